@@ -24,6 +24,7 @@
  */
 #include <iostream>
 #include <boost/algorithm/string.hpp>
+#include <boost/optional.hpp>
 #include <QDebug>
 
 #include "app-logic/CoRegistrationData.h"
@@ -486,6 +487,8 @@ namespace
 			reducer_map["VOTE"] = 				REDUCER_VOTE;
 			reducer_map["WEIGHTED_MEAN"] =		REDUCER_WEIGHTED_MEAN;
 			reducer_map["PERCENTILE"] = 		REDUCER_PERCENTILE;
+			reducer_map["APPROXIMATE_MEDIAN"] =	REDUCER_APPROXIMATE_MEDIAN;
+			reducer_map["APPROXIMATE_VOTE"] =	REDUCER_APPROXIMATE_VOTE;
 
 			ConfigurationTableRow row;
 			QString tmp_line = line.trimmed().simplified();
@@ -516,7 +519,34 @@ namespace
 			row.attr_type = it != attr_map.end() ?  it->second : CO_REGISTRATION_GPML_ATTRIBUTE;
 			row.attr_name = items[ATTR_NAME].trimmed();
 
-			row.reducer_type = reducer_map[items[DATA_OP].trimmed().toUpper()];
+			// The approximate reducers accept an optional accuracy, eg, "APPROXIMATE_MEDIAN(200)".
+			QString data_op = items[DATA_OP].trimmed().toUpper();
+			boost::optional<unsigned int> data_op_accuracy;
+			const int data_op_paren_index = data_op.indexOf('(');
+			if (data_op_paren_index >= 0)
+			{
+				bool ok = false;
+				const unsigned int accuracy =
+						data_op.mid(data_op_paren_index + 1).remove(')').trimmed().toUInt(&ok);
+				if (ok && accuracy > 0)
+				{
+					data_op_accuracy = accuracy;
+				}
+				data_op = data_op.left(data_op_paren_index).trimmed();
+			}
+
+			row.reducer_type = reducer_map[data_op];
+			if (data_op_accuracy)
+			{
+				if (row.reducer_type == REDUCER_APPROXIMATE_MEDIAN)
+				{
+					row.approximate_quantile_compression = data_op_accuracy.get();
+				}
+				else if (row.reducer_type == REDUCER_APPROXIMATE_VOTE)
+				{
+					row.approximate_vote_max_num_counters = data_op_accuracy.get();
+				}
+			}
 
 			if(items[SHAPE_ATTR].trimmed() == "true")
 				row.attr_type =  CO_REGISTRATION_SHAPEFILE_ATTRIBUTE;
@@ -30,6 +30,7 @@
 
 #include "app-logic/ReconstructedFeatureGeometry.h"
 #include "data-mining/DataMiningUtils.h"
+#include "data-mining/DataTable.h"
 #include "opengl/GLContext.h"
 #include "opengl/GLRenderer.h"
 #include "presentation/Application.h"
@@ -120,6 +121,60 @@ GPlatesApi::PyCoregistrationLayerProxy::get_coregistration_data(
 }
 
 
+bp::list
+GPlatesApi::PyCoregistrationLayerProxy::get_coregistration_data_time_series(
+		bp::object times)
+{
+	std::vector<double> reconstruction_times;
+	bp::stl_input_iterator<double> times_iter(times), times_end;
+	for ( ; times_iter != times_end; ++times_iter)
+	{
+		reconstruction_times.push_back(*times_iter);
+	}
+
+	bp::list ret;
+	GPlatesOpenGL::GLContext::non_null_ptr_type gl_context =
+		GPlatesPresentation::Application::instance().get_main_window().
+		reconstruction_view_widget().globe_and_map_widget().get_active_gl_context();
+
+	// Make sure the context is currently active.
+	gl_context->make_current();
+
+	// Start a begin_render/end_render scope.
+	// NOTE: Before calling this, OpenGL should be in the default OpenGL state.
+	GPlatesOpenGL::GLRenderer::non_null_ptr_type renderer = gl_context->create_renderer();
+	GPlatesOpenGL::GLRenderer::RenderScope render_scope(*renderer);
+
+	std::vector<GPlatesAppLogic::CoRegistrationData::non_null_ptr_type> coregistration_data;
+	d_proxy->get_coregistration_data_time_series(*renderer, reconstruction_times, coregistration_data);
+
+	std::vector<const GPlatesDataMining::DataTable *> data_tables;
+	BOOST_FOREACH(
+			const GPlatesAppLogic::CoRegistrationData::non_null_ptr_type &time_step_coregistration_data,
+			coregistration_data)
+	{
+		data_tables.push_back(&time_step_coregistration_data->data_table());
+	}
+
+	GPlatesDataMining::DataTable long_format_table;
+	GPlatesDataMining::create_long_format_data_table(data_tables, long_format_table);
+
+	std::vector<std::vector<QString> > table;
+	long_format_table.to_qstring_table(table);
+	BOOST_FOREACH(const std::vector<QString>& row, table)
+	{
+		bp::list data_row;
+		BOOST_FOREACH(const QString& cell, row)
+		{
+			const QByteArray data_array = cell.toUtf8();
+			data_row.append(bp::str(data_array.data()));
+		}
+		ret.append(data_row);
+	}
+	return ret;
+}
+
+
 using namespace GPlatesApi;
 
 bp::list (PyCoregistrationLayerProxy::*get_current_coreg_data)(float) = 
@@ -138,6 +193,7 @@ export_coregistration_layer_proxy()
 		.def("get_associations",		&PyCoregistrationLayerProxy::get_associations)
 		.def("get_coregistration_data", get_current_coreg_data)
 		.def("get_coregistration_data", get_coreg_data)
+		.def("get_coregistration_data_time_series", &PyCoregistrationLayerProxy::get_coregistration_data_time_series)
 		;
 
 }
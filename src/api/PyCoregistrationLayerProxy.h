@@ -63,6 +63,15 @@ namespace GPlatesApi
 		
 		bp::list
 		get_coregistration_data();
+
+
+		/**
+		 * Co-registers each reconstruction time in the sequence @a times and returns the results
+		 * as a single long-format table (the first column is the reconstruction time).
+		 */
+		bp::list
+		get_coregistration_data_time_series(
+				bp::object times);
 	
 	private:
 		GPlatesAppLogic::CoRegistrationLayerProxy::non_null_ptr_type d_proxy;		
@@ -22,6 +22,7 @@
  * with this program; if not, write to Free Software Foundation, Inc.,
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
+#include <algorithm>
 #include <boost/bind/bind.hpp>
 #include <boost/foreach.hpp>
 #include <boost/utility/in_place_factory.hpp>
@@ -31,6 +32,7 @@
 #include "ReconstructionTreeCreator.h"
 #include "ReconstructUtils.h"
 
+#include "data-mining/CoRegGeometryDistanceCache.h"
 #include "data-mining/DataSelector.h"
 
 #include "model/ModelUtils.h"
@@ -42,6 +44,21 @@
 
 #include "utils/FeatureUtils.h"
 
+namespace GPlatesAppLogic
+{
+	namespace
+	{
+		/**
+		 * The maximum number of reconstruction times of a time series to co-register at once.
+		 *
+		 * The reconstructed seeds and targets (and their spatial indices) of all time steps in a batch
+		 * are in memory at the same time.
+		 */
+		const unsigned int MAX_TIME_SERIES_TIME_STEPS_PER_BATCH = 16;
+	}
+}
+
+
 GPlatesAppLogic::CoRegistrationLayerProxy::CoRegistrationLayerProxy() :
 	d_current_reconstruction_time(0)
 {
@@ -95,22 +112,7 @@ GPlatesAppLogic::CoRegistrationLayerProxy::get_coregistration_data(
 
 		// The target layer proxies (reconstructed geometries and/or rasters).
 		std::vector<LayerProxy::non_null_ptr_type> target_layer_proxies;
-
-		// Get the co-registration target (reconstructed geometries) layer proxies.
-		BOOST_FOREACH(
-				LayerProxyUtils::InputLayerProxy<ReconstructLayerProxy> &target_layer_proxy,
-				d_current_target_reconstruct_layer_proxies)
-		{
-			target_layer_proxies.push_back(target_layer_proxy.get_input_layer_proxy());
-		}
-
-		// Get the co-registration target (raster) layer proxies.
-		BOOST_FOREACH(
-				LayerProxyUtils::InputLayerProxy<RasterLayerProxy> &target_layer_proxy,
-				d_current_target_raster_layer_proxies)
-		{
-			target_layer_proxies.push_back(target_layer_proxy.get_input_layer_proxy());
-		}
+		get_target_layer_proxies(target_layer_proxies);
 
 		d_cached_coregistration_data = CoRegistrationData::create(reconstruction_time);
 
@@ -119,7 +121,7 @@ GPlatesAppLogic::CoRegistrationLayerProxy::get_coregistration_data(
 				GPlatesDataMining::DataSelector::create(
 						d_current_coregistration_configuration_table);
 
-		// Co-register rasters if we can (if the run-time system supports it).
+		// Co-register rasters using OpenGL if the run-time system supports it (otherwise on the CPU).
 		boost::optional<GPlatesDataMining::DataSelector::RasterCoRegistration> co_register_rasters;
 		if (get_raster_co_registration(renderer))
 		{
@@ -143,6 +145,83 @@ GPlatesAppLogic::CoRegistrationLayerProxy::get_coregistration_data(
 }
 
 
+void
+GPlatesAppLogic::CoRegistrationLayerProxy::get_coregistration_data_time_series(
+		GPlatesOpenGL::GLRenderer &renderer,
+		const std::vector<double> &reconstruction_times,
+		std::vector<CoRegistrationData::non_null_ptr_type> &coregistration_data)
+{
+	// See if any input layer proxies have changed.
+	check_input_layer_proxies();
+
+	// The target layer proxies (reconstructed geometries and/or rasters).
+	std::vector<LayerProxy::non_null_ptr_type> target_layer_proxies;
+	get_target_layer_proxies(target_layer_proxies);
+
+	// Does the actual co-registration work.
+	boost::shared_ptr<GPlatesDataMining::DataSelector> selector =
+			GPlatesDataMining::DataSelector::create(
+					d_current_coregistration_configuration_table);
+
+	// Co-register rasters using OpenGL if the run-time system supports it (otherwise on the CPU).
+	boost::optional<GPlatesDataMining::DataSelector::RasterCoRegistration> co_register_rasters;
+	if (get_raster_co_registration(renderer))
+	{
+		// Pass GPlatesDataMining::DataSelector::RasterCoRegistration constructor parameters to
+		// construct a new object directly in-place.
+		co_register_rasters = boost::in_place(
+				boost::ref(renderer),
+				boost::ref(get_raster_co_registration(renderer).get()));
+	}
+
+	// Distances between seeds and targets (recorded at the first reconstruction time) that are
+	// re-used at the other reconstruction times.
+	GPlatesDataMining::CoRegGeometryDistanceCache distance_cache;
+
+	// Co-register the time steps in batches (to limit the number of reconstructions in memory at once).
+	for (unsigned int batch_begin = 0;
+		batch_begin < reconstruction_times.size();
+		batch_begin += MAX_TIME_SERIES_TIME_STEPS_PER_BATCH)
+	{
+		const unsigned int batch_end = (std::min)(
+				batch_begin + MAX_TIME_SERIES_TIME_STEPS_PER_BATCH,
+				static_cast<unsigned int>(reconstruction_times.size()));
+
+		const std::vector<double> batch_reconstruction_times(
+				reconstruction_times.begin() + batch_begin,
+				reconstruction_times.begin() + batch_end);
+
+		std::vector<GPlatesDataMining::DataSelector::reconstructed_feature_seq_type> batch_reconstructed_seed_features(
+				batch_reconstruction_times.size());
+		std::vector<GPlatesDataMining::DataTable *> batch_data_tables;
+		for (unsigned int n = 0; n < batch_reconstruction_times.size(); ++n)
+		{
+			// Get the co-registration reconstructed seed features from the input seed layer proxies.
+			BOOST_FOREACH(
+					LayerProxyUtils::InputLayerProxy<ReconstructLayerProxy> &seed_layer_proxy,
+					d_current_seed_layer_proxies)
+			{
+				seed_layer_proxy.get_input_layer_proxy()->get_reconstructed_features(
+						batch_reconstructed_seed_features[n],
+						batch_reconstruction_times[n]);
+			}
+
+			coregistration_data.push_back(CoRegistrationData::create(batch_reconstruction_times[n]));
+			batch_data_tables.push_back(&coregistration_data.back()->data_table());
+		}
+
+		// Fill the co-registration data tables with results.
+		selector->select_time_series(
+				batch_reconstruction_times,
+				batch_reconstructed_seed_features,
+				target_layer_proxies,
+				batch_data_tables,
+				co_register_rasters,
+				distance_cache);
+	}
+}
+
+
 boost::optional<GPlatesAppLogic::CoRegistrationData::non_null_ptr_type>
 GPlatesAppLogic::CoRegistrationLayerProxy::get_birth_attribute_data(
 		GPlatesOpenGL::GLRenderer &renderer,
@@ -211,24 +290,9 @@ GPlatesAppLogic::CoRegistrationLayerProxy::get_birth_attribute_data(
 
 	// The target layer proxies (reconstructed geometries and/or rasters).
 	std::vector<LayerProxy::non_null_ptr_type> target_layer_proxies;
+	get_target_layer_proxies(target_layer_proxies);
 
-	// Get the co-registration target (reconstructed geometries) layer proxies.
-	BOOST_FOREACH(
-			LayerProxyUtils::InputLayerProxy<ReconstructLayerProxy> &target_layer_proxy,
-			d_current_target_reconstruct_layer_proxies)
-	{
-		target_layer_proxies.push_back(target_layer_proxy.get_input_layer_proxy());
-	}
-
-	// Get the co-registration target (raster) layer proxies.
-	BOOST_FOREACH(
-			LayerProxyUtils::InputLayerProxy<RasterLayerProxy> &target_layer_proxy,
-			d_current_target_raster_layer_proxies)
-	{
-		target_layer_proxies.push_back(target_layer_proxy.get_input_layer_proxy());
-	}
-
-	// Co-register rasters if we can (if the run-time system supports it).
+	// Co-register rasters using OpenGL if the run-time system supports it (otherwise on the CPU).
 	boost::optional<GPlatesDataMining::DataSelector::RasterCoRegistration> co_register_rasters;
 	if (get_raster_co_registration(renderer))
 	{
@@ -442,6 +506,28 @@ GPlatesAppLogic::CoRegistrationLayerProxy::check_input_layer_proxies()
 }
 
 
+void
+GPlatesAppLogic::CoRegistrationLayerProxy::get_target_layer_proxies(
+		std::vector<LayerProxy::non_null_ptr_type> &target_layer_proxies)
+{
+	// Get the co-registration target (reconstructed geometries) layer proxies.
+	BOOST_FOREACH(
+			LayerProxyUtils::InputLayerProxy<ReconstructLayerProxy> &target_layer_proxy,
+			d_current_target_reconstruct_layer_proxies)
+	{
+		target_layer_proxies.push_back(target_layer_proxy.get_input_layer_proxy());
+	}
+
+	// Get the co-registration target (raster) layer proxies.
+	BOOST_FOREACH(
+			LayerProxyUtils::InputLayerProxy<RasterLayerProxy> &target_layer_proxy,
+			d_current_target_raster_layer_proxies)
+	{
+		target_layer_proxies.push_back(target_layer_proxy.get_input_layer_proxy());
+	}
+}
+
+
 boost::optional<GPlatesOpenGL::GLRasterCoRegistration &>
 GPlatesAppLogic::CoRegistrationLayerProxy::get_raster_co_registration(
 		GPlatesOpenGL::GLRenderer &renderer)
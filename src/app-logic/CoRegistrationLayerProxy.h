@@ -115,6 +115,24 @@ namespace GPlatesAppLogic
 				const double &reconstruction_time);
 
 
+		/**
+		 * Co-registers a time series - appends the co-registration data at each of @a reconstruction_times
+		 * to @a coregistration_data (in the same order).
+		 *
+		 * This is faster than calling @a get_coregistration_data at each reconstruction time since
+		 * the time steps are co-registered in parallel, and the distances between seed and target
+		 * geometries that move together (eg, on the same plate) are re-used across time steps
+		 * (see GPlatesDataMining::DataSelector::select_time_series).
+		 *
+		 * Note that, unlike @a get_coregistration_data, the co-registration data is not cached.
+		 */
+		void
+		get_coregistration_data_time_series(
+				GPlatesOpenGL::GLRenderer &renderer,
+				const std::vector<double> &reconstruction_times,
+				std::vector<CoRegistrationData::non_null_ptr_type> &coregistration_data);
+
+
 		/**
 		 * Returns all the attribute data at the birth time of the seed feature.
 		 * Normally, the return value is a one-row table.
@@ -323,6 +341,13 @@ namespace GPlatesAppLogic
 		void
 		check_input_layer_proxies();
 
+		/**
+		 * Returns the co-registration target (reconstructed geometries and raster) layer proxies.
+		 */
+		void
+		get_target_layer_proxies(
+				std::vector<LayerProxy::non_null_ptr_type> &target_layer_proxies);
+
 		/**
 		 * Returns the raster co-registration and creates one the first time this method is called.
 		 *
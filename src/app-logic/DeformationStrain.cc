@@ -23,149 +23,423 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <algorithm> // std::swap
 #include <cmath>
+#include <cstddef>
 
 #include "DeformationStrain.h"
 
 #include "maths/MathsUtils.h"
 
+#include "utils/ParallelUtils.h"
 
-const GPlatesAppLogic::DeformationStrain::StrainPrincipal
-GPlatesAppLogic::DeformationStrain::get_strain_principal() const
+
+namespace GPlatesAppLogic
 {
-	//
-	// The stretch along a deformed normal direction n is (|dx|/|dX|) where dx and dX are
-	// deformed and undeformed element vectors. The square of the stretch is
-	//
-	//   stretch(n)^2 = |dx|^2 / |dX|^2
-	//                = (dx.dx) / (dX.dX)
-	//   1 / stretch(n)^2 = (dX.dX) / (dx.dx)
-	//                    = ((F^-1 * dx).(F^-1 * dx)) / (dx.dx)
-	//                    = (dx * transpose(F^-1) * F^-1 * dx) / (dx.dx)
-	//                    = (dx * c * dx) / (dx.dx)
-	//                    = (dx * c * dx) / |dx|^2
-	//                    = n.c.n
-	//
-	// where "n = dx / |dx|" and "c = transpose(F^-1) * F^-1" is the Cauchy deformation tensor in terms
-	// of the deformation gradient tensor F.
-	//
-	// The principal axes are orthogonal and this occurs when the two deformed normal directions
-	// dx1 and dx2 are aligned with the principal axes, which happens when their dot product is zero.
-	// And these principal axes rotated back into the undeformed configuration with undeformed normal
-	// directions dX1 and dX2 that will also be orthogonal with a zero dot product defined by
-	// 
-	//   0 = dX1.dX2
-	//     = (F^-1 * dx1).(F^-1 * dx2)
-	//     = dx1.transpose(F^-1).(F^-1).dx2
-	//     = dx1.c.dx2
-	// 
-	// and dividing by |dx1|*|dx2| we have
-	// 
-	//   0 = dx1.c.dx2 / (|dx1|*|dx2|)
-	//     = n1.c.n2
-	// 
-	// where n1 and n2 are orthogonal principal axes in deformed configuration.
-	// If we set n1 at an angle 'angle' to the original axes (and n2 at 90 degrees larger) then
-	// 
-	//   n1 = (cos(angle) , sin(angle))
-	//   n2 = (-sin(angle), cos(angle))
-	//
-	//   0 = n1.c.n2
-	//     = (c_22 - c_11) * sin(angle) * cos(angle) + c_12 * (cos^2(angle) - sin^2(angle))
-	//
-	// which is equivalent to
-	// 
-	//   tan(2*angle) = 2 * c_12 / (c_11 - c_22)
-	// 
-	// which gives us the angle of rotation of the principal axes in the deformed configuration.
-	// 
-	// To get c we first need the inverse of F
-	// 
-	//   F^-1 = 1/det(F) * |  F_22 -F_12 |
-	//                     | -F_21  F_11 |
-	// 
-	//   c    = transpose(F^-1) * (F^-1)
-	//   c_11 = 1/det(F)^2 * (F_22^2 + F_21^2)
-	//   c_22 = 1/det(F)^2 * (F_12^2 + F_11^2)
-	//   c_12 = 1/det(F)^2 * (-F_12*F_22 - F_11*F_21)
-	//   c_21 = c_12
-	//
-	// And from previously we have
-	// 
-	//   1 / stretch(n1)^2 = n1.c.n1
-	//   1 / stretch(n2)^2 = n2.c.n2
-	// 
-	// where
-	// 
-	//   n1.c.n1 = c_11 * cos^2(angle) + c_22 * sin^2(angle) + 2 * c_12 * sin(angle) * cos(angle)
-	//   n2.c.n2 = c_11 * sin^2(angle) + c_22 * cos^2(angle) - 2 * c_12 * sin(angle) * cos(angle)
-	//
-	// and the engineering strain in the principal directions n1 and n2 are
-	// 
-	//   strain(n1) = (|dx1| - |dX1|) / |dX1| = stretch(n1) - 1 = 1/sqrt(n1.c.n1) - 1
-	//   strain(n2) = (|dx2| - |dX2|) / |dX2| = stretch(n2) - 1 = 1/sqrt(n2.c.n2) - 1
-	//
-	//
-	// References:
-	// 
-	//    Section 4.8 of "Continuum mechanics for engineers" by Mase.
-	//    
-	//    Principal Strains & Invariants - http://www.continuummechanics.org/principalstrain.html
-	//   
-
-	const double F_det =
-			d_deformation_gradient.theta_theta * d_deformation_gradient.phi_phi -
-			d_deformation_gradient.theta_phi * d_deformation_gradient.phi_theta;
-	// Deformation gradient tensor F only has an inverse if it's determinant is non-zero
-	// (which should always be the case, but we'll check to be sure).
-	if (F_det <= 0.0)
+	namespace
 	{
-		// Return zero strain.
-		return StrainPrincipal(0.0/*strain1*/, 0.0/*strain2*/, 0.0/*angle*/);
-	}
+		/**
+		 * Calculates the principal strain of deformation gradient tensor F.
+		 *
+		 * This is inline (and has no branches) so that it can be vectorised in the batched loops.
+		 */
+		inline
+		void
+		calculate_strain_principal(
+				DeformationStrain::StrainPrincipal &strain_principal,
+				const DeformationStrain::DeformationGradient &deformation_gradient)
+		{
+			//
+			// The stretch along a deformed normal direction n is (|dx|/|dX|) where dx and dX are
+			// deformed and undeformed element vectors. The square of the stretch is
+			//
+			//   stretch(n)^2 = |dx|^2 / |dX|^2
+			//                = (dx.dx) / (dX.dX)
+			//   1 / stretch(n)^2 = (dX.dX) / (dx.dx)
+			//                    = ((F^-1 * dx).(F^-1 * dx)) / (dx.dx)
+			//                    = (dx * transpose(F^-1) * F^-1 * dx) / (dx.dx)
+			//                    = (dx * c * dx) / (dx.dx)
+			//                    = (dx * c * dx) / |dx|^2
+			//                    = n.c.n
+			//
+			// where "n = dx / |dx|" and "c = transpose(F^-1) * F^-1" is the Cauchy deformation tensor in terms
+			// of the deformation gradient tensor F.
+			//
+			// The principal axes are orthogonal and this occurs when the two deformed normal directions
+			// dx1 and dx2 are aligned with the principal axes, which happens when their dot product is zero.
+			// And these principal axes rotated back into the undeformed configuration with undeformed normal
+			// directions dX1 and dX2 that will also be orthogonal with a zero dot product defined by
+			// 
+			//   0 = dX1.dX2
+			//     = (F^-1 * dx1).(F^-1 * dx2)
+			//     = dx1.transpose(F^-1).(F^-1).dx2
+			//     = dx1.c.dx2
+			// 
+			// and dividing by |dx1|*|dx2| we have
+			// 
+			//   0 = dx1.c.dx2 / (|dx1|*|dx2|)
+			//     = n1.c.n2
+			// 
+			// where n1 and n2 are orthogonal principal axes in deformed configuration.
+			// If we set n1 at an angle 'angle' to the original axes (and n2 at 90 degrees larger) then
+			// 
+			//   n1 = (cos(angle) , sin(angle))
+			//   n2 = (-sin(angle), cos(angle))
+			//
+			//   0 = n1.c.n2
+			//     = (c_22 - c_11) * sin(angle) * cos(angle) + c_12 * (cos^2(angle) - sin^2(angle))
+			//
+			// which is equivalent to
+			// 
+			//   tan(2*angle) = 2 * c_12 / (c_11 - c_22)
+			// 
+			// which gives us the angle of rotation of the principal axes in the deformed configuration.
+			// 
+			// To get c we first need the inverse of F
+			// 
+			//   F^-1 = 1/det(F) * |  F_22 -F_12 |
+			//                     | -F_21  F_11 |
+			// 
+			//   c    = transpose(F^-1) * (F^-1)
+			//   c_11 = 1/det(F)^2 * (F_22^2 + F_21^2)
+			//   c_22 = 1/det(F)^2 * (F_12^2 + F_11^2)
+			//   c_12 = 1/det(F)^2 * (-F_12*F_22 - F_11*F_21)
+			//   c_21 = c_12
+			//
+			// And from previously we have
+			// 
+			//   1 / stretch(n1)^2 = n1.c.n1
+			//   1 / stretch(n2)^2 = n2.c.n2
+			// 
+			// where
+			// 
+			//   n1.c.n1 = c_11 * cos^2(angle) + c_22 * sin^2(angle) + 2 * c_12 * sin(angle) * cos(angle)
+			//   n2.c.n2 = c_11 * sin^2(angle) + c_22 * cos^2(angle) - 2 * c_12 * sin(angle) * cos(angle)
+			//
+			// and the engineering strain in the principal directions n1 and n2 are
+			// 
+			//   strain(n1) = (|dx1| - |dX1|) / |dX1| = stretch(n1) - 1 = 1/sqrt(n1.c.n1) - 1
+			//   strain(n2) = (|dx2| - |dX2|) / |dX2| = stretch(n2) - 1 = 1/sqrt(n2.c.n2) - 1
+			//
+			//
+			// References:
+			// 
+			//    Section 4.8 of "Continuum mechanics for engineers" by Mase.
+			//    
+			//    Principal Strains & Invariants - http://www.continuummechanics.org/principalstrain.html
+			//   
 
-	const double inv_square_F_det = 1.0 / (F_det * F_det);
-	const double c_theta_theta = inv_square_F_det * (
-			d_deformation_gradient.phi_phi * d_deformation_gradient.phi_phi +
-			d_deformation_gradient.phi_theta * d_deformation_gradient.phi_theta);
-	const double c_phi_phi = inv_square_F_det * (
-			d_deformation_gradient.theta_phi * d_deformation_gradient.theta_phi +
-			d_deformation_gradient.theta_theta * d_deformation_gradient.theta_theta);
-	const double c_theta_phi = inv_square_F_det * (
-			-d_deformation_gradient.theta_phi * d_deformation_gradient.phi_phi -
-			d_deformation_gradient.theta_theta * d_deformation_gradient.phi_theta);
-
-	double angle = 0.5 * std::atan2(2 * c_theta_phi, c_theta_theta - c_phi_phi);
-	const double cos_angle = std::cos(angle);
-	const double sin_angle = std::sin(angle);
-
-	const double c1 = c_theta_theta * cos_angle * cos_angle +
-			c_phi_phi * sin_angle * sin_angle +
-			2.0 * c_theta_phi * sin_angle * cos_angle;
-	const double c2 = c_theta_theta * sin_angle * sin_angle +
-			c_phi_phi * cos_angle * cos_angle -
-			2.0 * c_theta_phi * sin_angle * cos_angle;
-
-	// Cauchy deformation tensor 'c' is symmetric and positive definite, so its eigenvalues c1 and c2 are positive.
-	double strain1 = (1.0 / std::sqrt(c1)) - 1.0;
-	double strain2 = (1.0 / std::sqrt(c2)) - 1.0;
-
-	// Keep the largest strain (positive is extension, negative is compression)
-	// in the first strain. Swap if necessary, including the angle which we have specified
-	// to always be relative to the first strain.
-	//
-	// Note: It might be possible to always swap them (without checking) since the eigenvalues
-	// c1 and c2 of the Cauchy deformation tensor 'c' might be such that c1 > c2 always holds, and
-	// hence strain2 > strain1 is always true. But I'm not sure so we'll check anyway.
-	if (strain2 > strain1)
-	{
-		std::swap(strain1, strain2);
-		// The second strain is 90 degrees larger than the first strain.
-		angle += GPlatesMaths::HALF_PI;
+			const double F_det =
+					deformation_gradient.theta_theta * deformation_gradient.phi_phi -
+					deformation_gradient.theta_phi * deformation_gradient.phi_theta;
+			// Deformation gradient tensor F only has an inverse if it's determinant is non-zero
+			// (which should always be the case, but we'll check to be sure).
+			// If it's not invertible then we'll return zero strain (but avoid divide-by-zero in the meantime).
+			const bool is_invertible = (F_det > 0.0);
+			const double safe_F_det = is_invertible ? F_det : 1.0;
+
+			const double inv_square_F_det = 1.0 / (safe_F_det * safe_F_det);
+			const double c_theta_theta = inv_square_F_det * (
+					deformation_gradient.phi_phi * deformation_gradient.phi_phi +
+					deformation_gradient.phi_theta * deformation_gradient.phi_theta);
+			const double c_phi_phi = inv_square_F_det * (
+					deformation_gradient.theta_phi * deformation_gradient.theta_phi +
+					deformation_gradient.theta_theta * deformation_gradient.theta_theta);
+			const double c_theta_phi = inv_square_F_det * (
+					-deformation_gradient.theta_phi * deformation_gradient.phi_phi -
+					deformation_gradient.theta_theta * deformation_gradient.phi_theta);
+
+			const double angle = 0.5 * std::atan2(2 * c_theta_phi, c_theta_theta - c_phi_phi);
+			const double cos_angle = std::cos(angle);
+			const double sin_angle = std::sin(angle);
+
+			const double c1 = c_theta_theta * cos_angle * cos_angle +
+					c_phi_phi * sin_angle * sin_angle +
+					2.0 * c_theta_phi * sin_angle * cos_angle;
+			const double c2 = c_theta_theta * sin_angle * sin_angle +
+					c_phi_phi * cos_angle * cos_angle -
+					2.0 * c_theta_phi * sin_angle * cos_angle;
+
+			// Cauchy deformation tensor 'c' is symmetric and positive definite, so its eigenvalues c1 and c2 are positive.
+			const double strain1 = (1.0 / std::sqrt(c1)) - 1.0;
+			const double strain2 = (1.0 / std::sqrt(c2)) - 1.0;
+
+			// Keep the largest strain (positive is extension, negative is compression)
+			// in the first strain. Swap if necessary, including the angle which we have specified
+			// to always be relative to the first strain.
+			//
+			// Note: It might be possible to always swap them (without checking) since the eigenvalues
+			// c1 and c2 of the Cauchy deformation tensor 'c' might be such that c1 > c2 always holds, and
+			// hence strain2 > strain1 is always true. But I'm not sure so we'll check anyway.
+			const bool swap_strains = (strain2 > strain1);
+
+			strain_principal.principal1 = is_invertible ? (swap_strains ? strain2 : strain1) : 0.0;
+			strain_principal.principal2 = is_invertible ? (swap_strains ? strain1 : strain2) : 0.0;
+			// The second strain is 90 degrees larger than the first strain.
+			strain_principal.angle = is_invertible ? (swap_strains ? angle + GPlatesMaths::HALF_PI : angle) : 0.0;
+		}
+
+
+		/**
+		 * Accumulates the previous deformation gradient tensor F using the previous and current
+		 * velocity spatial gradients L over a time increment.
+		 *
+		 * This is inline (and has no branches) so that it can be vectorised in the batched loops.
+		 */
+		inline
+		void
+		accumulate_deformation_gradient(
+				DeformationStrain::DeformationGradient &curr_f,
+				const DeformationStrain::DeformationGradient &prev_f,
+				const DeformationStrainRate::VelocitySpatialGradient &prev_l,
+				const DeformationStrainRate::VelocitySpatialGradient &curr_l,
+				const double &dt)
+		{
+			//
+			// The rate of change of deformation gradient tensor F is:
+			//
+			//   dF/dt = L * F
+			//
+			// ...where L is the velocity spatial gradient (see chapter 4 of
+			// "Introduction to the mechanics of a continuous medium" by Malvern).
+			//
+			// We use the central difference scheme to solve the above ordinary differential equation (ODE):
+			//
+			//   F(n+1) - F(n)
+			//   ------------- = (L(n+1)*F(n+1) + L(n)*F(n)) / 2
+			//         dt
+			//
+			//   (I - L(n+1)*dt/2) * F(n+1) = (I + L(n)*dt/2) * F(n)
+			//
+			// ...which in matrix form is...
+			//
+			//   F(n+1) = inverse[I - L(n+1)*dt/2] * (I + L(n)*dt/2) * F(n)
+			//
+			// ...which is 2x2 matrix inversion and subsequent multiplication.
+			// 
+			// Inverse of 2x2 matrix:
+			//
+			//   |a11 a12|
+			//   |a21 a22|
+			//
+			// ...is...
+			//
+			//           1          |a22  -a12|
+			//   -----------------  |-a21  a11|
+			//   (a11*a22-a12*a21)
+			//
+			//
+			//   F(n+1) = inverse[I - L(n+1)*dt/2] * (I + L(n)*dt/2) * F(n)
+			//
+			//   |F11(n+1) F12(n+1)|    1  | 1 - L22(n+1)*dt/2 L12(n+1)*dt/2    | * | 1 + L11(n)*dt/2 L12(n)*dt/2     | * |F11(n) F12(n)|
+			//   |F21(n+1) F22(n+1)| = --- | L21(n+1)*dt/2    1 - L11(n+1)*dt/2 |   | L21(n)*dt/2     1 + L22(n)*dt/2 |   |F21(n) F22(n)|
+			//                          D
+			//
+			// ...where D is Determinant(I - L(n+1)*dt/2)...
+			//
+			//   D = (1 - L11(n+1)*dt/2) * (1 - L22(n+1)*dt/2) - (L12(n+1)*dt/2) * (L21(n+1)*dt/2)
+			//
+
+			// Determinant of matrix to invert.
+			const double d = (1 - 0.5 * curr_l.theta_theta * dt) * (1 - 0.5 * curr_l.phi_phi * dt) -
+					(0.5 * curr_l.theta_phi * dt) * (0.5 * curr_l.phi_theta * dt);
+
+			// Avoid divide-by-zero.
+			// If unable to invert matrix (this shouldn't happen for well-behaved values of velocity spatial gradient)
+			// then the previous deformation gradient is returned.
+			const bool is_invertible = !(d > -GPlatesMaths::EPSILON && d < GPlatesMaths::EPSILON);
+			const double inv_d = 1.0 / (is_invertible ? d : 1.0);
+
+			const double inv_curr_l_00 = inv_d * (1 - 0.5 * curr_l.phi_phi * dt);
+			const double inv_curr_l_01 = inv_d * (0.5 * curr_l.theta_phi * dt);
+			const double inv_curr_l_10 = inv_d * (0.5 * curr_l.phi_theta * dt);
+			const double inv_curr_l_11 = inv_d * (1 - 0.5 * curr_l.theta_theta * dt);
+
+			const double prev_l_00 = 1 + 0.5 * prev_l.theta_theta * dt;
+			const double prev_l_01 = 0.5 * prev_l.theta_phi * dt;
+			const double prev_l_10 = 0.5 * prev_l.phi_theta * dt;
+			const double prev_l_11 = 1 + 0.5 * prev_l.phi_phi * dt;
+
+			// inverse[I - L(n+1)*dt/2] * (I + L(n)*dt/2)
+			const double m_00 = inv_curr_l_00 * prev_l_00 + inv_curr_l_01 * prev_l_10;
+			const double m_01 = inv_curr_l_00 * prev_l_01 + inv_curr_l_01 * prev_l_11;
+			const double m_10 = inv_curr_l_10 * prev_l_00 + inv_curr_l_11 * prev_l_10;
+			const double m_11 = inv_curr_l_10 * prev_l_01 + inv_curr_l_11 * prev_l_11;
+
+			// Read all of the previous F before writing the current F (in case they're the same object).
+			const double f_00 = m_00 * prev_f.theta_theta + m_01 * prev_f.phi_theta;
+			const double f_01 = m_00 * prev_f.theta_phi + m_01 * prev_f.phi_phi;
+			const double f_10 = m_10 * prev_f.theta_theta + m_11 * prev_f.phi_theta;
+			const double f_11 = m_10 * prev_f.theta_phi + m_11 * prev_f.phi_phi;
+
+			curr_f.theta_theta = is_invertible ? f_00 : prev_f.theta_theta;
+			curr_f.theta_phi = is_invertible ? f_01 : prev_f.theta_phi;
+			curr_f.phi_theta = is_invertible ? f_10 : prev_f.phi_theta;
+			curr_f.phi_phi = is_invertible ? f_11 : prev_f.phi_phi;
+		}
+
+
+		/**
+		 * Linearly interpolates two deformation gradient tensors.
+		 */
+		inline
+		void
+		interpolate_deformation_gradient(
+				DeformationStrain::DeformationGradient &f,
+				const DeformationStrain::DeformationGradient &first_f,
+				const DeformationStrain::DeformationGradient &second_f,
+				const double &position)
+		{
+			f.theta_theta = (1 - position) * first_f.theta_theta + position * second_f.theta_theta;
+			f.theta_phi = (1 - position) * first_f.theta_phi + position * second_f.theta_phi;
+			f.phi_theta = (1 - position) * first_f.phi_theta + position * second_f.phi_theta;
+			f.phi_phi = (1 - position) * first_f.phi_phi + position * second_f.phi_phi;
+		}
+
+
+		/**
+		 * The minimum number of strains processed by each thread in the batched functions.
+		 *
+		 * Each strain is only a few dozen floating-point operations so small batches
+		 * (such as a single time slot of a small geometry) are not worth starting threads for.
+		 */
+		const std::size_t MIN_STRAINS_PER_CHUNK = 16384;
+
+
+		/**
+		 * Accumulates a sub-range of strains (called concurrently from multiple threads).
+		 *
+		 * Each strain is accumulated independently of the others (there are no reductions),
+		 * so the results do not depend on how the strains are divided between threads.
+		 */
+		class AccumulateStrains
+		{
+		public:
+
+			AccumulateStrains(
+					DeformationStrain *strains,
+					const DeformationStrainRate *previous_strain_rates,
+					const DeformationStrainRate *current_strain_rates,
+					const double &time_increment) :
+				d_strains(strains),
+				d_previous_strain_rates(previous_strain_rates),
+				d_current_strain_rates(current_strain_rates),
+				d_time_increment(time_increment)
+			{  }
+
+			void
+			operator()(
+					std::size_t begin,
+					std::size_t end) const
+			{
+				for (std::size_t n = begin; n < end; ++n)
+				{
+					DeformationStrain::DeformationGradient deformation_gradient;
+					accumulate_deformation_gradient(
+							deformation_gradient,
+							d_strains[n].get_deformation_gradient(),
+							d_previous_strain_rates[n].get_velocity_spatial_gradient(),
+							d_current_strain_rates[n].get_velocity_spatial_gradient(),
+							d_time_increment);
+
+					d_strains[n] = DeformationStrain(deformation_gradient);
+				}
+			}
+
+		private:
+
+			DeformationStrain *d_strains;
+			const DeformationStrainRate *d_previous_strain_rates;
+			const DeformationStrainRate *d_current_strain_rates;
+			double d_time_increment;
+		};
+
+
+		/**
+		 * Interpolates a sub-range of strains (called concurrently from multiple threads).
+		 */
+		class InterpolateStrains
+		{
+		public:
+
+			InterpolateStrains(
+					DeformationStrain *interpolated_strains,
+					const DeformationStrain *first_strains,
+					const DeformationStrain *second_strains,
+					const double &position) :
+				d_interpolated_strains(interpolated_strains),
+				d_first_strains(first_strains),
+				d_second_strains(second_strains),
+				d_position(position)
+			{  }
+
+			void
+			operator()(
+					std::size_t begin,
+					std::size_t end) const
+			{
+				for (std::size_t n = begin; n < end; ++n)
+				{
+					DeformationStrain::DeformationGradient deformation_gradient;
+					interpolate_deformation_gradient(
+							deformation_gradient,
+							d_first_strains[n].get_deformation_gradient(),
+							d_second_strains[n].get_deformation_gradient(),
+							d_position);
+
+					d_interpolated_strains[n] = DeformationStrain(deformation_gradient);
+				}
+			}
+
+		private:
+
+			DeformationStrain *d_interpolated_strains;
+			const DeformationStrain *d_first_strains;
+			const DeformationStrain *d_second_strains;
+			double d_position;
+		};
+
+
+		/**
+		 * Calculates the principal strains of a sub-range of strains (called concurrently from multiple threads).
+		 */
+		class GetStrainPrincipals
+		{
+		public:
+
+			GetStrainPrincipals(
+					DeformationStrain::StrainPrincipal *strain_principals,
+					const DeformationStrain *strains) :
+				d_strain_principals(strain_principals),
+				d_strains(strains)
+			{  }
+
+			void
+			operator()(
+					std::size_t begin,
+					std::size_t end) const
+			{
+				for (std::size_t n = begin; n < end; ++n)
+				{
+					calculate_strain_principal(d_strain_principals[n], d_strains[n].get_deformation_gradient());
+				}
+			}
+
+		private:
+
+			DeformationStrain::StrainPrincipal *d_strain_principals;
+			const DeformationStrain *d_strains;
+		};
 	}
+}
+
+
+const GPlatesAppLogic::DeformationStrain::StrainPrincipal
+GPlatesAppLogic::DeformationStrain::get_strain_principal() const
+{
+	StrainPrincipal strain_principal;
+	calculate_strain_principal(strain_principal, d_deformation_gradient);
 
-	return StrainPrincipal(strain1, strain2, angle);
+	return strain_principal;
 }
 
 
@@ -176,112 +450,15 @@ GPlatesAppLogic::accumulate_strain(
 		const DeformationStrainRate &current_strain_rate,
 		const double &time_increment)
 {
-	//
-	// The rate of change of deformation gradient tensor F is:
-	//
-	//   dF/dt = L * F
-	//
-	// ...where L is the velocity spatial gradient (see chapter 4 of
-	// "Introduction to the mechanics of a continuous medium" by Malvern).
-	//
-	// We use the central difference scheme to solve the above ordinary differential equation (ODE):
-	//
-	//   F(n+1) - F(n)
-	//   ------------- = (L(n+1)*F(n+1) + L(n)*F(n)) / 2
-	//         dt
-	//
-	//   (I - L(n+1)*dt/2) * F(n+1) = (I + L(n)*dt/2) * F(n)
-	//
-	// ...which in matrix form is...
-	//
-	//   F(n+1) = inverse[I - L(n+1)*dt/2] * (I + L(n)*dt/2) * F(n)
-	//
-	// ...which is 2x2 matrix inversion and subsequent multiplication.
-	// 
-	// Inverse of 2x2 matrix:
-	//
-	//   |a11 a12|
-	//   |a21 a22|
-	//
-	// ...is...
-	//
-	//           1          |a22  -a12|
-	//   -----------------  |-a21  a11|
-	//   (a11*a22-a12*a21)
-	//
-	//
-	//   F(n+1) = inverse[I - L(n+1)*dt/2] * (I + L(n)*dt/2) * F(n)
-	//
-	//   |F11(n+1) F12(n+1)|    1  | 1 - L22(n+1)*dt/2 L12(n+1)*dt/2    | * | 1 + L11(n)*dt/2 L12(n)*dt/2     | * |F11(n) F12(n)|
-	//   |F21(n+1) F22(n+1)| = --- | L21(n+1)*dt/2    1 - L11(n+1)*dt/2 |   | L21(n)*dt/2     1 + L22(n)*dt/2 |   |F21(n) F22(n)|
-	//                          D
-	//
-	// ...where D is Determinant(I - L(n+1)*dt/2)...
-	//
-	//   D = (1 - L11(n+1)*dt/2) * (1 - L22(n+1)*dt/2) - (L12(n+1)*dt/2) * (L21(n+1)*dt/2)
-	//
-
-	const DeformationStrain::DeformationGradient &prev_f = previous_strain.get_deformation_gradient();
-	const DeformationStrainRate::VelocitySpatialGradient &prev_l = previous_strain_rate.get_velocity_spatial_gradient();
-	const DeformationStrainRate::VelocitySpatialGradient &curr_l = current_strain_rate.get_velocity_spatial_gradient();
-
-	const double dt = time_increment;
-
-	// Determinant of matrix to invert.
-	const double d = (1 - 0.5 * curr_l.theta_theta * dt) * (1 - 0.5 * curr_l.phi_phi * dt) -
-			(0.5 * curr_l.theta_phi * dt) * (0.5 * curr_l.phi_theta * dt);
-
-	// Avoid divide-by-zero.
-	if (d > -GPlatesMaths::EPSILON &&
-		d < GPlatesMaths::EPSILON)
-	{
-		// Unable to invert matrix - this shouldn't happen for well-behaved values of velocity spatial gradient.
-		// Return the previous strain.
-		return DeformationStrain(prev_f);
-	}
-	const double inv_d = 1.0 / d;
-
-	double inv_curr_l_mat[2][2];
-	inv_curr_l_mat[0][0] = inv_d * (1 - 0.5 * curr_l.phi_phi * dt);
-	inv_curr_l_mat[0][1] = inv_d * (0.5 * curr_l.theta_phi * dt);
-	inv_curr_l_mat[1][0] = inv_d * (0.5 * curr_l.phi_theta * dt);
-	inv_curr_l_mat[1][1] = inv_d * (1 - 0.5 * curr_l.theta_theta * dt);
-
-	double prev_l_mat[2][2];
-	prev_l_mat[0][0] = 1 + 0.5 * prev_l.theta_theta * dt;
-	prev_l_mat[0][1] = 0.5 * prev_l.theta_phi * dt;
-	prev_l_mat[1][0] = 0.5 * prev_l.phi_theta * dt;
-	prev_l_mat[1][1] = 1 + 0.5 * prev_l.phi_phi * dt;
-
-	double prev_f_mat[2][2];
-	prev_f_mat[0][0] = prev_f.theta_theta;
-	prev_f_mat[0][1] = prev_f.theta_phi;
-	prev_f_mat[1][0] = prev_f.phi_theta;
-	prev_f_mat[1][1] = prev_f.phi_phi;
-
-	double inv_curr_l_mult_prev_l_mat[2][2];
-	for (int i = 0; i < 2; ++i)
-	{
-		for (int j = 0; j < 2; ++j)
-		{
-			inv_curr_l_mult_prev_l_mat[i][j] =
-				inv_curr_l_mat[i][0] * prev_l_mat[0][j] +
-				inv_curr_l_mat[i][1] * prev_l_mat[1][j];
-		}
-	}
-
-	double curr_f[2][2];
-	for (int i = 0; i < 2; ++i)
-	{
-		for (int j = 0; j < 2; ++j)
-		{
-			curr_f[i][j] =
-				inv_curr_l_mult_prev_l_mat[i][0] * prev_f_mat[0][j] +
-				inv_curr_l_mult_prev_l_mat[i][1] * prev_f_mat[1][j];
-		}
-	}
+	DeformationStrain::DeformationGradient current_deformation_gradient;
+	accumulate_deformation_gradient(
+			current_deformation_gradient,
+			previous_strain.get_deformation_gradient(),
+			previous_strain_rate.get_velocity_spatial_gradient(),
+			current_strain_rate.get_velocity_spatial_gradient(),
+			time_increment);
 
-	return DeformationStrain(DeformationStrain::DeformationGradient(curr_f[0][0], curr_f[0][1], curr_f[1][0], curr_f[1][1]));
+	return DeformationStrain(current_deformation_gradient);
 }
 
 
@@ -291,13 +468,55 @@ GPlatesAppLogic::interpolate_strain(
 		const DeformationStrain &second_strain,
 		const double &position)
 {
-	const DeformationStrain::DeformationGradient &first_deformation_gradient = first_strain.get_deformation_gradient();
-	const DeformationStrain::DeformationGradient &second_deformation_gradient = second_strain.get_deformation_gradient();
+	DeformationStrain::DeformationGradient deformation_gradient;
+	interpolate_deformation_gradient(
+			deformation_gradient,
+			first_strain.get_deformation_gradient(),
+			second_strain.get_deformation_gradient(),
+			position);
+
+	return DeformationStrain(deformation_gradient);
+}
+
+
+void
+GPlatesAppLogic::accumulate_strains(
+		DeformationStrain *strains,
+		const DeformationStrainRate *previous_strain_rates,
+		const DeformationStrainRate *current_strain_rates,
+		unsigned int num_strains,
+		const double &time_increment)
+{
+	GPlatesUtils::ParallelUtils::parallel_for(
+			num_strains,
+			AccumulateStrains(strains, previous_strain_rates, current_strain_rates, time_increment),
+			MIN_STRAINS_PER_CHUNK);
+}
+
+
+void
+GPlatesAppLogic::interpolate_strains(
+		DeformationStrain *interpolated_strains,
+		const DeformationStrain *first_strains,
+		const DeformationStrain *second_strains,
+		unsigned int num_strains,
+		const double &position)
+{
+	GPlatesUtils::ParallelUtils::parallel_for(
+			num_strains,
+			InterpolateStrains(interpolated_strains, first_strains, second_strains, position),
+			MIN_STRAINS_PER_CHUNK);
+}
 
-	const double f_theta_theta = (1 - position) * first_deformation_gradient.theta_theta + position * second_deformation_gradient.theta_theta;
-	const double f_theta_phi = (1 - position) * first_deformation_gradient.theta_phi + position * second_deformation_gradient.theta_phi;
-	const double f_phi_theta = (1 - position) * first_deformation_gradient.phi_theta + position * second_deformation_gradient.phi_theta;
-	const double f_phi_phi = (1 - position) * first_deformation_gradient.phi_phi + position * second_deformation_gradient.phi_phi;
 
-	return DeformationStrain(DeformationStrain::DeformationGradient(f_theta_theta, f_theta_phi, f_phi_theta, f_phi_phi));
+void
+GPlatesAppLogic::get_strain_principals(
+		DeformationStrain::StrainPrincipal *strain_principals,
+		const DeformationStrain *strains,
+		unsigned int num_strains)
+{
+	GPlatesUtils::ParallelUtils::parallel_for(
+			num_strains,
+			GetStrainPrincipals(strain_principals, strains),
+			MIN_STRAINS_PER_CHUNK);
 }
@@ -79,6 +79,13 @@ namespace GPlatesAppLogic
 
 		struct StrainPrincipal
 		{
+			//! Zero strain.
+			StrainPrincipal() :
+				principal1(0),
+				principal2(0),
+				angle(0)
+			{  }
+
 			StrainPrincipal(
 					const double &principal1_,
 					const double &principal2_,
@@ -241,6 +248,56 @@ namespace GPlatesAppLogic
 			const DeformationStrain &first_strain,
 			const DeformationStrain &second_strain,
 			const double &position);
+
+
+	/**
+	 * Batched version of @a accumulate_strain that accumulates @a num_strains strains in place
+	 * (each strain in @a strains is replaced by its accumulated strain) using the corresponding
+	 * previous and current strain rates over the same time increment.
+	 *
+	 * The results are identical to calling @a accumulate_strain on each strain, but the loop over
+	 * the contiguous arrays has no branches (and no function calls) so the compiler can vectorise it.
+	 *
+	 * Large batches are split across threads. Each strain is accumulated independently of the others
+	 * so the results are the same regardless of the number of threads.
+	 */
+	void
+	accumulate_strains(
+			DeformationStrain *strains,
+			const DeformationStrainRate *previous_strain_rates,
+			const DeformationStrainRate *current_strain_rates,
+			unsigned int num_strains,
+			const double &time_increment);
+
+
+	/**
+	 * Batched version of @a interpolate_strain that stores @a num_strains interpolated strains
+	 * in @a interpolated_strains (which must have room for @a num_strains elements).
+	 *
+	 * @a interpolated_strains can be the same array as @a first_strains (to interpolate in place).
+	 *
+	 * Like @a accumulate_strains, large batches are split across threads (with the same results).
+	 */
+	void
+	interpolate_strains(
+			DeformationStrain *interpolated_strains,
+			const DeformationStrain *first_strains,
+			const DeformationStrain *second_strains,
+			unsigned int num_strains,
+			const double &position);
+
+
+	/**
+	 * Batched version of DeformationStrain::get_strain_principal that stores the principal strains
+	 * of @a num_strains strains in @a strain_principals (which must have room for @a num_strains elements).
+	 *
+	 * Like @a accumulate_strains, large batches are split across threads (with the same results).
+	 */
+	void
+	get_strain_principals(
+			DeformationStrain::StrainPrincipal *strain_principals,
+			const DeformationStrain *strains,
+			unsigned int num_strains);
 }
 
 #endif // GPLATES_APP_LOGIC_DEFORMATION_STRAIN_H
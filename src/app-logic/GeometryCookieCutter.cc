@@ -43,6 +43,7 @@
 #include "TopologyUtils.h"
 
 #include "global/GPlatesAssert.h"
+#include "global/PreconditionViolationError.h"
 
 #include "maths/ConstGeometryOnSphereVisitor.h"
 
@@ -485,6 +486,44 @@ GPlatesAppLogic::GeometryCookieCutter::partition_point(
 }
 
 
+bool
+GPlatesAppLogic::GeometryCookieCutter::is_point_in_partitioning_polygon(
+		const GPlatesMaths::PointOnSphere &point,
+		unsigned int partitioning_polygon_index) const
+{
+	return d_partitioning_geometries[partitioning_polygon_index].d_polygon_partitioner->partition_point(point) !=
+			GPlatesMaths::PolygonPartitioner::GEOMETRY_OUTSIDE;
+}
+
+
+void
+GPlatesAppLogic::GeometryCookieCutter::prepare_concurrent_partition_point_queries() const
+{
+	// Adaptive point-in-polygon tests update the polygon's call count (even once fully built).
+	GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+			d_partition_point_speed_and_memory != GPlatesMaths::PolygonOnSphere::ADAPTIVE,
+			GPLATES_ASSERTION_SOURCE);
+
+	partitioning_geometry_seq_type::const_iterator partition_iter =
+			d_partitioning_geometries.begin();
+	partitioning_geometry_seq_type::const_iterator partition_end =
+			d_partitioning_geometries.end();
+	for ( ; partition_iter != partition_end; ++partition_iter)
+	{
+		const PartitioningGeometry &partitioning_geometry = *partition_iter;
+
+		const GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type partitioning_polygon =
+				partitioning_geometry.d_polygon_partitioner->get_partitioning_polygon();
+
+		// Any point will do - the first test builds the point-in-polygon structure.
+		partitioning_polygon->is_point_in_polygon(
+				GPlatesMaths::PointOnSphere(partitioning_polygon->get_boundary_centroid()),
+				d_partition_point_speed_and_memory);
+		partitioning_polygon->get_inner_outer_bounding_small_circle();
+	}
+}
+
+
 void
 GPlatesAppLogic::GeometryCookieCutter::add_partitioning_reconstruction_geometries(
 		const std::vector<ReconstructionGeometry::non_null_ptr_type> &reconstruction_geometries,
@@ -235,6 +235,53 @@ namespace GPlatesAppLogic
 				const GPlatesMaths::PointOnSphere &point) const;
 
 
+		/**
+		 * Returns the number of partitioning polygons.
+		 *
+		 * They are indexed in the order that @a partition_point tests them.
+		 */
+		unsigned int
+		get_num_partitioning_polygons() const
+		{
+			return d_partitioning_geometries.size();
+		}
+
+		/**
+		 * Returns the reconstruction geometry of the partitioning polygon at index @a partitioning_polygon_index.
+		 */
+		const ReconstructionGeometry *
+		get_partitioning_reconstruction_geometry(
+				unsigned int partitioning_polygon_index) const
+		{
+			return d_partitioning_geometries[partitioning_polygon_index].d_reconstruction_geometry.get();
+		}
+
+		/**
+		 * Returns true if the partitioning polygon at index @a partitioning_polygon_index contains @a point.
+		 *
+		 * This is the test that @a partition_point does on each partitioning polygon (in order)
+		 * until one contains the point. Like @a partition_point, it can be called concurrently
+		 * once @a prepare_concurrent_partition_point_queries has been called.
+		 */
+		bool
+		is_point_in_partitioning_polygon(
+				const GPlatesMaths::PointOnSphere &point,
+				unsigned int partitioning_polygon_index) const;
+
+
+		/**
+		 * Builds the point-in-polygon structures (and bounding small circles) of all partitioning
+		 * polygons so that @a partition_point can subsequently be called concurrently from multiple threads.
+		 *
+		 * NOTE: This must be called from a single thread.
+		 *
+		 * @throws PreconditionViolationError if the point-in-polygon speed (specified in constructor)
+		 * is ADAPTIVE (since adaptive point-in-polygon tests modify the polygons).
+		 */
+		void
+		prepare_concurrent_partition_point_queries() const;
+
+
 		/**
 		 * Returns the reconstruction time of the reconstructed partitioning polygons
 		 * used to partition geometry with.
@@ -131,6 +131,25 @@ namespace GPlatesAppLogic
 				LayerInputChannelName::Type input_channel_name,
 				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection) = 0;
 
+		/**
+		 * Existing features in an input file have been modified (no features were added or removed).
+		 *
+		 * This is called instead of @a modified_input_file when it is known exactly which
+		 * features in the feature collection were modified, so that layer tasks can avoid
+		 * reprocessing the unmodified features.
+		 *
+		 * The default implementation treats the entire input file as modified.
+		 */
+		virtual
+		void
+		modified_input_features(
+				LayerInputChannelName::Type input_channel_name,
+				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &modified_features)
+		{
+			modified_input_file(input_channel_name, feature_collection);
+		}
+
 
 		/**
 		 * The output of another layer (a layer proxy) has been connected on the specified input channel.
@@ -230,6 +230,21 @@ namespace GPlatesAppLogic
 		}
 
 
+		/**
+		 * Create a copy of this vector field (including its vectors) that has the specified
+		 * reconstruct handle.
+		 *
+		 * This is used when the cached velocities of unmodified features are retained under a
+		 * new reconstruct handle (this instance is not changed since clients can share it).
+		 */
+		const non_null_ptr_type
+		clone_with_reconstruct_handle(
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) const
+		{
+			return non_null_ptr_type(new MultiPointVectorField(*this, reconstruct_handle_));
+		}
+
+
 		virtual
 		~MultiPointVectorField()
 		{  }
@@ -436,6 +451,19 @@ namespace GPlatesAppLogic
 			d_range(multi_point_ptr->number_of_points())
 		{  }
 
+		/**
+		 * Copy @a other but with a different reconstruct handle (see @a clone_with_reconstruct_handle).
+		 */
+		MultiPointVectorField(
+				const MultiPointVectorField &other,
+				boost::optional<ReconstructHandle::type> reconstruct_handle_):
+			ReconstructionGeometry(other, reconstruct_handle_),
+			WeakObserverType(other),
+			d_multi_point_ptr(other.d_multi_point_ptr),
+			d_property_iterator(other.d_property_iterator),
+			d_range(other.d_range)
+		{  }
+
 	private:
 		/**
 		 * The multi-point domain over which the 3-D vector field is sampled.
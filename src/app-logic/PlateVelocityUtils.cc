@@ -23,13 +23,17 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <algorithm>
 #include <cmath>
+#include <map>
+#include <vector>
 #include <boost/foreach.hpp>
 #include <boost/lambda/bind.hpp>
 #include <boost/lambda/construct.hpp>
 #include <boost/lambda/lambda.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/optional.hpp>
+#include <boost/utility/in_place_factory.hpp>
 
 #include "AppLogicUtils.h"
 #include "GeometryCookieCutter.h"
@@ -57,6 +61,7 @@
 #include "maths/FiniteRotation.h"
 #include "maths/Rotation.h"
 #include "maths/SmallCircleBounds.h"
+#include "maths/UnitQuaternion3D.h"
 
 #include "model/FeatureType.h"
 #include "model/FeatureVisitor.h"
@@ -77,6 +82,7 @@
 #include "property-values/GpmlPlateId.h"
 #include "property-values/GpmlTimeSample.h"
 
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 
 
@@ -233,6 +239,185 @@ namespace GPlatesAppLogic
 		};
 
 
+		/**
+		 * Returns the angular velocity vector of the specified rigid plate (resolved topological boundary
+		 * or static polygon), or none if its plate id or reconstruction tree creator cannot be determined.
+		 */
+		boost::optional<GPlatesMaths::Vector3D>
+		calculate_rigid_plate_velocity_angular_vector(
+				const ReconstructionGeometry *rigid_plate,
+				PlateVelocityUtils::StageRotationCache &stage_rotation_cache)
+		{
+			const boost::optional<GPlatesModel::integer_plate_id_type> recon_plate_id =
+					ReconstructionGeometryUtils::get_plate_id(rigid_plate);
+			if (!recon_plate_id)
+			{
+				return boost::none;
+			}
+
+			// Get the reconstruction tree creator to calculate velocity with.
+			// This should succeed since resolved topological boundaries and RFGs (static polygons)
+			// support reconstruction trees.
+			const boost::optional<ReconstructionTreeCreator> recon_tree_creator =
+					ReconstructionGeometryUtils::get_reconstruction_tree_creator(rigid_plate);
+			if (!recon_tree_creator)
+			{
+				return boost::none;
+			}
+
+			// Rigid plates sharing the same plate id (eg, static polygons) share the same stage rotation.
+			return stage_rotation_cache.get_velocity_angular_vector(recon_plate_id.get(), recon_tree_creator.get());
+		}
+
+
+		/**
+		 * The velocity surfaces (rigid plates and topological networks) that domain points are tested against.
+		 *
+		 * Everything that is otherwise lazily calculated (and cached) when querying the surfaces is
+		 * calculated in the constructor. So once constructed this is only read from, and hence can be
+		 * shared by multiple threads solving velocities concurrently.
+		 *
+		 * Also the angular velocity of each rigid plate (resolved topological boundary or static polygon)
+		 * is calculated once (instead of once per domain point), and the stage rotation of each plate id
+		 * is only calculated once (regardless of how many rigid plates share that plate id).
+		 */
+		class VelocitySurfaces :
+				private boost::noncopyable
+		{
+		public:
+
+			VelocitySurfaces(
+					const double &reconstruction_time,
+					const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &reconstructed_static_polygons,
+					const std::vector<ResolvedTopologicalBoundary::non_null_ptr_type> &resolved_topological_boundaries,
+					const std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &resolved_topological_networks,
+					const double &velocity_delta_time,
+					VelocityDeltaTime::Type velocity_delta_time_type) :
+				// Get the rigid plate features (resolved topological boundaries and static polygons) and wrap
+				// them in a structure that can do point-in-polygon tests so we can query them at domain points.
+				d_rigid_plates_query(
+						reconstruction_time,
+						reconstructed_static_polygons,
+						resolved_topological_boundaries,
+						boost::none/*resolved_topological_networks*/,
+						GeometryCookieCutter::SORT_BY_PLATE_ID,
+						// Use high speed point-in-poly testing since very dense velocity meshes containing
+						// lots of points can go through this path...
+						GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE),
+				// Get the resolved topological networks so we can query them for interpolated velocity at domain points.
+				d_resolved_networks_query(resolved_topological_networks),
+				d_stage_rotation_cache(reconstruction_time, velocity_delta_time, velocity_delta_time_type)
+			{
+				d_rigid_plates_query.prepare_concurrent_partition_point_queries();
+				d_resolved_networks_query.prepare_concurrent_velocity_queries(
+						velocity_delta_time,
+						velocity_delta_time_type);
+
+				BOOST_FOREACH(
+						const ReconstructedFeatureGeometry::non_null_ptr_type &reconstructed_static_polygon,
+						reconstructed_static_polygons)
+				{
+					add_rigid_plate(reconstructed_static_polygon.get());
+				}
+
+				BOOST_FOREACH(
+						const ResolvedTopologicalBoundary::non_null_ptr_type &resolved_topological_boundary,
+						resolved_topological_boundaries)
+				{
+					add_rigid_plate(resolved_topological_boundary.get());
+				}
+
+				// Boundary smoothing queries the bounding small circle of the surface containing
+				// each domain point (and that includes networks and their interior rigid blocks).
+				BOOST_FOREACH(
+						const ResolvedTopologicalNetwork::non_null_ptr_type &resolved_topological_network,
+						resolved_topological_networks)
+				{
+					prepare_boundary_polygon(resolved_topological_network.get());
+
+					const ResolvedTriangulation::Network::rigid_block_seq_type &rigid_blocks =
+							resolved_topological_network->get_triangulation_network().get_rigid_blocks();
+					BOOST_FOREACH(const ResolvedTriangulation::Network::RigidBlock &rigid_block, rigid_blocks)
+					{
+						prepare_boundary_polygon(rigid_block.get_reconstructed_feature_geometry().get());
+					}
+				}
+			}
+
+			const GeometryCookieCutter &
+			get_rigid_plates_query() const
+			{
+				return d_rigid_plates_query;
+			}
+
+			const PlateVelocityUtils::TopologicalNetworksVelocities &
+			get_resolved_networks_query() const
+			{
+				return d_resolved_networks_query;
+			}
+
+			/**
+			 * Returns the angular velocity vector of the specified rigid plate (which should be
+			 * returned by the rigid plates query), or none if unable to calculate it.
+			 */
+			boost::optional<const GPlatesMaths::Vector3D &>
+			get_rigid_plate_velocity_angular_vector(
+					const ReconstructionGeometry *rigid_plate) const
+			{
+				rigid_plate_velocity_angular_vector_map_type::const_iterator iter =
+						d_rigid_plate_velocity_angular_vectors.find(rigid_plate);
+				if (iter == d_rigid_plate_velocity_angular_vectors.end())
+				{
+					return boost::none;
+				}
+
+				return iter->second;
+			}
+
+		private:
+
+			typedef std::map<const ReconstructionGeometry *, GPlatesMaths::Vector3D>
+					rigid_plate_velocity_angular_vector_map_type;
+
+			GeometryCookieCutter d_rigid_plates_query;
+			PlateVelocityUtils::TopologicalNetworksVelocities d_resolved_networks_query;
+			PlateVelocityUtils::StageRotationCache d_stage_rotation_cache;
+			rigid_plate_velocity_angular_vector_map_type d_rigid_plate_velocity_angular_vectors;
+
+
+			void
+			add_rigid_plate(
+					const ReconstructionGeometry *rigid_plate)
+			{
+				prepare_boundary_polygon(rigid_plate);
+
+				const boost::optional<GPlatesMaths::Vector3D> velocity_angular_vector =
+						calculate_rigid_plate_velocity_angular_vector(rigid_plate, d_stage_rotation_cache);
+				if (!velocity_angular_vector)
+				{
+					return;
+				}
+
+				d_rigid_plate_velocity_angular_vectors.insert(
+						rigid_plate_velocity_angular_vector_map_type::value_type(
+								rigid_plate,
+								velocity_angular_vector.get()));
+			}
+
+			void
+			prepare_boundary_polygon(
+					const ReconstructionGeometry *surface)
+			{
+				boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> boundary_polygon =
+						ReconstructionGeometryUtils::get_boundary_polygon(surface);
+				if (boundary_polygon)
+				{
+					boundary_polygon.get()->get_inner_outer_bounding_small_circle();
+				}
+			}
+		};
+
+
 		/**
 		 * Test the domain point against the resolved topological network.
 		 *
@@ -286,78 +471,48 @@ namespace GPlatesAppLogic
 
 
 		/**
-		 * Test the domain point against rigid plates (resolved topological boundaries and static polygons).
-		 *
-		 * Return false if point is not inside any rigid plates.
+		 * Set the velocity of the domain point from the rigid plate (resolved topological boundary
+		 * or static polygon) containing it.
 		 */
-		bool
-		solve_velocities_on_rigid_plates(
+		void
+		solve_velocity_on_rigid_plate(
 				const GPlatesMaths::PointOnSphere &domain_point,
 				boost::optional<MultiPointVectorField::CodomainElement> &range_element,
-				const GeometryCookieCutter &rigid_plates_query,
-				const double &velocity_delta_time,
-				VelocityDeltaTime::Type velocity_delta_time_type)
+				const ReconstructionGeometry *rigid_plate_containing_point,
+				const VelocitySurfaces &velocity_surfaces)
 		{
-			const boost::optional<const ReconstructionGeometry *> rigid_plate_containing_point =
-					rigid_plates_query.partition_point(domain_point);
-			if (!rigid_plate_containing_point)
-			{
-				return false;
-			}
-
-
-#ifdef DEBUG
-GPlatesMaths::LatLonPoint llp = GPlatesMaths::make_lat_lon_point(domain_point);
-qDebug() << "solve_velocities_on_rigid_plates: " << llp;
-#endif
-
 			const boost::optional<GPlatesModel::integer_plate_id_type> recon_plate_id_opt =
 					ReconstructionGeometryUtils::get_plate_id(
-							rigid_plate_containing_point.get());
-			if (!recon_plate_id_opt)
+							rigid_plate_containing_point);
+
+			// The angular velocity was calculated up front (it's the same for all points in the rigid plate).
+			// It's not available if the plate id or reconstruction tree creator could not be determined.
+			const boost::optional<const GPlatesMaths::Vector3D &> velocity_angular_vector =
+					velocity_surfaces.get_rigid_plate_velocity_angular_vector(
+							rigid_plate_containing_point);
+			if (!recon_plate_id_opt ||
+				!velocity_angular_vector)
 			{
 				GPlatesMaths::Vector3D zero_velocity(0, 0, 0);
 				range_element = MultiPointVectorField::CodomainElement(
 						zero_velocity,
 						MultiPointVectorField::CodomainElement::NotInAnyBoundaryOrNetwork);
 
-				return true;
+				return;
 			}
 
 			GPlatesModel::integer_plate_id_type recon_plate_id = recon_plate_id_opt.get();
 
-			const double reconstruction_time = rigid_plate_containing_point.get()->get_reconstruction_time();
-
-			// Get the reconstruction tree creator to calculate velocity with.
-			boost::optional<ReconstructionTreeCreator> recon_tree_creator =
-				ReconstructionGeometryUtils::get_reconstruction_tree_creator(
-						rigid_plate_containing_point.get());
-			// This should succeed since resolved topological boundaries and RFGs (static polygons)
-			// support reconstruction trees.
-			if (!recon_tree_creator)
-			{
-				GPlatesMaths::Vector3D zero_velocity(0, 0, 0);
-				range_element = MultiPointVectorField::CodomainElement(
-						zero_velocity,
-						MultiPointVectorField::CodomainElement::NotInAnyBoundaryOrNetwork);
-
-				return true;
-			}
-
 			// Compute the velocity for this domain point.
 			const GPlatesMaths::Vector3D vector_xyz =
-					PlateVelocityUtils::calculate_velocity_vector(
+					GPlatesMaths::calculate_velocity_vector(
 							domain_point,
-							recon_plate_id,
-							recon_tree_creator.get(),
-							reconstruction_time,
-							velocity_delta_time,
-							velocity_delta_time_type);
+							velocity_angular_vector.get());
 
 			// Determine if point was in a resolved topological boundary or RFG (static polygon).
 			const MultiPointVectorField::CodomainElement::Reason codomain_element_reason =
 					ReconstructionGeometryUtils::get_reconstruction_geometry_derived_type<
-							const ResolvedTopologicalBoundary *>(rigid_plate_containing_point.get())
+							const ResolvedTopologicalBoundary *>(rigid_plate_containing_point)
 					? MultiPointVectorField::CodomainElement::InPlateBoundary
 					: MultiPointVectorField::CodomainElement::InStaticPolygon;
 
@@ -365,7 +520,103 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 					vector_xyz,
 					codomain_element_reason,
 					recon_plate_id,
-					rigid_plate_containing_point.get());
+					rigid_plate_containing_point);
+		}
+
+
+		/**
+		 * Set the velocities of consecutive domain points that are all in the same rigid plate.
+		 *
+		 * This gives the same results as calling @a solve_velocity_on_rigid_plate on each point,
+		 * but the velocities are calculated in one batch (using @a velocities as scratch space).
+		 */
+		void
+		solve_velocities_on_rigid_plate_batch(
+				const GPlatesMaths::PointOnSphere *domain_points,
+				MultiPointVectorField::codomain_type::iterator range_elements,
+				unsigned int num_domain_points,
+				const ReconstructionGeometry *rigid_plate_containing_points,
+				const VelocitySurfaces &velocity_surfaces,
+				std::vector<GPlatesMaths::Vector3D> &velocities)
+		{
+			const boost::optional<GPlatesModel::integer_plate_id_type> recon_plate_id_opt =
+					ReconstructionGeometryUtils::get_plate_id(
+							rigid_plate_containing_points);
+
+			const boost::optional<const GPlatesMaths::Vector3D &> velocity_angular_vector =
+					velocity_surfaces.get_rigid_plate_velocity_angular_vector(
+							rigid_plate_containing_points);
+			if (!recon_plate_id_opt ||
+				!velocity_angular_vector)
+			{
+				const GPlatesMaths::Vector3D zero_velocity(0, 0, 0);
+				for (unsigned int n = 0; n < num_domain_points; ++n)
+				{
+					range_elements[n] = MultiPointVectorField::CodomainElement(
+							zero_velocity,
+							MultiPointVectorField::CodomainElement::NotInAnyBoundaryOrNetwork);
+				}
+
+				return;
+			}
+
+			const MultiPointVectorField::CodomainElement::Reason codomain_element_reason =
+					ReconstructionGeometryUtils::get_reconstruction_geometry_derived_type<
+							const ResolvedTopologicalBoundary *>(rigid_plate_containing_points)
+					? MultiPointVectorField::CodomainElement::InPlateBoundary
+					: MultiPointVectorField::CodomainElement::InStaticPolygon;
+
+			if (velocities.size() < num_domain_points)
+			{
+				velocities.resize(num_domain_points);
+			}
+
+			GPlatesMaths::calculate_velocity_vectors(
+					&velocities[0],
+					domain_points,
+					num_domain_points,
+					velocity_angular_vector.get());
+
+			for (unsigned int n = 0; n < num_domain_points; ++n)
+			{
+				range_elements[n] = MultiPointVectorField::CodomainElement(
+						velocities[n],
+						codomain_element_reason,
+						recon_plate_id_opt.get(),
+						rigid_plate_containing_points);
+			}
+		}
+
+
+		/**
+		 * Test the domain point against rigid plates (resolved topological boundaries and static polygons).
+		 *
+		 * Return false if point is not inside any rigid plates.
+		 */
+		bool
+		solve_velocities_on_rigid_plates(
+				const GPlatesMaths::PointOnSphere &domain_point,
+				boost::optional<MultiPointVectorField::CodomainElement> &range_element,
+				const VelocitySurfaces &velocity_surfaces)
+		{
+			const boost::optional<const ReconstructionGeometry *> rigid_plate_containing_point =
+					velocity_surfaces.get_rigid_plates_query().partition_point(domain_point);
+			if (!rigid_plate_containing_point)
+			{
+				return false;
+			}
+
+
+#ifdef DEBUG
+GPlatesMaths::LatLonPoint llp = GPlatesMaths::make_lat_lon_point(domain_point);
+qDebug() << "solve_velocities_on_rigid_plates: " << llp;
+#endif
+
+			solve_velocity_on_rigid_plate(
+					domain_point,
+					range_element,
+					rigid_plate_containing_point.get(),
+					velocity_surfaces);
 
 			return true;
 		}
@@ -380,8 +631,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 		solve_velocity_on_surfaces(
 				const GPlatesMaths::PointOnSphere &domain_point,
 				boost::optional<MultiPointVectorField::CodomainElement> &range_element,
-				const GeometryCookieCutter &rigid_plates_query,
-				const PlateVelocityUtils::TopologicalNetworksVelocities &resolved_networks_query,
+				const VelocitySurfaces &velocity_surfaces,
 				const double &velocity_delta_time,
 				VelocityDeltaTime::Type velocity_delta_time_type)
 		{
@@ -392,7 +642,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 			if (solve_velocities_on_networks(
 					domain_point,
 					range_element,
-					resolved_networks_query,
+					velocity_surfaces.get_resolved_networks_query(),
 					velocity_delta_time,
 					velocity_delta_time_type))
 			{
@@ -406,9 +656,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 			if (solve_velocities_on_rigid_plates(
 					domain_point,
 					range_element,
-					rigid_plates_query,
-					velocity_delta_time,
-					velocity_delta_time_type))
+					velocity_surfaces))
 			{
 				return true;
 			}
@@ -443,8 +691,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 				boost::optional<GPlatesMaths::Vector3D> &velocity_inside_polygon_boundary,
 				boost::optional<GPlatesMaths::Vector3D> &velocity_outside_polygon_boundary,
 				const ReconstructionGeometry *polygon_recon_geom_containing_domain_point,
-				const GeometryCookieCutter &rigid_plates_query,
-				const PlateVelocityUtils::TopologicalNetworksVelocities &resolved_networks_query,
+				const VelocitySurfaces &velocity_surfaces,
 				const double &velocity_delta_time,
 				VelocityDeltaTime::Type velocity_delta_time_type)
 		{
@@ -453,8 +700,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 			if (!solve_velocity_on_surfaces(
 					point_sample,
 					velocity_sample,
-					rigid_plates_query,
-					resolved_networks_query,
+					velocity_surfaces,
 					velocity_delta_time,
 					velocity_delta_time_type))
 			{
@@ -500,8 +746,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 				const GPlatesMaths::PointOnSphere &polygon_boundary_point,
 				const GPlatesMaths::PointOnSphere &domain_point,
 				const ReconstructionGeometry *polygon_recon_geom_containing_domain_point,
-				const GeometryCookieCutter &rigid_plates_query,
-				const PlateVelocityUtils::TopologicalNetworksVelocities &resolved_networks_query,
+				const VelocitySurfaces &velocity_surfaces,
 				const double &velocity_delta_time,
 				VelocityDeltaTime::Type velocity_delta_time_type)
 		{
@@ -541,8 +786,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 					velocity_inside_polygon_boundary,
 					velocity_outside_polygon_boundary,
 					polygon_recon_geom_containing_domain_point,
-					rigid_plates_query,
-					resolved_networks_query,
+					velocity_surfaces,
 					velocity_delta_time,
 					velocity_delta_time_type);
 
@@ -556,8 +800,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 					velocity_inside_polygon_boundary,
 					velocity_outside_polygon_boundary,
 					polygon_recon_geom_containing_domain_point,
-					rigid_plates_query,
-					resolved_networks_query,
+					velocity_surfaces,
 					velocity_delta_time,
 					velocity_delta_time_type);
 
@@ -585,8 +828,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 					velocity_inside_polygon_boundary,
 					velocity_outside_polygon_boundary,
 					polygon_recon_geom_containing_domain_point,
-					rigid_plates_query,
-					resolved_networks_query,
+					velocity_surfaces,
 					velocity_delta_time,
 					velocity_delta_time_type);
 
@@ -602,8 +844,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 					velocity_inside_polygon_boundary,
 					velocity_outside_polygon_boundary,
 					polygon_recon_geom_containing_domain_point,
-					rigid_plates_query,
-					resolved_networks_query,
+					velocity_surfaces,
 					velocity_delta_time,
 					velocity_delta_time_type);
 
@@ -643,8 +884,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 							velocity_inside_polygon_boundary,
 							velocity_outside_polygon_boundary,
 							polygon_recon_geom_containing_domain_point,
-							rigid_plates_query,
-							resolved_networks_query,
+							velocity_surfaces,
 							velocity_delta_time,
 							velocity_delta_time_type);
 
@@ -676,8 +916,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 						velocity_inside_polygon_boundary,
 						velocity_outside_polygon_boundary,
 						polygon_recon_geom_containing_domain_point,
-						rigid_plates_query,
-						resolved_networks_query,
+						velocity_surfaces,
 						velocity_delta_time,
 						velocity_delta_time_type);
 
@@ -715,8 +954,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 		solve_velocity_on_surfaces_with_boundary_smoothing(
 				const GPlatesMaths::PointOnSphere &domain_point,
 				boost::optional<MultiPointVectorField::CodomainElement> &range_element,
-				const GeometryCookieCutter &rigid_plates_query,
-				const PlateVelocityUtils::TopologicalNetworksVelocities &resolved_networks_query,
+				const VelocitySurfaces &velocity_surfaces,
 				const double &velocity_delta_time,
 				VelocityDeltaTime::Type velocity_delta_time_type,
 				const double &boundary_smoothing_half_angle_radians,
@@ -727,8 +965,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 			if (!solve_velocity_on_surfaces(
 					domain_point,
 					range_element,
-					rigid_plates_query,
-					resolved_networks_query,
+					velocity_surfaces,
 					velocity_delta_time,
 					velocity_delta_time_type))
 			{
@@ -816,8 +1053,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 							closest_point_on_polygon_boundary.get(),
 							domain_point,
 							boundary_recon_geom,
-							rigid_plates_query,
-							resolved_networks_query,
+							velocity_surfaces,
 							velocity_delta_time,
 							velocity_delta_time_type);
 			if (!average_boundary_velocity)
@@ -839,6 +1075,513 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 
 			return true;
 		}
+
+
+		/**
+		 * The domain points of all velocity domains concatenated into a single index range
+		 * (so that the work can be evenly divided amongst threads regardless of the number of domains).
+		 */
+		class DomainPoints
+		{
+		public:
+
+			DomainPoints() :
+				d_num_points(0)
+			{  }
+
+			void
+			add_domain(
+					const GPlatesMaths::MultiPointOnSphere::non_null_ptr_to_const_type &domain,
+					const MultiPointVectorField::non_null_ptr_type &vector_field)
+			{
+				d_domains.push_back(Domain(domain, vector_field, d_num_points));
+				d_num_points += domain->number_of_points();
+			}
+
+			unsigned int
+			get_num_points() const
+			{
+				return d_num_points;
+			}
+
+			unsigned int
+			get_num_domains() const
+			{
+				return d_domains.size();
+			}
+
+			/**
+			 * Returns the index of the domain containing the point at @a point_index.
+			 */
+			unsigned int
+			get_domain_index(
+					unsigned int point_index) const
+			{
+				// Find the first domain starting *after* the point and then step back one domain.
+				std::vector<Domain>::const_iterator domain_iter = std::upper_bound(
+						d_domains.begin(),
+						d_domains.end(),
+						point_index,
+						&DomainPoints::is_before_domain);
+
+				return (domain_iter - d_domains.begin()) - 1;
+			}
+
+			const GPlatesMaths::MultiPointOnSphere &
+			get_domain(
+					unsigned int domain_index) const
+			{
+				return *d_domains[domain_index].domain;
+			}
+
+			MultiPointVectorField &
+			get_vector_field(
+					unsigned int domain_index) const
+			{
+				return *d_domains[domain_index].vector_field;
+			}
+
+			unsigned int
+			get_domain_start_point_index(
+					unsigned int domain_index) const
+			{
+				return d_domains[domain_index].start_point_index;
+			}
+
+		private:
+
+			struct Domain
+			{
+				Domain(
+						const GPlatesMaths::MultiPointOnSphere::non_null_ptr_to_const_type &domain_,
+						const MultiPointVectorField::non_null_ptr_type &vector_field_,
+						unsigned int start_point_index_) :
+					domain(domain_),
+					vector_field(vector_field_),
+					start_point_index(start_point_index_)
+				{  }
+
+				GPlatesMaths::MultiPointOnSphere::non_null_ptr_to_const_type domain;
+				MultiPointVectorField::non_null_ptr_type vector_field;
+				unsigned int start_point_index;
+			};
+
+			static
+			bool
+			is_before_domain(
+					unsigned int point_index,
+					const Domain &domain)
+			{
+				return point_index < domain.start_point_index;
+			}
+
+			std::vector<Domain> d_domains;
+			unsigned int d_num_points;
+		};
+
+
+		/**
+		 * Partitions domain points into the static polygons (when they are the only velocity surfaces)
+		 * and records the static polygon containing each domain point (for the next velocity solve).
+		 *
+		 * If a partition was cached by a previous velocity solve then each domain point is only tested
+		 * against the static polygons that have moved relative to its domain since then.
+		 * This gives the same result as testing the domain point against all static polygons because:
+		 * - the static polygons are tested in the same order (sorted by plate id, and the plate ids
+		 *   are unchanged), and the first static polygon containing a point wins, and
+		 * - a static polygon that has not moved relative to a domain still contains the same domain points.
+		 */
+		class StaticPolygonPartitioner :
+				private boost::noncopyable
+		{
+		public:
+
+			StaticPolygonPartitioner(
+					const GeometryCookieCutter &static_polygons_query,
+					const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &reconstructed_static_polygons,
+					unsigned int num_domain_points,
+					boost::optional<const std::vector<int> &> cached_partition,
+					const PlateVelocityUtils::StaticPolygonPartitionCache::MovedStaticPolygons &moved_static_polygons) :
+				d_static_polygons_query(static_polygons_query),
+				d_query_indices(reconstructed_static_polygons.size(), -1),
+				d_partition(num_domain_points, -1)
+			{
+				// Map the static polygons to the order in which the query tests them (and back).
+				// Static polygons that are not polygons are not in the query.
+				typedef std::map<const ReconstructionGeometry *, int> static_polygon_index_map_type;
+				static_polygon_index_map_type static_polygon_indices;
+				for (unsigned int n = 0; n < reconstructed_static_polygons.size(); ++n)
+				{
+					static_polygon_indices.insert(
+							static_polygon_index_map_type::value_type(reconstructed_static_polygons[n].get(), n));
+				}
+
+				const unsigned int num_query_polygons = d_static_polygons_query.get_num_partitioning_polygons();
+				d_static_polygon_indices.reserve(num_query_polygons);
+				for (unsigned int query_index = 0; query_index < num_query_polygons; ++query_index)
+				{
+					static_polygon_index_map_type::const_iterator static_polygon_index_iter =
+							static_polygon_indices.find(
+									d_static_polygons_query.get_partitioning_reconstruction_geometry(query_index));
+					GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+							static_polygon_index_iter != static_polygon_indices.end(),
+							GPLATES_ASSERTION_SOURCE);
+
+					d_static_polygon_indices.push_back(static_polygon_index_iter->second);
+					d_query_indices[static_polygon_index_iter->second] = query_index;
+				}
+
+				if (!cached_partition ||
+					cached_partition->size() != num_domain_points)
+				{
+					return;
+				}
+
+				d_cached_partition = cached_partition;
+				d_domain_moved_static_polygons_indices = moved_static_polygons.domain_indices;
+				d_moved_static_polygons = moved_static_polygons.moved_static_polygons;
+
+				// The moved static polygons of each domain in the order the query tests them.
+				d_moved_query_indices.resize(d_moved_static_polygons.size());
+				for (unsigned int m = 0; m < d_moved_static_polygons.size(); ++m)
+				{
+					for (unsigned int query_index = 0; query_index < num_query_polygons; ++query_index)
+					{
+						if (d_moved_static_polygons[m][d_static_polygon_indices[query_index]])
+						{
+							d_moved_query_indices[m].push_back(query_index);
+						}
+					}
+				}
+			}
+
+			/**
+			 * Returns the first static polygon containing the domain point at @a point_index
+			 * (in the domain at @a domain_index), or none if not in any static polygon.
+			 *
+			 * The containing static polygon is recorded in the new partition.
+			 * This can be called concurrently for different domain points.
+			 */
+			boost::optional<const ReconstructionGeometry *>
+			partition_point(
+					const GPlatesMaths::PointOnSphere &domain_point,
+					unsigned int domain_index,
+					unsigned int point_index)
+			{
+				const boost::optional<unsigned int> query_index =
+						find_query_index(domain_point, domain_index, point_index);
+				if (!query_index)
+				{
+					return boost::none;
+				}
+
+				d_partition[point_index] = d_static_polygon_indices[query_index.get()];
+
+				return d_static_polygons_query.get_partitioning_reconstruction_geometry(query_index.get());
+			}
+
+			/**
+			 * The index of the static polygon containing each domain point (or -1 if none).
+			 */
+			std::vector<int> &
+			get_partition()
+			{
+				return d_partition;
+			}
+
+		private:
+
+			const GeometryCookieCutter &d_static_polygons_query;
+
+			//! The query index of each static polygon (or -1 if not in the query).
+			std::vector<int> d_query_indices;
+			//! The static polygon index of each query polygon.
+			std::vector<int> d_static_polygon_indices;
+
+			boost::optional<const std::vector<int> &> d_cached_partition;
+			std::vector<unsigned int> d_domain_moved_static_polygons_indices;
+			std::vector< std::vector<bool> > d_moved_static_polygons;
+			std::vector< std::vector<unsigned int> > d_moved_query_indices;
+
+			std::vector<int> d_partition;
+
+
+			boost::optional<unsigned int>
+			find_query_index(
+					const GPlatesMaths::PointOnSphere &domain_point,
+					unsigned int domain_index,
+					unsigned int point_index) const
+			{
+				const unsigned int num_query_polygons = d_static_polygons_query.get_num_partitioning_polygons();
+
+				if (!d_cached_partition)
+				{
+					return find_first_query_index(domain_point, 0, num_query_polygons);
+				}
+
+				const unsigned int moved_index = d_domain_moved_static_polygons_indices[domain_index];
+				const std::vector<unsigned int> &moved_query_indices = d_moved_query_indices[moved_index];
+
+				const int cached_static_polygon_index = d_cached_partition.get()[point_index];
+				if (cached_static_polygon_index < 0)
+				{
+					// The point was not in any static polygon, and those that have not moved relative
+					// to it still don't contain it.
+					return find_moved_query_index(domain_point, moved_query_indices, num_query_polygons);
+				}
+
+				const int cached_query_index = d_query_indices[cached_static_polygon_index];
+				if (cached_query_index < 0 ||
+					d_moved_static_polygons[moved_index][cached_static_polygon_index])
+				{
+					// The static polygon containing the point has moved relative to it.
+					return find_first_query_index(domain_point, 0, num_query_polygons);
+				}
+
+				// The static polygon containing the point still contains it, but a moved static polygon
+				// that is tested before it might now also contain the point.
+				const boost::optional<unsigned int> moved_query_index =
+						find_moved_query_index(domain_point, moved_query_indices, static_cast<unsigned int>(cached_query_index));
+				if (moved_query_index)
+				{
+					return moved_query_index;
+				}
+
+				return static_cast<unsigned int>(cached_query_index);
+			}
+
+			/**
+			 * Returns the first query polygon in [@a query_begin, @a query_end) containing the point.
+			 */
+			boost::optional<unsigned int>
+			find_first_query_index(
+					const GPlatesMaths::PointOnSphere &domain_point,
+					unsigned int query_begin,
+					unsigned int query_end) const
+			{
+				for (unsigned int query_index = query_begin; query_index < query_end; ++query_index)
+				{
+					if (d_static_polygons_query.is_point_in_partitioning_polygon(domain_point, query_index))
+					{
+						return query_index;
+					}
+				}
+
+				return boost::none;
+			}
+
+			/**
+			 * Returns the first moved query polygon before @a query_end containing the point.
+			 */
+			boost::optional<unsigned int>
+			find_moved_query_index(
+					const GPlatesMaths::PointOnSphere &domain_point,
+					const std::vector<unsigned int> &moved_query_indices,
+					unsigned int query_end) const
+			{
+				BOOST_FOREACH(unsigned int query_index, moved_query_indices)
+				{
+					if (query_index >= query_end)
+					{
+						break;
+					}
+
+					if (d_static_polygons_query.is_point_in_partitioning_polygon(domain_point, query_index))
+					{
+						return query_index;
+					}
+				}
+
+				return boost::none;
+			}
+		};
+
+
+		/**
+		 * Solves velocities on a range of domain points (called concurrently from multiple threads).
+		 *
+		 * Each domain point writes only to its own element in its velocity field, and the
+		 * velocity surfaces are only read from, so there's no need for any locking.
+		 *
+		 * The velocities of consecutive domain points in the same rigid plate are calculated in batches
+		 * (with GPlatesMaths::calculate_velocity_vectors) after the surfaces containing them are found.
+		 */
+		class SolveVelocitiesOnDomainPoints
+		{
+		public:
+
+			SolveVelocitiesOnDomainPoints(
+					const DomainPoints &domain_points,
+					const VelocitySurfaces &velocity_surfaces,
+					const double &velocity_delta_time,
+					VelocityDeltaTime::Type velocity_delta_time_type,
+					const boost::optional<PlateVelocityUtils::VelocitySmoothingOptions> &velocity_smoothing_options,
+					const GPlatesMaths::AngularExtent &boundary_smoothing_angular_half_extent,
+					bool exclude_deforming_regions_from_smoothing,
+					StaticPolygonPartitioner *static_polygon_partitioner) :
+				d_domain_points(domain_points),
+				d_velocity_surfaces(velocity_surfaces),
+				d_velocity_delta_time(velocity_delta_time),
+				d_velocity_delta_time_type(velocity_delta_time_type),
+				d_velocity_smoothing_options(velocity_smoothing_options),
+				d_boundary_smoothing_angular_half_extent(boundary_smoothing_angular_half_extent),
+				d_exclude_deforming_regions_from_smoothing(exclude_deforming_regions_from_smoothing),
+				d_static_polygon_partitioner(static_polygon_partitioner)
+			{  }
+
+			void
+			operator()(
+					std::size_t points_begin,
+					std::size_t points_end) const
+			{
+				unsigned int point_index = points_begin;
+				unsigned int domain_index = d_domain_points.get_domain_index(point_index);
+
+				// The rigid plate containing each point of the current domain (or NULL if its velocity is
+				// already solved), and scratch space for the batched rigid plate velocities.
+				std::vector<const ReconstructionGeometry *> rigid_plates_containing_points;
+				std::vector<GPlatesMaths::Vector3D> velocities;
+
+				while (point_index < points_end)
+				{
+					const GPlatesMaths::MultiPointOnSphere &domain = d_domain_points.get_domain(domain_index);
+					MultiPointVectorField &vector_field = d_domain_points.get_vector_field(domain_index);
+					const unsigned int domain_start_point_index = d_domain_points.get_domain_start_point_index(domain_index);
+
+					// Solve the points in the current domain (that are also in the requested range).
+					unsigned int domain_end_point_index = domain_start_point_index + domain.number_of_points();
+					if (domain_end_point_index > points_end)
+					{
+						domain_end_point_index = points_end;
+					}
+
+					const GPlatesMaths::MultiPointOnSphere::const_iterator domain_begin =
+							domain.begin() + (point_index - domain_start_point_index);
+					const MultiPointVectorField::codomain_type::iterator field_begin =
+							vector_field.begin() + (point_index - domain_start_point_index);
+
+					rigid_plates_containing_points.clear();
+
+					GPlatesMaths::MultiPointOnSphere::const_iterator domain_iter = domain_begin;
+					MultiPointVectorField::codomain_type::iterator field_iter = field_begin;
+					for ( ; point_index < domain_end_point_index; ++point_index, ++domain_iter, ++field_iter)
+					{
+						rigid_plates_containing_points.push_back(
+								solve_velocity_unless_in_rigid_plate(*domain_iter, *field_iter, domain_index, point_index));
+					}
+
+					// Solve the velocities of each run of consecutive points in the same rigid plate in one batch.
+					const unsigned int num_points = rigid_plates_containing_points.size();
+					unsigned int run_begin = 0;
+					while (run_begin < num_points)
+					{
+						const ReconstructionGeometry *rigid_plate = rigid_plates_containing_points[run_begin];
+						if (rigid_plate == NULL)
+						{
+							++run_begin;
+							continue;
+						}
+
+						unsigned int run_end = run_begin + 1;
+						while (run_end < num_points &&
+							rigid_plates_containing_points[run_end] == rigid_plate)
+						{
+							++run_end;
+						}
+
+						solve_velocities_on_rigid_plate_batch(
+								&*(domain_begin + run_begin),
+								field_begin + run_begin,
+								run_end - run_begin,
+								rigid_plate,
+								d_velocity_surfaces,
+								velocities);
+
+						run_begin = run_end;
+					}
+
+					// Move to the next domain.
+					++domain_index;
+				}
+			}
+
+		private:
+
+			const DomainPoints &d_domain_points;
+			const VelocitySurfaces &d_velocity_surfaces;
+			double d_velocity_delta_time;
+			VelocityDeltaTime::Type d_velocity_delta_time_type;
+			boost::optional<PlateVelocityUtils::VelocitySmoothingOptions> d_velocity_smoothing_options;
+			GPlatesMaths::AngularExtent d_boundary_smoothing_angular_half_extent;
+			bool d_exclude_deforming_regions_from_smoothing;
+			StaticPolygonPartitioner *d_static_polygon_partitioner;
+
+
+			/**
+			 * Solves the velocity of the domain point, unless it's in a rigid plate (without smoothing),
+			 * in which case the rigid plate is returned and its velocity is left for the caller to batch.
+			 *
+			 * Returns NULL if the velocity was solved.
+			 */
+			const ReconstructionGeometry *
+			solve_velocity_unless_in_rigid_plate(
+					const GPlatesMaths::PointOnSphere &domain_point,
+					boost::optional<MultiPointVectorField::CodomainElement> &range_element,
+					unsigned int domain_index,
+					unsigned int point_index) const
+			{
+				if (d_velocity_smoothing_options)
+				{
+					solve_velocity_on_surfaces_with_boundary_smoothing(
+							domain_point,
+							range_element,
+							d_velocity_surfaces,
+							d_velocity_delta_time,
+							d_velocity_delta_time_type,
+							d_velocity_smoothing_options->angular_half_extent_radians,
+							d_boundary_smoothing_angular_half_extent,
+							d_exclude_deforming_regions_from_smoothing);
+
+					return NULL;
+				}
+
+				boost::optional<const ReconstructionGeometry *> rigid_plate_containing_point;
+				if (d_static_polygon_partitioner)
+				{
+					rigid_plate_containing_point =
+							d_static_polygon_partitioner->partition_point(domain_point, domain_index, point_index);
+				}
+				else
+				{
+					// Same order as 'solve_velocity_on_surfaces' - networks take precedence over rigid plates.
+					if (solve_velocities_on_networks(
+							domain_point,
+							range_element,
+							d_velocity_surfaces.get_resolved_networks_query(),
+							d_velocity_delta_time,
+							d_velocity_delta_time_type))
+					{
+						return NULL;
+					}
+
+					rigid_plate_containing_point =
+							d_velocity_surfaces.get_rigid_plates_query().partition_point(domain_point);
+				}
+
+				if (rigid_plate_containing_point)
+				{
+					return rigid_plate_containing_point.get();
+				}
+
+				// Same as 'solve_velocity_on_surfaces' when not in any surface.
+				const GPlatesMaths::Vector3D zero_velocity(0, 0, 0);
+				range_element = MultiPointVectorField::CodomainElement(
+						zero_velocity,
+						MultiPointVectorField::CodomainElement::NotInAnyBoundaryOrNetwork);
+
+				return NULL;
+			}
+		};
 	}
 }
 
@@ -916,7 +1659,8 @@ GPlatesAppLogic::PlateVelocityUtils::solve_velocities_on_surfaces(
 		const std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &velocity_surface_resolved_topological_networks,
 		const double &velocity_delta_time,
 		VelocityDeltaTime::Type velocity_delta_time_type,
-		const boost::optional<VelocitySmoothingOptions> &velocity_smoothing_options)
+		const boost::optional<VelocitySmoothingOptions> &velocity_smoothing_options,
+		boost::optional<StaticPolygonPartitionCache &> static_polygon_partition_cache)
 {
 	PROFILE_FUNC();
 
@@ -926,31 +1670,8 @@ GPlatesAppLogic::PlateVelocityUtils::solve_velocities_on_surfaces(
 		return;
 	}
 
-	// Get the rigid plate features (resolved topological boundaries and static polygons) and wrap
-	// them in a structure that can do point-in-polygon tests so we can query them at domain points.
-	GeometryCookieCutter rigid_plates_query(
-			reconstruction_time,
-			velocity_surface_reconstructed_static_polygons,
-			velocity_surface_resolved_topological_boundaries,
-			boost::none/*velocity_surface_resolved_topological_networks*/,
-			GeometryCookieCutter::SORT_BY_PLATE_ID,
-			// Use high speed point-in-poly testing since very dense velocity meshes containing
-			// lots of points can go through this path...
-			GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE);
-
-	// Get the resolved topological networks so we can query them for interpolated velocity at domain points.
-	const TopologicalNetworksVelocities resolved_networks_query(
-			velocity_surface_resolved_topological_networks);
-
-	GPlatesMaths::AngularExtent boundary_smoothing_angular_half_extent = GPlatesMaths::AngularExtent::ZERO;
-	bool exclude_deforming_regions_from_smoothing = true;
-	if (velocity_smoothing_options)
-	{
-		boundary_smoothing_angular_half_extent =
-				GPlatesMaths::AngularExtent::create_from_angle(
-						velocity_smoothing_options->angular_half_extent_radians);
-		exclude_deforming_regions_from_smoothing = velocity_smoothing_options->exclude_deforming_regions;
-	}
+	// The domain points of all velocity domains (concatenated) - this is what we solve velocities on in parallel.
+	DomainPoints domain_points;
 
 	// Iterate over the velocity domain RFGs.
 	std::vector<ReconstructedFeatureGeometry::non_null_ptr_type>::const_iterator velocity_domains_iter =
@@ -982,9 +1703,6 @@ GPlatesAppLogic::PlateVelocityUtils::solve_velocities_on_surfaces(
 				GeometryUtils::convert_geometry_to_multi_point(
 						*velocity_domain_rfg->reconstructed_geometry());
 
-		GPlatesMaths::MultiPointOnSphere::const_iterator domain_iter = velocity_domain_multi_point->begin();
-		GPlatesMaths::MultiPointOnSphere::const_iterator domain_end = velocity_domain_multi_point->end();
-
 		MultiPointVectorField::non_null_ptr_type vector_field =
 				MultiPointVectorField::create_empty(
 						reconstruction_time,
@@ -993,41 +1711,240 @@ GPlatesAppLogic::PlateVelocityUtils::solve_velocities_on_surfaces(
 						// For now using the domain...
 						*velocity_domain_rfg->property().handle_weak_ref(),
 						velocity_domain_rfg->property());
-		MultiPointVectorField::codomain_type::iterator field_iter = vector_field->begin();
 
-		// Iterate over the domain points and calculate their velocities.
-		for ( ; domain_iter != domain_end; ++domain_iter, ++field_iter)
-		{
-			const GPlatesMaths::PointOnSphere &domain_point = *domain_iter;
-			boost::optional<MultiPointVectorField::CodomainElement> &range_element = *field_iter;
+		domain_points.add_domain(velocity_domain_multi_point, vector_field);
+
+		multi_point_velocity_fields.push_back(vector_field);
+	}
+
+	// The velocity surfaces are prepared up front so that they can then be queried concurrently.
+	const VelocitySurfaces velocity_surfaces(
+			reconstruction_time,
+			velocity_surface_reconstructed_static_polygons,
+			velocity_surface_resolved_topological_boundaries,
+			velocity_surface_resolved_topological_networks,
+			velocity_delta_time,
+			velocity_delta_time_type);
+
+	GPlatesMaths::AngularExtent boundary_smoothing_angular_half_extent = GPlatesMaths::AngularExtent::ZERO;
+	bool exclude_deforming_regions_from_smoothing = true;
+	if (velocity_smoothing_options)
+	{
+		boundary_smoothing_angular_half_extent =
+				GPlatesMaths::AngularExtent::create_from_angle(
+						velocity_smoothing_options->angular_half_extent_radians);
+		exclude_deforming_regions_from_smoothing = velocity_smoothing_options->exclude_deforming_regions;
+	}
+
+	// If the static polygons are the only velocity surfaces then the domain points are simply
+	// partitioned into the static polygons (and the partition is cached for the next solve).
+	boost::optional<StaticPolygonPartitioner> static_polygon_partitioner;
+	if (static_polygon_partition_cache &&
+		velocity_surface_resolved_topological_boundaries.empty() &&
+		velocity_surface_resolved_topological_networks.empty() &&
+		!velocity_smoothing_options)
+	{
+		StaticPolygonPartitionCache::MovedStaticPolygons moved_static_polygons;
+		const boost::optional<const std::vector<int> &> cached_static_polygon_partition =
+				static_polygon_partition_cache->get_partition(
+						velocity_domains,
+						velocity_surface_reconstructed_static_polygons,
+						moved_static_polygons);
+
+		static_polygon_partitioner = boost::in_place(
+				velocity_surfaces.get_rigid_plates_query(),
+				velocity_surface_reconstructed_static_polygons,
+				domain_points.get_num_points(),
+				cached_static_polygon_partition,
+				moved_static_polygons);
+	}
+
+	// Iterate over the domain points (of all domains) and calculate their velocities in parallel.
+	GPlatesUtils::ParallelUtils::parallel_for(
+			domain_points.get_num_points(),
+			SolveVelocitiesOnDomainPoints(
+					domain_points,
+					velocity_surfaces,
+					velocity_delta_time,
+					velocity_delta_time_type,
+					velocity_smoothing_options,
+					boundary_smoothing_angular_half_extent,
+					exclude_deforming_regions_from_smoothing,
+					static_polygon_partitioner ? &static_polygon_partitioner.get() : NULL),
+			// Not worth starting threads for a handful of points...
+			64/*min_items_per_chunk*/);
+
+	if (static_polygon_partitioner)
+	{
+		// Always update the cache (even if the cached partition was used) so that the next solve
+		// only tests static polygons that have moved relative to the domains since *this* solve.
+		static_polygon_partition_cache->set_partition(
+				velocity_domains,
+				velocity_surface_reconstructed_static_polygons,
+				static_polygon_partitioner->get_partition());
+	}
+}
+
 
-			if (velocity_smoothing_options)
+boost::optional<const std::vector<int> &>
+GPlatesAppLogic::PlateVelocityUtils::StaticPolygonPartitionCache::get_partition(
+		const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &velocity_domains,
+		const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &reconstructed_static_polygons,
+		MovedStaticPolygons &moved_static_polygons) const
+{
+	if (!d_is_valid ||
+		velocity_domains.size() != d_domains.size() ||
+		reconstructed_static_polygons.size() != d_static_polygons.size())
+	{
+		return boost::none;
+	}
+
+	// The rotation of each domain and static polygon since the partition was cached.
+	std::vector<GPlatesMaths::UnitQuaternion3D> domain_rotation_changes;
+	std::vector<GPlatesMaths::UnitQuaternion3D> static_polygon_rotation_changes;
+	if (!get_rotation_changes(domain_rotation_changes, d_domains, velocity_domains) ||
+		!get_rotation_changes(static_polygon_rotation_changes, d_static_polygons, reconstructed_static_polygons))
+	{
+		return boost::none;
+	}
+
+	moved_static_polygons.domain_indices.clear();
+	moved_static_polygons.moved_static_polygons.clear();
+
+	// Domains rotated by the same rotation (eg, with the same plate id) share their moved static polygons.
+	std::vector<GPlatesMaths::UnitQuaternion3D> distinct_domain_rotation_changes;
+	BOOST_FOREACH(const GPlatesMaths::UnitQuaternion3D &domain_rotation_change, domain_rotation_changes)
+	{
+		unsigned int moved_index = 0;
+		for ( ; moved_index < distinct_domain_rotation_changes.size(); ++moved_index)
+		{
+			if (GPlatesMaths::represents_identity_rotation(
+				domain_rotation_change * distinct_domain_rotation_changes[moved_index].get_inverse()))
 			{
-				solve_velocity_on_surfaces_with_boundary_smoothing(
-						domain_point,
-						range_element,
-						rigid_plates_query,
-						resolved_networks_query,
-						velocity_delta_time,
-						velocity_delta_time_type,
-						velocity_smoothing_options->angular_half_extent_radians,
-						boundary_smoothing_angular_half_extent,
-						exclude_deforming_regions_from_smoothing);
+				break;
 			}
-			else
+		}
+
+		if (moved_index == distinct_domain_rotation_changes.size())
+		{
+			distinct_domain_rotation_changes.push_back(domain_rotation_change);
+
+			// A static polygon has moved relative to the domain if it was rotated by a different rotation.
+			const GPlatesMaths::UnitQuaternion3D inverse_domain_rotation_change = domain_rotation_change.get_inverse();
+			moved_static_polygons.moved_static_polygons.push_back(std::vector<bool>());
+			std::vector<bool> &moved = moved_static_polygons.moved_static_polygons.back();
+			moved.reserve(static_polygon_rotation_changes.size());
+			BOOST_FOREACH(
+					const GPlatesMaths::UnitQuaternion3D &static_polygon_rotation_change,
+					static_polygon_rotation_changes)
 			{
-				solve_velocity_on_surfaces(
-						domain_point,
-						range_element,
-						rigid_plates_query,
-						resolved_networks_query,
-						velocity_delta_time,
-						velocity_delta_time_type);
+				moved.push_back(
+						!GPlatesMaths::represents_identity_rotation(
+								static_polygon_rotation_change * inverse_domain_rotation_change));
 			}
 		}
 
-		multi_point_velocity_fields.push_back(vector_field);
+		moved_static_polygons.domain_indices.push_back(moved_index);
+	}
+
+	return d_partition;
+}
+
+
+void
+GPlatesAppLogic::PlateVelocityUtils::StaticPolygonPartitionCache::set_partition(
+		const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &velocity_domains,
+		const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &reconstructed_static_polygons,
+		std::vector<int> &partition)
+{
+	if (!get_rotated_geometries(d_domains, velocity_domains) ||
+		!get_rotated_geometries(d_static_polygons, reconstructed_static_polygons))
+	{
+		clear();
+		return;
+	}
+
+	d_partition.swap(partition);
+	d_is_valid = true;
+}
+
+
+void
+GPlatesAppLogic::PlateVelocityUtils::StaticPolygonPartitionCache::clear()
+{
+	d_domains.clear();
+	d_static_polygons.clear();
+	d_partition.clear();
+	d_is_valid = false;
+}
+
+
+bool
+GPlatesAppLogic::PlateVelocityUtils::StaticPolygonPartitionCache::get_rotated_geometries(
+		std::vector<RotatedGeometry> &rotated_geometries,
+		const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &rfgs)
+{
+	rotated_geometries.clear();
+	rotated_geometries.reserve(rfgs.size());
+
+	BOOST_FOREACH(const ReconstructedFeatureGeometry::non_null_ptr_type &rfg, rfgs)
+	{
+		// Geometries not reconstructed by a finite rotation (eg, reconstructed using topologies)
+		// don't move rigidly and so their partition cannot be reused.
+		const boost::optional<ReconstructedFeatureGeometry::FiniteRotationReconstruction> &
+				finite_rotation_reconstruction = rfg->finite_rotation_reconstruction();
+		if (!finite_rotation_reconstruction)
+		{
+			return false;
+		}
+
+		rotated_geometries.push_back(
+				RotatedGeometry(
+						finite_rotation_reconstruction->get_resolved_geometry(),
+						finite_rotation_reconstruction->get_reconstruct_method_finite_rotation()->get_finite_rotation(),
+						rfg->reconstruction_plate_id()));
+	}
+
+	return true;
+}
+
+
+bool
+GPlatesAppLogic::PlateVelocityUtils::StaticPolygonPartitionCache::get_rotation_changes(
+		std::vector<GPlatesMaths::UnitQuaternion3D> &rotation_changes,
+		const std::vector<RotatedGeometry> &previous_rotated_geometries,
+		const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &rfgs)
+{
+	rotation_changes.clear();
+	rotation_changes.reserve(rfgs.size());
+
+	for (unsigned int n = 0; n < rfgs.size(); ++n)
+	{
+		const ReconstructedFeatureGeometry &rfg = *rfgs[n];
+		const RotatedGeometry &previous_rotated_geometry = previous_rotated_geometries[n];
+
+		const boost::optional<ReconstructedFeatureGeometry::FiniteRotationReconstruction> &
+				finite_rotation_reconstruction = rfg.finite_rotation_reconstruction();
+		if (!finite_rotation_reconstruction)
+		{
+			return false;
+		}
+
+		// Must be the same unreconstructed geometry.
+		// And the same plate id since the static polygons are searched in order of plate id.
+		if (finite_rotation_reconstruction->get_resolved_geometry() != previous_rotated_geometry.resolved_geometry ||
+			rfg.reconstruction_plate_id() != previous_rotated_geometry.plate_id)
+		{
+			return false;
+		}
+
+		// The rotation since the previous reconstruction.
+		rotation_changes.push_back(
+				finite_rotation_reconstruction->get_reconstruct_method_finite_rotation()->get_finite_rotation().unit_quat() *
+					previous_rotated_geometry.finite_rotation.unit_quat().get_inverse());
 	}
+
+	return true;
 }
 
 
@@ -1140,6 +2057,35 @@ GPlatesAppLogic::PlateVelocityUtils::calculate_stage_rotation(
 }
 
 
+const GPlatesAppLogic::PlateVelocityUtils::StageRotationCache::Stage &
+GPlatesAppLogic::PlateVelocityUtils::StageRotationCache::get_stage(
+		const GPlatesModel::integer_plate_id_type &reconstruction_plate_id,
+		const ReconstructionTreeCreator &reconstruction_tree_creator)
+{
+	const stage_map_type::key_type stage_key(reconstruction_tree_creator, reconstruction_plate_id);
+
+	stage_map_type::iterator stage_iter = d_stages.find(stage_key);
+	if (stage_iter == d_stages.end())
+	{
+		const GPlatesMaths::FiniteRotation stage_rotation = calculate_stage_rotation(
+				reconstruction_plate_id,
+				reconstruction_tree_creator,
+				d_reconstruction_time,
+				d_velocity_delta_time,
+				d_velocity_delta_time_type);
+
+		stage_iter = d_stages.insert(
+				stage_map_type::value_type(
+						stage_key,
+						Stage(
+								stage_rotation,
+								GPlatesMaths::calculate_velocity_angular_vector(stage_rotation, d_velocity_delta_time)))).first;
+	}
+
+	return stage_iter->second;
+}
+
+
 GPlatesMaths::VectorColatitudeLongitude
 GPlatesAppLogic::PlateVelocityUtils::calculate_velocity_colat_lon(
 		const GPlatesMaths::PointOnSphere &point,
@@ -1182,6 +2128,20 @@ GPlatesAppLogic::PlateVelocityUtils::TopologicalNetworksVelocities::TopologicalN
 }
 
 
+void
+GPlatesAppLogic::PlateVelocityUtils::TopologicalNetworksVelocities::prepare_concurrent_velocity_queries(
+		const double &velocity_delta_time,
+		VelocityDeltaTime::Type velocity_delta_time_type) const
+{
+	BOOST_FOREACH(const ResolvedTopologicalNetwork::non_null_ptr_type &network, d_networks)
+	{
+		network->get_triangulation_network().prepare_concurrent_velocity_queries(
+				velocity_delta_time,
+				velocity_delta_time_type);
+	}
+}
+
+
 boost::optional<
 		std::pair<
 				const GPlatesAppLogic::ReconstructionGeometry *,
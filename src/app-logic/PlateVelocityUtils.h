@@ -47,6 +47,7 @@
 
 #include "maths/CalculateVelocity.h"
 #include "maths/FiniteRotation.h"
+#include "maths/UnitQuaternion3D.h"
 #include "maths/Vector3D.h"
 
 #include "model/FeatureCollectionHandle.h"
@@ -114,6 +115,132 @@ namespace GPlatesAppLogic
 			bool exclude_deforming_regions;
 		};
 
+
+		/**
+		 * Remembers which reconstructed static polygon each velocity domain point was found in so that
+		 * a subsequent call to @a solve_velocities_on_surfaces (eg, the next frame of a velocity export)
+		 * only needs to test each domain point against the static polygons that have moved relative to it.
+		 *
+		 * A static polygon rotated by the same rotation as a domain (since the partition was cached)
+		 * has not moved relative to the domain's points - typically static polygons with the same
+		 * plate id as the domain (eg, domain points assigned plate ids using the static polygons).
+		 * Whether it contains a domain point is unchanged, so only the static polygons that have moved
+		 * relative to the domain are tested (and, if the point was in a static polygon that has not
+		 * moved relative to it, only those tested before that static polygon, since the first static
+		 * polygon containing a point wins). The result is the same as testing all static polygons.
+		 *
+		 * This only applies when static polygons are the only velocity surfaces (and there's no
+		 * velocity smoothing), and the cached partition is only reused if the velocity domains and
+		 * static polygons have the same (unreconstructed) geometries and plate ids as before, and
+		 * were all reconstructed using finite rotations.
+		 *
+		 * It's up to the owner of the cache to @a clear it when the input layers change.
+		 */
+		class StaticPolygonPartitionCache
+		{
+		public:
+
+			/**
+			 * Which static polygons have moved relative to each domain since the partition was cached.
+			 */
+			struct MovedStaticPolygons
+			{
+				/**
+				 * The index into @a moved_static_polygons of each domain.
+				 *
+				 * Domains rotated by the same rotation (eg, with the same plate id) share an index.
+				 */
+				std::vector<unsigned int> domain_indices;
+
+				//! Whether each static polygon has moved relative to the domains sharing the index.
+				std::vector< std::vector<bool> > moved_static_polygons;
+			};
+
+
+			StaticPolygonPartitionCache() :
+				d_is_valid(false)
+			{  }
+
+			/**
+			 * Returns the index (into the static polygons) of the static polygon that contained each
+			 * domain point (concatenated over all domains) when the partition was cached, or none if
+			 * the cached partition does not apply to @a velocity_domains and @a reconstructed_static_polygons.
+			 *
+			 * A negative index means the domain point was not in any static polygon.
+			 *
+			 * If the cached partition applies then @a moved_static_polygons is set to the static polygons
+			 * that have moved relative to each domain since it was cached.
+			 */
+			boost::optional<const std::vector<int> &>
+			get_partition(
+					const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &velocity_domains,
+					const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &reconstructed_static_polygons,
+					MovedStaticPolygons &moved_static_polygons) const;
+
+			/**
+			 * Caches the partition of the domain points of @a velocity_domains into
+			 * @a reconstructed_static_polygons (replacing any previous partition).
+			 *
+			 * The contents of @a partition are swapped into the cache.
+			 *
+			 * Nothing is cached if any domain or static polygon was not reconstructed using
+			 * a finite rotation (eg, reconstructed using topologies).
+			 */
+			void
+			set_partition(
+					const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &velocity_domains,
+					const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &reconstructed_static_polygons,
+					std::vector<int> &partition);
+
+			void
+			clear();
+
+		private:
+
+			/**
+			 * An unreconstructed geometry and the rotation that reconstructed it.
+			 */
+			struct RotatedGeometry
+			{
+				RotatedGeometry(
+						const GPlatesMaths::GeometryOnSphere::non_null_ptr_to_const_type &resolved_geometry_,
+						const GPlatesMaths::FiniteRotation &finite_rotation_,
+						boost::optional<GPlatesModel::integer_plate_id_type> plate_id_) :
+					resolved_geometry(resolved_geometry_),
+					finite_rotation(finite_rotation_),
+					plate_id(plate_id_)
+				{  }
+
+				GPlatesMaths::GeometryOnSphere::non_null_ptr_to_const_type resolved_geometry;
+				GPlatesMaths::FiniteRotation finite_rotation;
+				boost::optional<GPlatesModel::integer_plate_id_type> plate_id;
+			};
+
+			std::vector<RotatedGeometry> d_domains;
+			std::vector<RotatedGeometry> d_static_polygons;
+			std::vector<int> d_partition;
+			bool d_is_valid;
+
+			static
+			bool
+			get_rotated_geometries(
+					std::vector<RotatedGeometry> &rotated_geometries,
+					const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &rfgs);
+
+			/**
+			 * Returns the rotation of each of @a rfgs since it was reconstructed as @a previous_rotated_geometries,
+			 * or false if any of @a rfgs has a different unreconstructed geometry or plate id (or was not
+			 * reconstructed using a finite rotation).
+			 */
+			static
+			bool
+			get_rotation_changes(
+					std::vector<GPlatesMaths::UnitQuaternion3D> &rotation_changes,
+					const std::vector<RotatedGeometry> &previous_rotated_geometries,
+					const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &rfgs);
+		};
+
+
 		/**
 		 * Solves velocities for the specified velocity surfaces:
 		 * - reconstructed static polygons,
@@ -162,6 +289,17 @@ namespace GPlatesAppLogic
 		 * Note that all @a ReconstructionGeometry derived objects (domains and surfaces) have a
 		 * reconstruction time of @a reconstruction_time so it is simply provided to avoid having
 		 * to retrieve it from any of those @a ReconstructionGeometry objects.
+		 *
+		 * The velocities of the domain points are solved in parallel (using all available cores).
+		 * The velocity surfaces are prepared up front (eg, building point-in-polygon structures and
+		 * calculating network vertex velocities and rigid plate stage rotations) and then only read
+		 * while solving, so the results are the same as solving serially.
+		 * Within each thread, the velocities of consecutive domain points in the same rigid plate
+		 * are calculated in a batch (see GPlatesMaths::calculate_velocity_vectors).
+		 *
+		 * If @a static_polygon_partition_cache is specified then it is used to avoid testing each
+		 * domain point against all static polygons when the cached partition still applies
+		 * (see @a StaticPolygonPartitionCache), and it is then updated with the new partition.
 		 */
 		void
 		solve_velocities_on_surfaces(
@@ -176,7 +314,8 @@ namespace GPlatesAppLogic
 				const std::vector<GPlatesGlobal::PointerTraits<ResolvedTopologicalNetwork>::non_null_ptr_type> &velocity_surface_resolved_topological_networks,
 				const double &velocity_delta_time = 1.0,
 				VelocityDeltaTime::Type velocity_delta_time_type = VelocityDeltaTime::T_PLUS_MINUS_HALF_DELTA_T,
-				const boost::optional<VelocitySmoothingOptions> &velocity_smoothing_options = boost::none);
+				const boost::optional<VelocitySmoothingOptions> &velocity_smoothing_options = boost::none,
+				boost::optional<StaticPolygonPartitionCache &> static_polygon_partition_cache = boost::none);
 
 
 		//////////////////////////////
@@ -287,6 +426,85 @@ namespace GPlatesAppLogic
 				VelocityDeltaTime::Type velocity_delta_time_type);
 
 
+		/**
+		 * Caches the stage rotation (and velocity angular vector) of each plate for a single
+		 * reconstruction time and velocity delta time.
+		 *
+		 * Calculating a stage rotation involves looking up the plate in two reconstruction trees,
+		 * so when calculating velocities of many geometries (or points) this ensures it's only done
+		 * once per plate (and reconstruction tree creator).
+		 *
+		 * NOTE: This is not thread-safe (the cache is filled on demand).
+		 */
+		class StageRotationCache
+		{
+		public:
+
+			StageRotationCache(
+					const double &reconstruction_time,
+					const double &velocity_delta_time,
+					VelocityDeltaTime::Type velocity_delta_time_type) :
+				d_reconstruction_time(reconstruction_time),
+				d_velocity_delta_time(velocity_delta_time),
+				d_velocity_delta_time_type(velocity_delta_time_type)
+			{  }
+
+			/**
+			 * Returns the stage rotation of the specified plate (see @a calculate_stage_rotation).
+			 */
+			const GPlatesMaths::FiniteRotation &
+			get_stage_rotation(
+					const GPlatesModel::integer_plate_id_type &reconstruction_plate_id,
+					const ReconstructionTreeCreator &reconstruction_tree_creator)
+			{
+				return get_stage(reconstruction_plate_id, reconstruction_tree_creator).stage_rotation;
+			}
+
+			/**
+			 * Returns the velocity angular vector of the specified plate
+			 * (see GPlatesMaths::calculate_velocity_angular_vector).
+			 *
+			 * The velocity of any point on the plate is then the cross product of this vector and the point.
+			 */
+			const GPlatesMaths::Vector3D &
+			get_velocity_angular_vector(
+					const GPlatesModel::integer_plate_id_type &reconstruction_plate_id,
+					const ReconstructionTreeCreator &reconstruction_tree_creator)
+			{
+				return get_stage(reconstruction_plate_id, reconstruction_tree_creator).velocity_angular_vector;
+			}
+
+		private:
+
+			struct Stage
+			{
+				Stage(
+						const GPlatesMaths::FiniteRotation &stage_rotation_,
+						const GPlatesMaths::Vector3D &velocity_angular_vector_) :
+					stage_rotation(stage_rotation_),
+					velocity_angular_vector(velocity_angular_vector_)
+				{  }
+
+				GPlatesMaths::FiniteRotation stage_rotation;
+				GPlatesMaths::Vector3D velocity_angular_vector;
+			};
+
+			typedef std::map<
+					std::pair<ReconstructionTreeCreator, GPlatesModel::integer_plate_id_type>,
+					Stage> stage_map_type;
+
+			double d_reconstruction_time;
+			double d_velocity_delta_time;
+			VelocityDeltaTime::Type d_velocity_delta_time_type;
+			stage_map_type d_stages;
+
+			const Stage &
+			get_stage(
+					const GPlatesModel::integer_plate_id_type &reconstruction_plate_id,
+					const ReconstructionTreeCreator &reconstruction_tree_creator);
+		};
+
+
 		////////////////////////////////////////////////
 		// Utilities relevant to topological networks //
 		////////////////////////////////////////////////
@@ -321,6 +539,17 @@ namespace GPlatesAppLogic
 					const double &velocity_delta_time = 1.0,
 					VelocityDeltaTime::Type velocity_delta_time_type = VelocityDeltaTime::T_PLUS_DELTA_T_TO_T) const;
 
+			/**
+			 * Prepares the networks so that @a calculate_velocity can subsequently be called concurrently
+			 * from multiple threads (using the same @a velocity_delta_time and @a velocity_delta_time_type).
+			 *
+			 * NOTE: This must be called from a single thread.
+			 */
+			void
+			prepare_concurrent_velocity_queries(
+					const double &velocity_delta_time = 1.0,
+					VelocityDeltaTime::Type velocity_delta_time_type = VelocityDeltaTime::T_PLUS_DELTA_T_TO_T) const;
+
 		private:
 
 			typedef std::vector<GPlatesGlobal::PointerTraits<ResolvedTopologicalNetwork>::non_null_ptr_type> network_seq_type;
@@ -241,6 +241,21 @@ namespace GPlatesAppLogic
 				const GPlatesPropertyValues::TextContent &raster_band_name);
 
 
+		/**
+		 * Returns true if the raster is reconstructed (using reconstructed polygons) or masked
+		 * by an age grid.
+		 *
+		 * If this returns false then @a get_multi_resolution_data_raster simply returns the
+		 * (unreconstructed) proxied raster.
+		 */
+		bool
+		is_reconstructed() const
+		{
+			return !d_current_reconstructed_polygons_layer_proxies.empty() ||
+					d_current_age_grid_raster_layer_proxy.boolean_test();
+		}
+
+
 		/**
 		 * Returns the possibly reconstructed (multi-resolution) *data* raster for the current
 		 * reconstruction time and current raster band.
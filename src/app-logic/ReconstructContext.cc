@@ -190,6 +190,137 @@ GPlatesAppLogic::ReconstructContext::set_features(
 }
 
 
+bool
+GPlatesAppLogic::ReconstructContext::update_features(
+		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &modified_features,
+		boost::optional<std::vector<GPlatesModel::FeatureHandle::weak_ref> &> reconstructable_features)
+{
+	std::set<const GPlatesModel::FeatureHandle *> modified_feature_handles;
+	BOOST_FOREACH(const GPlatesModel::FeatureHandle::weak_ref &modified_feature_ref, modified_features)
+	{
+		modified_feature_handles.insert(modified_feature_ref.handle_ptr());
+	}
+
+	// Whether the geometry property handles of the unmodified features remain valid.
+	bool preserved_geometry_property_handles = true;
+
+	// The modified features that we already have (regardless of whether they're still reconstructable).
+	std::set<const GPlatesModel::FeatureHandle *> existing_modified_feature_handles;
+
+	// For each feature in the updated sequence, the index of the same *unmodified* feature in the
+	// current sequence (or none if the feature was modified or is new).
+	std::vector< boost::optional<unsigned int> > unmodified_feature_indices;
+
+	// Re-determine the reconstruct methods of the modified features we already have and
+	// remove those features that are no longer valid or no longer reconstructable.
+	reconstruct_method_feature_seq_type reconstruct_method_feature_seq;
+	reconstruct_method_feature_seq.reserve(d_reconstruct_method_feature_seq.size() + modified_features.size());
+	unmodified_feature_indices.reserve(d_reconstruct_method_feature_seq.size() + modified_features.size());
+	const unsigned int num_features = d_reconstruct_method_feature_seq.size();
+	for (unsigned int feature_index = 0; feature_index < num_features; ++feature_index)
+	{
+		const ReconstructMethodFeature &reconstruct_method_feature = d_reconstruct_method_feature_seq[feature_index];
+
+		const GPlatesModel::FeatureHandle::weak_ref &feature_ref = reconstruct_method_feature.feature_ref;
+		if (!feature_ref.is_valid())
+		{
+			// Removing a feature's geometry property handles leaves a hole in the present day geometries.
+			if (!reconstruct_method_feature.geometry_property_to_handle_seq.empty())
+			{
+				preserved_geometry_property_handles = false;
+			}
+			continue;
+		}
+
+		if (modified_feature_handles.find(feature_ref.handle_ptr()) == modified_feature_handles.end())
+		{
+			// Feature was not modified so keep its reconstruct method and geometry property handles.
+			reconstruct_method_feature_seq.push_back(reconstruct_method_feature);
+			unmodified_feature_indices.push_back(feature_index);
+			continue;
+		}
+
+		existing_modified_feature_handles.insert(feature_ref.handle_ptr());
+
+		boost::optional<ReconstructMethod::Type> reconstruct_method_type =
+				d_reconstruct_method_registry.get_reconstruct_method_type(feature_ref);
+		if (!reconstruct_method_type)
+		{
+			if (!reconstruct_method_feature.geometry_property_to_handle_seq.empty())
+			{
+				preserved_geometry_property_handles = false;
+			}
+			continue;
+		}
+
+		// Keep the feature's geometry property handles (for now) so they can be re-used below.
+		reconstruct_method_feature_seq.push_back(
+				ReconstructMethodFeature(feature_ref, reconstruct_method_type.get()));
+		reconstruct_method_feature_seq.back().geometry_property_to_handle_seq =
+				reconstruct_method_feature.geometry_property_to_handle_seq;
+		unmodified_feature_indices.push_back(boost::none);
+	}
+
+	// Add any modified features that were not previously reconstructable but now are.
+	BOOST_FOREACH(const GPlatesModel::FeatureHandle::weak_ref &modified_feature_ref, modified_features)
+	{
+		if (!modified_feature_ref.is_valid() ||
+			!existing_modified_feature_handles.insert(modified_feature_ref.handle_ptr()).second)
+		{
+			continue;
+		}
+
+		boost::optional<ReconstructMethod::Type> reconstruct_method_type =
+				d_reconstruct_method_registry.get_reconstruct_method_type(modified_feature_ref);
+		if (reconstruct_method_type)
+		{
+			reconstruct_method_feature_seq.push_back(
+					ReconstructMethodFeature(modified_feature_ref, reconstruct_method_type.get()));
+			unmodified_feature_indices.push_back(boost::none);
+		}
+	}
+
+	d_reconstruct_method_feature_seq.swap(reconstruct_method_feature_seq);
+
+	// Re-use the reconstruct methods of the unmodified features in the context states.
+	update_context_states(unmodified_feature_indices);
+
+	// Update the geometry property handles (and present day geometries) of the modified features,
+	// or re-assign them all (later) if that's not possible.
+	if (have_assigned_geometry_property_handles())
+	{
+		if (!preserved_geometry_property_handles ||
+			!update_geometry_property_handles(unmodified_feature_indices))
+		{
+			preserved_geometry_property_handles = false;
+
+			d_cached_present_day_geometries = boost::none;
+			BOOST_FOREACH(
+					ReconstructMethodFeature &reconstruct_method_feature,
+					d_reconstruct_method_feature_seq)
+			{
+				reconstruct_method_feature.geometry_property_to_handle_seq.clear();
+			}
+		}
+	}
+
+	// Return all reconstructable features, if requested by the caller.
+	if (reconstructable_features)
+	{
+		reconstructable_features->clear();
+		reconstructable_features->reserve(d_reconstruct_method_feature_seq.size());
+		BOOST_FOREACH(
+				const ReconstructMethodFeature &reconstruct_method_feature,
+				d_reconstruct_method_feature_seq)
+		{
+			reconstructable_features->push_back(reconstruct_method_feature.feature_ref);
+		}
+	}
+
+	return preserved_geometry_property_handles;
+}
+
+
 GPlatesAppLogic::ReconstructContext::context_state_reference_type
 GPlatesAppLogic::ReconstructContext::create_context_state(
 		const ReconstructMethodInterface::Context &reconstruct_method_context)
@@ -407,6 +538,63 @@ GPlatesAppLogic::ReconstructContext::get_reconstructed_features(
 }
 
 
+void
+GPlatesAppLogic::ReconstructContext::get_reconstructed_features(
+		std::vector<ReconstructedFeature> &reconstructed_features,
+		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &features,
+		const context_state_reference_type &context_state_ref,
+		const double &reconstruction_time,
+		ReconstructHandle::type reconstruct_handle)
+{
+	PROFILE_FUNC();
+
+	// Since we're mapping RFGs to geometry property handles we need to ensure
+	// that the handles have been assigned.
+	if (!have_assigned_geometry_property_handles())
+	{
+		assign_geometry_property_handles();
+	}
+
+	// The context state should have the same number of features (reconstruct methods).
+	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+			context_state_ref->d_reconstruct_methods.size() == d_reconstruct_method_feature_seq.size(),
+			GPLATES_ASSERTION_SOURCE);
+
+	std::vector<unsigned int> feature_indices;
+	get_feature_indices(feature_indices, features);
+
+	reconstructed_features.reserve(reconstructed_features.size() + feature_indices.size());
+
+	// Iterate over the reconstruct methods of the specified features and reconstruct.
+	BOOST_FOREACH(unsigned int feature_index, feature_indices)
+	{
+		const ReconstructMethodFeature &reconstruct_method_feature = d_reconstruct_method_feature_seq[feature_index];
+
+		const ReconstructMethodInterface::non_null_ptr_type context_state_reconstruct_method =
+				context_state_ref->d_reconstruct_methods[feature_index];
+
+		// Reconstruct the current feature.
+		std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> reconstructed_feature_geometries;
+		context_state_reconstruct_method->reconstruct_feature_geometries(
+				reconstructed_feature_geometries,
+				reconstruct_handle,
+				context_state_ref->d_reconstruct_method_context,
+				reconstruction_time);
+
+		// Add a reconstructed feature objects to the caller's sequence.
+		reconstructed_features.push_back(
+				ReconstructedFeature(context_state_reconstruct_method->get_feature_ref()));
+		ReconstructedFeature &reconstructed_feature = reconstructed_features.back();
+
+		// Convert the reconstructed feature geometries to reconstructions for the current feature.
+		get_feature_reconstructions(
+				reconstructed_feature.d_reconstructions,
+				reconstruct_method_feature.geometry_property_to_handle_seq,
+				reconstructed_feature_geometries);
+	}
+}
+
+
 GPlatesAppLogic::ReconstructHandle::type
 GPlatesAppLogic::ReconstructContext::get_reconstruction_time_spans(
 		std::vector<ReconstructionTimeSpan> &reconstruction_time_spans,
@@ -691,6 +879,40 @@ GPlatesAppLogic::ReconstructContext::reconstruct_feature_velocities(
 }
 
 
+void
+GPlatesAppLogic::ReconstructContext::reconstruct_feature_velocities(
+		std::vector<MultiPointVectorField::non_null_ptr_type> &reconstructed_feature_velocities,
+		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &features,
+		const context_state_reference_type &context_state_ref,
+		const double &reconstruction_time,
+		ReconstructHandle::type reconstruct_handle,
+		const double &velocity_delta_time,
+		VelocityDeltaTime::Type velocity_delta_time_type)
+{
+	PROFILE_FUNC();
+
+	// The context state should have the same number of features (reconstruct methods).
+	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+			context_state_ref->d_reconstruct_methods.size() == d_reconstruct_method_feature_seq.size(),
+			GPLATES_ASSERTION_SOURCE);
+
+	std::vector<unsigned int> feature_indices;
+	get_feature_indices(feature_indices, features);
+
+	// Iterate over the reconstruct methods of the specified features.
+	BOOST_FOREACH(unsigned int feature_index, feature_indices)
+	{
+		context_state_ref->d_reconstruct_methods[feature_index]->reconstruct_feature_velocities(
+				reconstructed_feature_velocities,
+				reconstruct_handle,
+				context_state_ref->d_reconstruct_method_context,
+				reconstruction_time,
+				velocity_delta_time,
+				velocity_delta_time_type);
+	}
+}
+
+
 void
 GPlatesAppLogic::ReconstructContext::get_feature_reconstructions(
 		std::vector<Reconstruction> &reconstructions,
@@ -944,3 +1166,146 @@ GPlatesAppLogic::ReconstructContext::initialise_context_states()
 		}
 	}
 }
+
+
+void
+GPlatesAppLogic::ReconstructContext::update_context_states(
+		const std::vector< boost::optional<unsigned int> > &unmodified_feature_indices)
+{
+	// We take the opportunity to remove any expired context states (that the client is no
+	// longer using) in order to compress the size of the array.
+	d_context_states.erase(
+			std::remove_if(d_context_states.begin(), d_context_states.end(),
+					boost::bind(&context_state_weak_reference_type::expired, boost::placeholders::_1)),
+			d_context_states.end());
+
+	const unsigned int num_features = d_reconstruct_method_feature_seq.size();
+
+	// Iterate over the existing context states and re-create the reconstruct methods of only
+	// the modified (and new) features. The unmodified features keep their reconstruct methods
+	// (and any internal state, such as deformation lookup tables, accumulated by them).
+	BOOST_FOREACH(const context_state_weak_reference_type &context_state_weak_ref, d_context_states)
+	{
+		context_state_reference_type context_state_ref(context_state_weak_ref);
+
+		ContextState::reconstruct_method_seq_type reconstruct_methods;
+		reconstruct_methods.reserve(num_features);
+
+		for (unsigned int feature_index = 0; feature_index < num_features; ++feature_index)
+		{
+			const boost::optional<unsigned int> &unmodified_feature_index =
+					unmodified_feature_indices[feature_index];
+			if (unmodified_feature_index)
+			{
+				reconstruct_methods.push_back(
+						context_state_ref->d_reconstruct_methods[unmodified_feature_index.get()]);
+				continue;
+			}
+
+			const ReconstructMethodFeature &reconstruct_method_feature =
+					d_reconstruct_method_feature_seq[feature_index];
+
+			// Create a new reconstruct method for the current feature and its reconstruct method type.
+			reconstruct_methods.push_back(
+					d_reconstruct_method_registry.create_reconstruct_method(
+							reconstruct_method_feature.reconstruction_method_type,
+							reconstruct_method_feature.feature_ref,
+							context_state_ref->d_reconstruct_method_context));
+		}
+
+		context_state_ref->d_reconstruct_methods.swap(reconstruct_methods);
+	}
+}
+
+
+bool
+GPlatesAppLogic::ReconstructContext::update_geometry_property_handles(
+		const std::vector< boost::optional<unsigned int> > &unmodified_feature_indices)
+{
+	// Can use default reconstruct params and tree generator since does not affect present day geometries.
+	const ReconstructMethodInterface::Context present_day_reconstruct_method_context(
+			ReconstructParams(),
+			ReconstructionTreeCreator(new IdentityReconstructionTreeCreatorImpl()));
+
+	const unsigned int num_features = d_reconstruct_method_feature_seq.size();
+	for (unsigned int feature_index = 0; feature_index < num_features; ++feature_index)
+	{
+		// Unmodified features keep their geometry property handles.
+		if (unmodified_feature_indices[feature_index])
+		{
+			continue;
+		}
+
+		ReconstructMethodFeature &reconstruct_method_feature = d_reconstruct_method_feature_seq[feature_index];
+
+		// Get the present day geometries for the current feature.
+		const ReconstructMethodInterface::non_null_ptr_type reconstruct_method =
+				d_reconstruct_method_registry.create_reconstruct_method(
+						reconstruct_method_feature.reconstruction_method_type,
+						reconstruct_method_feature.feature_ref,
+						present_day_reconstruct_method_context);
+		std::vector<ReconstructMethodInterface::Geometry> present_day_geometries;
+		reconstruct_method->get_present_day_feature_geometries(present_day_geometries);
+
+		ReconstructMethodFeature::geometry_property_to_handle_seq_type &geometry_property_to_handle_seq =
+				reconstruct_method_feature.geometry_property_to_handle_seq;
+
+		if (geometry_property_to_handle_seq.empty())
+		{
+			// The feature has no geometry property handles yet so append new ones.
+			BOOST_FOREACH(const ReconstructMethodInterface::Geometry &present_day_geometry, present_day_geometries)
+			{
+				const ReconstructMethodFeature::GeometryPropertyToHandle geometry_property_to_handle =
+				{
+					present_day_geometry.property_iterator,
+					static_cast<geometry_property_handle_type>(d_cached_present_day_geometries->size())
+				};
+
+				geometry_property_to_handle_seq.push_back(geometry_property_to_handle);
+				d_cached_present_day_geometries->push_back(present_day_geometry.geometry);
+			}
+		}
+		else if (geometry_property_to_handle_seq.size() == present_day_geometries.size())
+		{
+			// Re-use the feature's geometry property handles.
+			for (unsigned int n = 0; n < present_day_geometries.size(); ++n)
+			{
+				geometry_property_to_handle_seq[n].property_iterator = present_day_geometries[n].property_iterator;
+				d_cached_present_day_geometries.get()[geometry_property_to_handle_seq[n].geometry_property_handle] =
+						present_day_geometries[n].geometry;
+			}
+		}
+		else
+		{
+			// The number of geometry properties changed so the handles cannot be re-used.
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+void
+GPlatesAppLogic::ReconstructContext::get_feature_indices(
+		std::vector<unsigned int> &feature_indices,
+		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &features) const
+{
+	std::set<const GPlatesModel::FeatureHandle *> feature_handles;
+	BOOST_FOREACH(const GPlatesModel::FeatureHandle::weak_ref &feature_ref, features)
+	{
+		feature_handles.insert(feature_ref.handle_ptr());
+	}
+
+	const unsigned int num_features = d_reconstruct_method_feature_seq.size();
+	for (unsigned int feature_index = 0; feature_index < num_features; ++feature_index)
+	{
+		const GPlatesModel::FeatureHandle::weak_ref &feature_ref =
+				d_reconstruct_method_feature_seq[feature_index].feature_ref;
+		if (feature_ref.is_valid() &&
+			feature_handles.find(feature_ref.handle_ptr()) != feature_handles.end())
+		{
+			feature_indices.push_back(feature_index);
+		}
+	}
+}
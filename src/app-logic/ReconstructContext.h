@@ -489,6 +489,33 @@ namespace GPlatesAppLogic
 				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &features,
 				boost::optional<std::vector<GPlatesModel::FeatureHandle::weak_ref> &> reconstructable_features = boost::none);
 
+		/**
+		 * Updates the reconstruct methods of the specified modified features (features previously
+		 * added with @a set_features, or features that were not previously reconstructable).
+		 *
+		 * This is cheaper than calling @a set_features with all features again since only the
+		 * modified features need to have their reconstruct method determined. Modified features
+		 * that are no longer reconstructable are removed and modified features that have become
+		 * reconstructable are added (after the existing features).
+		 *
+		 * Existing context states keep the reconstruct methods of the unmodified features
+		 * (only the modified features have their reconstruct methods re-created).
+		 *
+		 * If @a reconstructable_features is specified then it is cleared and the subset of all
+		 * features (not just modified features) that are reconstructable are returned.
+		 *
+		 * Returns true if the geometry property handles of the unmodified features are unchanged,
+		 * in which case any reconstructions (of unmodified features) previously returned by
+		 * @a get_reconstructed_features, etc, remain valid. This is the case unless a modified
+		 * feature changed its number of reconstructable geometry properties or is no longer reconstructable.
+		 * If false is returned then all geometry property handles will get re-assigned and clients
+		 * should discard all their reconstructions (as if @a set_features had been called).
+		 */
+		bool
+		update_features(
+				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &modified_features,
+				boost::optional<std::vector<GPlatesModel::FeatureHandle::weak_ref> &> reconstructable_features = boost::none);
+
 
 		/**
 		 * Creates a context state associated with the specified reconstruct context state.
@@ -512,7 +539,7 @@ namespace GPlatesAppLogic
 		 *
 		 * The returned sequence can be indexed using @a geometry_property_handle_type.
 		 *
-		 * The returned reference is valid until @a set_features is called.
+		 * The returned reference is valid until @a set_features (or @a update_features) is called.
 		 */
 		const std::vector<geometry_type> &
 		get_present_day_feature_geometries();
@@ -586,6 +613,28 @@ namespace GPlatesAppLogic
 				const double &reconstruction_time);
 
 
+		/**
+		 * Same as the other overload of @a get_reconstructed_features but only reconstructs those
+		 * features, specified in the most recent call to @a set_features (or @a update_features),
+		 * that are in @a features.
+		 *
+		 * Features in @a features that are not reconstructable are ignored.
+		 *
+		 * Unlike the other overload, this method does not get the next global reconstruct handle.
+		 * Instead the specified @a reconstruct_handle is stored in each @a ReconstructedFeatureGeometry
+		 * instance created. This is useful for replacing the reconstructions of modified features
+		 * in a previous reconstruction of all features (where the retained reconstructions of the
+		 * unmodified features are then given the same new handle).
+		 */
+		void
+		get_reconstructed_features(
+				std::vector<ReconstructedFeature> &reconstructed_features,
+				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &features,
+				const context_state_reference_type &context_state_ref,
+				const double &reconstruction_time,
+				ReconstructHandle::type reconstruct_handle);
+
+
 		/**
 		 * This is similar to @a get_reconstructions but reconstructs over a time range of
 		 * reconstruction times instead of a single reconstruction time.
@@ -658,6 +707,24 @@ namespace GPlatesAppLogic
 				const double &velocity_delta_time = 1.0,
 				VelocityDeltaTime::Type velocity_delta_time_type = VelocityDeltaTime::T_PLUS_MINUS_HALF_DELTA_T);
 
+
+		/**
+		 * Same as the other overload of @a reconstruct_feature_velocities but only calculates
+		 * velocities for those features that are in @a features (and are reconstructable).
+		 *
+		 * As with the feature-limited overload of @a get_reconstructed_features, the specified
+		 * @a reconstruct_handle is stored in the @a MultiPointVectorField velocity objects.
+		 */
+		void
+		reconstruct_feature_velocities(
+				std::vector<MultiPointVectorField::non_null_ptr_type> &reconstructed_feature_velocities,
+				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &features,
+				const context_state_reference_type &context_state_ref,
+				const double &reconstruction_time,
+				ReconstructHandle::type reconstruct_handle,
+				const double &velocity_delta_time,
+				VelocityDeltaTime::Type velocity_delta_time_type);
+
 	private:
 
 		/**
@@ -763,6 +830,35 @@ namespace GPlatesAppLogic
 
 		void
 		initialise_context_states();
+
+		/**
+		 * Updates the reconstruct methods of the context states after the features have been
+		 * updated by @a update_features.
+		 *
+		 * Each entry of @a unmodified_feature_indices maps a feature to the index of its existing
+		 * reconstruct method (or none if the feature is modified or new).
+		 */
+		void
+		update_context_states(
+				const std::vector< boost::optional<unsigned int> > &unmodified_feature_indices);
+
+		/**
+		 * Updates the geometry property handles (and present day geometries) of the modified
+		 * features after the features have been updated by @a update_features.
+		 *
+		 * Returns false if the existing geometry property handles could not be re-used.
+		 */
+		bool
+		update_geometry_property_handles(
+				const std::vector< boost::optional<unsigned int> > &unmodified_feature_indices);
+
+		/**
+		 * Returns the indices (into our sequence of features) of the specified features.
+		 */
+		void
+		get_feature_indices(
+				std::vector<unsigned int> &feature_indices,
+				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &features) const;
 	};
 }
 
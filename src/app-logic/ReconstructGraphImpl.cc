@@ -364,7 +364,8 @@ GPlatesAppLogic::ReconstructGraphImpl::LayerInputConnection::input_layer_activat
 
 
 void
-GPlatesAppLogic::ReconstructGraphImpl::LayerInputConnection::modified_input_feature_collection()
+GPlatesAppLogic::ReconstructGraphImpl::LayerInputConnection::modified_input_feature_collection(
+		const FeatureCollectionModified::modified_event_type &event)
 {
 	//
 	// Notify the layer task of the layer receiving input from this connection
@@ -384,9 +385,40 @@ GPlatesAppLogic::ReconstructGraphImpl::LayerInputConnection::modified_input_feat
 					d_input_data->get_input_file();
 			if (input_file)
 			{
-				layer_task.modified_input_file(
-						d_layer_input_channel_name,
-						input_file->get_file().get_feature_collection());
+				const GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection =
+						input_file->get_file().get_feature_collection();
+
+				// If features were only modified (not added or removed) then let the layer task
+				// know which features were modified (otherwise it could be any feature).
+				if (event.type() == FeatureCollectionModified::modified_event_type::CHILD_MODIFIED &&
+					feature_collection.is_valid())
+				{
+					std::vector<GPlatesModel::FeatureHandle::weak_ref> modified_features;
+					modified_features.reserve(event.modified_children().size());
+					BOOST_FOREACH(
+							const GPlatesModel::FeatureCollectionHandle::const_iterator &modified_feature_iter,
+							event.modified_children())
+					{
+						// Use our non-const feature collection to get a non-const feature reference.
+						const GPlatesModel::FeatureCollectionHandle::iterator feature_iter(
+								*feature_collection, modified_feature_iter.index());
+						if (feature_iter.is_still_valid())
+						{
+							modified_features.push_back((*feature_iter)->reference());
+						}
+					}
+
+					layer_task.modified_input_features(
+							d_layer_input_channel_name,
+							feature_collection,
+							modified_features);
+				}
+				else
+				{
+					layer_task.modified_input_file(
+							d_layer_input_channel_name,
+							feature_collection);
+				}
 			}
 		}
 	}
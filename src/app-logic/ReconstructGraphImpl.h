@@ -259,7 +259,7 @@ namespace GPlatesAppLogic
 						const weak_reference_type &reference,
 						const modified_event_type &event)
 				{
-					d_layer_input_connection->modified_input_feature_collection();
+					d_layer_input_connection->modified_input_feature_collection(event);
 				}
 
 			private:
@@ -267,8 +267,14 @@ namespace GPlatesAppLogic
 			};
 
 
+			/**
+			 * If only features in the input feature collection were modified (ie, no features were
+			 * added or removed) then the layer task is told which features were modified, otherwise
+			 * the layer task is told the entire input feature collection was modified.
+			 */
 			void
-			modified_input_feature_collection();
+			modified_input_feature_collection(
+					const FeatureCollectionModified::modified_event_type &event);
 
 
 			boost::shared_ptr<Data> d_input_data;
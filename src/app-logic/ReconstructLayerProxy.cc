@@ -23,8 +23,10 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <map>
 #include <boost/bind/bind.hpp>
 #include <boost/foreach.hpp>
+#include <boost/ref.hpp>
 #include <boost/utility/in_place_factory.hpp>
 
 #include <QDebug>
@@ -83,6 +85,246 @@ namespace GPlatesAppLogic
 					reconstruction.get_reconstructed_feature_geometry(),
 					rfg_node);
 		}
+
+		//! Returns the feature referenced by a reconstructed feature.
+		inline
+		const GPlatesModel::FeatureHandle *
+		get_feature_handle_ptr(
+				const ReconstructContext::ReconstructedFeature &reconstructed_feature)
+		{
+			return reconstructed_feature.get_feature().handle_ptr();
+		}
+
+		//! Returns the feature referenced by a reconstructed feature velocity.
+		inline
+		const GPlatesModel::FeatureHandle *
+		get_feature_handle_ptr(
+				const MultiPointVectorField::non_null_ptr_type &reconstructed_feature_velocity)
+		{
+			return reconstructed_feature_velocity->feature_handle_ptr();
+		}
+
+		/**
+		 * Replaces the cached elements (reconstructed features or velocities) of the modified
+		 * features with their updated elements.
+		 *
+		 * The updated elements of each modified feature are placed where its cached elements were,
+		 * or appended if the feature had no cached elements. Cached elements of modified features
+		 * that have no updated elements (eg, no longer reconstructable) are removed.
+		 */
+		template <typename ElementType>
+		void
+		splice_modified_features(
+				std::vector<ElementType> &cached_elements,
+				const std::vector<ElementType> &modified_elements,
+				const std::set<const GPlatesModel::FeatureHandle *> &modified_feature_handles)
+		{
+			typedef std::map<const GPlatesModel::FeatureHandle *, std::vector<ElementType> >
+					modified_feature_elements_map_type;
+
+			// Group the updated elements by feature.
+			modified_feature_elements_map_type modified_feature_elements_map;
+			BOOST_FOREACH(const ElementType &modified_element, modified_elements)
+			{
+				modified_feature_elements_map[get_feature_handle_ptr(modified_element)].push_back(modified_element);
+			}
+
+			std::vector<ElementType> spliced_elements;
+			spliced_elements.reserve(cached_elements.size() + modified_elements.size());
+
+			BOOST_FOREACH(const ElementType &cached_element, cached_elements)
+			{
+				const GPlatesModel::FeatureHandle *feature_handle = get_feature_handle_ptr(cached_element);
+				if (modified_feature_handles.find(feature_handle) == modified_feature_handles.end())
+				{
+					spliced_elements.push_back(cached_element);
+					continue;
+				}
+
+				// Insert the updated elements of the modified feature in place of its first cached element.
+				typename modified_feature_elements_map_type::iterator modified_feature_elements_iter =
+						modified_feature_elements_map.find(feature_handle);
+				if (modified_feature_elements_iter != modified_feature_elements_map.end())
+				{
+					spliced_elements.insert(
+							spliced_elements.end(),
+							modified_feature_elements_iter->second.begin(),
+							modified_feature_elements_iter->second.end());
+					modified_feature_elements_map.erase(modified_feature_elements_iter);
+				}
+			}
+
+			// Append the updated elements of any modified features that had no cached elements.
+			BOOST_FOREACH(const ElementType &modified_element, modified_elements)
+			{
+				if (modified_feature_elements_map.find(get_feature_handle_ptr(modified_element)) !=
+					modified_feature_elements_map.end())
+				{
+					spliced_elements.push_back(modified_element);
+				}
+			}
+
+			cached_elements.swap(spliced_elements);
+		}
+
+		/**
+		 * Adds a reconstruction to a reconstructions spatial partition.
+		 */
+		void
+		add_reconstruction_to_spatial_partition(
+				ReconstructLayerProxy::reconstructions_spatial_partition_type &reconstructions_spatial_partition,
+				const ReconstructContext::Reconstruction &reconstruction)
+		{
+			// NOTE: To avoid reconstructing geometries when it might not be needed we add the
+			// *unreconstructed* geometry (and a finite rotation) to the spatial partition.
+			// The spatial partition will rotate only the centroid of the *unreconstructed*
+			// geometry (instead of reconstructing the entire geometry) and then use that as the
+			// insertion location (along with the *unreconstructed* geometry's bounding circle extents).
+			// An example where transforming might not be needed is data mining co-registration
+			// where might not need to transform all geometries to determine if seed and target
+			// features are close enough within a region of interest.
+
+			const ReconstructedFeatureGeometry::non_null_ptr_type &rfg =
+					reconstruction.get_reconstructed_feature_geometry();
+
+			// See if the reconstruction can be represented as a finite rotation.
+			const boost::optional<ReconstructedFeatureGeometry::FiniteRotationReconstruction> &
+					finite_rotation_reconstruction = rfg->finite_rotation_reconstruction();
+			if (finite_rotation_reconstruction)
+			{
+				// The resolved geometry is the *unreconstructed* geometry (but still possibly
+				// the result of a look up of a time-dependent geometry property).
+				const GPlatesMaths::GeometryOnSphere &resolved_geometry =
+						*finite_rotation_reconstruction->get_resolved_geometry();
+				const GPlatesMaths::FiniteRotation &finite_rotation =
+						finite_rotation_reconstruction->get_reconstruct_method_finite_rotation()
+								->get_finite_rotation();
+
+				reconstructions_spatial_partition.add(reconstruction, resolved_geometry, finite_rotation);
+			}
+			else
+			{
+				// It's not a finite rotation so we can't assume the geometry has rigidly rotated.
+				// Hence we can't assume its shape is the same and hence can't assume the
+				// small circle bounding radius is the same.
+				// So just get the reconstructed geometry and insert it into the spatial partition.
+				// The appropriate bounding small circle will be generated for it when it's added.
+				reconstructions_spatial_partition.add(reconstruction, *rfg->reconstructed_geometry());
+			}
+		}
+
+		/**
+		 * Typedef for a mapping of retained RFGs to their copies under a new reconstruct handle.
+		 */
+		typedef std::map<const ReconstructedFeatureGeometry *, ReconstructedFeatureGeometry::non_null_ptr_type>
+				rfg_copy_map_type;
+
+		/**
+		 * Replaces those RFGs of the reconstructed features that don't have the specified reconstruct
+		 * handle with copies that do (and records the copy of each replaced RFG in @a rfg_copies).
+		 *
+		 * The RFGs are copied, rather than modified, since clients can still be referencing them.
+		 */
+		void
+		copy_with_reconstruct_handle(
+				std::vector<ReconstructContext::ReconstructedFeature> &reconstructed_features,
+				ReconstructHandle::type reconstruct_handle,
+				rfg_copy_map_type &rfg_copies)
+		{
+			BOOST_FOREACH(ReconstructContext::ReconstructedFeature &reconstructed_feature, reconstructed_features)
+			{
+				const ReconstructContext::ReconstructedFeature::reconstruction_seq_type &reconstructions =
+						reconstructed_feature.get_reconstructions();
+
+				ReconstructContext::ReconstructedFeature::reconstruction_seq_type copied_reconstructions;
+				copied_reconstructions.reserve(reconstructions.size());
+
+				BOOST_FOREACH(const ReconstructContext::Reconstruction &reconstruction, reconstructions)
+				{
+					const ReconstructedFeatureGeometry::non_null_ptr_type &rfg =
+							reconstruction.get_reconstructed_feature_geometry();
+					if (rfg->get_reconstruct_handle() == reconstruct_handle)
+					{
+						copied_reconstructions.push_back(reconstruction);
+						continue;
+					}
+
+					const ReconstructedFeatureGeometry::non_null_ptr_type rfg_copy =
+							rfg->clone_with_reconstruct_handle(reconstruct_handle);
+					rfg_copies.insert(rfg_copy_map_type::value_type(rfg.get(), rfg_copy));
+
+					copied_reconstructions.push_back(
+							ReconstructContext::Reconstruction(
+									reconstruction.get_geometry_property_handle(),
+									rfg_copy));
+				}
+
+				reconstructed_feature = ReconstructContext::ReconstructedFeature(
+						reconstructed_feature.get_feature(),
+						copied_reconstructions);
+			}
+		}
+
+		/**
+		 * Replaces those reconstructed feature velocities that don't have the specified reconstruct
+		 * handle with copies that do.
+		 *
+		 * The velocities are copied, rather than modified, since clients can still be referencing them.
+		 */
+		void
+		copy_with_reconstruct_handle(
+				std::vector<MultiPointVectorField::non_null_ptr_type> &reconstructed_feature_velocities,
+				ReconstructHandle::type reconstruct_handle)
+		{
+			BOOST_FOREACH(
+					MultiPointVectorField::non_null_ptr_type &reconstructed_feature_velocity,
+					reconstructed_feature_velocities)
+			{
+				if (reconstructed_feature_velocity->get_reconstruct_handle() != reconstruct_handle)
+				{
+					reconstructed_feature_velocity =
+							reconstructed_feature_velocity->clone_with_reconstruct_handle(reconstruct_handle);
+				}
+			}
+		}
+
+		/**
+		 * Combines the resolved networks of a time slot from the resolved network time spans of
+		 * multiple topological network layers (which all have the same time range).
+		 *
+		 * Used to lazily create each time slot of a combined resolved network time span, so that
+		 * the time slots of the individual layers are only resolved when they're first needed.
+		 */
+		boost::optional<TopologyReconstruct::rtn_seq_type>
+		combine_resolved_networks_in_time_slot(
+				const std::vector<TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_to_const_type> &
+						resolved_network_time_spans,
+				unsigned int time_slot,
+				const double &/*time*/)
+		{
+			TopologyReconstruct::rtn_seq_type rtns_in_time_slot;
+
+			// Get the resolved topological networks for the time slot.
+			BOOST_FOREACH(
+					const TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_to_const_type &
+							resolved_network_time_span,
+					resolved_network_time_spans)
+			{
+				boost::optional<const TopologyReconstruct::rtn_seq_type &> rtns =
+						resolved_network_time_span->get_sample_in_time_slot(time_slot);
+				if (rtns)
+				{
+					rtns_in_time_slot.insert(rtns_in_time_slot.end(), rtns->begin(), rtns->end());
+				}
+			}
+
+			if (rtns_in_time_slot.empty())
+			{
+				return boost::none;
+			}
+
+			return rtns_in_time_slot;
+		}
 	}
 }
 
@@ -127,7 +369,7 @@ GPlatesAppLogic::ReconstructLayerProxy::get_reconstructed_feature_geometries(
 
 	// Lookup the cached ReconstructionInfo associated with the reconstruction time and reconstruct params.
 	const reconstruction_cache_key_type reconstruction_cache_key(reconstruction_time, reconstruct_params);
-	ReconstructionInfo &reconstruction_info = d_cached_reconstructions.get_value(reconstruction_cache_key);
+	ReconstructionInfo &reconstruction_info = get_reconstruction_info(reconstruction_cache_key);
 
 	// If the cached reconstruction info has not been initialised or has been evicted from the cache...
 	if (!reconstruction_info.cached_reconstructed_feature_geometries)
@@ -184,7 +426,7 @@ GPlatesAppLogic::ReconstructLayerProxy::get_reconstructions(
 
 	// Lookup the cached ReconstructionInfo associated with the reconstruction time and reconstruct params.
 	const reconstruction_cache_key_type reconstruction_cache_key(reconstruction_time, reconstruct_params);
-	ReconstructionInfo &reconstruction_info = d_cached_reconstructions.get_value(reconstruction_cache_key);
+	ReconstructionInfo &reconstruction_info = get_reconstruction_info(reconstruction_cache_key);
 
 	// If the cached reconstruction info has not been initialised or has been evicted from the cache...
 	if (!reconstruction_info.cached_reconstructions)
@@ -235,7 +477,7 @@ GPlatesAppLogic::ReconstructLayerProxy::get_reconstructed_feature_geometries_spa
 
 	// Lookup the cached ReconstructionInfo associated with the reconstruction time and reconstruct params.
 	const reconstruction_cache_key_type reconstruction_cache_key(reconstruction_time, reconstruct_params);
-	ReconstructionInfo &reconstruction_info = d_cached_reconstructions.get_value(reconstruction_cache_key);
+	ReconstructionInfo &reconstruction_info = get_reconstruction_info(reconstruction_cache_key);
 
 	// If the cached reconstruction info has not been initialised or has been evicted from the cache...
 	if (!reconstruction_info.cached_reconstructed_feature_geometries_spatial_partition)
@@ -286,7 +528,7 @@ GPlatesAppLogic::ReconstructLayerProxy::get_reconstructions_spatial_partition(
 
 	// Lookup the cached ReconstructionInfo associated with the reconstruction time and reconstruct params.
 	const reconstruction_cache_key_type reconstruction_cache_key(reconstruction_time, reconstruct_params);
-	ReconstructionInfo &reconstruction_info = d_cached_reconstructions.get_value(reconstruction_cache_key);
+	ReconstructionInfo &reconstruction_info = get_reconstruction_info(reconstruction_cache_key);
 
 	// If the cached reconstruction info has not been initialised or has been evicted from the cache...
 	if (!reconstruction_info.cached_reconstructions_spatial_partition)
@@ -318,7 +560,7 @@ GPlatesAppLogic::ReconstructLayerProxy::get_reconstructed_features(
 
 	// Lookup the cached ReconstructionInfo associated with the reconstruction time and reconstruct params.
 	const reconstruction_cache_key_type reconstruction_cache_key(reconstruction_time, reconstruct_params);
-	ReconstructionInfo &reconstruction_info = d_cached_reconstructions.get_value(reconstruction_cache_key);
+	ReconstructionInfo &reconstruction_info = get_reconstruction_info(reconstruction_cache_key);
 
 	// If the cached reconstruction info has not been initialised or has been evicted from the cache...
 	if (!reconstruction_info.cached_reconstructed_features)
@@ -432,7 +674,7 @@ GPlatesAppLogic::ReconstructLayerProxy::get_reconstructed_topological_sections(
 	// topologies to reconstruct (because a topology layer is asking us for topological sections and it
 	// won't ask layers, that reconstruct using topologies, to do that).
 	const reconstruction_cache_key_type reconstruction_cache_key(reconstruction_time, reconstruct_params);
-	const ReconstructionInfo &reconstruction_info = d_cached_reconstructions.get_value(reconstruction_cache_key);
+	ReconstructionInfo &reconstruction_info = get_reconstruction_info(reconstruction_cache_key);
 
 	//
 	// We don't want to re-generate the cache - we only want to re-use the cache if it's there.
@@ -440,48 +682,33 @@ GPlatesAppLogic::ReconstructLayerProxy::get_reconstructed_topological_sections(
 	// (this is really just re-using anything that happens to be cached inside the context's ReconstructMethod instances).
 	//
 
-	// If we have cached RFGs then just return them.
-	if (reconstruction_info.cached_reconstructed_feature_geometries)
+	// If we have cached RFGs (or cached 'ReconstructContext::ReconstructedFeature's) then just return them.
+	if (reconstruction_info.cached_reconstructed_feature_geometries ||
+		reconstruction_info.cached_reconstructed_features)
 	{
+		// Index the cached RFGs by feature ID (if not already) so we only visit the referenced features.
+		const TopologicalSectionIndex &topological_section_index =
+				cache_topological_section_index(reconstruction_info);
+
 		// Append, to the caller's sequence, those cached RFGs that match the topological section feature IDs.
-		const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &reconstructed_feature_geometries =
-				reconstruction_info.cached_reconstructed_feature_geometries.get();
-		BOOST_FOREACH(
-				const ReconstructedFeatureGeometry::non_null_ptr_type &reconstructed_feature_geometry,
-				reconstructed_feature_geometries)
+		BOOST_FOREACH(const GPlatesModel::FeatureId &topological_section_referenced, topological_sections_referenced)
 		{
-			const GPlatesModel::FeatureHandle::weak_ref feature_ref = reconstructed_feature_geometry->get_feature_ref();
-			if (feature_ref.is_valid() &&
-				topological_sections_referenced.find(feature_ref->feature_id()) != topological_sections_referenced.end())
+			const TopologicalSectionIndex::reconstruction_geometry_seq_type *rgs =
+					topological_section_index.find(topological_section_referenced);
+			if (rgs == NULL)
 			{
-				reconstructed_topological_sections.push_back(reconstructed_feature_geometry);
+				continue;
 			}
-		}
 
-		return reconstruction_info.cached_reconstructed_feature_geometries_handle.get();
-	}
-
-	// If we have cached 'ReconstructContext::ReconstructedFeature's then convert them to RFGs.
-	if (reconstruction_info.cached_reconstructed_features)
-	{
-		// Copy the RFGs already cached in the ReconstructContext::ReconstructedFeature's into RFG format.
-		// The ReconstructContext::ReconstructedFeature's store RFGs and geometry property handles.
-		// We only need RFGs.
-		const std::vector<ReconstructContext::ReconstructedFeature> &reconstructed_features =
-				reconstruction_info.cached_reconstructed_features.get();
-		BOOST_FOREACH(const ReconstructContext::ReconstructedFeature &reconstructed_feature, reconstructed_features)
-		{
-			// Append, to the caller's sequence, those cached RFGs that match the topological section feature IDs.
-			const GPlatesModel::FeatureHandle::weak_ref feature_ref = reconstructed_feature.get_feature();
-			if (feature_ref.is_valid() &&
-				topological_sections_referenced.find(feature_ref->feature_id()) != topological_sections_referenced.end())
+			BOOST_FOREACH(const ReconstructionGeometry::non_null_ptr_type &rg, *rgs)
 			{
-				const ReconstructContext::ReconstructedFeature::reconstruction_seq_type &reconstructions =
-						reconstructed_feature.get_reconstructions();
-				BOOST_FOREACH(const ReconstructContext::Reconstruction &reconstruction, reconstructions)
+				// The index was built only from our cached RFGs.
+				const ReconstructedFeatureGeometry::non_null_ptr_type reconstructed_feature_geometry =
+						GPlatesUtils::static_pointer_cast<ReconstructedFeatureGeometry>(rg);
+
+				if (reconstructed_feature_geometry->get_feature_ref().is_valid())
 				{
-					reconstructed_topological_sections.push_back(
-							reconstruction.get_reconstructed_feature_geometry());
+					reconstructed_topological_sections.push_back(reconstructed_feature_geometry);
 				}
 			}
 		}
@@ -611,7 +838,7 @@ GPlatesAppLogic::ReconstructLayerProxy::get_reconstructed_feature_velocities(
 
 	// Lookup the cached ReconstructionInfo associated with the reconstruction time and reconstruct params.
 	const reconstruction_cache_key_type reconstruction_cache_key(reconstruction_time, reconstruct_params);
-	ReconstructionInfo &reconstruction_info = d_cached_reconstructions.get_value(reconstruction_cache_key);
+	ReconstructionInfo &reconstruction_info = get_reconstruction_info(reconstruction_cache_key);
 
 	// If the velocity delta time parameters have changed then remove the velocities from the cache.
 	if (reconstruction_info.cached_velocity_delta_time_params !=
@@ -673,11 +900,6 @@ GPlatesAppLogic::ReconstructLayerProxy::get_reconstruct_method_context(
 					// +1 accounts for the extra time step used to generate deformed geometries...
 					num_time_slots + 1);
 
-	// Create our resolved network time span that combines resolved networks from
-	// *all* topological network layers.
-	TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_type combined_resolved_network_time_span =
-			TopologyReconstruct::resolved_network_time_span_type::create(time_range);
-
 	// Get a resolved network time span from each topological network layer.
 	std::vector<TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_to_const_type>
 			resolved_network_time_spans;
@@ -696,36 +918,25 @@ GPlatesAppLogic::ReconstructLayerProxy::get_reconstruct_method_context(
 		resolved_network_time_spans.push_back(resolved_network_time_span);
 	}
 
-	// Iterate over the time slots of the time span and fill in the resolved topological networks.
-	for (unsigned int time_slot = 0; time_slot < num_time_slots; ++time_slot)
-	{
-		TopologyReconstruct::rtn_seq_type rtns_in_time_slot;
-
-		// Get the resolved topological networks for the current time slot.
-		std::vector<TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_to_const_type>::const_iterator
-				resolved_network_time_spans_iter = resolved_network_time_spans.begin();
-		std::vector<TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_to_const_type>::const_iterator
-				resolved_network_time_spans_end = resolved_network_time_spans.end();
-		for ( ;
-			resolved_network_time_spans_iter != resolved_network_time_spans_end;
-			++resolved_network_time_spans_iter)
-		{
-			TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_to_const_type
-					resolved_network_time_span = *resolved_network_time_spans_iter;
-
-			boost::optional<const TopologyReconstruct::rtn_seq_type &> rtns =
-					resolved_network_time_span->get_sample_in_time_slot(time_slot);
-			if (rtns)
-			{
-				rtns_in_time_slot.insert(rtns_in_time_slot.end(), rtns->begin(), rtns->end());
-			}
-		}
-
-		if (!rtns_in_time_slot.empty())
-		{
-			combined_resolved_network_time_span->set_sample_in_time_slot(rtns_in_time_slot, time_slot);
-		}
-	}
+	// Create our resolved network time span that combines resolved networks from
+	// *all* topological network layers.
+	//
+	// Each time slot is only filled in when first accessed (when reconstructing geometries using topologies).
+	// This in turn resolves the networks of that time slot in each topological network layer (if not already).
+	//
+	// Our time slots only reference the networks resolved by each topological network layer, so we
+	// bound the number resident in the same way. Releasing a time slot here never creates duplicate
+	// networks when it's accessed again, because a network layer does not release (and re-resolve)
+	// networks that are still referenced (such as by the topology point locations of reconstructed geometries).
+	TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_type combined_resolved_network_time_span =
+			TopologyReconstruct::resolved_network_time_span_type::create(
+					time_range,
+					boost::bind(
+							&combine_resolved_networks_in_time_slot,
+							resolved_network_time_spans,
+							boost::placeholders::_1,
+							boost::placeholders::_2),
+					TopologyNetworkResolverLayerProxy::MAX_NUM_RESIDENT_RESOLVED_NETWORK_TIME_SLOTS);
 
 	// Create our resolved boundary time span that combines resolved boundaries from
 	// *all* topological boundary layers.
@@ -1168,6 +1379,43 @@ GPlatesAppLogic::ReconstructLayerProxy::modified_reconstructable_feature_collect
 }
 
 
+void
+GPlatesAppLogic::ReconstructLayerProxy::modified_reconstructable_features(
+		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &modified_features)
+{
+	// Notify the reconstruct context of the modified features only.
+	// This avoids re-determining the reconstruct methods of the unmodified features.
+	if (d_reconstruct_context.update_features(modified_features, d_current_reconstructable_features))
+	{
+		// The cached reconstructions of the unmodified features are still valid so we only need
+		// to reconstruct the modified features in each cached reconstruction info.
+		// This is deferred until each cached reconstruction info is next requested.
+		d_cached_reconstructions.visit_values(
+				boost::bind(
+						&ReconstructLayerProxy::add_pending_modified_features,
+						this,
+						boost::placeholders::_1,
+						boost::placeholders::_2,
+						boost::cref(modified_features)));
+	}
+	else
+	{
+		// The geometry property handles were re-assigned so the cached reconstruction info is now invalid.
+		reset_reconstruction_cache();
+	}
+
+	// Polling observers need to update themselves.
+	d_subject_token.invalidate();
+
+	// Anything dependent on the reconstructable feature collections is now invalid.
+	reset_reconstructable_feature_collection_caches();
+
+	// Polling observers need to update themselves if they depend on present day geometries, for example.
+	d_reconstructable_feature_collections_subject_token.invalidate();
+}
+
+
 bool
 GPlatesAppLogic::ReconstructLayerProxy::using_topologies_to_reconstruct() const
 {
@@ -1272,6 +1520,49 @@ GPlatesAppLogic::ReconstructLayerProxy::cache_reconstructed_features(
 }
 
 
+const GPlatesAppLogic::TopologicalSectionIndex &
+GPlatesAppLogic::ReconstructLayerProxy::cache_topological_section_index(
+		ReconstructionInfo &reconstruction_info)
+{
+	// If it's already cached then nothing to do.
+	if (reconstruction_info.cached_topological_section_index)
+	{
+		return reconstruction_info.cached_topological_section_index.get();
+	}
+
+	reconstruction_info.cached_topological_section_index = TopologicalSectionIndex();
+	TopologicalSectionIndex &topological_section_index = reconstruction_info.cached_topological_section_index.get();
+
+	// Index the cached RFGs, or the RFGs in the cached 'ReconstructContext::ReconstructedFeature's.
+	if (reconstruction_info.cached_reconstructed_feature_geometries)
+	{
+		topological_section_index.add(
+				reconstruction_info.cached_reconstructed_feature_geometries->begin(),
+				reconstruction_info.cached_reconstructed_feature_geometries->end());
+	}
+	else
+	{
+		GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+				reconstruction_info.cached_reconstructed_features,
+				GPLATES_ASSERTION_SOURCE);
+
+		BOOST_FOREACH(
+				const ReconstructContext::ReconstructedFeature &reconstructed_feature,
+				reconstruction_info.cached_reconstructed_features.get())
+		{
+			const ReconstructContext::ReconstructedFeature::reconstruction_seq_type &reconstructions =
+					reconstructed_feature.get_reconstructions();
+			BOOST_FOREACH(const ReconstructContext::Reconstruction &reconstruction, reconstructions)
+			{
+				topological_section_index.add(reconstruction.get_reconstructed_feature_geometry());
+			}
+		}
+	}
+
+	return topological_section_index;
+}
+
+
 GPlatesAppLogic::ReconstructLayerProxy::reconstructions_spatial_partition_type::non_null_ptr_to_const_type
 GPlatesAppLogic::ReconstructLayerProxy::cache_reconstructions_spatial_partition(
 		ReconstructionInfo &reconstruction_info,
@@ -1300,44 +1591,9 @@ GPlatesAppLogic::ReconstructLayerProxy::cache_reconstructions_spatial_partition(
 				reconstructed_feature.get_reconstructions();
 		BOOST_FOREACH(const ReconstructContext::Reconstruction &reconstruction, reconstructions)
 		{
-			// NOTE: To avoid reconstructing geometries when it might not be needed we add the
-			// *unreconstructed* geometry (and a finite rotation) to the spatial partition.
-			// The spatial partition will rotate only the centroid of the *unreconstructed*
-			// geometry (instead of reconstructing the entire geometry) and then use that as the
-			// insertion location (along with the *unreconstructed* geometry's bounding circle extents).
-			// An example where transforming might not be needed is data mining co-registration
-			// where might not need to transform all geometries to determine if seed and target
-			// features are close enough within a region of interest.
-
-			const ReconstructedFeatureGeometry::non_null_ptr_type &rfg =
-					reconstruction.get_reconstructed_feature_geometry();
-
-			// See if the reconstruction can be represented as a finite rotation.
-			const boost::optional<ReconstructedFeatureGeometry::FiniteRotationReconstruction> &
-					finite_rotation_reconstruction = rfg->finite_rotation_reconstruction();
-			if (finite_rotation_reconstruction)
-			{
-				// The resolved geometry is the *unreconstructed* geometry (but still possibly
-				// the result of a look up of a time-dependent geometry property).
-				const GPlatesMaths::GeometryOnSphere &resolved_geometry =
-						*finite_rotation_reconstruction->get_resolved_geometry();
-				const GPlatesMaths::FiniteRotation &finite_rotation =
-						finite_rotation_reconstruction->get_reconstruct_method_finite_rotation()
-								->get_finite_rotation();
-
-				reconstruction_info.cached_reconstructions_spatial_partition.get()->add(
-						reconstruction, resolved_geometry, finite_rotation);
-			}
-			else
-			{
-				// It's not a finite rotation so we can't assume the geometry has rigidly rotated.
-				// Hence we can't assume its shape is the same and hence can't assume the
-				// small circle bounding radius is the same.
-				// So just get the reconstructed geometry and insert it into the spatial partition.
-				// The appropriate bounding small circle will be generated for it when it's added.
-				reconstruction_info.cached_reconstructions_spatial_partition.get()->add(
-						reconstruction, *rfg->reconstructed_geometry());
-			}
+			add_reconstruction_to_spatial_partition(
+					*reconstruction_info.cached_reconstructions_spatial_partition.get(),
+					reconstruction);
 		}
 	}
 
@@ -1375,6 +1631,179 @@ GPlatesAppLogic::ReconstructLayerProxy::cache_reconstructed_feature_velocities(
 }
 
 
+GPlatesAppLogic::ReconstructLayerProxy::ReconstructionInfo &
+GPlatesAppLogic::ReconstructLayerProxy::get_reconstruction_info(
+		const reconstruction_cache_key_type &reconstruction_cache_key)
+{
+	ReconstructionInfo &reconstruction_info = d_cached_reconstructions.get_value(reconstruction_cache_key);
+
+	// Reconstruct any features modified since the reconstruction info was last requested.
+	if (!reconstruction_info.pending_modified_features.empty())
+	{
+		update_reconstruction_info(reconstruction_cache_key, reconstruction_info);
+	}
+
+	return reconstruction_info;
+}
+
+
+void
+GPlatesAppLogic::ReconstructLayerProxy::add_pending_modified_features(
+		const reconstruction_cache_key_type &reconstruction_cache_key,
+		ReconstructionInfo &reconstruction_info,
+		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &modified_features)
+{
+	// Nothing to update if nothing has been reconstructed yet.
+	if (!reconstruction_info.cached_reconstructed_features &&
+		!reconstruction_info.cached_reconstructed_feature_velocities)
+	{
+		return;
+	}
+
+	BOOST_FOREACH(const GPlatesModel::FeatureHandle::weak_ref &modified_feature_ref, modified_features)
+	{
+		reconstruction_info.pending_modified_features[modified_feature_ref.handle_ptr()] = modified_feature_ref;
+	}
+}
+
+
+void
+GPlatesAppLogic::ReconstructLayerProxy::update_reconstruction_info(
+		const reconstruction_cache_key_type &reconstruction_cache_key,
+		ReconstructionInfo &reconstruction_info)
+{
+	const double reconstruction_time = reconstruction_cache_key.first.dval();
+
+	std::vector<GPlatesModel::FeatureHandle::weak_ref> modified_features;
+	std::set<const GPlatesModel::FeatureHandle *> modified_feature_handles;
+	BOOST_FOREACH(
+			const ReconstructionInfo::pending_modified_features_type::value_type &pending_modified_feature,
+			reconstruction_info.pending_modified_features)
+	{
+		modified_feature_handles.insert(pending_modified_feature.first);
+		modified_features.push_back(pending_modified_feature.second);
+	}
+	reconstruction_info.pending_modified_features.clear();
+
+	if (reconstruction_info.cached_reconstructed_features)
+	{
+		// The spliced reconstructions get a new reconstruct handle (rather than the handle of the
+		// cached reconstructions) so that clients searching for reconstructions by handle don't
+		// find the outdated reconstructions of the modified features (which keep the old handle).
+		const ReconstructHandle::type reconstruct_handle = ReconstructHandle::get_next_reconstruct_handle();
+
+		// Reconstruct only the modified features.
+		std::vector<ReconstructContext::ReconstructedFeature> modified_reconstructed_features;
+		d_reconstruct_context.get_reconstructed_features(
+				modified_reconstructed_features,
+				modified_features,
+				reconstruction_info.context_state,
+				reconstruction_time,
+				reconstruct_handle);
+
+		splice_modified_features(
+				reconstruction_info.cached_reconstructed_features.get(),
+				modified_reconstructed_features,
+				modified_feature_handles);
+
+		// The retained reconstructions of the unmodified features are copied under the new handle
+		// (the originals are left unchanged since clients can still be referencing them).
+		rfg_copy_map_type rfg_copies;
+		copy_with_reconstruct_handle(
+				reconstruction_info.cached_reconstructed_features.get(),
+				reconstruct_handle,
+				rfg_copies);
+		reconstruction_info.cached_reconstructed_feature_geometries_handle = reconstruct_handle;
+
+		// The spatial partitions don't support removing elements, and the partition could still be
+		// referenced by clients anyway, so splice into a new partition instead. The retained
+		// reconstructions are added at their existing locations which, unlike adding the modified
+		// reconstructions, doesn't require bounding their geometries.
+		if (reconstruction_info.cached_reconstructions_spatial_partition)
+		{
+			const reconstructions_spatial_partition_type::non_null_ptr_type reconstructions_spatial_partition =
+					reconstructions_spatial_partition_type::create(DEFAULT_SPATIAL_PARTITION_DEPTH);
+
+			reconstructions_spatial_partition_type::const_iterator cached_reconstructions_iter =
+					reconstruction_info.cached_reconstructions_spatial_partition.get()->get_iterator();
+			for ( ; !cached_reconstructions_iter.finished(); cached_reconstructions_iter.next())
+			{
+				const ReconstructContext::Reconstruction &cached_reconstruction =
+						cached_reconstructions_iter.get_element();
+				if (modified_feature_handles.find(
+						cached_reconstruction.get_reconstructed_feature_geometry()->feature_handle_ptr()) ==
+					modified_feature_handles.end())
+				{
+					// Add the copy of the retained RFG (that has the new reconstruct handle).
+					rfg_copy_map_type::const_iterator rfg_copy_iter =
+							rfg_copies.find(cached_reconstruction.get_reconstructed_feature_geometry().get());
+					GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+							rfg_copy_iter != rfg_copies.end(),
+							GPLATES_ASSERTION_SOURCE);
+
+					reconstructions_spatial_partition->add(
+							ReconstructContext::Reconstruction(
+									cached_reconstruction.get_geometry_property_handle(),
+									rfg_copy_iter->second),
+							cached_reconstructions_iter.get_location());
+				}
+			}
+
+			BOOST_FOREACH(
+					const ReconstructContext::ReconstructedFeature &modified_reconstructed_feature,
+					modified_reconstructed_features)
+			{
+				const ReconstructContext::ReconstructedFeature::reconstruction_seq_type &reconstructions =
+						modified_reconstructed_feature.get_reconstructions();
+				BOOST_FOREACH(const ReconstructContext::Reconstruction &reconstruction, reconstructions)
+				{
+					add_reconstruction_to_spatial_partition(*reconstructions_spatial_partition, reconstruction);
+				}
+			}
+
+			reconstruction_info.cached_reconstructions_spatial_partition = reconstructions_spatial_partition;
+		}
+
+		// The other cached formats are generated from the cached reconstructed features (or the
+		// reconstructions spatial partition) when next requested, which just involves copying.
+		reconstruction_info.cached_reconstructed_feature_geometries = boost::none;
+		reconstruction_info.cached_reconstructions = boost::none;
+		reconstruction_info.cached_reconstructed_feature_geometries_spatial_partition = boost::none;
+		reconstruction_info.cached_topological_section_index = boost::none;
+	}
+
+	if (reconstruction_info.cached_reconstructed_feature_velocities)
+	{
+		// The velocity delta time parameters are always cached along with the velocities.
+		GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+				reconstruction_info.cached_velocity_delta_time_params,
+				GPLATES_ASSERTION_SOURCE);
+
+		// As with the reconstructions, the spliced velocities get a new reconstruct handle.
+		const ReconstructHandle::type reconstruct_handle = ReconstructHandle::get_next_reconstruct_handle();
+
+		// Calculate velocities for only the modified features.
+		std::vector<MultiPointVectorField::non_null_ptr_type> modified_reconstructed_feature_velocities;
+		d_reconstruct_context.reconstruct_feature_velocities(
+				modified_reconstructed_feature_velocities,
+				modified_features,
+				reconstruction_info.context_state,
+				reconstruction_time,
+				reconstruct_handle,
+				reconstruction_info.cached_velocity_delta_time_params->second.dval(),
+				reconstruction_info.cached_velocity_delta_time_params->first);
+
+		splice_modified_features(
+				reconstruction_info.cached_reconstructed_feature_velocities.get(),
+				modified_reconstructed_feature_velocities,
+				modified_feature_handles);
+
+		copy_with_reconstruct_handle(reconstruction_info.cached_reconstructed_feature_velocities.get(), reconstruct_handle);
+		reconstruction_info.cached_reconstructed_feature_velocities_handle = reconstruct_handle;
+	}
+}
+
+
 GPlatesAppLogic::ReconstructLayerProxy::ReconstructionInfo
 GPlatesAppLogic::ReconstructLayerProxy::create_reconstruction_info(
 		const reconstruction_cache_key_type &reconstruction_cache_key)
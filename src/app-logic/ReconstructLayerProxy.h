@@ -40,6 +40,7 @@
 #include "ReconstructionLayerProxy.h"
 #include "ReconstructMethodInterface.h"
 #include "TimeSpanUtils.h"
+#include "TopologicalSectionIndex.h"
 #include "VelocityDeltaTime.h"
 
 #include "global/PointerTraits.h"
@@ -915,6 +916,19 @@ namespace GPlatesAppLogic
 		modified_reconstructable_feature_collection(
 				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection);
 
+		/**
+		 * Some features in a reconstructable feature collection were modified
+		 * (but no features were added to, or removed from, the feature collection).
+		 *
+		 * Only the modified features are reconstructed again (the cached reconstructions of the
+		 * unmodified features are retained where possible). This is deferred until the cached
+		 * reconstructions are next requested.
+		 */
+		void
+		modified_reconstructable_features(
+				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &modified_features);
+
 		/**
 		 * Returns true if we are reconstructing geometries using topologies.
 		 *
@@ -932,6 +946,10 @@ namespace GPlatesAppLogic
 		 */
 		struct ReconstructionInfo
 		{
+			//! Typedef for modified features keyed by their feature handle.
+			typedef std::map<const GPlatesModel::FeatureHandle *, GPlatesModel::FeatureHandle::weak_ref>
+					pending_modified_features_type;
+
 			explicit
 			ReconstructionInfo(
 					const ReconstructContext::context_state_reference_type &context_state_) :
@@ -987,6 +1005,14 @@ namespace GPlatesAppLogic
 			boost::optional<reconstructions_spatial_partition_type::non_null_ptr_type>
 					cached_reconstructions_spatial_partition;
 
+			/**
+			 * The cached reconstructed feature geometries indexed by feature ID.
+			 *
+			 * This is built on demand when topology layers request topological sections so that
+			 * each request only visits the referenced features (instead of all cached RFGs).
+			 */
+			boost::optional<TopologicalSectionIndex> cached_topological_section_index;
+
 			//
 			// Velocities.
 			//
@@ -1008,6 +1034,14 @@ namespace GPlatesAppLogic
 			 */
 			boost::optional< std::vector<MultiPointVectorField::non_null_ptr_type> >
 					cached_reconstructed_feature_velocities;
+
+			/**
+			 * Features modified since our cached reconstructions (and velocities) were generated.
+			 *
+			 * These are only re-reconstructed when this reconstruction info is next requested
+			 * (so that reconstruction infos that are never requested again don't get updated).
+			 */
+			pending_modified_features_type pending_modified_features;
 		};
 
 		//! Typedef for the key type to the reconstruction cache (reconstruction time and reconstruct params).
@@ -1287,6 +1321,16 @@ namespace GPlatesAppLogic
 				const double &reconstruction_time);
 
 
+		/**
+		 * Indexes the cached RFGs by feature ID if not already indexed.
+		 *
+		 * Either the cached RFGs or the cached reconstructed features must already exist.
+		 */
+		const TopologicalSectionIndex &
+		cache_topological_section_index(
+				ReconstructionInfo &reconstruction_info);
+
+
 		/**
 		 * Generates a reconstructions spatial partition for the specified reconstruct params and
 		 * reconstruction time if it's not already cached.
@@ -1307,6 +1351,37 @@ namespace GPlatesAppLogic
 				VelocityDeltaTime::Type velocity_delta_time_type,
 				const double &velocity_delta_time);
 
+		/**
+		 * Returns the cached reconstruction info associated with the specified key (creating it if
+		 * it's not cached), after updating it with any features modified since it was last requested.
+		 */
+		ReconstructionInfo &
+		get_reconstruction_info(
+				const reconstruction_cache_key_type &reconstruction_cache_key);
+
+		/**
+		 * Records the modified features in the specified reconstruction info so they can be
+		 * re-reconstructed when it's next requested (see @a get_reconstruction_info).
+		 */
+		void
+		add_pending_modified_features(
+				const reconstruction_cache_key_type &reconstruction_cache_key,
+				ReconstructionInfo &reconstruction_info,
+				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &modified_features);
+
+		/**
+		 * Updates the cached reconstructions (and velocities) of the specified reconstruction info
+		 * with its pending modified features.
+		 *
+		 * Only the modified features are reconstructed - the cached reconstructions of the
+		 * unmodified features are retained (but are copied under a new reconstruct handle, shared with
+		 * the re-reconstructed features, so that the outdated reconstructions are not identified by it).
+		 */
+		void
+		update_reconstruction_info(
+				const reconstruction_cache_key_type &reconstruction_cache_key,
+				ReconstructionInfo &reconstruction_info);
+
 
 		/**
 		 * Utility method used by @a reconstruction_cache_type when it needs a new @a ReconstructionInfo
@@ -170,6 +170,21 @@ GPlatesAppLogic::ReconstructLayerTask::modified_input_file(
 }
 
 
+void
+GPlatesAppLogic::ReconstructLayerTask::modified_input_features(
+		LayerInputChannelName::Type input_channel_name,
+		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &modified_features)
+{
+	if (input_channel_name == LayerInputChannelName::RECONSTRUCTABLE_FEATURES)
+	{
+		// Let the reconstruct layer proxy know that some features in one of the reconstructable
+		// feature collections have been modified.
+		d_reconstruct_layer_proxy->modified_reconstructable_features(feature_collection, modified_features);
+	}
+}
+
+
 void
 GPlatesAppLogic::ReconstructLayerTask::add_input_layer_proxy_connection(
 		LayerInputChannelName::Type input_channel_name,
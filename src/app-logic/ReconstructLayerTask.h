@@ -113,6 +113,13 @@ namespace GPlatesAppLogic
 				LayerInputChannelName::Type input_channel_name,
 				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection);
 
+		virtual
+		void
+		modified_input_features(
+				LayerInputChannelName::Type input_channel_name,
+				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &modified_features);
+
 
 		virtual
 		void
@@ -35,6 +35,8 @@
 #include "ReconstructUtils.h"
 #include "TopologyReconstructedFeatureGeometry.h"
 
+#include "file-io/GpmlBinaryFeatureIndex.h"
+
 #include "global/AssertionFailureException.h"
 #include "global/GPlatesAssert.h"
 #include "global/PreconditionViolationError.h"
@@ -65,6 +67,30 @@ namespace GPlatesAppLogic
 {
 	namespace
 	{
+		/**
+		 * Returns false if the index entry of @a feature_ref (see GPlatesFileIO::GpmlBinaryFeatureIndex)
+		 * shows that the feature is not valid at @a reconstruction_time.
+		 *
+		 * This avoids visiting (and, for lazily loaded features, decoding) the feature's properties.
+		 */
+		bool
+		could_be_valid_at_recon_time(
+				const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
+				const double &reconstruction_time)
+		{
+			if (!feature_ref.is_valid())
+			{
+				return true;
+			}
+
+			boost::optional<const GPlatesFileIO::GpmlBinaryFeatureIndex::Entry &> feature_index_entry =
+					GPlatesFileIO::GpmlBinaryFeatureIndex::get_entry(*feature_ref);
+
+			return !feature_index_entry ||
+					feature_index_entry->is_valid_at_recon_time(reconstruction_time);
+		}
+
+
 		/**
 		 * The transform used to reconstruct by plate id.
 		 */
@@ -380,6 +406,14 @@ GPlatesAppLogic::ReconstructMethodByPlateId::reconstruct_feature_geometries(
 		const Context &context,
 		const double &reconstruction_time)
 {
+	// If the feature is indexed as not valid at the reconstruction time then skip it without
+	// looking at its properties (unless we've been requested to reconstruct for all times).
+	if (!context.reconstruct_params.get_reconstruct_by_plate_id_outside_active_time_period() &&
+		!could_be_valid_at_recon_time(get_feature_ref(), reconstruction_time))
+	{
+		return;
+	}
+
 	boost::optional<const topology_reconstructed_geometry_time_span_sequence_type &>
 			topology_reconstructed_geometry_time_spans = get_topology_reconstruction_info(context);
 	if (topology_reconstructed_geometry_time_spans)
@@ -32,6 +32,8 @@
 #include "ReconstructionFeatureProperties.h"
 
 #include "maths/CalculateVelocity.h"
+#include "maths/FiniteRotation.h"
+#include "maths/Vector3D.h"
 
 #include "model/types.h"
 
@@ -70,6 +72,18 @@ GPlatesAppLogic::ReconstructMethodInterface::reconstruct_feature_velocities_by_p
 	const GPlatesMaths::FiniteRotation finite_rotation =
 			reconstruction_tree->get_composed_absolute_rotation(reconstruction_plate_id);
 
+	// All the feature's geometries are on the same plate so they share the same stage rotation.
+	// So only calculate it once (rather than for every domain point).
+	const GPlatesMaths::FiniteRotation stage_rotation =
+			PlateVelocityUtils::calculate_stage_rotation(
+					reconstruction_plate_id,
+					context.reconstruction_tree_creator,
+					reconstruction_time,
+					velocity_delta_time,
+					velocity_delta_time_type);
+	const GPlatesMaths::Vector3D velocity_angular_vector =
+			GPlatesMaths::calculate_velocity_angular_vector(stage_rotation, velocity_delta_time);
+
 	// Iterate over the feature's present day geometries and rotate each one.
 	std::vector<Geometry> present_day_geometries;
 	get_present_day_feature_geometries(present_day_geometries);
@@ -122,13 +136,7 @@ GPlatesAppLogic::ReconstructMethodInterface::reconstruct_feature_velocities_by_p
 		{
 			// Calculate the velocity.
 			const GPlatesMaths::Vector3D vector_xyz =
-					PlateVelocityUtils::calculate_velocity_vector(
-							*domain_iter,
-							reconstruction_plate_id,
-							context.reconstruction_tree_creator,
-							reconstruction_time,
-							velocity_delta_time,
-							velocity_delta_time_type);
+					GPlatesMaths::calculate_velocity_vector(*domain_iter, velocity_angular_vector);
 
 			*field_iter = MultiPointVectorField::CodomainElement(
 					vector_xyz,
@@ -108,6 +108,23 @@ GPlatesAppLogic::ReconstructedFeatureGeometry::ReconstructedFeatureGeometry(
 }
 
 
+GPlatesAppLogic::ReconstructedFeatureGeometry::ReconstructedFeatureGeometry(
+		const ReconstructedFeatureGeometry &other,
+		boost::optional<ReconstructHandle::type> reconstruct_handle_) :
+	ReconstructionGeometry(other, reconstruct_handle_),
+	WeakObserverType(other),
+	d_reconstruction_tree(other.d_reconstruction_tree),
+	d_reconstruction_tree_creator(other.d_reconstruction_tree_creator),
+	d_property_iterator(other.d_property_iterator),
+	d_reconstructed_geometry(other.d_reconstructed_geometry),
+	d_finite_rotation_reconstruction(other.d_finite_rotation_reconstruction),
+	d_reconstruct_method_type(other.d_reconstruct_method_type),
+	d_reconstruction_plate_id(other.d_reconstruction_plate_id),
+	d_time_of_formation(other.d_time_of_formation)
+{
+}
+
+
 const GPlatesModel::FeatureHandle::weak_ref
 GPlatesAppLogic::ReconstructedFeatureGeometry::get_feature_ref() const
 {
@@ -215,6 +215,23 @@ namespace GPlatesAppLogic
 		}
 
 
+
+		/**
+		 * Create a copy of this reconstructed feature geometry that has the specified reconstruct handle.
+		 *
+		 * This is used when the cached reconstruction geometries of unmodified features are retained
+		 * under a new reconstruct handle (this instance is not changed since clients can share it).
+		 *
+		 * Derived classes override this to also copy their own state.
+		 */
+		virtual
+		const non_null_ptr_type
+		clone_with_reconstruct_handle(
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) const
+		{
+			return non_null_ptr_type(new ReconstructedFeatureGeometry(*this, reconstruct_handle_));
+		}
+
 		virtual
 		~ReconstructedFeatureGeometry()
 		{  }
@@ -446,6 +463,13 @@ namespace GPlatesAppLogic
 				boost::optional<GPlatesPropertyValues::GeoTimeInstant> time_of_formation_ = boost::none,
 				boost::optional<ReconstructHandle::type> reconstruct_handle_ = boost::none);
 
+		/**
+		 * Copy @a other but with a different reconstruct handle (see @a clone_with_reconstruct_handle).
+		 */
+		ReconstructedFeatureGeometry(
+				const ReconstructedFeatureGeometry &other,
+				boost::optional<ReconstructHandle::type> reconstruct_handle_);
+
 	private:
 
 		/**
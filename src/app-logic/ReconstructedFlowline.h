@@ -115,6 +115,20 @@ namespace GPlatesAppLogic
 		}
 
 
+		/**
+		 * Create a copy of this @a ReconstructedFlowline that has the specified reconstruct handle.
+		 *
+		 * This overrides the base class @a ReconstructedFeatureGeometry method.
+		 */
+		virtual
+		const ReconstructedFeatureGeometry::non_null_ptr_type
+		clone_with_reconstruct_handle(
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) const
+		{
+			return ReconstructedFeatureGeometry::non_null_ptr_type(new ReconstructedFlowline(*this, reconstruct_handle_));
+		}
+
+
 		/**
 		 * Accept a ConstReconstructionGeometryVisitor instance.
 		 */
@@ -216,6 +230,18 @@ namespace GPlatesAppLogic
 			d_right_plate_id(right_plate_id_)
 		{  }
 
+		ReconstructedFlowline(
+				const ReconstructedFlowline &other,
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) :
+			ReconstructedFeatureGeometry(other, reconstruct_handle_),
+			d_present_day_seed_point(other.d_present_day_seed_point),
+			d_reconstructed_seed_point(other.d_reconstructed_seed_point),
+			d_left_flowline_points(other.d_left_flowline_points),
+			d_right_flowline_points(other.d_right_flowline_points),
+			d_left_plate_id(other.d_left_plate_id),
+			d_right_plate_id(other.d_right_plate_id)
+		{  }
+
 		seed_point_type d_present_day_seed_point;
 		seed_point_type d_reconstructed_seed_point;
 		GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type d_left_flowline_points;
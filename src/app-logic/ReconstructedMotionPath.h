@@ -117,6 +117,19 @@ namespace GPlatesAppLogic
 							reconstructed_geometry_));
 		}
 
+		/**
+		 * Create a copy of this @a ReconstructedMotionPath that has the specified reconstruct handle.
+		 *
+		 * This overrides the base class @a ReconstructedFeatureGeometry method.
+		 */
+		virtual
+		const ReconstructedFeatureGeometry::non_null_ptr_type
+		clone_with_reconstruct_handle(
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) const
+		{
+			return ReconstructedFeatureGeometry::non_null_ptr_type(new ReconstructedMotionPath(*this, reconstruct_handle_));
+		}
+
 		/**
 		 * Accept a ConstReconstructionGeometryVisitor instance.
 		 */
@@ -194,6 +207,15 @@ namespace GPlatesAppLogic
 			d_motion_path_points(motion_path_points_)
 		{  }
 
+		ReconstructedMotionPath(
+				const ReconstructedMotionPath &other,
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) :
+			ReconstructedFeatureGeometry(other, reconstruct_handle_),
+			d_present_day_seed_point(other.d_present_day_seed_point),
+			d_reconstructed_seed_point(other.d_reconstructed_seed_point),
+			d_motion_path_points(other.d_motion_path_points)
+		{  }
+
 		GPlatesMaths::PointOnSphere d_present_day_seed_point;
 		GPlatesMaths::PointOnSphere d_reconstructed_seed_point;
 		GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type d_motion_path_points;
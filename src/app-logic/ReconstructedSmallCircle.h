@@ -92,6 +92,20 @@ namespace GPlatesAppLogic
 		}
 
 
+		/**
+		 * Create a copy of this @a ReconstructedSmallCircle that has the specified reconstruct handle.
+		 *
+		 * This overrides the base class @a ReconstructedFeatureGeometry method.
+		 */
+		virtual
+		const ReconstructedFeatureGeometry::non_null_ptr_type
+		clone_with_reconstruct_handle(
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) const
+		{
+			return ReconstructedFeatureGeometry::non_null_ptr_type(new ReconstructedSmallCircle(*this, reconstruct_handle_));
+		}
+
+
 		/**
 		 * Accept a ConstReconstructionGeometryVisitor instance.
 		 */
@@ -156,6 +170,14 @@ namespace GPlatesAppLogic
             d_radius(radius_)
 		{  }
 
+		ReconstructedSmallCircle(
+				const ReconstructedSmallCircle &other,
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) :
+			ReconstructedFeatureGeometry(other, reconstruct_handle_),
+			d_centre(other.d_centre),
+			d_radius(other.d_radius)
+		{  }
+
 		small_circle_centre_type d_centre;
 		double d_radius;
 
@@ -119,6 +119,20 @@ namespace GPlatesAppLogic
 		}
 
 
+		/**
+		 * Create a copy of this @a ReconstructedVirtualGeomagneticPole that has the specified reconstruct handle.
+		 *
+		 * This overrides the base class @a ReconstructedFeatureGeometry method.
+		 */
+		virtual
+		const ReconstructedFeatureGeometry::non_null_ptr_type
+		clone_with_reconstruct_handle(
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) const
+		{
+			return ReconstructedFeatureGeometry::non_null_ptr_type(new ReconstructedVirtualGeomagneticPole(*this, reconstruct_handle_));
+		}
+
+
 		/**
 		 * Accept a ConstReconstructionGeometryVisitor instance.
 		 */
@@ -181,6 +195,13 @@ namespace GPlatesAppLogic
 			d_VGP_params(params)
 		{  }
 
+		ReconstructedVirtualGeomagneticPole(
+				const ReconstructedVirtualGeomagneticPole &other,
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) :
+			ReconstructedFeatureGeometry(other, reconstruct_handle_),
+			d_VGP_params(other.d_VGP_params)
+		{  }
+
 		ReconstructedVirtualGeomagneticPoleParams d_VGP_params;
 	};
 }
@@ -53,6 +53,37 @@ GPlatesAppLogic::ReconstructionFeatureProperties::initialise_pre_feature_propert
 }
 
 
+bool
+GPlatesAppLogic::ReconstructionFeatureProperties::initialise_pre_property_values(
+		const GPlatesModel::TopLevelPropertyInline &top_level_property_inline)
+{
+	static const GPlatesModel::PropertyName geometry_import_time_property_name =
+			GPlatesModel::PropertyName::create_gpml("geometryImportTime");
+	static const GPlatesModel::PropertyName valid_time_property_name =
+			GPlatesModel::PropertyName::create_gml("validTime");
+	static const GPlatesModel::PropertyName reconstruction_plate_id_property_name =
+			GPlatesModel::PropertyName::create_gpml("reconstructionPlateId");
+	static const GPlatesModel::PropertyName right_plate_id_property_name =
+			GPlatesModel::PropertyName::create_gpml("rightPlate");
+	static const GPlatesModel::PropertyName left_plate_id_property_name =
+			GPlatesModel::PropertyName::create_gpml("leftPlate");
+	static const GPlatesModel::PropertyName spreading_asymmetry_property_name =
+			GPlatesModel::PropertyName::create_gpml("spreadingAsymmetry");
+	static const GPlatesModel::PropertyName reconstruction_method_name =
+			GPlatesModel::PropertyName::create_gpml("reconstructionMethod");
+
+	// Only visit the properties that we're interested in.
+	const GPlatesModel::PropertyName &property_name = top_level_property_inline.property_name();
+	return property_name == geometry_import_time_property_name ||
+			property_name == valid_time_property_name ||
+			property_name == reconstruction_plate_id_property_name ||
+			property_name == right_plate_id_property_name ||
+			property_name == left_plate_id_property_name ||
+			property_name == spreading_asymmetry_property_name ||
+			property_name == reconstruction_method_name;
+}
+
+
 void
 GPlatesAppLogic::ReconstructionFeatureProperties::visit_gml_time_instant(
 		const GPlatesPropertyValues::GmlTimeInstant &gml_time_instant)
@@ -211,6 +211,16 @@ namespace GPlatesAppLogic
 		initialise_pre_feature_properties(
 				const GPlatesModel::FeatureHandle &feature_handle);
 
+		/**
+		 * Skips properties that are not reconstruction parameters.
+		 *
+		 * This avoids visiting (and, for lazily loaded features, decoding) property values such as geometries.
+		 */
+		virtual
+		bool
+		initialise_pre_property_values(
+				const GPlatesModel::TopLevelPropertyInline &top_level_property_inline);
+
 	private:
 
 		boost::optional<GPlatesModel::integer_plate_id_type> d_recon_plate_id;
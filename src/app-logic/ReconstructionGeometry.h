@@ -142,6 +142,19 @@ namespace GPlatesAppLogic
 			d_reconstruct_handle(reconstruct_handle_)
 		{  }
 
+		/**
+		 * Construct a copy of @a other but with a different reconstruct handle.
+		 *
+		 * Used by derived classes to create copies of themselves that are identified by a
+		 * different reconstruct handle (the original is left unchanged since it can be shared).
+		 */
+		ReconstructionGeometry(
+				const ReconstructionGeometry &other,
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) :
+			d_reconstruction_time(other.d_reconstruction_time),
+			d_reconstruct_handle(reconstruct_handle_)
+		{  }
+
 	private:
 
 		/**
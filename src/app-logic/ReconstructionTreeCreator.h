@@ -117,6 +117,35 @@ namespace GPlatesAppLogic
 		GPlatesModel::integer_plate_id_type
 		get_default_anchor_plate_id() const;
 
+
+		/**
+		 * Two reconstruction tree creators are equal if they share the same implementation
+		 * (and hence create the same reconstruction trees).
+		 */
+		bool
+		operator==(
+				const ReconstructionTreeCreator &other) const
+		{
+			return d_impl.get() == other.d_impl.get();
+		}
+
+		bool
+		operator!=(
+				const ReconstructionTreeCreator &other) const
+		{
+			return !(*this == other);
+		}
+
+		/**
+		 * Less-than comparison (of implementations) so creators can be used as keys in sorted containers.
+		 */
+		bool
+		operator<(
+				const ReconstructionTreeCreator &other) const
+		{
+			return d_impl.get() < other.d_impl.get();
+		}
+
 	private:
 		GPlatesUtils::non_null_intrusive_ptr<ReconstructionTreeCreatorImpl> d_impl;
 	};
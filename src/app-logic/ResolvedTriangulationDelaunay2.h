@@ -268,6 +268,9 @@ namespace GPlatesAppLogic
 						point_on_sphere,
 						lat_lon_point,
 						shared_source_info);
+
+				// Any derived information is now out-of-date.
+				d_deformation_info = boost::none;
 			}
 
 			//! Returns index of this vertex within all vertices in the delaunay triangulation.
@@ -564,6 +567,21 @@ namespace GPlatesAppLogic
 				return d_delaunay_2.get();
 			}
 
+			/**
+			 * Discard all cached information for this face (including reference to Delaunay triangulation).
+			 *
+			 * This is needed when a face is copied from another Delaunay triangulation, or when
+			 * its vertices have moved, since the face vertex check cannot detect either case.
+			 */
+			void
+			reset_cached_info()
+			{
+				d_check_face_vertices = CheckFaceVertices();
+				d_delaunay_2 = boost::none;
+				d_is_in_deforming_region = boost::none;
+				d_deformation_info = boost::none;
+			}
+
 		private:
 
 			/**
@@ -164,6 +164,148 @@ namespace GPlatesAppLogic
 	};
 
 
+	/**
+	 * Creates @a delaunay_2 by copying @a cached_delaunay_2 and moving its vertices to the
+	 * (unsorted) projected delaunay points @a delaunay_point_2_seq.
+	 *
+	 * @a cached_delaunay_point_vertex_indices maps the delaunay points of the cached triangulation
+	 * to its vertex indices - we assume our delaunay points correspond to those (in the same order).
+	 * Moving a vertex only flips the edges around it (or, if it moves too far, removes and re-inserts it)
+	 * so the result is the delaunay triangulation of our points regardless.
+	 *
+	 * Returns false if the delaunay points don't correspond (in which case @a delaunay_2 is cleared).
+	 */
+	bool
+	move_vertices_of_cached_delaunay_2(
+			ResolvedTriangulation::Delaunay_2 &delaunay_2,
+			const std::vector<DelaunayPoint2> &delaunay_point_2_seq,
+			const ResolvedTriangulation::Delaunay_2 &cached_delaunay_2,
+			const std::vector<unsigned int> &cached_delaunay_point_vertex_indices)
+	{
+		const unsigned int num_delaunay_points = delaunay_point_2_seq.size();
+		if (num_delaunay_points != cached_delaunay_point_vertex_indices.size())
+		{
+			return false;
+		}
+
+		const unsigned int num_vertices = cached_delaunay_2.number_of_vertices();
+
+		// Copy the cached triangulation (including its hierarchy levels).
+		delaunay_2.copy_triangulation(cached_delaunay_2);
+
+		// Map vertex indices to the copied vertices.
+		std::vector<ResolvedTriangulation::Delaunay_2::Vertex_handle> vertex_handles(num_vertices);
+		ResolvedTriangulation::Delaunay_2::Finite_vertices_iterator vertices_iter = delaunay_2.finite_vertices_begin();
+		ResolvedTriangulation::Delaunay_2::Finite_vertices_iterator vertices_end = delaunay_2.finite_vertices_end();
+		for ( ; vertices_iter != vertices_end; ++vertices_iter)
+		{
+			const unsigned int vertex_index = vertices_iter->get_vertex_index();
+			if (vertex_index >= num_vertices)
+			{
+				delaunay_2.clear();
+				return false;
+			}
+
+			vertex_handles[vertex_index] = vertices_iter;
+		}
+
+		// Find the new position of each vertex.
+		std::vector<const DelaunayPoint2 *> vertex_points(num_vertices, NULL);
+		for (unsigned int n = 0; n < num_delaunay_points; ++n)
+		{
+			const unsigned int vertex_index = cached_delaunay_point_vertex_indices[n];
+			if (vertex_index >= num_vertices)
+			{
+				delaunay_2.clear();
+				return false;
+			}
+
+			if (vertex_points[vertex_index] == NULL)
+			{
+				vertex_points[vertex_index] = &delaunay_point_2_seq[n];
+				continue;
+			}
+
+			// Delaunay points that previously coincided (and hence shared a vertex) must still
+			// coincide, otherwise they need separate vertices.
+			if (delaunay_point_2_seq[n].point_2 != vertex_points[vertex_index]->point_2)
+			{
+				delaunay_2.clear();
+				return false;
+			}
+		}
+
+		// Move the vertices.
+		for (unsigned int vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+		{
+			if (vertex_points[vertex_index] == NULL)
+			{
+				delaunay_2.clear();
+				return false;
+			}
+
+			const ResolvedTriangulation::Delaunay_2::Vertex_handle vertex_handle = vertex_handles[vertex_index];
+
+			// If another vertex is already at the new position then the points no longer correspond.
+			if (delaunay_2.move_if_no_collision(vertex_handle, vertex_points[vertex_index]->point_2) != vertex_handle)
+			{
+				delaunay_2.clear();
+				return false;
+			}
+		}
+
+		// Re-initialise the vertices with our delaunay point information.
+		std::vector<bool> is_vertex_initialised(num_vertices, false);
+		for (unsigned int n = 0; n < num_delaunay_points; ++n)
+		{
+			const DelaunayPoint2 &delaunay_point_2 = delaunay_point_2_seq[n];
+			const ResolvedTriangulation::Network::DelaunayPoint &delaunay_point = *delaunay_point_2.delaunay_point;
+
+			const unsigned int vertex_index = cached_delaunay_point_vertex_indices[n];
+			const ResolvedTriangulation::Delaunay_2::Vertex_handle vertex_handle = vertex_handles[vertex_index];
+
+			if (!is_vertex_initialised[vertex_index])
+			{
+				vertex_handle->initialise(
+						delaunay_2,
+						vertex_index,
+						delaunay_point.point,
+						delaunay_point_2.lat_lon_point,
+						delaunay_point.shared_source_info);
+
+				is_vertex_initialised[vertex_index] = true;
+			}
+			else
+			{
+				// Equally blend the source infos of coincident vertices
+				// (see 'ResolvedTriangulation::Network::create_delaunay_2()').
+				const ResolvedVertexSourceInfo::non_null_ptr_to_const_type interpolated_source_info =
+						ResolvedVertexSourceInfo::create(
+								get_non_null_pointer(&vertex_handle->get_shared_source_info()),
+								delaunay_point.shared_source_info,
+								0.5);  // equal blending
+
+				vertex_handle->initialise(
+						delaunay_2,
+						vertex_index,
+						delaunay_point.point,
+						delaunay_point_2.lat_lon_point,
+						interpolated_source_info);
+			}
+		}
+
+		// The copied faces still reference the cached triangulation (and its cached face information).
+		ResolvedTriangulation::Delaunay_2::All_faces_iterator faces_iter = delaunay_2.all_faces_begin();
+		ResolvedTriangulation::Delaunay_2::All_faces_iterator faces_end = delaunay_2.all_faces_end();
+		for ( ; faces_iter != faces_end; ++faces_iter)
+		{
+			faces_iter->reset_cached_info();
+		}
+
+		return true;
+	}
+
+
 	/**
 	 * Calculate the velocity at a delaunay vertex.
 	 */
@@ -211,6 +353,35 @@ namespace GPlatesAppLogic
 }
 
 
+boost::optional<GPlatesAppLogic::ResolvedTriangulation::Network::non_null_ptr_to_const_type>
+GPlatesAppLogic::ResolvedTriangulation::NetworkTriangulationCache::Entry::get_network() const
+{
+	return d_network;
+}
+
+
+void
+GPlatesAppLogic::ResolvedTriangulation::NetworkTriangulationCache::Entry::set_network(
+		const Network::non_null_ptr_to_const_type &network)
+{
+	d_network = network;
+}
+
+
+GPlatesAppLogic::ResolvedTriangulation::NetworkTriangulationCache::entry_ptr_type
+GPlatesAppLogic::ResolvedTriangulation::NetworkTriangulationCache::get_entry(
+		const GPlatesModel::FeatureHandle &feature)
+{
+	entry_ptr_type &entry = d_entries[&feature];
+	if (!entry)
+	{
+		entry.reset(new Entry());
+	}
+
+	return entry;
+}
+
+
 GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type
 GPlatesAppLogic::ResolvedTriangulation::Network::get_boundary_polygon_with_rigid_block_holes() const
 {
@@ -875,8 +1046,32 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_velocity(
 	{
 		rigid_block = is_point_in_a_rigid_block(point);
 	}
+
+	// If velocities have been prepared for concurrent queries (with the same velocity delta time parameters)
+	// then only use those (and avoid lazily calculating, and caching, velocities).
+	const ConcurrentVelocityQueries *concurrent_velocity_queries = NULL;
+	if (d_concurrent_velocity_queries &&
+		d_concurrent_velocity_queries->velocity_delta_time_params ==
+			std::make_pair(GPlatesMaths::Real(velocity_delta_time), velocity_delta_time_type))
+	{
+		concurrent_velocity_queries = &d_concurrent_velocity_queries.get();
+	}
+
 	if (rigid_block)
 	{
+		if (concurrent_velocity_queries)
+		{
+			// The rigid block references an element of 'd_rigid_blocks'.
+			const unsigned int rigid_block_index = &rigid_block.get() - &d_rigid_blocks.front();
+
+			const GPlatesMaths::Vector3D rigid_block_velocity =
+					GPlatesMaths::calculate_velocity_vector(
+							point,
+							concurrent_velocity_queries->rigid_block_velocity_angular_vectors[rigid_block_index]);
+
+			return std::make_pair(rigid_block_velocity, PointLocation(rigid_block.get()));
+		}
+
 		const GPlatesMaths::Vector3D rigid_block_velocity =
 				calculate_rigid_block_velocity(
 						point,
@@ -910,6 +1105,22 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_velocity(
 	delaunay_natural_neighbor_coordinates_2_type natural_neighbor_coordinates;
 	calc_delaunay_natural_neighbor_coordinates_in_deforming_region(natural_neighbor_coordinates, point_2, delaunay_face);
 
+	if (concurrent_velocity_queries)
+	{
+		// Interpolate the prepared 3D velocity vectors (these are only read, not cached, so we can be
+		// called concurrently from multiple threads).
+		const GPlatesMaths::Vector3D interpolated_velocity =
+				linear_interpolation_2(
+						natural_neighbor_coordinates,
+						UncachedDataAccess<GPlatesMaths::Vector3D>(
+								get_delaunay_point_2_to_vertex_handle_map(),
+								boost::bind(&get_concurrent_query_vertex_velocity,
+										boost::placeholders::_1,
+										boost::cref(concurrent_velocity_queries->vertex_velocities))));
+
+		return std::make_pair(interpolated_velocity, PointLocation(delaunay_face));
+	}
+
 	// Look for an existing map associated with the velocity delta time parameters.
 	DelaunayVertexHandleToVelocityMapType &delaunay_vertex_handle_to_velocity_map =
 			d_velocity_delta_time_to_velocity_map.get_value(
@@ -932,6 +1143,107 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_velocity(
 }
 
 
+void
+GPlatesAppLogic::ResolvedTriangulation::Network::prepare_concurrent_velocity_queries(
+		const double &velocity_delta_time,
+		VelocityDeltaTime::Type velocity_delta_time_type) const
+{
+	const velocity_delta_time_params_type velocity_delta_time_params =
+			std::make_pair(GPlatesMaths::Real(velocity_delta_time), velocity_delta_time_type);
+
+	// Return early if already prepared for the same velocity delta time parameters.
+	if (d_concurrent_velocity_queries &&
+		d_concurrent_velocity_queries->velocity_delta_time_params == velocity_delta_time_params)
+	{
+		return;
+	}
+
+	// Discard any previously prepared velocities (with different velocity delta time parameters)
+	// so that 'calculate_velocity()' doesn't use them while we're preparing.
+	d_concurrent_velocity_queries = boost::none;
+	ConcurrentVelocityQueries concurrent_velocity_queries(velocity_delta_time_params);
+
+	// Build the high-speed point-in-polygon structure (and bounding small circle) of the network boundary.
+	d_network_boundary_polygon->is_point_in_polygon(
+			GPlatesMaths::PointOnSphere(d_network_boundary_polygon->get_boundary_centroid()),
+			GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE);
+	d_network_boundary_polygon->get_inner_outer_bounding_small_circle();
+
+	// Do the same for the interior rigid blocks, and also calculate their angular velocities.
+	rigid_block_seq_type::const_iterator rigid_blocks_iter = d_rigid_blocks.begin();
+	rigid_block_seq_type::const_iterator rigid_blocks_end = d_rigid_blocks.end();
+	for ( ; rigid_blocks_iter != rigid_blocks_end; ++rigid_blocks_iter)
+	{
+		const RigidBlock &rigid_block = *rigid_blocks_iter;
+
+		boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> interior_polygon =
+				GeometryUtils::get_polygon_on_sphere(
+						*rigid_block.get_reconstructed_feature_geometry()->reconstructed_geometry());
+		if (interior_polygon)
+		{
+			interior_polygon.get()->is_point_in_polygon(
+					GPlatesMaths::PointOnSphere(interior_polygon.get()->get_boundary_centroid()),
+					GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE);
+			interior_polygon.get()->get_inner_outer_bounding_small_circle();
+		}
+
+		concurrent_velocity_queries.rigid_block_velocity_angular_vectors.push_back(
+				GPlatesMaths::calculate_velocity_angular_vector(
+						calculate_rigid_block_stage_rotation(
+								rigid_block,
+								velocity_delta_time,
+								velocity_delta_time_type),
+						velocity_delta_time));
+	}
+
+	// Build the delaunay triangulation and its point-to-vertex map.
+	const Delaunay_2 &delaunay_2 = get_delaunay_2();
+	get_delaunay_point_2_to_vertex_handle_map();
+
+	// Calculate the velocities at all vertices.
+	Delaunay_2::Finite_vertices_iterator finite_vertices_iter = delaunay_2.finite_vertices_begin();
+	Delaunay_2::Finite_vertices_iterator finite_vertices_end = delaunay_2.finite_vertices_end();
+	for ( ; finite_vertices_iter != finite_vertices_end; ++finite_vertices_iter)
+	{
+		const Delaunay_2::Vertex_handle vertex_handle = finite_vertices_iter;
+
+		concurrent_velocity_queries.vertex_velocities.insert(
+				std::make_pair(
+						vertex_handle,
+						calc_delaunay_vertex_velocity(vertex_handle, velocity_delta_time, velocity_delta_time_type)));
+	}
+
+	// Calculate whether each face is in the deforming region (this is otherwise calculated, and cached,
+	// on demand when locating the face containing a point).
+	Delaunay_2::Finite_faces_iterator finite_faces_iter = delaunay_2.finite_faces_begin();
+	Delaunay_2::Finite_faces_iterator finite_faces_end = delaunay_2.finite_faces_end();
+	for ( ; finite_faces_iter != finite_faces_end; ++finite_faces_iter)
+	{
+		finite_faces_iter->is_in_deforming_region();
+		finite_faces_iter->get_delaunay_2();
+	}
+
+	d_concurrent_velocity_queries = concurrent_velocity_queries;
+}
+
+
+GPlatesMaths::Vector3D
+GPlatesAppLogic::ResolvedTriangulation::Network::get_concurrent_query_vertex_velocity(
+		const Delaunay_2::Vertex_handle &vertex_handle,
+		const DelaunayVertexHandleToVelocityMapType &vertex_velocities)
+{
+	DelaunayVertexHandleToVelocityMapType::const_iterator vertex_velocity_iter =
+			vertex_velocities.find(vertex_handle);
+
+	// All (finite) vertices were prepared.
+	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+			vertex_velocity_iter != vertex_velocities.end(),
+			GPLATES_ASSERTION_SOURCE);
+
+	return vertex_velocity_iter->second;
+}
+
+
 const GPlatesAppLogic::ResolvedTriangulation::Delaunay_2 &
 GPlatesAppLogic::ResolvedTriangulation::Network::get_delaunay_2() const
 {
@@ -960,6 +1272,16 @@ GPlatesAppLogic::ResolvedTriangulation::Network::create_delaunay_2() const
 
 	d_delaunay_2 = boost::in_place(*this, d_reconstruction_time);
 
+	// See if we can re-use the triangulation of a network previously resolved from the same feature.
+	//
+	// Rift networks are excluded since their triangulations are adaptively refined
+	// (with extra vertices that don't correspond to delaunay points).
+	NetworkTriangulationCache::entry_ptr_type triangulation_cache_entry;
+	if (!d_build_info.rift_params)
+	{
+		triangulation_cache_entry = d_build_info.triangulation_cache_entry.lock();
+	}
+
 	// Project the points to 2D space and insert into array to be spatially sorted.
 	std::vector<DelaunayPoint2> delaunay_point_2_seq;
 	delaunay_point_2_seq.reserve(d_build_info.delaunay_points.size());
@@ -980,6 +1302,30 @@ GPlatesAppLogic::ResolvedTriangulation::Network::create_delaunay_2() const
 		delaunay_point_2_seq.push_back(DelaunayPoint2(&delaunay_point, lat_lon_point, point_2));
 	}
 
+	if (triangulation_cache_entry)
+	{
+		boost::optional<Network::non_null_ptr_to_const_type> cached_network = triangulation_cache_entry->get_network();
+		if (cached_network &&
+			cached_network.get()->d_delaunay_2 &&
+			move_vertices_of_cached_delaunay_2(
+					d_delaunay_2.get(),
+					delaunay_point_2_seq,
+					cached_network.get()->d_delaunay_2.get(),
+					cached_network.get()->d_delaunay_point_vertex_indices))
+		{
+			// Our delaunay points correspond to the same vertices as the cached network.
+			d_delaunay_point_vertex_indices = cached_network.get()->d_delaunay_point_vertex_indices;
+
+			// We're now the most recently triangulated network for our feature.
+			triangulation_cache_entry->set_network(GPlatesUtils::get_non_null_pointer(this));
+
+			return;
+		}
+
+		// Record which vertex each delaunay point gets inserted as.
+		d_delaunay_point_vertex_indices.resize(delaunay_point_2_seq.size());
+	}
+
 	// Improve performance by spatially sorting the delaunay points.
 	// This is what is done by the CGAL overload that inserts a *range* of points into a delauany triangulation.
 	CGAL::spatial_sort(
@@ -1050,10 +1396,23 @@ GPlatesAppLogic::ResolvedTriangulation::Network::create_delaunay_2() const
 				interpolated_source_info);
 		}
 
+		if (triangulation_cache_entry)
+		{
+			// Index of the delaunay point in the order it was passed to us.
+			const unsigned int delaunay_point_index = delaunay_point_2.delaunay_point - &d_build_info.delaunay_points[0];
+			d_delaunay_point_vertex_indices[delaunay_point_index] = vertex_handle->get_vertex_index();
+		}
+
 		// The next insert vertex will start searching at the face of the last inserted vertex.
 		insert_start_face = vertex_handle->face();
 	}
 
+	if (triangulation_cache_entry)
+	{
+		// We're now the most recently triangulated network for our feature.
+		triangulation_cache_entry->set_network(GPlatesUtils::get_non_null_pointer(this));
+	}
+
 	//
 	// Note that we don't need to initialise the faces.
 	//
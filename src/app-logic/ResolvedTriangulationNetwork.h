@@ -33,9 +33,12 @@
 #include <utility>
 #include <vector>
 #include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
 #include <boost/optional.hpp>
 #include <boost/ref.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/variant.hpp>
+#include <boost/weak_ptr.hpp>
 #include <QPointF>
 
 #include "GeometryUtils.h"
@@ -54,6 +57,7 @@
 #include "maths/UnitVector3D.h"
 #include "maths/Vector3D.h"
 
+#include "model/FeatureHandle.h"
 #include "model/types.h"
 
 #include "utils/Earth.h"
@@ -65,6 +69,83 @@ namespace GPlatesAppLogic
 {
 	namespace ResolvedTriangulation
 	{
+		class Network;
+
+
+		/**
+		 * Keeps the most recently triangulated @a Network of each topological network feature so that
+		 * the next network resolved from the same feature (typically at an adjacent reconstruction time)
+		 * can re-use its Delaunay triangulation instead of triangulating from scratch.
+		 *
+		 * Between adjacent reconstruction times a network usually has the same Delaunay points (just
+		 * in slightly different positions), so copying the previous triangulation and moving its vertices
+		 * (which only requires local edge flips) is cheaper than re-inserting all the points.
+		 * If the Delaunay points have changed then the network is triangulated from scratch.
+		 */
+		class NetworkTriangulationCache :
+				private boost::noncopyable
+		{
+		public:
+
+			/**
+			 * The most recently triangulated network of a single topological network feature.
+			 */
+			class Entry :
+					private boost::noncopyable
+			{
+			public:
+
+				/**
+				 * Returns the most recently triangulated network (if any).
+				 */
+				boost::optional<GPlatesUtils::non_null_intrusive_ptr<const Network> >
+				get_network() const;
+
+				/**
+				 * Sets the most recently triangulated network.
+				 */
+				void
+				set_network(
+						const GPlatesUtils::non_null_intrusive_ptr<const Network> &network);
+
+			private:
+				boost::optional<GPlatesUtils::non_null_intrusive_ptr<const Network> > d_network;
+			};
+
+			//! Typedef for a shared pointer to an @a Entry.
+			typedef boost::shared_ptr<Entry> entry_ptr_type;
+
+			//! Typedef for a weak pointer to an @a Entry (networks only weakly reference their entry).
+			typedef boost::weak_ptr<Entry> entry_weak_ptr_type;
+
+
+			/**
+			 * Returns the entry associated with the specified topological network feature
+			 * (creating it if necessary).
+			 */
+			entry_ptr_type
+			get_entry(
+					const GPlatesModel::FeatureHandle &feature);
+
+			/**
+			 * Releases all cached networks.
+			 *
+			 * Networks that have not yet triangulated will then triangulate from scratch.
+			 */
+			void
+			clear()
+			{
+				d_entries.clear();
+			}
+
+		private:
+
+			typedef std::map<const GPlatesModel::FeatureHandle *, entry_ptr_type> entry_map_type;
+
+			entry_map_type d_entries;
+		};
+
+
 		/**
 		 * The central access point for resolved topological network triangulations.
 		 *
@@ -289,6 +370,13 @@ namespace GPlatesAppLogic
 
 			/**
 			 * Creates a @a Network.
+			 *
+			 * If @a triangulation_cache_entry is specified then, when the Delaunay triangulation is
+			 * first needed, it is created from the triangulation of the network most recently
+			 * triangulated in that entry (if its Delaunay points still correspond), and then this
+			 * network becomes the most recently triangulated network in that entry.
+			 * Only a weak reference to the entry is kept. Note that rift networks are always
+			 * triangulated from scratch (since their triangulations are adaptively refined).
 			 */
 			template <typename DelaunayPointIter, typename RigidBlockIter>
 			static
@@ -301,7 +389,9 @@ namespace GPlatesAppLogic
 					RigidBlockIter rigid_blocks_begin,
 					RigidBlockIter rigid_blocks_end,
 					const TopologyNetworkParams &topology_network_params,
-					boost::optional<Rift> rift = boost::none)
+					boost::optional<Rift> rift = boost::none,
+					NetworkTriangulationCache::entry_ptr_type triangulation_cache_entry =
+							NetworkTriangulationCache::entry_ptr_type())
 			{
 				return non_null_ptr_type(
 						new Network(
@@ -310,7 +400,8 @@ namespace GPlatesAppLogic
 								delaunay_points_begin, delaunay_points_end,
 								rigid_blocks_begin, rigid_blocks_end,
 								topology_network_params,
-								rift));
+								rift,
+								triangulation_cache_entry));
 			}
 
 
@@ -746,6 +837,25 @@ namespace GPlatesAppLogic
 			}
 
 
+			/**
+			 * Prepares this network so that @a calculate_velocity can subsequently be called concurrently
+			 * from multiple threads (using the same @a velocity_delta_time and @a velocity_delta_time_type).
+			 *
+			 * This builds, up front, everything that @a calculate_velocity otherwise lazily builds on demand
+			 * (the delaunay triangulation, the point-in-polygon structures of the network boundary and
+			 * interior rigid blocks, and the velocities at the delaunay vertices and of the rigid blocks).
+			 * Concurrent velocity queries then only read from this network.
+			 *
+			 * NOTE: This must be called from a single thread (ie, before starting any concurrent queries).
+			 * Velocity queries with other delta-time parameters (and any other non-velocity queries) are
+			 * not safe to call concurrently.
+			 */
+			void
+			prepare_concurrent_velocity_queries(
+					const double &velocity_delta_time = 1.0,
+					VelocityDeltaTime::Type velocity_delta_time_type = VelocityDeltaTime::T_PLUS_DELTA_T_TO_T) const;
+
+
 			/**
 			 * Gets, or creates, 2D delaunay triangulation.
 			 *
@@ -819,9 +929,11 @@ namespace GPlatesAppLogic
 						DelaunayPointIter delaunay_points_begin_,
 						DelaunayPointIter delaunay_points_end_,
 						const TopologyNetworkParams &topology_network_params_,
-						boost::optional<Rift> rift_) :
+						boost::optional<Rift> rift_,
+						const NetworkTriangulationCache::entry_ptr_type &triangulation_cache_entry_) :
 					delaunay_points(delaunay_points_begin_, delaunay_points_end_),
-					topology_network_params(topology_network_params_)
+					topology_network_params(topology_network_params_),
+					triangulation_cache_entry(triangulation_cache_entry_)
 				{
 					if (rift_)
 					{
@@ -832,6 +944,9 @@ namespace GPlatesAppLogic
 				std::vector<DelaunayPoint> delaunay_points;
 				TopologyNetworkParams topology_network_params;
 				boost::optional<RiftParams> rift_params;
+
+				//! Used to re-use the triangulation of a network previously resolved from the same feature.
+				NetworkTriangulationCache::entry_weak_ptr_type triangulation_cache_entry;
 			};
 
 
@@ -1034,6 +1149,15 @@ namespace GPlatesAppLogic
 			 */
 			mutable boost::optional<Delaunay_2> d_delaunay_2;
 
+			/**
+			 * The index of the delaunay vertex that each delaunay point (in the order passed to
+			 * @a create) was inserted as (coincident points share a vertex).
+			 *
+			 * Only recorded when using a @a NetworkTriangulationCache (so that the next network
+			 * can match its delaunay points to our vertices).
+			 */
+			mutable std::vector<unsigned int> d_delaunay_point_vertex_indices;
+
 			/**
 			 * Maps delaunay vertex points to vertex handles.
 			 */
@@ -1064,6 +1188,32 @@ namespace GPlatesAppLogic
 			mutable velocity_delta_time_to_deformed_point_map_type d_velocity_delta_time_to_deformed_point_map;
 
 
+			/**
+			 * Velocities prepared (by @a prepare_concurrent_velocity_queries) for concurrent read-only access.
+			 */
+			struct ConcurrentVelocityQueries
+			{
+				explicit
+				ConcurrentVelocityQueries(
+						const velocity_delta_time_params_type &velocity_delta_time_params_) :
+					velocity_delta_time_params(velocity_delta_time_params_)
+				{  }
+
+				velocity_delta_time_params_type velocity_delta_time_params;
+
+				//! Velocities at *all* the delaunay vertices.
+				DelaunayVertexHandleToVelocityMapType vertex_velocities;
+
+				//! Angular velocity vector of each rigid block (indexed the same as @a d_rigid_blocks).
+				std::vector<GPlatesMaths::Vector3D> rigid_block_velocity_angular_vectors;
+			};
+
+			/**
+			 * Velocities prepared for concurrent queries (if @a prepare_concurrent_velocity_queries called).
+			 */
+			mutable boost::optional<ConcurrentVelocityQueries> d_concurrent_velocity_queries;
+
+
 			template <typename DelaunayPointIter, typename RigidBlockIter>
 			Network(
 					const double &reconstruction_time,
@@ -1073,14 +1223,15 @@ namespace GPlatesAppLogic
 					RigidBlockIter rigid_blocks_begin_,
 					RigidBlockIter rigid_blocks_end_,
 					const TopologyNetworkParams &topology_network_params,
-					boost::optional<Rift> rift) :
+					boost::optional<Rift> rift,
+					const NetworkTriangulationCache::entry_ptr_type &triangulation_cache_entry) :
 				d_reconstruction_time(reconstruction_time),
 				d_network_boundary_polygon(network_boundary_polygon),
 				d_rigid_blocks(rigid_blocks_begin_, rigid_blocks_end_),
 				d_projection(
 						GPlatesMaths::PointOnSphere(network_boundary_polygon->get_boundary_centroid()),
 						1e3 * GPlatesUtils::Earth::MEAN_RADIUS_KMS/*Earth radius in metres*/),
-				d_build_info(delaunay_points_begin, delaunay_points_end, topology_network_params, rift),
+				d_build_info(delaunay_points_begin, delaunay_points_end, topology_network_params, rift, triangulation_cache_entry),
 				// Set the number of cached velocity maps (eg, for different velocity delta time parameters).
 				//
 				// A value of 2 is suitable since a network layer will typically be asked to use one
@@ -1127,6 +1278,15 @@ namespace GPlatesAppLogic
 					const ReconstructionTreeCreator &reconstruction_tree_creator) const;
 
 
+			/**
+			 * Returns the prepared velocity at a delaunay vertex (see @a prepare_concurrent_velocity_queries).
+			 */
+			static
+			GPlatesMaths::Vector3D
+			get_concurrent_query_vertex_velocity(
+					const Delaunay_2::Vertex_handle &vertex_handle,
+					const DelaunayVertexHandleToVelocityMapType &vertex_velocities);
+
 			const delaunay_point_2_to_vertex_handle_map_type &
 			get_delaunay_point_2_to_vertex_handle_map() const;
 
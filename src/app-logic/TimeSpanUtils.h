@@ -332,6 +332,9 @@ namespace GPlatesAppLogic
 
 		/**
 		 * A look up table of samples of 'T' over a time span.
+		 *
+		 * Optionally the samples can be created lazily (on demand) when a time slot is first accessed,
+		 * and the number of resident samples can be bounded (by evicting the least recently used).
 		 */
 		template <typename T>
 		class TimeSampleSpan :
@@ -346,6 +349,35 @@ namespace GPlatesAppLogic
 			typedef GPlatesUtils::non_null_intrusive_ptr<const TimeSampleSpan> non_null_ptr_to_const_type;
 
 
+			/**
+			 * Convenience typedef for a function that lazily creates the sample in a time slot.
+			 *
+			 * The function takes the following arguments:
+			 * - The time slot of the sample being created,
+			 * - The time of the sample being created.
+			 *
+			 * The function returns none if there is no sample at the time slot.
+			 */
+			typedef boost::function<
+					boost::optional<T> (
+							unsigned int,
+							const double &)>
+									sample_creator_function_type;
+
+			/**
+			 * Convenience typedef for a function that returns true if a sample can be released
+			 * (when bounding the number of resident samples).
+			 *
+			 * A sample that is still referenced elsewhere should not be released since that frees
+			 * no memory and, if its time slot is accessed again, it would be created a second time
+			 * (leaving two different copies of the same sample in use).
+			 */
+			typedef boost::function<
+					bool (
+							const T &)>
+									sample_releasable_function_type;
+
+
 			/**
 			 * Allocate a look up table with as many slots as there are in @a time_range.
 			 *
@@ -360,6 +392,39 @@ namespace GPlatesAppLogic
 			}
 
 
+			/**
+			 * Allocate a look up table, with as many slots as there are in @a time_range, that creates
+			 * the sample in each time slot (using @a sample_creator_function) only when the time slot
+			 * is first accessed with @a get_sample_in_time_slot.
+			 *
+			 * If @a max_num_resident_samples is non-zero then, once that many samples are resident,
+			 * the least recently accessed sample is released to make room for a newly created sample
+			 * (a released sample is created again if its time slot is accessed again).
+			 * Note that this includes samples set with @a set_sample_in_time_slot.
+			 * Also note that this means a reference returned by @a get_sample_in_time_slot is only
+			 * valid until the next sample is created (so copy it if it's needed for longer).
+			 *
+			 * If @a sample_releasable_function is specified then only those samples it accepts are
+			 * released (the others remain resident until they are accepted), so the number of
+			 * resident samples can temporarily exceed @a max_num_resident_samples.
+			 */
+			static
+			non_null_ptr_type
+			create(
+					const TimeRange &time_range,
+					const sample_creator_function_type &sample_creator_function,
+					unsigned int max_num_resident_samples = 0,
+					const sample_releasable_function_type &sample_releasable_function = sample_releasable_function_type())
+			{
+				return non_null_ptr_type(
+						new TimeSampleSpan(
+								time_range,
+								sample_creator_function,
+								max_num_resident_samples,
+								sample_releasable_function));
+			}
+
+
 			/**
 			 * Returns the time range of the time span.
 			 */
@@ -373,12 +438,15 @@ namespace GPlatesAppLogic
 
 			/**
 			 * Returns true if @a set_sample_in_time_slot has not been called for any time slots.
+			 *
+			 * Note: Always returns false if samples are created lazily (since any time slot might
+			 * create a sample when accessed).
 			 */
 			virtual
 			bool
 			empty() const
 			{
-				return d_is_empty;
+				return d_is_empty && !d_sample_creator_function;
 			}
 
 
@@ -399,7 +467,8 @@ namespace GPlatesAppLogic
 			/**
 			 * Get the sample for the specified time slot.
 			 *
-			 * Returns none if @a set_sample_in_time_slot has not yet been called for @a time_slot.
+			 * Returns none if @a set_sample_in_time_slot has not yet been called for @a time_slot
+			 * (and, if samples are created lazily, the sample creator function returned none).
 			 *
 			 * The number of time slots is available in the TimeRange returned by @a get_time_range.
 			 *
@@ -414,23 +483,68 @@ namespace GPlatesAppLogic
 			/**
 			 * Non-const overload.
 			 *
-			 * Note: Returns none if @a set_sample_in_time_slot has not yet been called for @a time_slot.
+			 * Note: Returns none if @a set_sample_in_time_slot has not yet been called for @a time_slot
+			 * (and, if samples are created lazily, the sample creator function returned none).
 			 */
 			virtual
 			boost::optional<T &>
 			get_sample_in_time_slot(
 					unsigned int time_slot);
 
+
+			/**
+			 * Same as @a get_sample_in_time_slot except a sample is never lazily created
+			 * (ie, only returns a sample if it's currently resident).
+			 */
+			boost::optional<const T &>
+			get_resident_sample_in_time_slot(
+					unsigned int time_slot) const;
+
 		private:
 
 			//! Typedef for a time sequence of samples.
 			typedef std::vector< boost::optional<T> > sample_time_seq_type;
 
+			//! Typedef for a sequence of time slots ordered from most to least recently accessed.
+			typedef std::list<unsigned int> time_slot_lru_seq_type;
+
 
 			TimeRange d_time_range;
-			sample_time_seq_type d_sample_time_sequence;
+			mutable sample_time_seq_type d_sample_time_sequence;
 			bool d_is_empty;
 
+			/**
+			 * Optional function to lazily create samples.
+			 */
+			sample_creator_function_type d_sample_creator_function;
+
+			/**
+			 * Maximum number of resident samples (zero means no limit) - only used if lazily creating samples.
+			 */
+			unsigned int d_max_num_resident_samples;
+
+			/**
+			 * Optional function that determines whether a sample can be released (if bounded).
+			 */
+			sample_releasable_function_type d_sample_releasable_function;
+
+			/**
+			 * Whether each time slot has been filled (either lazily created or set).
+			 *
+			 * This avoids repeatedly calling the sample creator function for time slots with no sample.
+			 */
+			mutable std::vector<bool> d_is_time_slot_filled;
+
+			/**
+			 * Resident time slots ordered from most to least recently accessed (only if bounded).
+			 */
+			mutable time_slot_lru_seq_type d_time_slot_lru_sequence;
+
+			/**
+			 * Each time slot's position in @a d_time_slot_lru_sequence (only valid if resident).
+			 */
+			mutable std::vector< boost::optional<typename time_slot_lru_seq_type::iterator> > d_time_slot_lru_positions;
+
 
 			explicit
 			TimeSampleSpan(
@@ -438,8 +552,34 @@ namespace GPlatesAppLogic
 				d_time_range(time_range),
 				// Allocate and initialise empty slots...
 				d_sample_time_sequence(time_range.get_num_time_slots()),
-				d_is_empty(true)
+				d_is_empty(true),
+				d_max_num_resident_samples(0)
+			{  }
+
+			TimeSampleSpan(
+					const TimeRange &time_range,
+					const sample_creator_function_type &sample_creator_function,
+					unsigned int max_num_resident_samples,
+					const sample_releasable_function_type &sample_releasable_function) :
+				d_time_range(time_range),
+				// Allocate and initialise empty slots...
+				d_sample_time_sequence(time_range.get_num_time_slots()),
+				d_is_empty(true),
+				d_sample_creator_function(sample_creator_function),
+				d_max_num_resident_samples(max_num_resident_samples),
+				d_sample_releasable_function(sample_releasable_function),
+				d_is_time_slot_filled(time_range.get_num_time_slots(), false),
+				d_time_slot_lru_positions(time_range.get_num_time_slots())
 			{  }
+
+			/**
+			 * Records that the sample in @a time_slot was just filled or accessed, and releases the
+			 * least recently accessed sample(s) if there are now too many resident samples.
+			 */
+			void
+			touch_time_slot(
+					unsigned int time_slot,
+					bool is_resident) const;
 		};
 
 
@@ -755,6 +895,12 @@ namespace GPlatesAppLogic
 
 			d_is_empty = false;
 
+			if (d_sample_creator_function)
+			{
+				// Note that this can release other samples but not the one we just set.
+				touch_time_slot(time_slot, true/*is_resident*/);
+			}
+
 			return d_sample_time_sequence[time_slot].get();
 		}
 
@@ -768,6 +914,40 @@ namespace GPlatesAppLogic
 					time_slot < d_sample_time_sequence.size(),
 					GPLATES_ASSERTION_SOURCE);
 
+			if (!d_sample_creator_function)
+			{
+				return get_resident_sample_in_time_slot(time_slot);
+			}
+
+			boost::optional<T> &sample = d_sample_time_sequence[time_slot];
+
+			if (!d_is_time_slot_filled[time_slot])
+			{
+				// Create the sample on first access (or first access since it was released).
+				sample = d_sample_creator_function(time_slot, d_time_range.get_time(time_slot));
+			}
+
+			// Note that this can release other samples but not the one we just accessed.
+			touch_time_slot(time_slot, static_cast<bool>(sample));
+
+			if (!sample)
+			{
+				return boost::none;
+			}
+
+			return sample.get();
+		}
+
+
+		template <typename T>
+		boost::optional<const T &>
+		TimeSampleSpan<T>::get_resident_sample_in_time_slot(
+				unsigned int time_slot) const
+		{
+			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+					time_slot < d_sample_time_sequence.size(),
+					GPLATES_ASSERTION_SOURCE);
+
 			const boost::optional<T> &sample = d_sample_time_sequence[time_slot];
 			if (!sample)
 			{
@@ -778,6 +958,69 @@ namespace GPlatesAppLogic
 		}
 
 
+		template <typename T>
+		void
+		TimeSampleSpan<T>::touch_time_slot(
+				unsigned int time_slot,
+				bool is_resident) const
+		{
+			const bool was_filled = d_is_time_slot_filled[time_slot];
+			d_is_time_slot_filled[time_slot] = true;
+
+			// Only need to track access order if the number of resident samples is bounded.
+			if (d_max_num_resident_samples == 0)
+			{
+				return;
+			}
+
+			// Remove the time slot from its current position in the LRU sequence (if it's there).
+			// Time slots that were filled without a sample are not in the LRU sequence.
+			if (was_filled &&
+				d_time_slot_lru_positions[time_slot])
+			{
+				d_time_slot_lru_sequence.erase(d_time_slot_lru_positions[time_slot].get());
+				d_time_slot_lru_positions[time_slot] = boost::none;
+			}
+
+			if (!is_resident)
+			{
+				// Nothing resident so nothing to release later.
+				return;
+			}
+
+			// Make the time slot the most recently accessed.
+			d_time_slot_lru_sequence.push_front(time_slot);
+			d_time_slot_lru_positions[time_slot] = d_time_slot_lru_sequence.begin();
+
+			// Release the least recently accessed samples if there are too many.
+			//
+			// Samples that cannot be released are skipped. The most recently accessed sample
+			// (at the front of the LRU sequence) is never released.
+			typename time_slot_lru_seq_type::iterator lru_iter = d_time_slot_lru_sequence.end();
+			--lru_iter;
+			while (d_time_slot_lru_sequence.size() > d_max_num_resident_samples &&
+				lru_iter != d_time_slot_lru_sequence.begin())
+			{
+				const unsigned int lru_time_slot = *lru_iter;
+				typename time_slot_lru_seq_type::iterator next_lru_iter = lru_iter;
+				--next_lru_iter;
+
+				if (!d_sample_releasable_function ||
+					d_sample_releasable_function(d_sample_time_sequence[lru_time_slot].get()))
+				{
+					d_time_slot_lru_sequence.erase(lru_iter);
+					d_time_slot_lru_positions[lru_time_slot] = boost::none;
+
+					// The released sample will get created again if its time slot is accessed again.
+					d_sample_time_sequence[lru_time_slot] = boost::none;
+					d_is_time_slot_filled[lru_time_slot] = false;
+				}
+
+				lru_iter = next_lru_iter;
+			}
+		}
+
+
 		template <typename T>
 		boost::optional<T &>
 		TimeSampleSpan<T>::get_sample_in_time_slot(
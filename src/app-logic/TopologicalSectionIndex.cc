@@ -0,0 +1,98 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <boost/foreach.hpp>
+
+#include "TopologicalSectionIndex.h"
+
+#include "ReconstructionGeometryUtils.h"
+
+
+void
+GPlatesAppLogic::TopologicalSectionIndex::add(
+		const ReconstructionGeometry::non_null_ptr_type &rg)
+{
+	boost::optional<GPlatesModel::FeatureHandle::weak_ref> feature_ref =
+			ReconstructionGeometryUtils::get_feature_ref(rg);
+	if (!feature_ref)
+	{
+		return;
+	}
+
+	d_index[feature_ref.get()->feature_id()].push_back(rg);
+}
+
+
+const GPlatesAppLogic::TopologicalSectionIndex::reconstruction_geometry_seq_type *
+GPlatesAppLogic::TopologicalSectionIndex::find(
+		const GPlatesModel::FeatureId &feature_id) const
+{
+	index_type::const_iterator iter = d_index.find(feature_id);
+	if (iter == d_index.end())
+	{
+		return NULL;
+	}
+
+	return &iter->second;
+}
+
+
+void
+GPlatesAppLogic::TopologicalSectionIndex::find(
+		reconstruction_geometry_seq_type &found_rgs,
+		const GPlatesModel::FeatureId &feature_id,
+		const GPlatesModel::PropertyName &property_name,
+		boost::optional<const std::vector<ReconstructHandle::type> &> reconstruct_handles) const
+{
+	const reconstruction_geometry_seq_type *rgs = find(feature_id);
+	if (rgs == NULL)
+	{
+		return;
+	}
+
+	BOOST_FOREACH(const ReconstructionGeometry::non_null_ptr_type &rg, *rgs)
+	{
+		// The RG's geometry property must still exist and have the requested property name.
+		boost::optional<GPlatesModel::FeatureHandle::iterator> geometry_property =
+				ReconstructionGeometryUtils::get_geometry_property_iterator(rg);
+		if (!geometry_property ||
+			!geometry_property->is_still_valid() ||
+			(*geometry_property.get())->property_name() != property_name)
+		{
+			continue;
+		}
+
+		// If we've been requested to restrict the RGs to a set of reconstruct handles...
+		if (reconstruct_handles)
+		{
+			const boost::optional<ReconstructHandle::type> &rg_reconstruct_handle = rg->get_reconstruct_handle();
+			if (!rg_reconstruct_handle ||
+				std::find(
+					reconstruct_handles->begin(),
+					reconstruct_handles->end(),
+					rg_reconstruct_handle.get()) == reconstruct_handles->end())
+			{
+				continue;
+			}
+		}
+
+		found_rgs.push_back(rg);
+	}
+}
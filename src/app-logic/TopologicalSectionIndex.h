@@ -0,0 +1,180 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_APP_LOGIC_TOPOLOGICALSECTIONINDEX_H
+#define GPLATES_APP_LOGIC_TOPOLOGICALSECTIONINDEX_H
+
+#include <cstddef> // For std::size_t
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "ReconstructHandle.h"
+#include "ReconstructionGeometry.h"
+
+#include "model/FeatureId.h"
+#include "model/PropertyName.h"
+
+
+namespace GPlatesAppLogic
+{
+	/**
+	 * Maps feature IDs to the reconstruction geometries (RGs) that can be used as topological sections.
+	 *
+	 * Resolving a topology normally finds the RGs of each referenced topological section by first
+	 * finding all features with the section's feature ID (via the feature ID back-references)
+	 * and then visiting the weak observers of each of those features (with a linear search over
+	 * the reconstruct handles of each observer). For large topology datasets, with many sections
+	 * per boundary/network and many RGs per section feature (eg, multiple layers), this dominates
+	 * the cost of resolving.
+	 *
+	 * This index is built once from a sequence of RGs (typically all the topological section RGs
+	 * gathered by a layer for a particular reconstruction time) so that each section lookup is a
+	 * single hash table lookup over only those RGs.
+	 *
+	 * Since the index only contains the RGs it was built from, those RGs effectively replace the
+	 * restriction by reconstruct handles (although reconstruct handles are still honoured if specified).
+	 */
+	class TopologicalSectionIndex
+	{
+	public:
+
+		typedef std::vector<ReconstructionGeometry::non_null_ptr_type> reconstruction_geometry_seq_type;
+
+
+		TopologicalSectionIndex()
+		{  }
+
+		/**
+		 * Builds the index from the sequence of RGs [@a rgs_begin, @a rgs_end).
+		 *
+		 * The iterator must dereference to a (non-const) reconstruction geometry pointer type
+		 * convertible to ReconstructionGeometry::non_null_ptr_type.
+		 */
+		template <typename ReconstructionGeometryIter>
+		TopologicalSectionIndex(
+				ReconstructionGeometryIter rgs_begin,
+				ReconstructionGeometryIter rgs_end)
+		{
+			add(rgs_begin, rgs_end);
+		}
+
+
+		/**
+		 * Adds @a rg to the index (keyed by the feature ID of its feature).
+		 *
+		 * Does nothing if @a rg does not reference a valid feature.
+		 */
+		void
+		add(
+				const ReconstructionGeometry::non_null_ptr_type &rg);
+
+
+		/**
+		 * Adds the sequence of RGs [@a rgs_begin, @a rgs_end) to the index.
+		 */
+		template <typename ReconstructionGeometryIter>
+		void
+		add(
+				ReconstructionGeometryIter rgs_begin,
+				ReconstructionGeometryIter rgs_end)
+		{
+			for ( ; rgs_begin != rgs_end; ++rgs_begin)
+			{
+				add(ReconstructionGeometry::non_null_ptr_type(*rgs_begin));
+			}
+		}
+
+
+		/**
+		 * Returns true if no RGs have been added.
+		 */
+		bool
+		empty() const
+		{
+			return d_index.empty();
+		}
+
+
+		/**
+		 * Returns the number of distinct feature IDs in the index.
+		 */
+		std::size_t
+		size() const
+		{
+			return d_index.size();
+		}
+
+
+		/**
+		 * Returns all RGs (added to the index) whose feature has the feature ID @a feature_id,
+		 * or NULL if there are none.
+		 */
+		const reconstruction_geometry_seq_type *
+		find(
+				const GPlatesModel::FeatureId &feature_id) const;
+
+
+		/**
+		 * Appends to @a found_rgs those RGs, whose feature has the feature ID @a feature_id, that
+		 * were reconstructed from a geometry property named @a property_name.
+		 *
+		 * If @a reconstruct_handles is specified then only RGs with a reconstruct handle in that
+		 * set are appended.
+		 *
+		 * This is the indexed equivalent of finding the features with @a feature_id and then using
+		 * @a ReconstructionGeometryFinder on each of those features.
+		 */
+		void
+		find(
+				reconstruction_geometry_seq_type &found_rgs,
+				const GPlatesModel::FeatureId &feature_id,
+				const GPlatesModel::PropertyName &property_name,
+				boost::optional<const std::vector<ReconstructHandle::type> &> reconstruct_handles = boost::none) const;
+
+	private:
+
+		/**
+		 * Hashes a feature ID.
+		 *
+		 * Feature ID strings are interned (each distinct string is stored once in a string set)
+		 * so the address of the string uniquely identifies the feature ID. This avoids hashing
+		 * the string contents, and is consistent with FeatureId equality which compares the
+		 * string set entries (not the string contents).
+		 */
+		struct FeatureIdHash
+		{
+			std::size_t
+			operator()(
+					const GPlatesModel::FeatureId &feature_id) const
+			{
+				return std::hash<const void *>()(&feature_id.get());
+			}
+		};
+
+		typedef std::unordered_map<GPlatesModel::FeatureId, reconstruction_geometry_seq_type, FeatureIdHash>
+				index_type;
+
+
+		index_type d_index;
+	};
+}
+
+#endif // GPLATES_APP_LOGIC_TOPOLOGICALSECTIONINDEX_H
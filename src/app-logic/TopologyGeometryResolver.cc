@@ -63,12 +63,14 @@ GPlatesAppLogic::TopologyGeometryResolver::TopologyGeometryResolver(
 		ReconstructHandle::type reconstruct_handle,
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
-		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles) :
+		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+		boost::optional<const TopologicalSectionIndex &> topological_section_index) :
 	d_resolved_topological_lines(resolved_topological_lines),
 	d_reconstruct_handle(reconstruct_handle),
 	d_reconstruction_tree_creator(reconstruction_tree_creator),
 	d_reconstruction_tree(reconstruction_tree_creator.get_reconstruction_tree(reconstruction_time)),
-	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles)
+	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles),
+	d_topological_section_index(topological_section_index)
 {  
 }
 
@@ -78,12 +80,14 @@ GPlatesAppLogic::TopologyGeometryResolver::TopologyGeometryResolver(
 		ReconstructHandle::type reconstruct_handle,
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
-		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles) :
+		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+		boost::optional<const TopologicalSectionIndex &> topological_section_index) :
 	d_resolved_topological_boundaries(resolved_topological_boundaries),
 	d_reconstruct_handle(reconstruct_handle),
 	d_reconstruction_tree_creator(reconstruction_tree_creator),
 	d_reconstruction_tree(reconstruction_tree_creator.get_reconstruction_tree(reconstruction_time)),
-	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles)
+	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles),
+	d_topological_section_index(topological_section_index)
 {  
 }
 
@@ -94,13 +98,15 @@ GPlatesAppLogic::TopologyGeometryResolver::TopologyGeometryResolver(
 		ReconstructHandle::type reconstruct_handle,
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
-		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles) :
+		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+		boost::optional<const TopologicalSectionIndex &> topological_section_index) :
 	d_resolved_topological_lines(resolved_topological_lines),
 	d_resolved_topological_boundaries(resolved_topological_boundaries),
 	d_reconstruct_handle(reconstruct_handle),
 	d_reconstruction_tree_creator(reconstruction_tree_creator),
 	d_reconstruction_tree(reconstruction_tree_creator.get_reconstruction_tree(reconstruction_time)),
-	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles)
+	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles),
+	d_topological_section_index(topological_section_index)
 {  
 }
 
@@ -370,7 +376,8 @@ GPlatesAppLogic::TopologyGeometryResolver::record_topological_section_reconstruc
 			TopologyInternalUtils::find_topological_reconstruction_geometry(
 					geometry_delegate,
 					d_reconstruction_tree->get_reconstruction_time(),
-					topological_sections_reconstruct_handles);
+					topological_sections_reconstruct_handles,
+					d_topological_section_index);
 	if (!source_rg)
 	{
 		// If no RG was found then it's possible that the current reconstruction time is
@@ -39,6 +39,7 @@
 #include "ReconstructionTree.h"
 #include "ResolvedTopologicalBoundary.h"
 #include "ResolvedTopologicalLine.h"
+#include "TopologicalSectionIndex.h"
 #include "TopologyIntersections.h"
 
 #include "maths/GeometryOnSphere.h"
@@ -80,13 +81,16 @@ namespace GPlatesAppLogic
 		 *        the subset, of all reconstruction geometries observing the topological section features,
 		 *        that should be searched when resolving the topological geometries.
 		 *        This is useful to avoid outdated reconstruction geometries still in existence (and other scenarios).
+		 * @param topological_section_index optionally indexes the topological section reconstruction
+		 *        geometries by feature id (to avoid searching the observers of the topological section features).
 		 */
 		TopologyGeometryResolver(
 				std::vector<ResolvedTopologicalLine::non_null_ptr_type> &resolved_topological_lines,
 				ReconstructHandle::type reconstruct_handle,
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
-				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles);
+				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+				boost::optional<const TopologicalSectionIndex &> topological_section_index = boost::none);
 
 		/**
 		 * The resolved topological *boundaries* are appended to @a resolved_topological_boundaries.
@@ -96,13 +100,16 @@ namespace GPlatesAppLogic
 		 *        the subset, of all reconstruction geometries observing the topological section features,
 		 *        that should be searched when resolving the topological geometries.
 		 *        This is useful to avoid outdated reconstruction geometries still in existence (and other scenarios).
+		 * @param topological_section_index optionally indexes the topological section reconstruction
+		 *        geometries by feature id (to avoid searching the observers of the topological section features).
 		 */
 		TopologyGeometryResolver(
 				std::vector<ResolvedTopologicalBoundary::non_null_ptr_type> &resolved_topological_boundaries,
 				ReconstructHandle::type reconstruct_handle,
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
-				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles);
+				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+				boost::optional<const TopologicalSectionIndex &> topological_section_index = boost::none);
 
 		/**
 		 * The resolved topological *lines* are appended to @a resolved_topological_lines and
@@ -113,6 +120,8 @@ namespace GPlatesAppLogic
 		 *        the subset, of all reconstruction geometries observing the topological section features,
 		 *        that should be searched when resolving the topological geometries.
 		 *        This is useful to avoid outdated reconstruction geometries still in existence (and other scenarios).
+		 * @param topological_section_index optionally indexes the topological section reconstruction
+		 *        geometries by feature id (to avoid searching the observers of the topological section features).
 		 */
 		TopologyGeometryResolver(
 				std::vector<ResolvedTopologicalLine::non_null_ptr_type> &resolved_topological_lines,
@@ -120,7 +129,8 @@ namespace GPlatesAppLogic
 				ReconstructHandle::type reconstruct_handle,
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
-				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles);
+				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+				boost::optional<const TopologicalSectionIndex &> topological_section_index = boost::none);
 
 		virtual
 		~TopologyGeometryResolver() 
@@ -255,6 +265,11 @@ namespace GPlatesAppLogic
 		 */
 		boost::optional<std::vector<ReconstructHandle::type> > d_topological_sections_reconstruct_handles;
 
+		/**
+		 * Optional index of the topological section reconstruction geometries by feature id.
+		 */
+		boost::optional<const TopologicalSectionIndex &> d_topological_section_index;
+
 		//! The current feature being visited.
 		GPlatesModel::FeatureHandle::weak_ref d_currently_visited_feature;
 
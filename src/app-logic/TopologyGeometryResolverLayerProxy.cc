@@ -34,6 +34,7 @@
 #include "ReconstructionGeometryUtils.h"
 #include "ResolvedTopologicalBoundary.h"
 #include "ResolvedTopologicalLine.h"
+#include "TopologicalSectionIndex.h"
 #include "TopologyInternalUtils.h"
 #include "TopologyUtils.h"
 
@@ -1208,13 +1209,23 @@ GPlatesAppLogic::TopologyGeometryResolverLayerProxy::create_resolved_topological
 		topological_geometry_reconstruct_handles.push_back(reconstruct_handle);
 	}
 
+	// Index the topological sections by feature ID so that resolving each boundary section is a
+	// hash lookup (rather than a search through the observers of each topological section feature).
+	TopologicalSectionIndex topological_section_index(
+			topologically_referenced_reconstructed_geometries.begin(),
+			topologically_referenced_reconstructed_geometries.end());
+	topological_section_index.add(
+			topologically_referenced_resolved_lines.begin(),
+			topologically_referenced_resolved_lines.end());
+
 	// Resolve our boundary features into our sequence of resolved topological boundaries.
 	return TopologyUtils::resolve_topological_boundaries(
 			resolved_topological_boundaries,
 			d_current_topological_boundary_features,
 			d_current_reconstruction_layer_proxy.get_input_layer_proxy()->get_reconstruction_tree_creator(),
 			reconstruction_time,
-			topological_geometry_reconstruct_handles);
+			topological_geometry_reconstruct_handles,
+			topological_section_index);
 }
 
 
@@ -1285,13 +1296,20 @@ GPlatesAppLogic::TopologyGeometryResolverLayerProxy::create_resolved_topological
 	// This is where topological lines differ from topological boundaries.
 	// Topological boundaries can use resolved lines as topological sections.
 
+	// Index the topological sections by feature ID (see 'create_resolved_topological_boundaries()').
+	const TopologicalSectionIndex topological_section_index(
+			reconstructed_geometry_topological_sections.begin(),
+			reconstructed_geometry_topological_sections.end());
+
 	// Resolve our topological line features into our sequence of resolved topological lines.
 	return TopologyUtils::resolve_topological_lines(
 			resolved_topological_lines,
 			topological_line_features,
 			d_current_reconstruction_layer_proxy.get_input_layer_proxy()->get_reconstruction_tree_creator(),
 			reconstruction_time,
-			topological_sections_reconstruct_handles);
+			topological_sections_reconstruct_handles,
+			boost::none/*topological_lines_referenced*/,
+			topological_section_index);
 }
 
 
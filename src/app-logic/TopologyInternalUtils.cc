@@ -45,6 +45,7 @@
 #include "ReconstructionTree.h"
 #include "ResolvedTopologicalBoundary.h"
 #include "ResolvedTopologicalLine.h"
+#include "TopologicalSectionIndex.h"
 #include "TopologyReconstructedFeatureGeometry.h"
 
 #include "feature-visitors/PropertyValueFinder.h"
@@ -1126,8 +1127,46 @@ boost::optional<GPlatesAppLogic::ReconstructionGeometry::non_null_ptr_type>
 GPlatesAppLogic::TopologyInternalUtils::find_topological_reconstruction_geometry(
 		const GPlatesPropertyValues::GpmlPropertyDelegate &geometry_delegate,
 		const double &reconstruction_time,
-		boost::optional<const std::vector<ReconstructHandle::type> &> reconstruct_handles)
+		boost::optional<const std::vector<ReconstructHandle::type> &> reconstruct_handles,
+		boost::optional<const TopologicalSectionIndex &> topological_section_index)
 {
+	// Create a property name from the target_propery.
+	const QString property_name_qstring = GPlatesUtils::make_qstring_from_icu_string(
+			geometry_delegate.target_property().get_name());
+	const GPlatesModel::PropertyName property_name = GPlatesModel::PropertyName::create_gpml(
+			property_name_qstring);
+
+	// If we've been given an index of the topological section RGs then look up the RGs directly
+	// (instead of finding all features with the delegate feature id and visiting their observers).
+	if (topological_section_index)
+	{
+		std::vector<ReconstructionGeometry::non_null_ptr_type> found_rgs;
+		topological_section_index->find(
+				found_rgs,
+				geometry_delegate.feature_id(),
+				property_name,
+				reconstruct_handles);
+
+		// The features referenced by the found RGs (only used for diagnostics).
+		std::vector<GPlatesModel::FeatureHandle::weak_ref> found_features;
+		BOOST_FOREACH(const ReconstructionGeometry::non_null_ptr_type &found_rg, found_rgs)
+		{
+			boost::optional<GPlatesModel::FeatureHandle::weak_ref> found_feature =
+					ReconstructionGeometryUtils::get_feature_ref(found_rg);
+			if (found_feature &&
+				std::find(found_features.begin(), found_features.end(), found_feature.get()) == found_features.end())
+			{
+				found_features.push_back(found_feature.get());
+			}
+		}
+
+		return ::find_topological_section_reconstruction_geometry(
+				found_rgs,
+				found_features,
+				property_name,
+				reconstruction_time);
+	}
+
 	// Find all features with the feature id specified by the geometry delegate.
 	// Typically there should be only one feature since it's not generally a good idea to
 	// load multiple features with the same feature id into GPlates because both features
@@ -1159,12 +1198,6 @@ GPlatesAppLogic::TopologyInternalUtils::find_topological_reconstruction_geometry
 		return boost::none;
 	}
 
-	// Create a property name from the target_propery.
-	const QString property_name_qstring = GPlatesUtils::make_qstring_from_icu_string(
-			geometry_delegate.target_property().get_name());
-	const GPlatesModel::PropertyName property_name = GPlatesModel::PropertyName::create_gpml(
-			property_name_qstring);
-
 	// Find all the reconstruction geometries that reference the resolved features, and that
 	// are restricted by the reconstruct handles.
 	std::vector<ReconstructionGeometry::non_null_ptr_type> found_rgs;
@@ -55,6 +55,7 @@
 namespace GPlatesAppLogic
 {
 	class ReconstructionTree;
+	class TopologicalSectionIndex;
 
 	/**
 	 * This namespace contains utilities that are used internally in topology-related code.
@@ -249,6 +250,12 @@ namespace GPlatesAppLogic
 		 * - the same delegate feature is reconstructed more than once in different reconstruction
 		 *   contexts (eg, multiple layers reconstructing the same feature).
 		 *
+		 * If @a topological_section_index is specified then the RGs are looked up in that index
+		 * (by the delegate feature id) instead of visiting the weak observers of every feature with
+		 * the delegate feature id. Only RGs in the index can then be found, so the index should
+		 * contain all RGs that can be used as topological sections (in which case the result is
+		 * the same as not specifying the index).
+		 *
 		 * WARNING: Property delegates need to be improved because they do not uniquely
 		 * identify a property since they use the property name and a feature can
 		 * have multiple properties with the same name. Alternatively we could just reference
@@ -258,7 +265,8 @@ namespace GPlatesAppLogic
 		find_topological_reconstruction_geometry(
 				const GPlatesPropertyValues::GpmlPropertyDelegate &geometry_delegate,
 				const double &reconstruction_time,
-				boost::optional<const std::vector<ReconstructHandle::type> &> reconstruct_handles = boost::none);
+				boost::optional<const std::vector<ReconstructHandle::type> &> reconstruct_handles = boost::none,
+				boost::optional<const TopologicalSectionIndex &> topological_section_index = boost::none);
 
 
 		/**
@@ -79,12 +79,16 @@ GPlatesAppLogic::TopologyNetworkResolver::TopologyNetworkResolver(
 		const double &reconstruction_time,
 		ReconstructHandle::type reconstruct_handle,
 		boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-		const TopologyNetworkParams &topology_network_params) :
+		const TopologyNetworkParams &topology_network_params,
+		boost::optional<ResolvedTriangulation::NetworkTriangulationCache &> network_triangulation_cache,
+		boost::optional<const TopologicalSectionIndex &> topological_section_index) :
 	d_resolved_topological_networks(resolved_topological_networks),
 	d_reconstruction_time(reconstruction_time),
 	d_reconstruct_handle(reconstruct_handle),
 	d_topological_geometry_reconstruct_handles(topological_geometry_reconstruct_handles),
-	d_topology_network_params(topology_network_params)
+	d_topology_network_params(topology_network_params),
+	d_network_triangulation_cache(network_triangulation_cache),
+	d_topological_section_index(topological_section_index)
 {  
 }
 
@@ -482,7 +486,8 @@ GPlatesAppLogic::TopologyNetworkResolver::find_topological_reconstruction_geomet
 	return TopologyInternalUtils::find_topological_reconstruction_geometry(
 			geometry_delegate,
 			d_reconstruction_time,
-			topological_geometry_reconstruct_handles);
+			topological_geometry_reconstruct_handles,
+			d_topological_section_index);
 }
 
 
@@ -944,6 +949,13 @@ GPlatesAppLogic::TopologyNetworkResolver::create_resolved_topology_network()
 				d_current_rift_params.edge_length_threshold);
 	}
 
+	// If we have a triangulation cache then get the entry for the current network feature.
+	ResolvedTriangulation::NetworkTriangulationCache::entry_ptr_type triangulation_cache_entry;
+	if (d_network_triangulation_cache)
+	{
+		triangulation_cache_entry = d_network_triangulation_cache->get_entry(*d_currently_visited_feature);
+	}
+
 	// Now that we've gathered all the triangulation information we can create the triangulation network.
 	ResolvedTriangulation::Network::non_null_ptr_type triangulation_network =
 			ResolvedTriangulation::Network::create(
@@ -954,7 +966,8 @@ GPlatesAppLogic::TopologyNetworkResolver::create_resolved_topology_network()
 					rigid_blocks.begin(),
 					rigid_blocks.end(),
 					d_topology_network_params,
-					rift);
+					rift,
+					triangulation_cache_entry);
 
 	// Create the network RTN 
 	const ResolvedTopologicalNetwork::non_null_ptr_type network =
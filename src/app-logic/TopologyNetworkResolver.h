@@ -43,6 +43,7 @@
 #include "ResolvedTopologicalLine.h"
 #include "ResolvedTopologicalNetwork.h"
 #include "ResolvedTriangulationNetwork.h"
+#include "TopologicalSectionIndex.h"
 #include "TopologyIntersections.h"
 #include "TopologyNetworkParams.h"
 
@@ -91,13 +92,19 @@ namespace GPlatesAppLogic
 		 *        resolving the topological networks.
 		 *        This is useful to avoid outdated RFGs and RTGS still in existence (among other scenarios).
 		 * @param topology_network_params parameters used when creating the resolved networks.
+		 * @param network_triangulation_cache optionally lets each network re-use the triangulation
+		 *        of the network most recently triangulated from the same feature.
+		 * @param topological_section_index optionally indexes the topological boundary section and
+		 *        interior reconstruction geometries by feature id (to avoid searching feature observers).
 		 */
 		TopologyNetworkResolver(
 				std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &resolved_topological_networks,
 				const double &reconstruction_time,
 				ReconstructHandle::type reconstruct_handle,
 				boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams());
+				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams(),
+				boost::optional<ResolvedTriangulation::NetworkTriangulationCache &> network_triangulation_cache = boost::none,
+				boost::optional<const TopologicalSectionIndex &> topological_section_index = boost::none);
 
 		virtual
 		~TopologyNetworkResolver() 
@@ -308,6 +315,16 @@ namespace GPlatesAppLogic
 		 */
 		TopologyNetworkParams d_topology_network_params;
 
+		/**
+		 * Optional cache used to re-use triangulations of networks resolved from the same feature.
+		 */
+		boost::optional<ResolvedTriangulation::NetworkTriangulationCache &> d_network_triangulation_cache;
+
+		/**
+		 * Optional index of the topological boundary section and interior reconstruction geometries by feature id.
+		 */
+		boost::optional<const TopologicalSectionIndex &> d_topological_section_index;
+
 		//! The current feature being visited.
 		GPlatesModel::FeatureHandle::weak_ref d_currently_visited_feature;
 
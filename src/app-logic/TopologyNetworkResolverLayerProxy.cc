@@ -35,6 +35,7 @@
 #include "ResolvedTopologicalLine.h"
 #include "ResolvedTopologicalNetwork.h"
 #include "ResolvedVertexSourceInfo.h"
+#include "TopologicalSectionIndex.h"
 #include "TopologyInternalUtils.h"
 #include "TopologyUtils.h"
 
@@ -90,6 +91,28 @@ namespace GPlatesAppLogic
 				}
 			}
 		}
+
+
+		/**
+		 * Returns true if the resolved networks of a time slot are not referenced outside the
+		 * resolved network time span (and hence can be released from it).
+		 */
+		bool
+		are_resolved_networks_releasable(
+				const TopologyReconstruct::rtn_seq_type &resolved_networks)
+		{
+			BOOST_FOREACH(
+					const ResolvedTopologicalNetwork::non_null_ptr_type &resolved_network,
+					resolved_networks)
+			{
+				if (resolved_network->get_reference_count() > 1)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
 	}
 }
 
@@ -506,6 +529,9 @@ GPlatesAppLogic::TopologyNetworkResolverLayerProxy::reset_cache()
 	// Clear any cached resolved topological networks.
 	d_cached_resolved_networks.invalidate();
 	d_cached_time_span.invalidate();
+
+	// Our inputs have changed so don't re-use triangulations of previously resolved networks.
+	d_network_triangulation_cache.clear();
 }
 
 
@@ -676,9 +702,32 @@ GPlatesAppLogic::TopologyNetworkResolverLayerProxy::cache_resolved_network_time_
 	boost::optional<TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_type>
 			prev_resolved_network_time_span = d_cached_time_span.cached_resolved_network_time_span;
 
-	// Create an empty resolved network time span.
+	// The previous time span (if any) has the same inputs and params so we can share its time slot creator.
+	if (!d_cached_time_span.time_slot_creator)
+	{
+		d_cached_time_span.time_slot_creator.reset(
+				new ResolvedNetworkTimeSlotCreator(
+						d_current_topological_network_features,
+						d_dependent_topological_sections,
+						topology_network_params));
+	}
+
+	// Create an empty resolved network time span that resolves each time slot when it's first accessed.
+	//
+	// This avoids resolving (and triangulating) networks at times that are never visited, and
+	// bounds the number of resolved time slots that are resident at any time.
+	// Time slots whose networks are still referenced elsewhere are not released (since that
+	// wouldn't free their memory, and resolving them again would create duplicate networks).
 	d_cached_time_span.cached_resolved_network_time_span =
-			TopologyReconstruct::resolved_network_time_span_type::create(time_range);
+			TopologyReconstruct::resolved_network_time_span_type::create(
+					time_range,
+					boost::bind(
+							&ResolvedNetworkTimeSlotCreator::create_resolved_networks,
+							d_cached_time_span.time_slot_creator,
+							boost::placeholders::_1,
+							boost::placeholders::_2),
+					MAX_NUM_RESIDENT_RESOLVED_NETWORK_TIME_SLOTS,
+					&are_resolved_networks_releasable);
 
 	const unsigned int num_time_slots = time_range.get_num_time_slots();
 
@@ -710,47 +759,72 @@ GPlatesAppLogic::TopologyNetworkResolverLayerProxy::cache_resolved_network_time_
 				->get_current_reconstruction_layer_proxy()->get_reconstruction_tree_creator(num_time_slots + 1);
 	}
 
-	// Iterate over the time slots of the time span and fill in the resolved topological networks.
-	for (unsigned int time_slot = 0; time_slot < num_time_slots; ++time_slot)
+	// Re-use any time slots already resolved in the previous resolved network time span (if any).
+	// The remaining time slots are resolved when first accessed.
+	if (prev_resolved_network_time_span)
 	{
-		const double time = time_range.get_time(time_slot);
+		const TimeSpanUtils::TimeRange prev_time_range = prev_resolved_network_time_span.get()->get_time_range();
 
-		// Attempt to re-use a time slot of the previous resolved network time span (if any).
-		if (prev_resolved_network_time_span)
+		for (unsigned int time_slot = 0; time_slot < num_time_slots; ++time_slot)
 		{
 			// See if the time matches a time slot of the previous resolved network time span.
-			const TimeSpanUtils::TimeRange prev_time_range = prev_resolved_network_time_span.get()->get_time_range();
-			boost::optional<unsigned int> prev_time_slot = prev_time_range.get_time_slot(time);
-			if (prev_time_slot)
+			boost::optional<unsigned int> prev_time_slot = prev_time_range.get_time_slot(time_range.get_time(time_slot));
+			if (!prev_time_slot)
 			{
-				// Get the resolved topological networks from the previous resolved network time span.
-				boost::optional<TopologyReconstruct::rtn_seq_type &> prev_resolved_topological_networks =
-						prev_resolved_network_time_span.get()->get_sample_in_time_slot(prev_time_slot.get());
-				if (prev_resolved_topological_networks)
-				{
-					d_cached_time_span.cached_resolved_network_time_span.get()->set_sample_in_time_slot(
-							prev_resolved_topological_networks.get(),
-							time_slot);
+				continue;
+			}
 
-					// Continue to the next time slot.
-					continue;
-				}
+			// Get the resolved topological networks from the previous resolved network time span
+			// (but only if they've already been resolved).
+			boost::optional<const TopologyReconstruct::rtn_seq_type &> prev_resolved_topological_networks =
+					prev_resolved_network_time_span.get()->get_resident_sample_in_time_slot(prev_time_slot.get());
+			if (prev_resolved_topological_networks)
+			{
+				d_cached_time_span.cached_resolved_network_time_span.get()->set_sample_in_time_slot(
+						prev_resolved_topological_networks.get(),
+						time_slot);
 			}
 		}
-
-		// Create the resolved topological networks for the current time slot.
-		std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> resolved_topological_networks;
-		create_resolved_topological_networks(resolved_topological_networks, topology_network_params, time);
-
-		d_cached_time_span.cached_resolved_network_time_span.get()->set_sample_in_time_slot(
-				resolved_topological_networks,
-				time_slot);
 	}
 
 	return d_cached_time_span.cached_resolved_network_time_span.get();
 }
 
 
+GPlatesAppLogic::TopologyNetworkResolverLayerProxy::ResolvedNetworkTimeSlotCreator::ResolvedNetworkTimeSlotCreator(
+		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_network_features,
+		const DependentTopologicalSectionLayers &dependent_topological_sections,
+		const TopologyNetworkParams &topology_network_params) :
+	d_topological_network_features(topological_network_features),
+	d_topology_network_params(topology_network_params)
+{
+	dependent_topological_sections.get_dependent_topological_section_layers(
+			d_dependent_reconstructed_geometry_topological_sections_layers);
+	dependent_topological_sections.get_dependent_topological_section_layers(
+			d_dependent_resolved_line_topological_sections_layers);
+}
+
+
+boost::optional<GPlatesAppLogic::TopologyReconstruct::rtn_seq_type>
+GPlatesAppLogic::TopologyNetworkResolverLayerProxy::ResolvedNetworkTimeSlotCreator::create_resolved_networks(
+		unsigned int time_slot,
+		const double &time)
+{
+	// Create the resolved topological networks for the time slot.
+	std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> resolved_topological_networks;
+	TopologyNetworkResolverLayerProxy::create_resolved_topological_networks(
+			resolved_topological_networks,
+			d_topological_network_features,
+			d_dependent_reconstructed_geometry_topological_sections_layers,
+			d_dependent_resolved_line_topological_sections_layers,
+			d_topology_network_params,
+			d_network_triangulation_cache,
+			time);
+
+	return resolved_topological_networks;
+}
+
+
 GPlatesAppLogic::ReconstructHandle::type
 GPlatesAppLogic::TopologyNetworkResolverLayerProxy::create_resolved_topological_networks(
 		std::vector<GPlatesAppLogic::ResolvedTopologicalNetwork::non_null_ptr_type> &resolved_topological_networks,
@@ -763,9 +837,30 @@ GPlatesAppLogic::TopologyNetworkResolverLayerProxy::create_resolved_topological_
 	d_dependent_topological_sections.get_dependent_topological_section_layers(dependent_reconstructed_geometry_topological_sections_layers);
 	d_dependent_topological_sections.get_dependent_topological_section_layers(dependent_resolved_line_topological_sections_layers);
 
+	return create_resolved_topological_networks(
+			resolved_topological_networks,
+			d_current_topological_network_features,
+			dependent_reconstructed_geometry_topological_sections_layers,
+			dependent_resolved_line_topological_sections_layers,
+			topology_network_params,
+			d_network_triangulation_cache,
+			reconstruction_time);
+}
+
+
+GPlatesAppLogic::ReconstructHandle::type
+GPlatesAppLogic::TopologyNetworkResolverLayerProxy::create_resolved_topological_networks(
+		std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &resolved_topological_networks,
+		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_network_features,
+		const std::vector<ReconstructLayerProxy::non_null_ptr_type> &dependent_reconstructed_geometry_topological_sections_layers,
+		const std::vector<TopologyGeometryResolverLayerProxy::non_null_ptr_type> &dependent_resolved_line_topological_sections_layers,
+		const TopologyNetworkParams &topology_network_params,
+		ResolvedTriangulation::NetworkTriangulationCache &network_triangulation_cache,
+		const double &reconstruction_time)
+{
 	// If we have no topological network features or there are no topological section layers then we
 	// can't get any topological sections and we can't resolve any topological networks.
-	if (d_current_topological_network_features.empty() ||
+	if (topological_network_features.empty() ||
 		(dependent_reconstructed_geometry_topological_sections_layers.empty() &&
 			dependent_resolved_line_topological_sections_layers.empty()))
 	{
@@ -786,7 +881,7 @@ GPlatesAppLogic::TopologyNetworkResolverLayerProxy::create_resolved_topological_
 	std::set<GPlatesModel::FeatureId> topological_sections_referenced;
 	TopologyInternalUtils::find_topological_sections_referenced(
 			topological_sections_referenced,
-			d_current_topological_network_features,
+			topological_network_features,
 			TopologyGeometry::NETWORK,
 			reconstruction_time);
 
@@ -836,13 +931,24 @@ GPlatesAppLogic::TopologyNetworkResolverLayerProxy::create_resolved_topological_
 		topological_geometry_reconstruct_handles.push_back(reconstruct_handle);
 	}
 
+	// Index the topological sections by feature ID so that resolving each network boundary section
+	// (and interior) is a hash lookup (rather than a search through the observers of each section feature).
+	TopologicalSectionIndex topological_section_index(
+			topologically_referenced_reconstructed_geometries.begin(),
+			topologically_referenced_reconstructed_geometries.end());
+	topological_section_index.add(
+			topologically_referenced_resolved_lines.begin(),
+			topologically_referenced_resolved_lines.end());
+
 	// Resolve our network features into our sequence of resolved topological networks.
 	return TopologyUtils::resolve_topological_networks(
 			resolved_topological_networks,
 			reconstruction_time,
-			d_current_topological_network_features,
+			topological_network_features,
 			topological_geometry_reconstruct_handles,
-			topology_network_params);
+			topology_network_params,
+			network_triangulation_cache,
+			topological_section_index);
 }
 
 
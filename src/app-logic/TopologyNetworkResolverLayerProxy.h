@@ -28,7 +28,9 @@
 #define GPLATES_APP_LOGIC_TOPOLOGYNETWORKRESOLVERLAYERPROXY_H
 
 #include <vector>
+#include <boost/noncopyable.hpp>
 #include <boost/optional.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include "DependentTopologicalSectionLayers.h"
 #include "LayerProxy.h"
@@ -38,6 +40,7 @@
 #include "ReconstructionLayerProxy.h"
 #include "ReconstructLayerProxy.h"
 #include "ResolvedTopologicalNetwork.h"
+#include "ResolvedTriangulationNetwork.h"
 #include "TopologyGeometryResolverLayerProxy.h"
 #include "TopologyNetworkParams.h"
 #include "TopologyReconstruct.h"
@@ -67,6 +70,16 @@ namespace GPlatesAppLogic
 		typedef GPlatesUtils::non_null_intrusive_ptr<const TopologyNetworkResolverLayerProxy> non_null_ptr_to_const_type;
 
 
+		/**
+		 * The maximum number of time slots of resolved networks that a resolved network time span
+		 * (see @a get_resolved_network_time_span) keeps resident at any time.
+		 *
+		 * Time slots are resolved on demand and, beyond this limit, the least recently accessed
+		 * time slot is released (and resolved again if it is accessed again).
+		 */
+		static const unsigned int MAX_NUM_RESIDENT_RESOLVED_NETWORK_TIME_SLOTS = 256;
+
+
 		/**
 		 * Creates a @a TopologyNetworkResolverLayerProxy object.
 		 */
@@ -158,6 +171,10 @@ namespace GPlatesAppLogic
 		 * @a get_resolved_topological_networks over a sequence of reconstruction times because
 		 * a separate resolved network would unnecessarily be created for each client - whereas,
 		 * with this method, a single time range of resolved networks would be shared by all clients.
+		 *
+		 * Note that the networks in each time slot are only resolved when that time slot is first
+		 * accessed (and at most @a MAX_NUM_RESIDENT_RESOLVED_NETWORK_TIME_SLOTS time slots are resident),
+		 * so returning the time span is cheap and only the times actually visited incur a cost.
 		 */
 		TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_to_const_type
 		get_resolved_network_time_span(
@@ -452,6 +469,38 @@ namespace GPlatesAppLogic
 					cached_resolved_topological_network_velocities;
 		};
 
+		/**
+		 * Resolves the topological networks of a time slot when a resolved network time span
+		 * first accesses that time slot.
+		 *
+		 * This keeps its own copy of the inputs (network features and topological section layers)
+		 * current when it was created, rather than referencing us, so that time spans still held by
+		 * clients (after our cached time span is invalidated, or we are destroyed) can continue to
+		 * resolve their remaining time slots.
+		 */
+		class ResolvedNetworkTimeSlotCreator :
+				private boost::noncopyable
+		{
+		public:
+
+			ResolvedNetworkTimeSlotCreator(
+					const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_network_features,
+					const DependentTopologicalSectionLayers &dependent_topological_sections,
+					const TopologyNetworkParams &topology_network_params);
+
+			boost::optional<TopologyReconstruct::rtn_seq_type>
+			create_resolved_networks(
+					unsigned int time_slot,
+					const double &time);
+
+		private:
+			std::vector<GPlatesModel::FeatureHandle::weak_ref> d_topological_network_features;
+			std::vector<ReconstructLayerProxy::non_null_ptr_type> d_dependent_reconstructed_geometry_topological_sections_layers;
+			std::vector<TopologyGeometryResolverLayerProxy::non_null_ptr_type> d_dependent_resolved_line_topological_sections_layers;
+			TopologyNetworkParams d_topology_network_params;
+			ResolvedTriangulation::NetworkTriangulationCache d_network_triangulation_cache;
+		};
+
 		/**
 		 * Contains resolved topological network time span.
 		 */
@@ -460,6 +509,7 @@ namespace GPlatesAppLogic
 			void
 			invalidate()
 			{
+				time_slot_creator.reset();
 				cached_resolved_network_time_span = boost::none;
 				cached_topology_network_params = boost::none;
 			}
@@ -470,6 +520,13 @@ namespace GPlatesAppLogic
 			boost::optional<TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_type>
 					cached_resolved_network_time_span;
 
+			/**
+			 * Lazily resolves the time slots of the cached time span.
+			 *
+			 * Shared by time spans with different time ranges but the same inputs and params.
+			 */
+			boost::shared_ptr<ResolvedNetworkTimeSlotCreator> time_slot_creator;
+
 			/**
 			 * The cached topology network parameters associated with the cache resolved topological network time span.
 			 */
@@ -524,6 +581,12 @@ namespace GPlatesAppLogic
 		 */
 		ResolvedNetworkTimeSpan d_cached_time_span;
 
+		/**
+		 * Lets networks re-use the triangulation of the network most recently triangulated from the same
+		 * feature (typically at an adjacent time) instead of triangulating from scratch.
+		 */
+		ResolvedTriangulation::NetworkTriangulationCache d_network_triangulation_cache;
+
 		/**
 		 * The cached resolved networks (including time spans) depend on these topological sections.
 		 */
@@ -568,6 +631,8 @@ namespace GPlatesAppLogic
 
 		/**
 		 * Generates a resolved network time span for the specified time range if one is not already cached.
+		 *
+		 * The time slots are not resolved here - they're resolved when first accessed.
 		 */
 		TopologyReconstruct::resolved_network_time_span_type::non_null_ptr_to_const_type
 		cache_resolved_network_time_span(
@@ -584,6 +649,21 @@ namespace GPlatesAppLogic
 				const TopologyNetworkParams &topology_network_params,
 				const double &reconstruction_time);
 
+		/**
+		 * Creates resolved topological networks, from the specified network features and topological
+		 * section layers, for the specified reconstruction time.
+		 */
+		static
+		ReconstructHandle::type
+		create_resolved_topological_networks(
+				std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &resolved_topological_networks,
+				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_network_features,
+				const std::vector<ReconstructLayerProxy::non_null_ptr_type> &dependent_reconstructed_geometry_topological_sections_layers,
+				const std::vector<TopologyGeometryResolverLayerProxy::non_null_ptr_type> &dependent_resolved_line_topological_sections_layers,
+				const TopologyNetworkParams &topology_network_params,
+				ResolvedTriangulation::NetworkTriangulationCache &network_triangulation_cache,
+				const double &reconstruction_time);
+
 		/**
 		 * Creates resolved topological network velocities for the specified reconstruction time.
 		 */
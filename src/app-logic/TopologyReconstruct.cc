@@ -1489,6 +1489,14 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::initialise_deformation_t
 	boost::optional<GeometrySample::non_null_ptr_type &> most_recent_geometry_sample =
 			d_time_window_span->get_sample_in_time_slot(0);
 
+	// The points (of the current geometry sample) whose strains need accumulating are gathered into
+	// contiguous arrays so that their strains can be accumulated in a single batch.
+	// These are declared outside the time loop to avoid re-allocating for each time slot.
+	std::vector<GeometryPoint *> accumulate_geometry_points;
+	std::vector<DeformationStrain> accumulate_strains_batch;
+	std::vector<DeformationStrainRate> accumulate_most_recent_strain_rates;
+	std::vector<DeformationStrainRate> accumulate_current_strain_rates;
+
 	// Iterate over the time range going *forward* in time from the beginning of the
 	// time range (least recent) to the end (most recent).
 	for (unsigned int time_slot = 1; time_slot < num_time_slots; ++time_slot)
@@ -1519,6 +1527,11 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::initialise_deformation_t
 						most_recent_geometry_points.size() == num_geometry_points,
 						GPLATES_ASSERTION_SOURCE);
 
+			accumulate_geometry_points.clear();
+			accumulate_strains_batch.clear();
+			accumulate_most_recent_strain_rates.clear();
+			accumulate_current_strain_rates.clear();
+
 			// Iterate over the most recent and current geometry sample points.
 			for (unsigned int point_index = 0; point_index < num_geometry_points; ++point_index)
 			{
@@ -1558,14 +1571,12 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::initialise_deformation_t
 						current_strain_rate = *current_geometry_point->strain_rate;
 					}
 
-					// Compute new strain for the current geometry point using the strain at the
-					// most recent point and the strain rate at the current sample.
-					const DeformationStrain current_strain = accumulate_strain(
-							most_recent_strain,
-							most_recent_strain_rate,
-							current_strain_rate,
-							time_increment_in_seconds);
-					current_geometry_point->strain = d_pool_allocator->deformation_strain_pool.construct(current_strain);
+					// The new strain for the current geometry point is computed (below) using the strain
+					// at the most recent point and the strain rate at the current sample.
+					accumulate_geometry_points.push_back(current_geometry_point);
+					accumulate_strains_batch.push_back(most_recent_strain);
+					accumulate_most_recent_strain_rates.push_back(most_recent_strain_rate);
+					accumulate_current_strain_rates.push_back(current_strain_rate);
 				}
 				else
 				{
@@ -1580,6 +1591,24 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::initialise_deformation_t
 					// ...else leave current strain as NULL.
 				}
 			}
+
+			const unsigned int num_accumulate_geometry_points = accumulate_geometry_points.size();
+			if (num_accumulate_geometry_points > 0)
+			{
+				// Accumulate the strains of the gathered points (in place).
+				accumulate_strains(
+						&accumulate_strains_batch[0],
+						&accumulate_most_recent_strain_rates[0],
+						&accumulate_current_strain_rates[0],
+						num_accumulate_geometry_points,
+						time_increment_in_seconds);
+
+				for (unsigned int n = 0; n < num_accumulate_geometry_points; ++n)
+				{
+					accumulate_geometry_points[n]->strain =
+							d_pool_allocator->deformation_strain_pool.construct(accumulate_strains_batch[n]);
+				}
+			}
 		}
 		else
 		{
@@ -2428,6 +2457,12 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::interpolate_geometry_sam
 	// This is an optimisation since many points can be inside the same resolved boundary.
 	plate_id_to_stage_rotation_map_type resolved_boundary_stage_rotation_map;
 
+	// The points whose strains are interpolated (between initial and final strains) are gathered into
+	// contiguous arrays so that their strains can be interpolated in a single batch.
+	std::vector<GeometryPoint *> interpolate_strains_geometry_points;
+	std::vector<DeformationStrain> interpolate_initial_strains;
+	std::vector<DeformationStrain> interpolate_final_strains;
+
 	for (unsigned int geometry_point_index = 0; geometry_point_index < num_geometry_points; ++geometry_point_index)
 	{
 		GeometryPoint *initial_geometry_point = (*initial_geometry_points)[geometry_point_index];
@@ -2567,13 +2602,10 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::interpolate_geometry_sam
 					if (initial_geometry_point->strain &&
 						final_geometry_point->strain)
 					{
-						const DeformationStrain interpolated_strain =
-								interpolate_strain(
-										*initial_geometry_point->strain,
-										*final_geometry_point->strain,
-										interpolate_initial_to_final_position);
-
-						interpolated_geometry_point->strain = pool_allocator->deformation_strain_pool.construct(interpolated_strain);
+						// The strain is interpolated (below) along with the other gathered points.
+						interpolate_strains_geometry_points.push_back(interpolated_geometry_point);
+						interpolate_initial_strains.push_back(*initial_geometry_point->strain);
+						interpolate_final_strains.push_back(*final_geometry_point->strain);
 					}
 					else if (initial_geometry_point->strain)
 					{
@@ -2619,6 +2651,23 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::interpolate_geometry_sam
 		interpolated_geometry_points[geometry_point_index] = interpolated_geometry_point;
 	}
 
+	if (!interpolate_strains_geometry_points.empty())
+	{
+		// Interpolate the strains of the gathered points (the initial strains are replaced in place).
+		interpolate_strains(
+				&interpolate_initial_strains[0],
+				&interpolate_initial_strains[0],
+				&interpolate_final_strains[0],
+				interpolate_strains_geometry_points.size(),
+				interpolate_initial_to_final_position);
+
+		for (unsigned int n = 0; n < interpolate_strains_geometry_points.size(); ++n)
+		{
+			interpolate_strains_geometry_points[n]->strain =
+					pool_allocator->deformation_strain_pool.construct(interpolate_initial_strains[n]);
+		}
+	}
+
 	return GeometrySample::create_swap(interpolated_geometry_points, pool_allocator);
 }
 
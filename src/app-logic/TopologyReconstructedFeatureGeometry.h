@@ -98,6 +98,20 @@ namespace GPlatesAppLogic
 		}
 
 
+		/**
+		 * Create a copy of this @a TopologyReconstructedFeatureGeometry that has the specified reconstruct handle.
+		 *
+		 * This overrides the base class @a ReconstructedFeatureGeometry method.
+		 */
+		virtual
+		const ReconstructedFeatureGeometry::non_null_ptr_type
+		clone_with_reconstruct_handle(
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) const
+		{
+			return ReconstructedFeatureGeometry::non_null_ptr_type(new TopologyReconstructedFeatureGeometry(*this, reconstruct_handle_));
+		}
+
+
 		/**
 		 * Returns the reconstructed geometry.
 		 *
@@ -245,6 +259,13 @@ namespace GPlatesAppLogic
 			d_topology_reconstruct_geometry_time_span(topology_reconstruct_geometry_time_span)
 		{  }
 
+		TopologyReconstructedFeatureGeometry(
+				const TopologyReconstructedFeatureGeometry &other,
+				boost::optional<ReconstructHandle::type> reconstruct_handle_) :
+			ReconstructedFeatureGeometry(other, reconstruct_handle_),
+			d_topology_reconstruct_geometry_time_span(other.d_topology_reconstruct_geometry_time_span)
+		{  }
+
 	};
 }
 
@@ -1497,7 +1497,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
 		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
-		boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced)
+		boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced,
+		boost::optional<const TopologicalSectionIndex &> topological_section_index)
 {
 	PROFILE_FUNC();
 
@@ -1510,7 +1511,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
 			reconstruct_handle,
 			reconstruction_tree_creator,
 			reconstruction_time,
-			topological_sections_reconstruct_handles);
+			topological_sections_reconstruct_handles,
+			topological_section_index);
 
 	for (auto feature_collection : topological_line_features_collection)
 	{
@@ -1548,7 +1550,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
 		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
-		boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced)
+		boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced,
+		boost::optional<const TopologicalSectionIndex &> topological_section_index)
 {
 	PROFILE_FUNC();
 
@@ -1561,7 +1564,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
 			reconstruct_handle,
 			reconstruction_tree_creator,
 			reconstruction_time,
-			topological_sections_reconstruct_handles);
+			topological_sections_reconstruct_handles,
+			topological_section_index);
 
 	for (auto feature_ref : topological_line_features)
 	{
@@ -1635,7 +1639,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_boundaries(
 		const std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> &topological_closed_plate_polygon_features_collection,
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
-		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles)
+		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+		boost::optional<const TopologicalSectionIndex &> topological_section_index)
 {
 	PROFILE_FUNC();
 
@@ -1648,7 +1653,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_boundaries(
 			reconstruct_handle,
 			reconstruction_tree_creator,
 			reconstruction_time,
-			topological_sections_reconstruct_handles);
+			topological_sections_reconstruct_handles,
+			topological_section_index);
 
 	AppLogicUtils::visit_feature_collections(
 			topological_closed_plate_polygon_features_collection.begin(),
@@ -1665,7 +1671,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_boundaries(
 		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_closed_plate_polygon_features,
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
-		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles)
+		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+		boost::optional<const TopologicalSectionIndex &> topological_section_index)
 {
 	PROFILE_FUNC();
 
@@ -1678,7 +1685,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_boundaries(
 			reconstruct_handle,
 			reconstruction_tree_creator,
 			reconstruction_time,
-			topological_sections_reconstruct_handles);
+			topological_sections_reconstruct_handles,
+			topological_section_index);
 
 	AppLogicUtils::visit_features(
 			topological_closed_plate_polygon_features.begin(),
@@ -1739,7 +1747,9 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_networks(
 		const double &reconstruction_time,
 		const std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> &topological_network_features_collection,
 		boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-		const TopologyNetworkParams &topology_network_params)
+		const TopologyNetworkParams &topology_network_params,
+		boost::optional<ResolvedTriangulation::NetworkTriangulationCache &> network_triangulation_cache,
+		boost::optional<const TopologicalSectionIndex &> topological_section_index)
 {
 	PROFILE_FUNC();
 
@@ -1752,7 +1762,9 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_networks(
 			reconstruction_time,
 			reconstruct_handle,
 			topological_geometry_reconstruct_handles,
-			topology_network_params);
+			topology_network_params,
+			network_triangulation_cache,
+			topological_section_index);
 
 	AppLogicUtils::visit_feature_collections(
 			topological_network_features_collection.begin(),
@@ -1769,7 +1781,9 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_networks(
 		const double &reconstruction_time,
 		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_network_features,
 		boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-		const TopologyNetworkParams &topology_network_params)
+		const TopologyNetworkParams &topology_network_params,
+		boost::optional<ResolvedTriangulation::NetworkTriangulationCache &> network_triangulation_cache,
+		boost::optional<const TopologicalSectionIndex &> topological_section_index)
 {
 	PROFILE_FUNC();
 
@@ -1782,7 +1796,9 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_networks(
 			reconstruction_time,
 			reconstruct_handle,
 			topological_geometry_reconstruct_handles,
-			topology_network_params);
+			topology_network_params,
+			network_triangulation_cache,
+			topological_section_index);
 
 	AppLogicUtils::visit_features(
 			topological_network_features.begin(),
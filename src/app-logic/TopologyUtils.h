@@ -63,6 +63,7 @@ namespace GPlatesAppLogic
 {
 	class ResolvedTopologicalBoundary;
 	class ResolvedTopologicalLine;
+	class TopologicalSectionIndex;
 
 	/**
 	 * This namespace contains utilities that clients of topology-related functionality use.
@@ -126,6 +127,9 @@ namespace GPlatesAppLogic
 		 * @param topological_lines_referenced Only resolved those topological line features matching
 		 *        the specified feature IDs. This is useful when subsequently resolving boundaries/networks
 		 *        that reference a subset of the topological line features specified.
+		 * @param topological_section_index optionally indexes the topological section RGs by feature id
+		 *        (instead of searching the observers of each topological section feature).
+		 *        This should contain all RGs that can be used as topological sections.
 		 *
 		 * The returned reconstruct handle can be used to identify the resolved topological lines
 		 * when resolving topological *boundaries* (since they can reference resolved *lines*).
@@ -137,7 +141,8 @@ namespace GPlatesAppLogic
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
 				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none,
-				boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced = boost::none);
+				boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced = boost::none,
+				boost::optional<const TopologicalSectionIndex &> topological_section_index = boost::none);
 
 		/**
 		 * An overload of @a resolve_topological_lines accepting a vector of features instead of a feature collection.
@@ -149,7 +154,8 @@ namespace GPlatesAppLogic
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
 				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none,
-				boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced = boost::none);
+				boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced = boost::none,
+				boost::optional<const TopologicalSectionIndex &> topological_section_index = boost::none);
 
 
 		/**
@@ -181,6 +187,9 @@ namespace GPlatesAppLogic
 		 *        observing the topological section features,
 		 *        that should be searched when resolving the topological boundaries.
 		 *        This is useful to avoid outdated RFGs and RTGS still in existence (among other scenarios).
+		 * @param topological_section_index optionally indexes the topological section RGs by feature id
+		 *        (instead of searching the observers of each topological section feature).
+		 *        This should contain all RGs that can be used as topological sections.
 		 *
 		 * The returned reconstruct handle can be used to identify the resolved topological boundaries.
 		 * This is not currently used though.
@@ -191,7 +200,8 @@ namespace GPlatesAppLogic
 				const std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> &topological_closed_plate_polygon_features_collection,
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
-				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none);
+				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none,
+				boost::optional<const TopologicalSectionIndex &> topological_section_index = boost::none);
 
 		/**
 		 * An overload of @a resolve_topological_boundaries accepting a vector of features instead of a feature collection.
@@ -202,7 +212,8 @@ namespace GPlatesAppLogic
 				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_closed_plate_polygon_features,
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
-				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none);
+				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none,
+				boost::optional<const TopologicalSectionIndex &> topological_section_index = boost::none);
 
 
 		/**
@@ -236,6 +247,11 @@ namespace GPlatesAppLogic
 		 *        that should be searched when resolving the topological networks.
 		 *        This is useful to avoid outdated RFGs and RTGS still in existence (among other scenarios).
 		 * @param topology_network_params parameters used when creating the resolved networks.
+		 * @param network_triangulation_cache optionally lets each network re-use the triangulation
+		 *        of the network most recently triangulated from the same feature (eg, at a previous time).
+		 * @param topological_section_index optionally indexes the topological section RGs by feature id
+		 *        (instead of searching the observers of each topological section feature).
+		 *        This should contain all RGs that can be used as topological sections.
 		 *
 		 * The returned reconstruct handle can be used to identify the resolved topological networks.
 		 * This is not currently used though.
@@ -246,7 +262,9 @@ namespace GPlatesAppLogic
 				const double &reconstruction_time,
 				const std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> &topological_network_features_collection,
 				boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams());
+				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams(),
+				boost::optional<ResolvedTriangulation::NetworkTriangulationCache &> network_triangulation_cache = boost::none,
+				boost::optional<const TopologicalSectionIndex &> topological_section_index = boost::none);
 
 		/**
 		 * An overload of @a resolve_topological_networks accepting a vector of features instead of a feature collection.
@@ -257,7 +275,9 @@ namespace GPlatesAppLogic
 				const double &reconstruction_time,
 				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_network_features,
 				boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams());
+				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams(),
+				boost::optional<ResolvedTriangulation::NetworkTriangulationCache &> network_triangulation_cache = boost::none,
+				boost::optional<const TopologicalSectionIndex &> topological_section_index = boost::none);
 
 
 		/**
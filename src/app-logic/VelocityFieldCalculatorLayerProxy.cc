@@ -309,6 +309,7 @@ GPlatesAppLogic::VelocityFieldCalculatorLayerProxy::reset_cache()
 {
 	// Clear any cached velocity info for any reconstruction times and velocity params.
 	d_cached_velocities.clear();
+	d_static_polygon_partition_cache.clear();
 }
 
 
@@ -521,7 +522,8 @@ GPlatesAppLogic::VelocityFieldCalculatorLayerProxy::cache_velocities(
 				surface_resolved_topological_networks,
 				velocity_params.get_delta_time(),
 				velocity_params.get_delta_time_type(),
-				velocity_smoothing_options);
+				velocity_smoothing_options,
+				d_static_polygon_partition_cache);
 	}
 	else
 	{
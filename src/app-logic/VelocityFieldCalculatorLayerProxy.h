@@ -33,6 +33,7 @@
 #include "LayerProxy.h"
 #include "LayerProxyUtils.h"
 #include "MultiPointVectorField.h"
+#include "PlateVelocityUtils.h"
 #include "ReconstructionLayerProxy.h"
 #include "ReconstructLayerProxy.h"
 #include "TopologyGeometryResolverLayerProxy.h"
@@ -387,6 +388,13 @@ namespace GPlatesAppLogic
 		 */
 		velocity_cache_type d_cached_velocities;
 
+		/**
+		 * The partition of domain points into static polygon surfaces from the most recent
+		 * velocity solve - it's reused (across reconstruction times and velocity params) to only
+		 * test domain points against the static polygons that have moved relative to them.
+		 */
+		PlateVelocityUtils::StaticPolygonPartitionCache d_static_polygon_partition_cache;
+
 		/**
 		 * Used to notify polling observers that we've been updated.
 		 */
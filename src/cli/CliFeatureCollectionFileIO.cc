@@ -103,6 +103,7 @@ namespace
 
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_GPML = "gpml";
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_GPMLZ = "compressed-gpml";
+const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_GPMLB = "binary-gpml";
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_PLATES_LINE = "plates4-line";
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_PLATES_ROTATION = "plates4-rotation";
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_SHAPEFILE = "shapefile";
@@ -326,6 +327,10 @@ GPlatesCli::FeatureCollectionFileIO::get_save_file_format(
 	{
 		return GPlatesFileIO::FeatureCollectionFileFormat::GPMLZ;
 	}
+	else if (save_file_type == SAVE_FILE_TYPE_GPMLB)
+	{
+		return GPlatesFileIO::FeatureCollectionFileFormat::GPMLB;
+	}
 	else if (save_file_type == SAVE_FILE_TYPE_PLATES_LINE)
 	{
 		return GPlatesFileIO::FeatureCollectionFileFormat::PLATES4_LINE;
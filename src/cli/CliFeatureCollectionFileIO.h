@@ -118,6 +118,7 @@ namespace GPlatesCli
 		//
 		static const std::string SAVE_FILE_TYPE_GPML;
 		static const std::string SAVE_FILE_TYPE_GPMLZ;
+		static const std::string SAVE_FILE_TYPE_GPMLB;
 		static const std::string SAVE_FILE_TYPE_PLATES_LINE;
 		static const std::string SAVE_FILE_TYPE_PLATES_ROTATION;
 		static const std::string SAVE_FILE_TYPE_SHAPEFILE;
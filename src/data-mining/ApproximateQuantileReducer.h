@@ -0,0 +1,114 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATESDATAMINING_APPROXIMATEQUANTILEREDUCER_H
+#define GPLATESDATAMINING_APPROXIMATEQUANTILEREDUCER_H
+
+#include <boost/optional.hpp>
+#include <boost/variant.hpp>
+
+#include "CoRegReducer.h"
+#include "OpaqueDataToDouble.h"
+#include "QuantileDigest.h"
+
+namespace GPlatesDataMining
+{
+	/**
+	 * Estimates a quantile (such as the median) of the numerical input values in bounded memory.
+	 *
+	 * Unlike @a MedianReducer the input values are not copied - they are streamed into a @a QuantileDigest.
+	 */
+	class ApproximateQuantileReducer : public CoRegReducer
+	{
+	public:
+
+		/**
+		 * @a quantile is in the range [0,1] (eg, 0.5 for the median).
+		 *
+		 * Higher @a compression is more accurate but uses more memory (see @a QuantileDigest).
+		 */
+		explicit
+		ApproximateQuantileReducer(
+				const double &quantile,
+				unsigned int compression = QuantileDigest::DEFAULT_COMPRESSION) :
+			d_quantile(quantile),
+			d_compression(compression)
+		{  }
+
+		bool
+		supports_batches() const
+		{
+			return true;
+		}
+
+		void
+		begin_batches()
+		{
+			d_digest = QuantileDigest(d_compression);
+		}
+
+		void
+		process_batch(
+				ReducerInDataset::const_iterator input_begin,
+				ReducerInDataset::const_iterator input_end)
+		{
+			for ( ; input_begin != input_end; ++input_begin)
+			{
+				if (boost::optional<double> value = 
+					boost::apply_visitor(ConvertOpaqueDataToDouble(), boost::get<0>(*input_begin)))
+				{
+					d_digest->add(*value);
+				}
+			}
+		}
+
+		OpaqueData
+		end_batches()
+		{
+			QuantileDigest digest = d_digest.get();
+			d_digest = boost::none;
+
+			if (digest.empty())
+			{
+				return EmptyData;
+			}
+
+			return OpaqueData(digest.get_quantile(d_quantile));
+		}
+
+	protected:
+		OpaqueData
+		exec(
+				ReducerInDataset::const_iterator input_begin,
+				ReducerInDataset::const_iterator input_end) 
+		{
+			begin_batches();
+			process_batch(input_begin, input_end);
+			return end_batches();
+		}
+
+	private:
+		double d_quantile;
+		unsigned int d_compression;
+
+		//! The values reduced since @a begin_batches.
+		boost::optional<QuantileDigest> d_digest;
+	};
+}
+#endif
@@ -0,0 +1,110 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATESDATAMINING_APPROXIMATEVOTEREDUCER_H
+#define GPLATESDATAMINING_APPROXIMATEVOTEREDUCER_H
+
+#include <boost/optional.hpp>
+#include <boost/variant.hpp>
+#include <QString>
+
+#include "CoRegReducer.h"
+#include "FrequentValueSummary.h"
+#include "OpaqueDataToQString.h"
+
+namespace GPlatesDataMining
+{
+	/**
+	 * Estimates the most frequent input value (as a string) in bounded memory.
+	 *
+	 * Unlike @a VoteReducer the input values are not copied and sorted - they are counted by
+	 * a @a FrequentValueSummary with a bounded number of counters.
+	 */
+	class ApproximateVoteReducer : public CoRegReducer
+	{
+	public:
+
+		/**
+		 * More counters (@a max_num_counters) are more accurate but use more memory (see @a FrequentValueSummary).
+		 */
+		explicit
+		ApproximateVoteReducer(
+				unsigned int max_num_counters = FrequentValueSummary::DEFAULT_MAX_NUM_COUNTERS) :
+			d_max_num_counters(max_num_counters)
+		{  }
+
+		bool
+		supports_batches() const
+		{
+			return true;
+		}
+
+		void
+		begin_batches()
+		{
+			d_summary = FrequentValueSummary(d_max_num_counters);
+		}
+
+		void
+		process_batch(
+				ReducerInDataset::const_iterator input_begin,
+				ReducerInDataset::const_iterator input_end)
+		{
+			for ( ; input_begin != input_end; ++input_begin)
+			{
+				d_summary->add(
+						boost::apply_visitor(
+								ConvertOpaqueDataToString(),
+								boost::get<0>(*input_begin)));
+			}
+		}
+
+		OpaqueData
+		end_batches()
+		{
+			const boost::optional<QString> most_frequent_value = d_summary->get_most_frequent_value();
+			d_summary = boost::none;
+
+			if (!most_frequent_value)
+			{
+				return EmptyData;
+			}
+
+			return OpaqueData(most_frequent_value.get());
+		}
+
+	protected:
+		OpaqueData
+		exec(
+				ReducerInDataset::const_iterator input_begin,
+				ReducerInDataset::const_iterator input_end) 
+		{
+			begin_batches();
+			process_batch(input_begin, input_end);
+			return end_batches();
+		}
+
+	private:
+		unsigned int d_max_num_counters;
+
+		//! The values reduced since @a begin_batches.
+		boost::optional<FrequentValueSummary> d_summary;
+	};
+}
+#endif
@@ -26,6 +26,8 @@
 #include <boost/foreach.hpp>
 
 #include "CoRegConfigurationTable.h"
+#include "FrequentValueSummary.h"
+#include "QuantileDigest.h"
 #include "RegionOfInterestFilter.h"
 
 #include "global/GPlatesAssert.h"
@@ -106,6 +108,8 @@ GPlatesDataMining::ConfigurationTableRow::ConfigurationTableRow() :
 	reducer_type(REDUCER_MIN/*arbitrary*/),
 	raster_level_of_detail(0),
 	raster_fill_polygons(false),
+	approximate_quantile_compression(QuantileDigest::DEFAULT_COMPRESSION),
+	approximate_vote_max_num_counters(FrequentValueSummary::DEFAULT_MAX_NUM_COUNTERS),
 	index(0)
 {
 }
@@ -125,6 +129,8 @@ GPlatesDataMining::ConfigurationTableRow::operator==(
 		reducer_type == rhs.reducer_type	&&
 		raster_level_of_detail == rhs.raster_level_of_detail	&&
 		raster_fill_polygons == rhs.raster_fill_polygons		&&
+		approximate_quantile_compression == rhs.approximate_quantile_compression		&&
+		approximate_vote_max_num_counters == rhs.approximate_vote_max_num_counters	&&
 		index == rhs.index;
 }
 
@@ -190,6 +196,16 @@ GPlatesDataMining::ConfigurationTableRow::transcribe(
 		return scribe.get_transcribe_result();
 	}
 
+	// The approximate reducer accuracies were added later - older projects use the defaults.
+	if (!scribe.transcribe(TRANSCRIBE_SOURCE, approximate_quantile_compression, "approximate_quantile_compression"))
+	{
+		approximate_quantile_compression = QuantileDigest::DEFAULT_COMPRESSION;
+	}
+	if (!scribe.transcribe(TRANSCRIBE_SOURCE, approximate_vote_max_num_counters, "approximate_vote_max_num_counters"))
+	{
+		approximate_vote_max_num_counters = FrequentValueSummary::DEFAULT_MAX_NUM_COUNTERS;
+	}
+
 	return GPlatesScribe::TRANSCRIBE_SUCCESS;
 }
 
@@ -62,6 +62,8 @@ namespace GPlatesDataMining
 		ReducerType reducer_type; //TODO: change to CoRegReducer::config
 		unsigned int raster_level_of_detail; // Only used if target layer is a raster.
 		bool raster_fill_polygons; // Currently only used if target layer is a raster.
+		unsigned int approximate_quantile_compression; // Only used by REDUCER_APPROXIMATE_MEDIAN (see QuantileDigest).
+		unsigned int approximate_vote_max_num_counters; // Only used by REDUCER_APPROXIMATE_VOTE (see FrequentValueSummary).
 		unsigned index;
 
 	private: // Transcribe for sessions/projects...
@@ -23,6 +23,8 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */	
 #include "CoRegFilterMapReduceFactory.h"
+#include "ApproximateQuantileReducer.h"
+#include "ApproximateVoteReducer.h"
 #include "CoRegConfigurationTable.h"
 #include "Types.h"
 #include "LookupReducer.h"
@@ -102,6 +104,12 @@ GPlatesDataMining::CoRegReducerFactory::create(
 
 		case REDUCER_LOOKUP:
 			return new LookupReducer(reconstructed_seed_feature);
+
+		case REDUCER_APPROXIMATE_MEDIAN:
+			return new ApproximateQuantileReducer(0.5, row.approximate_quantile_compression);
+
+		case REDUCER_APPROXIMATE_VOTE:
+			return new ApproximateVoteReducer(row.approximate_vote_max_num_counters);
 		
 		default:
 			break;
@@ -0,0 +1,200 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+#include <boost/foreach.hpp>
+
+#include "CoRegGeometryDistanceCache.h"
+
+#include "maths/FiniteRotation.h"
+#include "maths/GeometryDistance.h"
+
+
+namespace GPlatesDataMining
+{
+	namespace
+	{
+		/**
+		 * Two unit quaternions whose (absolute) dot product is within this of one represent
+		 * rotations that differ by less than about 3e-7 radians (roughly two metres on the Earth's surface)
+		 * which is about the accuracy to which relative rotations can be composed anyway.
+		 */
+		const double RELATIVE_ROTATION_DOT_PRODUCT_EPSILON = 1e-14;
+
+
+		/**
+		 * Returns the rotation of the target geometry relative to the seed geometry.
+		 */
+		GPlatesMaths::UnitQuaternion3D
+		get_relative_rotation(
+				const GPlatesAppLogic::ReconstructedFeatureGeometry::FiniteRotationReconstruction &seed,
+				const GPlatesAppLogic::ReconstructedFeatureGeometry::FiniteRotationReconstruction &target)
+		{
+			return seed.get_reconstruct_method_finite_rotation()->get_finite_rotation().unit_quat().get_inverse() *
+					target.get_reconstruct_method_finite_rotation()->get_finite_rotation().unit_quat();
+		}
+
+
+		bool
+		are_same_rotations(
+				const GPlatesMaths::UnitQuaternion3D &q1,
+				const GPlatesMaths::UnitQuaternion3D &q2)
+		{
+			// Note that 'q' and '-q' represent the same rotation.
+			return std::fabs(dot(q1, q2).dval()) > 1 - RELATIVE_ROTATION_DOT_PRODUCT_EPSILON;
+		}
+
+
+		GPlatesMaths::AngularDistance
+		calculate_minimum_distance(
+				const GPlatesAppLogic::ReconstructedFeatureGeometry &seed,
+				const GPlatesAppLogic::ReconstructedFeatureGeometry &target,
+				const GPlatesMaths::AngularExtent &threshold)
+		{
+			return minimum_distance(
+					*seed.reconstructed_geometry(),
+					*target.reconstructed_geometry(),
+					// If either (or both) geometry is a polygon then the distance will be zero
+					// if the other geometry overlaps its interior...
+					true/*geometry1_interior_is_solid*/,
+					true/*geometry2_interior_is_solid*/,
+					threshold);
+		}
+	}
+}
+
+
+void
+GPlatesDataMining::CoRegGeometryDistanceCache::begin_recording(
+		const std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> &reference_seed_features)
+{
+	d_seed_geometries.clear();
+
+	BOOST_FOREACH(
+			const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reference_seed_feature,
+			reference_seed_features)
+	{
+		BOOST_FOREACH(
+				const GPlatesAppLogic::ReconstructContext::Reconstruction &reference_seed_geom,
+				reference_seed_feature.get_reconstructions())
+		{
+			const boost::optional<GPlatesAppLogic::ReconstructedFeatureGeometry::FiniteRotationReconstruction> &
+					finite_rotation_reconstruction =
+							reference_seed_geom.get_reconstructed_feature_geometry()->finite_rotation_reconstruction();
+			if (!finite_rotation_reconstruction)
+			{
+				continue;
+			}
+
+			const GPlatesAppLogic::ReconstructedFeatureGeometry::geometry_ptr_type &resolved_geometry =
+					finite_rotation_reconstruction->get_resolved_geometry();
+
+			std::pair<seed_geometry_map_type::iterator, bool> inserted = d_seed_geometries.insert(
+					seed_geometry_map_type::value_type(resolved_geometry.get(), SeedGeometry(resolved_geometry)));
+			if (!inserted.second)
+			{
+				// The same seed geometry is in more than one reference seed feature.
+				inserted.first->second.can_record = false;
+			}
+		}
+	}
+
+	d_recording = true;
+	d_recorded = false;
+}
+
+
+void
+GPlatesDataMining::CoRegGeometryDistanceCache::end_recording()
+{
+	d_recording = false;
+	d_recorded = true;
+}
+
+
+GPlatesMaths::AngularDistance
+GPlatesDataMining::CoRegGeometryDistanceCache::get_minimum_distance(
+		const GPlatesAppLogic::ReconstructedFeatureGeometry &seed,
+		const GPlatesAppLogic::ReconstructedFeatureGeometry &target,
+		const GPlatesMaths::AngularExtent &threshold)
+{
+	const boost::optional<GPlatesAppLogic::ReconstructedFeatureGeometry::FiniteRotationReconstruction> &
+			seed_finite_rotation_reconstruction = seed.finite_rotation_reconstruction();
+	const boost::optional<GPlatesAppLogic::ReconstructedFeatureGeometry::FiniteRotationReconstruction> &
+			target_finite_rotation_reconstruction = target.finite_rotation_reconstruction();
+
+	// Distances can only be re-used if both geometries are rigidly rotated.
+	if (!seed_finite_rotation_reconstruction ||
+		!target_finite_rotation_reconstruction)
+	{
+		return calculate_minimum_distance(seed, target, threshold);
+	}
+
+	// Only the map of target distances of a seed geometry is modified while recording
+	// (and only by the thread co-registering the seed) so the map of seed geometries can be searched
+	// without locking.
+	seed_geometry_map_type::iterator seed_geometry_iter =
+			d_seed_geometries.find(seed_finite_rotation_reconstruction->get_resolved_geometry().get());
+	if (seed_geometry_iter == d_seed_geometries.end())
+	{
+		return calculate_minimum_distance(seed, target, threshold);
+	}
+	SeedGeometry &seed_geometry = seed_geometry_iter->second;
+
+	const GPlatesMaths::UnitQuaternion3D relative_rotation =
+			get_relative_rotation(
+					seed_finite_rotation_reconstruction.get(),
+					target_finite_rotation_reconstruction.get());
+
+	const GPlatesAppLogic::ReconstructedFeatureGeometry::geometry_ptr_type &target_resolved_geometry =
+			target_finite_rotation_reconstruction->get_resolved_geometry();
+
+	if (d_recording)
+	{
+		const GPlatesMaths::AngularDistance distance = calculate_minimum_distance(seed, target, threshold);
+
+		if (seed_geometry.can_record)
+		{
+			// Note that, if the target geometry has already been recorded (for a different threshold),
+			// the first recorded distance is kept.
+			seed_geometry.target_distances.insert(
+					target_distance_map_type::value_type(
+							target_resolved_geometry.get(),
+							TargetDistance(target_resolved_geometry, relative_rotation, threshold, distance)));
+		}
+
+		return distance;
+	}
+
+	target_distance_map_type::const_iterator target_distance_iter =
+			seed_geometry.target_distances.find(target_resolved_geometry.get());
+	if (target_distance_iter != seed_geometry.target_distances.end())
+	{
+		const TargetDistance &target_distance = target_distance_iter->second;
+
+		// The distance is the same if the target has not moved relative to the seed.
+		if (target_distance.threshold.get_cosine() == threshold.get_cosine() &&
+			are_same_rotations(target_distance.relative_rotation, relative_rotation))
+		{
+			return target_distance.distance;
+		}
+	}
+
+	return calculate_minimum_distance(seed, target, threshold);
+}
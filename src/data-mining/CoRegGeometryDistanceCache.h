@@ -0,0 +1,171 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATESDATAMINING_COREGGEOMETRYDISTANCECACHE_H
+#define GPLATESDATAMINING_COREGGEOMETRYDISTANCECACHE_H
+
+#include <map>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+#include "app-logic/ReconstructContext.h"
+#include "app-logic/ReconstructedFeatureGeometry.h"
+
+#include "maths/AngularDistance.h"
+#include "maths/AngularExtent.h"
+#include "maths/GeometryOnSphere.h"
+#include "maths/UnitQuaternion3D.h"
+
+
+namespace GPlatesDataMining
+{
+	/**
+	 * Caches distances between seed and target geometries so they can be re-used when
+	 * co-registering a time series (a sequence of reconstruction times).
+	 *
+	 * A seed and target geometry that are each reconstructed by a finite rotation (eg, by plate ID)
+	 * are the same distance apart at any two reconstruction times at which the rotation of the target
+	 * relative to the seed is the same - most notably when both are on the same plate (since then
+	 * the relative rotation is always the identity).
+	 *
+	 * The distances are recorded while finding region-of-interest targets at a reference time and
+	 * then looked up at the other times. Geometries are identified by their *resolved* (unreconstructed)
+	 * geometries, which are shared across reconstruction times (unless the feature is modified).
+	 */
+	class CoRegGeometryDistanceCache :
+			private boost::noncopyable
+	{
+	public:
+
+		CoRegGeometryDistanceCache() :
+			d_recording(false),
+			d_recorded(false)
+		{  }
+
+
+		/**
+		 * Returns true once distances have been recorded (see @a end_recording).
+		 */
+		bool
+		is_recorded() const
+		{
+			return d_recorded;
+		}
+
+
+		/**
+		 * Starts recording distances from the geometries of @a reference_seed_features.
+		 *
+		 * Only distances from these seed geometries are recorded (by @a get_minimum_distance).
+		 *
+		 * NOTE: This must be called on the main thread (it copies feature weak-refs).
+		 */
+		void
+		begin_recording(
+				const std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> &reference_seed_features);
+
+		/**
+		 * Stops recording - subsequent calls to @a get_minimum_distance only look up recorded distances.
+		 */
+		void
+		end_recording();
+
+
+		/**
+		 * Returns the minimum distance between the reconstructed geometries of @a seed and @a target
+		 * (see 'GPlatesMaths::minimum_distance()' - polygon interiors are solid), or
+		 * AngularDistance::PI if the distance exceeds @a threshold.
+		 *
+		 * While recording, the distance is calculated and recorded (if @a seed is a reference seed geometry).
+		 * Otherwise the recorded distance is returned if the relative rotation of @a target and @a seed
+		 * (and @a threshold) matches that recorded, else the distance is calculated.
+		 *
+		 * This can be called concurrently provided that, while recording, each reference seed feature
+		 * is only used by one thread at a time. The reconstructed geometries must also have been prepared
+		 * for concurrent distance queries (see 'DataMiningUtils::prepare_for_concurrent_distance_queries()').
+		 */
+		GPlatesMaths::AngularDistance
+		get_minimum_distance(
+				const GPlatesAppLogic::ReconstructedFeatureGeometry &seed,
+				const GPlatesAppLogic::ReconstructedFeatureGeometry &target,
+				const GPlatesMaths::AngularExtent &threshold);
+
+	private:
+
+		//! The recorded distance to a target geometry.
+		struct TargetDistance
+		{
+			TargetDistance(
+					const GPlatesAppLogic::ReconstructedFeatureGeometry::geometry_ptr_type &target_geometry_,
+					const GPlatesMaths::UnitQuaternion3D &relative_rotation_,
+					const GPlatesMaths::AngularExtent &threshold_,
+					const GPlatesMaths::AngularDistance &distance_) :
+				target_geometry(target_geometry_),
+				relative_rotation(relative_rotation_),
+				threshold(threshold_),
+				distance(distance_)
+			{  }
+
+			//! Keeps the resolved target geometry alive (so its address is not re-used by another geometry).
+			GPlatesAppLogic::ReconstructedFeatureGeometry::geometry_ptr_type target_geometry;
+
+			//! Rotation of the target relative to the seed.
+			GPlatesMaths::UnitQuaternion3D relative_rotation;
+
+			GPlatesMaths::AngularExtent threshold;
+			GPlatesMaths::AngularDistance distance;
+		};
+
+		//! Recorded distances keyed by resolved target geometry.
+		typedef std::map<const GPlatesMaths::GeometryOnSphere *, TargetDistance> target_distance_map_type;
+
+		//! A reference seed geometry.
+		struct SeedGeometry
+		{
+			explicit
+			SeedGeometry(
+					const GPlatesAppLogic::ReconstructedFeatureGeometry::geometry_ptr_type &seed_geometry_) :
+				seed_geometry(seed_geometry_),
+				can_record(true)
+			{  }
+
+			//! Keeps the resolved seed geometry alive (so its address is not re-used by another geometry).
+			GPlatesAppLogic::ReconstructedFeatureGeometry::geometry_ptr_type seed_geometry;
+
+			/**
+			 * False if the same resolved geometry was found in more than one reference seed feature
+			 * (in which case multiple threads could record to it concurrently).
+			 */
+			bool can_record;
+
+			target_distance_map_type target_distances;
+		};
+
+		//! Reference seed geometries keyed by resolved seed geometry.
+		typedef std::map<const GPlatesMaths::GeometryOnSphere *, SeedGeometry> seed_geometry_map_type;
+
+
+		seed_geometry_map_type d_seed_geometries;
+
+		bool d_recording;
+		bool d_recorded;
+	};
+}
+
+#endif // GPLATESDATAMINING_COREGGEOMETRYDISTANCECACHE_H
@@ -71,6 +71,17 @@ namespace GPlatesDataMining
 				MapperOutDataset& output
 		) = 0;
 
+		/**
+		 * Returns true if each input is mapped independently of the other inputs, in which case
+		 * the input can be mapped in batches (with the outputs of the batches concatenated).
+		 */
+		virtual
+		bool
+		supports_batches() const
+		{
+			return true;
+		}
+
 		virtual
 		~CoRegMapper(){}
 	};
@@ -75,6 +75,50 @@ namespace GPlatesDataMining
 				return EmptyData;
 			return exec(first,last);
 		}
+
+		/**
+		 * Returns true if the input can be reduced in batches (using @a begin_batches,
+		 * @a process_batch and @a end_batches) instead of all at once (using @a process).
+		 *
+		 * Such reducers only keep a bounded summary of their input, so the caller need not
+		 * hold the entire input in memory at once.
+		 */
+		virtual
+		bool
+		supports_batches() const
+		{
+			return false;
+		}
+
+		/**
+		 * Starts reducing a new input in batches - only called if @a supports_batches is true.
+		 */
+		virtual
+		void
+		begin_batches()
+		{  }
+
+		/**
+		 * Reduces the next batch of input - only called between @a begin_batches and @a end_batches.
+		 */
+		virtual
+		void
+		process_batch(
+				ReducerInDataset::const_iterator first,
+				ReducerInDataset::const_iterator last)
+		{  }
+
+		/**
+		 * Returns the result of reducing all batches since @a begin_batches
+		 * (or @a EmptyData if there was no input, as with @a process).
+		 */
+		virtual
+		OpaqueData
+		end_batches()
+		{
+			return EmptyData;
+		}
+
 	protected:
 		virtual
 		OpaqueData
@@ -0,0 +1,371 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <utility>
+#include <boost/foreach.hpp>
+
+#include "CoRegTargetSpatialIndex.h"
+#include "CoRegGeometryDistanceCache.h"
+#include "DataMiningUtils.h"
+
+#include "app-logic/GeometryUtils.h"
+#include "app-logic/ReconstructedFeatureGeometry.h"
+
+#include "global/AssertionFailureException.h"
+#include "global/GPlatesAssert.h"
+
+#include "maths/GeometryDistance.h"
+
+
+namespace GPlatesDataMining
+{
+	namespace
+	{
+		/**
+		 * Returns the small circle bounding the specified geometry (a point is bounded by a zero-radius circle).
+		 */
+		GPlatesMaths::BoundingSmallCircle
+		get_bounding_small_circle(
+				const GPlatesMaths::GeometryOnSphere &geometry)
+		{
+			boost::optional<const GPlatesMaths::BoundingSmallCircle &> bounding_small_circle =
+					GPlatesAppLogic::GeometryUtils::get_geometry_bounding_small_circle(geometry);
+			if (bounding_small_circle)
+			{
+				return bounding_small_circle.get();
+			}
+
+			boost::optional<const GPlatesMaths::PointOnSphere &> point =
+					GPlatesAppLogic::GeometryUtils::get_point_on_sphere(geometry);
+			GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+					point,
+					GPLATES_ASSERTION_SOURCE);
+
+			return GPlatesMaths::BoundingSmallCircle(point->position_vector(), GPlatesMaths::AngularExtent::ZERO);
+		}
+
+
+		/**
+		 * Returns true if two bounding small circles intersect (including just touching).
+		 *
+		 * Unlike 'GPlatesMaths::intersect()' this also accepts circles that touch since the
+		 * region-of-interest filter accepts geometries at exactly the region-of-interest range.
+		 */
+		bool
+		intersect_or_touch(
+				const GPlatesMaths::BoundingSmallCircle &bounding_small_circle_1,
+				const GPlatesMaths::BoundingSmallCircle &bounding_small_circle_2)
+		{
+			return !GPlatesMaths::AngularExtent::create_from_cosine(
+					dot(bounding_small_circle_1.get_centre(), bounding_small_circle_2.get_centre()))
+				.is_precisely_greater_than(
+					bounding_small_circle_1.get_angular_extent() + bounding_small_circle_2.get_angular_extent());
+		}
+
+
+		//! Orders entries by a coordinate of their bounding small circle centres.
+		template <class EntryType>
+		class EntryCentreLessThan
+		{
+		public:
+			explicit
+			EntryCentreLessThan(
+					unsigned int axis) :
+				d_axis(axis)
+			{  }
+
+			bool
+			operator()(
+					const EntryType &lhs,
+					const EntryType &rhs) const
+			{
+				return get_coordinate(lhs) < get_coordinate(rhs);
+			}
+
+		private:
+			unsigned int d_axis;
+
+			double
+			get_coordinate(
+					const EntryType &entry) const
+			{
+				const GPlatesMaths::UnitVector3D &centre = entry.bounds.get_centre();
+				return (d_axis == 0) ? centre.x().dval() : ((d_axis == 1) ? centre.y().dval() : centre.z().dval());
+			}
+		};
+	}
+}
+
+
+GPlatesDataMining::CoRegTargetSpatialIndex::CoRegTargetSpatialIndex(
+		const reconstructed_feature_vector_type &reconstructed_target_features) :
+	d_reconstructed_features(reconstructed_target_features)
+{
+	for (unsigned int feature_index = 0; feature_index < d_reconstructed_features.size(); ++feature_index)
+	{
+		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature::reconstruction_seq_type &reconstructions =
+				d_reconstructed_features[feature_index].get_reconstructions();
+
+		for (unsigned int reconstruction_index = 0; reconstruction_index < reconstructions.size(); ++reconstruction_index)
+		{
+			const GPlatesMaths::GeometryOnSphere &reconstructed_geometry =
+					*reconstructions[reconstruction_index].get_reconstructed_feature_geometry()->reconstructed_geometry();
+
+			// So that distances to the target geometry can be queried concurrently.
+			DataMiningUtils::prepare_for_concurrent_distance_queries(reconstructed_geometry);
+
+			d_entries.push_back(
+					Entry(
+							get_bounding_small_circle(reconstructed_geometry),
+							feature_index,
+							reconstruction_index));
+		}
+	}
+
+	if (!d_entries.empty())
+	{
+		// Each node (except leaves) has two children so there's less than twice the number of entries.
+		d_nodes.reserve(2 * d_entries.size());
+
+		d_root_node_index = create_node(0, d_entries.size());
+	}
+}
+
+
+unsigned int
+GPlatesDataMining::CoRegTargetSpatialIndex::create_node(
+		unsigned int begin_entry_index,
+		unsigned int num_entries)
+{
+	const std::vector<Entry>::iterator begin_entries = d_entries.begin() + begin_entry_index;
+	const std::vector<Entry>::iterator end_entries = begin_entries + num_entries;
+
+	if (num_entries <= MAX_NUM_ENTRIES_PER_LEAF_NODE)
+	{
+		// Bound the leaf node's entries.
+		GPlatesMaths::BoundingSmallCircle leaf_bounds = begin_entries->bounds;
+		for (std::vector<Entry>::iterator entries_iter = begin_entries + 1; entries_iter != end_entries; ++entries_iter)
+		{
+			leaf_bounds = create_optimal_bounding_small_circle(leaf_bounds, entries_iter->bounds);
+		}
+
+		const unsigned int leaf_node_index = d_nodes.size();
+		d_nodes.push_back(Node(leaf_bounds, begin_entry_index, num_entries));
+
+		return leaf_node_index;
+	}
+
+	// Split the entries at the median along the axis in which their centres are most spread out.
+	double min_coords[3] = { 1, 1, 1 };
+	double max_coords[3] = { -1, -1, -1 };
+	for (std::vector<Entry>::iterator entries_iter = begin_entries; entries_iter != end_entries; ++entries_iter)
+	{
+		const GPlatesMaths::UnitVector3D &centre = entries_iter->bounds.get_centre();
+		const double coords[3] = { centre.x().dval(), centre.y().dval(), centre.z().dval() };
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			min_coords[axis] = (std::min)(min_coords[axis], coords[axis]);
+			max_coords[axis] = (std::max)(max_coords[axis], coords[axis]);
+		}
+	}
+
+	unsigned int split_axis = 0;
+	for (unsigned int axis = 1; axis < 3; ++axis)
+	{
+		if (max_coords[axis] - min_coords[axis] > max_coords[split_axis] - min_coords[split_axis])
+		{
+			split_axis = axis;
+		}
+	}
+
+	const unsigned int first_child_num_entries = num_entries / 2;
+	std::nth_element(
+			begin_entries,
+			begin_entries + first_child_num_entries,
+			end_entries,
+			EntryCentreLessThan<Entry>(split_axis));
+
+	const unsigned int first_child_node_index =
+			create_node(begin_entry_index, first_child_num_entries);
+	const unsigned int second_child_node_index =
+			create_node(begin_entry_index + first_child_num_entries, num_entries - first_child_num_entries);
+
+	// Create the internal node that bounds both child nodes.
+	const unsigned int node_index = d_nodes.size();
+	d_nodes.push_back(
+			Node(
+					create_optimal_bounding_small_circle(
+							d_nodes[first_child_node_index].bounds,
+							d_nodes[second_child_node_index].bounds),
+					begin_entry_index,
+					num_entries));
+	d_nodes.back().child_node_indices = std::make_pair(first_child_node_index, second_child_node_index);
+
+	return node_index;
+}
+
+
+void
+GPlatesDataMining::CoRegTargetSpatialIndex::find_region_of_interest_geometries(
+		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
+		const GPlatesMaths::AngularExtent &region_of_interest_range,
+		std::vector<region_of_interest_geometry_type> &region_of_interest_geometries,
+		CoRegGeometryDistanceCache *distance_cache) const
+{
+	if (!d_root_node_index)
+	{
+		return;
+	}
+
+	const GPlatesAppLogic::ReconstructContext::ReconstructedFeature::reconstruction_seq_type &
+			reconstructed_seed_geometries = reconstructed_seed_feature.get_reconstructions();
+
+	// Find the target geometries whose bounding small circles intersect the region of interest
+	// of any seed geometry.
+	std::vector<geometry_index_type> candidate_geometry_indices;
+	BOOST_FOREACH(
+			const GPlatesAppLogic::ReconstructContext::Reconstruction &reconstructed_seed_geom,
+			reconstructed_seed_geometries)
+	{
+		const GPlatesMaths::BoundingSmallCircle region_of_interest =
+				get_bounding_small_circle(
+						*reconstructed_seed_geom.get_reconstructed_feature_geometry()->reconstructed_geometry())
+					.expand(region_of_interest_range);
+
+		find_intersecting_entries(region_of_interest, candidate_geometry_indices);
+	}
+
+	// Restore the original target order (and remove target geometries found by more than one seed geometry).
+	std::sort(candidate_geometry_indices.begin(), candidate_geometry_indices.end());
+	candidate_geometry_indices.erase(
+			std::unique(candidate_geometry_indices.begin(), candidate_geometry_indices.end()),
+			candidate_geometry_indices.end());
+
+	BOOST_FOREACH(const geometry_index_type &candidate_geometry_index, candidate_geometry_indices)
+	{
+		const GPlatesAppLogic::ReconstructedFeatureGeometry &reconstructed_target_feature_geometry =
+				*d_reconstructed_features[candidate_geometry_index.first].get_reconstructions()
+						[candidate_geometry_index.second].get_reconstructed_feature_geometry();
+
+		// Find the minimum distance to the seed geometries.
+		//
+		// Each returned distance will either be less than the region-of-interest range or
+		// AngularDistance::PI (maximum possible distance) to signify the range was exceeded.
+		GPlatesMaths::AngularDistance min_distance = GPlatesMaths::AngularDistance::PI;
+		BOOST_FOREACH(
+				const GPlatesAppLogic::ReconstructContext::Reconstruction &reconstructed_seed_geom,
+				reconstructed_seed_geometries)
+		{
+			const GPlatesAppLogic::ReconstructedFeatureGeometry &reconstructed_seed_feature_geometry =
+					*reconstructed_seed_geom.get_reconstructed_feature_geometry();
+
+			const GPlatesMaths::AngularDistance distance = distance_cache
+					? distance_cache->get_minimum_distance(
+							reconstructed_seed_feature_geometry,
+							reconstructed_target_feature_geometry,
+							region_of_interest_range)
+					: minimum_distance(
+							*reconstructed_seed_feature_geometry.reconstructed_geometry(),
+							*reconstructed_target_feature_geometry.reconstructed_geometry(),
+							// If either (or both) geometry is a polygon then the distance will be zero
+							// if the other geometry overlaps its interior...
+							true/*geometry1_interior_is_solid*/,
+							true/*geometry2_interior_is_solid*/,
+							region_of_interest_range);
+			if (distance.is_precisely_less_than(min_distance))
+			{
+				min_distance = distance;
+			}
+		}
+
+		if (min_distance != GPlatesMaths::AngularDistance::PI)
+		{
+			region_of_interest_geometries.push_back(
+					region_of_interest_geometry_type(candidate_geometry_index, min_distance));
+		}
+	}
+}
+
+
+void
+GPlatesDataMining::CoRegTargetSpatialIndex::get_reconstructed_features(
+		const std::vector<geometry_index_type> &geometry_indices,
+		reconstructed_feature_vector_type &reconstructed_features) const
+{
+	// Group the target geometries by target feature.
+	std::vector<geometry_index_type>::const_iterator geometry_indices_iter = geometry_indices.begin();
+	while (geometry_indices_iter != geometry_indices.end())
+	{
+		const unsigned int feature_index = geometry_indices_iter->first;
+		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_target_feature =
+				d_reconstructed_features[feature_index];
+
+		GPlatesAppLogic::ReconstructContext::ReconstructedFeature::reconstruction_seq_type reconstructions;
+		for ( ;
+			geometry_indices_iter != geometry_indices.end() && geometry_indices_iter->first == feature_index;
+			++geometry_indices_iter)
+		{
+			reconstructions.push_back(
+					reconstructed_target_feature.get_reconstructions()[geometry_indices_iter->second]);
+		}
+
+		reconstructed_features.push_back(
+				GPlatesAppLogic::ReconstructContext::ReconstructedFeature(
+						reconstructed_target_feature.get_feature(),
+						reconstructions));
+	}
+}
+
+
+void
+GPlatesDataMining::CoRegTargetSpatialIndex::find_intersecting_entries(
+		const GPlatesMaths::BoundingSmallCircle &region_of_interest,
+		std::vector<geometry_index_type> &intersecting_entries) const
+{
+	std::vector<unsigned int> node_index_stack(1, d_root_node_index.get());
+	while (!node_index_stack.empty())
+	{
+		const Node &node = d_nodes[node_index_stack.back()];
+		node_index_stack.pop_back();
+
+		if (!intersect_or_touch(node.bounds, region_of_interest))
+		{
+			continue;
+		}
+
+		if (node.child_node_indices)
+		{
+			node_index_stack.push_back(node.child_node_indices->first);
+			node_index_stack.push_back(node.child_node_indices->second);
+			continue;
+		}
+
+		for (unsigned int entry_index = node.begin_entry_index;
+			entry_index < node.begin_entry_index + node.num_entries;
+			++entry_index)
+		{
+			const Entry &entry = d_entries[entry_index];
+			if (intersect_or_touch(entry.bounds, region_of_interest))
+			{
+				intersecting_entries.push_back(std::make_pair(entry.feature_index, entry.reconstruction_index));
+			}
+		}
+	}
+}
@@ -0,0 +1,186 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATESDATAMINING_COREGTARGETSPATIALINDEX_H
+#define GPLATESDATAMINING_COREGTARGETSPATIALINDEX_H
+
+#include <utility>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <boost/optional.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "app-logic/ReconstructContext.h"
+
+#include "maths/AngularDistance.h"
+#include "maths/AngularExtent.h"
+#include "maths/SmallCircleBounds.h"
+
+
+namespace GPlatesDataMining
+{
+	class CoRegGeometryDistanceCache;
+
+	/**
+	 * A spatial index of the reconstructed geometries of a co-registration target layer
+	 * (at one reconstruction time).
+	 *
+	 * The reconstructed target geometries are bulk-loaded into a binary tree of bounding small circles
+	 * so that a region-of-interest query only visits those target geometries whose bounding
+	 * small circles intersect the region of interest (instead of every target geometry).
+	 *
+	 * The index is built once per target layer and shared by all configuration rows (and all seeds)
+	 * that co-register with that target layer.
+	 */
+	class CoRegTargetSpatialIndex :
+			private boost::noncopyable
+	{
+	public:
+		typedef std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature>
+				reconstructed_feature_vector_type;
+
+		//! Identifies a reconstructed target geometry (by target feature index and reconstruction index).
+		typedef std::pair<unsigned int, unsigned int> geometry_index_type;
+
+		//! A reconstructed target geometry within a region of interest (and its distance to the seed).
+		typedef std::pair<geometry_index_type, GPlatesMaths::AngularDistance> region_of_interest_geometry_type;
+
+
+		static
+		boost::shared_ptr<CoRegTargetSpatialIndex>
+		create(
+				const reconstructed_feature_vector_type &reconstructed_target_features)
+		{
+			return boost::shared_ptr<CoRegTargetSpatialIndex>(
+					new CoRegTargetSpatialIndex(reconstructed_target_features));
+		}
+
+
+		/**
+		 * Returns all reconstructed target features (in the order they were indexed).
+		 */
+		const reconstructed_feature_vector_type &
+		get_reconstructed_features() const
+		{
+			return d_reconstructed_features;
+		}
+
+
+		/**
+		 * Finds those reconstructed target geometries within @a region_of_interest_range of
+		 * any geometry of @a reconstructed_seed_feature and appends them to @a region_of_interest_geometries
+		 * (in the order they were indexed) along with their minimum distance to the seed geometries.
+		 *
+		 * Only target geometries whose bounding small circles intersect the bounding small circle
+		 * of a seed geometry (expanded by @a region_of_interest_range) are visited.
+		 *
+		 * This can be called concurrently from multiple threads provided the seed geometries have been
+		 * prepared (see 'DataMiningUtils::prepare_for_concurrent_distance_queries()') - the target
+		 * geometries are prepared when they're indexed. Note that this does not copy any
+		 * @a ReconstructedFeature (which contains a feature weak-ref that is not thread-safe to copy).
+		 *
+		 * If @a distance_cache is specified then it is used to calculate (and possibly re-use)
+		 * the distances between seed and target geometries.
+		 */
+		void
+		find_region_of_interest_geometries(
+				const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
+				const GPlatesMaths::AngularExtent &region_of_interest_range,
+				std::vector<region_of_interest_geometry_type> &region_of_interest_geometries,
+				CoRegGeometryDistanceCache *distance_cache = NULL) const;
+
+
+		/**
+		 * Appends the reconstructed target geometries identified by @a geometry_indices
+		 * (which must be sorted) to @a reconstructed_features, grouped by target feature.
+		 */
+		void
+		get_reconstructed_features(
+				const std::vector<geometry_index_type> &geometry_indices,
+				reconstructed_feature_vector_type &reconstructed_features) const;
+
+	private:
+
+		//! The maximum number of target geometries in a leaf node of the bounding tree.
+		static const unsigned int MAX_NUM_ENTRIES_PER_LEAF_NODE = 8;
+
+		//! A reconstructed target geometry.
+		struct Entry
+		{
+			Entry(
+					const GPlatesMaths::BoundingSmallCircle &bounds_,
+					unsigned int feature_index_,
+					unsigned int reconstruction_index_) :
+				bounds(bounds_),
+				feature_index(feature_index_),
+				reconstruction_index(reconstruction_index_)
+			{  }
+
+			GPlatesMaths::BoundingSmallCircle bounds;
+			unsigned int feature_index;
+			unsigned int reconstruction_index;
+		};
+
+		//! A node in the bounding tree.
+		struct Node
+		{
+			Node(
+					const GPlatesMaths::BoundingSmallCircle &bounds_,
+					unsigned int begin_entry_index_,
+					unsigned int num_entries_) :
+				bounds(bounds_),
+				begin_entry_index(begin_entry_index_),
+				num_entries(num_entries_)
+			{  }
+
+			GPlatesMaths::BoundingSmallCircle bounds;
+			unsigned int begin_entry_index;
+			unsigned int num_entries;
+
+			//! Child node indices (none if a leaf node).
+			boost::optional<std::pair<unsigned int, unsigned int> > child_node_indices;
+		};
+
+
+		reconstructed_feature_vector_type d_reconstructed_features;
+
+		std::vector<Entry> d_entries;
+		std::vector<Node> d_nodes;
+
+		//! The root node (none if there are no target geometries).
+		boost::optional<unsigned int> d_root_node_index;
+
+
+		explicit
+		CoRegTargetSpatialIndex(
+				const reconstructed_feature_vector_type &reconstructed_target_features);
+
+		unsigned int
+		create_node(
+				unsigned int begin_entry_index,
+				unsigned int num_entries);
+
+		void
+		find_intersecting_entries(
+				const GPlatesMaths::BoundingSmallCircle &region_of_interest,
+				std::vector<geometry_index_type> &intersecting_entries) const;
+	};
+}
+
+#endif // GPLATESDATAMINING_COREGTARGETSPATIALINDEX_H
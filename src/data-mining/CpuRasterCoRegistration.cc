@@ -0,0 +1,1054 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <boost/foreach.hpp>
+#include <QDebug>
+
+#include "CpuRasterCoRegistration.h"
+#include "DataMiningUtils.h"
+
+#include "app-logic/GeometryUtils.h"
+#include "app-logic/ReconstructedFeatureGeometry.h"
+
+#include "file-io/RasterFileCacheFormat.h"
+
+#include "global/AssertionFailureException.h"
+#include "global/GPlatesAssert.h"
+
+#include "maths/AngularExtent.h"
+#include "maths/GeometryDistance.h"
+#include "maths/MultiPointOnSphere.h"
+#include "maths/MathsUtils.h"
+#include "maths/PointOnSphere.h"
+#include "maths/PolygonOnSphere.h"
+#include "maths/PolylineOnSphere.h"
+#include "maths/Real.h"
+
+#include "property-values/Georeferencing.h"
+#include "property-values/ProxiedRasterResolver.h"
+#include "property-values/RawRaster.h"
+#include "property-values/RawRasterUtils.h"
+
+#include "utils/ParallelUtils.h"
+#include "utils/Profile.h"
+
+
+namespace GPlatesDataMining
+{
+	namespace CpuRasterCoRegistration
+	{
+		namespace
+		{
+			/**
+			 * The dimension of the square tiles that a raster level is read in.
+			 *
+			 * This matches the block size of the mipmapped raster file cache so that each
+			 * tile is read from as few cache blocks as possible.
+			 */
+			const unsigned int TILE_DIMENSION = GPlatesFileIO::RasterFileCacheFormat::BLOCK_SIZE;
+
+
+			/**
+			 * A tile of a raster level and its coverage.
+			 *
+			 * The values and coverage are empty if the tile was not read (because it is not within
+			 * the region-of-interest of any seed geometry).
+			 */
+			struct RasterTile
+			{
+				RasterTile() :
+					width(0)
+				{  }
+
+				unsigned int width;
+
+				//! Pixel values (row-major).
+				std::vector<float> values;
+
+				//! Pixel coverage in the range [0,1] (row-major), zero where there's no data.
+				std::vector<float> coverage;
+			};
+
+
+			/**
+			 * A level of the mipmapped raster (in lat/lon coordinates) and its coverage.
+			 *
+			 * The level is divided into tiles of @a TILE_DIMENSION pixels, and only those tiles
+			 * needed by the seed geometries are read.
+			 */
+			struct RasterLevel
+			{
+				unsigned int width;
+				unsigned int height;
+
+				//! Number of tiles across and down the level.
+				unsigned int num_tile_columns;
+				unsigned int num_tile_rows;
+
+				//! The tiles of the level (row-major).
+				std::vector<RasterTile> tiles;
+
+				//! The latitude and longitude (radians) of the centre of the top-left pixel.
+				double first_pixel_centre_latitude;
+				double first_pixel_centre_longitude;
+
+				//! The (signed) latitude and longitude spacing (radians) between pixel centres.
+				double pixel_latitude_spacing;
+				double pixel_longitude_spacing;
+
+				//! Half the angular size (radians) of the diagonal of a pixel at the equator.
+				double half_pixel_diagonal;
+
+				//! Sine and cosine of the latitude of each row of pixel centres.
+				std::vector<double> row_sin_latitudes;
+				std::vector<double> row_cos_latitudes;
+
+				//! Sine and cosine of the longitude of each column of pixel centres.
+				std::vector<double> column_sin_longitudes;
+				std::vector<double> column_cos_longitudes;
+
+
+				const RasterTile &
+				get_tile(
+						unsigned int row,
+						unsigned int column) const
+				{
+					return tiles[(row / TILE_DIMENSION) * num_tile_columns + column / TILE_DIMENSION];
+				}
+
+				//! Returns the coverage of a pixel (zero if its tile was not read).
+				float
+				get_coverage(
+						unsigned int row,
+						unsigned int column) const
+				{
+					const RasterTile &tile = get_tile(row, column);
+					if (tile.coverage.empty())
+					{
+						return 0;
+					}
+
+					return tile.coverage[(row % TILE_DIMENSION) * tile.width + column % TILE_DIMENSION];
+				}
+
+				//! Returns the value of a pixel (its tile must have been read).
+				float
+				get_value(
+						unsigned int row,
+						unsigned int column) const
+				{
+					const RasterTile &tile = get_tile(row, column);
+					return tile.values[(row % TILE_DIMENSION) * tile.width + column % TILE_DIMENSION];
+				}
+			};
+
+
+			/**
+			 * A seed geometry prepared for co-registration (on the main thread).
+			 *
+			 * Exactly one of the point, multi-point, polyline and polygon is set.
+			 */
+			struct SeedGeometry
+			{
+				SeedGeometry(
+						const double &bounds_centre_latitude_,
+						const double &bounds_centre_longitude_,
+						const double &bounds_radius_) :
+					bounds_centre_latitude(bounds_centre_latitude_),
+					bounds_centre_longitude(bounds_centre_longitude_),
+					bounds_radius(bounds_radius_)
+				{  }
+
+				boost::optional<const GPlatesMaths::PointOnSphere &> point;
+				boost::optional<GPlatesMaths::MultiPointOnSphere::non_null_ptr_to_const_type> multi_point;
+				boost::optional<GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type> polyline;
+				boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> polygon;
+
+				//! The centre (radians) and radius (radians) of the small circle bounding the geometry.
+				double bounds_centre_latitude;
+				double bounds_centre_longitude;
+				double bounds_radius;
+			};
+
+			typedef std::vector<SeedGeometry> seed_geometry_seq_type;
+
+
+			/**
+			 * A region-of-interest shared by one or more operations.
+			 */
+			struct RegionOfInterest
+			{
+				RegionOfInterest(
+						const double &radius_,
+						bool fill_polygons_) :
+					radius(radius_),
+					fill_polygons(fill_polygons_)
+				{  }
+
+				double radius;
+				bool fill_polygons;
+			};
+
+
+			/**
+			 * Returns the range of pixel indices [begin, end] (inclusive) whose centres lie between the
+			 * fractional pixel coordinates @a coord1 and @a coord2, clamped to [0, @a num_pixels).
+			 *
+			 * Returns false if the range is outside the raster.
+			 */
+			bool
+			get_pixel_range(
+					const double &coord1,
+					const double &coord2,
+					unsigned int num_pixels,
+					unsigned int &begin,
+					unsigned int &end)
+			{
+				const double min_coord = std::ceil((std::min)(coord1, coord2));
+				const double max_coord = std::floor((std::max)(coord1, coord2));
+				if (max_coord < 0 || min_coord > num_pixels - 1.0 || min_coord > max_coord)
+				{
+					return false;
+				}
+
+				begin = (min_coord < 0) ? 0 : static_cast<unsigned int>(min_coord);
+				end = (max_coord > num_pixels - 1.0) ? num_pixels - 1 : static_cast<unsigned int>(max_coord);
+				return true;
+			}
+
+
+			/**
+			 * The range of pixel rows, and up to three ranges of pixel columns (allowing for the
+			 * raster longitude range to be offset from the seed longitude by a multiple of 360 degrees),
+			 * covering the small circle bounding the region-of-interest of a seed geometry.
+			 *
+			 * All ranges are inclusive.
+			 */
+			struct PixelRanges
+			{
+				PixelRanges() :
+					begin_row(0),
+					end_row(0),
+					num_column_ranges(0)
+				{  }
+
+				unsigned int begin_row;
+				unsigned int end_row;
+
+				std::pair<unsigned int, unsigned int> column_ranges[3];
+				unsigned int num_column_ranges;
+			};
+
+
+			/**
+			 * Returns the ranges of pixels covering the small circle bounding the region-of-interest
+			 * of @a seed_geometry.
+			 *
+			 * Returns false if the region-of-interest does not overlap the raster.
+			 */
+			bool
+			get_region_of_interest_pixel_ranges(
+					const RasterLevel &raster_level,
+					const SeedGeometry &seed_geometry,
+					const double &region_of_interest_radius,
+					PixelRanges &pixel_ranges)
+			{
+				const double bounds_radius = seed_geometry.bounds_radius + region_of_interest_radius;
+
+				if (!get_pixel_range(
+					(seed_geometry.bounds_centre_latitude - bounds_radius - raster_level.first_pixel_centre_latitude) /
+						raster_level.pixel_latitude_spacing,
+					(seed_geometry.bounds_centre_latitude + bounds_radius - raster_level.first_pixel_centre_latitude) /
+						raster_level.pixel_latitude_spacing,
+					raster_level.height,
+					pixel_ranges.begin_row,
+					pixel_ranges.end_row))
+				{
+					return false;
+				}
+
+				pixel_ranges.num_column_ranges = 0;
+
+				// If the bounding small circle contains a pole then it covers all longitudes.
+				if (std::fabs(seed_geometry.bounds_centre_latitude) + bounds_radius >= GPlatesMaths::HALF_PI)
+				{
+					pixel_ranges.column_ranges[pixel_ranges.num_column_ranges++] =
+							std::make_pair(0, raster_level.width - 1);
+					return true;
+				}
+
+				const double longitude_extent = std::asin(
+						std::sin(bounds_radius) / std::cos(seed_geometry.bounds_centre_latitude));
+				for (int wrap = -1; wrap <= 1; ++wrap)
+				{
+					const double centre_longitude = seed_geometry.bounds_centre_longitude + wrap * 2 * GPlatesMaths::PI;
+
+					std::pair<unsigned int, unsigned int> &column_range =
+							pixel_ranges.column_ranges[pixel_ranges.num_column_ranges];
+					if (get_pixel_range(
+						(centre_longitude - longitude_extent - raster_level.first_pixel_centre_longitude) /
+							raster_level.pixel_longitude_spacing,
+						(centre_longitude + longitude_extent - raster_level.first_pixel_centre_longitude) /
+							raster_level.pixel_longitude_spacing,
+						raster_level.width,
+						column_range.first,
+						column_range.second))
+					{
+						++pixel_ranges.num_column_ranges;
+					}
+				}
+
+				return pixel_ranges.num_column_ranges > 0;
+			}
+
+
+			/**
+			 * Appends the indices of the covered pixels whose centres are within the region-of-interest
+			 * of @a seed_geometry to @a pixel_indices.
+			 */
+			void
+			find_region_of_interest_pixels(
+					const RasterLevel &raster_level,
+					const SeedGeometry &seed_geometry,
+					const double &region_of_interest_radius,
+					bool fill_polygons,
+					std::vector<unsigned int> &pixel_indices)
+			{
+				PixelRanges pixel_ranges;
+				if (!get_region_of_interest_pixel_ranges(
+					raster_level,
+					seed_geometry,
+					region_of_interest_radius,
+					pixel_ranges))
+				{
+					return;
+				}
+
+				const unsigned int begin_row = pixel_ranges.begin_row;
+				const unsigned int end_row = pixel_ranges.end_row;
+				const std::pair<unsigned int, unsigned int> *const column_ranges = pixel_ranges.column_ranges;
+				const unsigned int num_column_ranges = pixel_ranges.num_column_ranges;
+
+				//
+				// Test the centres of the covered pixels in those ranges against the region-of-interest.
+				//
+
+				if (seed_geometry.point)
+				{
+					// Points only need a dot product per pixel.
+					const GPlatesMaths::UnitVector3D &point = seed_geometry.point->position_vector();
+					const double point_x = point.x().dval();
+					const double point_y = point.y().dval();
+					const double point_z = point.z().dval();
+					const double cos_region_of_interest_radius = std::cos(region_of_interest_radius);
+
+					for (unsigned int row = begin_row; row <= end_row; ++row)
+					{
+						const double row_x = point_x * raster_level.row_cos_latitudes[row];
+						const double row_y = point_y * raster_level.row_cos_latitudes[row];
+						const double row_z = point_z * raster_level.row_sin_latitudes[row];
+
+						for (unsigned int column_range_index = 0; column_range_index < num_column_ranges; ++column_range_index)
+						{
+							const unsigned int end_column = column_ranges[column_range_index].second;
+							for (unsigned int column = column_ranges[column_range_index].first; column <= end_column; ++column)
+							{
+								if (raster_level.get_coverage(row, column) > 0 &&
+									row_x * raster_level.column_cos_longitudes[column] +
+										row_y * raster_level.column_sin_longitudes[column] +
+										row_z >= cos_region_of_interest_radius)
+								{
+									pixel_indices.push_back(row * raster_level.width + column);
+								}
+							}
+						}
+					}
+
+					return;
+				}
+
+				const GPlatesMaths::AngularExtent region_of_interest_range =
+						GPlatesMaths::AngularExtent::create_from_angle(region_of_interest_radius);
+
+				for (unsigned int row = begin_row; row <= end_row; ++row)
+				{
+					const double cos_latitude = raster_level.row_cos_latitudes[row];
+					const double sin_latitude = raster_level.row_sin_latitudes[row];
+
+					for (unsigned int column_range_index = 0; column_range_index < num_column_ranges; ++column_range_index)
+					{
+						const unsigned int end_column = column_ranges[column_range_index].second;
+						for (unsigned int column = column_ranges[column_range_index].first; column <= end_column; ++column)
+						{
+							if (raster_level.get_coverage(row, column) <= 0)
+							{
+								continue;
+							}
+
+							const GPlatesMaths::PointOnSphere pixel_centre(
+									GPlatesMaths::UnitVector3D(
+											cos_latitude * raster_level.column_cos_longitudes[column],
+											cos_latitude * raster_level.column_sin_longitudes[column],
+											sin_latitude,
+											false/*check_validity*/));
+
+							// The distance is AngularDistance::PI if the region-of-interest is exceeded.
+							GPlatesMaths::AngularDistance distance = GPlatesMaths::AngularDistance::PI;
+							if (seed_geometry.multi_point)
+							{
+								distance = minimum_distance(
+										pixel_centre,
+										*seed_geometry.multi_point.get(),
+										region_of_interest_range);
+							}
+							else if (seed_geometry.polyline)
+							{
+								distance = minimum_distance(
+										pixel_centre,
+										*seed_geometry.polyline.get(),
+										region_of_interest_range);
+							}
+							else if (seed_geometry.polygon)
+							{
+								distance = minimum_distance(
+										pixel_centre,
+										*seed_geometry.polygon.get(),
+										fill_polygons/*polygon_interior_is_solid*/,
+										region_of_interest_range);
+							}
+
+							if (distance != GPlatesMaths::AngularDistance::PI)
+							{
+								pixel_indices.push_back(row * raster_level.width + column);
+							}
+						}
+					}
+				}
+			}
+
+
+			/**
+			 * Co-registers a range of seed features (called concurrently from multiple threads).
+			 *
+			 * Each seed feature writes only to its own element of the operation results, and the
+			 * raster level and seed geometries are only read from, so there's no need for any locking.
+			 */
+			class CoRegisterSeedFeatures
+			{
+			public:
+
+				CoRegisterSeedFeatures(
+						const RasterLevel &raster_level,
+						const std::vector<seed_geometry_seq_type> &seed_geometries,
+						const std::vector<RegionOfInterest> &regions_of_interest,
+						const std::vector<unsigned int> &operation_region_of_interest_indices,
+						std::vector<Operation> &operations) :
+					d_raster_level(raster_level),
+					d_seed_geometries(seed_geometries),
+					d_regions_of_interest(regions_of_interest),
+					d_operation_region_of_interest_indices(operation_region_of_interest_indices),
+					d_operations(operations)
+				{  }
+
+				void
+				operator()(
+						std::size_t begin_seed_feature_index,
+						std::size_t end_seed_feature_index) const
+				{
+					std::vector<unsigned int> pixel_indices;
+					std::vector< std::pair<float/*value*/, double/*weight*/> > weighted_values;
+
+					for (std::size_t seed_feature_index = begin_seed_feature_index;
+						seed_feature_index < end_seed_feature_index;
+						++seed_feature_index)
+					{
+						const seed_geometry_seq_type &seed_geometries = d_seed_geometries[seed_feature_index];
+						if (seed_geometries.empty())
+						{
+							// Seed feature does not exist at the reconstruction time.
+							continue;
+						}
+
+						for (unsigned int region_of_interest_index = 0;
+							region_of_interest_index < d_regions_of_interest.size();
+							++region_of_interest_index)
+						{
+							const RegionOfInterest &region_of_interest = d_regions_of_interest[region_of_interest_index];
+
+							// Find the pixels in the region-of-interest of any of the seed geometries.
+							pixel_indices.clear();
+							BOOST_FOREACH(const SeedGeometry &seed_geometry, seed_geometries)
+							{
+								find_region_of_interest_pixels(
+										d_raster_level,
+										seed_geometry,
+										region_of_interest.radius,
+										region_of_interest.fill_polygons,
+										pixel_indices);
+							}
+
+							// Each pixel is only counted once even if it's near more than one seed geometry
+							// (or is found in more than one longitude wrap of a global raster).
+							std::sort(pixel_indices.begin(), pixel_indices.end());
+							pixel_indices.erase(
+									std::unique(pixel_indices.begin(), pixel_indices.end()),
+									pixel_indices.end());
+
+							reduce(seed_feature_index, region_of_interest_index, pixel_indices, weighted_values);
+						}
+					}
+				}
+
+			private:
+
+				const RasterLevel &d_raster_level;
+				const std::vector<seed_geometry_seq_type> &d_seed_geometries;
+				const std::vector<RegionOfInterest> &d_regions_of_interest;
+				const std::vector<unsigned int> &d_operation_region_of_interest_indices;
+				std::vector<Operation> &d_operations;
+
+
+				/**
+				 * Reduces the pixels in a region-of-interest of a seed feature for each operation
+				 * using that region-of-interest.
+				 */
+				void
+				reduce(
+						std::size_t seed_feature_index,
+						unsigned int region_of_interest_index,
+						const std::vector<unsigned int> &pixel_indices,
+						std::vector< std::pair<float, double> > &weighted_values) const
+				{
+					// Weight each pixel by its coverage and area (on the globe).
+					double sum_weights = 0;
+					double sum_weighted_values = 0;
+					double sum_weighted_squared_values = 0;
+					float min_value = 0;
+					float max_value = 0;
+					weighted_values.clear();
+					BOOST_FOREACH(const unsigned int pixel_index, pixel_indices)
+					{
+						const unsigned int row = pixel_index / d_raster_level.width;
+						const unsigned int column = pixel_index % d_raster_level.width;
+
+						const float value = d_raster_level.get_value(row, column);
+						if (GPlatesMaths::is_nan(value))
+						{
+							continue;
+						}
+
+						const double weight = d_raster_level.get_coverage(row, column) *
+								d_raster_level.row_cos_latitudes[row];
+						if (weighted_values.empty())
+						{
+							min_value = max_value = value;
+						}
+						else
+						{
+							min_value = (std::min)(min_value, value);
+							max_value = (std::max)(max_value, value);
+						}
+						sum_weights += weight;
+						sum_weighted_values += weight * value;
+						sum_weighted_squared_values += weight * value * value;
+						weighted_values.push_back(std::make_pair(value, weight));
+					}
+
+					if (weighted_values.empty() ||
+						sum_weights <= 0)
+					{
+						// Leave results as "N/A".
+						return;
+					}
+
+					const double mean = sum_weighted_values / sum_weights;
+
+					for (unsigned int operation_index = 0; operation_index < d_operations.size(); ++operation_index)
+					{
+						if (d_operation_region_of_interest_indices[operation_index] != region_of_interest_index)
+						{
+							continue;
+						}
+
+						Operation &operation = d_operations[operation_index];
+						boost::optional<double> &result = operation.get_co_registration_results()[seed_feature_index];
+
+						switch (operation.get_operation_type())
+						{
+						case OPERATION_MEAN:
+							result = mean;
+							break;
+
+						case OPERATION_STANDARD_DEVIATION:
+							{
+								// Clamp to zero in case numerical precision makes the variance slightly negative.
+								const double variance = sum_weighted_squared_values / sum_weights - mean * mean;
+								result = (variance > 0) ? std::sqrt(variance) : 0.0;
+							}
+							break;
+
+						case OPERATION_MINIMUM:
+							result = min_value;
+							break;
+
+						case OPERATION_MAXIMUM:
+							result = max_value;
+							break;
+
+						case OPERATION_MEDIAN:
+							result = get_weighted_median(weighted_values, sum_weights);
+							break;
+
+						default:
+							GPlatesGlobal::Abort(GPLATES_ASSERTION_SOURCE);
+							break;
+						}
+					}
+				}
+
+
+				/**
+				 * Returns the value at which the cumulative weight (of values in increasing order)
+				 * reaches half the total weight.
+				 */
+				static
+				double
+				get_weighted_median(
+						std::vector< std::pair<float, double> > &weighted_values,
+						const double &sum_weights)
+				{
+					std::sort(weighted_values.begin(), weighted_values.end());
+
+					const double half_sum_weights = 0.5 * sum_weights;
+					double cumulative_weight = 0;
+					for (unsigned int n = 0; n < weighted_values.size(); ++n)
+					{
+						cumulative_weight += weighted_values[n].second;
+						if (cumulative_weight >= half_sum_weights)
+						{
+							return weighted_values[n].first;
+						}
+					}
+
+					return weighted_values.back().first;
+				}
+			};
+
+
+			/**
+			 * Returns true if @a georeferencing is not rotated (so that pixel rows are lines of
+			 * latitude and columns are lines of longitude).
+			 */
+			bool
+			is_unrotated_georeferencing(
+					const GPlatesPropertyValues::Georeferencing &georeferencing)
+			{
+				const GPlatesPropertyValues::Georeferencing::parameters_type &georeferencing_parameters =
+						georeferencing.get_parameters();
+
+				return GPlatesMaths::are_almost_exactly_equal(georeferencing_parameters.x_component_of_pixel_height, 0.0) &&
+						GPlatesMaths::are_almost_exactly_equal(georeferencing_parameters.y_component_of_pixel_width, 0.0);
+			}
+
+
+			/**
+			 * Reads the values and coverage of the tile at @a tile_row and @a tile_column of
+			 * level @a level into @a raster_level.
+			 *
+			 * Integer rasters are read as float rasters. Double rasters are converted to float
+			 * (the precision used by the OpenGL path).
+			 *
+			 * Returns false if the tile could not be read.
+			 */
+			bool
+			read_raster_tile(
+					GPlatesPropertyValues::ProxiedRasterResolver &proxied_raster_resolver,
+					unsigned int level,
+					unsigned int tile_row,
+					unsigned int tile_column,
+					RasterLevel &raster_level)
+			{
+				const unsigned int x_offset = tile_column * TILE_DIMENSION;
+				const unsigned int y_offset = tile_row * TILE_DIMENSION;
+				const unsigned int tile_width = (std::min)(TILE_DIMENSION, raster_level.width - x_offset);
+				const unsigned int tile_height = (std::min)(TILE_DIMENSION, raster_level.height - y_offset);
+
+				boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type> tile_raster =
+						proxied_raster_resolver.get_region_from_level(
+								level, x_offset, y_offset, tile_width, tile_height);
+				boost::optional<GPlatesPropertyValues::CoverageRawRaster::non_null_ptr_type> tile_coverage_raster =
+						proxied_raster_resolver.get_coverage_from_level(
+								level, x_offset, y_offset, tile_width, tile_height);
+				if (!tile_raster ||
+					!tile_coverage_raster)
+				{
+					return false;
+				}
+
+				const unsigned int num_tile_pixels = tile_width * tile_height;
+				RasterTile &tile = raster_level.tiles[tile_row * raster_level.num_tile_columns + tile_column];
+
+				if (boost::optional<GPlatesPropertyValues::FloatRawRaster::non_null_ptr_type> float_tile_raster =
+					GPlatesPropertyValues::RawRasterUtils::try_raster_cast<GPlatesPropertyValues::FloatRawRaster>(*tile_raster.get()))
+				{
+					const float *const float_values = float_tile_raster.get()->data();
+					tile.values.assign(float_values, float_values + num_tile_pixels);
+				}
+				else if (boost::optional<GPlatesPropertyValues::DoubleRawRaster::non_null_ptr_type> double_tile_raster =
+					GPlatesPropertyValues::RawRasterUtils::try_raster_cast<GPlatesPropertyValues::DoubleRawRaster>(*tile_raster.get()))
+				{
+					const double *const double_values = double_tile_raster.get()->data();
+					tile.values.assign(double_values, double_values + num_tile_pixels);
+				}
+				else
+				{
+					return false;
+				}
+
+				const float *const coverage_values = tile_coverage_raster.get()->data();
+				tile.coverage.assign(coverage_values, coverage_values + num_tile_pixels);
+				tile.width = tile_width;
+
+				return true;
+			}
+		}
+	}
+}
+
+
+bool
+GPlatesDataMining::CpuRasterCoRegistration::is_supported(
+		GPlatesAppLogic::RasterLayerProxy &raster_layer_proxy,
+		const GPlatesPropertyValues::TextContent &raster_band_name)
+{
+	// Reconstructed (and age-grid masked) rasters are only generated by OpenGL.
+	if (raster_layer_proxy.is_reconstructed())
+	{
+		return false;
+	}
+
+	if (!raster_layer_proxy.does_raster_band_contain_numerical_data(raster_band_name))
+	{
+		return false;
+	}
+
+	// The raster must be in lat/lon coordinates (in WGS84)...
+	if (!raster_layer_proxy.get_coordinate_transformation()->is_identity_transform())
+	{
+		return false;
+	}
+
+	// ...and not rotated (so that pixel rows are lines of latitude and columns are lines of longitude).
+	const boost::optional<GPlatesPropertyValues::Georeferencing::non_null_ptr_to_const_type> &georeferencing =
+			raster_layer_proxy.get_georeferencing();
+	if (!georeferencing ||
+		!is_unrotated_georeferencing(*georeferencing.get()))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+
+bool
+GPlatesDataMining::CpuRasterCoRegistration::co_register(
+		std::vector<Operation> &operations,
+		const std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> &reconstructed_seed_features,
+		GPlatesAppLogic::RasterLayerProxy &raster_layer_proxy,
+		const double &reconstruction_time,
+		const GPlatesPropertyValues::TextContent &raster_band_name,
+		unsigned int raster_level_of_detail)
+{
+	if (!is_supported(raster_layer_proxy, raster_band_name))
+	{
+		return false;
+	}
+
+	const boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type> &proxied_raster =
+			raster_layer_proxy.get_proxied_raster(reconstruction_time, raster_band_name);
+	if (!proxied_raster)
+	{
+		return false;
+	}
+
+	return co_register(
+			operations,
+			reconstructed_seed_features,
+			proxied_raster.get(),
+			raster_layer_proxy.get_georeferencing().get(),
+			raster_level_of_detail);
+}
+
+
+bool
+GPlatesDataMining::CpuRasterCoRegistration::co_register(
+		std::vector<Operation> &operations,
+		const std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> &reconstructed_seed_features,
+		const GPlatesPropertyValues::RawRaster::non_null_ptr_type &proxied_raster,
+		const GPlatesPropertyValues::Georeferencing::non_null_ptr_to_const_type &georeferencing,
+		unsigned int raster_level_of_detail)
+{
+	PROFILE_FUNC();
+
+	if (!is_unrotated_georeferencing(*georeferencing))
+	{
+		return false;
+	}
+
+	boost::optional<GPlatesPropertyValues::ProxiedRasterResolver::non_null_ptr_type> proxied_raster_resolver =
+			GPlatesPropertyValues::ProxiedRasterResolver::create(proxied_raster);
+	const boost::optional<std::pair<unsigned int, unsigned int> > raster_size =
+			GPlatesPropertyValues::RawRasterUtils::get_raster_size(*proxied_raster);
+	if (!proxied_raster_resolver ||
+		!raster_size)
+	{
+		return false;
+	}
+
+	// Each mipmap level halves the dimensions of the previous level (rounding up).
+	const unsigned int level = (std::min)(
+			raster_level_of_detail,
+			proxied_raster_resolver.get()->get_number_of_levels() - 1);
+	unsigned int level_width = raster_size->first;
+	unsigned int level_height = raster_size->second;
+	for (unsigned int n = 0; n < level; ++n)
+	{
+		level_width = (level_width >> 1) + (level_width & 1);
+		level_height = (level_height >> 1) + (level_height & 1);
+	}
+	if (level_width == 0 ||
+		level_height == 0)
+	{
+		return false;
+	}
+
+	// Pixel centres of the level (the raster georeferencing bounds pixel *boxes* and each
+	// level pixel covers 2^level x 2^level pixels of the full-resolution raster).
+	const GPlatesPropertyValues::Georeferencing::parameters_type &georeferencing_parameters =
+			georeferencing->get_parameters();
+	const double level_scale = static_cast<double>(1 << level);
+
+	RasterLevel raster_level;
+	raster_level.width = level_width;
+	raster_level.height = level_height;
+	raster_level.num_tile_columns = (level_width + TILE_DIMENSION - 1) / TILE_DIMENSION;
+	raster_level.num_tile_rows = (level_height + TILE_DIMENSION - 1) / TILE_DIMENSION;
+	// The tiles are read later, once we know which tiles the seed geometries need.
+	raster_level.tiles.resize(raster_level.num_tile_columns * raster_level.num_tile_rows);
+	raster_level.pixel_longitude_spacing = GPlatesMaths::convert_deg_to_rad(
+			level_scale * georeferencing_parameters.x_component_of_pixel_width);
+	raster_level.pixel_latitude_spacing = GPlatesMaths::convert_deg_to_rad(
+			level_scale * georeferencing_parameters.y_component_of_pixel_height);
+	raster_level.first_pixel_centre_longitude =
+			GPlatesMaths::convert_deg_to_rad(georeferencing_parameters.top_left_x_coordinate) +
+					0.5 * raster_level.pixel_longitude_spacing;
+	raster_level.first_pixel_centre_latitude =
+			GPlatesMaths::convert_deg_to_rad(georeferencing_parameters.top_left_y_coordinate) +
+					0.5 * raster_level.pixel_latitude_spacing;
+	raster_level.half_pixel_diagonal = 0.5 * std::sqrt(
+			raster_level.pixel_longitude_spacing * raster_level.pixel_longitude_spacing +
+					raster_level.pixel_latitude_spacing * raster_level.pixel_latitude_spacing);
+
+	if (GPlatesMaths::are_almost_exactly_equal(raster_level.pixel_longitude_spacing, 0.0) ||
+		GPlatesMaths::are_almost_exactly_equal(raster_level.pixel_latitude_spacing, 0.0))
+	{
+		return false;
+	}
+
+	raster_level.row_sin_latitudes.resize(level_height);
+	raster_level.row_cos_latitudes.resize(level_height);
+	for (unsigned int row = 0; row < level_height; ++row)
+	{
+		double latitude = raster_level.first_pixel_centre_latitude + row * raster_level.pixel_latitude_spacing;
+		// Pixel centres should be within [-90,90] but clamp in case of numerical precision.
+		latitude = (std::max)(-GPlatesMaths::HALF_PI, (std::min)(GPlatesMaths::HALF_PI, latitude));
+		raster_level.row_sin_latitudes[row] = std::sin(latitude);
+		raster_level.row_cos_latitudes[row] = std::cos(latitude);
+	}
+
+	raster_level.column_sin_longitudes.resize(level_width);
+	raster_level.column_cos_longitudes.resize(level_width);
+	for (unsigned int column = 0; column < level_width; ++column)
+	{
+		const double longitude = raster_level.first_pixel_centre_longitude + column * raster_level.pixel_longitude_spacing;
+		raster_level.column_sin_longitudes[column] = std::sin(longitude);
+		raster_level.column_cos_longitudes[column] = std::cos(longitude);
+	}
+
+	//
+	// Share region-of-interest pixel searches between operations with the same region-of-interest.
+	//
+	// Regions-of-interest smaller than a pixel are expanded to half a pixel diagonal so that
+	// a seed point always has at least one pixel (this is similar to the OpenGL path which always
+	// rasterises at least one pixel per seed point).
+	//
+
+	std::vector<RegionOfInterest> regions_of_interest;
+	std::vector<unsigned int> operation_region_of_interest_indices;
+	BOOST_FOREACH(Operation &operation, operations)
+	{
+		const double region_of_interest_radius = (std::min)(
+				(std::max)(operation.get_region_of_interest_radius(), raster_level.half_pixel_diagonal),
+				GPlatesMaths::PI);
+
+		unsigned int region_of_interest_index = 0;
+		while (region_of_interest_index < regions_of_interest.size() &&
+			!(regions_of_interest[region_of_interest_index].radius == region_of_interest_radius &&
+				regions_of_interest[region_of_interest_index].fill_polygons == operation.get_fill_polygons()))
+		{
+			++region_of_interest_index;
+		}
+		if (region_of_interest_index == regions_of_interest.size())
+		{
+			regions_of_interest.push_back(
+					RegionOfInterest(region_of_interest_radius, operation.get_fill_polygons()));
+		}
+		operation_region_of_interest_indices.push_back(region_of_interest_index);
+
+		// Start with no results for all seed features.
+		operation.get_co_registration_results().assign(reconstructed_seed_features.size(), boost::none);
+	}
+
+	//
+	// Prepare the seed geometries on this thread (geometries lazily cache their bounds and
+	// other structures used by distance queries).
+	//
+
+	std::vector<seed_geometry_seq_type> seed_geometries(reconstructed_seed_features.size());
+	for (unsigned int seed_feature_index = 0; seed_feature_index < reconstructed_seed_features.size(); ++seed_feature_index)
+	{
+		BOOST_FOREACH(
+				const GPlatesAppLogic::ReconstructContext::Reconstruction &reconstructed_seed_geom,
+				reconstructed_seed_features[seed_feature_index].get_reconstructions())
+		{
+			const GPlatesMaths::GeometryOnSphere &seed_geometry =
+					*reconstructed_seed_geom.get_reconstructed_feature_geometry()->reconstructed_geometry();
+
+			DataMiningUtils::prepare_for_concurrent_distance_queries(seed_geometry);
+
+			boost::optional<const GPlatesMaths::PointOnSphere &> seed_point =
+					GPlatesAppLogic::GeometryUtils::get_point_on_sphere(seed_geometry);
+			if (seed_point)
+			{
+				const GPlatesMaths::UnitVector3D &point = seed_point->position_vector();
+				seed_geometries[seed_feature_index].push_back(
+						SeedGeometry(
+								std::asin((std::max)(-1.0, (std::min)(1.0, point.z().dval()))),
+								std::atan2(point.y().dval(), point.x().dval()),
+								0.0/*bounds_radius*/));
+				seed_geometries[seed_feature_index].back().point = seed_point;
+				continue;
+			}
+
+			boost::optional<const GPlatesMaths::BoundingSmallCircle &> bounding_small_circle =
+					GPlatesAppLogic::GeometryUtils::get_geometry_bounding_small_circle(seed_geometry);
+			GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+					bounding_small_circle,
+					GPLATES_ASSERTION_SOURCE);
+
+			const GPlatesMaths::UnitVector3D &bounds_centre = bounding_small_circle->get_centre();
+			seed_geometries[seed_feature_index].push_back(
+					SeedGeometry(
+							std::asin((std::max)(-1.0, (std::min)(1.0, bounds_centre.z().dval()))),
+							std::atan2(bounds_centre.y().dval(), bounds_centre.x().dval()),
+							bounding_small_circle->get_angular_extent().get_angle().dval()));
+			SeedGeometry &prepared_seed_geometry = seed_geometries[seed_feature_index].back();
+			prepared_seed_geometry.multi_point = GPlatesAppLogic::GeometryUtils::get_multi_point_on_sphere(seed_geometry);
+			prepared_seed_geometry.polyline = GPlatesAppLogic::GeometryUtils::get_polyline_on_sphere(seed_geometry);
+			prepared_seed_geometry.polygon = GPlatesAppLogic::GeometryUtils::get_polygon_on_sphere(seed_geometry);
+		}
+	}
+
+	//
+	// Read only those tiles of the level (from the mipmapped raster file cache) that are covered by
+	// the region-of-interest of any seed geometry (using the largest region-of-interest).
+	//
+
+	double max_region_of_interest_radius = 0;
+	BOOST_FOREACH(const RegionOfInterest &region_of_interest, regions_of_interest)
+	{
+		max_region_of_interest_radius = (std::max)(max_region_of_interest_radius, region_of_interest.radius);
+	}
+
+	std::vector<bool> tiles_needed(raster_level.tiles.size(), false);
+	BOOST_FOREACH(const seed_geometry_seq_type &seed_feature_geometries, seed_geometries)
+	{
+		BOOST_FOREACH(const SeedGeometry &seed_geometry, seed_feature_geometries)
+		{
+			PixelRanges pixel_ranges;
+			if (!get_region_of_interest_pixel_ranges(
+				raster_level,
+				seed_geometry,
+				max_region_of_interest_radius,
+				pixel_ranges))
+			{
+				continue;
+			}
+
+			const unsigned int begin_tile_row = pixel_ranges.begin_row / TILE_DIMENSION;
+			const unsigned int end_tile_row = pixel_ranges.end_row / TILE_DIMENSION;
+			for (unsigned int column_range_index = 0; column_range_index < pixel_ranges.num_column_ranges; ++column_range_index)
+			{
+				const unsigned int begin_tile_column = pixel_ranges.column_ranges[column_range_index].first / TILE_DIMENSION;
+				const unsigned int end_tile_column = pixel_ranges.column_ranges[column_range_index].second / TILE_DIMENSION;
+				for (unsigned int tile_row = begin_tile_row; tile_row <= end_tile_row; ++tile_row)
+				{
+					for (unsigned int tile_column = begin_tile_column; tile_column <= end_tile_column; ++tile_column)
+					{
+						tiles_needed[tile_row * raster_level.num_tile_columns + tile_column] = true;
+					}
+				}
+			}
+		}
+	}
+
+	for (unsigned int tile_row = 0; tile_row < raster_level.num_tile_rows; ++tile_row)
+	{
+		for (unsigned int tile_column = 0; tile_column < raster_level.num_tile_columns; ++tile_column)
+		{
+			if (tiles_needed[tile_row * raster_level.num_tile_columns + tile_column] &&
+				!read_raster_tile(*proxied_raster_resolver.get(), level, tile_row, tile_column, raster_level))
+			{
+				qWarning() << "CpuRasterCoRegistration: Unable to read raster - skipping co-registration.";
+				return false;
+			}
+		}
+	}
+
+	//
+	// Co-register the seed features in parallel.
+	//
+
+	GPlatesUtils::ParallelUtils::parallel_for(
+			reconstructed_seed_features.size(),
+			CoRegisterSeedFeatures(
+					raster_level,
+					seed_geometries,
+					regions_of_interest,
+					operation_region_of_interest_indices,
+					operations),
+			// Each seed feature can cover many pixels...
+			4/*min_items_per_chunk*/);
+
+	return true;
+}
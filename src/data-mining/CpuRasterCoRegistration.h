@@ -0,0 +1,193 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_DATA_MINING_CPURASTERCOREGISTRATION_H
+#define GPLATES_DATA_MINING_CPURASTERCOREGISTRATION_H
+
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "app-logic/RasterLayerProxy.h"
+#include "app-logic/ReconstructContext.h"
+
+#include "property-values/Georeferencing.h"
+#include "property-values/RawRaster.h"
+#include "property-values/TextContent.h"
+
+
+namespace GPlatesDataMining
+{
+	/**
+	 * Co-registers seed geometries with a target raster on the CPU.
+	 *
+	 * This is used when raster co-registration cannot be accelerated using OpenGL (see
+	 * GLRasterCoRegistration), such as when there is no OpenGL context, and also for the
+	 * median operation (which the OpenGL path does not support).
+	 *
+	 * The results match those of GLRasterCoRegistration (to within the differences in how
+	 * the raster is sampled). The raster pixels within the region-of-interest of the seed
+	 * geometries of each seed feature are weighted by their area (on the globe) and their
+	 * coverage (see ProxiedRasterResolver::get_coverage_from_level), so the mean and standard
+	 * deviation are area-weighted, and the minimum and maximum are over pixels with non-zero coverage.
+	 *
+	 * The raster is read from its mipmapped raster file cache (at the requested level of detail)
+	 * in tiles, and only those tiles within the region-of-interest of the seed geometries are read.
+	 * The seed features are then co-registered in parallel.
+	 *
+	 * Only unreconstructed rasters with an unrotated lat/lon georeferencing in the WGS84
+	 * spatial reference system (by far the most common case) are currently supported.
+	 */
+	namespace CpuRasterCoRegistration
+	{
+		/**
+		 * How the raster pixels in the region-of-interest of geometries are combined into a single value.
+		 */
+		enum OperationType
+		{
+			OPERATION_MEAN,
+			OPERATION_STANDARD_DEVIATION,
+			OPERATION_MINIMUM,
+			OPERATION_MAXIMUM,
+			OPERATION_MEDIAN // Area-weighted median.
+		};
+
+
+		/**
+		 * Specifies the type of operation and region-of-interest and contains co-registration results.
+		 */
+		class Operation
+		{
+		public:
+			/**
+			 * Typedef for a sequence of co-registration results.
+			 *
+			 * There is one element per seed feature.
+			 * Null elements indicate no co-registration results (eg, no raster in region of
+			 * seed geometry or seed feature does not exist at the current reconstruction time).
+			 */
+			typedef std::vector< boost::optional<double> > result_seq_type;
+
+
+			/**
+			 * Define an operation as a type of operation, a region-of-interest and a fill polygon flag.
+			 *
+			 * These have the same meaning as in GLRasterCoRegistration::Operation.
+			 */
+			Operation(
+					const double &region_of_interest_radius/* angular radial extent in radians */,
+					OperationType operation,
+					bool fill_polygons) :
+				d_region_of_interest_radius(region_of_interest_radius),
+				d_operation(operation),
+				d_fill_polygons(fill_polygons)
+			{  }
+
+			const double &
+			get_region_of_interest_radius() const
+			{
+				return d_region_of_interest_radius;
+			}
+
+			OperationType
+			get_operation_type() const
+			{
+				return d_operation;
+			}
+
+			bool
+			get_fill_polygons() const
+			{
+				return d_fill_polygons;
+			}
+
+			/**
+			 * Returns results of co-registration.
+			 *
+			 * The length of the returned sequence is the number of seed features.
+			 */
+			const result_seq_type &
+			get_co_registration_results() const
+			{
+				return d_results;
+			}
+
+			result_seq_type &
+			get_co_registration_results()
+			{
+				return d_results;
+			}
+
+		private:
+			double d_region_of_interest_radius;
+			OperationType d_operation;
+			bool d_fill_polygons;
+
+			result_seq_type d_results;
+		};
+
+
+		/**
+		 * Returns true if the raster of @a raster_layer_proxy can be co-registered on the CPU.
+		 *
+		 * Returns false if the raster is reconstructed (or masked by an age grid), is not
+		 * georeferenced in (unrotated) lat/lon coordinates or does not contain numerical data.
+		 */
+		bool
+		is_supported(
+				GPlatesAppLogic::RasterLayerProxy &raster_layer_proxy,
+				const GPlatesPropertyValues::TextContent &raster_band_name);
+
+
+		/**
+		 * Co-registers the seed features @a reconstructed_seed_features with the raster, at level of detail
+		 * @a raster_level_of_detail (clamped to the lowest resolution mipmap), for each operation.
+		 *
+		 * The results are stored in each operation of @a operations.
+		 *
+		 * Returns false if the raster is not supported (see @a is_supported) or could not be read,
+		 * in which case the operation results should not be used.
+		 */
+		bool
+		co_register(
+				std::vector<Operation> &operations,
+				const std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> &reconstructed_seed_features,
+				GPlatesAppLogic::RasterLayerProxy &raster_layer_proxy,
+				const double &reconstruction_time,
+				const GPlatesPropertyValues::TextContent &raster_band_name,
+				unsigned int raster_level_of_detail);
+
+
+		/**
+		 * Same as the above overload but co-registers with the proxied raster @a proxied_raster
+		 * (containing numerical data) which is georeferenced by @a georeferencing in lat/lon
+		 * coordinates (in WGS84), instead of the raster of a raster layer.
+		 *
+		 * Returns false if @a georeferencing is rotated or the raster could not be read.
+		 */
+		bool
+		co_register(
+				std::vector<Operation> &operations,
+				const std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> &reconstructed_seed_features,
+				const GPlatesPropertyValues::RawRaster::non_null_ptr_type &proxied_raster,
+				const GPlatesPropertyValues::Georeferencing::non_null_ptr_to_const_type &georeferencing,
+				unsigned int raster_level_of_detail);
+	}
+}
+
+#endif // GPLATES_DATA_MINING_CPURASTERCOREGISTRATION_H
@@ -0,0 +1,421 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <boost/variant.hpp>
+
+#include "DataColumn.h"
+
+#include "OpaqueDataToQString.h"
+
+#include "global/GPlatesAssert.h"
+#include "global/PreconditionViolationError.h"
+
+
+namespace GPlatesDataMining
+{
+	namespace
+	{
+		//
+		// Indices of the types in the @a OpaqueData variant.
+		//
+		const int EMPTY_VALUE_TYPE = 0;
+		const int BOOL_VALUE_TYPE = 1;
+		const int INT_VALUE_TYPE = 2;
+		const int UNSIGNED_VALUE_TYPE = 3;
+		const int CHAR_VALUE_TYPE = 4;
+		const int FLOAT_VALUE_TYPE = 5;
+		const int DOUBLE_VALUE_TYPE = 6;
+		const int STRING_VALUE_TYPE = 7;
+
+
+		DataColumn::StorageType
+		get_storage_type_of_value_type(
+				int value_type)
+		{
+			switch (value_type)
+			{
+			case BOOL_VALUE_TYPE:
+			case INT_VALUE_TYPE:
+			case UNSIGNED_VALUE_TYPE:
+			case CHAR_VALUE_TYPE:
+				return DataColumn::STORAGE_INTEGER;
+
+			case FLOAT_VALUE_TYPE:
+			case DOUBLE_VALUE_TYPE:
+				return DataColumn::STORAGE_REAL;
+
+			case STRING_VALUE_TYPE:
+				return DataColumn::STORAGE_STRING;
+
+			default:
+				break;
+			}
+
+			return DataColumn::STORAGE_EMPTY;
+		}
+
+
+		/**
+		 * Returns true if @a value_type is a number (bools and chars are not treated as numbers).
+		 */
+		bool
+		is_number(
+				int value_type)
+		{
+			return value_type == INT_VALUE_TYPE ||
+					value_type == UNSIGNED_VALUE_TYPE ||
+					value_type == FLOAT_VALUE_TYPE ||
+					value_type == DOUBLE_VALUE_TYPE;
+		}
+
+
+		/**
+		 * Converts an integer or real value to double.
+		 */
+		class ConvertOpaqueDataToReal :
+				public boost::static_visitor<double>
+		{
+		public:
+
+			double
+			operator()(
+					const empty_data_type) const
+			{
+				return 0;
+			}
+
+			double
+			operator()(
+					const QString &) const
+			{
+				return 0;
+			}
+
+			template <class Type>
+			double
+			operator()(
+					const Type data) const
+			{
+				return data;
+			}
+		};
+
+
+		/**
+		 * Converts a bool, int, unsigned or char value to an integer.
+		 */
+		class ConvertOpaqueDataToInteger :
+				public boost::static_visitor<qint64>
+		{
+		public:
+
+			qint64
+			operator()(
+					const empty_data_type) const
+			{
+				return 0;
+			}
+
+			qint64
+			operator()(
+					const float) const
+			{
+				return 0;
+			}
+
+			qint64
+			operator()(
+					const double) const
+			{
+				return 0;
+			}
+
+			qint64
+			operator()(
+					const QString &) const
+			{
+				return 0;
+			}
+
+			template <class Type>
+			qint64
+			operator()(
+					const Type data) const
+			{
+				return data;
+			}
+		};
+	}
+}
+
+
+GPlatesDataMining::DataColumn::DataColumn(
+		std::size_t num_rows) :
+	d_storage_type(STORAGE_EMPTY),
+	d_value_type(EMPTY_VALUE_TYPE),
+	d_is_set(num_rows, false)
+{
+}
+
+
+void
+GPlatesDataMining::DataColumn::resize(
+		std::size_t num_rows)
+{
+	d_is_set.resize(num_rows, false);
+
+	switch (d_storage_type)
+	{
+	case STORAGE_INTEGER:
+		d_integers.resize(num_rows);
+		break;
+	case STORAGE_REAL:
+		d_reals.resize(num_rows);
+		break;
+	case STORAGE_STRING:
+		d_string_indices.resize(num_rows);
+		break;
+	default:
+		break;
+	}
+}
+
+
+void
+GPlatesDataMining::DataColumn::set(
+		std::size_t row,
+		const OpaqueData &value)
+{
+	GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+			row < size(),
+			GPLATES_ASSERTION_SOURCE);
+
+	const int value_type = value.which();
+	if (value_type == EMPTY_VALUE_TYPE)
+	{
+		d_is_set[row] = false;
+		return;
+	}
+
+	if (d_storage_type == STORAGE_EMPTY)
+	{
+		// The first value determines the type of the column.
+		d_value_type = value_type;
+		d_storage_type = get_storage_type_of_value_type(value_type);
+		resize(size());
+	}
+	else if (value_type != d_value_type)
+	{
+		if (is_number(value_type) && is_number(d_value_type))
+		{
+			if (d_storage_type != STORAGE_REAL)
+			{
+				convert_to_real();
+			}
+			d_value_type = DOUBLE_VALUE_TYPE;
+		}
+		else if (d_storage_type != STORAGE_STRING)
+		{
+			convert_to_string();
+		}
+	}
+
+	switch (d_storage_type)
+	{
+	case STORAGE_INTEGER:
+		d_integers[row] = boost::apply_visitor(ConvertOpaqueDataToInteger(), value);
+		break;
+	case STORAGE_REAL:
+		d_reals[row] = boost::apply_visitor(ConvertOpaqueDataToReal(), value);
+		break;
+	case STORAGE_STRING:
+		d_string_indices[row] = intern_string(
+				boost::apply_visitor(ConvertOpaqueDataToString(), value));
+		break;
+	default:
+		break;
+	}
+
+	d_is_set[row] = true;
+}
+
+
+GPlatesDataMining::OpaqueData
+GPlatesDataMining::DataColumn::get(
+		std::size_t row) const
+{
+	if (row >= size() ||
+		!d_is_set[row])
+	{
+		return OpaqueData(EmptyData);
+	}
+
+	switch (d_value_type)
+	{
+	case BOOL_VALUE_TYPE:
+		return OpaqueData(d_integers[row] != 0);
+	case INT_VALUE_TYPE:
+		return OpaqueData(static_cast<int>(d_integers[row]));
+	case UNSIGNED_VALUE_TYPE:
+		return OpaqueData(static_cast<unsigned int>(d_integers[row]));
+	case CHAR_VALUE_TYPE:
+		return OpaqueData(static_cast<char>(d_integers[row]));
+	case FLOAT_VALUE_TYPE:
+		return OpaqueData(static_cast<float>(d_reals[row]));
+	case DOUBLE_VALUE_TYPE:
+		return OpaqueData(d_reals[row]);
+	case STRING_VALUE_TYPE:
+		return OpaqueData(d_strings[d_string_indices[row]]);
+	default:
+		break;
+	}
+
+	return OpaqueData(EmptyData);
+}
+
+
+QString
+GPlatesDataMining::DataColumn::get_as_string(
+		std::size_t row) const
+{
+	if (d_storage_type == STORAGE_STRING &&
+		row < size() &&
+		d_is_set[row])
+	{
+		// Avoid copying the string into an OpaqueData.
+		return d_strings[d_string_indices[row]];
+	}
+
+	return boost::apply_visitor(ConvertOpaqueDataToString(), get(row));
+}
+
+
+void
+GPlatesDataMining::DataColumn::write(
+		QDataStream &stream) const
+{
+	const std::size_t num_rows = size();
+
+	stream << static_cast<quint8>(d_storage_type) << static_cast<quint8>(d_value_type);
+
+	// The bitmask of non-empty cells (packed eight cells per byte).
+	for (std::size_t row = 0; row < num_rows; row += 8)
+	{
+		quint8 mask = 0;
+		for (std::size_t bit = 0; bit < 8 && row + bit < num_rows; ++bit)
+		{
+			if (d_is_set[row + bit])
+			{
+				mask |= (1 << bit);
+			}
+		}
+		stream << mask;
+	}
+
+	if (d_storage_type == STORAGE_STRING)
+	{
+		stream << static_cast<quint32>(d_strings.size());
+		for (unsigned int n = 0; n < d_strings.size(); ++n)
+		{
+			stream << d_strings[n];
+		}
+	}
+
+	// The values of the non-empty cells.
+	for (std::size_t row = 0; row < num_rows; ++row)
+	{
+		if (!d_is_set[row])
+		{
+			continue;
+		}
+
+		switch (d_storage_type)
+		{
+		case STORAGE_INTEGER:
+			stream << d_integers[row];
+			break;
+		case STORAGE_REAL:
+			stream << d_reals[row];
+			break;
+		case STORAGE_STRING:
+			stream << d_string_indices[row];
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+
+void
+GPlatesDataMining::DataColumn::convert_to_real()
+{
+	d_reals.resize(size());
+
+	for (std::size_t row = 0; row < size(); ++row)
+	{
+		if (d_is_set[row])
+		{
+			d_reals[row] = static_cast<double>(d_integers[row]);
+		}
+	}
+
+	std::vector<qint64>().swap(d_integers);
+	d_storage_type = STORAGE_REAL;
+}
+
+
+void
+GPlatesDataMining::DataColumn::convert_to_string()
+{
+	d_string_indices.resize(size());
+
+	for (std::size_t row = 0; row < size(); ++row)
+	{
+		if (d_is_set[row])
+		{
+			// Convert using the current value type.
+			d_string_indices[row] = intern_string(
+					boost::apply_visitor(ConvertOpaqueDataToString(), get(row)));
+		}
+	}
+
+	std::vector<qint64>().swap(d_integers);
+	std::vector<double>().swap(d_reals);
+	d_storage_type = STORAGE_STRING;
+	d_value_type = STRING_VALUE_TYPE;
+}
+
+
+quint32
+GPlatesDataMining::DataColumn::intern_string(
+		const QString &string)
+{
+	QHash<QString, quint32>::const_iterator iter = d_string_dictionary.find(string);
+	if (iter != d_string_dictionary.end())
+	{
+		return iter.value();
+	}
+
+	const quint32 string_index = d_strings.size();
+	d_strings.push_back(string);
+	d_string_dictionary.insert(string, string_index);
+
+	return string_index;
+}
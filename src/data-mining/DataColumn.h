@@ -0,0 +1,179 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_DATA_MINING_DATACOLUMN_H
+#define GPLATES_DATA_MINING_DATACOLUMN_H
+
+#include <cstddef>
+#include <vector>
+#include <QDataStream>
+#include <QHash>
+#include <QString>
+#include <QtGlobal>
+
+#include "OpaqueData.h"
+
+
+namespace GPlatesDataMining
+{
+	/**
+	 * A column of a @a DataTable.
+	 *
+	 * Unlike a sequence of @a OpaqueData variants, the cells are stored in a typed vector
+	 * (integers, reals or indices into a dictionary of distinct strings) and empty cells are
+	 * stored in a bitmask. This uses a fraction of the memory of a variant per cell, especially
+	 * for columns of repeated strings (such as feature IDs of seeds with many geometries).
+	 *
+	 * The type of the column is the type of the first (non-empty) value set in it.
+	 * If a value of a different type is set later then the column is converted to
+	 * double if both types are numbers (int, unsigned, float or double), otherwise to string.
+	 */
+	class DataColumn
+	{
+	public:
+
+		/**
+		 * How the cells of a column are stored.
+		 */
+		enum StorageType
+		{
+			STORAGE_EMPTY, // All cells are empty.
+			STORAGE_INTEGER, // bool, int, unsigned and char.
+			STORAGE_REAL, // float and double.
+			STORAGE_STRING // Index into the column's dictionary of strings.
+		};
+
+
+		explicit
+		DataColumn(
+				std::size_t num_rows = 0);
+
+
+		/**
+		 * The number of cells (rows) in this column.
+		 */
+		std::size_t
+		size() const
+		{
+			return d_is_set.size();
+		}
+
+		/**
+		 * Changes the number of cells (rows) - any new cells are empty.
+		 */
+		void
+		resize(
+				std::size_t num_rows);
+
+
+		StorageType
+		get_storage_type() const
+		{
+			return d_storage_type;
+		}
+
+		/**
+		 * Returns the type of the values in this column as the index of that type in the
+		 * @a OpaqueData variant (the index of empty_data_type if all cells are empty).
+		 */
+		int
+		get_value_type() const
+		{
+			return d_value_type;
+		}
+
+
+		bool
+		is_empty(
+				std::size_t row) const
+		{
+			return !d_is_set[row];
+		}
+
+		/**
+		 * Sets the cell at @a row (setting an empty @a OpaqueData empties the cell).
+		 */
+		void
+		set(
+				std::size_t row,
+				const OpaqueData &value);
+
+		/**
+		 * Returns the cell at @a row (an empty @a OpaqueData if the cell is empty).
+		 */
+		OpaqueData
+		get(
+				std::size_t row) const;
+
+		/**
+		 * Returns the cell at @a row converted to a string (see ConvertOpaqueDataToString).
+		 */
+		QString
+		get_as_string(
+				std::size_t row) const;
+
+
+		/**
+		 * Writes this column to @a stream in the binary columnar format of @a DataTable::export_as_binary.
+		 */
+		void
+		write(
+				QDataStream &stream) const;
+
+	private:
+
+		StorageType d_storage_type;
+
+		//! Index of the type of the values in the @a OpaqueData variant.
+		int d_value_type;
+
+		//! Bitmask of the non-empty cells.
+		std::vector<bool> d_is_set;
+
+		//
+		// Only one of these is used (depending on the storage type).
+		//
+		std::vector<qint64> d_integers;
+		std::vector<double> d_reals;
+		std::vector<quint32> d_string_indices;
+
+		//! The distinct strings in this column.
+		std::vector<QString> d_strings;
+		QHash<QString, quint32> d_string_dictionary;
+
+
+		/**
+		 * Converts all non-empty cells to double.
+		 */
+		void
+		convert_to_real();
+
+		/**
+		 * Converts all non-empty cells to strings.
+		 */
+		void
+		convert_to_string();
+
+		quint32
+		intern_string(
+				const QString &string);
+	};
+}
+
+#endif // GPLATES_DATA_MINING_DATACOLUMN_H
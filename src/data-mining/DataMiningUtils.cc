@@ -31,8 +31,12 @@
 #include "feature-visitors/ShapefileAttributeFinder.h"
 #include "file-io/FeatureCollectionFileFormatRegistry.h"
 #include "global/LogException.h"
+#include "maths/ConstGeometryOnSphereVisitor.h"
 #include "maths/GeometryDistance.h"
 #include "maths/MathsUtils.h"
+#include "maths/MultiPointOnSphere.h"
+#include "maths/PolygonOnSphere.h"
+#include "maths/PolylineOnSphere.h"
 #include "utils/Earth.h"
 
 #include "CoRegConfigurationTable.h"
@@ -51,6 +55,51 @@ using namespace GPlatesUtils;
 	#undef max
 #endif
 
+namespace
+{
+	/**
+	 * Calculates the cached calculations of a geometry that are used by distance queries.
+	 */
+	class PrepareForConcurrentDistanceQueries :
+			public GPlatesMaths::ConstGeometryOnSphereVisitor
+	{
+	public:
+		virtual
+		void
+		visit_multi_point_on_sphere(
+				GPlatesMaths::MultiPointOnSphere::non_null_ptr_to_const_type multi_point_on_sphere)
+		{
+			multi_point_on_sphere->get_bounding_small_circle();
+		}
+
+		virtual
+		void
+		visit_polygon_on_sphere(
+				GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type polygon_on_sphere)
+		{
+			polygon_on_sphere->get_bounding_small_circle();
+			polygon_on_sphere->get_inner_outer_bounding_small_circle();
+			polygon_on_sphere->get_bounding_tree();
+
+			// Build the high speed point-in-polygon structure (any point will do) so that subsequent
+			// adaptive point-in-polygon tests don't modify the polygon.
+			polygon_on_sphere->is_point_in_polygon(
+					*polygon_on_sphere->exterior_ring_vertex_begin(),
+					GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE);
+		}
+
+		virtual
+		void
+		visit_polyline_on_sphere(
+				GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type polyline_on_sphere)
+		{
+			polyline_on_sphere->get_bounding_small_circle();
+			polyline_on_sphere->get_bounding_tree();
+		}
+	};
+}
+
+
 boost::optional< double > 
 GPlatesDataMining::DataMiningUtils::minimum(
 		const std::vector< double >& input)
@@ -141,6 +190,15 @@ GPlatesDataMining::DataMiningUtils::shortest_distance(
 }
 
 
+void
+GPlatesDataMining::DataMiningUtils::prepare_for_concurrent_distance_queries(
+		const GPlatesMaths::GeometryOnSphere &geometry)
+{
+	PrepareForConcurrentDistanceQueries visitor;
+	geometry.accept_visitor(visitor);
+}
+
+
 GPlatesDataMining::OpaqueData
 GPlatesDataMining::DataMiningUtils::get_property_value_by_name(
 		const GPlatesModel::FeatureHandle* feature_ptr,
@@ -41,6 +41,8 @@
 #include "file-io/File.h"
 #include "file-io/ReadErrorAccumulation.h"
 
+#include "maths/GeometryOnSphere.h"
+
 #include "model/FeatureHandle.h"
 
 
@@ -93,6 +95,17 @@ namespace GPlatesDataMining
 		shortest_distance(
 				const std::vector<const GPlatesAppLogic::ReconstructedFeatureGeometry*>& first,
 				const std::vector<const GPlatesAppLogic::ReconstructedFeatureGeometry*>& second);
+
+		/*
+		* Calculates (and caches) everything that is otherwise lazily calculated (and cached)
+		* by a geometry when distances to it are queried (bounding small circles, bounding trees
+		* and point-in-polygon structures).
+		* Distances to the geometry can then be queried concurrently from multiple threads.
+		*/
+		void
+		prepare_for_concurrent_distance_queries(
+				const GPlatesMaths::GeometryOnSphere &geometry);
+
 		/*
 		* Given the feature handle, find a property by the name.
 		*/
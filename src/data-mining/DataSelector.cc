@@ -24,6 +24,7 @@
  */
 
 #include <algorithm>
+#include <limits>
 #include <map>
 #include <QCoreApplication>
 #include <QDebug>
@@ -34,6 +35,9 @@
 
 #include "CoRegFilterCache.h"
 #include "CoRegFilterMapReduceFactory.h"
+#include "CoRegGeometryDistanceCache.h"
+#include "CoRegTargetSpatialIndex.h"
+#include "CpuRasterCoRegistration.h"
 #include "DataSelector.h"
 #include "DataMiningUtils.h"
 #include "RegionOfInterestFilter.h"
@@ -44,17 +48,304 @@
 
 #include "feature-visitors/TotalReconstructionSequenceTimePeriodFinder.h"
 
+#include "global/AssertionFailureException.h"
+#include "global/GPlatesAssert.h"
+
 #include "maths/Real.h"
 #include "maths/SphericalArea.h"
 
 #include "opengl/GLRasterCoRegistration.h"
 
 #include "utils/Earth.h"
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 
 GPlatesDataMining::DataTable GPlatesDataMining::DataSelector::d_data_table;
 
 
+namespace GPlatesDataMining
+{
+	namespace
+	{
+		/**
+		 * Number of filtered target features mapped at a time when the reducer supports batches.
+		 */
+		const std::size_t MAP_REDUCE_BATCH_SIZE = 1024;
+
+
+		//! A raster is identified by its layer and the selected raster band name.
+		typedef std::pair<GPlatesAppLogic::Layer, GPlatesUtils::UnicodeString/*band name*/> raster_id_type;
+
+		//! A list of config row indices.
+		typedef std::vector<unsigned int> config_row_indices_seq_type;
+
+		//! Lookup a list of config row indices associated with a particular raster.
+		typedef std::map<raster_id_type, config_row_indices_seq_type> config_rows_from_raster_layer_lookup_type;
+
+
+		/**
+		 * Groups the rows in the configuration table that co-register target *rasters* by raster
+		 * (it's more efficient to submit multiple operations per raster).
+		 */
+		void
+		get_config_rows_from_raster_layers(
+				const CoRegConfigurationTable &cfg_table,
+				config_rows_from_raster_layer_lookup_type &config_rows_from_raster_layer_lookup)
+		{
+			// Iterate over the rows in the configuration table and group rows by raster layer.
+			for (unsigned int config_row_index = 0; config_row_index < cfg_table.size(); ++config_row_index)
+			{
+				const ConfigurationTableRow &config_row = cfg_table[config_row_index];
+
+				// If it's not a raster co-registration then ignore it - it's handled in a separate code path.
+				if (config_row.attr_type != CO_REGISTRATION_RASTER_ATTRIBUTE)
+				{
+					continue;
+				}
+
+				// The raster band name is the configuration attribute.
+				const GPlatesUtils::UnicodeString raster_band_name(config_row.attr_name);
+
+				// Associate the config row with the raster.
+				const raster_id_type raster_id = std::make_pair(config_row.target_layer, raster_band_name);
+				config_rows_from_raster_layer_lookup[raster_id].push_back(config_row_index);
+			}
+		}
+
+
+		/**
+		 * Stores the raster co-registration results of a config row (one per seed feature) in the result data table.
+		 */
+		void
+		store_raster_co_registration_results(
+				const ConfigurationTableRow &config_row,
+				const std::vector< boost::optional<double> > &co_reg_results,
+				DataTable &result_data_table)
+		{
+			// Should have a result for each seed feature.
+			GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+					co_reg_results.size() == result_data_table.size(),
+					GPLATES_ASSERTION_SOURCE);
+
+			for (unsigned int reconstructed_seed_feature_index = 0;
+				reconstructed_seed_feature_index < co_reg_results.size();
+				++reconstructed_seed_feature_index)
+			{
+				// If there's a result for the current seed feature then set it in the result data table,
+				// otherwise leave the table entry as it is (empty) to signal "N/A".
+				if (co_reg_results[reconstructed_seed_feature_index])
+				{
+					result_data_table.set_cell(
+							reconstructed_seed_feature_index,
+							config_row.index + result_data_table.data_index(),
+							co_reg_results[reconstructed_seed_feature_index].get());
+				}
+			}
+		}
+
+
+		//! Target geometries within the region of interest of a seed.
+		typedef std::vector<CoRegTargetSpatialIndex::region_of_interest_geometry_type>
+				region_of_interest_geometry_seq_type;
+
+		//! Spatial index of the reconstructed target geometries of each target layer.
+		typedef std::map<GPlatesAppLogic::Layer, boost::shared_ptr<CoRegTargetSpatialIndex> > target_spatial_index_map_type;
+
+		//! Index of each region-of-interest target layer.
+		typedef std::map<GPlatesAppLogic::Layer, unsigned int> region_of_interest_layer_index_map_type;
+
+
+		/**
+		 * The target layers of config rows with a region-of-interest filter (indexed in the order first
+		 * encountered), and the largest region-of-interest range of the config rows of each target layer.
+		 *
+		 * The target geometries of each layer within the largest range of each seed are found once
+		 * (and in parallel over the seeds) and then shared by all region-of-interest config rows of that layer.
+		 */
+		struct RegionOfInterestLayers
+		{
+			region_of_interest_layer_index_map_type layer_indices;
+			std::vector<GPlatesAppLogic::Layer> layers;
+			std::vector<GPlatesMaths::AngularExtent> max_ranges;
+		};
+
+
+		void
+		get_region_of_interest_layers(
+				const CoRegConfigurationTable &cfg_table,
+				RegionOfInterestLayers &region_of_interest_layers)
+		{
+			BOOST_FOREACH(const ConfigurationTableRow &config_row, cfg_table)
+			{
+				const RegionOfInterestFilter::Config *region_of_interest_filter_cfg =
+						dynamic_cast<const RegionOfInterestFilter::Config *>(config_row.filter_cfg.get());
+				if (config_row.attr_type == CO_REGISTRATION_RASTER_ATTRIBUTE ||
+					region_of_interest_filter_cfg == NULL)
+				{
+					continue;
+				}
+
+				const GPlatesMaths::AngularExtent range =
+						RegionOfInterestFilter::get_range_angular_extent(region_of_interest_filter_cfg->range());
+
+				std::pair<region_of_interest_layer_index_map_type::iterator, bool> region_of_interest_layer_index =
+						region_of_interest_layers.layer_indices.insert(
+								region_of_interest_layer_index_map_type::value_type(
+										config_row.target_layer,
+										region_of_interest_layers.layers.size()));
+				if (region_of_interest_layer_index.second)
+				{
+					region_of_interest_layers.layers.push_back(config_row.target_layer);
+					region_of_interest_layers.max_ranges.push_back(range);
+				}
+				else if (range.is_precisely_greater_than(
+					region_of_interest_layers.max_ranges[region_of_interest_layer_index.first->second]))
+				{
+					region_of_interest_layers.max_ranges[region_of_interest_layer_index.first->second] = range;
+				}
+			}
+		}
+
+
+		/**
+		 * The co-registration of target reconstructed geometries at one reconstruction time.
+		 */
+		struct GeometryCoRegistrationTimeStep
+		{
+			GeometryCoRegistrationTimeStep() :
+				reconstructed_seed_features(NULL),
+				result_data_table(NULL)
+			{  }
+
+			const std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> *reconstructed_seed_features;
+			DataTable *result_data_table;
+
+			target_spatial_index_map_type target_spatial_indices;
+
+			//! Spatial index of each region-of-interest target layer (NULL if layer output unavailable).
+			std::vector<const CoRegTargetSpatialIndex *> region_of_interest_target_spatial_indices;
+
+			//! The target geometries within the region of interest of each seed (indexed by seed and then
+			//! by region-of-interest target layer).
+			std::vector< std::vector<region_of_interest_geometry_seq_type> > seed_region_of_interest_geometries;
+		};
+
+
+		/**
+		 * Finds the target geometries within the region of interest of the seeds of a range of time steps
+		 * (called concurrently from multiple threads).
+		 *
+		 * The seeds of all the time steps are treated as a single range of items (so that time steps
+		 * are processed in parallel even if they each have only a few seeds).
+		 *
+		 * Each seed writes only to its own element of the results, and the seeds and spatial
+		 * indices are only read from, so there's no need for any locking
+		 * (see @a CoRegGeometryDistanceCache for the distance cache).
+		 */
+		class FindRegionOfInterestGeometries
+		{
+		public:
+
+			FindRegionOfInterestGeometries(
+					std::vector<GeometryCoRegistrationTimeStep> &time_steps,
+					unsigned int time_steps_begin,
+					unsigned int time_steps_end,
+					const std::vector<GPlatesMaths::AngularExtent> &region_of_interest_ranges,
+					CoRegGeometryDistanceCache *distance_cache) :
+				d_time_steps(time_steps),
+				d_time_steps_begin(time_steps_begin),
+				d_region_of_interest_ranges(region_of_interest_ranges),
+				d_distance_cache(distance_cache)
+			{
+				// The first (combined) seed index of each time step.
+				d_time_step_seed_offsets.push_back(0);
+				for (unsigned int time_step_index = time_steps_begin; time_step_index < time_steps_end; ++time_step_index)
+				{
+					d_time_step_seed_offsets.push_back(
+							d_time_step_seed_offsets.back() +
+								time_steps[time_step_index].reconstructed_seed_features->size());
+				}
+			}
+
+			//! The number of seeds in all time steps.
+			std::size_t
+			get_num_seeds() const
+			{
+				return d_time_step_seed_offsets.back();
+			}
+
+			void
+			operator()(
+					std::size_t seeds_begin,
+					std::size_t seeds_end) const
+			{
+				for (std::size_t seed = seeds_begin; seed < seeds_end; ++seed)
+				{
+					// Find the time step containing the seed (skips over any time steps with no seeds).
+					const std::size_t time_step_offset_index =
+							std::upper_bound(d_time_step_seed_offsets.begin(), d_time_step_seed_offsets.end(), seed) -
+								d_time_step_seed_offsets.begin() - 1;
+					GeometryCoRegistrationTimeStep &time_step = d_time_steps[d_time_steps_begin + time_step_offset_index];
+					const std::size_t seed_index = seed - d_time_step_seed_offsets[time_step_offset_index];
+
+					for (unsigned int layer_index = 0;
+						layer_index < time_step.region_of_interest_target_spatial_indices.size();
+						++layer_index)
+					{
+						const CoRegTargetSpatialIndex *target_spatial_index =
+								time_step.region_of_interest_target_spatial_indices[layer_index];
+						if (target_spatial_index == NULL)
+						{
+							continue;
+						}
+
+						target_spatial_index->find_region_of_interest_geometries(
+								(*time_step.reconstructed_seed_features)[seed_index],
+								d_region_of_interest_ranges[layer_index],
+								time_step.seed_region_of_interest_geometries[seed_index][layer_index],
+								d_distance_cache);
+					}
+				}
+			}
+
+		private:
+			std::vector<GeometryCoRegistrationTimeStep> &d_time_steps;
+			unsigned int d_time_steps_begin;
+			std::vector<std::size_t> d_time_step_seed_offsets;
+			const std::vector<GPlatesMaths::AngularExtent> &d_region_of_interest_ranges;
+			CoRegGeometryDistanceCache *d_distance_cache;
+		};
+
+
+		/**
+		 * Finds the target geometries within the region of interest of the seeds of the time steps
+		 * in the range [time_steps_begin, time_steps_end), in parallel.
+		 */
+		void
+		find_region_of_interest_geometries(
+				std::vector<GeometryCoRegistrationTimeStep> &time_steps,
+				unsigned int time_steps_begin,
+				unsigned int time_steps_end,
+				const std::vector<GPlatesMaths::AngularExtent> &region_of_interest_ranges,
+				CoRegGeometryDistanceCache *distance_cache)
+		{
+			const FindRegionOfInterestGeometries find_region_of_interest_geometries_functor(
+					time_steps,
+					time_steps_begin,
+					time_steps_end,
+					region_of_interest_ranges,
+					distance_cache);
+
+			GPlatesUtils::ParallelUtils::parallel_for(
+					find_region_of_interest_geometries_functor.get_num_seeds(),
+					find_region_of_interest_geometries_functor,
+					// Not worth starting threads for a handful of seeds...
+					16/*min_items_per_chunk*/);
+		}
+	}
+}
+
+
 // The BOOST_FOREACH macro in versions of boost before 1.37 uses the same local
 // variable name in each instantiation. Nested BOOST_FOREACH macros therefore
 // cause GCC to warn about shadowed declarations.
@@ -68,6 +359,56 @@ GPlatesDataMining::DataSelector::select(
 		const double &reconstruction_time,
 		GPlatesDataMining::DataTable &result_data_table,
 		boost::optional<RasterCoRegistration> co_register_rasters)
+{
+	select_time_steps(
+			std::vector<double>(1, reconstruction_time),
+			std::vector<const reconstructed_feature_seq_type *>(1, &reconstructed_seed_features),
+			target_layer_proxies,
+			std::vector<DataTable *>(1, &result_data_table),
+			co_register_rasters,
+			NULL/*distance_cache*/);
+}
+
+
+void
+GPlatesDataMining::DataSelector::select_time_series(
+		const std::vector<double> &reconstruction_times,
+		const std::vector<reconstructed_feature_seq_type> &reconstructed_seed_features,
+		const std::vector<GPlatesAppLogic::LayerProxy::non_null_ptr_type> &target_layer_proxies,
+		const std::vector<DataTable *> &result_data_tables,
+		boost::optional<RasterCoRegistration> co_register_rasters,
+		CoRegGeometryDistanceCache &distance_cache)
+{
+	// Should have seeds and a result table for each reconstruction time.
+	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+			reconstructed_seed_features.size() == reconstruction_times.size() &&
+				result_data_tables.size() == reconstruction_times.size(),
+			GPLATES_ASSERTION_SOURCE);
+
+	std::vector<const reconstructed_feature_seq_type *> reconstructed_seed_features_ptrs;
+	BOOST_FOREACH(const reconstructed_feature_seq_type &seeds, reconstructed_seed_features)
+	{
+		reconstructed_seed_features_ptrs.push_back(&seeds);
+	}
+
+	select_time_steps(
+			reconstruction_times,
+			reconstructed_seed_features_ptrs,
+			target_layer_proxies,
+			result_data_tables,
+			co_register_rasters,
+			&distance_cache);
+}
+
+
+void
+GPlatesDataMining::DataSelector::select_time_steps(
+		const std::vector<double> &reconstruction_times,
+		const std::vector<const reconstructed_feature_seq_type *> &reconstructed_seed_features,
+		const std::vector<GPlatesAppLogic::LayerProxy::non_null_ptr_type> &target_layer_proxies,
+		const std::vector<DataTable *> &result_data_tables,
+		boost::optional<RasterCoRegistration> co_register_rasters,
+		CoRegGeometryDistanceCache *distance_cache)
 {
 	if (!is_config_table_valid(target_layer_proxies))
 	{
@@ -75,50 +416,71 @@ GPlatesDataMining::DataSelector::select(
 				"or not connected to this co-registration layer - skipping co-registration altogether.";
 		return;
 	}
-		
-	result_data_table.set_data_index(d_data_index);
-	result_data_table.set_table_header(d_table_header);
 
-	//
-	// Set up the co-registration result table.
-	//
-
-	BOOST_FOREACH(
-			const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
-			reconstructed_seed_features)
+	for (unsigned int time_step_index = 0; time_step_index < reconstruction_times.size(); ++time_step_index)
 	{
-		DataRowSharedPtr row = DataRowSharedPtr(new DataRow); 
-		fill_seed_info(reconstructed_seed_feature, row);
-		//append placeholder for real data below.
-		row->append(d_cfg_table.size(), EmptyData);
+		const double reconstruction_time = reconstruction_times[time_step_index];
+		const reconstructed_feature_seq_type &time_step_reconstructed_seed_features =
+				*reconstructed_seed_features[time_step_index];
+		DataTable &result_data_table = *result_data_tables[time_step_index];
+
+		result_data_table.set_data_index(d_data_index);
+		result_data_table.set_table_header(d_table_header);
+		result_data_table.set_reconstruction_time(reconstruction_time);
+
+		//
+		// Set up the co-registration result table.
+		//
+
+		// A row per seed feature - the co-registration results (one per config row) are initially empty.
+		result_data_table.resize(
+				time_step_reconstructed_seed_features.size(),
+				d_data_index + d_cfg_table.size());
+
+		for (unsigned int reconstructed_seed_feature_index = 0;
+			reconstructed_seed_feature_index < time_step_reconstructed_seed_features.size();
+			++reconstructed_seed_feature_index)
+		{
+			fill_seed_info(
+					time_step_reconstructed_seed_features[reconstructed_seed_feature_index],
+					result_data_table,
+					reconstructed_seed_feature_index);
+		}
 
-		result_data_table.push_back(row);
-	}
+		//
+		// Handle the configuration rows that co-register target *rasters*.
+		//
 
-	//
-	// Handle the configuration rows that co-register target *rasters*.
-	//
+		// If the necessary OpenGL extensions for raster co-registration are available then co-register
+		// using OpenGL, otherwise co-register on the CPU.
+		// The median operation is not supported by OpenGL and is always co-registered on the CPU.
+		if (co_register_rasters)
+		{
+			co_register_target_reconstructed_rasters(
+					co_register_rasters->renderer,
+					co_register_rasters->co_registration,
+					time_step_reconstructed_seed_features,	
+					reconstruction_time,
+					result_data_table);
+		}
 
-	// If the necessary OpenGL extensions for raster co-registration are available then co-register,
-	// otherwise leave the result data table entries are they are.
-	if (co_register_rasters)
-	{
-		co_register_target_reconstructed_rasters(
-				co_register_rasters->renderer,
-				co_register_rasters->co_registration,
-				reconstructed_seed_features,	
+		co_register_target_reconstructed_rasters_on_cpu(
+				time_step_reconstructed_seed_features,
 				reconstruction_time,
-				result_data_table);
+				result_data_table,
+				!co_register_rasters/*all_operations*/);
 	}
 
 	//
-	// Handle the configuration rows that co-register target reconstructed *geometries*.
+	// Handle the configuration rows that co-register target reconstructed *geometries*
+	// (for all time steps at once so that the time steps can be processed in parallel).
 	//
 
 	co_register_target_reconstructed_geometries(
-			reconstructed_seed_features,	
-			reconstruction_time,
-			result_data_table);
+			reconstruction_times,
+			reconstructed_seed_features,
+			result_data_tables,
+			distance_cache);
 }
 
 // See above
@@ -137,35 +499,8 @@ GPlatesDataMining::DataSelector::co_register_target_reconstructed_rasters(
 	const CoRegConfigurationTable &const_cfg_table = d_cfg_table;
 
 	// Group rows by raster layer - it's more efficient to submit multiple operations per raster.
-	// A raster is identified by its layer and the selected raster band name.
-	typedef std::pair<GPlatesAppLogic::Layer, GPlatesUtils::UnicodeString/*band name*/> raster_id_type;
-	// A list of config row indices.
-	typedef std::vector<unsigned int> config_row_indices_seq_type;
-	// Lookup a list of config row indices associated with a particular raster.
-	typedef std::map<raster_id_type, config_row_indices_seq_type> config_rows_from_raster_layer_lookup_type;
 	config_rows_from_raster_layer_lookup_type config_rows_from_raster_layer_lookup;
-
-	// Iterate over the rows in the configuration table and group rows by raster layer.
-	for (unsigned int config_row_index = 0; config_row_index < const_cfg_table.size(); ++config_row_index)
-	{
-		const ConfigurationTableRow &config_row = const_cfg_table[config_row_index];
-
-		// If it's not a raster co-registration then ignore it - it's handled in a separate code path.
-		if (config_row.attr_type != CO_REGISTRATION_RASTER_ATTRIBUTE)
-		{
-			continue;
-		}
-
-		// The target raster layer.
-		const GPlatesAppLogic::Layer target_layer = config_row.target_layer;
-
-		// The raster band name is the configuration attribute.
-		const GPlatesUtils::UnicodeString raster_band_name(config_row.attr_name);
-
-		// Associate the config row with the raster.
-		const raster_id_type raster_id = std::make_pair(target_layer, raster_band_name);
-		config_rows_from_raster_layer_lookup[raster_id].push_back(config_row_index);
-	}
+	get_config_rows_from_raster_layers(const_cfg_table, config_rows_from_raster_layer_lookup);
 
 	// Iterate over the raster layers and co-register all operations for each raster as a group.
 	BOOST_FOREACH(
@@ -244,6 +579,9 @@ GPlatesDataMining::DataSelector::co_register_target_reconstructed_rasters(
 			case REDUCER_STANDARD_DEVIATION:
 				operation_type = GPlatesOpenGL::GLRasterCoRegistration::OPERATION_STANDARD_DEVIATION;
 				break;
+			case REDUCER_MEDIAN:
+				// Not supported by OpenGL - see 'co_register_target_reconstructed_rasters_on_cpu()'.
+				continue;
 			default:
 				// Should not get any other reducer types for rasters - skip this config row.
 				qWarning() << "DataSelector: Unexpected reduce operation for raster - skipping co-registration.";
@@ -272,6 +610,10 @@ GPlatesDataMining::DataSelector::co_register_target_reconstructed_rasters(
 		GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
 				raster_operations.size() == operation_config_row_indices.size(),
 				GPLATES_ASSERTION_SOURCE);
+		if (raster_operations.empty())
+		{
+			continue;
+		}
 
 		// Co-register the reconstructed seed features with the reconstructed raster for all the
 		// operations associated with the current raster.
@@ -289,68 +631,174 @@ GPlatesDataMining::DataSelector::co_register_target_reconstructed_rasters(
 			const unsigned int config_row_index = operation_config_row_indices[operation_index];
 			const ConfigurationTableRow &config_row = const_cfg_table[config_row_index];
 
-			// Get the co-registration results.
-			const GPlatesOpenGL::GLRasterCoRegistration::Operation::result_seq_type &co_reg_results =
-					raster_operations[operation_index].get_co_registration_results();
-
-			// Should have a result for each seed feature.
-			GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
-					co_reg_results.size() == reconstructed_seed_features.size(),
-					GPLATES_ASSERTION_SOURCE);
-			// Store the results in the result data table.
-			for (unsigned int reconstructed_seed_feature_index = 0;
-				reconstructed_seed_feature_index < reconstructed_seed_features.size();
-				++reconstructed_seed_feature_index)
-			{
-				// If there's a result for the current seed feature then set it in the result data table,
-				// otherwise leave the table entry as it is (empty) to signal "N/A".
-				if (co_reg_results[reconstructed_seed_feature_index])
-				{
-					DataRow &result_data_row = *result_data_table[reconstructed_seed_feature_index];
-
-					result_data_row[config_row.index + result_data_table.data_index()] = 
-							co_reg_results[reconstructed_seed_feature_index].get();
-				}
-			}
+			// Store the co-registration results in the result data table.
+			store_raster_co_registration_results(
+					config_row,
+					raster_operations[operation_index].get_co_registration_results(),
+					result_data_table);
 		}
 	}
 }
 
 
 void
-GPlatesDataMining::DataSelector::co_register_target_reconstructed_geometries(
+GPlatesDataMining::DataSelector::co_register_target_reconstructed_rasters_on_cpu(
 		const std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> &reconstructed_seed_features,	
 		const double &reconstruction_time,
-		GPlatesDataMining::DataTable &result_data_table)
+		GPlatesDataMining::DataTable &result_data_table,
+		bool all_operations)
 {
-	//for each seed feature
-	for (unsigned int reconstructed_seed_feature_index = 0;
-		reconstructed_seed_feature_index < reconstructed_seed_features.size();
-		++reconstructed_seed_feature_index)
+	// Need to iterate over 'const' table.
+	const CoRegConfigurationTable &const_cfg_table = d_cfg_table;
+
+	// Group rows by raster layer - it's more efficient to submit multiple operations per raster.
+	config_rows_from_raster_layer_lookup_type config_rows_from_raster_layer_lookup;
+	get_config_rows_from_raster_layers(const_cfg_table, config_rows_from_raster_layer_lookup);
+
+	// Iterate over the raster layers and co-register all operations for each raster as a group.
+	BOOST_FOREACH(
+			config_rows_from_raster_layer_lookup_type::value_type &config_rows_from_raster_layer,
+			config_rows_from_raster_layer_lookup)
 	{
-		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature =
-				reconstructed_seed_features[reconstructed_seed_feature_index];
+		// The raster id.
+		const raster_id_type &raster_id = config_rows_from_raster_layer.first;
+
+		// The config row indices associated with the current raster.
+		const config_row_indices_seq_type &raster_config_row_indices = config_rows_from_raster_layer.second;
+
+		// The operations to co-register for the current raster.
+		std::vector<CpuRasterCoRegistration::Operation> raster_operations;
+
+		// Config row indices that are indexed using the operation index.
+		std::vector<unsigned int> operation_config_row_indices;
+
+		// Select the highest resolution level-of-detail requested for the current raster
+		// (it gets clamped to the lowest resolution level-of-detail available).
+		unsigned int raster_level_of_detail = std::numeric_limits<unsigned int>::max();
+
+		BOOST_FOREACH(const unsigned int config_row_index, raster_config_row_indices)
+		{
+			const ConfigurationTableRow &config_row = const_cfg_table[config_row_index];
+
+			// The reducer operation.
+			CpuRasterCoRegistration::OperationType operation_type;
+			switch (config_row.reducer_type)
+			{
+			case REDUCER_MIN:
+				operation_type = CpuRasterCoRegistration::OPERATION_MINIMUM;
+				break;
+			case REDUCER_MAX:
+				operation_type = CpuRasterCoRegistration::OPERATION_MAXIMUM;
+				break;
+			case REDUCER_MEAN:
+				operation_type = CpuRasterCoRegistration::OPERATION_MEAN;
+				break;
+			case REDUCER_STANDARD_DEVIATION:
+				operation_type = CpuRasterCoRegistration::OPERATION_STANDARD_DEVIATION;
+				break;
+			case REDUCER_MEDIAN:
+				operation_type = CpuRasterCoRegistration::OPERATION_MEDIAN;
+				break;
+			default:
+				// Should not get any other reducer types for rasters - skip this config row
+				// (the OpenGL path, if any, has already warned).
+				if (all_operations)
+				{
+					qWarning() << "DataSelector: Unexpected reduce operation for raster - skipping co-registration.";
+				}
+				continue;
+			}
+
+			// Operations other than median are co-registered using OpenGL if it's available.
+			if (!all_operations &&
+				operation_type != CpuRasterCoRegistration::OPERATION_MEDIAN)
+			{
+				continue;
+			}
+
+			// The region-of-interest range in Kms.
+			const double range = dynamic_cast<const RegionOfInterestFilter::Config &>(*config_row.filter_cfg).range();
+
+			if (config_row.raster_level_of_detail < raster_level_of_detail)
+			{
+				raster_level_of_detail = config_row.raster_level_of_detail;
+			}
+
+			raster_operations.push_back(
+					CpuRasterCoRegistration::Operation(
+							range / GPlatesUtils::Earth::EQUATORIAL_RADIUS_KMS /* angular radial extent in radians */,
+							operation_type,
+							config_row.raster_fill_polygons));
+			operation_config_row_indices.push_back(config_row_index);
+		}
+
+		if (raster_operations.empty())
+		{
+			continue;
+		}
+
+		// Get the target raster layer proxy.
+		boost::optional<GPlatesAppLogic::RasterLayerProxy::non_null_ptr_type> target_layer_proxy =
+				raster_id.first.get_layer_output<GPlatesAppLogic::RasterLayerProxy>();
+		if (!target_layer_proxy)
+		{
+			qWarning() << "DataSelector: Unable to get raster layer output - skipping co-registration.";
+			continue;
+		}
 
-		if(reconstructed_seed_feature.get_reconstructions().size() == 0)
+		if (!CpuRasterCoRegistration::co_register(
+				raster_operations,
+				reconstructed_seed_features,
+				*target_layer_proxy.get(),
+				reconstruction_time,
+				raster_id.second,
+				raster_level_of_detail))
 		{
-			//No reconstructed-feature-geometry means the seed feature is inactive at this time.
-			//if the seed is inactive, no need to calculate any data for it.
-			//leave all data in inactive seed row as "Nan". -- fix for Jo
+			qWarning() << "DataSelector: Raster co-registration without OpenGL (or using the median) "
+					"is only supported for unreconstructed rasters in lat/lon coordinates - skipping co-registration.";
 			continue;
 		}
 
-		DataRow &result_data_row = *result_data_table[reconstructed_seed_feature_index];
+		// Distribute the co-registration results back to the appropriate config row.
+		for (unsigned int operation_index = 0; operation_index < raster_operations.size(); ++operation_index)
+		{
+			store_raster_co_registration_results(
+					const_cfg_table[operation_config_row_indices[operation_index]],
+					raster_operations[operation_index].get_co_registration_results(),
+					result_data_table);
+		}
+	}
+}
+
 
-		CoRegFilterCache filter_cache;
+void
+GPlatesDataMining::DataSelector::co_register_target_reconstructed_geometries(
+		const std::vector<double> &reconstruction_times,
+		const std::vector<const reconstructed_feature_seq_type *> &reconstructed_seed_features,
+		const std::vector<DataTable *> &result_data_tables,
+		CoRegGeometryDistanceCache *distance_cache)
+{
+	// Need to iterate over 'const' table.
+	const CoRegConfigurationTable &const_cfg_table = d_cfg_table;
 
-		// Need to iterate over 'const' table.
-		const CoRegConfigurationTable &const_cfg_table = d_cfg_table;
+	RegionOfInterestLayers region_of_interest_layers;
+	get_region_of_interest_layers(const_cfg_table, region_of_interest_layers);
 
-		//for each row in cfg table
+	std::vector<GeometryCoRegistrationTimeStep> time_steps(reconstruction_times.size());
+	for (unsigned int time_step_index = 0; time_step_index < time_steps.size(); ++time_step_index)
+	{
+		GeometryCoRegistrationTimeStep &time_step = time_steps[time_step_index];
+		time_step.reconstructed_seed_features = reconstructed_seed_features[time_step_index];
+		time_step.result_data_table = result_data_tables[time_step_index];
+
+		// Spatially index the reconstructed target geometries of each target layer once
+		// (instead of once per seed feature and config row) and share it across the config rows
+		// that co-register with the same target layer.
 		BOOST_FOREACH(const ConfigurationTableRow &config_row, const_cfg_table)
 		{
 			// If it's a raster co-registration then ignore it - it's handled in a separate code path.
-			if (config_row.attr_type == CO_REGISTRATION_RASTER_ATTRIBUTE)
+			if (config_row.attr_type == CO_REGISTRATION_RASTER_ATTRIBUTE ||
+				time_step.target_spatial_indices.find(config_row.target_layer) != time_step.target_spatial_indices.end())
 			{
 				continue;
 			}
@@ -366,42 +814,216 @@ GPlatesDataMining::DataSelector::co_register_target_reconstructed_geometries(
 			}
 
 			// Get the reconstructed target features.
-			std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> reconstructed_target_features;
+			reconstructed_feature_seq_type reconstructed_target_features;
 			target_layer_proxy.get()->get_reconstructed_features(
 					reconstructed_target_features,
-					reconstruction_time);
+					reconstruction_times[time_step_index]);
 
-			boost::shared_ptr< CoRegFilter > filter;
-			boost::shared_ptr< CoRegMapper > mapper;
-			boost::shared_ptr<CoRegReducer> reducer;
-			boost::tie(filter,mapper,reducer)=
-					create_filter_map_reduce(config_row, reconstructed_seed_feature);
+			time_step.target_spatial_indices[target_layer] = CoRegTargetSpatialIndex::create(reconstructed_target_features);
+		}
 
-			//filter
-			CoRegFilter::reconstructed_feature_vector_type filter_result, cache_hit;
-			if(filter_cache.find(config_row, cache_hit))
+		if (region_of_interest_layers.layers.empty())
+		{
+			continue;
+		}
+
+		BOOST_FOREACH(const GPlatesAppLogic::Layer &region_of_interest_layer, region_of_interest_layers.layers)
+		{
+			target_spatial_index_map_type::const_iterator target_spatial_index_iter =
+					time_step.target_spatial_indices.find(region_of_interest_layer);
+			time_step.region_of_interest_target_spatial_indices.push_back(
+					(target_spatial_index_iter != time_step.target_spatial_indices.end())
+							? target_spatial_index_iter->second.get()
+							: NULL);
+		}
+
+		time_step.seed_region_of_interest_geometries.resize(
+				time_step.reconstructed_seed_features->size(),
+				std::vector<region_of_interest_geometry_seq_type>(region_of_interest_layers.layers.size()));
+
+		// Prepare the seed geometries so that distances to them can be queried concurrently
+		// (the target geometries were prepared when they were spatially indexed).
+		BOOST_FOREACH(
+				const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
+				*time_step.reconstructed_seed_features)
+		{
+			BOOST_FOREACH(
+					const GPlatesAppLogic::ReconstructContext::Reconstruction &reconstructed_seed_geom,
+					reconstructed_seed_feature.get_reconstructions())
 			{
-				filter->process(
-						cache_hit.begin(),
-						cache_hit.end(),
-						filter_result);
+				DataMiningUtils::prepare_for_concurrent_distance_queries(
+						*reconstructed_seed_geom.get_reconstructed_feature_geometry()->reconstructed_geometry());
 			}
-			else
+		}
+	}
+
+	//
+	// Find the target geometries within the region of interest of each seed in parallel
+	// (over the seeds of all time steps).
+	//
+
+	if (!region_of_interest_layers.layers.empty() &&
+		!time_steps.empty())
+	{
+		unsigned int time_steps_begin = 0;
+
+		// If the distance cache has not yet recorded any distances then record them at the first time step,
+		// and then re-use them for the remaining time steps.
+		if (distance_cache &&
+			!distance_cache->is_recorded())
+		{
+			distance_cache->begin_recording(*time_steps.front().reconstructed_seed_features);
+			find_region_of_interest_geometries(
+					time_steps, 0, 1, region_of_interest_layers.max_ranges, distance_cache);
+			distance_cache->end_recording();
+
+			time_steps_begin = 1;
+		}
+
+		find_region_of_interest_geometries(
+				time_steps, time_steps_begin, time_steps.size(), region_of_interest_layers.max_ranges, distance_cache);
+	}
+
+	//
+	// Map and reduce on this thread (in seed order) since the mappers access the model, and
+	// the filtered target features contain feature weak-refs, neither of which are thread-safe.
+	//
+
+	BOOST_FOREACH(const GeometryCoRegistrationTimeStep &time_step, time_steps)
+	{
+		const reconstructed_feature_seq_type &time_step_reconstructed_seed_features =
+				*time_step.reconstructed_seed_features;
+		DataTable &result_data_table = *time_step.result_data_table;
+
+		//for each seed feature
+		for (unsigned int reconstructed_seed_feature_index = 0;
+			reconstructed_seed_feature_index < time_step_reconstructed_seed_features.size();
+			++reconstructed_seed_feature_index)
+		{
+			const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature =
+					time_step_reconstructed_seed_features[reconstructed_seed_feature_index];
+
+			if(reconstructed_seed_feature.get_reconstructions().size() == 0)
 			{
-				filter->process(
-						reconstructed_target_features.begin(),
-						reconstructed_target_features.end(),
-						filter_result);
+				//No reconstructed-feature-geometry means the seed feature is inactive at this time.
+				//if the seed is inactive, no need to calculate any data for it.
+				//leave all data in inactive seed row as "Nan". -- fix for Jo
+				continue;
 			}
-			filter_cache.insert(config_row,filter_result);
 
-			//map
-			CoRegMapper::MapperOutDataset map_result;
-			mapper->process(filter_result.begin(), filter_result.end(), map_result);
+			CoRegFilterCache filter_cache;
+
+			//for each row in cfg table
+			BOOST_FOREACH(const ConfigurationTableRow &config_row, const_cfg_table)
+			{
+				// If it's a raster co-registration then ignore it - it's handled in a separate code path.
+				if (config_row.attr_type == CO_REGISTRATION_RASTER_ATTRIBUTE)
+				{
+					continue;
+				}
 
-			//reduce
-			result_data_row[config_row.index + result_data_table.data_index()] = 
-					reducer->process(map_result.begin(), map_result.end());
+				// Get the spatial index of the reconstructed target features.
+				// If there's none then we were unable to get the target layer output (and already warned).
+				target_spatial_index_map_type::const_iterator target_spatial_index_iter =
+						time_step.target_spatial_indices.find(config_row.target_layer);
+				if (target_spatial_index_iter == time_step.target_spatial_indices.end())
+				{
+					continue;
+				}
+				const CoRegTargetSpatialIndex &target_spatial_index = *target_spatial_index_iter->second;
+
+				boost::shared_ptr< CoRegFilter > filter;
+				boost::shared_ptr< CoRegMapper > mapper;
+				boost::shared_ptr<CoRegReducer> reducer;
+				boost::tie(filter,mapper,reducer)=
+						create_filter_map_reduce(config_row, reconstructed_seed_feature);
+
+				//filter
+				CoRegFilter::reconstructed_feature_vector_type filter_result, cache_hit;
+				if (const RegionOfInterestFilter::Config *region_of_interest_filter_cfg =
+					dynamic_cast<const RegionOfInterestFilter::Config *>(config_row.filter_cfg.get()))
+				{
+					// Select the target geometries (already found within the largest range of the
+					// target layer) that are within the range of this config row.
+					const GPlatesMaths::AngularExtent range =
+							RegionOfInterestFilter::get_range_angular_extent(region_of_interest_filter_cfg->range());
+					const region_of_interest_geometry_seq_type &region_of_interest_geometries =
+							time_step.seed_region_of_interest_geometries[reconstructed_seed_feature_index]
+									[region_of_interest_layers.layer_indices[config_row.target_layer]];
+
+					std::vector<CoRegTargetSpatialIndex::geometry_index_type> geometry_indices;
+					BOOST_FOREACH(
+							const CoRegTargetSpatialIndex::region_of_interest_geometry_type &region_of_interest_geometry,
+							region_of_interest_geometries)
+					{
+						if (region_of_interest_geometry.second.is_precisely_less_than(range))
+						{
+							geometry_indices.push_back(region_of_interest_geometry.first);
+						}
+					}
+
+					target_spatial_index.get_reconstructed_features(geometry_indices, filter_result);
+				}
+				else
+				{
+					if(filter_cache.find(config_row, cache_hit))
+					{
+						filter->process(
+								cache_hit.begin(),
+								cache_hit.end(),
+								filter_result);
+					}
+					else
+					{
+						filter->process(
+								target_spatial_index.get_reconstructed_features().begin(),
+								target_spatial_index.get_reconstructed_features().end(),
+								filter_result);
+					}
+					filter_cache.insert(config_row,filter_result);
+				}
+
+				if (mapper->supports_batches() && reducer->supports_batches())
+				{
+					// Map and reduce in batches so that the mapped values of all filtered target
+					// features are not held in memory at once.
+					CoRegMapper::MapperOutDataset map_result;
+					map_result.reserve((std::min)(MAP_REDUCE_BATCH_SIZE, filter_result.size()));
+
+					reducer->begin_batches();
+					for (std::size_t batch_begin = 0;
+						batch_begin < filter_result.size();
+						batch_begin += MAP_REDUCE_BATCH_SIZE)
+					{
+						const std::size_t batch_end =
+								(std::min)(batch_begin + MAP_REDUCE_BATCH_SIZE, filter_result.size());
+
+						map_result.clear();
+						mapper->process(
+								filter_result.begin() + batch_begin,
+								filter_result.begin() + batch_end,
+								map_result);
+						reducer->process_batch(map_result.begin(), map_result.end());
+					}
+
+					result_data_table.set_cell(
+							reconstructed_seed_feature_index,
+							config_row.index + result_data_table.data_index(),
+							reducer->end_batches());
+				}
+				else
+				{
+					//map
+					CoRegMapper::MapperOutDataset map_result;
+					mapper->process(filter_result.begin(), filter_result.end(), map_result);
+
+					//reduce
+					result_data_table.set_cell(
+							reconstructed_seed_feature_index,
+							config_row.index + result_data_table.data_index(),
+							reducer->process(map_result.begin(), map_result.end()));
+				}
+			}
 		}
 	}
 }
@@ -447,15 +1069,18 @@ GPlatesDataMining::DataSelector::is_config_table_valid(
 void
 GPlatesDataMining::DataSelector::fill_seed_info(
 		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
-		DataRowSharedPtr row)
+		DataTable &result_data_table,
+		std::size_t row_index)
 {
 	//Write out feature id as the first column so that each data row can be correlated. 
 	//This is a temporary solution and will be removed when layer framework is ready to handle this.
 	QString feature_id = reconstructed_seed_feature.get_feature()->feature_id().get().qstring();
-	row->append_cell(OpaqueData(feature_id));
+	result_data_table.set_cell(row_index, 0, OpaqueData(feature_id));
 
 	//seed valid time.
-	row->append_cell(
+	result_data_table.set_cell(
+			row_index,
+			1,
 			DataMiningUtils::get_property_value_by_name(
 					reconstructed_seed_feature.get_feature(),
 					"validTime"));
@@ -519,6 +1144,12 @@ GPlatesDataMining::DataSelector::populate_table_header()
 		case REDUCER_NUM_IN_ROI:
 			column_header += "(number-in-region)";
 			break;
+		case REDUCER_APPROXIMATE_MEDIAN:
+			column_header += "(approx-median)";
+			break;
+		case REDUCER_APPROXIMATE_VOTE:
+			column_header += "(approx-vote)";
+			break;
 
 		default:
 			// Do nothing.
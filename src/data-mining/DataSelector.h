@@ -57,10 +57,15 @@ namespace GPlatesOpenGL
 
 namespace GPlatesDataMining
 {
+	class CoRegGeometryDistanceCache;
+
 	class DataSelector
 	{
 	public:
 
+		//! Typedef for a sequence of reconstructed (seed or target) features.
+		typedef std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> reconstructed_feature_seq_type;
+
 		//! Used for co-registering target rasters.
 		struct RasterCoRegistration
 		{
@@ -88,9 +93,9 @@ namespace GPlatesDataMining
 		/**
 		 * Given the seed and target, select() will return the associated data in DataTable.
 		 *
-		 * Note that @a co_register_rasters is required for *raster* co-registration since
-		 * (raster co-registration is accelerated using OpenGL).
-		 * If @a co_register_rasters is boost::none then any target layers that are rasters will not be co-registered.
+		 * Note that @a co_register_rasters is used to accelerate *raster* co-registration using OpenGL.
+		 * If @a co_register_rasters is boost::none then target layers that are rasters are co-registered
+		 * on the CPU instead (only supported for unreconstructed rasters in lat/lon coordinates).
 		 */
 		void
 		select(
@@ -100,6 +105,28 @@ namespace GPlatesDataMining
 				DataTable &result_data_table,
 				boost::optional<RasterCoRegistration> co_register_rasters);
 
+		/**
+		 * Co-registers a time series - the seeds reconstructed at each of @a reconstruction_times
+		 * are co-registered into the corresponding table in @a result_data_tables.
+		 *
+		 * This is equivalent to calling @a select at each reconstruction time except that the
+		 * region-of-interest queries of all time steps are processed in parallel, and the distances
+		 * between seed and target geometries that have not moved relative to each other
+		 * (eg, on the same plate) are re-used across time steps (see @a CoRegGeometryDistanceCache).
+		 *
+		 * The distances are recorded in @a distance_cache at the first reconstruction time
+		 * (if @a distance_cache has not already recorded them) so the same @a distance_cache can be passed
+		 * to subsequent calls to co-register a long time series in batches of reconstruction times.
+		 */
+		void
+		select_time_series(
+				const std::vector<double> &reconstruction_times,
+				const std::vector<reconstructed_feature_seq_type> &reconstructed_seed_features,
+				const std::vector<GPlatesAppLogic::LayerProxy::non_null_ptr_type> &target_layer_proxies,
+				const std::vector<DataTable *> &result_data_tables,
+				boost::optional<RasterCoRegistration> co_register_rasters,
+				CoRegGeometryDistanceCache &distance_cache);
+
 		static
 		void
 		set_data_table(
@@ -139,7 +166,22 @@ namespace GPlatesDataMining
 		void
 		fill_seed_info(
 				const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
-				DataRowSharedPtr);
+				DataTable &result_data_table,
+				std::size_t row_index);
+
+		/**
+		 * Co-registers the seeds at each reconstruction time into the corresponding result table.
+		 *
+		 * @a distance_cache is optional (can be NULL).
+		 */
+		void
+		select_time_steps(
+				const std::vector<double> &reconstruction_times,
+				const std::vector<const reconstructed_feature_seq_type *> &reconstructed_seed_features,
+				const std::vector<GPlatesAppLogic::LayerProxy::non_null_ptr_type> &target_layer_proxies,
+				const std::vector<DataTable *> &result_data_tables,
+				boost::optional<RasterCoRegistration> co_register_rasters,
+				CoRegGeometryDistanceCache *distance_cache);
 
 		void
 		co_register_target_reconstructed_rasters(
@@ -149,11 +191,29 @@ namespace GPlatesDataMining
 				const double &reconstruction_time,
 				GPlatesDataMining::DataTable &result_data_table);
 
+		/**
+		 * Co-registers target rasters on the CPU (see CpuRasterCoRegistration).
+		 *
+		 * If @a all_operations is false then only the operations not supported by OpenGL (median) are co-registered.
+		 */
 		void
-		co_register_target_reconstructed_geometries(
+		co_register_target_reconstructed_rasters_on_cpu(
 				const std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> &reconstructed_seed_features,	
 				const double &reconstruction_time,
-				GPlatesDataMining::DataTable &result_data_table);
+				GPlatesDataMining::DataTable &result_data_table,
+				bool all_operations);
+
+		/**
+		 * Co-registers target reconstructed geometries at each reconstruction time.
+		 *
+		 * @a distance_cache is optional (can be NULL).
+		 */
+		void
+		co_register_target_reconstructed_geometries(
+				const std::vector<double> &reconstruction_times,
+				const std::vector<const reconstructed_feature_seq_type *> &reconstructed_seed_features,
+				const std::vector<DataTable *> &result_data_tables,
+				CoRegGeometryDistanceCache *distance_cache);
 
 		//default constructor
 		DataSelector();
@@ -22,19 +22,48 @@
  * with this program; if not, write to Free Software Foundation, Inc.,
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
+#include <algorithm>
+#include <boost/bind.hpp>
+#include <QDataStream>
+#include <QDebug>
+#include <QFile>
+
 #include "gui/CsvExport.h"
 
 #include "DataTable.h"
 #include "OpaqueDataToQString.h"
 
+#include "file-io/ErrorOpeningFileForWritingException.h"
+
 #include "global/CompilerWarnings.h"
+#include "global/LogException.h"
 
 
-void
-GPlatesDataMining::DataRow::append_cell(
-		const OpaqueData &val)
+namespace
 {
-	d_data.push_back(val);
+	//! The magic bytes at the start of a binary columnar table file.
+	const char BINARY_TABLE_MAGIC[] = "GPTABLE";
+	const int BINARY_TABLE_MAGIC_SIZE = sizeof(BINARY_TABLE_MAGIC); // Includes the terminating zero.
+
+	//! The current version of the binary columnar table format.
+	const quint32 BINARY_TABLE_VERSION = 1;
+
+
+	void
+	get_csv_line(
+			const GPlatesDataMining::DataTable &table,
+			std::size_t line_index,
+			GPlatesGui::CsvExport::LineDataType &line)
+	{
+		// The first line is the table header.
+		if (line_index == 0)
+		{
+			line = table.table_header();
+			return;
+		}
+
+		table.get_row_as_strings(line_index - 1, line);
+	}
 }
 
 
@@ -42,43 +71,191 @@ void
 GPlatesDataMining::DataTable::export_as_CSV(
 		const QString& filename) const
 {
-	std::vector<GPlatesGui::CsvExport::LineDataType> vector_table;
-
-	vector_table.push_back(d_table_header);
-	to_qstring_table(vector_table);
-	
 	GPlatesGui::CsvExport::ExportOptions opt;
 	opt.delimiter = ',';
+
+	// Convert each row to strings as it's written (rather than converting the entire table first).
 	GPlatesGui::CsvExport::export_data(
 			filename, 
 			opt, 
-			vector_table);
+			1 + d_num_rows/*header*/,
+			boost::bind(&get_csv_line, boost::cref(*this), _1, _2));
 }
 
+
+void
+GPlatesDataMining::DataTable::export_as_binary(
+		const QString& filename) const
+{
+	QFile file(filename);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		throw GPlatesFileIO::ErrorOpeningFileForWritingException(
+				GPLATES_EXCEPTION_SOURCE,
+				filename);
+	}
+
+	QDataStream out(&file);
+	out.setVersion(QDataStream::Qt_5_6);
+	out.setByteOrder(QDataStream::LittleEndian);
+	out.setFloatingPointPrecision(QDataStream::DoublePrecision);
+
+	out.writeRawData(BINARY_TABLE_MAGIC, BINARY_TABLE_MAGIC_SIZE);
+	out << BINARY_TABLE_VERSION
+		<< d_reconstruction_time
+		<< static_cast<quint32>(d_data_index)
+		<< static_cast<quint64>(d_num_rows)
+		<< static_cast<quint32>(d_columns.size());
+
+	out << static_cast<quint32>(d_table_header.size());
+	for (unsigned int n = 0; n < d_table_header.size(); ++n)
+	{
+		out << d_table_header[n];
+	}
+
+	for (unsigned int column_index = 0; column_index < d_columns.size(); ++column_index)
+	{
+		d_columns[column_index].write(out);
+	}
+
+	// Flush any buffered data so that failures to write it are also reported.
+	file.flush();
+
+	if (out.status() != QDataStream::Ok ||
+		file.error() != QFileDevice::NoError)
+	{
+		const QString error_string = (file.error() != QFileDevice::NoError)
+				? file.errorString()
+				: QString("data stream status %1").arg(out.status());
+		throw GPlatesGlobal::LogException(
+				GPLATES_EXCEPTION_SOURCE,
+				QString("Error writing binary table file \"%1\": %2").arg(filename).arg(error_string));
+	}
+}
+
+
+void
+GPlatesDataMining::DataTable::resize(
+		std::size_t num_rows,
+		std::size_t num_columns)
+{
+	d_num_rows = num_rows;
+
+	d_columns.resize(num_columns, DataColumn(num_rows));
+	for (unsigned int column_index = 0; column_index < num_columns; ++column_index)
+	{
+		d_columns[column_index].resize(num_rows);
+	}
+}
+
+
+void
+GPlatesDataMining::DataTable::get_cell(
+		std::size_t row_index,
+		std::size_t column_index,
+		OpaqueData& ret) const
+{
+	if (row_index >= d_num_rows ||
+		column_index >= d_columns.size())
+	{
+		qWarning() << "Invalid cell index into co-registration data table.";
+		return;
+	}
+
+	ret = d_columns[column_index].get(row_index);
+}
+
+
+QString
+GPlatesDataMining::DataTable::get_cell_as_string(
+		std::size_t row_index,
+		std::size_t column_index) const
+{
+	if (row_index >= d_num_rows ||
+		column_index >= d_columns.size())
+	{
+		qWarning() << "Invalid cell index into co-registration data table.";
+		return QString();
+	}
+
+	return d_columns[column_index].get_as_string(row_index);
+}
+
+
+void
+GPlatesDataMining::DataTable::get_row_as_strings(
+		std::size_t row_index,
+		std::vector<QString> &row) const
+{
+	row.reserve(row.size() + d_columns.size());
+
+	for (unsigned int column_index = 0; column_index < d_columns.size(); ++column_index)
+	{
+		row.push_back(d_columns[column_index].get_as_string(row_index));
+	}
+}
+
+
 void
 GPlatesDataMining::DataTable::to_qstring_table(
 		std::vector<std::vector<QString> >& table) const
 {
-	const_iterator iter = begin(), iter_end = end();
-
-	for(; iter != iter_end; iter++) //for each row
+	for (std::size_t row_index = 0; row_index < d_num_rows; ++row_index) //for each row
 	{
 		std::vector<QString> line;
-		//get each cell
-		for(unsigned i = 0; i < (*iter)->size(); i++)
-		{
-			OpaqueData o_data;
-			(*iter)->get_cell(i, o_data);
+		get_row_as_strings(row_index, line);
+		table.push_back(line);
+	}
+}
+
+
+void
+GPlatesDataMining::create_long_format_data_table(
+		const std::vector<const DataTable *> &data_tables,
+		DataTable &long_format_data_table)
+{
+	std::size_t num_rows = 0;
+	std::size_t num_columns = 0;
+	for (unsigned int table_index = 0; table_index < data_tables.size(); ++table_index)
+	{
+		num_rows += data_tables[table_index]->size();
+		num_columns = (std::max)(num_columns, data_tables[table_index]->num_columns());
+	}
+
+	// The reconstruction time is the first column.
+	long_format_data_table.resize(num_rows, 1 + num_columns);
 
-			line.push_back(
-				boost::apply_visitor(
-				GPlatesDataMining::ConvertOpaqueDataToString(),
-				o_data));
+	if (!data_tables.empty())
+	{
+		TableHeader table_header(1, "Reconstruction Time");
+		table_header.insert(
+				table_header.end(),
+				data_tables.front()->table_header().begin(),
+				data_tables.front()->table_header().end());
+		long_format_data_table.set_table_header(table_header);
+		long_format_data_table.set_data_index(1 + data_tables.front()->data_index());
+		long_format_data_table.set_reconstruction_time(data_tables.front()->reconstruction_time());
+	}
+
+	std::size_t long_format_row_index = 0;
+	for (unsigned int table_index = 0; table_index < data_tables.size(); ++table_index)
+	{
+		const DataTable &data_table = *data_tables[table_index];
+		const OpaqueData reconstruction_time(data_table.reconstruction_time());
+
+		for (std::size_t row_index = 0; row_index < data_table.size(); ++row_index, ++long_format_row_index)
+		{
+			long_format_data_table.set_cell(long_format_row_index, 0, reconstruction_time);
 
+			for (std::size_t column_index = 0; column_index < data_table.num_columns(); ++column_index)
+			{
+				long_format_data_table.set_cell(
+						long_format_row_index,
+						1 + column_index,
+						data_table.column(column_index).get(row_index));
+			}
 		}
-		table.push_back(line);
 	}
-	return;
 }
 
 
@@ -87,25 +264,16 @@ GPlatesDataMining::operator<<(
 		std::ostream& os,
 		const DataTable& table)
 {
-	DataTable::const_iterator iter = table.begin(), iter_end = table.end();
-
-	for(; iter != iter_end; iter++) //for each row
+	for (std::size_t row_index = 0; row_index < table.size(); ++row_index) //for each row
 	{
 		//get each cell
-		for(unsigned i = 0; i < (*iter)->size(); i++)
+		for (std::size_t column_index = 0; column_index < table.num_columns(); ++column_index)
 		{
-			OpaqueData o_data;
-			(*iter)->get_cell(i,o_data);
-
 			os	<< "{ " 
-				<< boost::apply_visitor(
-						GPlatesDataMining::ConvertOpaqueDataToString(),
-						o_data).toStdString() 
-						<< " }";
+				<< table.get_cell_as_string(row_index, column_index).toStdString()
+				<< " }";
 		}
 		os << std::endl;
 	}
 	return os;
 }
-
-
@@ -29,75 +29,33 @@
 #include <vector>
 #include <iostream>
 
-#include <QDebug>
 #include <QString>
 
-#include <boost/shared_ptr.hpp>
-#include <boost/optional.hpp>
-#include <boost/variant.hpp>
-
+#include "DataColumn.h"
 #include "OpaqueData.h"
 
-namespace GPlatesAppLogic
-{
-	class ReconstructedFeatureGeometry;
-}
 
 namespace GPlatesDataMining
 {
-	class DataRow;
-
 	typedef std::vector< QString > TableHeader;
-	typedef boost::shared_ptr<DataRow> DataRowSharedPtr;
 
-	class DataRow
+	/**
+	 * The co-registration results - a row per seed geometry and a column per seed attribute
+	 * (such as feature ID) followed by a column per co-registration configuration row.
+	 *
+	 * The table is stored by column (see @a DataColumn) since the cells in a column all
+	 * have the same type. This uses much less memory than a variant per cell for large tables.
+	 */
+	class DataTable
 	{
 	public:
-		void
-		get_cell(
-				unsigned column_index,
-				OpaqueData& ret) const
-		{
-			if(column_index >= d_data.size())
-			{
-				qWarning() << "Invalid column index into co-registration data row.";
-				return;
-			}
-			ret = d_data[column_index];			
-		}
-
-		void
-		append_cell(
-				const OpaqueData& val);
-
-		void
-		append(
-				std::size_t len,
-				const OpaqueData& val)
-		{
-			d_data.insert(d_data.end(), len, val);
-		}
-		
-		OpaqueData&
-		operator[](std::size_t index)
-		{
-			return d_data[index];
-		}
 
-		size_t
-		size()
-		{
-			return d_data.size();
-		}
-
-	protected:
-		std::vector< OpaqueData > d_data;
-	};
+		DataTable() :
+			d_reconstruction_time(0),
+			d_data_index(0),
+			d_num_rows(0)
+		{  }
 
-	class DataTable : 
-		public std::vector<DataRowSharedPtr>
-	{
-	public:
 		const TableHeader &
 		table_header() const
 		{
@@ -119,15 +77,32 @@ namespace GPlatesDataMining
 
 		void
 		set_reconstruction_time(
-					double& new_time)
+					const double& new_time)
 		{
 			d_reconstruction_time = new_time;
 		}
 
+		/**
+		 * Export as comma-separated values (including the table header).
+		 */
 		void 
 		export_as_CSV(
 				const QString& filename) const;
 
+		/**
+		 * Export in a binary columnar format.
+		 *
+		 * The (little-endian) file contains a header (magic bytes, version, reconstruction time,
+		 * data index, number of rows and columns, and the table header) followed by each column
+		 * (see @a DataColumn::write).
+		 *
+		 * @throws ErrorOpeningFileForWritingException if the file could not be opened.
+		 * @throws LogException (containing the file or data stream error) if the file could not be written.
+		 */
+		void
+		export_as_binary(
+				const QString& filename) const;
+
 		std::size_t
 		data_index() const
 		{
@@ -141,36 +116,114 @@ namespace GPlatesDataMining
 			d_data_index = idx;
 		}
 
+		/**
+		 * The number of rows.
+		 */
+		std::size_t
+		size() const
+		{
+			return d_num_rows;
+		}
+
+		bool
+		empty() const
+		{
+			return d_num_rows == 0;
+		}
+
+		std::size_t
+		num_columns() const
+		{
+			return d_columns.size();
+		}
+
+		/**
+		 * Changes the number of rows and columns - any new cells are empty.
+		 */
+		void
+		resize(
+				std::size_t num_rows,
+				std::size_t num_columns);
+
+		/**
+		 * Sets the cell at (@a row_index, @a column_index).
+		 *
+		 * The row and column indices must be within the size of the table (see @a resize).
+		 */
+		void
+		set_cell(
+				std::size_t row_index,
+				std::size_t column_index,
+				const OpaqueData &value)
+		{
+			d_columns[column_index].set(row_index, value);
+		}
+
+		/**
+		 * Gets the cell at (@a row_index, @a column_index) - an empty @a OpaqueData if the cell is empty.
+		 */
+		void
+		get_cell(
+				std::size_t row_index,
+				std::size_t column_index,
+				OpaqueData& ret) const;
+
+		/**
+		 * Gets the cell at (@a row_index, @a column_index) converted to a string.
+		 */
+		QString
+		get_cell_as_string(
+				std::size_t row_index,
+				std::size_t column_index) const;
+
+		const DataColumn &
+		column(
+				std::size_t column_index) const
+		{
+			return d_columns[column_index];
+		}
+
+		/**
+		 * Appends each row (as strings) to @a table.
+		 */
 		void
 		to_qstring_table(
 				std::vector<std::vector<QString> >&) const;
 
+		/**
+		 * Gets the row at @a row_index as strings.
+		 */
+		void
+		get_row_as_strings(
+				std::size_t row_index,
+				std::vector<QString> &row) const;
+
 
 	protected:
 		TableHeader d_table_header;
 		double d_reconstruction_time;
 		std::size_t d_data_index;
 
+		std::size_t d_num_rows;
+		std::vector<DataColumn> d_columns;
 	};
 
 	std::ostream &
 	operator<<(
 			std::ostream& os,
 			const DataTable& table);
+
+	/**
+	 * Concatenates the rows of @a data_tables (typically one table per reconstruction time of a
+	 * time series) into a single "long-format" table whose first column is the reconstruction time
+	 * of each row.
+	 *
+	 * The tables are expected to have the same columns (the table header is taken from the first table).
+	 */
+	void
+	create_long_format_data_table(
+			const std::vector<const DataTable *> &data_tables,
+			DataTable &long_format_data_table);
 }
 
 #endif
-
-
-
-
-
-
-
-
-
-
-
-
-
-
@@ -0,0 +1,149 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "FrequentValueSummary.h"
+
+
+GPlatesDataMining::FrequentValueSummary::FrequentValueSummary(
+		unsigned int max_num_counters) :
+	d_max_num_counters((std::max)(max_num_counters, 1U))
+{
+}
+
+
+void
+GPlatesDataMining::FrequentValueSummary::add(
+		const QString &value)
+{
+	count_map_type::iterator count_iter = d_counts.find(value);
+	if (count_iter != d_counts.end())
+	{
+		++count_iter.value();
+		return;
+	}
+
+	if (static_cast<unsigned int>(d_counts.size()) < d_max_num_counters)
+	{
+		d_counts.insert(value, 1);
+		return;
+	}
+
+	// All counters are in use so replace the value with the smallest count.
+	count_map_type::iterator smallest_count_iter = d_counts.begin();
+	for (count_map_type::iterator iter = d_counts.begin(); iter != d_counts.end(); ++iter)
+	{
+		if (iter.value() < smallest_count_iter.value())
+		{
+			smallest_count_iter = iter;
+		}
+	}
+
+	const unsigned int smallest_count = smallest_count_iter.value();
+	d_counts.erase(smallest_count_iter);
+	d_counts.insert(value, smallest_count + 1);
+}
+
+
+void
+GPlatesDataMining::FrequentValueSummary::merge(
+		const FrequentValueSummary &other)
+{
+	for (count_map_type::const_iterator other_iter = other.d_counts.begin();
+		other_iter != other.d_counts.end();
+		++other_iter)
+	{
+		d_counts[other_iter.key()] += other_iter.value();
+	}
+
+	remove_smallest_counts();
+}
+
+
+boost::optional<QString>
+GPlatesDataMining::FrequentValueSummary::get_most_frequent_value() const
+{
+	if (empty())
+	{
+		return boost::none;
+	}
+
+	count_map_type::const_iterator most_frequent_iter = d_counts.begin();
+	for (count_map_type::const_iterator iter = d_counts.begin(); iter != d_counts.end(); ++iter)
+	{
+		if (iter.value() > most_frequent_iter.value() ||
+			(iter.value() == most_frequent_iter.value() && iter.key() < most_frequent_iter.key()))
+		{
+			most_frequent_iter = iter;
+		}
+	}
+
+	return most_frequent_iter.key();
+}
+
+
+void
+GPlatesDataMining::FrequentValueSummary::remove_smallest_counts()
+{
+	if (static_cast<unsigned int>(d_counts.size()) <= d_max_num_counters)
+	{
+		return;
+	}
+
+	// Find the count of the last value that is kept.
+	std::vector<unsigned int> counts(d_counts.begin(), d_counts.end());
+	std::nth_element(
+			counts.begin(),
+			counts.begin() + (d_max_num_counters - 1),
+			counts.end(),
+			std::greater<unsigned int>());
+	const unsigned int min_kept_count = counts[d_max_num_counters - 1];
+
+	// Remove values with smaller counts, and then values with the same count until the maximum is reached.
+	unsigned int num_values_to_remove = d_counts.size() - d_max_num_counters;
+	for (count_map_type::iterator iter = d_counts.begin();
+		iter != d_counts.end() && num_values_to_remove > 0; )
+	{
+		if (iter.value() < min_kept_count)
+		{
+			iter = d_counts.erase(iter);
+			--num_values_to_remove;
+		}
+		else
+		{
+			++iter;
+		}
+	}
+	for (count_map_type::iterator iter = d_counts.begin();
+		iter != d_counts.end() && num_values_to_remove > 0; )
+	{
+		if (iter.value() == min_kept_count)
+		{
+			iter = d_counts.erase(iter);
+			--num_values_to_remove;
+		}
+		else
+		{
+			++iter;
+		}
+	}
+}
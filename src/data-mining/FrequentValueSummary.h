@@ -0,0 +1,106 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATESDATAMINING_FREQUENTVALUESUMMARY_H
+#define GPLATESDATAMINING_FREQUENTVALUESUMMARY_H
+
+#include <boost/optional.hpp>
+#include <QHash>
+#include <QString>
+
+
+namespace GPlatesDataMining
+{
+	/**
+	 * Finds the most frequent value in a stream of values using a bounded number of counters
+	 * (the "space-saving" algorithm).
+	 *
+	 * When a value arrives that is not counted and all counters are in use, the value replaces
+	 * the value with the smallest count (and inherits that count plus one). Any value that occurs
+	 * more often than 1/N of the time (where N is the maximum number of counters) is guaranteed
+	 * to be counted, and the most frequent value is found exactly if its count exceeds the
+	 * second-highest count by more than the smallest count.
+	 *
+	 * Summaries of separate streams (eg, accumulated on separate threads) can be merged with @a merge.
+	 */
+	class FrequentValueSummary
+	{
+	public:
+
+		//! The default maximum number of values counted at any time.
+		static const unsigned int DEFAULT_MAX_NUM_COUNTERS = 64;
+
+
+		explicit
+		FrequentValueSummary(
+				unsigned int max_num_counters = DEFAULT_MAX_NUM_COUNTERS);
+
+
+		/**
+		 * Returns true if no values have been added.
+		 */
+		bool
+		empty() const
+		{
+			return d_counts.isEmpty();
+		}
+
+
+		/**
+		 * Counts one occurrence of @a value.
+		 */
+		void
+		add(
+				const QString &value);
+
+
+		/**
+		 * Adds the counts of @a other to this summary.
+		 */
+		void
+		merge(
+				const FrequentValueSummary &other);
+
+
+		/**
+		 * Returns the (estimated) most frequent value, or none if @a empty.
+		 *
+		 * Ties are broken by choosing the lexicographically smallest value.
+		 */
+		boost::optional<QString>
+		get_most_frequent_value() const;
+
+	private:
+
+		typedef QHash<QString, unsigned int> count_map_type;
+
+
+		unsigned int d_max_num_counters;
+		count_map_type d_counts;
+
+
+		/**
+		 * Removes the values with the smallest counts until no more than the maximum number remain.
+		 */
+		void
+		remove_smallest_counts();
+	};
+}
+
+#endif // GPLATESDATAMINING_FREQUENTVALUESUMMARY_H
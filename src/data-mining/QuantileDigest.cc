@@ -0,0 +1,210 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+
+#include "QuantileDigest.h"
+
+#include "global/GPlatesAssert.h"
+#include "global/PreconditionViolationError.h"
+
+
+GPlatesDataMining::QuantileDigest::QuantileDigest(
+		unsigned int compression) :
+	d_compression((std::max)(compression, 1U)),
+	d_total_weight(0),
+	d_min(0),
+	d_max(0)
+{
+}
+
+
+void
+GPlatesDataMining::QuantileDigest::add(
+		const double &value,
+		const double &weight)
+{
+	GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+			weight > 0,
+			GPLATES_ASSERTION_SOURCE);
+
+	if (empty())
+	{
+		d_min = d_max = value;
+	}
+	else
+	{
+		if (value < d_min)
+		{
+			d_min = value;
+		}
+		if (value > d_max)
+		{
+			d_max = value;
+		}
+	}
+
+	d_unmerged_centroids.push_back(Centroid(value, weight));
+	d_total_weight += weight;
+
+	if (d_unmerged_centroids.size() >= get_max_unmerged_centroids())
+	{
+		compress();
+	}
+}
+
+
+void
+GPlatesDataMining::QuantileDigest::merge(
+		const QuantileDigest &other)
+{
+	if (other.empty())
+	{
+		return;
+	}
+
+	if (empty())
+	{
+		d_min = other.d_min;
+		d_max = other.d_max;
+	}
+	else
+	{
+		d_min = (std::min)(d_min, other.d_min);
+		d_max = (std::max)(d_max, other.d_max);
+	}
+
+	d_unmerged_centroids.insert(
+			d_unmerged_centroids.end(),
+			other.d_centroids.begin(),
+			other.d_centroids.end());
+	d_unmerged_centroids.insert(
+			d_unmerged_centroids.end(),
+			other.d_unmerged_centroids.begin(),
+			other.d_unmerged_centroids.end());
+	d_total_weight += other.d_total_weight;
+
+	compress();
+}
+
+
+double
+GPlatesDataMining::QuantileDigest::get_quantile(
+		const double &quantile)
+{
+	GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+			!empty(),
+			GPLATES_ASSERTION_SOURCE);
+
+	compress();
+
+	if (quantile <= 0)
+	{
+		return d_min;
+	}
+	if (quantile >= 1)
+	{
+		return d_max;
+	}
+
+	// Each centroid is considered to be centred at the middle of the range of (weighted) ranks it covers.
+	// Interpolate between the means of the two centroids whose centres straddle the requested rank.
+	const double rank = quantile * d_total_weight;
+
+	// Before the centre of the first centroid, interpolate from the minimum value.
+	double centre = 0.5 * d_centroids.front().weight;
+	if (rank < centre)
+	{
+		return d_min + (d_centroids.front().mean - d_min) * rank / centre;
+	}
+
+	for (centroid_seq_type::size_type n = 0; n + 1 < d_centroids.size(); ++n)
+	{
+		const Centroid &centroid = d_centroids[n];
+		const Centroid &next_centroid = d_centroids[n + 1];
+
+		const double next_centre = centre + 0.5 * (centroid.weight + next_centroid.weight);
+		if (rank < next_centre)
+		{
+			const double interpolate = (rank - centre) / (next_centre - centre);
+			return centroid.mean + interpolate * (next_centroid.mean - centroid.mean);
+		}
+
+		centre = next_centre;
+	}
+
+	// After the centre of the last centroid, interpolate to the maximum value.
+	const double remaining_weight = d_total_weight - centre;
+	if (remaining_weight <= 0)
+	{
+		return d_max;
+	}
+
+	return d_centroids.back().mean +
+			(d_max - d_centroids.back().mean) * (rank - centre) / remaining_weight;
+}
+
+
+void
+GPlatesDataMining::QuantileDigest::compress()
+{
+	if (d_unmerged_centroids.empty())
+	{
+		return;
+	}
+
+	// Merge the existing centroids with the unmerged centroids and sort by mean.
+	// Re-use the unmerged sequence (its capacity is retained for the next batch of values).
+	d_unmerged_centroids.insert(
+			d_unmerged_centroids.end(),
+			d_centroids.begin(),
+			d_centroids.end());
+	std::sort(d_unmerged_centroids.begin(), d_unmerged_centroids.end());
+
+	d_centroids.clear();
+
+	// Greedily combine adjacent centroids as long as the combined weight stays within the limit
+	// for its quantile. The limit is proportional to q(1-q) so that centroids in the tails
+	// stay small (accurate) while those near the median can grow large.
+	Centroid current_centroid = d_unmerged_centroids.front();
+	double weight_before_current_centroid = 0;
+	for (centroid_seq_type::size_type n = 1; n < d_unmerged_centroids.size(); ++n)
+	{
+		const Centroid &next_centroid = d_unmerged_centroids[n];
+
+		const double combined_weight = current_centroid.weight + next_centroid.weight;
+		const double quantile = (weight_before_current_centroid + 0.5 * combined_weight) / d_total_weight;
+		const double max_weight = 4 * d_total_weight * quantile * (1 - quantile) / d_compression;
+
+		if (combined_weight <= max_weight)
+		{
+			current_centroid.mean += (next_centroid.mean - current_centroid.mean) * next_centroid.weight / combined_weight;
+			current_centroid.weight = combined_weight;
+		}
+		else
+		{
+			d_centroids.push_back(current_centroid);
+			weight_before_current_centroid += current_centroid.weight;
+			current_centroid = next_centroid;
+		}
+	}
+	d_centroids.push_back(current_centroid);
+
+	d_unmerged_centroids.clear();
+}
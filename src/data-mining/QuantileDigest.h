@@ -0,0 +1,155 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATESDATAMINING_QUANTILEDIGEST_H
+#define GPLATESDATAMINING_QUANTILEDIGEST_H
+
+#include <vector>
+
+
+namespace GPlatesDataMining
+{
+	/**
+	 * Estimates quantiles (such as the median) of a stream of values in bounded memory
+	 * (a merging t-digest).
+	 *
+	 * Values are clustered into weighted centroids. Centroids near the tails of the distribution
+	 * are kept small (and hence accurate) while those near the median are allowed to grow larger.
+	 * The number of centroids (and hence memory usage) depends only on the compression, and not
+	 * on the number of values added.
+	 *
+	 * Digests of separate streams (eg, accumulated on separate threads) can be merged with @a merge.
+	 */
+	class QuantileDigest
+	{
+	public:
+
+		/**
+		 * The default compression - quantiles are typically estimated to within about 0.5% of rank
+		 * near the median (and much better near the tails) using a few hundred centroids.
+		 */
+		static const unsigned int DEFAULT_COMPRESSION = 100;
+
+
+		/**
+		 * Higher @a compression uses more memory (roughly proportional) but is more accurate.
+		 */
+		explicit
+		QuantileDigest(
+				unsigned int compression = DEFAULT_COMPRESSION);
+
+
+		/**
+		 * Returns true if no values have been added.
+		 */
+		bool
+		empty() const
+		{
+			return d_total_weight == 0;
+		}
+
+
+		/**
+		 * Adds a value with the specified weight (which must be positive).
+		 */
+		void
+		add(
+				const double &value,
+				const double &weight = 1.0);
+
+
+		/**
+		 * Adds the values summarised by @a other to this digest.
+		 */
+		void
+		merge(
+				const QuantileDigest &other);
+
+
+		/**
+		 * Returns the estimated value at @a quantile (in the range [0,1] - 0.5 is the median).
+		 *
+		 * The minimum and maximum added values are returned exactly for quantiles 0 and 1.
+		 *
+		 * NOTE: The digest must not be @a empty.
+		 *
+		 * NOTE: This is non-const since it first compresses any values added since the last call.
+		 */
+		double
+		get_quantile(
+				const double &quantile);
+
+	private:
+
+		struct Centroid
+		{
+			Centroid(
+					const double &mean_,
+					const double &weight_) :
+				mean(mean_),
+				weight(weight_)
+			{  }
+
+			bool
+			operator<(
+					const Centroid &rhs) const
+			{
+				return mean < rhs.mean;
+			}
+
+			double mean;
+			double weight;
+		};
+
+		typedef std::vector<Centroid> centroid_seq_type;
+
+
+		unsigned int d_compression;
+
+		//! Compressed centroids (sorted by mean) - only modified by @a compress.
+		centroid_seq_type d_centroids;
+
+		//! Values (and merged centroids) not yet compressed into @a d_centroids.
+		centroid_seq_type d_unmerged_centroids;
+
+		//! Total weight of @a d_centroids and @a d_unmerged_centroids.
+		double d_total_weight;
+
+		double d_min;
+		double d_max;
+
+
+		/**
+		 * Merges @a d_unmerged_centroids into @a d_centroids (if there are any).
+		 */
+		void
+		compress();
+
+		/**
+		 * The maximum number of unmerged centroids before they get compressed.
+		 */
+		centroid_seq_type::size_type
+		get_max_unmerged_centroids() const
+		{
+			return 5 * d_compression;
+		}
+	};
+}
+
+#endif // GPLATESDATAMINING_QUANTILEDIGEST_H
@@ -108,6 +108,13 @@ namespace GPlatesDataMining
 			}
 		}
 
+		bool
+		supports_batches() const
+		{
+			// Presence and number-in-region produce a single output for the entire input.
+			return d_attr_type == DISTANCE_ATTRIBUTE;
+		}
+
 		virtual
 		~RFGToRelationalPropertyMapper(){ }			
 
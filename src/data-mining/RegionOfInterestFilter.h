@@ -33,6 +33,7 @@
 
 #include "app-logic/ReconstructedFeatureGeometry.h"
 
+#include "maths/AngularExtent.h"
 #include "maths/GeometryDistance.h"
 #include "maths/MathsUtils.h"
 
@@ -51,9 +52,28 @@ namespace GPlatesDataMining
 				const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature, 
 				const double range):
 			d_reconstructed_seed_feature(reconstructed_seed_feature),
-			d_range(range)
+			d_range(range),
+			d_range_angular_extent(get_range_angular_extent(range))
 			{	}
 
+		/**
+		 * Converts a region-of-interest range (in Kms) to an angular extent (clamped to PI).
+		 */
+		static
+		GPlatesMaths::AngularExtent
+		get_range_angular_extent(
+				const double &range)
+		{
+			// Convert range from kms to radians.
+			double range_in_radians = range / GPlatesUtils::Earth::EQUATORIAL_RADIUS_KMS;
+			if (range_in_radians > GPlatesMaths::PI)
+			{
+				range_in_radians = GPlatesMaths::PI;
+			}
+
+			return GPlatesMaths::AngularExtent::create_from_angle(range_in_radians);
+		}
+
 		class Config : public CoRegFilter::Config
 		{
 		public:
@@ -196,19 +216,10 @@ namespace GPlatesDataMining
 						const GPlatesAppLogic::ReconstructContext::Reconstruction &reconstructed_seed_geom,
 						reconstructed_seed_geometries)
 				{
-					// Convert range from kms to radians.
-					double range_in_radians = d_range / GPlatesUtils::Earth::EQUATORIAL_RADIUS_KMS;
-					if (range_in_radians > GPlatesMaths::PI)
-					{
-						range_in_radians = GPlatesMaths::PI;
-					}
-
 					// Calculate minimum distance between the two geometries.
 					//
-					// The returned distance will either be less than 'range_in_radians' threshold or
+					// The returned distance will either be less than the range threshold or
 					// AngularDistance::PI (maximum possible distance) to signify threshold exceeded.
-					const GPlatesMaths::AngularExtent range_angular_extent =
-							GPlatesMaths::AngularExtent::create_from_angle(range_in_radians);
 					const GPlatesMaths::AngularDistance min_dist = minimum_distance(
 							*reconstructed_seed_geom.get_reconstructed_feature_geometry()->reconstructed_geometry(), 
 							*reconstructed_target_geom.get_reconstructed_feature_geometry()->reconstructed_geometry(), 
@@ -216,9 +227,9 @@ namespace GPlatesDataMining
 							// if the other geometry overlaps its interior...
 							true/*geometry1_interior_is_solid*/,
 							true/*geometry2_interior_is_solid*/,
-							range_angular_extent);
+							d_range_angular_extent);
 
-					// If the minimum distance was less than the threshold 'range_in_radians'...
+					// If the minimum distance was less than the range threshold...
 					if (min_dist != GPlatesMaths::AngularDistance::PI)
 					{
 						filtered_reconstructed_target_geometries.push_back(
@@ -235,6 +246,7 @@ namespace GPlatesDataMining
 
 		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &d_reconstructed_seed_feature;
 		double d_range;
+		GPlatesMaths::AngularExtent d_range_angular_extent;
 	};
 }
 #endif
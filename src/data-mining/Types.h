@@ -88,6 +88,8 @@ namespace GPlatesDataMining
 		REDUCER_MIN_DISTANCE,
 		REDUCER_PRESENCE,
 		REDUCER_NUM_IN_ROI,
+		REDUCER_APPROXIMATE_MEDIAN,
+		REDUCER_APPROXIMATE_VOTE,
 
 		// NOTE: Any new values should also be added to @a transcribe.
 
@@ -112,7 +114,9 @@ namespace GPlatesDataMining
 			"REDUCER_PERCENTILE",
 			"REDUCER_MIN_DISTANCE",
 			"REDUCER_PRESENCE",
-			"REDUCER_NUM_IN_ROI"
+			"REDUCER_NUM_IN_ROI",
+			"REDUCER_APPROXIMATE_MEDIAN",
+			"REDUCER_APPROXIMATE_VOTE"
 		};
 		if(static_cast<unsigned>(type) < static_cast<unsigned>(NUM_OF_Reducer_Type))
 		{
@@ -182,7 +186,9 @@ namespace GPlatesDataMining
 			GPlatesScribe::EnumValue("REDUCER_PERCENTILE", REDUCER_PERCENTILE),
 			GPlatesScribe::EnumValue("REDUCER_MIN_DISTANCE", REDUCER_MIN_DISTANCE),
 			GPlatesScribe::EnumValue("REDUCER_PRESENCE", REDUCER_PRESENCE),
-			GPlatesScribe::EnumValue("REDUCER_NUM_IN_ROI", REDUCER_NUM_IN_ROI)
+			GPlatesScribe::EnumValue("REDUCER_NUM_IN_ROI", REDUCER_NUM_IN_ROI),
+			GPlatesScribe::EnumValue("REDUCER_APPROXIMATE_MEDIAN", REDUCER_APPROXIMATE_MEDIAN),
+			GPlatesScribe::EnumValue("REDUCER_APPROXIMATE_VOTE", REDUCER_APPROXIMATE_VOTE)
 		};
 
 		return GPlatesScribe::transcribe_enum_protocol(
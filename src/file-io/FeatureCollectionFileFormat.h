@@ -49,6 +49,7 @@ namespace GPlatesFileIO
 			WRITE_ONLY_XY_GMT, //!< '.xy' extension.
 			GMAP,              //!< '.vgp' extension.
 			GSML,              //!< '.gsml' extension.
+			GPMLB,             //!< '.gpmlb' extension.
 
 			// NOTE: This must be last and must be the actual number of formats (ie, no gaps in enum values).
 			NUM_FORMATS
@@ -81,6 +81,86 @@ namespace GPlatesFileIO
 		};
 
 
+		/**
+		 * Configuration options for the binary GPML format 'GPMLB'.
+		 */
+		class GpmlBinaryConfiguration :
+				public Configuration
+		{
+		public:
+			typedef boost::shared_ptr<const GpmlBinaryConfiguration> shared_ptr_to_const_type;
+			typedef boost::shared_ptr<GpmlBinaryConfiguration> shared_ptr_type;
+
+			/**
+			 * Constructor.
+			 *
+			 * @a lazy_loading memory-maps files when reading and decodes property values on first access.
+			 * @a compress_blocks compresses the blocks when writing (smaller files, but slower).
+			 * @a write_feature_summaries writes each feature's valid time, reconstruction plate ID and
+			 * geometry bounds (so clients can skip features without decoding them).
+			 */
+			explicit
+			GpmlBinaryConfiguration(
+					bool lazy_loading = false,
+					bool compress_blocks = false,
+					bool write_feature_summaries = true) :
+				d_lazy_loading(lazy_loading),
+				d_compress_blocks(compress_blocks),
+				d_write_feature_summaries(write_feature_summaries)
+			{  }
+
+			//! Returns lazy loading flag.
+			bool
+			get_lazy_loading() const
+			{
+				return d_lazy_loading;
+			}
+
+			//! Sets lazy loading flag.
+			void
+			set_lazy_loading(
+					bool lazy_loading)
+			{
+				d_lazy_loading = lazy_loading;
+			}
+
+			//! Returns block compression flag.
+			bool
+			get_compress_blocks() const
+			{
+				return d_compress_blocks;
+			}
+
+			//! Sets block compression flag.
+			void
+			set_compress_blocks(
+					bool compress_blocks)
+			{
+				d_compress_blocks = compress_blocks;
+			}
+
+			//! Returns feature summaries flag.
+			bool
+			get_write_feature_summaries() const
+			{
+				return d_write_feature_summaries;
+			}
+
+			//! Sets feature summaries flag.
+			void
+			set_write_feature_summaries(
+					bool write_feature_summaries)
+			{
+				d_write_feature_summaries = write_feature_summaries;
+			}
+
+		private:
+			bool d_lazy_loading;
+			bool d_compress_blocks;
+			bool d_write_feature_summaries;
+		};
+
+
 		/**
 		 * Configuration options for OGR-supported file formats.
 		 */
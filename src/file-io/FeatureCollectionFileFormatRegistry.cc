@@ -41,6 +41,8 @@
 #include "GeoscimlProfile.h"
 #include "GmapReader.h"
 #include "GMTFormatWriter.h"
+#include "GpmlBinaryReader.h"
+#include "GpmlBinaryWriter.h"
 #include "GpmlOutputVisitor.h"
 #include "GpmlReader.h"
 #include "GpmlPropertyStructuralTypeReader.h"
@@ -125,6 +127,7 @@ namespace GPlatesFileIO
 			const QString FILE_FORMAT_EXT_GPML = "gpml";
 			const QString FILE_FORMAT_EXT_GPMLZ = "gpmlz";
 			const QString FILE_FORMAT_EXT_GPMLZ_ALTERNATIVE = "gpml.gz";
+			const QString FILE_FORMAT_EXT_GPMLB = "gpmlb";
 			const QString FILE_FORMAT_EXT_PLATES4_LINE = "dat";
 			const QString FILE_FORMAT_EXT_PLATES4_LINE_ALTERNATIVE = "pla";
 			const QString FILE_FORMAT_EXT_PLATES4_ROTATION = "rot";
@@ -239,6 +242,37 @@ namespace GPlatesFileIO
 			}
 
 
+			/**
+			 * Reads a binary GPML (".gpmlb") feature collection.
+			 */
+			void
+			gpmlb_read_feature_collection(
+					File::Reference &file_ref,
+					const Registry &file_format_registry,
+					const GpmlPropertyStructuralTypeReader::non_null_ptr_to_const_type &gpml_property_structural_type_reader,
+					ReadErrorAccumulation &read_errors,
+					bool &contains_unsaved_changes)
+			{
+				// Get the current default binary GPML configuration.
+				boost::optional<FeatureCollectionFileFormat::GpmlBinaryConfiguration::shared_ptr_to_const_type>
+						default_gpmlb_file_configuration =
+								FeatureCollectionFileFormat::dynamic_cast_configuration<
+										const FeatureCollectionFileFormat::GpmlBinaryConfiguration>(
+												file_format_registry.get_default_configuration(
+														FeatureCollectionFileFormat::GPMLB));
+				GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+						default_gpmlb_file_configuration,
+						GPLATES_ASSERTION_SOURCE);
+
+				GpmlBinaryReader::read_file(
+						file_ref,
+						gpml_property_structural_type_reader,
+						read_errors,
+						contains_unsaved_changes,
+						default_gpmlb_file_configuration.get()->get_lazy_loading());
+			}
+
+
 			/**
 			 * Reads a GSML feature collection.
 			 */
@@ -284,6 +318,33 @@ namespace GPlatesFileIO
 								true/*use_gzip*/));
 			}
 
+			/**
+			 * Creates a GPMLB feature visitor writer.
+			 */
+			boost::shared_ptr<GPlatesModel::ConstFeatureVisitor>
+			create_gpmlb_feature_collection_writer(
+					File::Reference &file_ref,
+					const Registry &file_format_registry)
+			{
+				// Get the current default binary GPML configuration.
+				boost::optional<FeatureCollectionFileFormat::GpmlBinaryConfiguration::shared_ptr_to_const_type>
+						default_gpmlb_file_configuration =
+								FeatureCollectionFileFormat::dynamic_cast_configuration<
+										const FeatureCollectionFileFormat::GpmlBinaryConfiguration>(
+												file_format_registry.get_default_configuration(
+														FeatureCollectionFileFormat::GPMLB));
+				GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+						default_gpmlb_file_configuration,
+						GPLATES_ASSERTION_SOURCE);
+
+				return boost::shared_ptr<GPlatesModel::ConstFeatureVisitor>(
+						new GpmlBinaryWriter(
+								file_ref.get_file_info(),
+								file_ref.get_feature_collection(),
+								default_gpmlb_file_configuration.get()->get_compress_blocks(),
+								default_gpmlb_file_configuration.get()->get_write_feature_summaries()));
+			}
+
 			/**
 			 * Creates a PLATES4_LINE feature visitor writer.
 			 */
@@ -793,6 +854,22 @@ GPlatesFileIO::FeatureCollectionFileFormat::Registry::register_default_file_form
 			// No configuration options yet for this file format...
 			boost::none);
 
+	classifications_type gpmlb_classification;
+	gpmlb_classification.set(); // Set all flags - GPMLB can handle everything (that GPML can).
+	Configuration::shared_ptr_to_const_type gpmlb_default_configuration(new GpmlBinaryConfiguration());
+	register_file_format(
+			GPMLB,
+			"Binary GPML",
+			std::vector<QString>(1, FILE_FORMAT_EXT_GPMLB),
+			gpmlb_classification,
+			&file_name_ends_with,
+			Registry::read_feature_collection_function_type(
+					boost::bind(&gpmlb_read_feature_collection,
+							_1, boost::cref(*this), gpml_property_structural_type_reader, _2, _3)),
+			Registry::create_feature_collection_writer_function_type(
+					boost::bind(&create_gpmlb_feature_collection_writer, _1, boost::cref(*this))),
+			gpmlb_default_configuration);
+
 	classifications_type plate4_line_classification;
 	plate4_line_classification.set(GPlatesAppLogic::ReconstructMethod::BY_PLATE_ID);
 	std::vector<QString> plate4_line_filename_extensions;
@@ -378,12 +378,15 @@ namespace GPlatesFileIO
 				boost::optional< std::vector<GPlatesAppLogic::DeformationStrain::StrainPrincipal> > principal_strains;
 				if (include_principal_strain)
 				{
-					principal_strains = std::vector<GPlatesAppLogic::DeformationStrain::StrainPrincipal>();
+					principal_strains = std::vector<GPlatesAppLogic::DeformationStrain::StrainPrincipal>(
+							deformation_strains.size());
 
-					principal_strains->reserve(deformation_strains.size());
-					for (unsigned int n = 0; n < deformation_strains.size(); ++n)
+					if (!deformation_strains.empty())
 					{
-						principal_strains->push_back(deformation_strains[n].get_strain_principal());
+						GPlatesAppLogic::get_strain_principals(
+								&principal_strains.get()[0],
+								&deformation_strains[0],
+								deformation_strains.size());
 					}
 				}
 
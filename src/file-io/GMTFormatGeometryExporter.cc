@@ -25,7 +25,7 @@
  */
 
 #include <string>
-#include <QtGlobal>
+#include <QLatin1String>
 #include <QTextStream>
 
 #include "GMTFormatGeometryExporter.h"
@@ -34,89 +34,69 @@
 #include "maths/PolylineOnSphere.h"
 #include "maths/PolygonOnSphere.h"
 #include "maths/LatLonPoint.h"
-#include "maths/Real.h"
 
 #include "utils/StringFormattingUtils.h"
 
 namespace
 {
 	/**
-	* Adapted from GMTFormatWriter to work on a QTextStream.
+	 * A coordinate in the GMT xy format is written as decimal number that
+	 * takes up 8 characters excluding sign.
+	 */
+	const unsigned GMT_COORDINATE_FIELDWIDTH = 9;
+
+
+	/**
+	* Adapted from GMTFormatWriter to append to a string buffer.
 	*/
 	void
 	print_gmt_coordinate_line(
-			QTextStream &stream,
-			const GPlatesMaths::Real &lat,
-			const GPlatesMaths::Real &lon,
+			std::string &buffer,
+			const double &lat,
+			const double &lon,
 			bool reverse_coordinate_order)
 	{
-		/*
-		* A coordinate in the GMT xy format is written as decimal number that
-		* takes up 8 characters excluding sign.
-		*/
-		static const unsigned GMT_COORDINATE_FIELDWIDTH = 9;
-
-		/*
-		* We convert the coordinates to strings first, so that in case an exception
-		* is thrown, the ostream is not modified.
-		*/
-		std::string lat_str, lon_str;
-		try {
-			lat_str = GPlatesUtils::formatted_double_to_string(lat.dval(),
-				GMT_COORDINATE_FIELDWIDTH);
-			lon_str = GPlatesUtils::formatted_double_to_string(lon.dval(),
-				GMT_COORDINATE_FIELDWIDTH);
-		} catch (const GPlatesUtils::InvalidFormattingParametersException &) {
-			// The argument name in the above expression was removed to
-			// prevent "unreferenced local variable" compiler warnings under MSVC.
-			throw;
-		}
-
 		// GMT format is by default (lon,lat) which is opposite of PLATES4 line format.
 		if (reverse_coordinate_order) {
 			// For whatever perverse reason, the user wants to write in (lat,lon) order.
-			stream << "  " << lat_str.c_str()
-				<< "      " << lon_str.c_str()
-#if QT_VERSION >= QT_VERSION_CHECK(5,15,0)
-				<< Qt::endl;
-#else
-				<< endl;
-#endif
+			buffer += "  ";
+			GPlatesUtils::append_formatted_double(buffer, lat, GMT_COORDINATE_FIELDWIDTH);
+			buffer += "      ";
+			GPlatesUtils::append_formatted_double(buffer, lon, GMT_COORDINATE_FIELDWIDTH);
+			buffer += '\n';
 		} else {
 			// Normal GMT (lon,lat) order should be used.
-			stream << "  " << lon_str.c_str()
-				<< "      " << lat_str.c_str()
-#if QT_VERSION >= QT_VERSION_CHECK(5,15,0)
-				<< Qt::endl;
-#else
-				<< endl;
-#endif
+			buffer += "  ";
+			GPlatesUtils::append_formatted_double(buffer, lon, GMT_COORDINATE_FIELDWIDTH);
+			buffer += "      ";
+			GPlatesUtils::append_formatted_double(buffer, lat, GMT_COORDINATE_FIELDWIDTH);
+			buffer += '\n';
 		}
 	}
 
 
 	void
 	print_gmt_feature_termination_line(
-			QTextStream &stream)
+			std::string &buffer)
 	{
 		// No newline is output since a GMT header may follow in which
 		// case it will use the same line.
 		// FIXME: standardize header to remove output of a final line with only the ">" character:
 		// it seems unnecessary and causes complications down the road in other workflows.
 		// see also : GPlatesFileIO::GMTHeaderPrinter::print_feature_header_lines(..) for output of ">" 
-		stream << ">";
+		buffer += '>';
 	}
 
 
 	void
 	print_gmt_coordinate_line(
-			QTextStream &stream,
+			std::string &buffer,
 			const GPlatesMaths::PointOnSphere &pos,
 			bool reverse_coordinate_order)
 	{
 		GPlatesMaths::LatLonPoint llp =
 			GPlatesMaths::make_lat_lon_point(pos);
-		print_gmt_coordinate_line(stream, llp.latitude(), llp.longitude(),
+		print_gmt_coordinate_line(buffer, llp.latitude(), llp.longitude(),
 			reverse_coordinate_order);
 	}
 }
@@ -131,6 +111,19 @@ GPlatesFileIO::GMTFormatGeometryExporter::GMTFormatGeometryExporter(
 		bool reverse_coordinate_order,
 		bool polygon_terminating_point) :
 	d_stream_ptr(&output_stream),
+	d_buffer_ptr(&d_stream_buffer),
+	d_reverse_coordinate_order(reverse_coordinate_order),
+	d_polygon_terminating_point(polygon_terminating_point)
+{
+}
+
+
+GPlatesFileIO::GMTFormatGeometryExporter::GMTFormatGeometryExporter(
+		std::string &output_buffer,
+		bool reverse_coordinate_order,
+		bool polygon_terminating_point) :
+	d_stream_ptr(NULL),
+	d_buffer_ptr(&output_buffer),
 	d_reverse_coordinate_order(reverse_coordinate_order),
 	d_polygon_terminating_point(polygon_terminating_point)
 {
@@ -157,11 +150,13 @@ GPlatesFileIO::GMTFormatGeometryExporter::visit_multi_point_on_sphere(
 	// Output all points to produce the line segments.
 	for ( ; iter != end; ++iter)
 	{
-		print_gmt_coordinate_line(*d_stream_ptr, *iter, d_reverse_coordinate_order);
+		print_gmt_coordinate_line(*d_buffer_ptr, *iter, d_reverse_coordinate_order);
 	}
 
 	// Write the final terminating symbol.
-	print_gmt_feature_termination_line(*d_stream_ptr);
+	print_gmt_feature_termination_line(*d_buffer_ptr);
+
+	flush_stream_buffer();
 }
 
 
@@ -169,10 +164,12 @@ void
 GPlatesFileIO::GMTFormatGeometryExporter::visit_point_on_sphere(
 		GPlatesMaths::PointGeometryOnSphere::non_null_ptr_to_const_type point_on_sphere)
 {
-	print_gmt_coordinate_line(*d_stream_ptr, point_on_sphere->position(), d_reverse_coordinate_order);
+	print_gmt_coordinate_line(*d_buffer_ptr, point_on_sphere->position(), d_reverse_coordinate_order);
 
 	// Write the final terminating symbol.
-	print_gmt_feature_termination_line(*d_stream_ptr);
+	print_gmt_feature_termination_line(*d_buffer_ptr);
+
+	flush_stream_buffer();
 }
 
 
@@ -186,7 +183,7 @@ GPlatesFileIO::GMTFormatGeometryExporter::visit_polygon_on_sphere(
 			polygon_on_sphere->exterior_ring_vertex_end());
 
 	// Write a terminating symbol after each ring.
-	print_gmt_feature_termination_line(*d_stream_ptr);
+	print_gmt_feature_termination_line(*d_buffer_ptr);
 
 	const unsigned int num_interior_rings = polygon_on_sphere->number_of_interior_rings();
 	for (unsigned int interior_ring_index = 0; interior_ring_index < num_interior_rings; ++interior_ring_index)
@@ -196,8 +193,10 @@ GPlatesFileIO::GMTFormatGeometryExporter::visit_polygon_on_sphere(
 				polygon_on_sphere->interior_ring_vertex_end(interior_ring_index));
 
 		// Write a terminating symbol after each ring.
-		print_gmt_feature_termination_line(*d_stream_ptr);
+		print_gmt_feature_termination_line(*d_buffer_ptr);
 	}
+
+	flush_stream_buffer();
 }
 
 
@@ -212,11 +211,25 @@ GPlatesFileIO::GMTFormatGeometryExporter::visit_polyline_on_sphere(
 	// Output all points to produce the line segments.
 	for ( ; iter != end; ++iter)
 	{
-		print_gmt_coordinate_line(*d_stream_ptr, *iter, d_reverse_coordinate_order);
+		print_gmt_coordinate_line(*d_buffer_ptr, *iter, d_reverse_coordinate_order);
 	}
 
 	// Write the final terminating symbol.
-	print_gmt_feature_termination_line(*d_stream_ptr);
+	print_gmt_feature_termination_line(*d_buffer_ptr);
+
+	flush_stream_buffer();
+}
+
+
+void
+GPlatesFileIO::GMTFormatGeometryExporter::flush_stream_buffer()
+{
+	if (d_stream_ptr)
+	{
+		// The formatted coordinates are ASCII.
+		*d_stream_ptr << QLatin1String(d_stream_buffer.data(), static_cast<int>(d_stream_buffer.size()));
+		d_stream_buffer.clear();
+	}
 }
 
 
@@ -229,13 +242,13 @@ GPlatesFileIO::GMTFormatGeometryExporter::write_polygon_ring(
 	GPlatesMaths::PolygonOnSphere::ring_vertex_const_iterator ring_vertex_iter = ring_vertex_begin;
 	for ( ; ring_vertex_iter != ring_vertex_end; ++ring_vertex_iter)
 	{
-		print_gmt_coordinate_line(*d_stream_ptr, *ring_vertex_iter, d_reverse_coordinate_order);
+		print_gmt_coordinate_line(*d_buffer_ptr, *ring_vertex_iter, d_reverse_coordinate_order);
 	}
 
 	// Finally, to produce a closed polygon ring, we should return to the initial point
 	// (Assuming that option was specified, which it is by default).
 	if (d_polygon_terminating_point)
 	{
-		print_gmt_coordinate_line(*d_stream_ptr, *ring_vertex_begin, d_reverse_coordinate_order);
+		print_gmt_coordinate_line(*d_buffer_ptr, *ring_vertex_begin, d_reverse_coordinate_order);
 	}
 }
@@ -27,6 +27,7 @@
 #ifndef GPLATES_FILEIO_GMTFORMATGEOMETRYEXPORTER_H
 #define GPLATES_FILEIO_GMTFORMATGEOMETRYEXPORTER_H
 
+#include <string>
 #include <boost/noncopyable.hpp>
 #include <QTextStream>
 
@@ -57,6 +58,17 @@ namespace GPlatesFileIO
 				bool reverse_coordinate_order = false,
 				bool polygon_terminating_point = true);
 
+		/**
+		 * Appends the exported geometries to @a output_buffer (instead of writing to a stream).
+		 *
+		 * Unlike writing to a QTextStream this can be used by multiple threads, each with its
+		 * own exporter and output buffer (the output is ASCII).
+		 */
+		GMTFormatGeometryExporter(
+				std::string &output_buffer,
+				bool reverse_coordinate_order = false,
+				bool polygon_terminating_point = true);
+
 		virtual
 		~GMTFormatGeometryExporter()
 		{  }
@@ -98,11 +110,23 @@ namespace GPlatesFileIO
 	private:
 
 		/**
-		* The QTextStream we write to.
+		* The QTextStream we write to (if not writing to an output buffer).
 		* QTextStreams can conveniently be created from QIODevices and QByteArrays.
 		*/
 		QTextStream *d_stream_ptr;
 
+		/**
+		 * Each geometry is formatted into this buffer.
+		 *
+		 * This is either the caller's output buffer or @a d_stream_buffer.
+		 */
+		std::string *d_buffer_ptr;
+
+		/**
+		 * Buffers a geometry before it's written to @a d_stream_ptr (if writing to a stream).
+		 */
+		std::string d_stream_buffer;
+
 		/**
 		* Should we go against the norm and write out coordinates using a (lat,lon) ordering?
 		*/
@@ -115,6 +139,12 @@ namespace GPlatesFileIO
 		bool d_polygon_terminating_point;
 
 
+		/**
+		 * Writes the buffered geometry to the output stream (if writing to a stream).
+		 */
+		void
+		flush_stream_buffer();
+
 		void
 		write_polygon_ring(
 				const GPlatesMaths::PolygonOnSphere::ring_vertex_const_iterator &ring_vertex_begin,
@@ -23,6 +23,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <QByteArray>
 #include <QtGlobal>
 
 #include "GMTFormatHeader.h"
@@ -851,3 +852,62 @@ GPlatesFileIO::GMTHeaderPrinter::print_feature_header_lines(
 		}
 	}
 }
+
+
+void
+GPlatesFileIO::GMTHeaderPrinter::append_global_header_lines(
+		std::string &output,
+		const std::vector<QString> &header_lines)
+{
+	// Print each line of the GMT header preceded by the '>' character.
+	std::vector<QString>::const_iterator header_line_iter;
+	for (header_line_iter = header_lines.begin();
+		header_line_iter != header_lines.end();
+		++header_line_iter)
+	{
+		const QByteArray line = header_line_iter->toLocal8Bit();
+		output += '>';
+		output.append(line.constData(), line.size());
+		output += '\n';
+	}
+}
+
+
+void
+GPlatesFileIO::GMTHeaderPrinter::append_feature_header_lines(
+		std::string &output,
+		const std::vector<QString> &header_lines,
+		bool is_first_feature_header_in_file)
+{
+	// If this is the first feature written to the file then
+	// we don't have a '>' marker from the previous feature's list of points.
+	if (is_first_feature_header_in_file)
+	{
+		output += '>';
+	}
+
+	if (header_lines.empty())
+	{
+		// There are no header lines to output so just output a newline and return.
+		output += '\n';
+		return;
+	}
+
+	// Print each line of the GMT header.
+	std::vector<QString>::const_iterator header_line_iter;
+	for (header_line_iter = header_lines.begin();
+		header_line_iter != header_lines.end();
+		++header_line_iter)
+	{
+		// First line in header uses '>' marker written by previous geometry.
+		// 2nd, 3rd, etc lines in header write their own '>' marker.
+		if (header_line_iter != header_lines.begin())
+		{
+			output += '>';
+		}
+
+		const QByteArray line = header_line_iter->toLocal8Bit();
+		output.append(line.constData(), line.size());
+		output += '\n';
+	}
+}
@@ -26,6 +26,7 @@
 #ifndef GPLATES_FILEIO_GMTFORMATHEADER_H
 #define GPLATES_FILEIO_GMTFORMATHEADER_H
 
+#include <string>
 #include <vector>
 #include <QString>
 #include <QTextStream>
@@ -149,6 +150,30 @@ namespace GPlatesFileIO
 				QTextStream& output_stream,
 				std::vector<QString>& header_lines);
 
+		/**
+		 * Same as @a print_global_header_lines but appends to @a output (in the local 8-bit
+		 * encoding, which is the default encoding of QTextStream).
+		 */
+		static
+		void
+		append_global_header_lines(
+				std::string &output,
+				const std::vector<QString> &header_lines);
+
+		/**
+		 * Same as @a print_feature_header_lines but appends to @a output (in the local 8-bit
+		 * encoding, which is the default encoding of QTextStream).
+		 *
+		 * This does not use any printer state (@a is_first_feature_header_in_file should only
+		 * be true for the first feature in the file) so features can be formatted by multiple threads.
+		 */
+		static
+		void
+		append_feature_header_lines(
+				std::string &output,
+				const std::vector<QString> &header_lines,
+				bool is_first_feature_header_in_file);
+
 	private:
 		//! Is the next feature to be written the first one ?
 		bool d_is_first_feature_header_in_file;
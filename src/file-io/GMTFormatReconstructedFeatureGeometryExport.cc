@@ -23,22 +23,27 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <string>
+#include <vector>
+#include <QByteArray>
 #include <QFile>
 #include <QStringList>
 #include <QString>
-#include <QTextStream>
 
 #include "GMTFormatReconstructedFeatureGeometryExport.h"
 
 #include "ErrorOpeningFileForWritingException.h"
 #include "GMTFormatGeometryExporter.h"
 #include "GMTFormatHeader.h"
+#include "OrderedChunkWriter.h"
 
 #include "app-logic/ReconstructedFeatureGeometry.h"
 
 #include "file-io/FileInfo.h"
 
-#include "utils/StringFormattingUtils.h"
+#include "global/LogException.h"
+
+#include "utils/ParallelUtils.h"
 
 
 namespace GPlatesFileIO
@@ -73,6 +78,139 @@ namespace GPlatesFileIO
 			}
 
 
+			/**
+			 * Number of reconstructed geometries formatted (in parallel) before they're handed to
+			 * the writer thread.
+			 */
+			const std::size_t FORMAT_BATCH_SIZE = 4096;
+
+			/**
+			 * Minimum number of reconstructed geometries formatted by each thread at a time.
+			 */
+			const std::size_t MIN_GEOMETRIES_PER_FORMAT_CHUNK = 64;
+
+
+			/**
+			 * A reconstructed geometry (and its feature header) to be written to the file.
+			 */
+			struct GeometryRecord
+			{
+				GeometryRecord(
+						std::size_t header_lines_index_,
+						const GPlatesMaths::GeometryOnSphere::non_null_ptr_to_const_type &geometry_) :
+					header_lines_index(header_lines_index_),
+					geometry(geometry_)
+				{  }
+
+				//! Index into the header lines of the features in the batch.
+				std::size_t header_lines_index;
+
+				GPlatesMaths::GeometryOnSphere::non_null_ptr_to_const_type geometry;
+			};
+
+
+			/**
+			 * A batch of reconstructed geometries to be formatted.
+			 */
+			struct GeometryRecordBatch
+			{
+				void
+				clear()
+				{
+					feature_header_lines.clear();
+					geometry_records.clear();
+				}
+
+				std::vector< std::vector<QString> > feature_header_lines;
+				std::vector<GeometryRecord> geometry_records;
+			};
+
+
+			/**
+			 * Formats a range of geometry records (and their headers) in a batch.
+			 *
+			 * This only accesses the header strings and the reconstructed geometries (not the model)
+			 * so it can be called from multiple threads.
+			 */
+			class FormatGeometryRecords
+			{
+			public:
+				FormatGeometryRecords(
+						const GeometryRecordBatch &batch,
+						std::vector<std::string> &formatted_geometry_records,
+						bool is_first_batch_in_file) :
+					d_batch(batch),
+					d_formatted_geometry_records(formatted_geometry_records),
+					d_is_first_batch_in_file(is_first_batch_in_file)
+				{  }
+
+				void
+				operator()(
+						std::size_t begin,
+						std::size_t end) const
+				{
+					for (std::size_t record_index = begin; record_index < end; ++record_index)
+					{
+						const GeometryRecord &geometry_record = d_batch.geometry_records[record_index];
+						std::string &formatted_geometry_record = d_formatted_geometry_records[record_index];
+
+						// Print the header lines.
+						GMTHeaderPrinter::append_feature_header_lines(
+								formatted_geometry_record,
+								d_batch.feature_header_lines[geometry_record.header_lines_index],
+								d_is_first_batch_in_file && record_index == 0);
+
+						// Write the reconstructed geometry.
+						GMTFormatGeometryExporter geom_exporter(formatted_geometry_record);
+						geom_exporter.export_geometry(geometry_record.geometry);
+					}
+				}
+
+			private:
+				const GeometryRecordBatch &d_batch;
+				std::vector<std::string> &d_formatted_geometry_records;
+				bool d_is_first_batch_in_file;
+			};
+
+
+			/**
+			 * Formats the geometry records in @a batch in parallel and hands them, in order,
+			 * to @a chunk_writer as a single chunk.
+			 */
+			void
+			write_geometry_record_batch(
+					OrderedChunkWriter &chunk_writer,
+					const GeometryRecordBatch &batch,
+					bool is_first_batch_in_file)
+			{
+				const std::size_t num_geometry_records = batch.geometry_records.size();
+
+				std::vector<std::string> formatted_geometry_records(num_geometry_records);
+				GPlatesUtils::ParallelUtils::parallel_for(
+						num_geometry_records,
+						FormatGeometryRecords(batch, formatted_geometry_records, is_first_batch_in_file),
+						MIN_GEOMETRIES_PER_FORMAT_CHUNK);
+
+				std::size_t chunk_size = 0;
+				for (std::size_t record_index = 0; record_index < num_geometry_records; ++record_index)
+				{
+					chunk_size += formatted_geometry_records[record_index].size();
+				}
+
+				QByteArray chunk;
+				chunk.reserve(static_cast<int>(chunk_size));
+				for (std::size_t record_index = 0; record_index < num_geometry_records; ++record_index)
+				{
+					const std::string &formatted_geometry_record = formatted_geometry_records[record_index];
+					chunk.append(
+							formatted_geometry_record.data(),
+							static_cast<int>(formatted_geometry_record.size()));
+				}
+
+				chunk_writer.append(chunk);
+			}
+
+
 			/**
 			 * Prints GMT format header at top of the exported file containing information
 			 * about the reconstruction that is not per-feature information.
@@ -121,20 +259,18 @@ GPlatesFileIO::GMTFormatReconstructedFeatureGeometryExport::export_geometries(
 			file_info.filePath());
 	}
 
-	QTextStream output_stream(&output_file);
-
-	// Does the actual printing of GMT header to the output stream.
-	GMTHeaderPrinter gmt_header_printer;
+	// Writes the formatted chunks to the file (in order) on a separate thread so that
+	// writing overlaps with formatting.
+	OrderedChunkWriter chunk_writer(output_file);
 
 	// Write out the global header (at the top of the exported file).
 	std::vector<QString> global_header_lines;
 	get_global_header_lines(global_header_lines,
 			referenced_files, active_reconstruction_files,
 			reconstruction_anchor_plate_id, reconstruction_time);
-	gmt_header_printer.print_global_header_lines(output_stream, global_header_lines);
-
-	// Used to write the reconstructed geometry in GMT format.
-	GMTFormatGeometryExporter geom_exporter(output_stream);
+	std::string global_header;
+	GMTHeaderPrinter::append_global_header_lines(global_header, global_header_lines);
+	chunk_writer.append(QByteArray(global_header.data(), static_cast<int>(global_header.size())));
 
 	// Even though we're printing out reconstructed geometry rather than
 	// present day geometry we still write out the verbose properties
@@ -142,6 +278,11 @@ GPlatesFileIO::GMTFormatReconstructedFeatureGeometryExport::export_geometries(
 	// the geometries).
 	GMTFormatVerboseHeader gmt_header;
 
+	// The header lines are gathered here, since they access the model (which is not thread-safe),
+	// and the geometries are then formatted in parallel one batch at a time.
+	GeometryRecordBatch batch;
+	bool is_first_batch_in_file = true;
+
 	// Iterate through the reconstructed geometries and write to output.
 	std::list<feature_geometry_group_type>::const_iterator feature_iter;
 	for (feature_iter = feature_geometry_group_seq.begin();
@@ -163,11 +304,17 @@ GPlatesFileIO::GMTFormatReconstructedFeatureGeometryExport::export_geometries(
 			continue;
 		}
 
+		if (feature_geom_group.recon_geoms.empty())
+		{
+			continue;
+		}
+
 		// Get the header lines.
-		std::vector<QString> header_lines;
-		gmt_header.get_feature_header_lines(feature_ref, header_lines);
+		batch.feature_header_lines.push_back(std::vector<QString>());
+		gmt_header.get_feature_header_lines(feature_ref, batch.feature_header_lines.back());
+		const std::size_t header_lines_index = batch.feature_header_lines.size() - 1;
 
-		// Iterate through the reconstructed geometries of the current feature and write to output.
+		// Iterate through the reconstructed geometries of the current feature and add to the batch.
 		reconstructed_feature_geom_seq_type::const_iterator rfg_iter;
 		for (rfg_iter = feature_geom_group.recon_geoms.begin();
 			rfg_iter != feature_geom_group.recon_geoms.end();
@@ -175,11 +322,32 @@ GPlatesFileIO::GMTFormatReconstructedFeatureGeometryExport::export_geometries(
 		{
 			const GPlatesAppLogic::ReconstructedFeatureGeometry *rfg = *rfg_iter;
 
-			// Print the header lines.
-			gmt_header_printer.print_feature_header_lines(output_stream, header_lines);
+			batch.geometry_records.push_back(
+					GeometryRecord(header_lines_index, rfg->reconstructed_geometry()));
+		}
 
-			// Write the reconstructed geometry.
-			geom_exporter.export_geometry(rfg->reconstructed_geometry()); 
+		if (batch.geometry_records.size() >= FORMAT_BATCH_SIZE)
+		{
+			write_geometry_record_batch(chunk_writer, batch, is_first_batch_in_file);
+			is_first_batch_in_file = false;
+			batch.clear();
 		}
 	}
+
+	if (!batch.geometry_records.empty())
+	{
+		write_geometry_record_batch(chunk_writer, batch, is_first_batch_in_file);
+	}
+
+	// Report any failure to write the formatted chunks to the file.
+	// Flush any buffered data so that failures to write it are also reported.
+	if (!chunk_writer.finish() ||
+		!output_file.flush())
+	{
+		throw GPlatesGlobal::LogException(
+				GPLATES_EXCEPTION_SOURCE,
+				QString("Error writing GMT file \"%1\": %2")
+						.arg(file_info.filePath())
+						.arg(output_file.errorString()));
+	}
 }
@@ -26,6 +26,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <cstring> // for strcmp
 #include <exception>
@@ -36,6 +37,7 @@
 #include <boost/bind/bind.hpp>
 #include <boost/cast.hpp>
 #include <boost/cstdint.hpp>
+#include <boost/foreach.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 #include <boost/optional.hpp>
 #include <boost/scoped_array.hpp>
@@ -43,6 +45,8 @@
 #include <boost/type_traits/is_floating_point.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <QDateTime>
+#include <QDebug>
+#include <QSysInfo>
 
 #include <ogr_spatialref.h>
 
@@ -52,6 +56,7 @@
 #include "ErrorOpeningFileForWritingException.h"
 #include "GdalUtils.h"
 #include "RasterFileCacheFormat.h"
+#include "RasterFileCacheWriteLock.h"
 
 #include "global/AssertionFailureException.h"
 #include "global/GPlatesAssert.h"
@@ -350,6 +355,23 @@ namespace
 
 		return true;
 	}
+
+
+	/**
+	 * Converts an optional raster (of a specific raw raster type) to an optional RawRaster.
+	 */
+	template <class RawRasterPtrType>
+	boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type>
+	to_optional_raw_raster(
+			const boost::optional<RawRasterPtrType> &raster)
+	{
+		if (!raster)
+		{
+			return boost::none;
+		}
+
+		return GPlatesPropertyValues::RawRaster::non_null_ptr_type(raster.get().get());
+	}
 }
 
 
@@ -401,21 +423,20 @@ namespace GPlatesFileIO
 		// Ensure Rgba8RawRaster type does not go down this path.
 		BOOST_STATIC_ASSERT(RawRasterType::has_statistics);
 
-		// None of our RasterBand readers should be NULL.
-		GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
-				raster_band.file_cache_format_reader,
-				GPLATES_ASSERTION_SOURCE);
+		boost::optional<GPlatesPropertyValues::RasterStatistics> statistics;
 
-		// Read the raster statistics from the raster file cache.
+		// Read the raster statistics from the raster file cache (if it has been created).
 		//
 		// NOTE: We avoid reading them directly using GDAL since that can require rescanning the source
 		// data which is not necessary since we've cached the statistics in the cache format reader.
 		// This saves a few seconds when the raster is first loaded into GPlates.
-		boost::optional<GPlatesPropertyValues::RasterStatistics> statistics =
-				raster_band.file_cache_format_reader->get_raster_statistics();
-		if (statistics)
+		if (raster_band.file_cache_format_reader)
 		{
-			return statistics.get();
+			statistics = raster_band.file_cache_format_reader->get_raster_statistics();
+			if (statistics)
+			{
+				return statistics.get();
+			}
 		}
 
 		// This should not throw because our raster band should not be a colour band.
@@ -425,9 +446,13 @@ namespace GPlatesFileIO
 		// which should have been stored in the raster cache file.
 		// However there was a bug in GPlates 1.2 that failed to store the raster statistics in the
 		// cache file, so we need to get the statistics here.
+		//
+		// We also get here if the raster file cache is still being created in the background, in which
+		// case approximate statistics are fine (GDAL can then use overviews, or a subset of the data,
+		// instead of scanning the entire raster).
 		double min, max, mean, std_dev;
 		if (gdal_raster_band->GetStatistics(
-				false /* approx ok */,
+				raster_band.creating_file_cache /* approx ok */,
 				true /* force */,
 				&min, &max, &mean, &std_dev) != CE_None)
 		{
@@ -437,8 +462,7 @@ namespace GPlatesFileIO
 			// Log an error message so we know why a raster is not being displayed.
 			// NOTE: This failure actually didn't happen now - it happened when GPlates created the
 			// raster cache file (which could've been a different instance of GPlates).
-			qWarning() << "Failed to read GDAL statistics from '"
-					<< raster_band.file_cache_format_reader->get_filename() << "'.";
+			qWarning() << "Failed to read GDAL statistics from '" << d_source_raster_filename << "'.";
 
 			report_recoverable_error(read_errors, ReadErrors::ErrorReadingRasterBand);
 			return boost::none;
@@ -487,13 +511,12 @@ namespace GPlatesFileIO
 			RasterElementType *result_buf,
 			const RasterBand &raster_band,
 			bool flip,
+			unsigned int level,
 			unsigned int region_x_offset,
 			unsigned int region_y_offset,
 			unsigned int region_width,
 			unsigned int region_height)
 	{
-		PROFILE_FUNC();
-
 		// Ensure Rgba8RawRaster type does not go down this path.
 		BOOST_STATIC_ASSERT((!boost::is_same<RasterElementType, GPlatesGui::rgba8_t>::value));
 
@@ -505,20 +528,22 @@ namespace GPlatesFileIO
 		// Read it in line by line.
 		for (unsigned int i = 0; i != region_height; ++i)
 		{
-			// Work out which line we want to read in, depending on whether it's flipped.
-			int line_index = region_y_offset + i;
-			if (flip)
-			{
-				line_index = d_source_height - 1 - line_index;
-			}
+			// Work out which source window we want to read in, depending on whether it's flipped.
+			// At full resolution (level 0) this is a single line of the region.
+			int source_x_offset, source_y_offset, source_width, source_height;
+			get_source_window(
+					source_x_offset, source_y_offset, source_width, source_height,
+					flip, level, region_x_offset, region_y_offset + i, region_width);
 
 			// Read the line into the buffer.
+			// If the source window is larger than the buffer then GDAL samples its overviews
+			// (if any) or decimates the source window.
 			CPLErr error = gdal_raster_band->RasterIO(
 					GF_Read,
-					region_x_offset,
-					line_index,
-					region_width,
-					1 /* read one row */,
+					source_x_offset,
+					source_y_offset,
+					source_width,
+					source_height,
 					// Using qint64 in case reading file larger than 4Gb...
 					result_buf + qint64(i) * region_width,
 					region_width,
@@ -545,13 +570,12 @@ namespace GPlatesFileIO
 			GPlatesGui::rgba8_t *result_buf,
 			const RasterBand &raster_band,
 			bool flip,
+			unsigned int level,
 			unsigned int region_x_offset,
 			unsigned int region_y_offset,
 			unsigned int region_width,
 			unsigned int region_height)
 	{
-		PROFILE_FUNC();
-
 		// This should not throw because our raster band should be a colour band.
 		const RasterBand::GDALRgbaBands &gdal_rgba_raster_bands =
 				boost::get<const RasterBand::GDALRgbaBands>(raster_band.gdal_raster_band);
@@ -561,31 +585,31 @@ namespace GPlatesFileIO
 		switch (gdal_rgba_raster_bands.band_data_type)
 		{
 		case GDT_Byte:
-			add_rgba_data<quint8>(result_buf, gdal_rgba_raster_bands, flip, region_x_offset, region_y_offset, region_width, region_height);
+			add_rgba_data<quint8>(result_buf, gdal_rgba_raster_bands, flip, level, region_x_offset, region_y_offset, region_width, region_height);
 			break;
 
 		case GDT_Int16:
-			add_rgba_data<qint16>(result_buf, gdal_rgba_raster_bands, flip, region_x_offset, region_y_offset, region_width, region_height);
+			add_rgba_data<qint16>(result_buf, gdal_rgba_raster_bands, flip, level, region_x_offset, region_y_offset, region_width, region_height);
 			break;
 
 		case GDT_UInt16:
-			add_rgba_data<quint16>(result_buf, gdal_rgba_raster_bands, flip, region_x_offset, region_y_offset, region_width, region_height);
+			add_rgba_data<quint16>(result_buf, gdal_rgba_raster_bands, flip, level, region_x_offset, region_y_offset, region_width, region_height);
 			break;
 
 		case GDT_Int32:
-			add_rgba_data<qint32>(result_buf, gdal_rgba_raster_bands, flip, region_x_offset, region_y_offset, region_width, region_height);
+			add_rgba_data<qint32>(result_buf, gdal_rgba_raster_bands, flip, level, region_x_offset, region_y_offset, region_width, region_height);
 			break;
 
 		case GDT_UInt32:
-			add_rgba_data<quint32>(result_buf, gdal_rgba_raster_bands, flip, region_x_offset, region_y_offset, region_width, region_height);
+			add_rgba_data<quint32>(result_buf, gdal_rgba_raster_bands, flip, level, region_x_offset, region_y_offset, region_width, region_height);
 			break;
 
 		case GDT_Float32:
-			add_rgba_data<float>(result_buf, gdal_rgba_raster_bands, flip, region_x_offset, region_y_offset, region_width, region_height);
+			add_rgba_data<float>(result_buf, gdal_rgba_raster_bands, flip, level, region_x_offset, region_y_offset, region_width, region_height);
 			break;
 
 		case GDT_Float64:
-			add_rgba_data<double>(result_buf, gdal_rgba_raster_bands, flip, region_x_offset, region_y_offset, region_width, region_height);
+			add_rgba_data<double>(result_buf, gdal_rgba_raster_bands, flip, level, region_x_offset, region_y_offset, region_width, region_height);
 			break;
 
 		default:
@@ -601,6 +625,7 @@ namespace GPlatesFileIO
 			GPlatesGui::rgba8_t *result_buf,
 			const RasterBand::GDALRgbaBands &gdal_rgba_raster_bands,
 			bool flip,
+			unsigned int level,
 			unsigned int region_x_offset,
 			unsigned int region_y_offset,
 			unsigned int region_width,
@@ -675,20 +700,20 @@ namespace GPlatesFileIO
 					? non_byte_band_data_storage.get()
 					: reinterpret_cast<RasterBandElementType *>(result_line_ptr);
 
-			// Work out which line we want to read in, depending on whether it's flipped.
-			int line_index = region_y_offset + j;
-			if (flip)
-			{
-				line_index = d_source_height - 1 - line_index;
-			}
+			// Work out which source window we want to read in, depending on whether it's flipped.
+			// At full resolution (level 0) this is a single line of the region.
+			int source_x_offset, source_y_offset, source_width, source_height;
+			get_source_window(
+					source_x_offset, source_y_offset, source_width, source_height,
+					flip, level, region_x_offset, region_y_offset + j, region_width);
 
 			// Read the red line into the buffer.
 			CPLErr error = gdal_rgba_raster_bands.red_band->RasterIO(
 					GF_Read,
-					region_x_offset,
-					line_index,
-					region_width,
-					1 /* read one row */,
+					source_x_offset,
+					source_y_offset,
+					source_width,
+					source_height,
 					read_line_ptr + 0/*red offset*/,
 					region_width,
 					1 /* one row of buffer */,
@@ -704,10 +729,10 @@ namespace GPlatesFileIO
 			// Read the green line into the buffer.
 			error = gdal_rgba_raster_bands.green_band->RasterIO(
 					GF_Read,
-					region_x_offset,
-					line_index,
-					region_width,
-					1 /* read one row */,
+					source_x_offset,
+					source_y_offset,
+					source_width,
+					source_height,
 					read_line_ptr + 1/*green offset*/,
 					region_width,
 					1 /* one row of buffer */,
@@ -723,10 +748,10 @@ namespace GPlatesFileIO
 			// Read the blue line into the buffer.
 			error = gdal_rgba_raster_bands.blue_band->RasterIO(
 					GF_Read,
-					region_x_offset,
-					line_index,
-					region_width,
-					1 /* read one row */,
+					source_x_offset,
+					source_y_offset,
+					source_width,
+					source_height,
 					read_line_ptr + 2/*blue offset*/,
 					region_width,
 					1 /* one row of buffer */,
@@ -744,10 +769,10 @@ namespace GPlatesFileIO
 				// Read the alpha line into the buffer.
 				error = gdal_rgba_raster_bands.alpha_band.get()->RasterIO(
 						GF_Read,
-						region_x_offset,
-						line_index,
-						region_width,
-						1 /* read one row */,
+						source_x_offset,
+						source_y_offset,
+						source_width,
+						source_height,
 						read_line_ptr + 3/*alpha offset*/,
 						region_width,
 						1 /* one row of buffer */,
@@ -876,13 +901,15 @@ namespace GPlatesFileIO
 GPlatesFileIO::GDALRasterReader::GDALRasterReader(
 		const QString &filename,
 		RasterReader *raster_reader,
-		ReadErrorAccumulation *read_errors) :
+		ReadErrorAccumulation *read_errors,
+		bool wait_for_file_caches) :
 	RasterReaderImpl(raster_reader),
 	d_source_raster_filename(filename),
 	d_dataset(GdalUtils::open_raster(filename, false/*update*/, read_errors)),
 	d_flip(false),
 	d_source_width(0),
-	d_source_height(0)
+	d_source_height(0),
+	d_cancel_creating_file_caches(false)
 {
 	// Prior to 1st Dec 2009 there was a bug in GDAL that incorrectly flipped (in y-direction)
 	// non-GMT-style GRDs. So GDAL releases after this date do not need any flipping
@@ -968,25 +995,13 @@ GPlatesFileIO::GDALRasterReader::GDALRasterReader(
 
 	// First see if we've got an RGBA raster (as separate R, G and B bands, and A) with Byte components.
 	// These are classic RGB colour formats which we want to treat as a single *colour* band.
-	boost::optional<RasterBand::GDALRgbaBands> gdal_rgba_bands = is_colour_raster();
+	boost::optional<RasterBand::GDALRgbaBands> gdal_rgba_bands = is_colour_raster(d_dataset);
 	if (gdal_rgba_bands)
 	{
-		RasterBand raster_band(
-				GPlatesPropertyValues::RasterType::RGBA8,
-				gdal_rgba_bands.get());
-		raster_band.file_cache_format_reader =
-				create_source_raster_file_cache_format_reader(
-						raster_band, 1/*band_number*/, read_errors);
-
-		if (raster_band.file_cache_format_reader)
-		{
-			d_raster_bands.push_back(raster_band);
-		}
-		else
-		{
-			// We were unable to create a raster band file cache or unable to read it.
-			report_failure_to_begin(read_errors, ReadErrors::ErrorReadingRasterFile);
-		}
+		d_raster_bands.push_back(
+				RasterBand(
+						GPlatesPropertyValues::RasterType::RGBA8,
+						gdal_rgba_bands.get()));
 	}
 	else // create one numerical raster per band...
 	{
@@ -1009,24 +1024,72 @@ GPlatesFileIO::GDALRasterReader::GDALRasterReader(
 				continue;
 			}
 
-			const unsigned int raster_band_number = d_raster_bands.size() + 1;
-			RasterBand raster_band(raster_type, gdal_raster_band);
-			raster_band.file_cache_format_reader =
-					create_source_raster_file_cache_format_reader(
-							raster_band,
-							raster_band_number,
-							read_errors);
+			d_raster_bands.push_back(RasterBand(raster_type, gdal_raster_band));
+		}
+	}
+
+	//
+	// Open the source raster file cache of each raster band.
+	//
+	// Any caches that don't exist (or are out-of-date) are created in the background so that loading
+	// a large raster does not block until its caches are created. Until then each such band is read
+	// directly from the source raster (and previewed using reduced-resolution reads).
+	// The mipmap file caches are then also created in the background (from the source raster file caches).
+	//
+	// Unless the caller is waiting for the caches, in which case they are created now (and the
+	// mipmap file caches are created by the caller, see 'RasterReader::create()').
+	//
+
+	std::vector<FileCacheRequest> file_cache_requests;
+	for (unsigned int band_number = 1; band_number <= d_raster_bands.size(); ++band_number)
+	{
+		RasterBand &raster_band = d_raster_bands[band_number - 1];
 
-			if (!raster_band.file_cache_format_reader)
+		raster_band.file_cache_format_reader =
+				open_source_raster_file_cache_format_reader(raster_band, band_number);
+		if (!raster_band.file_cache_format_reader)
+		{
+			if (wait_for_file_caches)
 			{
-				// We were unable to create a raster band file cache or unable to read it.
-				report_failure_to_begin(read_errors, ReadErrors::ErrorReadingRasterFile);
+				// If the cache cannot be created then the raster band is read directly from the source raster.
+				if (create_source_raster_file_cache(raster_band, band_number, read_errors))
+				{
+					raster_band.file_cache_format_reader =
+							open_source_raster_file_cache_format_reader(raster_band, band_number);
+				}
+
 				continue;
 			}
 
-			d_raster_bands.push_back(raster_band);
+			// A colour band is made from RGB[A] GDAL bands so it has no GDAL band number.
+			GDALRasterBand *const *gdal_raster_band = boost::get<GDALRasterBand *>(&raster_band.gdal_raster_band);
+
+			raster_band.creating_file_cache = true;
+			file_cache_requests.push_back(
+					FileCacheRequest(
+							band_number,
+							raster_band.raster_type,
+							gdal_raster_band ? (*gdal_raster_band)->GetBand() : 0));
 		}
 	}
+
+	if (!file_cache_requests.empty())
+	{
+		d_creating_raster_band_file_caches.resize(d_raster_bands.size(), false);
+		d_creating_raster_band_mipmap_file_caches.resize(d_raster_bands.size(), false);
+		BOOST_FOREACH(const FileCacheRequest &file_cache_request, file_cache_requests)
+		{
+			d_creating_raster_band_file_caches[file_cache_request.band_number - 1] = true;
+			d_creating_raster_band_mipmap_file_caches[file_cache_request.band_number - 1] = true;
+		}
+
+		d_file_cache_thread.reset(
+				new boost::thread(
+						boost::bind(
+								&GDALRasterReader::create_source_raster_file_caches,
+								this,
+								file_cache_requests)));
+	}
 }
 
 
@@ -1034,6 +1097,17 @@ GPlatesFileIO::GDALRasterReader::~GDALRasterReader()
 {
 	try
 	{
+		if (d_file_cache_thread)
+		{
+			// Stop creating source raster file caches (a partially written cache file is removed).
+			{
+				boost::lock_guard<boost::mutex> lock(d_file_cache_mutex);
+				d_cancel_creating_file_caches = true;
+			}
+
+			d_file_cache_thread->join();
+		}
+
 		if (d_dataset)
 		{
 			// Closes the dataset as well as all bands that were opened.
@@ -1161,10 +1235,8 @@ GPlatesFileIO::GDALRasterReader::get_proxied_raw_raster(
 		return boost::none;
 	}
 
-	// None of our RasterBand readers should be NULL.
-	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
-			d_raster_bands[band_number - 1].file_cache_format_reader,
-			GPLATES_ASSERTION_SOURCE);
+	// Pick up the source raster file cache if it has been created (so statistics can be read from it).
+	update_source_raster_file_cache_format_reader(band_number);
 
 	RasterBandReaderHandle raster_band_reader_handle =
 			create_raster_band_reader_handle(band_number);
@@ -1227,11 +1299,6 @@ GPlatesFileIO::GDALRasterReader::get_raw_raster(
 		return boost::none;
 	}
 
-	// None of our RasterBand readers should be NULL.
-	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
-			d_raster_bands[band_number - 1].file_cache_format_reader,
-			GPLATES_ASSERTION_SOURCE);
-
 	unsigned int region_x_offset, region_y_offset, region_width, region_height;
 	if (!unpack_region(region, d_source_width, d_source_height,
 				region_x_offset, region_y_offset, region_width, region_height))
@@ -1239,10 +1306,25 @@ GPlatesFileIO::GDALRasterReader::get_raw_raster(
 		return boost::none;
 	}
 
-	// Read the specified source region from the raster file cache.
-	boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type> data =
-			d_raster_bands[band_number - 1].file_cache_format_reader->read_raster(
-					region_x_offset, region_y_offset, region_width, region_height);
+	const RasterBand &raster_band = d_raster_bands[band_number - 1];
+
+	boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type> data;
+	if (update_source_raster_file_cache_format_reader(band_number) &&
+		raster_band.file_cache_format_reader)
+	{
+		// Read the specified source region from the raster file cache.
+		data = raster_band.file_cache_format_reader->read_raster(
+				region_x_offset, region_y_offset, region_width, region_height);
+	}
+	else
+	{
+		// The raster file cache is still being created (or could not be created) so
+		// read the specified source region directly from the source raster.
+		data = read_raw_raster(
+				raster_band,
+				QRect(region_x_offset, region_y_offset, region_width, region_height),
+				0/*level*/);
+	}
 
 	if (!data)
 	{
@@ -1270,6 +1352,64 @@ GPlatesFileIO::GDALRasterReader::get_type(
 }
 
 
+boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type>
+GPlatesFileIO::GDALRasterReader::get_decimated_raw_raster(
+		unsigned int band_number,
+		unsigned int level,
+		const QRect &region,
+		ReadErrorAccumulation *read_errors)
+{
+	if (!can_read())
+	{
+		return boost::none;
+	}
+
+	if (band_number == 0 ||
+		band_number > d_raster_bands.size())
+	{
+		report_recoverable_error(read_errors, ReadErrors::ErrorReadingRasterBand);
+		return boost::none;
+	}
+
+	boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type> data =
+			read_raw_raster(d_raster_bands[band_number - 1], region, level);
+	if (!data)
+	{
+		report_recoverable_error(read_errors, ReadErrors::InvalidRegionInRaster);
+		return boost::none;
+	}
+
+	return data.get();
+}
+
+
+bool
+GPlatesFileIO::GDALRasterReader::is_raster_file_cache_complete(
+		unsigned int band_number)
+{
+	if (band_number == 0 ||
+		band_number > d_raster_bands.size())
+	{
+		return true;
+	}
+
+	if (!update_source_raster_file_cache_format_reader(band_number))
+	{
+		return false;
+	}
+
+	// The source raster file cache is complete, but the mipmap file cache might still be
+	// getting created from it.
+	if (d_creating_raster_band_mipmap_file_caches.empty())
+	{
+		return true;
+	}
+
+	boost::lock_guard<boost::mutex> lock(d_file_cache_mutex);
+	return !d_creating_raster_band_mipmap_file_caches[band_number - 1];
+}
+
+
 bool
 GPlatesFileIO::GDALRasterReader::initialise_source_raster_dimensions()
 {
@@ -1315,9 +1455,10 @@ GPlatesFileIO::GDALRasterReader::initialise_source_raster_dimensions()
 
 
 boost::optional<GPlatesFileIO::GDALRasterReader::RasterBand::GDALRgbaBands>
-GPlatesFileIO::GDALRasterReader::is_colour_raster()
+GPlatesFileIO::GDALRasterReader::is_colour_raster(
+		GDALDataset *dataset)
 {
-	const unsigned int num_gdal_raster_bands = d_dataset->GetRasterCount();
+	const unsigned int num_gdal_raster_bands = dataset->GetRasterCount();
 
 	// First see if we've got an RGBA raster (as separate R, G and B bands, and A) with Byte components.
 	// These are classic RGB colour formats which we want to treat as a single *colour* band.
@@ -1333,7 +1474,7 @@ GPlatesFileIO::GDALRasterReader::is_colour_raster()
 
 	for (unsigned int i = 1; i != num_gdal_raster_bands + 1; ++i)
 	{
-		GDALRasterBand *gdal_raster_band = d_dataset->GetRasterBand(i);
+		GDALRasterBand *gdal_raster_band = dataset->GetRasterBand(i);
 
 		if (gdal_raster_band == NULL)
 		{
@@ -1464,124 +1605,71 @@ GPlatesFileIO::GDALRasterReader::create_proxied_raw_raster(
 
 
 boost::shared_ptr<GPlatesFileIO::SourceRasterFileCacheFormatReader>
-GPlatesFileIO::GDALRasterReader::create_source_raster_file_cache_format_reader(
+GPlatesFileIO::GDALRasterReader::open_source_raster_file_cache_format_reader(
 		RasterBand &raster_band,
-		unsigned int band_number,
-		ReadErrorAccumulation *read_errors)
+		unsigned int band_number)
 {
 	// Find the existing source raster file cache (if exists).
 	boost::optional<QString> cache_filename =
 			RasterFileCacheFormat::get_existing_source_cache_filename(d_source_raster_filename, band_number);
-	if (cache_filename)
+	if (!cache_filename)
 	{
-		// If the source raster was modified after the raster file cache then we need
-		// to regenerate the raster file cache.
-		QDateTime source_last_modified = QFileInfo(d_source_raster_filename).lastModified();
-		QDateTime cache_last_modified = QFileInfo(cache_filename.get()).lastModified();
-		if (source_last_modified > cache_last_modified)
-		{
-			// Remove the cache file.
-			QFile(cache_filename.get()).remove();
-			// Create a new cache file.
-			if (!create_source_raster_file_cache(raster_band, band_number, read_errors))
-			{
-				// Unable to create cache file.
-				return boost::shared_ptr<GPlatesFileIO::SourceRasterFileCacheFormatReader>();
-			}
-		}
+		// The cache file needs to be generated.
+		return boost::shared_ptr<GPlatesFileIO::SourceRasterFileCacheFormatReader>();
 	}
-	// Generate the cache file if it doesn't exist...
-	else
+
+	// If the source raster was modified after the raster file cache then we need
+	// to regenerate the raster file cache.
+	QDateTime source_last_modified = QFileInfo(d_source_raster_filename).lastModified();
+	QDateTime cache_last_modified = QFileInfo(cache_filename.get()).lastModified();
+	if (source_last_modified > cache_last_modified)
 	{
-		if (!create_source_raster_file_cache(raster_band, band_number, read_errors))
-		{
-			// Unable to create cache file.
-			return boost::shared_ptr<GPlatesFileIO::SourceRasterFileCacheFormatReader>();
-		}
+		// Remove the cache file.
+		QFile(cache_filename.get()).remove();
 
-		cache_filename =
-				RasterFileCacheFormat::get_existing_source_cache_filename(d_source_raster_filename, band_number);
-		if (!cache_filename)
-		{
-			// Cache file was created but unable to read it for some reason.
-			return boost::shared_ptr<GPlatesFileIO::SourceRasterFileCacheFormatReader>();
-		}
+		return boost::shared_ptr<GPlatesFileIO::SourceRasterFileCacheFormatReader>();
 	}
 
-	boost::shared_ptr<GPlatesFileIO::SourceRasterFileCacheFormatReader> raster_band_file_cache_format_reader;
-
 	try
 	{
-		try
-		{
-			raster_band_file_cache_format_reader =
-					create_source_raster_file_cache_format_reader(
-							raster_band, cache_filename.get(), read_errors);
-		}
-		catch (RasterFileCacheFormat::UnsupportedVersion &exc)
-		{
-			// Log the exception so we know what caused the failure.
-			qWarning() << exc;
-
-			qWarning() << "Attempting rebuild of source raster file cache '"
-					<< cache_filename.get() << "' for current version of GPlates.";
-
-			// We'll have to remove the file and build it for the current GPlates version.
-			// This means if the future version of GPlates (the one that created the
-			// unrecognised version file) runs again it will either know how to
-			// load our version (or rebuild it for itself also if it determines its
-			// new format is much better or much more efficient).
-			QFile(cache_filename.get()).remove();
-
-			// Build it with the current version format.
-			if (create_source_raster_file_cache(raster_band, band_number, read_errors))
-			{
-				// Try reading it again.
-				raster_band_file_cache_format_reader =
-						create_source_raster_file_cache_format_reader(
-								raster_band, cache_filename.get(), read_errors);
-			}
-		}
-		catch (std::exception &exc)
-		{
-			// Log the exception so we know what caused the failure.
-			qWarning() << "Error reading source raster file cache '" << cache_filename.get()
-					<< "', attempting rebuild: " << exc.what();
+		return create_source_raster_file_cache_format_reader(
+				raster_band, cache_filename.get(), NULL/*read_errors*/);
+	}
+	catch (RasterFileCacheFormat::UnsupportedVersion &exc)
+	{
+		// Log the exception so we know what caused the failure.
+		qWarning() << exc;
 
-			// Remove the cache file in case it is corrupted somehow.
-			// Eg, it was partially written to by a previous instance of GPlates and
-			// not immediately removed for some reason.
-			QFile(cache_filename.get()).remove();
+		qWarning() << "Rebuilding source raster file cache '"
+				<< cache_filename.get() << "' for current version of GPlates.";
 
-			// Try building it again.
-			if (create_source_raster_file_cache(raster_band, band_number, read_errors))
-			{
-				// Try reading it again.
-				raster_band_file_cache_format_reader =
-						create_source_raster_file_cache_format_reader(
-								raster_band, cache_filename.get(), read_errors);
-			}
-		}
+		// We'll have to remove the file and build it for the current GPlates version.
+		// This means if the future version of GPlates (the one that created the
+		// unrecognised version file) runs again it will either know how to
+		// load our version (or rebuild it for itself also if it determines its
+		// new format is much better or much more efficient).
+		QFile(cache_filename.get()).remove();
 	}
 	catch (std::exception &exc)
 	{
 		// Log the exception so we know what caused the failure.
-		qWarning() << exc.what();
+		qWarning() << "Error reading source raster file cache '" << cache_filename.get()
+				<< "', rebuilding: " << exc.what();
 
-		// Log a warning message.
-		qWarning() << "Unable to read, or generate, source raster file cache for raster '"
-				<< d_source_raster_filename << "', giving up on it.";
+		// Remove the cache file in case it is corrupted somehow.
+		// Eg, it was partially written to by a previous instance of GPlates and
+		// not immediately removed for some reason.
+		QFile(cache_filename.get()).remove();
 	}
 	catch (...)
 	{
-		qWarning() << "Unknown exception";
+		qWarning() << "Unknown error reading source raster file cache '" << cache_filename.get()
+				<< "', rebuilding";
 
-		// Log a warning message.
-		qWarning() << "Unable to read, or generate, source raster file cache for raster '"
-				<< d_source_raster_filename << "', giving up on it.";
+		QFile(cache_filename.get()).remove();
 	}
 
-	return raster_band_file_cache_format_reader;
+	return boost::shared_ptr<GPlatesFileIO::SourceRasterFileCacheFormatReader>();
 }
 
 
@@ -1643,66 +1731,226 @@ GPlatesFileIO::GDALRasterReader::create_source_raster_file_cache_format_reader(
 }
 
 
+void
+GPlatesFileIO::GDALRasterReader::create_source_raster_file_caches(
+		const std::vector<FileCacheRequest> &file_cache_requests)
+{
+	// GDAL datasets cannot be used by more than one thread at a time so open our own.
+	GDALDataset *dataset = GdalUtils::open_raster(d_source_raster_filename, false/*update*/);
+
+	bool created_all_file_caches = (dataset != NULL);
+
+	BOOST_FOREACH(const FileCacheRequest &file_cache_request, file_cache_requests)
+	{
+		{
+			boost::lock_guard<boost::mutex> lock(d_file_cache_mutex);
+			if (d_cancel_creating_file_caches)
+			{
+				created_all_file_caches = false;
+				break;
+			}
+		}
+
+		if (dataset)
+		{
+			boost::optional<RasterBand> raster_band;
+			if (file_cache_request.gdal_band_number == 0)
+			{
+				boost::optional<RasterBand::GDALRgbaBands> gdal_rgba_bands = is_colour_raster(dataset);
+				if (gdal_rgba_bands)
+				{
+					raster_band = RasterBand(file_cache_request.raster_type, gdal_rgba_bands.get());
+				}
+			}
+			else
+			{
+				GDALRasterBand *gdal_raster_band = dataset->GetRasterBand(file_cache_request.gdal_band_number);
+				if (gdal_raster_band)
+				{
+					raster_band = RasterBand(file_cache_request.raster_type, gdal_raster_band);
+				}
+			}
+
+			// Note that any errors are logged (there's no read errors accumulation since the
+			// raster has already been loaded). And if the cache cannot be created then the
+			// raster band continues to be read directly from the source raster.
+			if (!raster_band ||
+				!create_source_raster_file_cache(raster_band.get(), file_cache_request.band_number, NULL))
+			{
+				created_all_file_caches = false;
+			}
+		}
+
+		// Let the raster band know its cache is ready to be opened.
+		boost::lock_guard<boost::mutex> lock(d_file_cache_mutex);
+		d_creating_raster_band_file_caches[file_cache_request.band_number - 1] = false;
+	}
+
+	if (dataset)
+	{
+		GdalUtils::close_raster(dataset);
+	}
+
+	// Now create the mipmap file caches from the source raster file caches.
+	//
+	// This uses its own raster reader (and hence its own source raster file cache readers) since
+	// a raster reader cannot be used by more than one thread at a time. And creating a raster
+	// reader creates the mipmap file caches of those bands whose source raster file caches exist.
+	// It waits for any source raster file caches that became out-of-date in the meantime (rather than
+	// starting yet another thread to create them).
+	//
+	// If a source raster file cache could not be created then neither are the mipmap file caches
+	// (they are instead created when first needed, as is the case when no caches are created
+	// in the background).
+	if (created_all_file_caches)
+	{
+		try
+		{
+			// Mipmapping is cancelled (and any partially written mipmap file removed) by
+			// throwing from its progress callback.
+			RasterReader::create(
+					d_source_raster_filename,
+					NULL/*read_errors*/,
+					boost::bind(&GDALRasterReader::check_creating_file_caches_cancelled, this),
+					true/*wait_for_file_caches*/);
+		}
+		catch (std::exception &exc)
+		{
+			qWarning() << "Error creating mipmap file caches for raster '"
+					<< d_source_raster_filename << "': " << exc.what();
+		}
+		catch (...)
+		{
+			qWarning() << "Unknown error creating mipmap file caches for raster '"
+					<< d_source_raster_filename << "'";
+		}
+	}
+
+	// Let the raster bands know their mipmap file caches are ready to be opened
+	// (or, if they failed to be created, that they should be created when first needed).
+	boost::lock_guard<boost::mutex> lock(d_file_cache_mutex);
+	BOOST_FOREACH(const FileCacheRequest &file_cache_request, file_cache_requests)
+	{
+		d_creating_raster_band_mipmap_file_caches[file_cache_request.band_number - 1] = false;
+	}
+}
+
+
 bool
-GPlatesFileIO::GDALRasterReader::create_source_raster_file_cache(
-		RasterBand &raster_band,
-		unsigned int band_number,
-		ReadErrorAccumulation *read_errors)
+GPlatesFileIO::GDALRasterReader::update_source_raster_file_cache_format_reader(
+		unsigned int band_number)
 {
-	PROFILE_FUNC();
+	RasterBand &raster_band = d_raster_bands[band_number - 1];
 
-	boost::optional<QString> cache_filename =
-			RasterFileCacheFormat::get_writable_source_cache_filename(d_source_raster_filename, band_number);
+	if (raster_band.creating_file_cache)
+	{
+		{
+			boost::lock_guard<boost::mutex> lock(d_file_cache_mutex);
+			if (d_creating_raster_band_file_caches[band_number - 1])
+			{
+				return false;
+			}
+		}
 
-	if (!cache_filename)
+		// The cache has been created (or failed to be created, in which case the raster band
+		// continues to be read directly from the source raster).
+		raster_band.creating_file_cache = false;
+		raster_band.file_cache_format_reader =
+				open_source_raster_file_cache_format_reader(raster_band, band_number);
+	}
+
+	return true;
+}
+
+
+void
+GPlatesFileIO::GDALRasterReader::check_creating_file_caches_cancelled()
+{
+	boost::lock_guard<boost::mutex> lock(d_file_cache_mutex);
+	if (d_cancel_creating_file_caches)
 	{
-		// Can't write raster file cache anywhere.
-		return false;
+		throw GPlatesGlobal::LogException(
+				GPLATES_EXCEPTION_SOURCE, "Creation of source raster file cache cancelled.");
 	}
+}
+
+
+bool
+GPlatesFileIO::GDALRasterReader::create_source_raster_file_cache(
+		RasterBand &raster_band,
+		unsigned int band_number,
+		ReadErrorAccumulation *read_errors)
+{
+	boost::optional<QString> cache_filename;
+	QString partial_cache_filename;
 
 	// Write the cache file.
 	try
 	{
+		// Another reader of the same raster (in this process) might be writing the same cache file,
+		// in which case wait for it to finish (unless this reader is destroyed in the meantime).
+		RasterFileCacheWriteLock write_lock(
+				RasterFileCacheWriteLock::get_source_cache_id(d_source_raster_filename, band_number),
+				boost::bind(&GDALRasterReader::check_creating_file_caches_cancelled, this));
+
+		// If it was written while we were waiting then we don't need to write it.
+		if (is_source_raster_file_cache_up_to_date(band_number))
+		{
+			return true;
+		}
+
+		cache_filename =
+				RasterFileCacheFormat::get_writable_source_cache_filename(d_source_raster_filename, band_number);
+		if (!cache_filename)
+		{
+			// Can't write raster file cache anywhere.
+			return false;
+		}
+
+		// Write to a partial file and only move it into place once complete.
+		// This way a reader never sees a partially written cache file.
+		partial_cache_filename = RasterFileCacheWriteLock::get_partial_cache_filename(cache_filename.get());
+
 		switch (raster_band.raster_type)
 		{
 			case GPlatesPropertyValues::RasterType::UINT8:
 				write_source_raster_file_cache<GPlatesPropertyValues::UInt8RawRaster>(
-						raster_band, cache_filename.get(), read_errors);
+						raster_band, partial_cache_filename, read_errors);
 				break;
 
 			case GPlatesPropertyValues::RasterType::UINT16:
 				write_source_raster_file_cache<GPlatesPropertyValues::UInt16RawRaster>(
-						raster_band, cache_filename.get(), read_errors);
+						raster_band, partial_cache_filename, read_errors);
 				break;
 
 			case GPlatesPropertyValues::RasterType::INT16:
 				write_source_raster_file_cache<GPlatesPropertyValues::Int16RawRaster>(
-						raster_band, cache_filename.get(), read_errors);
+						raster_band, partial_cache_filename, read_errors);
 				break;
 
 			case GPlatesPropertyValues::RasterType::UINT32:
 				write_source_raster_file_cache<GPlatesPropertyValues::UInt32RawRaster>(
-						raster_band, cache_filename.get(), read_errors);
+						raster_band, partial_cache_filename, read_errors);
 				break;
 
 			case GPlatesPropertyValues::RasterType::INT32:
 				write_source_raster_file_cache<GPlatesPropertyValues::Int32RawRaster>(
-						raster_band, cache_filename.get(), read_errors);
+						raster_band, partial_cache_filename, read_errors);
 				break;
 
 			case GPlatesPropertyValues::RasterType::FLOAT:
 				write_source_raster_file_cache<GPlatesPropertyValues::FloatRawRaster>(
-						raster_band, cache_filename.get(), read_errors);
+						raster_band, partial_cache_filename, read_errors);
 				break;
 
 			case GPlatesPropertyValues::RasterType::DOUBLE:
 				write_source_raster_file_cache<GPlatesPropertyValues::DoubleRawRaster>(
-						raster_band, cache_filename.get(), read_errors);
+						raster_band, partial_cache_filename, read_errors);
 				break;
 
 			case GPlatesPropertyValues::RasterType::RGBA8:
 				write_source_raster_file_cache<GPlatesPropertyValues::Rgba8RawRaster>(
-						raster_band, cache_filename.get(), read_errors);
+						raster_band, partial_cache_filename, read_errors);
 				break;
 
 			default:
@@ -1711,27 +1959,40 @@ GPlatesFileIO::GDALRasterReader::create_source_raster_file_cache(
 		}
 
 		// Copy the file permissions from the source raster file to the cache file.
-		QFile::setPermissions(cache_filename.get(), QFile::permissions(d_source_raster_filename));
+		QFile::setPermissions(partial_cache_filename, QFile::permissions(d_source_raster_filename));
+
+		if (!RasterFileCacheWriteLock::commit_partial_cache_file(partial_cache_filename, cache_filename.get()))
+		{
+			throw GPlatesGlobal::LogException(
+					GPLATES_EXCEPTION_SOURCE, "Unable to move completed cache file into place.");
+		}
 	}
 	catch (std::exception &exc)
 	{
 		// Log the exception so we know what caused the failure.
-		qWarning() << "Error writing source raster file cache '" << cache_filename.get()
-				<< "', removing it: " << exc.what();
+		qWarning() << "Error writing source raster file cache for band" << band_number
+				<< "of raster '" << d_source_raster_filename << "': " << exc.what();
 
-		// Remove the cache file in case it was partially written.
-		QFile(cache_filename.get()).remove();
+		// Remove the partially written cache file (if any).
+		// Note that the cache file itself is never partially written.
+		if (!partial_cache_filename.isEmpty())
+		{
+			QFile(partial_cache_filename).remove();
+		}
 
 		return false;
 	}
 	catch (...)
 	{
 		// Log the exception so we know what caused the failure.
-		qWarning() << "Unknown error writing source raster file cache '" << cache_filename.get()
-				<< "', removing it";
+		qWarning() << "Unknown error writing source raster file cache for band" << band_number
+				<< "of raster '" << d_source_raster_filename << "'";
 
-		// Remove the cache file in case it was partially written.
-		QFile(cache_filename.get()).remove();
+		// Remove the partially written cache file (if any).
+		if (!partial_cache_filename.isEmpty())
+		{
+			QFile(partial_cache_filename).remove();
+		}
 
 		return false;
 	}
@@ -1740,6 +2001,21 @@ GPlatesFileIO::GDALRasterReader::create_source_raster_file_cache(
 }
 
 
+bool
+GPlatesFileIO::GDALRasterReader::is_source_raster_file_cache_up_to_date(
+		unsigned int band_number)
+{
+	boost::optional<QString> cache_filename =
+			RasterFileCacheFormat::get_existing_source_cache_filename(d_source_raster_filename, band_number);
+	if (!cache_filename)
+	{
+		return false;
+	}
+
+	return QFileInfo(d_source_raster_filename).lastModified() <= QFileInfo(cache_filename.get()).lastModified();
+}
+
+
 template <class RawRasterType>
 void
 GPlatesFileIO::GDALRasterReader::write_source_raster_file_cache(
@@ -1747,8 +2023,6 @@ GPlatesFileIO::GDALRasterReader::write_source_raster_file_cache(
 		const QString &cache_filename,
 		ReadErrorAccumulation *read_errors)
 {
-	PROFILE_FUNC();
-
 	// Open the cache file for writing.
 	QFile cache_file(cache_filename);
 	if (!cache_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
@@ -1815,6 +2089,9 @@ GPlatesFileIO::GDALRasterReader::write_source_raster_file_cache(
 	out << static_cast<double>(0); // raster_mean - doesn't matter what gets read.
 	out << static_cast<double>(0); // raster_standard_deviation - doesn't matter what gets read.
 
+	// Write the byte order of the encoded block data.
+	out << static_cast<quint32>(QSysInfo::ByteOrder);
+
 	// The block information will get written next.
 	const qint64 block_info_file_offset = cache_file.pos();
 
@@ -1835,14 +2112,13 @@ GPlatesFileIO::GDALRasterReader::write_source_raster_file_cache(
 		block_info.height = 0;
 		block_info.main_offset = 0;
 		block_info.coverage_offset = 0;
+		block_info.main_size = 0;
+		block_info.coverage_size = 0;
+		block_info.main_compression = RasterFileCacheFormat::BLOCK_UNCOMPRESSED;
+		block_info.coverage_compression = RasterFileCacheFormat::BLOCK_UNCOMPRESSED;
 
 		// Write out the dummy block information.
-		out << block_info.x_offset
-			<< block_info.y_offset
-			<< block_info.width
-			<< block_info.height
-			<< block_info.main_offset
-			<< block_info.coverage_offset;
+		RasterFileCacheFormat::write_block_info(out, block_info);
 	}
 
 	// Raster statistics to calculate as we write the source raster file cache.
@@ -1922,12 +2198,7 @@ GPlatesFileIO::GDALRasterReader::write_source_raster_file_cache(
 				block_infos.get_block_info(block_index);
 
 		// Write out the proper block information.
-		out << block_info.x_offset
-			<< block_info.y_offset
-			<< block_info.width
-			<< block_info.height
-			<< block_info.main_offset
-			<< block_info.coverage_offset;
+		RasterFileCacheFormat::write_block_info(out, block_info);
 	}
 
 	// Write the total size of the cache file so the reader can verify that the
@@ -2075,18 +2346,117 @@ GPlatesFileIO::GDALRasterReader::add_statistics(
 }
 
 
+boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type>
+GPlatesFileIO::GDALRasterReader::read_raw_raster(
+		const RasterBand &raster_band,
+		const QRect &region,
+		unsigned int level)
+{
+	// Each level halves the resolution so there's no point going beyond 32 levels.
+	if (level >= 32)
+	{
+		return boost::none;
+	}
+
+	try
+	{
+		switch (raster_band.raster_type)
+		{
+			case GPlatesPropertyValues::RasterType::UINT8:
+				return to_optional_raw_raster(
+						read_data<GPlatesPropertyValues::UInt8RawRaster>(raster_band, d_flip, region, level));
+
+			case GPlatesPropertyValues::RasterType::UINT16:
+				return to_optional_raw_raster(
+						read_data<GPlatesPropertyValues::UInt16RawRaster>(raster_band, d_flip, region, level));
+
+			case GPlatesPropertyValues::RasterType::INT16:
+				return to_optional_raw_raster(
+						read_data<GPlatesPropertyValues::Int16RawRaster>(raster_band, d_flip, region, level));
+
+			case GPlatesPropertyValues::RasterType::UINT32:
+				return to_optional_raw_raster(
+						read_data<GPlatesPropertyValues::UInt32RawRaster>(raster_band, d_flip, region, level));
+
+			case GPlatesPropertyValues::RasterType::INT32:
+				return to_optional_raw_raster(
+						read_data<GPlatesPropertyValues::Int32RawRaster>(raster_band, d_flip, region, level));
+
+			case GPlatesPropertyValues::RasterType::FLOAT:
+				return to_optional_raw_raster(
+						read_data<GPlatesPropertyValues::FloatRawRaster>(raster_band, d_flip, region, level));
+
+			case GPlatesPropertyValues::RasterType::DOUBLE:
+				return to_optional_raw_raster(
+						read_data<GPlatesPropertyValues::DoubleRawRaster>(raster_band, d_flip, region, level));
+
+			case GPlatesPropertyValues::RasterType::RGBA8:
+				return to_optional_raw_raster(
+						read_data<GPlatesPropertyValues::Rgba8RawRaster>(raster_band, d_flip, region, level));
+
+			default:
+				break;
+		}
+	}
+	catch (std::exception &exc)
+	{
+		// Log the exception so we know what caused the failure.
+		qWarning() << "Error reading raster '" << d_source_raster_filename << "': " << exc.what();
+	}
+
+	return boost::none;
+}
+
+
+void
+GPlatesFileIO::GDALRasterReader::get_source_window(
+		int &source_x_offset,
+		int &source_y_offset,
+		int &source_width,
+		int &source_height,
+		bool flip,
+		unsigned int level,
+		unsigned int region_x_offset,
+		unsigned int region_row,
+		unsigned int region_width)
+{
+	// Each pixel of a level covers 2^level x 2^level source pixels
+	// (or less near the right or bottom edge of the source raster).
+	// Using 64-bit integers to avoid overflow for very large rasters at high levels...
+	const quint64 source_x_begin = quint64(region_x_offset) << level;
+	const quint64 source_x_end = (std::min)(quint64(region_x_offset + region_width) << level, quint64(d_source_width));
+	const quint64 source_y_begin = quint64(region_row) << level;
+	const quint64 source_y_end = (std::min)(quint64(region_row + 1) << level, quint64(d_source_height));
+
+	source_x_offset = static_cast<int>(source_x_begin);
+	source_width = static_cast<int>(source_x_end - source_x_begin);
+	source_height = static_cast<int>(source_y_end - source_y_begin);
+
+	// Flipped rasters store their first row in the last scanline (see 'd_flip').
+	source_y_offset = flip
+			? static_cast<int>(d_source_height - source_y_end)
+			: static_cast<int>(source_y_begin);
+}
+
+
 template<class RawRasterType>
 boost::optional<typename RawRasterType::non_null_ptr_type>
 GPlatesFileIO::GDALRasterReader::read_data(
 		const RasterBand &raster_band,
 		bool flip,
-		const QRect &region)
+		const QRect &region,
+		unsigned int level)
 {
 	//typedef typename RawRasterType::element_type raster_element_type;
 
+	// The dimensions of the requested level.
+	// Each level halves the resolution of the previous level (rounding up).
+	const unsigned int level_width = ((quint64(d_source_width) - 1) >> level) + 1;
+	const unsigned int level_height = ((quint64(d_source_height) - 1) >> level) + 1;
+
 	// Allocate the buffer to read into.
 	unsigned int region_x_offset, region_y_offset, region_width, region_height;
-	if (!unpack_region(region, d_source_width, d_source_height,
+	if (!unpack_region(region, level_width, level_height,
 				region_x_offset, region_y_offset, region_width, region_height))
 	{
 		throw GPlatesGlobal::LogException(
@@ -2105,7 +2475,7 @@ GPlatesFileIO::GDALRasterReader::read_data(
 		return boost::none;
 	}
 
-	add_data(result.get()->data(), raster_band, flip,
+	add_data(result.get()->data(), raster_band, flip, level,
 				region_x_offset, region_y_offset, region_width, region_height);
 
 	// Add the no-data value after adding the data.
@@ -2251,11 +2621,10 @@ GPlatesFileIO::GDALRasterReader::hilbert_curve_traversal(
 			block_info.height = RasterFileCacheFormat::BLOCK_SIZE;
 		}
 
-		// Record the file offset of the current block of data.
-		block_info.main_offset = out.device()->pos();
-
 		// TODO: Add coverage data.
 		block_info.coverage_offset = 0;
+		block_info.coverage_size = 0;
+		block_info.coverage_compression = RasterFileCacheFormat::BLOCK_UNCOMPRESSED;
 
 		// We should already have source region data.
 		GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
@@ -2270,9 +2639,11 @@ GPlatesFileIO::GDALRasterReader::hilbert_curve_traversal(
 					int(block_info.y_offset + block_info.height) <= source_region.y() + source_region.height(),
 				GPLATES_ASSERTION_SOURCE);
 
-		PROFILE_BLOCK("Write GDAL raster data to file cache");
+		// Stop if this reader is being destroyed.
+		check_creating_file_caches_cancelled();
 
-		// Write the current block from the source region to the output stream.
+		// Copy the current block from the source region into contiguous block data.
+		std::vector<typename RawRasterType::element_type> block_data(block_info.width * block_info.height);
 		for (unsigned int y = 0; y < block_info.height; ++y)
 		{
 			// Using std::size_t in case 64-bit and in case source region is larger than 4Gb...
@@ -2281,12 +2652,23 @@ GPlatesFileIO::GDALRasterReader::hilbert_curve_traversal(
 						std::size_t(block_info.y_offset - source_region.y() + y) * source_region.width() +
 						block_info.x_offset - source_region.x();
 
-			for (unsigned int x = 0; x < block_info.width; ++x)
-			{
-				out << source_region_row[x];
-			}
+			std::copy(
+					source_region_row,
+					source_region_row + block_info.width,
+					block_data.begin() + y * block_info.width);
 		}
 
+		// Write the block data (in the native byte order) to the output stream and record the
+		// (aligned) file offset of the current block of data.
+		block_info.main_offset = RasterFileCacheFormat::write_block_data(
+				out,
+				out.device()->pos(),
+				&block_data[0],
+				block_data.size() * sizeof(typename RawRasterType::element_type),
+				RasterFileCacheFormat::MAIN_BLOCK_COMPRESSION,
+				block_info.main_size,
+				block_info.main_compression);
+
 		return;
 	}
 
@@ -31,7 +31,10 @@
 #include <vector>
 #include <boost/function.hpp>
 #include <boost/optional.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
 #include <boost/variant.hpp>
 #include <QString>
 #include <QtGlobal>
@@ -54,10 +57,16 @@ namespace GPlatesFileIO
 	{
 	public:
 
+		/**
+		 * Any missing (or out-of-date) raster file caches are created in the background unless
+		 * @a wait_for_file_caches is true, in which case the source raster file caches are
+		 * created before returning (see @a RasterReader::create).
+		 */
 		GDALRasterReader(
 				const QString &filename,
 				RasterReader *raster_reader,
-				ReadErrorAccumulation *read_errors);
+				ReadErrorAccumulation *read_errors,
+				bool wait_for_file_caches = false);
 
 		~GDALRasterReader();
 
@@ -102,6 +111,23 @@ namespace GPlatesFileIO
 				unsigned int band_number,
 				ReadErrorAccumulation *read_errors);
 
+		/**
+		 * Reads with a buffer smaller than the region of the source raster, which GDAL samples
+		 * from the raster's overviews (if it has any) or otherwise decimates.
+		 */
+		virtual
+		boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type>
+		get_decimated_raw_raster(
+				unsigned int band_number,
+				unsigned int level,
+				const QRect &region,
+				ReadErrorAccumulation *read_errors);
+
+		virtual
+		bool
+		is_raster_file_cache_complete(
+				unsigned int band_number);
+
 	private:
 
 		/**
@@ -133,13 +159,37 @@ namespace GPlatesFileIO
 					GPlatesPropertyValues::RasterType::Type raster_type_,
 					const gdal_raster_band_type &gdal_raster_band_) :
 				raster_type(raster_type_),
-				gdal_raster_band(gdal_raster_band_)
+				gdal_raster_band(gdal_raster_band_),
+				creating_file_cache(false)
 			{  }
 
 			GPlatesPropertyValues::RasterType::Type raster_type;
 			gdal_raster_band_type gdal_raster_band;
-			//! Source raster file cache reader.
+			//! Source raster file cache reader (NULL if data is read directly from the source raster).
 			boost::shared_ptr<SourceRasterFileCacheFormatReader> file_cache_format_reader;
+			//! Whether the source raster file cache is (or was, until checked) being created by @a d_file_cache_thread.
+			bool creating_file_cache;
+		};
+
+
+		/**
+		 * A source raster file cache to be created by @a d_file_cache_thread.
+		 */
+		struct FileCacheRequest
+		{
+			FileCacheRequest(
+					unsigned int band_number_,
+					GPlatesPropertyValues::RasterType::Type raster_type_,
+					int gdal_band_number_) :
+				band_number(band_number_),
+				raster_type(raster_type_),
+				gdal_band_number(gdal_band_number_)
+			{  }
+
+			unsigned int band_number;
+			GPlatesPropertyValues::RasterType::Type raster_type;
+			//! The GDAL band number, or zero for a colour band (made from RGB[A] GDAL bands).
+			int gdal_band_number;
 		};
 
 
@@ -147,7 +197,8 @@ namespace GPlatesFileIO
 		initialise_source_raster_dimensions();
 
 		boost::optional<RasterBand::GDALRgbaBands>
-		is_colour_raster();
+		is_colour_raster(
+				GDALDataset *dataset);
 
 		void
 		report_recoverable_error(
@@ -167,15 +218,15 @@ namespace GPlatesFileIO
 				ReadErrorAccumulation *read_errors);
 
 		/**
-		 * Creates a reader for the cached source raster.
+		 * Opens a reader for the cached source raster, if the cache exists and is up-to-date.
 		 *
-		 * If no cache exists, or it's out-of-date, etc then the cache is regenerated.
+		 * Returns NULL if the cache needs to be (re)generated (any out-of-date, or unreadable,
+		 * cache file is removed).
 		 */
 		boost::shared_ptr<GPlatesFileIO::SourceRasterFileCacheFormatReader>
-		create_source_raster_file_cache_format_reader(
+		open_source_raster_file_cache_format_reader(
 				RasterBand &raster_band,
-				unsigned int band_number,
-				ReadErrorAccumulation *read_errors);
+				unsigned int band_number);
 
 		boost::shared_ptr<SourceRasterFileCacheFormatReader>
 		create_source_raster_file_cache_format_reader(
@@ -185,6 +236,9 @@ namespace GPlatesFileIO
 
 		/**
 		 * Creates a raster file cache for the source raster (returns false if unsuccessful).
+		 *
+		 * If another thread is writing the same cache then waits for it to finish (and only
+		 * writes the cache if that failed).
 		 */
 		bool
 		create_source_raster_file_cache(
@@ -192,6 +246,41 @@ namespace GPlatesFileIO
 				unsigned int band_number,
 				ReadErrorAccumulation *read_errors);
 
+		/**
+		 * Returns true if the source raster file cache of the specified band exists and
+		 * is not older than the source raster.
+		 */
+		bool
+		is_source_raster_file_cache_up_to_date(
+				unsigned int band_number);
+
+		/**
+		 * Creates the requested source raster file caches, and then their mipmap file caches -
+		 * this is run by @a d_file_cache_thread.
+		 *
+		 * The caches are created using a separate GDAL dataset since GDAL datasets
+		 * cannot be used by more than one thread at a time.
+		 */
+		void
+		create_source_raster_file_caches(
+				const std::vector<FileCacheRequest> &file_cache_requests);
+
+		/**
+		 * Opens the source raster file cache of the specified band if @a d_file_cache_thread
+		 * has finished creating it since last checked.
+		 *
+		 * Returns false if the cache is still being created.
+		 */
+		bool
+		update_source_raster_file_cache_format_reader(
+				unsigned int band_number);
+
+		/**
+		 * Throws an exception (in @a d_file_cache_thread) if this reader is being destroyed.
+		 */
+		void
+		check_creating_file_caches_cancelled();
+
 		template <class RawRasterType>
 		void
 		write_source_raster_file_cache(
@@ -244,12 +333,29 @@ namespace GPlatesFileIO
 				const RasterBand &raster_band,
 				ReadErrorAccumulation *read_errors);
 
+		/**
+		 * Returns the window of the source raster (in GDAL pixel coordinates) covered by
+		 * the row @a region_row of a region at the specified resolution @a level.
+		 */
+		void
+		get_source_window(
+				int &source_x_offset,
+				int &source_y_offset,
+				int &source_width,
+				int &source_height,
+				bool flip,
+				unsigned int level,
+				unsigned int region_x_offset,
+				unsigned int region_row,
+				unsigned int region_width);
+
 		template<typename RasterElementType>
 		void
 		add_data(
 				RasterElementType *result_buf,
 				const RasterBand &raster_band,
 				bool flip,
+				unsigned int level,
 				unsigned int region_x_offset,
 				unsigned int region_y_offset,
 				unsigned int region_width,
@@ -261,17 +367,33 @@ namespace GPlatesFileIO
 				GPlatesGui::rgba8_t *result_buf,
 				const RasterBand::GDALRgbaBands &gdal_rgba_raster_bands,
 				bool flip,
+				unsigned int level,
 				unsigned int region_x_offset,
 				unsigned int region_y_offset,
 				unsigned int region_width,
 				unsigned int region_height);
 
+		/**
+		 * Reads the specified region at the specified resolution @a level directly from the
+		 * source raster (bypassing the source raster file cache).
+		 */
+		boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type>
+		read_raw_raster(
+				const RasterBand &raster_band,
+				const QRect &region,
+				unsigned int level);
+
+		/**
+		 * Reads the specified region at the specified resolution @a level directly from the source raster
+		 * (level zero is full resolution and each level halves the resolution of the previous level).
+		 */
 		template<class RawRasterType>
 		boost::optional<typename RawRasterType::non_null_ptr_type>
 		read_data(
 				const RasterBand &raster_band,
 				bool flip,
-				const QRect &region);
+				const QRect &region,
+				unsigned int level = 0);
 
 		template <class RawRasterType>
 		void
@@ -365,9 +487,34 @@ namespace GPlatesFileIO
 		std::vector<RasterBand> d_raster_bands;
 
 		/**
-		 * A source raster file cache reader for each raster band.
+		 * Creates any missing (or out-of-date) source raster file caches in the background,
+		 * followed by their mipmap file caches.
+		 *
+		 * Until a band's cache is created its data is read directly from the source raster.
+		 */
+		boost::scoped_ptr<boost::thread> d_file_cache_thread;
+
+		/**
+		 * Protects the following data shared with @a d_file_cache_thread.
+		 */
+		boost::mutex d_file_cache_mutex;
+
+		/**
+		 * Whether @a d_file_cache_thread is still creating the source raster file cache of each band
+		 * (indexed by band number - 1).
+		 */
+		std::vector<bool> d_creating_raster_band_file_caches;
+
+		/**
+		 * Whether @a d_file_cache_thread is still creating the mipmap file cache of each band
+		 * (indexed by band number - 1).
+		 */
+		std::vector<bool> d_creating_raster_band_mipmap_file_caches;
+
+		/**
+		 * Set when this reader is destroyed to stop @a d_file_cache_thread.
 		 */
-		std::vector<boost::shared_ptr<SourceRasterFileCacheFormatReader> > d_raster_band_file_cache_format_readers;
+		bool d_cancel_creating_file_caches;
 	};
 
 
@@ -399,6 +546,7 @@ namespace GPlatesFileIO
 			GPlatesGui::rgba8_t *result_buf,
 			const GDALRasterReader::RasterBand &raster_band,
 			bool flip,
+			unsigned int level,
 			unsigned int region_x_offset,
 			unsigned int region_y_offset,
 			unsigned int region_width,
@@ -0,0 +1,139 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <boost/any.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "GpmlBinaryFeatureIndex.h"
+
+#include "model/TopLevelPropertyInline.h"
+
+
+const std::string GPlatesFileIO::GpmlBinaryFeatureIndex::FEATURE_COLLECTION_TAG("gpmlb_feature_index");
+
+
+bool
+GPlatesFileIO::GpmlBinaryFeatureIndex::Entry::is_valid_at_recon_time(
+		const double &reconstruction_time) const
+{
+	if (time_of_appearance &&
+		time_of_disappearance)
+	{
+		const GPlatesPropertyValues::GeoTimeInstant reconstruction_geo_time(reconstruction_time);
+
+		return time_of_appearance->is_earlier_than_or_coincident_with(reconstruction_geo_time) &&
+				reconstruction_geo_time.is_earlier_than_or_coincident_with(time_of_disappearance.get());
+	}
+
+	return true;
+}
+
+
+GPlatesFileIO::GpmlBinaryFeatureIndex &
+GPlatesFileIO::GpmlBinaryFeatureIndex::get_or_create(
+		GPlatesModel::FeatureCollectionHandle &feature_collection)
+{
+	boost::any &feature_index_tag = feature_collection.tags()[FEATURE_COLLECTION_TAG];
+
+	// If first time tag added then set it to an empty index.
+	// Note that the index is shared (rather than copied) when the tag is copied.
+	if (feature_index_tag.empty())
+	{
+		feature_index_tag = boost::shared_ptr<GpmlBinaryFeatureIndex>(new GpmlBinaryFeatureIndex());
+	}
+
+	return *boost::any_cast<boost::shared_ptr<GpmlBinaryFeatureIndex> >(feature_index_tag);
+}
+
+
+boost::optional<const GPlatesFileIO::GpmlBinaryFeatureIndex::Entry &>
+GPlatesFileIO::GpmlBinaryFeatureIndex::get_entry(
+		const GPlatesModel::FeatureHandle &feature)
+{
+	const GPlatesModel::FeatureCollectionHandle *feature_collection = feature.parent_ptr();
+	if (feature_collection == NULL)
+	{
+		return boost::none;
+	}
+
+	const GPlatesModel::FeatureCollectionHandle::tags_type &tags = feature_collection->tags();
+	GPlatesModel::FeatureCollectionHandle::tags_type::const_iterator feature_index_tag_iter =
+			tags.find(FEATURE_COLLECTION_TAG);
+	if (feature_index_tag_iter == tags.end())
+	{
+		return boost::none;
+	}
+
+	const boost::shared_ptr<GpmlBinaryFeatureIndex> *feature_index =
+			boost::any_cast<boost::shared_ptr<GpmlBinaryFeatureIndex> >(&feature_index_tag_iter->second);
+	if (feature_index == NULL)
+	{
+		return boost::none;
+	}
+
+	const entry_map_type &entries = (*feature_index)->d_entries;
+	entry_map_type::const_iterator entry_iter = entries.find(&feature);
+	if (entry_iter == entries.end())
+	{
+		return boost::none;
+	}
+
+	// The entry no longer applies if the feature was modified since it was read.
+	// This also guards against a new feature re-using the memory of a deleted feature.
+	const Entry &entry = entry_iter->second;
+	if (!(entry.revision_id == feature.revision_id()))
+	{
+		return boost::none;
+	}
+
+	// Not all modifications change the revision ID (eg, property values modified in-place), but a
+	// property value can only be modified once it's decoded. So the entry only applies while none
+	// of the feature's property values have been decoded.
+	GPlatesModel::FeatureHandle::const_iterator properties_iter = feature.begin();
+	GPlatesModel::FeatureHandle::const_iterator properties_end = feature.end();
+	for ( ; properties_iter != properties_end; ++properties_iter)
+	{
+		const GPlatesModel::TopLevelPropertyInline *property =
+				dynamic_cast<const GPlatesModel::TopLevelPropertyInline *>((*properties_iter).get());
+		if (property == NULL ||
+			!property->has_lazy_values())
+		{
+			return boost::none;
+		}
+	}
+
+	return entry;
+}
+
+
+void
+GPlatesFileIO::GpmlBinaryFeatureIndex::add_entry(
+		const GPlatesModel::FeatureHandle &feature,
+		const Entry &entry)
+{
+	entry_map_type::iterator entry_iter = d_entries.find(&feature);
+	if (entry_iter != d_entries.end())
+	{
+		entry_iter->second = entry;
+	}
+	else
+	{
+		d_entries.insert(entry_map_type::value_type(&feature, entry));
+	}
+}
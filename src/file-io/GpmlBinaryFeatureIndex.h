@@ -0,0 +1,135 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILE_IO_GPMLBINARYFEATUREINDEX_H
+#define GPLATES_FILE_IO_GPMLBINARYFEATUREINDEX_H
+
+#include <map>
+#include <string>
+#include <boost/optional.hpp>
+
+#include "maths/SmallCircleBounds.h"
+
+#include "model/FeatureCollectionHandle.h"
+#include "model/FeatureHandle.h"
+#include "model/RevisionId.h"
+#include "model/types.h"
+
+#include "property-values/GeoTimeInstant.h"
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * A summary of the valid time, reconstruction plate ID and geometry bounds of the features
+	 * read from a binary GPML (".gpmlb") file that was written with a feature index.
+	 *
+	 * This allows clients (such as reconstruct layers) to skip features without visiting (and hence
+	 * decoding) their properties, which matters when features are loaded lazily.
+	 *
+	 * The index is stored as a tag in the feature collection. A feature's index entry is only
+	 * returned while the feature remains unmodified since it was read, which is while its revision ID
+	 * is unchanged and none of its (lazily loaded) property values have been decoded (since property
+	 * values can be modified in-place without changing the revision ID). So entries are only useful
+	 * for lazily loaded features.
+	 */
+	class GpmlBinaryFeatureIndex
+	{
+	public:
+
+		/**
+		 * The summary of a feature.
+		 *
+		 * A part of the summary is none if the feature does not have the corresponding property.
+		 */
+		struct Entry
+		{
+			explicit
+			Entry(
+					const GPlatesModel::RevisionId &revision_id_) :
+				revision_id(revision_id_)
+			{  }
+
+			/**
+			 * Returns true if @a reconstruction_time lies within the valid time or if there's
+			 * no valid time (meaning valid for all time).
+			 */
+			bool
+			is_valid_at_recon_time(
+					const double &reconstruction_time) const;
+
+
+			//! The revision of the feature when it was read.
+			GPlatesModel::RevisionId revision_id;
+
+			boost::optional<GPlatesPropertyValues::GeoTimeInstant> time_of_appearance;
+			boost::optional<GPlatesPropertyValues::GeoTimeInstant> time_of_disappearance;
+
+			boost::optional<GPlatesModel::integer_plate_id_type> reconstruction_plate_id;
+
+			//! Bounds all geometries of the feature (none if the feature has no geometry).
+			boost::optional<GPlatesMaths::BoundingSmallCircle> bounds;
+		};
+
+
+		/**
+		 * Returns the index stored in @a feature_collection, first storing an empty index if
+		 * it does not have one.
+		 */
+		static
+		GpmlBinaryFeatureIndex &
+		get_or_create(
+				GPlatesModel::FeatureCollectionHandle &feature_collection);
+
+		/**
+		 * Returns the index entry of @a feature.
+		 *
+		 * Returns none if the feature is not in a feature collection with an index, if the feature
+		 * has no entry in the index or if the feature might have been modified since it was read
+		 * (its revision ID changed or any of its property values have been decoded).
+		 */
+		static
+		boost::optional<const Entry &>
+		get_entry(
+				const GPlatesModel::FeatureHandle &feature);
+
+
+		/**
+		 * Adds (or replaces) the index entry of @a feature.
+		 */
+		void
+		add_entry(
+				const GPlatesModel::FeatureHandle &feature,
+				const Entry &entry);
+
+	private:
+
+		/**
+		 * The key string used when storing the index as a tag in a FeatureCollectionHandle.
+		 */
+		static const std::string FEATURE_COLLECTION_TAG;
+
+
+		typedef std::map<const GPlatesModel::FeatureHandle *, Entry> entry_map_type;
+
+		entry_map_type d_entries;
+	};
+}
+
+#endif // GPLATES_FILE_IO_GPMLBINARYFEATUREINDEX_H
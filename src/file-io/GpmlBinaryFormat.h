@@ -0,0 +1,180 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILE_IO_GPMLBINARYFORMAT_H
+#define GPLATES_FILE_IO_GPMLBINARYFORMAT_H
+
+#include <QDataStream>
+#include <QtGlobal>
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * Layout of the binary GPML (".gpmlb") feature collection file format.
+	 *
+	 * This is a compact binary equivalent of GPML that is much faster to read and write.
+	 *
+	 * The file starts with a header:
+	 *   - the magic bytes @a MAGIC,
+	 *   - the format version (quint32),
+	 *   - the version string of the GPGIM used to write the features (QString).
+	 *
+	 * This is followed by a sequence of blocks, terminated by a zero (quint32). Each block is:
+	 *   - the stored size of the block data (quint32, non-zero),
+	 *   - the uncompressed size of the block data (quint32),
+	 *   - the block compression (quint8, see @a BlockCompression),
+	 *   - the (possibly compressed) block data.
+	 *
+	 * The uncompressed block data contains:
+	 *   - the strings interned by this block (appended to the strings of previous blocks),
+	 *   - the qualified XML names interned by this block (each is three string indices:
+	 *     namespace URI, namespace alias and name),
+	 *   - a GPML document containing the features in this block that are not encoded natively
+	 *     (an empty byte array if there are none),
+	 *   - the feature records (see @a FeatureEncoding).
+	 *
+	 * Feature types, property names, structural types (and other qualified names) are written as
+	 * indices into the interned qualified names. Geometry coordinates are written as contiguous
+	 * blocks of (x,y,z) unit-vector doubles (which, unlike lat/lon, round-trip exactly).
+	 *
+	 * Features containing property value types without a native encoding (or top-level properties
+	 * with XML attributes) are written as GPML (in each block's GPML document) which means every
+	 * property value type round-trips losslessly.
+	 * Native encodings can be added for those types (see @a PropertyValueEncoding) with a
+	 * corresponding increment of @a VERSION.
+	 *
+	 * Geological times are written as doubles (with infinities representing the distant past/future).
+	 *
+	 * All numbers are little-endian.
+	 */
+	namespace GpmlBinaryFormat
+	{
+		/**
+		 * The magic bytes at the start of each file.
+		 */
+		static const char MAGIC[] = "GPMLBIN";
+		static const int MAGIC_SIZE = sizeof(MAGIC); // Includes the terminating zero.
+
+		/**
+		 * The current version of the format.
+		 *
+		 * Files with a later version cannot be read.
+		 */
+		static const quint32 VERSION = 1;
+
+		/**
+		 * Blocks are written once their uncompressed feature data reaches this size.
+		 */
+		static const int BLOCK_SIZE = 1024 * 1024;
+
+		/**
+		 * The QDataStream version used to serialise strings and byte arrays.
+		 */
+		static const int DATA_STREAM_VERSION = QDataStream::Qt_5_6;
+
+
+		/**
+		 * The compression of a block.
+		 */
+		enum BlockCompression
+		{
+			BLOCK_UNCOMPRESSED = 0,
+			BLOCK_ZLIB = 1 // Compressed with 'qCompress()'.
+		};
+
+		/**
+		 * How a feature record is encoded.
+		 */
+		enum FeatureEncoding
+		{
+			/**
+			 * Feature type (qualified name index), feature ID (QString), revision ID (QString),
+			 * the feature summary (see @a FeatureSummaryFlags) and the number of properties (quint32)
+			 * followed by each property's name (qualified name index), number of values (quint32),
+			 * size of the encoded values in bytes (quint32) and the values (see @a PropertyValueEncoding).
+			 */
+			FEATURE_NATIVE = 0,
+
+			/**
+			 * The feature in the block's GPML document with the feature ID (QString) that follows.
+			 *
+			 * The feature ID (rather than the position in the GPML document) identifies the feature
+			 * so that a GPML feature that fails to read does not shift the remaining GPML features
+			 * into the wrong records.
+			 */
+			FEATURE_GPML = 1
+		};
+
+		/**
+		 * The optional parts of the summary of a natively encoded feature.
+		 *
+		 * The summary starts with these flags (quint8) followed by each part that is present (in order):
+		 *   - the begin and end of the "gml:validTime" property (two doubles),
+		 *   - the "gpml:reconstructionPlateId" property (quint64),
+		 *   - a small circle bounding all geometries (centre (x,y,z) and cosine of the radius, four doubles).
+		 */
+		enum FeatureSummaryFlags
+		{
+			FEATURE_SUMMARY_VALID_TIME = 1 << 0,
+			FEATURE_SUMMARY_RECONSTRUCTION_PLATE_ID = 1 << 1,
+			FEATURE_SUMMARY_BOUNDS = 1 << 2
+		};
+
+		/**
+		 * How a property value is encoded (each property value is preceded by one of these as a quint8).
+		 */
+		enum PropertyValueEncoding
+		{
+			PROPERTY_VALUE_ENUMERATION = 0,
+			PROPERTY_VALUE_GML_LINE_STRING,
+			PROPERTY_VALUE_GML_MULTI_POINT,
+			PROPERTY_VALUE_GML_ORIENTABLE_CURVE,
+			PROPERTY_VALUE_GML_POINT,
+			PROPERTY_VALUE_GML_POLYGON,
+			PROPERTY_VALUE_GML_TIME_INSTANT,
+			PROPERTY_VALUE_GML_TIME_PERIOD,
+			PROPERTY_VALUE_GPML_CONSTANT_VALUE,
+			PROPERTY_VALUE_GPML_PLATE_ID,
+			PROPERTY_VALUE_XS_BOOLEAN,
+			PROPERTY_VALUE_XS_DOUBLE,
+			PROPERTY_VALUE_XS_INTEGER,
+			PROPERTY_VALUE_XS_STRING,
+
+			NUM_PROPERTY_VALUE_ENCODINGS // Must be last.
+		};
+
+
+		/**
+		 * Sets the version, byte order and floating-point precision of a stream reading or writing
+		 * the binary format.
+		 */
+		inline
+		void
+		initialise_data_stream(
+				QDataStream &stream)
+		{
+			stream.setVersion(DATA_STREAM_VERSION);
+			stream.setByteOrder(QDataStream::LittleEndian);
+			stream.setFloatingPointPrecision(QDataStream::DoublePrecision);
+		}
+	}
+}
+
+#endif // GPLATES_FILE_IO_GPMLBINARYFORMAT_H
@@ -0,0 +1,1222 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <vector>
+#include <boost/foreach.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/optional.hpp>
+#include <boost/shared_ptr.hpp>
+#include <QBuffer>
+#include <QByteArray>
+#include <QDataStream>
+#include <QDebug>
+#include <QFile>
+#include <QString>
+#include <QtGlobal>
+
+#include "GpmlBinaryReader.h"
+
+#include "ErrorOpeningFileForReadingException.h"
+#include "GpmlBinaryFeatureIndex.h"
+#include "GpmlBinaryFormat.h"
+#include "GpmlReader.h"
+#include "ReadErrors.h"
+#include "ReadErrorOccurrence.h"
+
+#include "global/GPlatesException.h"
+
+#include "maths/AngularExtent.h"
+#include "maths/MultiPointOnSphere.h"
+#include "maths/PointOnSphere.h"
+#include "maths/PolygonOnSphere.h"
+#include "maths/PolylineOnSphere.h"
+#include "maths/SmallCircleBounds.h"
+#include "maths/UnitVector3D.h"
+
+#include "model/FeatureCollectionHandle.h"
+#include "model/FeatureHandle.h"
+#include "model/FeatureId.h"
+#include "model/FeatureType.h"
+#include "model/Gpgim.h"
+#include "model/GpgimVersion.h"
+#include "model/PropertyName.h"
+#include "model/RevisionId.h"
+#include "model/TopLevelPropertyInline.h"
+#include "model/XmlAttributeName.h"
+#include "model/XmlAttributeValue.h"
+
+#include "property-values/Enumeration.h"
+#include "property-values/EnumerationType.h"
+#include "property-values/GeoTimeInstant.h"
+#include "property-values/GmlLineString.h"
+#include "property-values/GmlMultiPoint.h"
+#include "property-values/GmlOrientableCurve.h"
+#include "property-values/GmlPoint.h"
+#include "property-values/GmlPolygon.h"
+#include "property-values/GmlTimeInstant.h"
+#include "property-values/GmlTimePeriod.h"
+#include "property-values/GpmlConstantValue.h"
+#include "property-values/GpmlPlateId.h"
+#include "property-values/StructuralType.h"
+#include "property-values/XsBoolean.h"
+#include "property-values/XsDouble.h"
+#include "property-values/XsInteger.h"
+#include "property-values/XsString.h"
+
+#include "utils/Profile.h"
+#include "utils/UnicodeString.h"
+
+
+namespace
+{
+	namespace Format = GPlatesFileIO::GpmlBinaryFormat;
+
+
+	/**
+	 * Thrown when the binary data is malformed (eg, a truncated or corrupted file).
+	 */
+	class MalformedDataException
+	{  };
+
+
+	/**
+	 * Throws @a MalformedDataException if a previous read from @a input failed.
+	 */
+	void
+	check_status(
+			const QDataStream &input)
+	{
+		if (input.status() != QDataStream::Ok)
+		{
+			throw MalformedDataException();
+		}
+	}
+
+
+	/**
+	 * Reads a contiguous block of little-endian doubles into @a values (which is already sized).
+	 */
+	void
+	read_doubles(
+			QDataStream &input,
+			std::vector<double> &values)
+	{
+		if (values.empty())
+		{
+			return;
+		}
+
+		const qint64 num_bytes = values.size() * sizeof(double);
+		if (input.readRawData(reinterpret_cast<char *>(&values[0]), num_bytes) != num_bytes)
+		{
+			throw MalformedDataException();
+		}
+
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+		BOOST_FOREACH(double &value, values)
+		{
+			char *bytes = reinterpret_cast<char *>(&value);
+			std::reverse(bytes, bytes + sizeof(double));
+		}
+#endif
+	}
+
+
+	/**
+	 * Reads the number of points followed by the (x,y,z) coordinates of each point.
+	 */
+	void
+	read_points(
+			QDataStream &input,
+			std::vector<GPlatesMaths::PointOnSphere> &points)
+	{
+		quint32 num_points;
+		input >> num_points;
+		check_status(input);
+
+		// Avoid allocating huge amounts of memory due to a corrupted number of points.
+		if (qint64(num_points) * 3 * sizeof(double) > input.device()->bytesAvailable())
+		{
+			throw MalformedDataException();
+		}
+
+		std::vector<double> coordinates(3 * num_points);
+		read_doubles(input, coordinates);
+
+		points.reserve(points.size() + num_points);
+		for (quint32 n = 0; n < num_points; ++n)
+		{
+			points.push_back(
+					GPlatesMaths::PointOnSphere(
+							GPlatesMaths::UnitVector3D(
+									coordinates[3 * n],
+									coordinates[3 * n + 1],
+									coordinates[3 * n + 2])));
+		}
+	}
+
+
+	/**
+	 * Decodes the strings, qualified names and property values of a binary GPML file.
+	 *
+	 * The strings and qualified names interned by each block are accumulated since
+	 * later blocks can refer to them.
+	 *
+	 * When loading lazily this is shared by the lazily decoded property values (and hence outlives the reader).
+	 */
+	class PropertyValueDecoder :
+			private boost::noncopyable
+	{
+	public:
+
+		void
+		read_strings(
+				QDataStream &input)
+		{
+			quint32 num_strings;
+			input >> num_strings;
+			check_status(input);
+
+			for (quint32 n = 0; n < num_strings; ++n)
+			{
+				QString string;
+				input >> string;
+				check_status(input);
+
+				d_strings.push_back(string);
+			}
+		}
+
+		void
+		read_qualified_names(
+				QDataStream &input)
+		{
+			quint32 num_qualified_names;
+			input >> num_qualified_names;
+			check_status(input);
+
+			for (quint32 n = 0; n < num_qualified_names; ++n)
+			{
+				quint32 namespace_uri_index;
+				quint32 namespace_alias_index;
+				quint32 name_index;
+				input >> namespace_uri_index >> namespace_alias_index >> name_index;
+				check_status(input);
+
+				if (namespace_uri_index >= d_strings.size() ||
+					namespace_alias_index >= d_strings.size() ||
+					name_index >= d_strings.size())
+				{
+					throw MalformedDataException();
+				}
+
+				QualifiedName qualified_name;
+				qualified_name.namespace_uri = d_strings[namespace_uri_index];
+				qualified_name.namespace_alias = d_strings[namespace_alias_index];
+				qualified_name.name = d_strings[name_index];
+				d_qualified_names.push_back(qualified_name);
+			}
+		}
+
+		const GPlatesModel::FeatureType &
+		read_feature_type(
+				QDataStream &input)
+		{
+			return read_qualified_name(input, d_feature_types);
+		}
+
+		const GPlatesModel::PropertyName &
+		read_property_name(
+				QDataStream &input)
+		{
+			return read_qualified_name(input, d_property_names);
+		}
+
+		GPlatesModel::PropertyValue::non_null_ptr_type
+		read_property_value(
+				QDataStream &input)
+		{
+			quint8 property_value_encoding;
+			input >> property_value_encoding;
+			check_status(input);
+
+			switch (property_value_encoding)
+			{
+			case Format::PROPERTY_VALUE_ENUMERATION:
+				{
+					const GPlatesPropertyValues::EnumerationType enumeration_type =
+							read_qualified_name(input, d_enumeration_types);
+					QString enumeration_content;
+					input >> enumeration_content;
+					check_status(input);
+
+					return GPlatesPropertyValues::Enumeration::create(
+							enumeration_type,
+							GPlatesUtils::UnicodeString(enumeration_content));
+				}
+
+			case Format::PROPERTY_VALUE_GML_LINE_STRING:
+				return read_line_string(input);
+
+			case Format::PROPERTY_VALUE_GML_MULTI_POINT:
+				{
+					std::vector<GPlatesMaths::PointOnSphere> points;
+					read_points(input, points);
+
+					std::vector<GPlatesPropertyValues::GmlPoint::GmlProperty> gml_properties;
+					gml_properties.reserve(points.size());
+					for (unsigned int n = 0; n < points.size(); ++n)
+					{
+						gml_properties.push_back(read_gml_property(input));
+					}
+
+					return GPlatesPropertyValues::GmlMultiPoint::create(
+							GPlatesMaths::MultiPointOnSphere::create(points),
+							gml_properties);
+				}
+
+			case Format::PROPERTY_VALUE_GML_ORIENTABLE_CURVE:
+				{
+					const std::map<GPlatesModel::XmlAttributeName, GPlatesModel::XmlAttributeValue> xml_attributes =
+							read_xml_attributes(input);
+
+					return GPlatesPropertyValues::GmlOrientableCurve::create(
+							read_line_string(input),
+							xml_attributes);
+				}
+
+			case Format::PROPERTY_VALUE_GML_POINT:
+				{
+					const GPlatesPropertyValues::GmlPoint::GmlProperty gml_property = read_gml_property(input);
+					std::pair<double, double> pos_2d;
+					input >> pos_2d.first >> pos_2d.second;
+					check_status(input);
+
+					return GPlatesPropertyValues::GmlPoint::create_from_pos_2d(pos_2d, gml_property);
+				}
+
+			case Format::PROPERTY_VALUE_GML_POLYGON:
+				{
+					std::vector<GPlatesMaths::PointOnSphere> exterior_ring;
+					read_points(input, exterior_ring);
+
+					quint32 num_interior_rings;
+					input >> num_interior_rings;
+					check_status(input);
+
+					std::vector< std::vector<GPlatesMaths::PointOnSphere> > interior_rings;
+					for (quint32 n = 0; n < num_interior_rings; ++n)
+					{
+						interior_rings.push_back(std::vector<GPlatesMaths::PointOnSphere>());
+						read_points(input, interior_rings.back());
+					}
+
+					return GPlatesPropertyValues::GmlPolygon::create(
+							GPlatesMaths::PolygonOnSphere::create(exterior_ring, interior_rings));
+				}
+
+			case Format::PROPERTY_VALUE_GML_TIME_INSTANT:
+				return read_time_instant(input);
+
+			case Format::PROPERTY_VALUE_GML_TIME_PERIOD:
+				{
+					const GPlatesPropertyValues::GmlTimeInstant::non_null_ptr_type begin = read_time_instant(input);
+					const GPlatesPropertyValues::GmlTimeInstant::non_null_ptr_type end = read_time_instant(input);
+
+					return GPlatesPropertyValues::GmlTimePeriod::create(begin, end);
+				}
+
+			case Format::PROPERTY_VALUE_GPML_CONSTANT_VALUE:
+				{
+					const GPlatesPropertyValues::StructuralType value_type =
+							read_qualified_name(input, d_structural_types);
+					QString description;
+					input >> description;
+					check_status(input);
+
+					return GPlatesPropertyValues::GpmlConstantValue::create(
+							read_property_value(input),
+							value_type,
+							GPlatesUtils::UnicodeString(description));
+				}
+
+			case Format::PROPERTY_VALUE_GPML_PLATE_ID:
+				{
+					quint64 plate_id;
+					input >> plate_id;
+					check_status(input);
+
+					return GPlatesPropertyValues::GpmlPlateId::create(plate_id);
+				}
+
+			case Format::PROPERTY_VALUE_XS_BOOLEAN:
+				{
+					quint8 value;
+					input >> value;
+					check_status(input);
+
+					return GPlatesPropertyValues::XsBoolean::create(value != 0);
+				}
+
+			case Format::PROPERTY_VALUE_XS_DOUBLE:
+				{
+					double value;
+					input >> value;
+					check_status(input);
+
+					return GPlatesPropertyValues::XsDouble::create(value);
+				}
+
+			case Format::PROPERTY_VALUE_XS_INTEGER:
+				{
+					qint32 value;
+					input >> value;
+					check_status(input);
+
+					return GPlatesPropertyValues::XsInteger::create(value);
+				}
+
+			case Format::PROPERTY_VALUE_XS_STRING:
+				{
+					QString value;
+					input >> value;
+					check_status(input);
+
+					return GPlatesPropertyValues::XsString::create(GPlatesUtils::UnicodeString(value));
+				}
+
+			default:
+				break;
+			}
+
+			// Unrecognised property value encoding.
+			throw MalformedDataException();
+		}
+
+		GPlatesPropertyValues::GmlLineString::non_null_ptr_type
+		read_line_string(
+				QDataStream &input)
+		{
+			std::vector<GPlatesMaths::PointOnSphere> points;
+			read_points(input, points);
+
+			return GPlatesPropertyValues::GmlLineString::create(
+					GPlatesMaths::PolylineOnSphere::create(points));
+		}
+
+		GPlatesPropertyValues::GmlTimeInstant::non_null_ptr_type
+		read_time_instant(
+				QDataStream &input)
+		{
+			double time_position;
+			input >> time_position;
+			check_status(input);
+
+			const GPlatesPropertyValues::GmlTimeInstant::xml_attribute_map_type xml_attributes =
+					read_xml_attributes(input);
+
+			return GPlatesPropertyValues::GmlTimeInstant::create(
+					GPlatesPropertyValues::GeoTimeInstant(time_position),
+					xml_attributes);
+		}
+
+		GPlatesPropertyValues::GmlPoint::GmlProperty
+		read_gml_property(
+				QDataStream &input)
+		{
+			quint8 gml_property;
+			input >> gml_property;
+			check_status(input);
+
+			if (gml_property != GPlatesPropertyValues::GmlPoint::POS &&
+				gml_property != GPlatesPropertyValues::GmlPoint::COORDINATES)
+			{
+				throw MalformedDataException();
+			}
+
+			return static_cast<GPlatesPropertyValues::GmlPoint::GmlProperty>(gml_property);
+		}
+
+		std::map<GPlatesModel::XmlAttributeName, GPlatesModel::XmlAttributeValue>
+		read_xml_attributes(
+				QDataStream &input)
+		{
+			quint32 num_xml_attributes;
+			input >> num_xml_attributes;
+			check_status(input);
+
+			std::map<GPlatesModel::XmlAttributeName, GPlatesModel::XmlAttributeValue> xml_attributes;
+			for (quint32 n = 0; n < num_xml_attributes; ++n)
+			{
+				const GPlatesModel::XmlAttributeName xml_attribute_name =
+						read_qualified_name(input, d_xml_attribute_names);
+				QString xml_attribute_value;
+				input >> xml_attribute_value;
+				check_status(input);
+
+				xml_attributes.insert(
+						std::make_pair(
+								xml_attribute_name,
+								GPlatesModel::XmlAttributeValue(GPlatesUtils::UnicodeString(xml_attribute_value))));
+			}
+
+			return xml_attributes;
+		}
+
+	private:
+
+		//! Namespace URI, namespace alias and name.
+		struct QualifiedName
+		{
+			QString namespace_uri;
+			QString namespace_alias;
+			QString name;
+		};
+
+		std::vector<QString> d_strings;
+		std::vector<QualifiedName> d_qualified_names;
+
+		//
+		// Qualified names are converted to these types on first use (this avoids repeatedly
+		// looking them up in their string sets).
+		//
+		std::vector< boost::optional<GPlatesModel::FeatureType> > d_feature_types;
+		std::vector< boost::optional<GPlatesModel::PropertyName> > d_property_names;
+		std::vector< boost::optional<GPlatesPropertyValues::StructuralType> > d_structural_types;
+		std::vector< boost::optional<GPlatesPropertyValues::EnumerationType> > d_enumeration_types;
+		std::vector< boost::optional<GPlatesModel::XmlAttributeName> > d_xml_attribute_names;
+
+
+		/**
+		 * Reads a qualified name index and returns the qualified name as a @a QualifiedXmlNameType.
+		 */
+		template <class QualifiedXmlNameType>
+		const QualifiedXmlNameType &
+		read_qualified_name(
+				QDataStream &input,
+				std::vector< boost::optional<QualifiedXmlNameType> > &qualified_xml_names)
+		{
+			quint32 qualified_name_index;
+			input >> qualified_name_index;
+			check_status(input);
+
+			if (qualified_name_index >= d_qualified_names.size())
+			{
+				throw MalformedDataException();
+			}
+
+			if (qualified_xml_names.size() < d_qualified_names.size())
+			{
+				qualified_xml_names.resize(d_qualified_names.size());
+			}
+
+			boost::optional<QualifiedXmlNameType> &qualified_xml_name = qualified_xml_names[qualified_name_index];
+			if (!qualified_xml_name)
+			{
+				const QualifiedName &qualified_name = d_qualified_names[qualified_name_index];
+				qualified_xml_name = QualifiedXmlNameType(
+						qualified_name.namespace_uri,
+						qualified_name.namespace_alias,
+						qualified_name.name);
+			}
+
+			return qualified_xml_name.get();
+		}
+	};
+
+
+	/**
+	 * A read-only memory-mapped file.
+	 */
+	class MappedFile :
+			private boost::noncopyable
+	{
+	public:
+
+		/**
+		 * Maps the entire file @a filename, or returns NULL if it cannot be mapped.
+		 */
+		static
+		boost::shared_ptr<MappedFile>
+		create(
+				const QString &filename)
+		{
+			boost::shared_ptr<MappedFile> mapped_file(new MappedFile(filename));
+			if (mapped_file->d_data == NULL)
+			{
+				return boost::shared_ptr<MappedFile>();
+			}
+
+			return mapped_file;
+		}
+
+		~MappedFile()
+		{
+			if (d_data)
+			{
+				d_file.unmap(d_data);
+			}
+		}
+
+		const uchar *
+		data() const
+		{
+			return d_data;
+		}
+
+		qint64
+		size() const
+		{
+			return d_size;
+		}
+
+	private:
+
+		QFile d_file;
+		uchar *d_data;
+		qint64 d_size;
+
+
+		explicit
+		MappedFile(
+				const QString &filename) :
+			d_file(filename),
+			d_data(NULL),
+			d_size(0)
+		{
+			if (d_file.open(QIODevice::ReadOnly))
+			{
+				d_size = d_file.size();
+				if (d_size > 0)
+				{
+					d_data = d_file.map(0, d_size);
+				}
+			}
+		}
+	};
+
+
+	/**
+	 * The property values of a top-level property that are decoded on first access.
+	 */
+	class LazyPropertyValues :
+			public GPlatesModel::TopLevelPropertyInline::LazyValues
+	{
+	public:
+
+		/**
+		 * @a block is the (uncompressed) block containing the property values, starting at
+		 * @a values_offset, and @a mapped_file (if any) is the file mapping that @a block might refer to.
+		 */
+		static
+		const non_null_ptr_to_const_type
+		create(
+				const boost::shared_ptr<PropertyValueDecoder> &property_value_decoder,
+				const QByteArray &block,
+				const boost::shared_ptr<MappedFile> &mapped_file,
+				qint64 values_offset,
+				quint32 num_values)
+		{
+			return non_null_ptr_to_const_type(
+					new LazyPropertyValues(property_value_decoder, block, mapped_file, values_offset, num_values));
+		}
+
+		virtual
+		void
+		decode(
+				GPlatesModel::TopLevelPropertyInline::container_type &values) const
+		{
+			QDataStream input(d_block);
+			Format::initialise_data_stream(input);
+
+			try
+			{
+				if (!input.device()->seek(d_values_offset))
+				{
+					throw MalformedDataException();
+				}
+
+				GPlatesModel::TopLevelPropertyInline::container_type decoded_values;
+				for (quint32 v = 0; v < d_num_values; ++v)
+				{
+					decoded_values.push_back(d_property_value_decoder->read_property_value(input));
+				}
+
+				values.insert(values.end(), decoded_values.begin(), decoded_values.end());
+			}
+			catch (const MalformedDataException &)
+			{
+				qWarning() << "Unable to decode lazily loaded property values from binary GPML file.";
+			}
+			catch (const GPlatesGlobal::Exception &)
+			{
+				// Corrupted data can also result in invalid geometries, etc.
+				qWarning() << "Unable to decode lazily loaded property values from binary GPML file.";
+			}
+		}
+
+	private:
+
+		boost::shared_ptr<PropertyValueDecoder> d_property_value_decoder;
+		QByteArray d_block;
+		boost::shared_ptr<MappedFile> d_mapped_file;
+		qint64 d_values_offset;
+		quint32 d_num_values;
+
+
+		LazyPropertyValues(
+				const boost::shared_ptr<PropertyValueDecoder> &property_value_decoder,
+				const QByteArray &block,
+				const boost::shared_ptr<MappedFile> &mapped_file,
+				qint64 values_offset,
+				quint32 num_values) :
+			d_property_value_decoder(property_value_decoder),
+			d_block(block),
+			d_mapped_file(mapped_file),
+			d_values_offset(values_offset),
+			d_num_values(num_values)
+		{  }
+	};
+
+
+	/**
+	 * Reads the blocks of a binary GPML file.
+	 */
+	class BlockReader
+	{
+	public:
+
+		/**
+		 * If @a lazy_loading is true then property values are decoded on first access.
+		 */
+		BlockReader(
+				const GPlatesFileIO::GpmlPropertyStructuralTypeReader::non_null_ptr_to_const_type &property_structural_type_reader,
+				const boost::shared_ptr<GPlatesFileIO::DataSource> &source,
+				GPlatesFileIO::ReadErrorAccumulation &read_errors,
+				bool &contains_unsaved_changes,
+				bool lazy_loading) :
+			d_property_structural_type_reader(property_structural_type_reader),
+			d_source(source),
+			d_read_errors(read_errors),
+			d_contains_unsaved_changes(contains_unsaved_changes),
+			d_lazy_loading(lazy_loading),
+			d_property_value_decoder(new PropertyValueDecoder()),
+			d_feature_index(NULL)
+		{  }
+
+		/**
+		 * Reads the (uncompressed) @a block and adds its features to @a feature_collection.
+		 *
+		 * @a mapped_file is the file mapping that @a block refers to (if any).
+		 */
+		void
+		read_block(
+				const QByteArray &block,
+				const boost::shared_ptr<MappedFile> &mapped_file,
+				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection)
+		{
+			QDataStream input(block);
+			Format::initialise_data_stream(input);
+
+			d_property_value_decoder->read_strings(input);
+			d_property_value_decoder->read_qualified_names(input);
+
+			// Read the features that were written as GPML.
+			// They get added to the feature collection in their proper order below.
+			QByteArray block_gpml;
+			input >> block_gpml;
+			check_status(input);
+			std::vector<GPlatesModel::FeatureHandle::non_null_ptr_type> gpml_features;
+			if (!block_gpml.isEmpty())
+			{
+				read_gpml_features(block_gpml, gpml_features);
+			}
+
+			// The GPML feature records refer to their features by feature ID. This way a GPML feature that
+			// failed to read leaves an empty slot rather than shifting the remaining GPML features.
+			gpml_feature_index_map_type gpml_feature_index_map;
+			for (unsigned int f = 0; f < gpml_features.size(); ++f)
+			{
+				gpml_feature_index_map.insert(
+						gpml_feature_index_map_type::value_type(
+								gpml_features[f]->feature_id().get().qstring(),
+								f));
+			}
+			std::vector<bool> gpml_features_added(gpml_features.size(), false);
+
+			quint32 num_features;
+			input >> num_features;
+			check_status(input);
+
+			for (quint32 n = 0; n < num_features; ++n)
+			{
+				quint8 feature_encoding;
+				input >> feature_encoding;
+				check_status(input);
+
+				if (feature_encoding == Format::FEATURE_NATIVE)
+				{
+					boost::optional<GPlatesFileIO::GpmlBinaryFeatureIndex::Entry> feature_summary;
+					const GPlatesModel::FeatureHandle::non_null_ptr_type feature =
+							read_native_feature(input, block, mapped_file, feature_summary);
+
+					feature_collection->add(feature);
+
+					// Index entries only apply to features whose property values have not been decoded.
+					if (feature_summary &&
+						d_lazy_loading)
+					{
+						if (d_feature_index == NULL)
+						{
+							d_feature_index = &GPlatesFileIO::GpmlBinaryFeatureIndex::get_or_create(*feature_collection);
+						}
+						d_feature_index->add_entry(*feature, feature_summary.get());
+					}
+				}
+				else if (feature_encoding == Format::FEATURE_GPML)
+				{
+					QString feature_id;
+					input >> feature_id;
+					check_status(input);
+
+					// Equal feature IDs are matched in document order.
+					boost::optional<unsigned int> gpml_feature_index;
+					gpml_feature_index_map_type::iterator gpml_feature_index_iter =
+							gpml_feature_index_map.find(feature_id);
+					if (gpml_feature_index_iter != gpml_feature_index_map.end())
+					{
+						gpml_feature_index = gpml_feature_index_iter->second;
+						gpml_feature_index_map.erase(gpml_feature_index_iter);
+					}
+
+					// If the GPML feature failed to read then a read error will already have been reported
+					// and its slot is left empty.
+					if (gpml_feature_index)
+					{
+						feature_collection->add(gpml_features[gpml_feature_index.get()]);
+						gpml_features_added[gpml_feature_index.get()] = true;
+					}
+				}
+				else
+				{
+					throw MalformedDataException();
+				}
+			}
+
+			// Any GPML features that did not match a record (eg, their feature ID could not be read and
+			// a new one was generated) are added after the block's other features so they're not lost.
+			for (unsigned int f = 0; f < gpml_features.size(); ++f)
+			{
+				if (!gpml_features_added[f])
+				{
+					feature_collection->add(gpml_features[f]);
+				}
+			}
+		}
+
+	private:
+
+		//! Maps feature IDs to indices of GPML features (equal IDs are kept in insertion order).
+		typedef std::multimap<QString, unsigned int> gpml_feature_index_map_type;
+
+		GPlatesFileIO::GpmlPropertyStructuralTypeReader::non_null_ptr_to_const_type d_property_structural_type_reader;
+		boost::shared_ptr<GPlatesFileIO::DataSource> d_source;
+		GPlatesFileIO::ReadErrorAccumulation &d_read_errors;
+		bool &d_contains_unsaved_changes;
+		bool d_lazy_loading;
+
+		boost::shared_ptr<PropertyValueDecoder> d_property_value_decoder;
+
+		//! The feature index of the feature collection (created when the first feature summary is read).
+		GPlatesFileIO::GpmlBinaryFeatureIndex *d_feature_index;
+
+
+		/**
+		 * Reads the features in the GPML document @a block_gpml.
+		 */
+		void
+		read_gpml_features(
+				QByteArray &block_gpml,
+				std::vector<GPlatesModel::FeatureHandle::non_null_ptr_type> &gpml_features)
+		{
+			QBuffer gpml_buffer(&block_gpml);
+			gpml_buffer.open(QIODevice::ReadOnly);
+
+			// Read into a temporary feature collection.
+			const GPlatesModel::FeatureCollectionHandle::non_null_ptr_type gpml_feature_collection =
+					GPlatesModel::FeatureCollectionHandle::create();
+
+			GPlatesFileIO::GpmlReader::read_device(
+					gpml_buffer,
+					d_source,
+					gpml_feature_collection->reference(),
+					d_property_structural_type_reader,
+					d_read_errors,
+					d_contains_unsaved_changes);
+
+			GPlatesModel::FeatureCollectionHandle::iterator features_iter = gpml_feature_collection->begin();
+			GPlatesModel::FeatureCollectionHandle::iterator features_end = gpml_feature_collection->end();
+			for ( ; features_iter != features_end; ++features_iter)
+			{
+				gpml_features.push_back(*features_iter);
+			}
+
+			// Remove the features from the temporary feature collection so they can be added to
+			// the file's feature collection.
+			BOOST_FOREACH(const GPlatesModel::FeatureHandle::non_null_ptr_type &gpml_feature, gpml_features)
+			{
+				gpml_feature->remove_from_parent();
+			}
+		}
+
+		GPlatesModel::FeatureHandle::non_null_ptr_type
+		read_native_feature(
+				QDataStream &input,
+				const QByteArray &block,
+				const boost::shared_ptr<MappedFile> &mapped_file,
+				boost::optional<GPlatesFileIO::GpmlBinaryFeatureIndex::Entry> &feature_summary)
+		{
+			const GPlatesModel::FeatureType feature_type = d_property_value_decoder->read_feature_type(input);
+
+			QString feature_id;
+			QString revision_id_string;
+			input >> feature_id >> revision_id_string;
+			check_status(input);
+
+			const GPlatesModel::RevisionId revision_id(GPlatesUtils::UnicodeString(revision_id_string));
+
+			feature_summary = read_feature_summary(input, revision_id);
+
+			const GPlatesModel::FeatureHandle::non_null_ptr_type feature =
+					GPlatesModel::FeatureHandle::create(
+							feature_type,
+							GPlatesModel::FeatureId(GPlatesUtils::UnicodeString(feature_id)),
+							revision_id);
+
+			quint32 num_properties;
+			input >> num_properties;
+			check_status(input);
+
+			for (quint32 p = 0; p < num_properties; ++p)
+			{
+				const GPlatesModel::PropertyName property_name = d_property_value_decoder->read_property_name(input);
+
+				quint32 num_values;
+				quint32 values_size;
+				input >> num_values >> values_size;
+				check_status(input);
+
+				if (d_lazy_loading)
+				{
+					// Skip over the property values - they get decoded when first accessed.
+					const qint64 values_offset = input.device()->pos();
+					if (input.skipRawData(values_size) != static_cast<int>(values_size))
+					{
+						throw MalformedDataException();
+					}
+
+					feature->add(
+							GPlatesModel::TopLevelPropertyInline::create_lazy(
+									property_name,
+									LazyPropertyValues::create(
+											d_property_value_decoder,
+											block,
+											mapped_file,
+											values_offset,
+											num_values)));
+				}
+				else
+				{
+					GPlatesModel::TopLevelPropertyInline::container_type values;
+					for (quint32 v = 0; v < num_values; ++v)
+					{
+						values.push_back(d_property_value_decoder->read_property_value(input));
+					}
+
+					feature->add(GPlatesModel::TopLevelPropertyInline::create(property_name, values));
+				}
+			}
+
+			return feature;
+		}
+
+		boost::optional<GPlatesFileIO::GpmlBinaryFeatureIndex::Entry>
+		read_feature_summary(
+				QDataStream &input,
+				const GPlatesModel::RevisionId &revision_id)
+		{
+			quint8 flags;
+			input >> flags;
+			check_status(input);
+
+			if (flags == 0)
+			{
+				return boost::none;
+			}
+
+			GPlatesFileIO::GpmlBinaryFeatureIndex::Entry feature_summary(revision_id);
+
+			if (flags & Format::FEATURE_SUMMARY_VALID_TIME)
+			{
+				double time_of_appearance;
+				double time_of_disappearance;
+				input >> time_of_appearance >> time_of_disappearance;
+				check_status(input);
+
+				feature_summary.time_of_appearance = GPlatesPropertyValues::GeoTimeInstant(time_of_appearance);
+				feature_summary.time_of_disappearance = GPlatesPropertyValues::GeoTimeInstant(time_of_disappearance);
+			}
+
+			if (flags & Format::FEATURE_SUMMARY_RECONSTRUCTION_PLATE_ID)
+			{
+				quint64 reconstruction_plate_id;
+				input >> reconstruction_plate_id;
+				check_status(input);
+
+				feature_summary.reconstruction_plate_id = reconstruction_plate_id;
+			}
+
+			if (flags & Format::FEATURE_SUMMARY_BOUNDS)
+			{
+				double centre_x;
+				double centre_y;
+				double centre_z;
+				double cosine_radius;
+				input >> centre_x >> centre_y >> centre_z >> cosine_radius;
+				check_status(input);
+
+				feature_summary.bounds = GPlatesMaths::BoundingSmallCircle(
+						GPlatesMaths::UnitVector3D(centre_x, centre_y, centre_z),
+						GPlatesMaths::AngularExtent::create_from_cosine(cosine_radius));
+			}
+
+			return feature_summary;
+		}
+	};
+
+
+	/**
+	 * Reads the block header and data following @a stored_block_size and decompresses the data if necessary.
+	 *
+	 * If @a mapped_file is not NULL then the returned (uncompressed) block refers directly to the
+	 * file mapping (rather than copying it).
+	 */
+	QByteArray
+	read_block(
+			QDataStream &input,
+			quint32 stored_block_size,
+			const boost::shared_ptr<MappedFile> &mapped_file)
+	{
+		quint32 block_size;
+		quint8 block_compression;
+		input >> block_size >> block_compression;
+		check_status(input);
+
+		// Avoid allocating huge amounts of memory due to a corrupted block size.
+		if (stored_block_size > input.device()->bytesAvailable())
+		{
+			throw MalformedDataException();
+		}
+
+		QByteArray stored_block;
+		if (mapped_file)
+		{
+			const qint64 stored_block_offset = input.device()->pos();
+			if (stored_block_offset + stored_block_size > mapped_file->size() ||
+				input.skipRawData(stored_block_size) != static_cast<int>(stored_block_size))
+			{
+				throw MalformedDataException();
+			}
+
+			stored_block = QByteArray::fromRawData(
+					reinterpret_cast<const char *>(mapped_file->data() + stored_block_offset),
+					stored_block_size);
+		}
+		else
+		{
+			stored_block.resize(stored_block_size);
+			if (input.readRawData(stored_block.data(), stored_block_size) != static_cast<int>(stored_block_size))
+			{
+				throw MalformedDataException();
+			}
+		}
+
+		QByteArray block;
+		if (block_compression == Format::BLOCK_UNCOMPRESSED)
+		{
+			block = stored_block;
+		}
+		else if (block_compression == Format::BLOCK_ZLIB)
+		{
+			block = qUncompress(stored_block);
+		}
+		else
+		{
+			throw MalformedDataException();
+		}
+
+		if (block.size() != static_cast<int>(block_size))
+		{
+			throw MalformedDataException();
+		}
+
+		return block;
+	}
+}
+
+
+void
+GPlatesFileIO::GpmlBinaryReader::read_file(
+		File::Reference &file,
+		const GpmlPropertyStructuralTypeReader::non_null_ptr_to_const_type &property_structural_type_reader,
+		ReadErrorAccumulation &read_errors,
+		bool &contains_unsaved_changes,
+		bool lazy_loading)
+{
+	PROFILE_FUNC();
+
+	contains_unsaved_changes = false;
+
+	const QString filename = file.get_file_info().get_qfileinfo().filePath();
+
+	QFile input_file(filename);
+	if (!input_file.open(QIODevice::ReadOnly))
+	{
+		throw ErrorOpeningFileForReadingException(GPLATES_EXCEPTION_SOURCE, filename);
+	}
+
+	QDataStream input(&input_file);
+	Format::initialise_data_stream(input);
+
+	const boost::shared_ptr<DataSource> source(
+			new LocalFileDataSource(filename, DataFormats::Gpml));
+	const boost::shared_ptr<LocationInDataSource> location(new LineNumber(0));
+
+	//
+	// Read the header.
+	//
+
+	char magic[Format::MAGIC_SIZE];
+	if (input.readRawData(magic, Format::MAGIC_SIZE) != Format::MAGIC_SIZE ||
+		std::memcmp(magic, Format::MAGIC, Format::MAGIC_SIZE) != 0)
+	{
+		read_errors.d_failures_to_begin.push_back(
+				ReadErrorOccurrence(source, location, ReadErrors::FileFormatNotSupported, ReadErrors::FileNotLoaded));
+		return;
+	}
+
+	quint32 version;
+	QString gpgim_version_string;
+	input >> version >> gpgim_version_string;
+	if (input.status() != QDataStream::Ok)
+	{
+		read_errors.d_failures_to_begin.push_back(
+				ReadErrorOccurrence(source, location, ReadErrors::ErrorReadingFile, ReadErrors::FileNotLoaded));
+		return;
+	}
+
+	// We cannot read files written by a more recent version of GPlates using a later format version.
+	if (version > Format::VERSION)
+	{
+		read_errors.d_failures_to_begin.push_back(
+				ReadErrorOccurrence(source, location, ReadErrors::FileFormatNotSupported, ReadErrors::FileNotLoaded));
+		return;
+	}
+
+	GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection = file.get_feature_collection();
+
+	// Store the GPGIM version in the feature collection as a tag (as is done when reading GPML).
+	boost::optional<GPlatesModel::GpgimVersion> gpgim_version =
+			GPlatesModel::GpgimVersion::create(gpgim_version_string);
+	if (gpgim_version)
+	{
+		// Append warning if the file was created by a more recent version of GPlates.
+		if (gpgim_version.get() > GPlatesModel::Gpgim::instance().get_version())
+		{
+			read_errors.d_warnings.push_back(
+					ReadErrorOccurrence(
+							source,
+							location,
+							ReadErrors::PartiallySupportedVersionAttribute,
+							ReadErrors::AssumingCurrentVersion));
+		}
+
+		feature_collection->tags()[GPlatesModel::GpgimVersion::FEATURE_COLLECTION_TAG] = gpgim_version.get();
+	}
+	else
+	{
+		read_errors.d_warnings.push_back(
+				ReadErrorOccurrence(
+						source,
+						location,
+						ReadErrors::MalformedVersionAttribute,
+						ReadErrors::AssumingCurrentVersion));
+	}
+
+	//
+	// Read the blocks.
+	//
+
+	// When loading lazily the file is memory-mapped so that uncompressed blocks (and hence the
+	// undecoded property values) do not need to be copied into memory.
+	// If the file cannot be mapped then the blocks are just read into memory.
+	boost::shared_ptr<MappedFile> mapped_file;
+	if (lazy_loading)
+	{
+		mapped_file = MappedFile::create(filename);
+	}
+
+	BlockReader block_reader(property_structural_type_reader, source, read_errors, contains_unsaved_changes, lazy_loading);
+
+	try
+	{
+		while (true)
+		{
+			quint32 stored_block_size;
+			input >> stored_block_size;
+			check_status(input);
+
+			// A zero block size marks the end of the blocks.
+			if (stored_block_size == 0)
+			{
+				break;
+			}
+
+			block_reader.read_block(
+					read_block(input, stored_block_size, mapped_file),
+					mapped_file,
+					feature_collection);
+		}
+	}
+	catch (const MalformedDataException &)
+	{
+		// Keep the features read so far, but report that the file was only partially read.
+		read_errors.d_terminating_errors.push_back(
+				ReadErrorOccurrence(source, location, ReadErrors::ParseError, ReadErrors::ParsingStoppedPrematurely));
+	}
+	catch (const GPlatesGlobal::Exception &)
+	{
+		// Corrupted data can also result in invalid geometries, etc.
+		read_errors.d_terminating_errors.push_back(
+				ReadErrorOccurrence(source, location, ReadErrors::ParseError, ReadErrors::ParsingStoppedPrematurely));
+	}
+}
@@ -0,0 +1,64 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILE_IO_GPMLBINARYREADER_H
+#define GPLATES_FILE_IO_GPMLBINARYREADER_H
+
+#include "File.h"
+#include "GpmlPropertyStructuralTypeReader.h"
+#include "ReadErrorAccumulation.h"
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * Reads features from the binary GPML (".gpmlb") file format (see @a GpmlBinaryFormat).
+	 */
+	class GpmlBinaryReader
+	{
+	public:
+
+		/**
+		 * Reads the features in @a file into its feature collection.
+		 *
+		 * @a property_structural_type_reader is used to read any features that were written as GPML
+		 * (because they contain property values with no native binary encoding).
+		 *
+		 * If @a lazy_loading is true then the file is memory-mapped and the property values of
+		 * natively encoded features are only decoded when first accessed
+		 * (see TopLevelPropertyInline::create_lazy). The file should then not be modified by other
+		 * applications while its features are loaded.
+		 *
+		 * If @a lazy_loading is true then any feature summaries in the file are added to the
+		 * feature collection's @a GpmlBinaryFeatureIndex.
+		 *
+		 * @throws ErrorOpeningFileForReadingException if the file could not be opened.
+		 */
+		static
+		void
+		read_file(
+				File::Reference &file,
+				const GpmlPropertyStructuralTypeReader::non_null_ptr_to_const_type &property_structural_type_reader,
+				ReadErrorAccumulation &read_errors,
+				bool &contains_unsaved_changes,
+				bool lazy_loading = false);
+	};
+}
+
+#endif // GPLATES_FILE_IO_GPMLBINARYREADER_H
@@ -0,0 +1,833 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <utility>
+#include <boost/foreach.hpp>
+#include <boost/optional.hpp>
+#include <QtGlobal>
+
+#include "GpmlBinaryWriter.h"
+
+#include "ErrorOpeningFileForWritingException.h"
+#include "GpmlBinaryFormat.h"
+
+#include "maths/MultiPointOnSphere.h"
+#include "maths/PointOnSphere.h"
+#include "maths/PolygonOnSphere.h"
+#include "maths/PolylineOnSphere.h"
+#include "maths/SmallCircleBounds.h"
+
+#include "model/FeatureHandle.h"
+#include "model/Gpgim.h"
+#include "model/GpgimVersion.h"
+#include "model/PropertyName.h"
+#include "model/TopLevelPropertyInline.h"
+#include "model/types.h"
+
+#include "property-values/Enumeration.h"
+#include "property-values/GmlLineString.h"
+#include "property-values/GmlMultiPoint.h"
+#include "property-values/GmlOrientableCurve.h"
+#include "property-values/GmlPoint.h"
+#include "property-values/GmlPolygon.h"
+#include "property-values/GmlTimeInstant.h"
+#include "property-values/GmlTimePeriod.h"
+#include "property-values/GpmlConstantValue.h"
+#include "property-values/GpmlPlateId.h"
+#include "property-values/XsBoolean.h"
+#include "property-values/XsDouble.h"
+#include "property-values/XsInteger.h"
+#include "property-values/GeoTimeInstant.h"
+#include "property-values/XsString.h"
+
+
+namespace
+{
+	/**
+	 * Writes @a values as a contiguous block of little-endian doubles.
+	 */
+	void
+	write_doubles(
+			QDataStream &output,
+			std::vector<double> &values)
+	{
+		if (values.empty())
+		{
+			return;
+		}
+
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+		BOOST_FOREACH(double &value, values)
+		{
+			char *bytes = reinterpret_cast<char *>(&value);
+			std::reverse(bytes, bytes + sizeof(double));
+		}
+#endif
+
+		output.writeRawData(
+				reinterpret_cast<const char *>(&values[0]),
+				values.size() * sizeof(double));
+	}
+
+
+	/**
+	 * Writes the number of points followed by the (x,y,z) coordinates of each point.
+	 */
+	template <typename PointForwardIter>
+	void
+	write_points(
+			QDataStream &output,
+			PointForwardIter points_begin,
+			PointForwardIter points_end)
+	{
+		std::vector<double> coordinates;
+		for (PointForwardIter points_iter = points_begin; points_iter != points_end; ++points_iter)
+		{
+			const GPlatesMaths::UnitVector3D position = (*points_iter).position_vector();
+			coordinates.push_back(position.x().dval());
+			coordinates.push_back(position.y().dval());
+			coordinates.push_back(position.z().dval());
+		}
+
+		output << static_cast<quint32>(coordinates.size() / 3);
+		write_doubles(output, coordinates);
+	}
+
+
+	/**
+	 * Writes the summary of a feature (its valid time, reconstruction plate ID and geometry bounds).
+	 */
+	class FeatureSummaryWriter :
+			public GPlatesModel::ConstFeatureVisitor
+	{
+	public:
+
+		void
+		write_summary(
+				const GPlatesModel::FeatureHandle &feature_handle,
+				QDataStream &output)
+		{
+			d_valid_time = boost::none;
+			d_reconstruction_plate_id = boost::none;
+			d_bounds_builder = boost::none;
+
+			visit_feature(feature_handle.reference());
+
+			quint8 flags = 0;
+			if (d_valid_time)
+			{
+				flags |= GPlatesFileIO::GpmlBinaryFormat::FEATURE_SUMMARY_VALID_TIME;
+			}
+			if (d_reconstruction_plate_id)
+			{
+				flags |= GPlatesFileIO::GpmlBinaryFormat::FEATURE_SUMMARY_RECONSTRUCTION_PLATE_ID;
+			}
+			if (d_bounds_builder)
+			{
+				flags |= GPlatesFileIO::GpmlBinaryFormat::FEATURE_SUMMARY_BOUNDS;
+			}
+
+			output << flags;
+
+			if (d_valid_time)
+			{
+				output << d_valid_time->first.value() << d_valid_time->second.value();
+			}
+
+			if (d_reconstruction_plate_id)
+			{
+				output << static_cast<quint64>(d_reconstruction_plate_id.get());
+			}
+
+			if (d_bounds_builder)
+			{
+				const GPlatesMaths::BoundingSmallCircle bounds = d_bounds_builder->get_bounding_small_circle();
+				const GPlatesMaths::UnitVector3D &centre = bounds.get_centre();
+				output << centre.x().dval()
+						<< centre.y().dval()
+						<< centre.z().dval()
+						<< bounds.get_angular_extent().get_cosine().dval();
+			}
+		}
+
+	protected:
+
+		virtual
+		void
+		visit_gml_line_string(
+				const GPlatesPropertyValues::GmlLineString &gml_line_string)
+		{
+			add_bounds(gml_line_string.polyline()->get_bounding_small_circle());
+		}
+
+		virtual
+		void
+		visit_gml_multi_point(
+				const GPlatesPropertyValues::GmlMultiPoint &gml_multi_point)
+		{
+			add_bounds(gml_multi_point.multipoint()->get_bounding_small_circle());
+		}
+
+		virtual
+		void
+		visit_gml_orientable_curve(
+				const GPlatesPropertyValues::GmlOrientableCurve &gml_orientable_curve)
+		{
+			gml_orientable_curve.base_curve()->accept_visitor(*this);
+		}
+
+		virtual
+		void
+		visit_gml_point(
+				const GPlatesPropertyValues::GmlPoint &gml_point)
+		{
+			add_bounds(
+					GPlatesMaths::BoundingSmallCircle(
+							gml_point.point().position_vector(),
+							GPlatesMaths::AngularExtent::ZERO));
+		}
+
+		virtual
+		void
+		visit_gml_polygon(
+				const GPlatesPropertyValues::GmlPolygon &gml_polygon)
+		{
+			add_bounds(gml_polygon.polygon()->get_bounding_small_circle());
+		}
+
+		virtual
+		void
+		visit_gml_time_period(
+				const GPlatesPropertyValues::GmlTimePeriod &gml_time_period)
+		{
+			static const GPlatesModel::PropertyName VALID_TIME_PROPERTY_NAME =
+					GPlatesModel::PropertyName::create_gml("validTime");
+
+			if (current_top_level_propname() == VALID_TIME_PROPERTY_NAME)
+			{
+				d_valid_time = std::make_pair(
+						gml_time_period.begin()->time_position(),
+						gml_time_period.end()->time_position());
+			}
+		}
+
+		virtual
+		void
+		visit_gpml_constant_value(
+				const GPlatesPropertyValues::GpmlConstantValue &gpml_constant_value)
+		{
+			gpml_constant_value.value()->accept_visitor(*this);
+		}
+
+		virtual
+		void
+		visit_gpml_plate_id(
+				const GPlatesPropertyValues::GpmlPlateId &gpml_plate_id)
+		{
+			static const GPlatesModel::PropertyName RECONSTRUCTION_PLATE_ID_PROPERTY_NAME =
+					GPlatesModel::PropertyName::create_gpml("reconstructionPlateId");
+
+			if (current_top_level_propname() == RECONSTRUCTION_PLATE_ID_PROPERTY_NAME)
+			{
+				d_reconstruction_plate_id = gpml_plate_id.value();
+			}
+		}
+
+	private:
+
+		boost::optional<
+				std::pair<GPlatesPropertyValues::GeoTimeInstant, GPlatesPropertyValues::GeoTimeInstant> >
+						d_valid_time;
+		boost::optional<GPlatesModel::integer_plate_id_type> d_reconstruction_plate_id;
+		boost::optional<GPlatesMaths::BoundingSmallCircleBuilder> d_bounds_builder;
+
+
+		void
+		add_bounds(
+				const GPlatesMaths::BoundingSmallCircle &bounds)
+		{
+			if (!d_bounds_builder)
+			{
+				d_bounds_builder = GPlatesMaths::BoundingSmallCircleBuilder(bounds.get_centre());
+			}
+
+			d_bounds_builder->add(bounds);
+		}
+	};
+
+
+	/**
+	 * Decodes any lazily-loaded property values of the features in @a feature_collection.
+	 */
+	void
+	load_lazy_property_values(
+			const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection)
+	{
+		GPlatesModel::FeatureCollectionHandle::iterator features_iter = feature_collection->begin();
+		GPlatesModel::FeatureCollectionHandle::iterator features_end = feature_collection->end();
+		for ( ; features_iter != features_end; ++features_iter)
+		{
+			GPlatesModel::FeatureHandle::iterator properties_iter = (*features_iter)->begin();
+			GPlatesModel::FeatureHandle::iterator properties_end = (*features_iter)->end();
+			for ( ; properties_iter != properties_end; ++properties_iter)
+			{
+				const GPlatesModel::TopLevelPropertyInline *property =
+						dynamic_cast<const GPlatesModel::TopLevelPropertyInline *>((*properties_iter).get());
+				if (property)
+				{
+					property->load_lazy_values();
+				}
+			}
+		}
+	}
+}
+
+
+/**
+ * Writes property values that have a native binary encoding.
+ */
+class GPlatesFileIO::GpmlBinaryWriter::PropertyValueEncoder :
+		public GPlatesModel::ConstFeatureVisitor
+{
+public:
+
+	PropertyValueEncoder(
+			GpmlBinaryWriter &writer,
+			QDataStream &output) :
+		d_writer(writer),
+		d_output(output),
+		d_encoded(false)
+	{  }
+
+	/**
+	 * Writes @a property_value.
+	 *
+	 * Returns false if @a property_value (or a property value nested inside it) has no native encoding
+	 * (in which case a partial encoding might have been written).
+	 */
+	bool
+	encode(
+			const GPlatesModel::PropertyValue &property_value)
+	{
+		d_encoded = false;
+		property_value.accept_visitor(*this);
+		return d_encoded;
+	}
+
+protected:
+
+	virtual
+	void
+	visit_enumeration(
+			const GPlatesPropertyValues::Enumeration &enumeration)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_ENUMERATION);
+		d_output << d_writer.intern_qualified_name(enumeration.type())
+				<< enumeration.value().get().qstring();
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_gml_line_string(
+			const GPlatesPropertyValues::GmlLineString &gml_line_string)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_GML_LINE_STRING);
+		write_line_string(gml_line_string);
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_gml_multi_point(
+			const GPlatesPropertyValues::GmlMultiPoint &gml_multi_point)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_GML_MULTI_POINT);
+
+		const GPlatesPropertyValues::GmlMultiPoint::internal_multipoint_type multi_point =
+				gml_multi_point.multipoint();
+		write_points(d_output, multi_point->begin(), multi_point->end());
+
+		// Whether each point is written as "gml:pos" or "gml:coordinates" in GPML.
+		BOOST_FOREACH(GPlatesPropertyValues::GmlPoint::GmlProperty gml_property, gml_multi_point.gml_properties())
+		{
+			d_output << static_cast<quint8>(gml_property);
+		}
+
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_gml_orientable_curve(
+			const GPlatesPropertyValues::GmlOrientableCurve &gml_orientable_curve)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_GML_ORIENTABLE_CURVE);
+		write_xml_attributes(gml_orientable_curve.xml_attributes());
+		write_line_string(*gml_orientable_curve.base_curve());
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_gml_point(
+			const GPlatesPropertyValues::GmlPoint &gml_point)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_GML_POINT);
+
+		// Write the 2D position (rather than the 3D point) since that's what the point is created from
+		// when reading GPML (the 3D point is then generated from it on demand).
+		const std::pair<double, double> &pos_2d = gml_point.point_2d();
+		d_output << static_cast<quint8>(gml_point.gml_property())
+				<< pos_2d.first
+				<< pos_2d.second;
+
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_gml_polygon(
+			const GPlatesPropertyValues::GmlPolygon &gml_polygon)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_GML_POLYGON);
+
+		const GPlatesPropertyValues::GmlPolygon::internal_polygon_type polygon = gml_polygon.polygon();
+
+		write_points(d_output, polygon->exterior_ring_vertex_begin(), polygon->exterior_ring_vertex_end());
+
+		const unsigned int num_interior_rings = polygon->number_of_interior_rings();
+		d_output << static_cast<quint32>(num_interior_rings);
+		for (unsigned int interior_ring_index = 0; interior_ring_index < num_interior_rings; ++interior_ring_index)
+		{
+			write_points(
+					d_output,
+					polygon->interior_ring_vertex_begin(interior_ring_index),
+					polygon->interior_ring_vertex_end(interior_ring_index));
+		}
+
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_gml_time_instant(
+			const GPlatesPropertyValues::GmlTimeInstant &gml_time_instant)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_GML_TIME_INSTANT);
+		write_time_instant(gml_time_instant);
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_gml_time_period(
+			const GPlatesPropertyValues::GmlTimePeriod &gml_time_period)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_GML_TIME_PERIOD);
+		write_time_instant(*gml_time_period.begin());
+		write_time_instant(*gml_time_period.end());
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_gpml_constant_value(
+			const GPlatesPropertyValues::GpmlConstantValue &gpml_constant_value)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_GPML_CONSTANT_VALUE);
+		d_output << d_writer.intern_qualified_name(gpml_constant_value.value_type())
+				<< gpml_constant_value.description().qstring();
+
+		// The nested property value determines whether the constant value could be encoded.
+		encode(*gpml_constant_value.value());
+	}
+
+	virtual
+	void
+	visit_gpml_plate_id(
+			const GPlatesPropertyValues::GpmlPlateId &gpml_plate_id)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_GPML_PLATE_ID);
+		d_output << static_cast<quint64>(gpml_plate_id.value());
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_xs_boolean(
+			const GPlatesPropertyValues::XsBoolean &xs_boolean)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_XS_BOOLEAN);
+		d_output << static_cast<quint8>(xs_boolean.value());
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_xs_double(
+			const GPlatesPropertyValues::XsDouble &xs_double)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_XS_DOUBLE);
+		d_output << xs_double.value();
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_xs_integer(
+			const GPlatesPropertyValues::XsInteger &xs_integer)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_XS_INTEGER);
+		d_output << static_cast<qint32>(xs_integer.value());
+		d_encoded = true;
+	}
+
+	virtual
+	void
+	visit_xs_string(
+			const GPlatesPropertyValues::XsString &xs_string)
+	{
+		write_encoding(GpmlBinaryFormat::PROPERTY_VALUE_XS_STRING);
+		d_output << xs_string.value().get().qstring();
+		d_encoded = true;
+	}
+
+private:
+
+	GpmlBinaryWriter &d_writer;
+	QDataStream &d_output;
+	bool d_encoded;
+
+
+	void
+	write_encoding(
+			GpmlBinaryFormat::PropertyValueEncoding encoding)
+	{
+		d_output << static_cast<quint8>(encoding);
+	}
+
+	void
+	write_line_string(
+			const GPlatesPropertyValues::GmlLineString &gml_line_string)
+	{
+		const GPlatesPropertyValues::GmlLineString::internal_polyline_type polyline = gml_line_string.polyline();
+		write_points(d_output, polyline->vertex_begin(), polyline->vertex_end());
+	}
+
+	void
+	write_time_instant(
+			const GPlatesPropertyValues::GmlTimeInstant &gml_time_instant)
+	{
+		d_output << gml_time_instant.time_position().value();
+		write_xml_attributes(gml_time_instant.time_position_xml_attributes());
+	}
+
+	void
+	write_xml_attributes(
+			const std::map<GPlatesModel::XmlAttributeName, GPlatesModel::XmlAttributeValue> &xml_attributes)
+	{
+		d_output << static_cast<quint32>(xml_attributes.size());
+
+		typedef std::map<GPlatesModel::XmlAttributeName, GPlatesModel::XmlAttributeValue> xml_attributes_type;
+		BOOST_FOREACH(const xml_attributes_type::value_type &xml_attribute, xml_attributes)
+		{
+			d_output << d_writer.intern_qualified_name(xml_attribute.first)
+					<< xml_attribute.second.get().qstring();
+		}
+	}
+};
+
+
+GPlatesFileIO::GpmlBinaryWriter::GpmlBinaryWriter(
+		const FileInfo &file_info,
+		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+		bool compress_blocks,
+		bool write_feature_summaries) :
+	d_output_file(file_info.get_qfileinfo().filePath()),
+	d_feature_collection(feature_collection),
+	d_compress_blocks(compress_blocks),
+	d_write_feature_summaries(write_feature_summaries),
+	d_num_block_features(0)
+{
+	// If the features were lazily loaded then their undecoded property values might still
+	// refer to the (memory-mapped) file we're about to overwrite, so decode them first.
+	load_lazy_property_values(d_feature_collection);
+
+	if (!d_output_file.open(QIODevice::WriteOnly))
+	{
+		throw ErrorOpeningFileForWritingException(
+				GPLATES_EXCEPTION_SOURCE,
+				file_info.get_qfileinfo().filePath());
+	}
+
+	d_output.setDevice(&d_output_file);
+	GpmlBinaryFormat::initialise_data_stream(d_output);
+
+	// The version of the GPGIM built into the current GPlates.
+	const GPlatesModel::GpgimVersion &gpgim_version = GPlatesModel::Gpgim::instance().get_version();
+
+	d_output.writeRawData(GpmlBinaryFormat::MAGIC, GpmlBinaryFormat::MAGIC_SIZE);
+	d_output << GpmlBinaryFormat::VERSION
+			<< gpgim_version.get_version_string();
+
+	// Also store the GPGIM version in the feature collection as a tag (as is done when writing GPML).
+	d_feature_collection->tags()[GPlatesModel::GpgimVersion::FEATURE_COLLECTION_TAG] = gpgim_version;
+}
+
+
+GPlatesFileIO::GpmlBinaryWriter::~GpmlBinaryWriter()
+{
+	// Since this is a destructor we cannot let any exceptions escape.
+	// If one is thrown we just have to lump it and continue on.
+	try
+	{
+		write_block();
+
+		// Mark the end of the blocks.
+		d_output << static_cast<quint32>(0);
+	}
+	catch (...)
+	{
+	}
+}
+
+
+void
+GPlatesFileIO::GpmlBinaryWriter::visit_feature_handle(
+		const GPlatesModel::FeatureHandle &feature_handle)
+{
+	QByteArray feature_record;
+	bool encoded_natively;
+	{
+		QDataStream feature_record_stream(&feature_record, QIODevice::WriteOnly);
+		GpmlBinaryFormat::initialise_data_stream(feature_record_stream);
+
+		encoded_natively = encode_feature(feature_handle, feature_record_stream);
+	}
+
+	if (!encoded_natively)
+	{
+		// Write the feature to the current block's GPML document instead.
+		if (!d_block_gpml_writer)
+		{
+			d_block_gpml_buffer.reset(new QBuffer());
+			d_block_gpml_buffer->open(QIODevice::WriteOnly);
+			d_block_gpml_writer.reset(new GpmlOutputVisitor(d_block_gpml_buffer.get(), d_feature_collection));
+		}
+		d_block_gpml_writer->visit_feature(feature_handle.reference());
+
+		feature_record.clear();
+		QDataStream feature_record_stream(&feature_record, QIODevice::WriteOnly);
+		GpmlBinaryFormat::initialise_data_stream(feature_record_stream);
+		feature_record_stream << static_cast<quint8>(GpmlBinaryFormat::FEATURE_GPML)
+				<< feature_handle.feature_id().get().qstring();
+	}
+
+	d_block_feature_records.append(feature_record);
+	++d_num_block_features;
+
+	const qint64 block_size = d_block_feature_records.size() +
+			(d_block_gpml_buffer ? d_block_gpml_buffer->size() : 0);
+	if (block_size >= GpmlBinaryFormat::BLOCK_SIZE)
+	{
+		write_block();
+	}
+}
+
+
+bool
+GPlatesFileIO::GpmlBinaryWriter::encode_feature(
+		const GPlatesModel::FeatureHandle &feature_handle,
+		QDataStream &feature_record)
+{
+	feature_record << static_cast<quint8>(GpmlBinaryFormat::FEATURE_NATIVE)
+			<< intern_qualified_name(feature_handle.feature_type())
+			<< feature_handle.feature_id().get().qstring()
+			<< feature_handle.revision_id().get().qstring();
+
+	if (d_write_feature_summaries)
+	{
+		FeatureSummaryWriter().write_summary(feature_handle, feature_record);
+	}
+	else
+	{
+		feature_record << static_cast<quint8>(0); // No summary.
+	}
+
+	// The number of properties needs to be written before the properties.
+	std::vector<const GPlatesModel::TopLevelPropertyInline *> properties;
+	GPlatesModel::FeatureHandle::const_iterator properties_iter = feature_handle.begin();
+	GPlatesModel::FeatureHandle::const_iterator properties_end = feature_handle.end();
+	for ( ; properties_iter != properties_end; ++properties_iter)
+	{
+		const GPlatesModel::TopLevelPropertyInline *property =
+				dynamic_cast<const GPlatesModel::TopLevelPropertyInline *>((*properties_iter).get());
+		// The XML attributes of top-level properties have no native encoding.
+		if (property == NULL ||
+			!property->xml_attributes().empty())
+		{
+			return false;
+		}
+
+		properties.push_back(property);
+	}
+
+	feature_record << static_cast<quint32>(properties.size());
+
+	BOOST_FOREACH(const GPlatesModel::TopLevelPropertyInline *property, properties)
+	{
+		// The values are encoded separately since their size is written before them.
+		QByteArray property_values;
+		{
+			QDataStream property_values_stream(&property_values, QIODevice::WriteOnly);
+			GpmlBinaryFormat::initialise_data_stream(property_values_stream);
+
+			PropertyValueEncoder property_value_encoder(*this, property_values_stream);
+
+			GPlatesModel::TopLevelPropertyInline::const_iterator values_iter = property->begin();
+			GPlatesModel::TopLevelPropertyInline::const_iterator values_end = property->end();
+			for ( ; values_iter != values_end; ++values_iter)
+			{
+				if (!property_value_encoder.encode(**values_iter))
+				{
+					return false;
+				}
+			}
+		}
+
+		feature_record << intern_qualified_name(property->property_name())
+				<< static_cast<quint32>(property->size())
+				<< static_cast<quint32>(property_values.size());
+		feature_record.writeRawData(property_values.constData(), property_values.size());
+	}
+
+	return true;
+}
+
+
+void
+GPlatesFileIO::GpmlBinaryWriter::write_block()
+{
+	if (d_num_block_features == 0)
+	{
+		return;
+	}
+
+	QByteArray block_gpml;
+	if (d_block_gpml_writer)
+	{
+		// Destroying the GPML writer finishes the GPML document.
+		d_block_gpml_writer.reset();
+		block_gpml = d_block_gpml_buffer->data();
+		d_block_gpml_buffer.reset();
+	}
+
+	QByteArray block;
+	{
+		QDataStream block_stream(&block, QIODevice::WriteOnly);
+		GpmlBinaryFormat::initialise_data_stream(block_stream);
+
+		block_stream << static_cast<quint32>(d_block_strings.size());
+		BOOST_FOREACH(const QString &string, d_block_strings)
+		{
+			block_stream << string;
+		}
+
+		block_stream << static_cast<quint32>(d_block_qualified_names.size());
+		BOOST_FOREACH(const qualified_name_type &qualified_name, d_block_qualified_names)
+		{
+			block_stream << qualified_name.first
+					<< qualified_name.second.first
+					<< qualified_name.second.second;
+		}
+
+		block_stream << block_gpml;
+
+		block_stream << d_num_block_features;
+		block_stream.writeRawData(d_block_feature_records.constData(), d_block_feature_records.size());
+	}
+
+	GpmlBinaryFormat::BlockCompression block_compression = GpmlBinaryFormat::BLOCK_UNCOMPRESSED;
+	QByteArray stored_block;
+	if (d_compress_blocks)
+	{
+		stored_block = qCompress(block);
+		block_compression = GpmlBinaryFormat::BLOCK_ZLIB;
+	}
+	else
+	{
+		stored_block = block;
+	}
+
+	d_output << static_cast<quint32>(stored_block.size())
+			<< static_cast<quint32>(block.size())
+			<< static_cast<quint8>(block_compression);
+	d_output.writeRawData(stored_block.constData(), stored_block.size());
+
+	// Start a new block.
+	d_block_strings.clear();
+	d_block_qualified_names.clear();
+	d_block_feature_records.clear();
+	d_num_block_features = 0;
+}
+
+
+quint32
+GPlatesFileIO::GpmlBinaryWriter::intern_string(
+		const QString &string)
+{
+	QHash<QString, quint32>::const_iterator string_iter = d_string_indices.constFind(string);
+	if (string_iter != d_string_indices.constEnd())
+	{
+		return string_iter.value();
+	}
+
+	const quint32 string_index = d_string_indices.size();
+	d_string_indices.insert(string, string_index);
+	d_block_strings.push_back(string);
+
+	return string_index;
+}
+
+
+quint32
+GPlatesFileIO::GpmlBinaryWriter::intern_qualified_name(
+		const QString &namespace_uri,
+		const QString &namespace_alias,
+		const QString &name)
+{
+	const qualified_name_type qualified_name(
+			intern_string(namespace_uri),
+			std::make_pair(intern_string(namespace_alias), intern_string(name)));
+
+	std::map<qualified_name_type, quint32>::const_iterator qualified_name_iter =
+			d_qualified_name_indices.find(qualified_name);
+	if (qualified_name_iter != d_qualified_name_indices.end())
+	{
+		return qualified_name_iter->second;
+	}
+
+	const quint32 qualified_name_index = d_qualified_name_indices.size();
+	d_qualified_name_indices.insert(std::make_pair(qualified_name, qualified_name_index));
+	d_block_qualified_names.push_back(qualified_name);
+
+	return qualified_name_index;
+}
@@ -0,0 +1,165 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILE_IO_GPMLBINARYWRITER_H
+#define GPLATES_FILE_IO_GPMLBINARYWRITER_H
+
+#include <map>
+#include <utility>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <QBuffer>
+#include <QByteArray>
+#include <QDataStream>
+#include <QFile>
+#include <QHash>
+#include <QString>
+
+#include "FileInfo.h"
+#include "GpmlOutputVisitor.h"
+
+#include "model/FeatureCollectionHandle.h"
+#include "model/FeatureVisitor.h"
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * Writes features to the binary GPML (".gpmlb") file format (see @a GpmlBinaryFormat).
+	 *
+	 * Features are written in blocks as they are visited, and the last block is written when
+	 * the writer is destroyed.
+	 */
+	class GpmlBinaryWriter :
+			public GPlatesModel::ConstFeatureVisitor,
+			private boost::noncopyable
+	{
+	public:
+
+		/**
+		 * Opens the file for writing and writes the file header.
+		 *
+		 * @a feature_collection is the feature collection whose features will be visited
+		 * (it is used when writing features that have no native binary encoding as GPML).
+		 *
+		 * If @a compress_blocks is true then blocks are compressed with zlib.
+		 * This produces smaller files but is slower to read and write.
+		 *
+		 * If @a write_feature_summaries is true then the valid time, reconstruction plate ID and
+		 * geometry bounds of each feature are also written (see @a GpmlBinaryFeatureIndex).
+		 *
+		 * @throws ErrorOpeningFileForWritingException if the file could not be opened.
+		 */
+		GpmlBinaryWriter(
+				const FileInfo &file_info,
+				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+				bool compress_blocks = false,
+				bool write_feature_summaries = true);
+
+		/**
+		 * Writes the last block and the end of the file.
+		 */
+		virtual
+		~GpmlBinaryWriter();
+
+	protected:
+
+		virtual
+		void
+		visit_feature_handle(
+				const GPlatesModel::FeatureHandle &feature_handle);
+
+	private:
+
+		class PropertyValueEncoder;
+
+		//! Namespace URI, namespace alias and name string indices.
+		typedef std::pair<quint32, std::pair<quint32, quint32> > qualified_name_type;
+
+
+		QFile d_output_file;
+		QDataStream d_output;
+
+		GPlatesModel::FeatureCollectionHandle::weak_ref d_feature_collection;
+		bool d_compress_blocks;
+		bool d_write_feature_summaries;
+
+		//
+		// Strings and qualified names interned so far (across all blocks).
+		//
+		QHash<QString, quint32> d_string_indices;
+		std::map<qualified_name_type, quint32> d_qualified_name_indices;
+
+		//
+		// The current block.
+		//
+		std::vector<QString> d_block_strings;
+		std::vector<qualified_name_type> d_block_qualified_names;
+		QByteArray d_block_feature_records;
+		quint32 d_num_block_features;
+
+		//! GPML document of features in the current block with no native encoding (created on demand).
+		boost::scoped_ptr<QBuffer> d_block_gpml_buffer;
+		boost::scoped_ptr<GpmlOutputVisitor> d_block_gpml_writer;
+
+
+		/**
+		 * Encodes @a feature_handle natively into @a feature_record.
+		 *
+		 * Returns false if any property value has no native encoding.
+		 */
+		bool
+		encode_feature(
+				const GPlatesModel::FeatureHandle &feature_handle,
+				QDataStream &feature_record);
+
+		/**
+		 * Writes the current block (if it contains any features) and starts a new block.
+		 */
+		void
+		write_block();
+
+		quint32
+		intern_string(
+				const QString &string);
+
+		/**
+		 * Interns a qualified XML name (such as a feature type, property name or structural type).
+		 */
+		template <class QualifiedXmlNameType>
+		quint32
+		intern_qualified_name(
+				const QualifiedXmlNameType &qualified_name)
+		{
+			return intern_qualified_name(
+					qualified_name.get_namespace().qstring(),
+					qualified_name.get_namespace_alias().qstring(),
+					qualified_name.get_name().qstring());
+		}
+
+		quint32
+		intern_qualified_name(
+				const QString &namespace_uri,
+				const QString &namespace_alias,
+				const QString &name);
+	};
+}
+
+#endif // GPLATES_FILE_IO_GPMLBINARYWRITER_H
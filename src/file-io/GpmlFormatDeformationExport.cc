@@ -23,6 +23,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <vector>
 #include <boost/optional.hpp>
 #include <QFile>
 #include <QStringList>
@@ -147,10 +148,19 @@ namespace
 			principal_majors.reserve(deformation_strains.size());
 			principal_minors.reserve(deformation_strains.size());
 			principal_angles.reserve(deformation_strains.size());
+
+			std::vector<GPlatesAppLogic::DeformationStrain::StrainPrincipal> principal_strains(deformation_strains.size());
+			if (!deformation_strains.empty())
+			{
+				GPlatesAppLogic::get_strain_principals(
+						&principal_strains[0],
+						&deformation_strains[0],
+						deformation_strains.size());
+			}
+
 			for (unsigned int d = 0; d < deformation_strains.size(); ++d)
 			{
-				const GPlatesAppLogic::DeformationStrain::StrainPrincipal principal_strain =
-						deformation_strains[d].get_strain_principal();
+				const GPlatesAppLogic::DeformationStrain::StrainPrincipal &principal_strain = principal_strains[d];
 
 				if (include_principal_strain->output == GPlatesFileIO::DeformationExport::PrincipalStrainOptions::STRAIN)
 				{
@@ -30,6 +30,7 @@
 #include <sstream>
 #include <string>
 #include <boost/bind/bind.hpp>
+#include <boost/exception_ptr.hpp>
 #include <boost/foreach.hpp>
 #include <boost/optional.hpp>
 #include <boost/utility/in_place_factory.hpp>
@@ -47,6 +48,7 @@
 #include "GpmlPropertyStructuralTypeReader.h"
 #include "GpmlReaderUtils.h"
 #include "GzipFile.h"
+#include "ReadAheadDevice.h"
 #include "ReadErrors.h"
 #include "ReadErrorOccurrence.h"
 
@@ -65,6 +67,7 @@
 #include "property-values/GpmlPiecewiseAggregation.h"
 #include "property-values/GpmlScalarField3DFile.h"
 
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 #include "utils/StringUtils.h"
 #include "utils/UnicodeStringUtils.h"
@@ -184,42 +187,212 @@ namespace
 	}
 
 
+	/**
+	 * The maximum number of feature XML elements read (from the XML stream) before they are
+	 * converted into features (in parallel).
+	 *
+	 * This limits the memory used by the XML elements that are waiting to be converted.
+	 */
+	const std::size_t MAX_NUM_FEATURES_PER_BATCH = 4096;
+
+	/**
+	 * The minimum number of features converted by a worker thread at a time.
+	 */
+	const std::size_t MIN_NUM_FEATURES_PER_PARALLEL_CHUNK = 16;
+
+
+	/**
+	 * The result of reading a feature from its XML element.
+	 */
+	struct FeatureReadResult
+	{
+		FeatureReadResult() :
+			contains_unsaved_changes(false)
+		{  }
+
+		boost::optional<Model::FeatureHandle::non_null_ptr_type> feature;
+		IO::ReadErrorAccumulation read_errors;
+		bool contains_unsaved_changes;
+
+		//! Any exception thrown while reading the feature (re-thrown in the calling thread).
+		boost::optional<boost::exception_ptr> exception;
+	};
+
+
+	/**
+	 * Reads features from their XML elements (can be called concurrently for different features).
+	 *
+	 * The read errors (and unsaved changes flag) of each feature are recorded separately so that
+	 * they can be merged in the original feature order afterwards.
+	 */
+	class FeatureBatchReader
+	{
+	public:
+
+		FeatureBatchReader(
+				const std::vector<Model::XmlElementNode::non_null_ptr_type> &feature_xml_elements,
+				const std::vector<IO::GpmlFeatureReaderInterface> &feature_readers,
+				std::vector<FeatureReadResult> &feature_read_results,
+				const Utils::ReaderParams &params) :
+			d_feature_xml_elements(feature_xml_elements),
+			d_feature_readers(feature_readers),
+			d_feature_read_results(feature_read_results),
+			d_reader(params.reader),
+			d_source(params.source)
+		{  }
+
+		void
+		operator()(
+				std::size_t features_begin,
+				std::size_t features_end) const
+		{
+			for (std::size_t feature_index = features_begin; feature_index < features_end; ++feature_index)
+			{
+				const Model::XmlElementNode::non_null_ptr_type &feature_xml_element =
+						d_feature_xml_elements[feature_index];
+				FeatureReadResult &feature_read_result = d_feature_read_results[feature_index];
+
+				boost::shared_ptr<IO::DataSource> source = d_source;
+				Utils::ReaderParams feature_params(
+						d_reader,
+						source,
+						feature_read_result.read_errors,
+						feature_read_result.contains_unsaved_changes);
+
+				try
+				{
+					// XXX: It's probable that we may wish to in some way preserve any 
+					// attributes a feature has, even though we won't use them.
+					append_warning_if( ! feature_xml_element->attributes_empty(),
+							feature_xml_element,
+							feature_params,
+							IO::ReadErrors::UnexpectedNonEmptyAttributeList,
+							IO::ReadErrors::AttributesIgnored);
+
+					// Create and read a new feature from the GPML file (from the already-read-in XML feature node).
+					// The feature is not yet in a feature collection (it gets added later in the calling thread).
+					feature_read_result.feature =
+							d_feature_readers[feature_index].read_feature(feature_xml_element, feature_params);
+				}
+				catch (...)
+				{
+					feature_read_result.exception = boost::current_exception();
+				}
+			}
+		}
+
+	private:
+		const std::vector<Model::XmlElementNode::non_null_ptr_type> &d_feature_xml_elements;
+		const std::vector<IO::GpmlFeatureReaderInterface> &d_feature_readers;
+		std::vector<FeatureReadResult> &d_feature_read_results;
+		QXmlStreamReader &d_reader;
+		boost::shared_ptr<IO::DataSource> d_source;
+	};
+
+
+	/**
+	 * Reads features from the XML elements in @a feature_xml_elements and adds them to
+	 * @a feature_collection (in the same order), and then clears @a feature_xml_elements.
+	 *
+	 * The features are read on multiple threads. This is where most of the time is spent
+	 * (eg, interpreting properties and creating geometries), as opposed to reading the XML.
+	 */
 	void
-	read_feature(
-			const Model::XmlElementNode::non_null_ptr_type &feature_xml_element,
+	read_features(
+			std::vector<Model::XmlElementNode::non_null_ptr_type> &feature_xml_elements,
 			const IO::GpmlFeatureReaderFactory &feature_reader_factory,
 			const Model::FeatureCollectionHandle::weak_ref &feature_collection,
 			Utils::ReaderParams &params)
 	{
-		// XXX: It's probable that we may wish to in some way preserve any 
-		// attributes a feature has, even though we won't use them.
-		append_warning_if( ! feature_xml_element->attributes_empty(),
-				feature_xml_element,
-				params,
-				IO::ReadErrors::UnexpectedNonEmptyAttributeList,
-				IO::ReadErrors::AttributesIgnored);
-	
-		const Model::FeatureType feature_type(feature_xml_element->get_name());
+		const std::size_t num_features = feature_xml_elements.size();
 
-		// Get the feature reader associated with the feature type.
-		IO::GpmlFeatureReaderInterface feature_reader =
-				feature_reader_factory.get_feature_reader(feature_type);
+		// Get the feature reader associated with the feature type of each feature.
+		//
+		// This is done here (in the calling thread) because the feature reader factory creates
+		// (and caches) the feature reader for a feature type the first time it is requested.
+		std::vector<IO::GpmlFeatureReaderInterface> feature_readers;
+		feature_readers.reserve(num_features);
+		for (std::size_t feature_index = 0; feature_index < num_features; ++feature_index)
+		{
+			const Model::FeatureType feature_type(feature_xml_elements[feature_index]->get_name());
+			feature_readers.push_back(feature_reader_factory.get_feature_reader(feature_type));
+		}
 
-		// Create and read a new feature from the GPML file (from the already-read-in XML feature node).
-		GPlatesModel::FeatureHandle::non_null_ptr_type feature =
-				feature_reader.read_feature(feature_xml_element, params);
+		// Read the features in parallel.
+		std::vector<FeatureReadResult> feature_read_results(num_features);
+		GPlatesUtils::ParallelUtils::parallel_for(
+				num_features,
+				FeatureBatchReader(feature_xml_elements, feature_readers, feature_read_results, params),
+				MIN_NUM_FEATURES_PER_PARALLEL_CHUNK);
 
-		// Add the new feature to the feature collection.
-		feature_collection->add(feature);
+		// Add the new features to the feature collection, and merge their read errors, in the original order.
+		BOOST_FOREACH(const FeatureReadResult &feature_read_result, feature_read_results)
+		{
+			params.errors.accumulate(feature_read_result.read_errors);
+			if (feature_read_result.contains_unsaved_changes)
+			{
+				params.contains_unsaved_changes = true;
+			}
+
+			// As when reading features one at a time, a feature that throws prevents subsequent
+			// features from being added.
+			if (feature_read_result.exception)
+			{
+				boost::rethrow_exception(feature_read_result.exception.get());
+			}
+
+			feature_collection->add(feature_read_result.feature.get());
+		}
+
+		feature_xml_elements.clear();
+	}
+
+
+	/**
+	 * The elements whose text content is streamed directly into numeric lists while
+	 * reading the XML (instead of being stored as text and tokenised later).
+	 *
+	 * These carry the coordinates of geometries and hence the bulk of most GPML files.
+	 * The geometry readers in 'GpmlStructuralTypeReaderUtils' use the numeric lists directly
+	 * (and fall back to parsing the text if an element could not be read as a numeric list).
+	 */
+	Model::XmlElementNode::element_name_seq_type
+	create_numeric_list_xml_element_names()
+	{
+		Model::XmlElementNode::element_name_seq_type numeric_list_xml_element_names;
+		numeric_list_xml_element_names.push_back(Model::XmlElementName::create_gml("posList"));
+		numeric_list_xml_element_names.push_back(Model::XmlElementName::create_gml("pos"));
+
+		return numeric_list_xml_element_names;
+	}
+
+	const Model::XmlElementNode::element_name_seq_type &
+	get_numeric_list_xml_element_names()
+	{
+		static const Model::XmlElementNode::element_name_seq_type NUMERIC_LIST_XML_ELEMENT_NAMES =
+				create_numeric_list_xml_element_names();
+
+		return NUMERIC_LIST_XML_ELEMENT_NAMES;
 	}
 
 
+	/**
+	 * Reads the XML element of each feature in a feature member and appends them to @a feature_xml_elements.
+	 *
+	 * When enough feature XML elements have accumulated they are read into features (see @a read_features).
+	 *
+	 * Note that each feature is still read into an XML element tree, which the (GPGIM-driven)
+	 * feature and property readers then interpret. Only the text of coordinate elements is streamed
+	 * (into numeric lists) - there's no streaming path that builds property values directly
+	 * from parse events.
+	 */
 	void
 	read_feature_member(
 			Utils::ReaderParams &params,
 			const IO::GpmlFeatureReaderFactory &feature_reader_factory,
 			const Model::FeatureCollectionHandle::weak_ref &feature_collection,
-			const boost::shared_ptr<Model::XmlElementNode::AliasToNamespaceMap> &alias_map)
+			const boost::shared_ptr<Model::XmlElementNode::AliasToNamespaceMap> &alias_map,
+			std::vector<Model::XmlElementNode::non_null_ptr_type> &feature_xml_elements)
 	{
 		QXmlStreamReader &reader = params.reader;
 		while ( ! reader.atEnd())
@@ -232,8 +405,16 @@ namespace
 			if (reader.isStartElement())
 			{
 				Model::XmlElementNode::non_null_ptr_type feature_xml_element = 
-						Model::XmlElementNode::create(reader, alias_map);
-				read_feature(feature_xml_element, feature_reader_factory, feature_collection, params);
+						Model::XmlElementNode::create(
+								reader,
+								alias_map,
+								get_numeric_list_xml_element_names());
+				feature_xml_elements.push_back(feature_xml_element);
+
+				if (feature_xml_elements.size() >= MAX_NUM_FEATURES_PER_BATCH)
+				{
+					read_features(feature_xml_elements, feature_reader_factory, feature_collection, params);
+				}
 			}
 		}
 	}
@@ -351,10 +532,12 @@ GPlatesFileIO::GpmlReader::read_file(
 	const FileInfo &fileinfo = file.get_file_info();
 
 	QString filename(fileinfo.get_qfileinfo().filePath());
-	QXmlStreamReader reader;
+	QIODevice *device = NULL;
 
 	QFile input_file(filename);
 	boost::optional<GzipFile> gzip_file;
+	// NOTE: Declared after 'gzip_file' so that it's destroyed first (stopping its read-ahead thread).
+	boost::optional<ReadAheadDevice> read_ahead_device;
 	if (use_gzip)
 	{
 		// The gzip file reads and decompresses the gpmlz input file.
@@ -369,7 +552,14 @@ GPlatesFileIO::GpmlReader::read_file(
 			throw ErrorOpeningFileForReadingException(GPLATES_EXCEPTION_SOURCE, filename);
 		}
 
-		reader.setDevice(&gzip_file.get());
+		// Decompress ahead on a separate thread so that decompression overlaps with parsing.
+		read_ahead_device = boost::in_place(&gzip_file.get());
+		if (!read_ahead_device->open(QIODevice::ReadOnly))
+		{
+			throw ErrorOpeningFileForReadingException(GPLATES_EXCEPTION_SOURCE, filename);
+		}
+
+		device = &read_ahead_device.get();
 	}
 	else
 	{
@@ -377,7 +567,7 @@ GPlatesFileIO::GpmlReader::read_file(
 		{
 			throw ErrorOpeningFileForReadingException(GPLATES_EXCEPTION_SOURCE, filename);
 		}
-		reader.setDevice(&input_file);
+		device = &input_file;
 	}
 	
 
@@ -386,6 +576,35 @@ GPlatesFileIO::GpmlReader::read_file(
 
 	GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection = file.get_feature_collection();
 
+	read_device(
+			*device,
+			source,
+			feature_collection,
+			property_structural_type_reader,
+			read_errors,
+			contains_unsaved_changes);
+
+	// Turns relative paths into absolute paths in all GmlFile instances.
+	MakeFilePathsAbsoluteVisitor visitor(fileinfo.get_qfileinfo().absolutePath(), read_errors);
+	for (GPlatesModel::FeatureCollectionHandle::iterator iter = feature_collection->begin();
+			iter != feature_collection->end(); ++iter)
+	{
+		visitor.visit_feature(iter);
+	}
+}
+
+
+void
+GPlatesFileIO::GpmlReader::read_device(
+		QIODevice &device,
+		const boost::shared_ptr<DataSource> &source,
+		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+		const GpmlPropertyStructuralTypeReader::non_null_ptr_to_const_type &property_structural_type_reader,
+		ReadErrorAccumulation &read_errors,
+		bool &contains_unsaved_changes)
+{
+	QXmlStreamReader reader(&device);
+
 	GpmlReaderUtils::ReaderParams params(reader, source, read_errors, contains_unsaved_changes);
 	boost::shared_ptr<GPlatesModel::XmlElementNode::AliasToNamespaceMap> alias_map(
 			new GPlatesModel::XmlElementNode::AliasToNamespaceMap);
@@ -408,6 +627,13 @@ GPlatesFileIO::GpmlReader::read_file(
 		const GpmlFeatureReaderFactory feature_reader_factory(
 				property_structural_type_reader, gpml_version.get());
 
+		// The XML elements of features that have been read from the XML stream but not yet
+		// converted into features.
+		//
+		// Reading the XML stream is sequential, but the features are converted in parallel in batches.
+		std::vector<GPlatesModel::XmlElementNode::non_null_ptr_type> feature_xml_elements;
+		feature_xml_elements.reserve(MAX_NUM_FEATURES_PER_BATCH);
+
 		while ( ! reader.atEnd())
 		{
 			reader.readNext();
@@ -425,9 +651,12 @@ GPlatesFileIO::GpmlReader::read_file(
 					params, 
 					ReadErrors::UnrecognisedFeatureCollectionElement,
 					ReadErrors::ElementNameChanged);
-				read_feature_member(params, feature_reader_factory, feature_collection, alias_map);
+				read_feature_member(params, feature_reader_factory, feature_collection, alias_map, feature_xml_elements);
 			}
 		}
+
+		// Read the remaining features.
+		read_features(feature_xml_elements, feature_reader_factory, feature_collection, params);
 	}
 
 	if (reader.error())
@@ -440,13 +669,5 @@ GPlatesFileIO::GpmlReader::read_file(
 					ReadErrors::ParseError, 
 					ReadErrors::ParsingStoppedPrematurely));
 	}
-
-	// Turns relative paths into absolute paths in all GmlFile instances.
-	MakeFilePathsAbsoluteVisitor visitor(fileinfo.get_qfileinfo().absolutePath(), read_errors);
-	for (GPlatesModel::FeatureCollectionHandle::iterator iter = feature_collection->begin();
-			iter != feature_collection->end(); ++iter)
-	{
-		visitor.visit_feature(iter);
-	}
 }
 
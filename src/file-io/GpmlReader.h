@@ -28,10 +28,14 @@
 #ifndef GPLATES_FILEIO_GPMLREADER_H
 #define GPLATES_FILEIO_GPMLREADER_H
 
+#include <boost/shared_ptr.hpp>
+#include <QIODevice>
+
 #include "File.h"
 #include "FileInfo.h"
 #include "GpmlPropertyStructuralTypeReader.h"
 #include "ReadErrorAccumulation.h"
+#include "ReadErrorOccurrence.h"
 
 #include "model/FeatureCollectionHandle.h"
 
@@ -49,6 +53,24 @@ namespace GPlatesFileIO
 				ReadErrorAccumulation &read_errors,
 				bool &contains_unsaved_changes,
 				bool use_gzip = false);
+
+		/**
+		 * Reads the GPML document in @a device (which should already be open for reading)
+		 * and adds its features to @a feature_collection.
+		 *
+		 * Read errors are reported against @a source.
+		 *
+		 * Unlike @a read_file, any relative file paths in the GPML are left as is.
+		 */
+		static
+		void
+		read_device(
+				QIODevice &device,
+				const boost::shared_ptr<DataSource> &source,
+				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+				const GpmlPropertyStructuralTypeReader::non_null_ptr_to_const_type &property_structural_type_reader,
+				ReadErrorAccumulation &read_errors,
+				bool &contains_unsaved_changes);
 	};
 }
 
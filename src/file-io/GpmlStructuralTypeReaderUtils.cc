@@ -138,6 +138,136 @@ namespace
 	}
 
 
+	/**
+	 * Extracts the numeric list of a text node that was streamed into a numeric list
+	 * (see 'GPlatesModel::XmlTextNode::create_numeric_list()').
+	 */
+	class NumericListExtractionVisitor :
+			public GPlatesModel::XmlNodeVisitor
+	{
+	public:
+
+		virtual
+		void
+		visit_text_node(
+				const GPlatesModel::XmlTextNode::non_null_ptr_type &text)
+		{
+			d_numeric_list = text->get_numeric_list();
+		}
+
+		const boost::optional<const std::vector<double> &> &
+		get_numeric_list() const
+		{
+			return d_numeric_list;
+		}
+
+	private:
+
+		boost::optional<const std::vector<double> &> d_numeric_list;
+	};
+
+
+	/**
+	 * Returns the numbers in the text content of @a elem if the text was streamed into a numeric
+	 * list when it was read, otherwise returns boost::none (and the caller should parse the text).
+	 */
+	boost::optional<const std::vector<double> &>
+	get_numeric_list(
+			const GPlatesModel::XmlElementNode::non_null_ptr_type &elem)
+	{
+		// A numeric list is only created when the element has no other content.
+		if (elem->number_of_children() != 1)
+		{
+			return boost::none;
+		}
+
+		NumericListExtractionVisitor visitor;
+		(*elem->children_begin())->accept_visitor(visitor);
+
+		return visitor.get_numeric_list();
+	}
+
+
+	/**
+	 * Appends the (lat,lon) pairs in the numeric list of @a elem (if any) to @a points.
+	 *
+	 * Returns false if @a elem does not contain a numeric list with an even number of numbers,
+	 * in which case nothing is appended and the caller should parse the text instead.
+	 */
+	bool
+	append_lat_lon_points_from_numeric_list(
+			std::vector<GPlatesMaths::PointOnSphere> &points,
+			const GPlatesModel::XmlElementNode::non_null_ptr_type &elem)
+	{
+		boost::optional<const std::vector<double> &> numeric_list = get_numeric_list(elem);
+		if (!numeric_list ||
+			(numeric_list->size() % 2) != 0)
+		{
+			return false;
+		}
+
+		const unsigned int num_points = numeric_list->size() / 2;
+		points.reserve(points.size() + num_points);
+
+		for (unsigned int n = 0; n < num_points; ++n)
+		{
+			// NOTE: We are assuming GPML is using (lat,lon) ordering.
+			// See http://trac.gplates.org/wiki/CoordinateReferenceSystem for details.
+			const double lat = (*numeric_list)[2 * n];
+			const double lon = (*numeric_list)[2 * n + 1];
+
+			if ( ! (GPlatesMaths::LatLonPoint::is_valid_latitude(lat) &&
+					GPlatesMaths::LatLonPoint::is_valid_longitude(lon))) {
+				// Bad coordinates!
+				throw GPlatesFileIO::GpmlReaderException(GPLATES_EXCEPTION_SOURCE,
+						elem, GPlatesFileIO::ReadErrors::InvalidLatLonPoint,
+						EXCEPTION_SOURCE);
+			}
+			points.push_back(GPlatesMaths::make_point_on_sphere(
+						GPlatesMaths::LatLonPoint(lat,lon)));
+		}
+
+		return true;
+	}
+
+
+	/**
+	 * Appends the (lat,lon) pairs in the whitespace-separated text @a str to @a points.
+	 */
+	void
+	append_lat_lon_points_from_text(
+			std::vector<GPlatesMaths::PointOnSphere> &points,
+			QString str,
+			const GPlatesModel::XmlElementNode::non_null_ptr_type &elem)
+	{
+		points.reserve(points.size() + estimate_number_of_points(str));
+
+		QTextStream is(&str, QIODevice::ReadOnly);
+		while ( ! is.atEnd() && (is.status() == QTextStream::Ok))
+		{
+			double lat = 0.0;
+			double lon = 0.0;
+
+			// FIXME: What should I do if one (or both) of these are screwed?
+			// NOTE: We are assuming GPML is using (lat,lon) ordering.
+			// See http://trac.gplates.org/wiki/CoordinateReferenceSystem for details.
+			is >> lat;
+			// FIXME: Check is.status() here!
+			is >> lon;
+
+			if ( ! (GPlatesMaths::LatLonPoint::is_valid_latitude(lat) &&
+					GPlatesMaths::LatLonPoint::is_valid_longitude(lon))) {
+				// Bad coordinates!
+				throw GPlatesFileIO::GpmlReaderException(GPLATES_EXCEPTION_SOURCE,
+						elem, GPlatesFileIO::ReadErrors::InvalidLatLonPoint,
+						EXCEPTION_SOURCE);
+			}
+			points.push_back(GPlatesMaths::make_point_on_sphere(
+						GPlatesMaths::LatLonPoint(lat,lon)));
+		}
+	}
+
+
 	class ValueObjectTemplateVisitor :
 			public GPlatesModel::XmlNodeVisitor
 	{
@@ -1269,10 +1399,18 @@ GPlatesFileIO::GpmlStructuralTypeReaderUtils::create_pos_2d(
 		const GPlatesModel::GpgimVersion &gpml_version,
 		GPlatesFileIO::ReadErrorAccumulation &read_errors)
 {
-	QString str = create_nonempty_string(elem, gpml_version, read_errors);
-
 	// XXX: Currently assuming srsDimension is 2!!
 
+	// Use the numbers directly if they were streamed into a numeric list when read.
+	boost::optional<const std::vector<double> &> numeric_list = get_numeric_list(elem);
+	if (numeric_list &&
+		numeric_list->size() >= 2)
+	{
+		return std::make_pair((*numeric_list)[0], (*numeric_list)[1]);
+	}
+
+	QString str = create_nonempty_string(elem, gpml_version, read_errors);
+
 	QTextStream is(&str, QIODevice::ReadOnly);
 
 	double x = 0.0;
@@ -1369,35 +1507,18 @@ GPlatesFileIO::GpmlStructuralTypeReaderUtils::create_polyline(
 {
 	typedef GPlatesMaths::PolylineOnSphere polyline_type;
 
-	QString str = create_nonempty_string(elem, gpml_version, read_errors);
-
 	// XXX: Currently assuming srsDimension is 2!!
 
 	std::vector<GPlatesMaths::PointOnSphere> points;
-	points.reserve(estimate_number_of_points(str));
 
-	QTextStream is(&str, QIODevice::ReadOnly);
-	while ( ! is.atEnd() && (is.status() == QTextStream::Ok))
+	// Use the numbers directly if they were streamed into a numeric list when read,
+	// otherwise parse the text.
+	if (!append_lat_lon_points_from_numeric_list(points, elem))
 	{
-		double lat = 0.0;
-		double lon = 0.0;
-
-		// FIXME: What should I do if one (or both) of these are screwed?
-		// NOTE: We are assuming GPML is using (lat,lon) ordering.
-		// See http://trac.gplates.org/wiki/CoordinateReferenceSystem for details.
-		is >> lat;
-		// FIXME: Check is.status() here!
-		is >> lon;
-
-		if ( ! (GPlatesMaths::LatLonPoint::is_valid_latitude(lat) &&
-				GPlatesMaths::LatLonPoint::is_valid_longitude(lon))) {
-			// Bad coordinates!
-			throw GpmlReaderException(GPLATES_EXCEPTION_SOURCE,
-					elem, GPlatesFileIO::ReadErrors::InvalidLatLonPoint,
-					EXCEPTION_SOURCE);
-		}
-		points.push_back(GPlatesMaths::make_point_on_sphere(
-					GPlatesMaths::LatLonPoint(lat,lon)));
+		append_lat_lon_points_from_text(
+				points,
+				create_nonempty_string(elem, gpml_version, read_errors),
+				elem);
 	}
 
 	// We want to return a different ReadError Description for each possible return
@@ -1443,37 +1564,19 @@ GPlatesFileIO::GpmlStructuralTypeReaderUtils::create_polygon_ring(
 {
 	typedef GPlatesMaths::PolygonOnSphere polygon_type;
 
-	QString str = create_nonempty_string(elem, gpml_version, read_errors);
-
 	// XXX: Currently assuming srsDimension is 2!!
 
 	boost::shared_ptr< std::vector<GPlatesMaths::PointOnSphere> > ring_points(
 			new std::vector<GPlatesMaths::PointOnSphere>());
-	ring_points->reserve(estimate_number_of_points(str));
 
-	// Transform the text into a sequence of PointOnSphere.
-	QTextStream is(&str, QIODevice::ReadOnly);
-	while ( ! is.atEnd() && (is.status() == QTextStream::Ok))
+	// Use the numbers directly if they were streamed into a numeric list when read,
+	// otherwise transform the text into a sequence of PointOnSphere.
+	if (!append_lat_lon_points_from_numeric_list(*ring_points, elem))
 	{
-		double lat = 0.0;
-		double lon = 0.0;
-
-		// FIXME: What should I do if one (or both) of these are screwed?
-		// NOTE: We are assuming GPML is using (lat,lon) ordering.
-		// See http://trac.gplates.org/wiki/CoordinateReferenceSystem for details.
-		is >> lat;
-		// FIXME: Check is.status() here!
-		is >> lon;
-
-		if ( ! (GPlatesMaths::LatLonPoint::is_valid_latitude(lat) &&
-				GPlatesMaths::LatLonPoint::is_valid_longitude(lon))) {
-			// Bad coordinates!
-			throw GpmlReaderException(GPLATES_EXCEPTION_SOURCE,
-					elem, GPlatesFileIO::ReadErrors::InvalidLatLonPoint,
-					EXCEPTION_SOURCE);
-		}
-		ring_points->push_back(
-				GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(lat,lon)));
+		append_lat_lon_points_from_text(
+				*ring_points,
+				create_nonempty_string(elem, gpml_version, read_errors),
+				elem);
 	}
 
 	// There should be at least 3 points in a polygon.
@@ -47,6 +47,7 @@
 
 #include "GzipFile.h"
 
+#include <cstring>
 #include <boost/numeric/conversion/cast.hpp>
 
 #include <QBuffer>
@@ -312,10 +313,11 @@ GPlatesFileIO::GzipFile::readData(
 		}
 
 		// Copy the decompressed bytes to the caller.
-		for (int n = 0; n < decompressed_bytes_to_copy; ++n, ++decompressed_bytes_read)
-		{
-			decompressed_data[decompressed_bytes_read] = decompressed_buffer[n];
-		}
+		std::memcpy(
+				decompressed_data + decompressed_bytes_read,
+				decompressed_buffer.constData(),
+				decompressed_bytes_to_copy);
+		decompressed_bytes_read += decompressed_bytes_to_copy;
 
 		// Remove buffered data that we've consumed.
 		decompressed_buffer.remove(0, decompressed_bytes_to_copy);
@@ -400,10 +402,11 @@ GPlatesFileIO::GzipFile::readData(
 		}
 
 		// Copy the decompressed bytes to the caller.
-		for (int n = 0; n < decompressed_bytes_to_copy; ++n, ++decompressed_bytes_read)
-		{
-			decompressed_data[decompressed_bytes_read] = decompressed_buffer[n];
-		}
+		std::memcpy(
+				decompressed_data + decompressed_bytes_read,
+				decompressed_buffer.constData(),
+				decompressed_bytes_to_copy);
+		decompressed_bytes_read += decompressed_bytes_to_copy;
 
 		// Remove buffered data that we've consumed.
 		decompressed_buffer.remove(0, decompressed_bytes_to_copy);
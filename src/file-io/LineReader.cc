@@ -23,23 +23,110 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <cstring>
+#include <QString>
+#include <QTextCodec>
+
 #include "LineReader.h"
 
+
+namespace
+{
+	//! The UTF8 byte-order-mark.
+	const char UTF8_BYTE_ORDER_MARK[] = "\xEF\xBB\xBF";
+	const int UTF8_BYTE_ORDER_MARK_SIZE = 3;
+}
+
+
 GPlatesFileIO::LineReader::LineReader(
 		QFile &input) :
-	d_text_stream(&input),
+	d_input(input),
+	d_mapped_data(NULL),
+	d_position(NULL),
+	d_end(NULL),
 	d_line_number(0),
 	d_have_buffered_line(false)
 {
+	// Map the entire file into memory so that lines can be split in place without copying.
+	// If that's not possible (eg, an empty file) then read the entire file instead.
+	const qint64 file_size = d_input.size();
+	if (file_size > 0)
+	{
+		d_mapped_data = d_input.map(0, file_size);
+	}
+	if (d_mapped_data)
+	{
+		d_data = QByteArray::fromRawData(reinterpret_cast<const char *>(d_mapped_data), file_size);
+	}
+	else
+	{
+		d_data = d_input.readAll();
+	}
+
 	// Assume input text file is UTF8 encoded (which includes the ASCII character set).
-	// If we don't specify this then UTF8 characters will not decoded correctly on reading.
-	d_text_stream.setCodec("UTF-8");
+	// However, like QTextStream, we also detect a UTF16/UTF32 byte-order-mark, in which case
+	// we convert the entire file to UTF8 up front so that lines can still be parsed as UTF8 bytes.
+	int start_offset = 0;
+	if (d_data.startsWith(UTF8_BYTE_ORDER_MARK))
+	{
+		start_offset = UTF8_BYTE_ORDER_MARK_SIZE;
+	}
+	else
+	{
+		QTextCodec *codec = QTextCodec::codecForUtfText(d_data, NULL/*defaultCodec*/);
+		if (codec)
+		{
+			QString text = codec->toUnicode(d_data);
+			if (text.startsWith(QChar(0xFEFF)))
+			{
+				text.remove(0, 1);
+			}
+
+			// Converting means we no longer need the mapped file.
+			d_data = text.toUtf8();
+			if (d_mapped_data)
+			{
+				d_input.unmap(d_mapped_data);
+				d_mapped_data = NULL;
+			}
+		}
+	}
+
+	d_position = d_data.constData() + start_offset;
+	d_end = d_data.constData() + d_data.size();
+}
+
+
+GPlatesFileIO::LineReader::~LineReader()
+{
+	if (d_mapped_data)
+	{
+		// Release our reference to the mapped data before unmapping it.
+		d_data.clear();
+		d_input.unmap(d_mapped_data);
+	}
 }
 
 
 bool
 GPlatesFileIO::LineReader::getline(
 		QString &line)
+{
+	Line line_bytes;
+	if (!getline(line_bytes))
+	{
+		return false;
+	}
+
+	line = line_bytes.to_qstring();
+
+	return true;
+}
+
+
+bool
+GPlatesFileIO::LineReader::getline(
+		Line &line)
 {
 	if (d_have_buffered_line)
 	{
@@ -63,6 +150,22 @@ GPlatesFileIO::LineReader::getline(
 bool
 GPlatesFileIO::LineReader::peekline(
 		QString &line)
+{
+	Line line_bytes;
+	if (!peekline(line_bytes))
+	{
+		return false;
+	}
+
+	line = line_bytes.to_qstring();
+
+	return true;
+}
+
+
+bool
+GPlatesFileIO::LineReader::peekline(
+		Line &line)
 {
 	if (d_have_buffered_line)
 	{
@@ -84,18 +187,36 @@ GPlatesFileIO::LineReader::peekline(
 
 bool
 GPlatesFileIO::LineReader::readline(
-		QString &line)
+		Line &line)
 {
-	if (d_text_stream.atEnd())
+	if (d_position == d_end)
 	{
 		return false;
 	}
 
-	// Note that QTextStream::readLine() recognises both "\n" (used by Unix and Mac OS X) and
-	// "\r\n" (used by Windows). It doesn't recognise "\r" used by Macs prior to Mac OS X, but
+	// Note that, like QTextStream::readLine(), we recognise both "\n" (used by Unix and Mac OS X)
+	// and "\r\n" (used by Windows). We don't recognise "\r" used by Macs prior to Mac OS X, but
 	// those are very old systems and hopefully we don't have any (or many) files around these
 	// days with just "\r".
-	line = d_text_stream.readLine();
+	const char *line_end = static_cast<const char *>(
+			std::memchr(d_position, '\n', d_end - d_position));
+
+	line.begin = d_position;
+	if (line_end)
+	{
+		d_position = line_end + 1;
+		if (line_end != line.begin && *(line_end - 1) == '\r')
+		{
+			--line_end;
+		}
+		line.end = line_end;
+	}
+	else
+	{
+		// The last line has no end-of-line characters.
+		line.end = d_end;
+		d_position = d_end;
+	}
 
 	return true;
 }
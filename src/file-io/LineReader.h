@@ -36,9 +36,9 @@
 #define GPLATES_FILEIO_LINEREADER_H
 
 #include <boost/noncopyable.hpp>
+#include <QByteArray>
 #include <QFile>
 #include <QString>
-#include <QTextStream>
 
 #include "utils/SafeBool.h"
 
@@ -48,6 +48,15 @@ namespace GPlatesFileIO
 	/**
 	 * Reads lines in a text file allowing client to peek ahead one line.
 	 *
+	 * The entire file is memory-mapped (or read into memory if it cannot be mapped) and lines
+	 * are split in place, so lines can be accessed as raw UTF8 bytes (see @a Line) without
+	 * decoding them to QString. Clients that only need to parse ASCII fields (such as numbers)
+	 * should use the @a Line overloads of @a getline and @a peekline (and @a LineTokenizer).
+	 *
+	 * The text file is assumed to be UTF8 encoded (which includes the ASCII character set).
+	 * A UTF8 byte-order-mark is skipped, and a file with a UTF16 or UTF32 byte-order-mark is
+	 * converted to UTF8 when it is opened.
+	 *
 	 * NOTE: Using a 'QFile' instead of 'std::istream' in order to support filenames
 	 * with unicode characters, and using QString instead of std::string to support
 	 * unicode characters within the files.
@@ -63,10 +72,42 @@ namespace GPlatesFileIO
 			private boost::noncopyable
 	{
 	public:
+
+		/**
+		 * The UTF8 bytes of a line (excluding the end-of-line characters).
+		 *
+		 * The bytes remain valid for the lifetime of the @a LineReader.
+		 */
+		struct Line
+		{
+			Line() :
+				begin(NULL),
+				end(NULL)
+			{  }
+
+			/**
+			 * Decodes the UTF8 bytes of the line.
+			 */
+			QString
+			to_qstring() const
+			{
+				return QString::fromUtf8(begin, end - begin);
+			}
+
+			const char *begin;
+			const char *end;
+		};
+
+
+		/**
+		 * The file @a input must be open and must remain open for the lifetime of this line reader.
+		 */
 		explicit
 		LineReader(
 				QFile &input);
 
+		~LineReader();
+
 		
 		/**
 		 * Reads the next line and returns true if there is one.
@@ -75,6 +116,13 @@ namespace GPlatesFileIO
 		getline(
 				QString &line);
 
+		/**
+		 * Reads the next line (without decoding it) and returns true if there is one.
+		 */
+		bool
+		getline(
+				Line &line);
+
 					
 		/**
 		 * Peeks at the next line and returns true if there is one.
@@ -85,6 +133,15 @@ namespace GPlatesFileIO
 		peekline(
 				QString &line);
 
+		/**
+		 * Peeks at the next line (without decoding it) and returns true if there is one.
+		 *
+		 * A subsequent call to @a getline will return the same line.
+		 */
+		bool
+		peekline(
+				Line &line);
+
 
 		/**
 		 * SafeBool base class provides operator bool().
@@ -94,7 +151,7 @@ namespace GPlatesFileIO
 		bool
 		boolean_test() const
 		{
-			return d_have_buffered_line || !d_text_stream.atEnd();
+			return d_have_buffered_line || d_position != d_end;
 		}
 
 		
@@ -105,15 +162,25 @@ namespace GPlatesFileIO
 		}
 	
 	private:
-		QTextStream d_text_stream;
+		QFile &d_input;
+
+		//! The memory-mapped file (or NULL if the file could not be mapped).
+		uchar *d_mapped_data;
+
+		//! The file contents (refers to the memory-mapped file if it was mapped).
+		QByteArray d_data;
+
+		const char *d_position;
+		const char *d_end;
+
 		unsigned int d_line_number;
-		QString d_buffered_line;
+		Line d_buffered_line;
 		bool d_have_buffered_line;
 
 
 		bool
 		readline(
-				QString &line);
+				Line &line);
 	};
 }
 
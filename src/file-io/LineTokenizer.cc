@@ -0,0 +1,353 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <limits>
+#include <boost/cstdint.hpp>
+#include <QByteArray>
+
+#include "LineTokenizer.h"
+
+
+namespace
+{
+	/**
+	 * Powers of ten that are exactly representable as doubles.
+	 */
+	const double EXACT_POWERS_OF_TEN[] =
+	{
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+	const int MAX_EXACT_POWER_OF_TEN = 22;
+
+	//! Mantissas up to this value are exactly representable as doubles.
+	const boost::uint64_t MAX_EXACT_MANTISSA = boost::uint64_t(1) << 53;
+
+	//! More significant digits than this may overflow the 64-bit mantissa.
+	const int MAX_MANTISSA_DIGITS = 19;
+
+
+	inline
+	bool
+	is_whitespace(
+			char c)
+	{
+		return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+	}
+
+
+	inline
+	bool
+	is_digit(
+			char c)
+	{
+		return c >= '0' && c <= '9';
+	}
+
+
+	/**
+	 * Returns true if the (case insensitive) lower-case @a word starts at @a position.
+	 */
+	bool
+	starts_with_word(
+			const char *position,
+			const char *end,
+			const char *word)
+	{
+		for ( ; *word; ++word, ++position)
+		{
+			if (position == end ||
+				(*position | 0x20) != *word) // ASCII lower-case
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+
+	/**
+	 * Accumulates a decimal digit into @a mantissa.
+	 *
+	 * Returns false if there are too many significant digits to accumulate.
+	 */
+	inline
+	bool
+	accumulate_digit(
+			char digit,
+			boost::uint64_t &mantissa,
+			int &num_significant_digits)
+	{
+		if (num_significant_digits == MAX_MANTISSA_DIGITS)
+		{
+			return false;
+		}
+
+		mantissa = 10 * mantissa + (digit - '0');
+		if (mantissa != 0)
+		{
+			++num_significant_digits;
+		}
+
+		return true;
+	}
+}
+
+
+bool
+GPlatesFileIO::LineTokenizer::read(
+		double &value)
+{
+	skip_whitespace();
+
+	const char *const token_begin = d_position;
+	const char *position = d_position;
+
+	bool negative = false;
+	if (position != d_end &&
+		(*position == '+' || *position == '-'))
+	{
+		negative = (*position == '-');
+		++position;
+	}
+
+	if (starts_with_word(position, d_end, "inf"))
+	{
+		value = negative
+				? -std::numeric_limits<double>::infinity()
+				: std::numeric_limits<double>::infinity();
+		d_position = position + 3;
+		return true;
+	}
+	if (starts_with_word(position, d_end, "nan"))
+	{
+		value = std::numeric_limits<double>::quiet_NaN();
+		d_position = position + 3;
+		return true;
+	}
+
+	// Accumulate the significant digits into an integer mantissa with a decimal exponent.
+	boost::uint64_t mantissa = 0;
+	int num_significant_digits = 0;
+	int exponent = 0;
+	bool mantissa_is_exact = true;
+	bool have_digits = false;
+
+	for ( ; position != d_end && is_digit(*position); ++position)
+	{
+		have_digits = true;
+		if (!accumulate_digit(*position, mantissa, num_significant_digits))
+		{
+			mantissa_is_exact = false;
+		}
+	}
+	if (position != d_end && *position == '.')
+	{
+		for (++position; position != d_end && is_digit(*position); ++position)
+		{
+			have_digits = true;
+			if (accumulate_digit(*position, mantissa, num_significant_digits))
+			{
+				--exponent;
+			}
+			else
+			{
+				mantissa_is_exact = false;
+			}
+		}
+	}
+
+	if (!have_digits)
+	{
+		return false;
+	}
+
+	// The exponent is only part of the number if it has at least one digit.
+	if (position != d_end &&
+		(*position == 'e' || *position == 'E'))
+	{
+		const char *exponent_position = position + 1;
+		bool negative_exponent = false;
+		if (exponent_position != d_end &&
+			(*exponent_position == '+' || *exponent_position == '-'))
+		{
+			negative_exponent = (*exponent_position == '-');
+			++exponent_position;
+		}
+
+		if (exponent_position != d_end && is_digit(*exponent_position))
+		{
+			int explicit_exponent = 0;
+			for ( ; exponent_position != d_end && is_digit(*exponent_position); ++exponent_position)
+			{
+				// Avoid integer overflow (the number is way out of range anyway).
+				if (explicit_exponent < 100000)
+				{
+					explicit_exponent = 10 * explicit_exponent + (*exponent_position - '0');
+				}
+			}
+
+			exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+			position = exponent_position;
+		}
+	}
+
+	if (mantissa_is_exact &&
+		mantissa <= MAX_EXACT_MANTISSA &&
+		exponent >= -MAX_EXACT_POWER_OF_TEN &&
+		exponent <= MAX_EXACT_POWER_OF_TEN)
+	{
+		// Both the mantissa and the power of ten are exact doubles, so a single (correctly rounded)
+		// multiply or divide gives the correctly rounded result. This covers almost all numbers
+		// in practice (eg, up to 15 significant digits with an exponent magnitude up to 22).
+		double result = static_cast<double>(mantissa);
+		if (exponent < 0)
+		{
+			result /= EXACT_POWERS_OF_TEN[-exponent];
+		}
+		else
+		{
+			result *= EXACT_POWERS_OF_TEN[exponent];
+		}
+
+		value = negative ? -result : result;
+	}
+	else
+	{
+		// Fall back to the (slower) general conversion, which uses the C locale.
+		bool ok;
+		const double result = QByteArray(token_begin, position - token_begin).toDouble(&ok);
+		if (!ok)
+		{
+			return false;
+		}
+
+		value = result;
+	}
+
+	d_position = position;
+	return true;
+}
+
+
+bool
+GPlatesFileIO::LineTokenizer::read(
+		int &value)
+{
+	long long integer;
+	if (!read_integer(integer))
+	{
+		return false;
+	}
+
+	value = static_cast<int>(integer);
+	return true;
+}
+
+
+bool
+GPlatesFileIO::LineTokenizer::read(
+		unsigned int &value)
+{
+	long long integer;
+	if (!read_integer(integer))
+	{
+		return false;
+	}
+
+	value = static_cast<unsigned int>(integer);
+	return true;
+}
+
+
+bool
+GPlatesFileIO::LineTokenizer::read(
+		unsigned long &value)
+{
+	long long integer;
+	if (!read_integer(integer))
+	{
+		return false;
+	}
+
+	value = static_cast<unsigned long>(integer);
+	return true;
+}
+
+
+GPlatesFileIO::LineReader::Line
+GPlatesFileIO::LineTokenizer::remainder()
+{
+	skip_whitespace();
+
+	LineReader::Line line;
+	line.begin = d_position;
+	line.end = d_end;
+
+	d_position = d_end;
+
+	return line;
+}
+
+
+bool
+GPlatesFileIO::LineTokenizer::read_integer(
+		long long &value)
+{
+	skip_whitespace();
+
+	const char *position = d_position;
+
+	bool negative = false;
+	if (position != d_end &&
+		(*position == '+' || *position == '-'))
+	{
+		negative = (*position == '-');
+		++position;
+	}
+
+	if (position == d_end || !is_digit(*position))
+	{
+		return false;
+	}
+
+	boost::uint64_t magnitude = 0;
+	for ( ; position != d_end && is_digit(*position); ++position)
+	{
+		magnitude = 10 * magnitude + (*position - '0');
+	}
+
+	value = negative
+			? -static_cast<long long>(magnitude)
+			: static_cast<long long>(magnitude);
+
+	d_position = position;
+	return true;
+}
+
+
+void
+GPlatesFileIO::LineTokenizer::skip_whitespace()
+{
+	while (d_position != d_end && is_whitespace(*d_position))
+	{
+		++d_position;
+	}
+}
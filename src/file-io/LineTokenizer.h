@@ -0,0 +1,97 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILEIO_LINETOKENIZER_H
+#define GPLATES_FILEIO_LINETOKENIZER_H
+
+#include "LineReader.h"
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * Parses whitespace-separated numbers, in place, from the UTF8 bytes of a line.
+	 *
+	 * This is a much faster replacement for reading numbers from a QTextStream (over a QString line)
+	 * since there's no UTF8 decoding, no locale and no per-character virtual stream machinery.
+	 * It accepts the same numbers as QTextStream (with its integer base set to 10):
+	 *  - integers are an optional sign followed by decimal digits (so "012" is twelve, not octal),
+	 *  - reals are an optional sign followed by digits with an optional decimal point and
+	 *    optional exponent, or "inf" or "nan" (case insensitive).
+	 *
+	 * Like QTextStream, leading whitespace is skipped before each number, and a number ends
+	 * at the first character that cannot continue it (the next read then starts from there).
+	 * Only ASCII whitespace is recognised as whitespace.
+	 *
+	 * Each read returns false (and leaves the position unchanged) if a number could not be read.
+	 */
+	class LineTokenizer
+	{
+	public:
+
+		explicit
+		LineTokenizer(
+				const LineReader::Line &line) :
+			d_position(line.begin),
+			d_end(line.end)
+		{  }
+
+
+		bool
+		read(
+				double &value);
+
+		bool
+		read(
+				int &value);
+
+		bool
+		read(
+				unsigned int &value);
+
+		bool
+		read(
+				unsigned long &value);
+
+
+		/**
+		 * Skips whitespace and returns the remainder of the line.
+		 */
+		LineReader::Line
+		remainder();
+
+	private:
+
+		const char *d_position;
+		const char *d_end;
+
+
+		/**
+		 * Reads a signed 64-bit integer (wrapping on overflow, like QTextStream).
+		 */
+		bool
+		read_integer(
+				long long &value);
+
+		void
+		skip_whitespace();
+	};
+}
+
+#endif // GPLATES_FILEIO_LINETOKENIZER_H
@@ -142,7 +142,9 @@ namespace GPlatesFileIO
 			d_in >> version_number;
 
 			// Determine which reader to use depending on the version.
-			if (version_number == 1)
+			// Version 2 only changed the block information and block data which is handled by
+			// RasterFileCacheFormatReader (used by VersionOneReader).
+			if (version_number >= 1 && version_number <= 2)
 			{
 				d_impl.reset(new VersionOneReader(version_number, d_file, d_in));
 			}
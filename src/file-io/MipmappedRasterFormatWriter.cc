@@ -60,3 +60,75 @@ namespace GPlatesFileIO
 		}
 	}
 }
+
+
+GPlatesFileIO::MipmappedRasterFormatWriterInternals::TemporaryMipmapLevelFile::TemporaryMipmapLevelFile(
+		const QString &filename) :
+	d_file_stream(&d_file),
+	d_byte_stream(&d_byte_array, QIODevice::ReadWrite)
+{
+	// Use the same Qt data stream version as the final output file/stream.
+	d_file_stream.setVersion(RasterFileCacheFormat::Q_DATA_STREAM_VERSION);
+	d_byte_stream.setVersion(RasterFileCacheFormat::Q_DATA_STREAM_VERSION);
+
+	// Attempt to open mipmap file (for reading/writing) in temporary directory.
+	if (!d_file.open())
+	{
+		// Attempt to open mipmap file in same directory as source raster.
+		// The auto-generated part of the filename should get appended.
+		d_file.setFileTemplate(filename);
+		if (!d_file.open())
+		{
+			throw ErrorOpeningFileForWritingException(
+					GPLATES_EXCEPTION_SOURCE,
+					filename + ".tmp"/*give it an extension to indicate a temporary file*/);
+		}
+	}
+}
+
+
+quint64
+GPlatesFileIO::MipmappedRasterFormatWriterInternals::TemporaryMipmapLevelFile::append(
+		const QByteArray &encoded_data)
+{
+	// Write any accumulated data first so that we can write the (usually large) encoded data
+	// directly to the file (instead of copying it into the byte stream).
+	flush();
+
+	const quint64 file_offset = d_file.pos();
+	const unsigned int num_padding_bytes = RasterFileCacheFormat::get_block_data_padding(file_offset);
+	RasterFileCacheFormat::write_padding(d_file_stream, num_padding_bytes);
+
+	if (d_file_stream.writeRawData(encoded_data.constData(), encoded_data.size()) != encoded_data.size())
+	{
+		throw GPlatesGlobal::LogException(
+				GPLATES_EXCEPTION_SOURCE,
+				"Error writing temporary mipmap file during raster file cache mipmap generation.");
+	}
+
+	return file_offset + num_padding_bytes;
+}
+
+
+void
+GPlatesFileIO::MipmappedRasterFormatWriterInternals::TemporaryMipmapLevelFile::flush_if_full()
+{
+	if (d_byte_array.size() >= int(BYTE_STREAM_SIZE_THRESHOLD))
+	{
+		flush();
+	}
+}
+
+
+QFile &
+GPlatesFileIO::MipmappedRasterFormatWriterInternals::TemporaryMipmapLevelFile::flush()
+{
+	if (!d_byte_array.isEmpty())
+	{
+		d_file_stream.writeRawData(d_byte_array.constData(), d_byte_array.size());
+		d_byte_array.clear();
+		d_byte_stream.device()->seek(0);
+	}
+
+	return d_file;
+}
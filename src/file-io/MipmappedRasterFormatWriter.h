@@ -28,14 +28,23 @@
 #ifndef GPLATES_FILEIO_MIPMAPPEDRASTERFORMATWRITER_H
 #define GPLATES_FILEIO_MIPMAPPEDRASTERFORMATWRITER_H
 
+#include <algorithm>
 #include <limits>
 #include <ostream>
 #include <string>
 #include <vector>
+#include <boost/bind/bind.hpp>
+#include <boost/exception_ptr.hpp>
 #include <boost/foreach.hpp>
+#include <boost/function.hpp>
 #include <boost/noncopyable.hpp>
+#include <boost/optional.hpp>
+#include <boost/ref.hpp>
 #include <boost/scoped_array.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
 #include <boost/type_traits/is_floating_point.hpp>
 #include <boost/type_traits/is_integral.hpp>
 #include <boost/utility/enable_if.hpp>
@@ -45,6 +54,7 @@
 #include <QFile>
 #include <QFileInfo>
 #include <QString>
+#include <QSysInfo>
 #include <QTemporaryFile>
 
 #include "ErrorOpeningFileForWritingException.h"
@@ -67,30 +77,20 @@
 #include "property-values/RawRasterUtils.h"
 
 #include "utils/Base2Utils.h"
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 
 namespace GPlatesFileIO
 {
-	namespace MipmappedRasterFormatWriterInternals
-	{
-		template<typename T>
-		void
-		write(
-				QDataStream &out,
-				const T *data,
-				unsigned int len)
-		{
-			PROFILE_FUNC();
-
-			const T *end = data + len;
-			while (data != end)
-			{
-				out << *data;
-				++data;
-			}
-		}
+	/**
+	 * Reports the progress of mipmap generation as the number of (equally sized) regions of the
+	 * source raster mipmapped so far, and the total number of regions.
+	 */
+	typedef boost::function<void (unsigned int, unsigned int)> mipmap_progress_callback_type;
 
 
+	namespace MipmappedRasterFormatWriterInternals
+	{
 		/**
 		 * Returns the NAN no-data value for floating point element types (returns true), otherwise
 		 * returns the default value for the element type (and returns false).
@@ -120,6 +120,253 @@ namespace GPlatesFileIO
 				GPlatesGui::rgba8_t &no_data_value);
 
 
+		/**
+		 * A temporary file containing the encoded data of a mipmap level.
+		 *
+		 * Data written to @a get_stream is accumulated in memory and streamed to the file once
+		 * enough has accumulated. Doing this avoids an excessive number of disk file seeks
+		 * (slowing things dramatically).
+		 */
+		class TemporaryMipmapLevelFile :
+				private boost::noncopyable
+		{
+		public:
+			/**
+			 * Opens a temporary file in the temporary directory (or, failing that, in the same
+			 * directory as @a filename).
+			 *
+			 * Throws @a ErrorOpeningFileForWritingException if the file could not be opened.
+			 */
+			explicit
+			TemporaryMipmapLevelFile(
+					const QString &filename);
+
+			/**
+			 * The stream to write encoded data to.
+			 */
+			QDataStream &
+			get_stream()
+			{
+				return d_byte_stream;
+			}
+
+			/**
+			 * The file offset of the next data written to @a get_stream
+			 * (the current file offset plus any unwritten data).
+			 */
+			quint64
+			get_position() const
+			{
+				return d_file.pos() + d_byte_array.size();
+			}
+
+			/**
+			 * Appends @a encoded_data at the next file offset that is a multiple of
+			 * RasterFileCacheFormat::BLOCK_DATA_ALIGNMENT, and returns that file offset.
+			 */
+			quint64
+			append(
+					const QByteArray &encoded_data);
+
+			/**
+			 * Streams the data written to @a get_stream to the file if enough has accumulated.
+			 */
+			void
+			flush_if_full();
+
+			/**
+			 * Streams any data written to @a get_stream to the file, and returns the file.
+			 */
+			QFile &
+			flush();
+
+		private:
+			/**
+			 * When the number of bytes written to the byte stream exceeds this threshold then
+			 * we'll stream it to the file.
+			 */
+			static const unsigned int BYTE_STREAM_SIZE_THRESHOLD = 8 * 1024 * 1024;
+
+			QTemporaryFile d_file;
+			QDataStream d_file_stream;
+			QByteArray d_byte_array;
+			QDataStream d_byte_stream;
+		};
+
+
+		/**
+		 * Runs a sequence of tasks on worker threads and returns their results, in order,
+		 * to a consumer thread.
+		 *
+		 * Worker threads only run ahead of the consumer by a limited number of tasks
+		 * (to limit the memory used by results waiting to be consumed).
+		 */
+		template <typename ResultType>
+		class OrderedTaskPool :
+				private boost::noncopyable
+		{
+		public:
+			/**
+			 * A task is called (on a worker thread) with its index in the sequence of tasks.
+			 */
+			typedef boost::function<boost::shared_ptr<ResultType> (unsigned int)> task_type;
+
+
+			/**
+			 * Starts @a num_threads worker threads to run @a num_tasks tasks.
+			 */
+			OrderedTaskPool(
+					unsigned int num_tasks,
+					const task_type &task,
+					unsigned int num_threads,
+					unsigned int max_num_pending_tasks) :
+				d_task(task),
+				d_results(num_tasks),
+				d_max_num_pending_tasks((std::max)(max_num_pending_tasks, 1U)),
+				d_next_task_to_run(0),
+				d_next_task_to_consume(0),
+				d_stop(false)
+			{
+				for (unsigned int n = 0; n < num_threads; ++n)
+				{
+					d_threads.create_thread(boost::bind(&OrderedTaskPool::run_tasks, this));
+				}
+			}
+
+
+			/**
+			 * Stops the worker threads (if they're still running tasks) and waits for them to finish.
+			 */
+			~OrderedTaskPool()
+			{
+				{
+					boost::mutex::scoped_lock lock(d_mutex);
+					d_stop = true;
+				}
+				d_task_consumed_condition.notify_all();
+
+				d_threads.join_all();
+			}
+
+
+			/**
+			 * Waits for, and returns, the result of the next task.
+			 *
+			 * Re-throws the exception thrown by any task.
+			 */
+			boost::shared_ptr<ResultType>
+			wait_for_next_result()
+			{
+				boost::mutex::scoped_lock lock(d_mutex);
+
+				GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+						d_next_task_to_consume < d_results.size(),
+						GPLATES_ASSERTION_SOURCE);
+
+				while (!d_results[d_next_task_to_consume] &&
+					!d_exception)
+				{
+					d_task_completed_condition.wait(lock);
+				}
+
+				if (d_exception)
+				{
+					boost::rethrow_exception(d_exception.get());
+				}
+
+				boost::shared_ptr<ResultType> result;
+				result.swap(d_results[d_next_task_to_consume]);
+				++d_next_task_to_consume;
+
+				lock.unlock();
+				d_task_consumed_condition.notify_all();
+
+				return result;
+			}
+
+		private:
+
+			task_type d_task;
+
+			boost::mutex d_mutex;
+			boost::condition_variable d_task_completed_condition;
+			boost::condition_variable d_task_consumed_condition;
+
+			//! Results of completed tasks that have not yet been consumed.
+			std::vector<boost::shared_ptr<ResultType> > d_results;
+			unsigned int d_max_num_pending_tasks;
+			unsigned int d_next_task_to_run;
+			unsigned int d_next_task_to_consume;
+			bool d_stop;
+			boost::optional<boost::exception_ptr> d_exception;
+
+			boost::thread_group d_threads;
+
+
+			void
+			run_tasks()
+			{
+				while (true)
+				{
+					unsigned int task_index;
+					{
+						boost::mutex::scoped_lock lock(d_mutex);
+
+						// Wait until the consumer has caught up (if we're too far ahead).
+						while (!d_stop &&
+							d_next_task_to_run < d_results.size() &&
+							d_next_task_to_run >= d_next_task_to_consume + d_max_num_pending_tasks)
+						{
+							d_task_consumed_condition.wait(lock);
+						}
+
+						if (d_stop ||
+							d_next_task_to_run >= d_results.size())
+						{
+							return;
+						}
+
+						task_index = d_next_task_to_run++;
+					}
+
+					boost::shared_ptr<ResultType> result;
+					try
+					{
+						result = d_task(task_index);
+
+						// A task must return a result (the consumer waits for it).
+						GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+								result,
+								GPLATES_ASSERTION_SOURCE);
+					}
+					catch (...)
+					{
+						{
+							boost::mutex::scoped_lock lock(d_mutex);
+
+							// Only the first exception is kept, and the remaining tasks are abandoned.
+							if (!d_exception)
+							{
+								d_exception = boost::current_exception();
+							}
+							d_stop = true;
+						}
+						d_task_completed_condition.notify_all();
+						d_task_consumed_condition.notify_all();
+
+						return;
+					}
+
+					{
+						boost::mutex::scoped_lock lock(d_mutex);
+						d_results[task_index] = result;
+					}
+					d_task_completed_condition.notify_all();
+				}
+			}
+		};
+
+
 		template <class ProxiedRawRasterType, class MipmapperType>
 		class BaseMipmappedRasterFormatWriter
 		{
@@ -158,9 +405,30 @@ namespace GPlatesFileIO
 			}
 
 
+			/**
+			 * Reports the progress of @a write.
+			 *
+			 * It is called on the thread calling @a write.
+			 */
+			typedef mipmap_progress_callback_type progress_callback_type;
+
+
+			/**
+			 * Sets the callback used to report the progress of @a write.
+			 */
+			void
+			set_progress_callback(
+					const progress_callback_type &progress_callback)
+			{
+				d_progress_callback = progress_callback;
+			}
+
+
 			/**
 			 * Creates mipmaps and writes a Mipmapped Raster Format file at @a filename.
 			 *
+			 * The source raster is mipmapped using multiple threads.
+			 *
 			 * Throws @a ErrorOpeningFileForWritingException if the file could not
 			 * be opened for writing.
 			 */
@@ -223,42 +491,12 @@ namespace GPlatesFileIO
 				// Create a temporary file for each mipmap level to contain its encoded data.
 				// These files are temporary and will be removed on scope exit after their data
 				// is concatenated to the final mipmap pyramid file.
-				std::vector<boost::shared_ptr<QTemporaryFile> > temporary_mipmap_files;
-				std::vector<boost::shared_ptr<QDataStream> > temporary_mipmap_file_streams;
-				std::vector<boost::shared_ptr<QByteArray> > temporary_mipmap_byte_arrays;
-				std::vector<boost::shared_ptr<QDataStream> > temporary_mipmap_byte_streams;
+				std::vector<boost::shared_ptr<TemporaryMipmapLevelFile> > temporary_mipmap_files;
 				for (level = 0; level < d_num_levels; ++level)
 				{
-					boost::shared_ptr<QTemporaryFile> temporary_mipmap_file(new QTemporaryFile());
-					boost::shared_ptr<QDataStream> temporary_mipmap_file_stream(
-							new QDataStream(temporary_mipmap_file.get()));
-					// Use the same Qt data stream version as the final output file/stream.
-					temporary_mipmap_file_stream->setVersion(RasterFileCacheFormat::Q_DATA_STREAM_VERSION);
-
-					boost::shared_ptr<QByteArray> temporary_mipmap_byte_array(new QByteArray());
-					boost::shared_ptr<QDataStream> temporary_mipmap_byte_stream(
-							new QDataStream(temporary_mipmap_byte_array.get(), QIODevice::ReadWrite));
-					// Use the same Qt data stream version as the final output file/stream.
-					temporary_mipmap_byte_stream->setVersion(RasterFileCacheFormat::Q_DATA_STREAM_VERSION);
-
-					// Attempt to open mipmap file (for reading/writing) in temporary directory.
-					if (!temporary_mipmap_file->open())
-					{
-						// Attempt to open mipmap file in same directory as source raster.
-						// The auto-generated part of the filename should get appended.
-						temporary_mipmap_file->setFileTemplate(filename);
-						if (!temporary_mipmap_file->open())
-						{
-							throw ErrorOpeningFileForWritingException(
-									GPLATES_EXCEPTION_SOURCE,
-									filename + ".tmp"/*give it an extension to indicate a temporary file*/);
-						}
-					}
-
-					temporary_mipmap_files.push_back(temporary_mipmap_file);
-					temporary_mipmap_file_streams.push_back(temporary_mipmap_file_stream);
-					temporary_mipmap_byte_arrays.push_back(temporary_mipmap_byte_array);
-					temporary_mipmap_byte_streams.push_back(temporary_mipmap_byte_stream);
+					temporary_mipmap_files.push_back(
+							boost::shared_ptr<TemporaryMipmapLevelFile>(
+									new TemporaryMipmapLevelFile(filename)));
 				}
 
 				// Create the block information for each mipmap level.
@@ -289,6 +527,15 @@ namespace GPlatesFileIO
 								source_raster_width_next_power_of_two,
 								source_raster_height_next_power_of_two);
 
+				// The root node of the quad tree covers the entire source raster (and more).
+				const QuadTreeNode root_node(
+						d_num_levels - 1/*level*/,
+						0/*x_offset*/,
+						0/*y_offset*/,
+						source_raster_dimension_next_power_of_two/*dimension*/,
+						0/*hilbert_start_point*/,
+						0/*hilbert_end_point*/);
+
 				// Traverse the Hilbert curve of blocks of the source (base level) raster
 				// using quad-tree recursion.
 				// The leaf nodes of the traversal correspond to the blocks in the base level.
@@ -300,32 +547,48 @@ namespace GPlatesFileIO
 				// to a single mipmap pyramid file (the final output file) as they are generated
 				// because due to block-compression it is not known in advance the size of encoded
 				// data for each mipmap level.
-				hilbert_curve_traversal(
-						d_num_levels - 1/*level*/,
-						0/*x_offset*/,
-						0/*y_offset*/,
-						source_raster_dimension_next_power_of_two/*dimension*/,
-						0/*hilbert_start_point*/,
-						0/*hilbert_end_point*/,
-						temporary_mipmap_file_streams,
-						temporary_mipmap_byte_arrays,
-						temporary_mipmap_byte_streams,
-						mipmap_block_infos);
+				//
+				// The subtrees rooted at 'subtree_level' are independent of each other and so they are
+				// mipmapped in parallel by worker threads (into memory). This thread then appends each
+				// mipmapped subtree (in Hilbert curve order) to the temporary mipmap files and mipmaps
+				// the levels above the subtrees.
+				const unsigned int num_threads = GPlatesUtils::ParallelUtils::get_num_worker_threads();
+				const unsigned int subtree_level = get_subtree_level(num_threads);
+
+				std::vector<QuadTreeNode> subtree_nodes;
+				find_subtree_nodes(root_node, subtree_level, subtree_nodes);
+
+				if (d_progress_callback)
+				{
+					d_progress_callback(0, subtree_nodes.size());
+				}
 
-				// Flush the mipmap byte streams to their file streams if any data remaining in them.
-				for (level = 0; level < d_num_levels; ++level)
 				{
-					QDataStream &mipmap_file_stream = *temporary_mipmap_file_streams[level];
-					QByteArray &mipmap_byte_array = *temporary_mipmap_byte_arrays[level];
-					QDataStream &mipmap_byte_stream = *temporary_mipmap_byte_streams[level];
+					// NOTE: The worker threads are stopped (and joined) if an exception is thrown.
+					OrderedTaskPool<MipmappedSubtree> subtree_pool(
+							subtree_nodes.size(),
+							boost::bind(
+									&BaseMipmappedRasterFormatWriter::mipmap_subtree,
+									this,
+									boost::cref(subtree_nodes),
+									boost::placeholders::_1,
+									boost::ref(mipmap_block_infos)),
+							num_threads,
+							MAX_NUM_PENDING_SUBTREES_PER_THREAD * num_threads);
+
+					PyramidOutput pyramid_output(
+							subtree_level,
+							subtree_nodes,
+							subtree_pool,
+							temporary_mipmap_files,
+							d_progress_callback);
+					hilbert_curve_traversal(root_node, pyramid_output, mipmap_block_infos);
+				}
 
-					if (!mipmap_byte_array.isEmpty())
-					{
-						mipmap_file_stream.writeRawData(
-								mipmap_byte_array.constData(), mipmap_byte_array.size());
-						mipmap_byte_array.clear();
-						mipmap_byte_stream.device()->seek(0);
-					}
+				// Flush any encoded data still in memory to the temporary mipmap files.
+				for (level = 0; level < d_num_levels; ++level)
+				{
+					temporary_mipmap_files[level]->flush();
 				}
 
 				const qint64 level_info_pos = file.pos();
@@ -362,16 +625,22 @@ namespace GPlatesFileIO
 							// no-data value...
 							sizeof(quint32) + sizeof(mipmapped_element_type) +
 							// raster statistics...
-							5 * sizeof(quint32) + 4 * sizeof(double);
+							5 * sizeof(quint32) + 4 * sizeof(double) +
+							// byte order of the block data...
+							sizeof(quint32);
 
 					// We'll be writing the mipmap's block information to the output file along
 					// with the mipmap encoded data.
 					data_file_pos +=
 							level_info.num_blocks * RasterFileCacheFormat::BlockInfo::STREAM_SIZE;
 
+					// The encoded data is padded to start at an aligned file offset
+					// (the block offsets within the encoded data are already aligned).
+					data_file_pos += RasterFileCacheFormat::get_block_data_padding(data_file_pos);
+
 					// The temporary mipmap file contains the encoded mipmap data for the current level and
 					// that will also be written to the output file.
-					data_file_pos += temporary_mipmap_files[level]->size();
+					data_file_pos += temporary_mipmap_files[level]->flush().size();
 				}
 
 				// Predict the total size of the output file.
@@ -460,11 +729,19 @@ namespace GPlatesFileIO
 					out << raster_mean;
 					out << raster_standard_deviation;
 
-					// The file offset at which the current mipmap's encoded data will be written to.
-					const qint64 encoded_data_file_pos =
+					// Write the byte order of the encoded block data.
+					out << static_cast<quint32>(QSysInfo::ByteOrder);
+
+					// The file offset of the end of the current mipmap's block information.
+					const qint64 block_infos_end_file_pos =
 							file.pos() +
 							mipmap_blocks.get_num_blocks() * RasterFileCacheFormat::BlockInfo::STREAM_SIZE;
 
+					// The (aligned) file offset at which the current mipmap's encoded data will be written to.
+					const unsigned int num_encoded_data_padding_bytes =
+							RasterFileCacheFormat::get_block_data_padding(block_infos_end_file_pos);
+					const qint64 encoded_data_file_pos = block_infos_end_file_pos + num_encoded_data_padding_bytes;
+
 					// Write the current mipmap's block information to the output file.
 					const unsigned int num_blocks = mipmap_blocks.get_num_blocks();
 					for (unsigned int block_index = 0; block_index < num_blocks; ++block_index)
@@ -479,18 +756,16 @@ namespace GPlatesFileIO
 							block_info.coverage_offset += encoded_data_file_pos;
 						}
 
-						out << block_info.x_offset
-							<< block_info.y_offset
-							<< block_info.width
-							<< block_info.height
-							<< block_info.main_offset
-							<< block_info.coverage_offset;
+						RasterFileCacheFormat::write_block_info(out, block_info);
 					}
 
+					// Pad so that the encoded data starts at an aligned file offset.
+					RasterFileCacheFormat::write_padding(out, num_encoded_data_padding_bytes);
+
 					// Now write the mipmap's encoded data to the output file.
 					// We do this by copying the encoded data from the temporary mipmap file.
 					// The temporary file will get removed on scope exit.
-					write_temporary_mipmap_file_to_output(*temporary_mipmap_files[level], out);
+					write_temporary_mipmap_file_to_output(temporary_mipmap_files[level]->flush(), out);
 				}
 
 				// Make sure our predicted file size matches the actual file size.
@@ -543,15 +818,479 @@ namespace GPlatesFileIO
 			unsigned int d_source_raster_height;
 			unsigned int d_num_levels;
 
+			//! Reports progress of @a write.
+			progress_callback_type d_progress_callback;
+
+			//! Serialises reading of the source raster by worker threads.
+			boost::mutex d_source_raster_mutex;
+
 		private:
 
 			/**
-			 * When the number of bytes written to a mipmap byte stream (attached to QByteArray)
-			 * exceeds this threshold then we'll stream it to the mipmap file.
+			 * The subtrees mipmapped by worker threads are rooted no higher than this mipmap level.
 			 *
-			 * Doing this avoids an excessive number of disk file seeks (slowing things dramatically).
+			 * This limits the memory used by each subtree (since it's mipmapped in memory).
 			 */
-			static const unsigned int MIPMAP_BYTE_STREAM_SIZE_THRESHOLD = 8 * 1024 * 1024;
+			static const unsigned int MAX_SUBTREE_LEVEL = 2;
+
+			/**
+			 * The subtrees are only rooted at a higher mipmap level if there would still be at least
+			 * this many subtrees per thread (to keep all threads busy).
+			 */
+			static const unsigned int MIN_NUM_SUBTREES_PER_THREAD = 4;
+
+			/**
+			 * Worker threads can run ahead of the (in-order) writing of mipmapped subtrees by up to
+			 * this many subtrees per thread.
+			 */
+			static const unsigned int MAX_NUM_PENDING_SUBTREES_PER_THREAD = 2;
+
+
+			/**
+			 * A node in the quad tree traversal of the Hilbert curve of blocks.
+			 */
+			struct QuadTreeNode
+			{
+				QuadTreeNode(
+						unsigned int level_,
+						unsigned int x_offset_,
+						unsigned int y_offset_,
+						unsigned int dimension_,
+						unsigned int hilbert_start_point_,
+						unsigned int hilbert_end_point_) :
+					level(level_),
+					x_offset(x_offset_),
+					y_offset(y_offset_),
+					dimension(dimension_),
+					hilbert_start_point(hilbert_start_point_),
+					hilbert_end_point(hilbert_end_point_)
+				{  }
+
+				//! The mipmap level that the node is mipmapped to.
+				unsigned int level;
+
+				//! The region of the source raster covered by the node.
+				unsigned int x_offset;
+				unsigned int y_offset;
+				unsigned int dimension;
+
+				unsigned int hilbert_start_point;
+				unsigned int hilbert_end_point;
+			};
+
+
+			/**
+			 * The encoded mipmapped blocks of a subtree of the quad tree (mipmapped by a worker thread).
+			 */
+			struct MipmappedSubtree :
+					private boost::noncopyable
+			{
+				struct Level :
+						private boost::noncopyable
+				{
+					Level() :
+						stream(&encoded_data, QIODevice::WriteOnly)
+					{
+						// Use the same Qt data stream version as the final output file/stream.
+						stream.setVersion(RasterFileCacheFormat::Q_DATA_STREAM_VERSION);
+					}
+
+					QByteArray encoded_data;
+					QDataStream stream;
+
+					//! Block offsets are relative to the start of the encoded data (until it's written to file).
+					std::vector<RasterFileCacheFormat::BlockInfo *> block_infos;
+				};
+
+				explicit
+				MipmappedSubtree(
+						unsigned int num_levels)
+				{
+					for (unsigned int level = 0; level < num_levels; ++level)
+					{
+						levels.push_back(boost::shared_ptr<Level>(new Level()));
+					}
+				}
+
+				//! The mipmapper of the root node of the subtree.
+				boost::shared_ptr<mipmapper_type> mipmapper;
+
+				std::vector<boost::shared_ptr<Level> > levels;
+			};
+
+
+			/**
+			 * Where the quad tree traversal writes the encoded data of mipmapped blocks.
+			 */
+			class MipmapOutput
+			{
+			public:
+				virtual
+				~MipmapOutput()
+				{  }
+
+				/**
+				 * Returns the mipmapper of @a node if it was mipmapped elsewhere (in which case the node
+				 * is not traversed), otherwise returns boost::none.
+				 */
+				virtual
+				boost::optional<boost::shared_ptr<mipmapper_type> >
+				get_mipmapped_node(
+						const QuadTreeNode &node)
+				{
+					return boost::none;
+				}
+
+				//! The stream that the next block of the specified level is written to.
+				virtual
+				QDataStream &
+				get_stream(
+						unsigned int level) = 0;
+
+				//! The position of @a get_stream relative to an offset aligned to BLOCK_DATA_ALIGNMENT.
+				virtual
+				quint64
+				get_position(
+						unsigned int level) = 0;
+
+				//! Called after a block of the specified level has been written.
+				virtual
+				void
+				block_written(
+						unsigned int level,
+						RasterFileCacheFormat::BlockInfo &block_info) = 0;
+			};
+
+
+			/**
+			 * Writes the mipmapped blocks of a subtree into memory (used by worker threads).
+			 */
+			class SubtreeOutput :
+					public MipmapOutput
+			{
+			public:
+				explicit
+				SubtreeOutput(
+						MipmappedSubtree &subtree) :
+					d_subtree(subtree)
+				{  }
+
+				virtual
+				QDataStream &
+				get_stream(
+						unsigned int level)
+				{
+					return d_subtree.levels[level]->stream;
+				}
+
+				virtual
+				quint64
+				get_position(
+						unsigned int level)
+				{
+					return d_subtree.levels[level]->encoded_data.size();
+				}
+
+				virtual
+				void
+				block_written(
+						unsigned int level,
+						RasterFileCacheFormat::BlockInfo &block_info)
+				{
+					d_subtree.levels[level]->block_infos.push_back(&block_info);
+				}
+
+			private:
+				MipmappedSubtree &d_subtree;
+			};
+
+
+			/**
+			 * Writes mipmapped blocks to the temporary mipmap files.
+			 *
+			 * The subtrees mipmapped by worker threads are appended (in order) when the traversal
+			 * reaches them, and the levels above them are written as they are mipmapped.
+			 */
+			class PyramidOutput :
+					public MipmapOutput
+			{
+			public:
+				PyramidOutput(
+						unsigned int subtree_level,
+						const std::vector<QuadTreeNode> &subtree_nodes,
+						OrderedTaskPool<MipmappedSubtree> &subtree_pool,
+						const std::vector<boost::shared_ptr<TemporaryMipmapLevelFile> > &temporary_mipmap_files,
+						const progress_callback_type &progress_callback) :
+					d_subtree_level(subtree_level),
+					d_subtree_nodes(subtree_nodes),
+					d_subtree_pool(subtree_pool),
+					d_temporary_mipmap_files(temporary_mipmap_files),
+					d_progress_callback(progress_callback),
+					d_num_subtrees_written(0)
+				{  }
+
+				virtual
+				boost::optional<boost::shared_ptr<mipmapper_type> >
+				get_mipmapped_node(
+						const QuadTreeNode &node)
+				{
+					if (node.level != d_subtree_level)
+					{
+						return boost::none;
+					}
+
+					// The subtrees are mipmapped in the same order that they are traversed.
+					GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+							d_num_subtrees_written < d_subtree_nodes.size() &&
+								d_subtree_nodes[d_num_subtrees_written].x_offset == node.x_offset &&
+								d_subtree_nodes[d_num_subtrees_written].y_offset == node.y_offset,
+							GPLATES_ASSERTION_SOURCE);
+
+					// Wait for the subtree to be mipmapped (if it hasn't been already).
+					const boost::shared_ptr<MipmappedSubtree> subtree = d_subtree_pool.wait_for_next_result();
+
+					// Append the encoded data of each level of the subtree to the temporary mipmap files
+					// and convert the block offsets (relative to the encoded data) to file offsets.
+					for (unsigned int level = 0; level < subtree->levels.size(); ++level)
+					{
+						const typename MipmappedSubtree::Level &subtree_level = *subtree->levels[level];
+						if (subtree_level.block_infos.empty())
+						{
+							continue;
+						}
+
+						const quint64 encoded_data_file_offset =
+								d_temporary_mipmap_files[level]->append(subtree_level.encoded_data);
+
+						BOOST_FOREACH(RasterFileCacheFormat::BlockInfo *block_info, subtree_level.block_infos)
+						{
+							block_info->main_offset += encoded_data_file_offset;
+							if (block_info->coverage_offset != 0)
+							{
+								block_info->coverage_offset += encoded_data_file_offset;
+							}
+						}
+					}
+
+					++d_num_subtrees_written;
+					if (d_progress_callback)
+					{
+						d_progress_callback(d_num_subtrees_written, d_subtree_nodes.size());
+					}
+
+					return subtree->mipmapper;
+				}
+
+				virtual
+				QDataStream &
+				get_stream(
+						unsigned int level)
+				{
+					return d_temporary_mipmap_files[level]->get_stream();
+				}
+
+				virtual
+				quint64
+				get_position(
+						unsigned int level)
+				{
+					return d_temporary_mipmap_files[level]->get_position();
+				}
+
+				virtual
+				void
+				block_written(
+						unsigned int level,
+						RasterFileCacheFormat::BlockInfo &block_info)
+				{
+					d_temporary_mipmap_files[level]->flush_if_full();
+				}
+
+			private:
+				unsigned int d_subtree_level;
+				const std::vector<QuadTreeNode> &d_subtree_nodes;
+				OrderedTaskPool<MipmappedSubtree> &d_subtree_pool;
+				const std::vector<boost::shared_ptr<TemporaryMipmapLevelFile> > &d_temporary_mipmap_files;
+				const progress_callback_type &d_progress_callback;
+				unsigned int d_num_subtrees_written;
+			};
+
+
+			/**
+			 * Returns the mipmap level at which the quad tree is split into subtrees that are
+			 * mipmapped in parallel.
+			 */
+			unsigned int
+			get_subtree_level(
+					unsigned int num_threads) const
+			{
+				unsigned int subtree_level = 0;
+				while (subtree_level + 1 < d_num_levels &&
+					subtree_level < MAX_SUBTREE_LEVEL)
+				{
+					// The number of subtrees (that overlap the source raster) one level up.
+					// Each node at level 'L' covers a source region of dimension '2 * BLOCK_SIZE * 2^L'.
+					const unsigned int dimension = (2 * RasterFileCacheFormat::BLOCK_SIZE) << (subtree_level + 1);
+					const unsigned int num_subtrees =
+							((d_source_raster_width + dimension - 1) / dimension) *
+							((d_source_raster_height + dimension - 1) / dimension);
+					if (num_subtrees < MIN_NUM_SUBTREES_PER_THREAD * num_threads)
+					{
+						break;
+					}
+
+					++subtree_level;
+				}
+
+				return subtree_level;
+			}
+
+
+			/**
+			 * Returns the child of @a node at the specified position (0 to 3) along the Hilbert curve,
+			 * and the child's z-order x/y indices (0 or 1) within @a node.
+			 */
+			static
+			QuadTreeNode
+			get_hilbert_child_node(
+					const QuadTreeNode &node,
+					unsigned int hilbert_child_index,
+					unsigned int &child_x_zorder,
+					unsigned int &child_y_zorder)
+			{
+				unsigned int child_hilbert_start_point;
+				unsigned int child_hilbert_end_point;
+				switch (hilbert_child_index)
+				{
+				case 0:
+					child_x_zorder = node.hilbert_start_point;
+					child_y_zorder = node.hilbert_start_point;
+					child_hilbert_start_point = node.hilbert_start_point;
+					child_hilbert_end_point = 1 - node.hilbert_end_point;
+					break;
+
+				case 1:
+					child_x_zorder = node.hilbert_end_point;
+					child_y_zorder = 1 - node.hilbert_end_point;
+					child_hilbert_start_point = node.hilbert_start_point;
+					child_hilbert_end_point = node.hilbert_end_point;
+					break;
+
+				case 2:
+					child_x_zorder = 1 - node.hilbert_start_point;
+					child_y_zorder = 1 - node.hilbert_start_point;
+					child_hilbert_start_point = node.hilbert_start_point;
+					child_hilbert_end_point = node.hilbert_end_point;
+					break;
+
+				default:
+					child_x_zorder = 1 - node.hilbert_end_point;
+					child_y_zorder = node.hilbert_end_point;
+					child_hilbert_start_point = 1 - node.hilbert_start_point;
+					child_hilbert_end_point = node.hilbert_end_point;
+					break;
+				}
+
+				const unsigned int child_dimension = (node.dimension >> 1);
+
+				return QuadTreeNode(
+						node.level - 1,
+						node.x_offset + child_x_zorder * child_dimension,
+						node.y_offset + child_y_zorder * child_dimension,
+						child_dimension,
+						child_hilbert_start_point,
+						child_hilbert_end_point);
+			}
+
+
+			/**
+			 * Returns true if the region covered by @a node is outside the source raster.
+			 *
+			 * This can happen because the Hilbert traversal operates on power-of-two dimensions
+			 * which encompass the source raster (leaving regions that contain no source raster data).
+			 */
+			bool
+			is_outside_source_raster(
+					const QuadTreeNode &node) const
+			{
+				return node.x_offset >= d_source_raster_width || node.y_offset >= d_source_raster_height;
+			}
+
+
+			/**
+			 * Finds the nodes at @a subtree_level (that overlap the source raster) in Hilbert curve order.
+			 */
+			void
+			find_subtree_nodes(
+					const QuadTreeNode &node,
+					unsigned int subtree_level,
+					std::vector<QuadTreeNode> &subtree_nodes) const
+			{
+				if (is_outside_source_raster(node))
+				{
+					return;
+				}
+
+				if (node.level == subtree_level)
+				{
+					subtree_nodes.push_back(node);
+					return;
+				}
+
+				for (unsigned int hilbert_child_index = 0; hilbert_child_index < 4; ++hilbert_child_index)
+				{
+					unsigned int child_x_zorder;
+					unsigned int child_y_zorder;
+					find_subtree_nodes(
+							get_hilbert_child_node(node, hilbert_child_index, child_x_zorder, child_y_zorder),
+							subtree_level,
+							subtree_nodes);
+				}
+			}
+
+
+			/**
+			 * Mipmaps the subtree rooted at the specified subtree node into memory.
+			 *
+			 * NOTE: This is called by worker threads.
+			 * Each subtree writes to different blocks in @a mipmap_block_infos.
+			 */
+			boost::shared_ptr<MipmappedSubtree>
+			mipmap_subtree(
+					const std::vector<QuadTreeNode> &subtree_nodes,
+					unsigned int subtree_index,
+					std::vector<RasterFileCacheFormat::BlockInfos> &mipmap_block_infos)
+			{
+				const QuadTreeNode &subtree_node = subtree_nodes[subtree_index];
+
+				boost::shared_ptr<MipmappedSubtree> subtree(new MipmappedSubtree(subtree_node.level + 1));
+				SubtreeOutput subtree_output(*subtree);
+
+				const boost::optional<boost::shared_ptr<mipmapper_type> > mipmapper =
+						hilbert_curve_traversal(subtree_node, subtree_output, mipmap_block_infos);
+
+				// Subtree nodes only exist where they overlap the source raster.
+				GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+						mipmapper,
+						GPLATES_ASSERTION_SOURCE);
+				subtree->mipmapper = mipmapper.get();
+
+				return subtree;
+			}
+
+
+			static
+			boost::optional<const mipmapper_type &>
+			get_child_mipmapper(
+					const boost::optional<boost::shared_ptr<mipmapper_type> > &child_mipmapper)
+			{
+				if (!child_mipmapper)
+				{
+					return boost::none;
+				}
+
+				return boost::optional<const mipmapper_type &>(*child_mipmapper.get());
+			}
 
 
 			/**
@@ -561,190 +1300,97 @@ namespace GPlatesFileIO
 			 * The leaf nodes of the traversal correspond to the blocks in the base level.
 			 * As we traverse back towards the root of the quad tree we perform mipmapping.
 			 * Each mipmap will have its own Hilbert curve (appropriate for its mipmap level)
-			 * and will temporarily write to its own mipmap file (stream) and record its own
+			 * and will write to its own mipmap stream in @a output and record its own
 			 * block informations.
 			 */
 			boost::optional<boost::shared_ptr<mipmapper_type> >
 			hilbert_curve_traversal(
-					unsigned int level,
-					unsigned int x_offset,
-					unsigned int y_offset,
-					unsigned int dimension,
-					unsigned int hilbert_start_point,
-					unsigned int hilbert_end_point,
-					const std::vector<boost::shared_ptr<QDataStream> > &temporary_mipmap_file_streams,
-					const std::vector<boost::shared_ptr<QByteArray> > &temporary_mipmap_byte_arrays,
-					const std::vector<boost::shared_ptr<QDataStream> > &temporary_mipmap_byte_streams,
+					const QuadTreeNode &node,
+					MipmapOutput &output,
 					std::vector<RasterFileCacheFormat::BlockInfos> &mipmap_block_infos)
 			{
-				// See if the current quad-tree region is outside the source raster.
-				// This can happen because the Hilbert traversal operates on power-of-two dimensions
-				// which encompass the source raster (leaving regions that contain no source raster data).
-				if (x_offset >= d_source_raster_width || y_offset >= d_source_raster_height)
+				if (is_outside_source_raster(node))
 				{
 					return boost::none;
 				}
 
+				// See if the current node has already been mipmapped (by a worker thread).
+				const boost::optional<boost::shared_ptr<mipmapper_type> > mipmapped_node =
+						output.get_mipmapped_node(node);
+				if (mipmapped_node)
+				{
+					return mipmapped_node;
+				}
+
+				boost::shared_ptr<mipmapper_type> mipmapper;
+
 				// For the highest-resolution mipmap level (not the full-resolution base level)
 				// we need to get data from the source raster.
-				if (level == 0)
+				if (node.level == 0)
 				{
 					// The source raster region should be twice the size of the mipmapped region.
 					// The later is the size of a single block.
 					GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
-							dimension == 2 * RasterFileCacheFormat::BLOCK_SIZE,
+							node.dimension == 2 * RasterFileCacheFormat::BLOCK_SIZE,
 							GPLATES_ASSERTION_SOURCE);
 
 					// Get the source raster data from the region we need for mipmapping the current
 					// quad tree region.
-					boost::shared_ptr<mipmapper_type> mipmapper = get_source_raster_data(x_offset, y_offset);
-
-					// Get the current block in the current mipmap based on the block x/y offsets.
-					RasterFileCacheFormat::BlockInfo &block_info =
-							mipmap_block_infos[level].get_block_info(
-									x_offset / dimension,
-									y_offset / dimension);
-
-					// Mipmap the source raster region.
-					mipmap(
-							*mipmapper,
-							*temporary_mipmap_file_streams[level],
-							*temporary_mipmap_byte_arrays[level],
-							*temporary_mipmap_byte_streams[level],
-							block_info,
-							// Level 0 is half the resolution of the full-resolution source raster...
-							x_offset >> 1,
-							y_offset >> 1);
-
-					// Return the mipmapper so the second mipmap level (parent of this quad-tree
-					// recursion) can use the mipmapped data for further mipmapping.
-					return mipmapper;
+					mipmapper = get_source_raster_data(node.x_offset, node.y_offset);
 				}
-
-				const unsigned int child_level = level - 1;
-				const unsigned int child_dimension = (dimension >> 1);
-
-				// References to the (up to) four child mipmapped regions.
-				// The Hilbert curve traverses the child nodes in an order that changes
-				// (unlike the fixed z-order traversal) and so we need to map back to a z-order
-				// traversal before we can join the child mipmaps and perform further mipmapping.
-				boost::optional<const mipmapper_type &> child_mipmappers_zorder[2][2];
-
-				const unsigned int child_x_offset_hilbert0 = hilbert_start_point;
-				const unsigned int child_y_offset_hilbert0 = hilbert_start_point;
-				const boost::optional<boost::shared_ptr<mipmapper_type> > child_mipmapper_hilbert0 =
-						hilbert_curve_traversal(
-								child_level,
-								x_offset + child_x_offset_hilbert0 * child_dimension,
-								y_offset + child_y_offset_hilbert0 * child_dimension,
-								child_dimension,
-								hilbert_start_point,
-								1 - hilbert_end_point,
-								temporary_mipmap_file_streams,
-								temporary_mipmap_byte_arrays,
-								temporary_mipmap_byte_streams,
-								mipmap_block_infos);
-				if (child_mipmapper_hilbert0)
+				else
 				{
-					// Map Hilbert traversal to z-order traversal.
-					child_mipmappers_zorder[child_y_offset_hilbert0][child_x_offset_hilbert0] =
-							*child_mipmapper_hilbert0.get();
-				}
+					// References to the (up to) four child mipmapped regions.
+					// The Hilbert curve traverses the child nodes in an order that changes
+					// (unlike the fixed z-order traversal) and so we need to map back to a z-order
+					// traversal before we can join the child mipmaps and perform further mipmapping.
+					boost::optional<boost::shared_ptr<mipmapper_type> > child_mipmappers_zorder[2][2];
 
-				const unsigned int child_x_offset_hilbert1 = hilbert_end_point;
-				const unsigned int child_y_offset_hilbert1 = 1 - hilbert_end_point;
-				const boost::optional<boost::shared_ptr<mipmapper_type> > child_mipmapper_hilbert1 =
-						hilbert_curve_traversal(
-								child_level,
-								x_offset + child_x_offset_hilbert1 * child_dimension,
-								y_offset + child_y_offset_hilbert1 * child_dimension,
-								child_dimension,
-								hilbert_start_point,
-								hilbert_end_point,
-								temporary_mipmap_file_streams,
-								temporary_mipmap_byte_arrays,
-								temporary_mipmap_byte_streams,
-								mipmap_block_infos);
-				if (child_mipmapper_hilbert1)
-				{
-					// Map Hilbert traversal to z-order traversal.
-					child_mipmappers_zorder[child_y_offset_hilbert1][child_x_offset_hilbert1] =
-							*child_mipmapper_hilbert1.get();
-				}
+					for (unsigned int hilbert_child_index = 0; hilbert_child_index < 4; ++hilbert_child_index)
+					{
+						unsigned int child_x_zorder;
+						unsigned int child_y_zorder;
+						const QuadTreeNode child_node =
+								get_hilbert_child_node(node, hilbert_child_index, child_x_zorder, child_y_zorder);
+
+						// Map Hilbert traversal to z-order traversal.
+						child_mipmappers_zorder[child_y_zorder][child_x_zorder] =
+								hilbert_curve_traversal(child_node, output, mipmap_block_infos);
+					}
 
-				const unsigned int child_x_offset_hilbert2 = 1 - hilbert_start_point;
-				const unsigned int child_y_offset_hilbert2 = 1 - hilbert_start_point;
-				const boost::optional<boost::shared_ptr<mipmapper_type> > child_mipmapper_hilbert2 =
-						hilbert_curve_traversal(
-								child_level,
-								x_offset + child_x_offset_hilbert2 * child_dimension,
-								y_offset + child_y_offset_hilbert2 * child_dimension,
-								child_dimension,
-								hilbert_start_point,
-								hilbert_end_point,
-								temporary_mipmap_file_streams,
-								temporary_mipmap_byte_arrays,
-								temporary_mipmap_byte_streams,
-								mipmap_block_infos);
-				if (child_mipmapper_hilbert2)
-				{
-					// Map Hilbert traversal to z-order traversal.
-					child_mipmappers_zorder[child_y_offset_hilbert2][child_x_offset_hilbert2] =
-							*child_mipmapper_hilbert2.get();
-				}
+					// We shouldn't be able to get here unless the child mipmap (at z-order child x/y
+					// indices 0/0) contains data (ie, is not outside the entire source raster).
+					GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+							child_mipmappers_zorder[0][0],
+							GPLATES_ASSERTION_SOURCE);
 
-				const unsigned int child_x_offset_hilbert3 = 1 - hilbert_end_point;
-				const unsigned int child_y_offset_hilbert3 = hilbert_end_point;
-				const boost::optional<boost::shared_ptr<mipmapper_type> > child_mipmapper_hilbert3 =
-						hilbert_curve_traversal(
-								child_level,
-								x_offset + child_x_offset_hilbert3 * child_dimension,
-								y_offset + child_y_offset_hilbert3 * child_dimension,
-								child_dimension,
-								1 - hilbert_start_point,
-								hilbert_end_point,
-								temporary_mipmap_file_streams,
-								temporary_mipmap_byte_arrays,
-								temporary_mipmap_byte_streams,
-								mipmap_block_infos);
-				if (child_mipmapper_hilbert3)
-				{
-					// Map Hilbert traversal to z-order traversal.
-					child_mipmappers_zorder[child_y_offset_hilbert3][child_x_offset_hilbert3] =
-							*child_mipmapper_hilbert3.get();
+					// Join the four child mipmappers into one mipmapper.
+					mipmapper.reset(
+							new mipmapper_type(
+									*child_mipmappers_zorder[0][0].get(),
+									get_child_mipmapper(child_mipmappers_zorder[0][1]),
+									get_child_mipmapper(child_mipmappers_zorder[1][0]),
+									get_child_mipmapper(child_mipmappers_zorder[1][1])));
 				}
 
-				// We shouldn't be able to get here unless the child mipmap (at z-order child x/y
-				// indices 0/0) contains data (ie, is not outside the entire source raster).
-				GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
-						child_mipmappers_zorder[0][0],
-						GPLATES_ASSERTION_SOURCE);
-
-				// Join the four child mipmappers into one mipmapper.
-				boost::shared_ptr<mipmapper_type> mipmapper(
-						new mipmapper_type(
-								child_mipmappers_zorder[0][0].get(),
-								child_mipmappers_zorder[0][1],
-								child_mipmappers_zorder[1][0],
-								child_mipmappers_zorder[1][1]));
-
 				// Get the current block in the current mipmap based on the block x/y offsets.
 				RasterFileCacheFormat::BlockInfo &block_info =
-						mipmap_block_infos[level].get_block_info(
-								x_offset / dimension,
-								y_offset / dimension);
+						mipmap_block_infos[node.level].get_block_info(
+								node.x_offset / node.dimension,
+								node.y_offset / node.dimension);
 
-				// Mipmap the joined child regions.
+				// Mipmap the source region or joined child regions.
 				mipmap(
 						*mipmapper,
-						*temporary_mipmap_file_streams[level],
-						*temporary_mipmap_byte_arrays[level],
-						*temporary_mipmap_byte_streams[level],
+						output.get_stream(node.level),
+						output.get_position(node.level),
 						block_info,
 						// Level 0 is half the resolution of the full-resolution source raster.
 						// The other levels scale resolution as 1 / 2^(level+1) ...
-						x_offset >> (level + 1),
-						y_offset >> (level + 1));
+						node.x_offset >> (node.level + 1),
+						node.y_offset >> (node.level + 1));
+
+				output.block_written(node.level, block_info);
 
 				// Return the mipmapper so the next mipmap level (parent of this quad-tree
 				// recursion) can use the mipmapped data for further mipmapping.
@@ -758,6 +1404,8 @@ namespace GPlatesFileIO
 			 * mipmap data for a region of size BLOCK_SIZE x BLOCK_SIZE (or less).
 			 *
 			 * The returned mipmapper contains the source region data and is ready for mipmapping.
+			 *
+			 * NOTE: This is called by worker threads.
 			 */
 			boost::shared_ptr<mipmapper_type>
 			get_source_raster_data(
@@ -766,6 +1414,10 @@ namespace GPlatesFileIO
 			{
 				const unsigned int dimension = 2 * RasterFileCacheFormat::BLOCK_SIZE;
 
+				// The source raster band reader (and any colour palette used by the derived class)
+				// are not thread-safe so only one worker thread can read a source region at a time.
+				boost::mutex::scoped_lock source_raster_lock(d_source_raster_mutex);
+
 				// If we are near the right or bottom edge of the source raster then we can
 				// get partially covered blocks so ensure the source region is valid.
 				const unsigned int source_region_width =
@@ -781,10 +1433,8 @@ namespace GPlatesFileIO
 				const QRect source_region_rect(x_offset, y_offset, source_region_width, source_region_height);
 
 				// Get the region data from the source raster.
-				PROFILE_BEGIN(profile_get_src_data, "get source region data");
 				boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type> source_region_raw_raster =
 						d_source_raster_band_reader_handle.get_raw_raster(source_region_rect);
-				PROFILE_END(profile_get_src_data);
 				if (!source_region_raw_raster)
 				{
 					throw GPlatesGlobal::LogException(
@@ -815,21 +1465,23 @@ namespace GPlatesFileIO
 
 
 			/**
-			 * Mipmap source data (either from source raster or parent mipmap level) and
+			 * Mipmap source data (either from source raster or child mipmap level) and
 			 * write data to the specified mipmap stream and record stream offsets in block info.
+			 *
+			 * @a mipmap_stream_position is the current position of @a mipmap_stream relative to
+			 * an offset aligned to RasterFileCacheFormat::BLOCK_DATA_ALIGNMENT.
+			 *
+			 * NOTE: This is called by worker threads.
 			 */
 			void
 			mipmap(
 					mipmapper_type &mipmapper,
-					QDataStream &mipmap_file_stream,
-					QByteArray &mipmap_byte_array,
-					QDataStream &mipmap_byte_stream,
+					QDataStream &mipmap_stream,
+					quint64 mipmap_stream_position,
 					RasterFileCacheFormat::BlockInfo &mipmap_block_info,
 					unsigned int mipmap_x_offset,
 					unsigned int mipmap_y_offset)
 			{
-				PROFILE_FUNC();
-
 				// Perform the mipmapping.
 				mipmapper.generate_next();
 
@@ -850,18 +1502,19 @@ namespace GPlatesFileIO
 							mipmap_block_info.height <= RasterFileCacheFormat::BLOCK_SIZE,
 						GPLATES_ASSERTION_SOURCE);
 
-				// Record the file offset of the current block of data.
-				// The offset is the current file offset plus any unwritten data.
-				mipmap_block_info.main_offset =
-						mipmap_file_stream.device()->pos() + mipmap_byte_array.size();
-
-				// Write current main mipmap to the byte stream.
-				// We do this instead of writing to the file in order to avoid constantly
-				// doing file seeks which slow things down dramatically.
-				MipmappedRasterFormatWriterInternals::write<mipmapped_element_type>(
-						mipmap_byte_stream,
+				// Write current main mipmap to the stream and record the offset of the current block
+				// of data (the current position plus any alignment padding).
+				//
+				// NOTE: The data is written in the native byte order, which is *much* faster than
+				// writing each element with the output operator '<<'.
+				mipmap_block_info.main_offset = RasterFileCacheFormat::write_block_data(
+						mipmap_stream,
+						mipmap_stream_position,
 						current_mipmap->data(),
-						current_mipmap->width() * current_mipmap->height());
+						current_mipmap->width() * current_mipmap->height() * sizeof(mipmapped_element_type),
+						RasterFileCacheFormat::MAIN_BLOCK_COMPRESSION,
+						mipmap_block_info.main_size,
+						mipmap_block_info.main_compression);
 
 				// Get and write the associated coverage raster if required.
 				boost::optional<coverage_raster_type::non_null_ptr_to_const_type> current_coverage =
@@ -873,30 +1526,23 @@ namespace GPlatesFileIO
 								current_coverage.get()->height() == current_mipmap->height(),
 							GPLATES_ASSERTION_SOURCE);
 
-					// Record the file offset of the current block of coverage data.
-					// The offset is the current file offset plus any unwritten data.
-					mipmap_block_info.coverage_offset =
-							mipmap_file_stream.device()->pos() + mipmap_byte_array.size();
-
-					// Write the current coverage mipmap to the byte stream.
-					// We do this instead of writing to the file in order to avoid constantly
-					// doing file seeks which slow things down dramatically.
-					MipmappedRasterFormatWriterInternals::write<coverage_element_type>(
-							mipmap_byte_stream,
+					// Write the current coverage mipmap to the stream (after the main data) and record
+					// the offset of the current block of coverage data.
+					mipmap_block_info.coverage_offset = RasterFileCacheFormat::write_block_data(
+							mipmap_stream,
+							mipmap_block_info.main_offset + mipmap_block_info.main_size,
 							current_coverage.get()->data(),
-							current_coverage.get()->width() * current_coverage.get()->height());
+							current_coverage.get()->width() * current_coverage.get()->height() *
+									sizeof(coverage_element_type),
+							RasterFileCacheFormat::COVERAGE_BLOCK_COMPRESSION,
+							mipmap_block_info.coverage_size,
+							mipmap_block_info.coverage_compression);
 				}
 				else
 				{
 					mipmap_block_info.coverage_offset = 0;
-				}
-
-				// Flush the mipmap byte stream to the file stream if enough data has accumulated.
-				if (mipmap_byte_array.size() >= int(MIPMAP_BYTE_STREAM_SIZE_THRESHOLD))
-				{
-					mipmap_file_stream.writeRawData(mipmap_byte_array.constData(), mipmap_byte_array.size());
-					mipmap_byte_array.clear();
-					mipmap_byte_stream.device()->seek(0);
+					mipmap_block_info.coverage_size = 0;
+					mipmap_block_info.coverage_compression = RasterFileCacheFormat::BLOCK_UNCOMPRESSED;
 				}
 			}
 
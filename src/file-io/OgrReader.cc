@@ -28,7 +28,12 @@
  */
 
 #include <fstream>
+#include <stdexcept>
+#include <string>
+#include <boost/foreach.hpp>
+#include <boost/noncopyable.hpp>
 #include <boost/optional.hpp>
+#include <boost/utility/in_place_factory.hpp>
 #include <QDebug>
 #include <QMessageBox>
 #include <QString>
@@ -49,6 +54,9 @@
 #include "feature-visitors/PropertyValueFinder.h" 
 #include "feature-visitors/ShapefileAttributeFinder.h"
 
+#include "global/AssertionFailureException.h"
+#include "global/GPlatesAssert.h"
+
 #include "model/ChangesetHandle.h"
 #include "model/Gpgim.h"
 #include "model/GpgimFeatureClass.h"
@@ -77,6 +85,7 @@
 #include "maths/PolylineOnSphere.h"
 #include "maths/PolygonOnSphere.h"
 
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 #include "utils/UnicodeStringUtils.h"
 
@@ -159,17 +168,14 @@ namespace
 
 
 	/**
-	 * Creates a gml line string from @a list_of_points and adds this to @a feature.
+	 * Creates a gml line string from @a polyline and adds this to @a feature.
 	 */
 	void
 	add_polyline_geometry_to_feature(
 		const GPlatesModel::FeatureHandle::weak_ref &feature,
-		const std::vector<GPlatesMaths::PointOnSphere> &list_of_points,
+		const GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type &polyline,
 		const boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> &property)
 	{
-		GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type polyline =
-			GPlatesMaths::PolylineOnSphere::create(list_of_points);
-
 		GPlatesPropertyValues::GmlLineString::non_null_ptr_type gml_line_string =
 			GPlatesPropertyValues::GmlLineString::create(polyline);
 
@@ -196,18 +202,14 @@ namespace
 	}
 
 	/**
-	 * Creates a gml polygon from @a list_of_points and adds this to @a feature.
+	 * Creates a gml polygon from @a polygon and adds this to @a feature.
 	 */
 	void
 	add_polygon_geometry_to_feature(		
 		const GPlatesModel::FeatureHandle::weak_ref &feature,
-		const std::vector<GPlatesMaths::PointOnSphere> &exterior_ring,
-		const std::list< std::vector<GPlatesMaths::PointOnSphere> > &interior_rings,
+		const GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type &polygon,
 		const boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> &property)
 	{
-		GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type polygon =
-			GPlatesMaths::PolygonOnSphere::create(exterior_ring, interior_rings);
-
 		GPlatesPropertyValues::GmlPolygon::non_null_ptr_type gml_polygon =
 			GPlatesPropertyValues::GmlPolygon::create(polygon);
 
@@ -929,6 +931,586 @@ namespace
 }
 
 
+namespace
+{
+	/**
+	 * The number of OGR features read (and converted in parallel) at a time.
+	 */
+	const unsigned int OGR_FEATURE_BATCH_SIZE = 4096;
+
+
+	/**
+	 * Returns the number of points in the exterior and interior rings of @a polygon.
+	 */
+	unsigned int
+	get_num_polygon_points(
+			OGRPolygon *polygon)
+	{
+		unsigned int num_points = 0;
+
+		const OGRLinearRing *exterior_ring = polygon->getExteriorRing();
+		if (exterior_ring)
+		{
+			num_points += exterior_ring->getNumPoints();
+		}
+
+		const int num_interior_rings = polygon->getNumInteriorRings();
+		for (int n = 0; n < num_interior_rings; ++n)
+		{
+			const OGRLinearRing *interior_ring = polygon->getInteriorRing(n);
+			if (interior_ring)
+			{
+				num_points += interior_ring->getNumPoints();
+			}
+		}
+
+		return num_points;
+	}
+
+
+	/**
+	 * Destroys (and clears) a batch of OGR features when it goes out of scope.
+	 */
+	class OgrFeatureBatchDestroyer :
+			private boost::noncopyable
+	{
+	public:
+		explicit
+		OgrFeatureBatchDestroyer(
+				std::vector<OGRFeature *> &ogr_features) :
+			d_ogr_features(ogr_features)
+		{  }
+
+		~OgrFeatureBatchDestroyer()
+		{
+			BOOST_FOREACH(OGRFeature *ogr_feature, d_ogr_features)
+			{
+				OGRFeature::DestroyFeature(ogr_feature);
+			}
+			d_ogr_features.clear();
+		}
+
+	private:
+		std::vector<OGRFeature *> &d_ogr_features;
+	};
+}
+
+
+/**
+ * A geometry point of an OGR feature, transformed to WGS84 and converted to a point on the sphere.
+ */
+struct GPlatesFileIO::OgrReader::ConvertedPoint
+{
+	enum Status
+	{
+		VALID,
+		TRANSFORM_FAILED,
+		NO_LONGITUDE_DATA,
+		NO_LATITUDE_DATA,
+		INVALID_LATITUDE,
+		INVALID_LONGITUDE
+	};
+
+	ConvertedPoint(
+			double x_,
+			double y_) :
+		x(x_),
+		y(y_),
+		status(VALID)
+	{  }
+
+	//! Longitude and latitude (after transformation).
+	double x;
+	double y;
+
+	Status status;
+
+	//! Only valid if @a status is VALID.
+	boost::optional<GPlatesMaths::PointOnSphere> point;
+};
+
+
+/**
+ * A geometry of an OGR feature created from its converted points.
+ *
+ * At most one of the geometries is set (depending on the OGR geometry type). None are set if the
+ * geometry has invalid points (or too few points), or if it could not be created (see @a error).
+ */
+struct GPlatesFileIO::OgrReader::ConvertedGeometry
+{
+	boost::optional<GPlatesMaths::MultiPointOnSphere::non_null_ptr_to_const_type> multi_point;
+	boost::optional<GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type> polyline;
+	boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> polygon;
+
+	//! Why the geometry could not be created (if its creation threw an exception).
+	boost::optional<std::string> error;
+
+	/**
+	 * The points of a polyline, or the exterior and interior rings of a polygon, that failed validation.
+	 *
+	 * Creating these geometries throws an exception (describing why the points are invalid).
+	 * Invalid points are common in real files (eg, antipodal adjacent points), so they're created
+	 * by 'get_converted_geometry()' on the calling thread (to report the error) rather than
+	 * throwing on a worker thread.
+	 */
+	boost::optional< std::vector<GPlatesMaths::PointOnSphere> > invalid_polyline_points;
+	boost::optional< std::vector<GPlatesMaths::PointOnSphere> > invalid_polygon_exterior_ring;
+	std::list< std::vector<GPlatesMaths::PointOnSphere> > invalid_polygon_interior_rings;
+};
+
+
+/**
+ * The attributes, geometry points and geometries of an OGR feature.
+ */
+struct GPlatesFileIO::OgrReader::ConvertedFeature
+{
+	std::vector<QVariant> attributes;
+
+	//! The attributes as a "gpml:shapefileAttributes" dictionary (none if there are no attributes).
+	boost::optional<GPlatesPropertyValues::GpmlKeyValueDictionary::non_null_ptr_type> attributes_dictionary;
+
+	//! The geometry points in the order they are visited by the 'handle_*' methods.
+	std::vector<ConvertedPoint> points;
+
+	/**
+	 * The geometries created from @a points.
+	 *
+	 * There's one for each linestring of a (multi-)linestring, each polygon of a (multi-)polygon
+	 * and one for a multi-point (and none for a point).
+	 */
+	std::vector<ConvertedGeometry> geometries;
+};
+
+
+/**
+ * Converts a range of features in a batch (this is called concurrently for different ranges).
+ */
+class GPlatesFileIO::OgrReader::ConvertFeatures
+{
+public:
+
+	enum Stage
+	{
+		//! Extract attributes and (untransformed) geometry points from the OGR features.
+		EXTRACT,
+		/**
+		 * Validate the (transformed) geometry points, convert them to points on the sphere and
+		 * create the geometries and the attributes dictionary.
+		 */
+		CONVERT
+	};
+
+	ConvertFeatures(
+			Stage stage,
+			const std::vector<OGRFeature *> &ogr_features,
+			std::vector<ConvertedFeature> &converted_features,
+			OGRFeatureDefn *feature_def,
+			const QStringList &field_names) :
+		d_stage(stage),
+		d_ogr_features(ogr_features),
+		d_converted_features(converted_features),
+		d_feature_def(feature_def),
+		d_field_names(field_names)
+	{  }
+
+	void
+	operator()(
+			std::size_t begin,
+			std::size_t end) const
+	{
+		for (std::size_t n = begin; n < end; ++n)
+		{
+			ConvertedFeature &converted_feature = d_converted_features[n];
+
+			if (d_stage == EXTRACT)
+			{
+				converted_feature.attributes.clear();
+				converted_feature.points.clear();
+
+				OGRFeature *ogr_feature = d_ogr_features[n];
+				get_attributes(converted_feature.attributes, ogr_feature, d_feature_def);
+
+				OGRGeometry *geometry = ogr_feature->GetGeometryRef();
+				if (geometry)
+				{
+					extract_points(geometry, converted_feature.points);
+				}
+			}
+			else
+			{
+				BOOST_FOREACH(ConvertedPoint &converted_point, converted_feature.points)
+				{
+					convert_point(converted_point);
+				}
+
+				converted_feature.geometries.clear();
+				OGRGeometry *geometry = d_ogr_features[n]->GetGeometryRef();
+				if (geometry)
+				{
+					create_geometries(geometry, converted_feature);
+				}
+
+				converted_feature.attributes_dictionary =
+						create_attributes_dictionary(converted_feature.attributes, d_field_names);
+			}
+		}
+	}
+
+private:
+
+	Stage d_stage;
+	const std::vector<OGRFeature *> &d_ogr_features;
+	std::vector<ConvertedFeature> &d_converted_features;
+	OGRFeatureDefn *d_feature_def;
+	const QStringList &d_field_names;
+
+
+	/**
+	 * Extracts the points in the same order as they are visited by the 'handle_*' methods.
+	 */
+	static
+	void
+	extract_points(
+			OGRGeometry *geometry,
+			std::vector<ConvertedPoint> &points)
+	{
+		switch (wkbFlatten(geometry->getGeometryType()))
+		{
+		case wkbPoint:
+			{
+				OGRPoint *ogr_point = static_cast<OGRPoint *>(geometry);
+				points.push_back(ConvertedPoint(ogr_point->getX(), ogr_point->getY()));
+			}
+			break;
+
+		case wkbLineString:
+			extract_line_string_points(static_cast<OGRLineString *>(geometry), points);
+			break;
+
+		case wkbPolygon:
+			extract_polygon_points(static_cast<OGRPolygon *>(geometry), points);
+			break;
+
+		case wkbMultiPoint:
+		case wkbMultiLineString:
+		case wkbMultiPolygon:
+			{
+				OGRGeometryCollection *multi = static_cast<OGRGeometryCollection *>(geometry);
+				const int num_geometries = multi->getNumGeometries();
+				for (int n = 0; n < num_geometries; ++n)
+				{
+					extract_points(multi->getGeometryRef(n), points);
+				}
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	static
+	void
+	extract_line_string_points(
+			OGRLineString *line_string,
+			std::vector<ConvertedPoint> &points)
+	{
+		if (line_string == NULL)
+		{
+			return;
+		}
+
+		const int num_points = line_string->getNumPoints();
+		for (int n = 0; n < num_points; ++n)
+		{
+			points.push_back(ConvertedPoint(line_string->getX(n), line_string->getY(n)));
+		}
+	}
+
+	static
+	void
+	extract_polygon_points(
+			OGRPolygon *polygon,
+			std::vector<ConvertedPoint> &points)
+	{
+		extract_line_string_points(polygon->getExteriorRing(), points);
+
+		const int num_interior_rings = polygon->getNumInteriorRings();
+		for (int n = 0; n < num_interior_rings; ++n)
+		{
+			extract_line_string_points(polygon->getInteriorRing(n), points);
+		}
+	}
+
+	static
+	void
+	convert_point(
+			ConvertedPoint &converted_point)
+	{
+		if (converted_point.status != ConvertedPoint::VALID)
+		{
+			return;
+		}
+
+		const double x = converted_point.x;
+		const double y = converted_point.y;
+
+		if (x < SHAPE_NO_DATA)
+		{
+			converted_point.status = ConvertedPoint::NO_LONGITUDE_DATA;
+		}
+		else if (y < SHAPE_NO_DATA)
+		{
+			converted_point.status = ConvertedPoint::NO_LATITUDE_DATA;
+		}
+		else if (!GPlatesMaths::LatLonPoint::is_valid_latitude(y))
+		{
+			converted_point.status = ConvertedPoint::INVALID_LATITUDE;
+		}
+		else if (!GPlatesMaths::LatLonPoint::is_valid_longitude(x))
+		{
+			converted_point.status = ConvertedPoint::INVALID_LONGITUDE;
+		}
+		else
+		{
+			converted_point.point = GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(y, x));
+		}
+	}
+
+	/**
+	 * Creates the geometries of @a geometry from the converted points of @a converted_feature.
+	 *
+	 * This follows the same rules as the 'handle_*' methods for which points make up each geometry
+	 * (and which geometries are ignored) so those methods can just use the created geometries.
+	 */
+	static
+	void
+	create_geometries(
+			OGRGeometry *geometry,
+			ConvertedFeature &converted_feature)
+	{
+		std::vector<ConvertedGeometry> &geometries = converted_feature.geometries;
+		unsigned int point_index = 0;
+
+		switch (wkbFlatten(geometry->getGeometryType()))
+		{
+		case wkbMultiPoint:
+			{
+				// Invalid points are skipped (rather than ignoring the entire multi-point).
+				std::vector<GPlatesMaths::PointOnSphere> points;
+				BOOST_FOREACH(const ConvertedPoint &converted_point, converted_feature.points)
+				{
+					if (converted_point.point)
+					{
+						points.push_back(converted_point.point.get());
+					}
+				}
+
+				geometries.resize(1);
+				if (!points.empty())
+				{
+					try
+					{
+						geometries[0].multi_point = GPlatesMaths::MultiPointOnSphere::create(points);
+					}
+					catch (std::exception &exc)
+					{
+						geometries[0].error = std::string(exc.what());
+					}
+					catch (...)
+					{
+						geometries[0].error = std::string("Unknown error");
+					}
+				}
+			}
+			break;
+
+		case wkbLineString:
+			geometries.resize(1);
+			create_polyline(
+					static_cast<OGRLineString *>(geometry),
+					converted_feature.points,
+					point_index,
+					geometries[0]);
+			break;
+
+		case wkbMultiLineString:
+			{
+				OGRGeometryCollection *multi = static_cast<OGRGeometryCollection *>(geometry);
+				const int num_geometries = multi->getNumGeometries();
+				geometries.resize(num_geometries);
+				for (int n = 0; n < num_geometries; ++n)
+				{
+					create_polyline(
+							static_cast<OGRLineString *>(multi->getGeometryRef(n)),
+							converted_feature.points,
+							point_index,
+							geometries[n]);
+				}
+			}
+			break;
+
+		case wkbPolygon:
+			geometries.resize(1);
+			create_polygon(
+					static_cast<OGRPolygon *>(geometry),
+					converted_feature.points,
+					point_index,
+					geometries[0]);
+			break;
+
+		case wkbMultiPolygon:
+			{
+				OGRGeometryCollection *multi = static_cast<OGRGeometryCollection *>(geometry);
+				const int num_geometries = multi->getNumGeometries();
+				geometries.resize(num_geometries);
+				for (int n = 0; n < num_geometries; ++n)
+				{
+					create_polygon(
+							static_cast<OGRPolygon *>(multi->getGeometryRef(n)),
+							converted_feature.points,
+							point_index,
+							geometries[n]);
+				}
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	/**
+	 * Gets the @a num_points converted points starting at @a point_index (and advances past them).
+	 *
+	 * Returns false if there are less than two points or any point is invalid.
+	 */
+	static
+	bool
+	get_line_points(
+			const std::vector<ConvertedPoint> &converted_points,
+			unsigned int &point_index,
+			int num_points,
+			std::vector<GPlatesMaths::PointOnSphere> &points)
+	{
+		const unsigned int first_point_index = point_index;
+		point_index += num_points;
+
+		if (num_points < 2)
+		{
+			return false;
+		}
+
+		points.reserve(num_points);
+		for (int n = 0; n < num_points; ++n)
+		{
+			const ConvertedPoint &converted_point = converted_points[first_point_index + n];
+			if (!converted_point.point)
+			{
+				return false;
+			}
+			points.push_back(converted_point.point.get());
+		}
+
+		return true;
+	}
+
+	static
+	void
+	create_polyline(
+			OGRLineString *line_string,
+			const std::vector<ConvertedPoint> &converted_points,
+			unsigned int &point_index,
+			ConvertedGeometry &converted_geometry)
+	{
+		std::vector<GPlatesMaths::PointOnSphere> points;
+		if (get_line_points(converted_points, point_index, line_string->getNumPoints(), points))
+		{
+			if (GPlatesMaths::PolylineOnSphere::evaluate_construction_parameter_validity(points) !=
+				GPlatesMaths::PolylineOnSphere::VALID)
+			{
+				converted_geometry.invalid_polyline_points = boost::in_place();
+				converted_geometry.invalid_polyline_points->swap(points);
+				return;
+			}
+
+			try
+			{
+				converted_geometry.polyline = GPlatesMaths::PolylineOnSphere::create(points);
+			}
+			catch (std::exception &exc)
+			{
+				converted_geometry.error = std::string(exc.what());
+			}
+			catch (...)
+			{
+				converted_geometry.error = std::string("Unknown error");
+			}
+		}
+	}
+
+	static
+	void
+	create_polygon(
+			OGRPolygon *polygon,
+			const std::vector<ConvertedPoint> &converted_points,
+			unsigned int &point_index,
+			ConvertedGeometry &converted_geometry)
+	{
+		// A missing ring has no points.
+		std::vector<GPlatesMaths::PointOnSphere> exterior_ring;
+		OGRLinearRing *ogr_exterior_ring = polygon->getExteriorRing();
+		const bool valid_exterior_ring = ogr_exterior_ring &&
+				get_line_points(converted_points, point_index, ogr_exterior_ring->getNumPoints(), exterior_ring);
+
+		std::list< std::vector<GPlatesMaths::PointOnSphere> > interior_rings;
+		const int num_interior_rings = polygon->getNumInteriorRings();
+		for (int n = 0; n < num_interior_rings; ++n)
+		{
+			OGRLinearRing *ogr_interior_ring = polygon->getInteriorRing(n);
+			if (ogr_interior_ring == NULL)
+			{
+				continue;
+			}
+
+			// Only interior rings with valid points are added.
+			std::vector<GPlatesMaths::PointOnSphere> interior_ring;
+			if (get_line_points(converted_points, point_index, ogr_interior_ring->getNumPoints(), interior_ring))
+			{
+				interior_rings.push_back(interior_ring);
+			}
+		}
+
+		// If the exterior ring is invalid then we don't create a polygon.
+		if (valid_exterior_ring)
+		{
+			if (GPlatesMaths::PolygonOnSphere::evaluate_construction_parameter_validity(
+					exterior_ring.begin(), exterior_ring.end(),
+					interior_rings.begin(), interior_rings.end()) != GPlatesMaths::PolygonOnSphere::VALID)
+			{
+				converted_geometry.invalid_polygon_exterior_ring = boost::in_place();
+				converted_geometry.invalid_polygon_exterior_ring->swap(exterior_ring);
+				converted_geometry.invalid_polygon_interior_rings.swap(interior_rings);
+				return;
+			}
+
+			try
+			{
+				converted_geometry.polygon = GPlatesMaths::PolygonOnSphere::create(exterior_ring, interior_rings);
+			}
+			catch (std::exception &exc)
+			{
+				converted_geometry.error = std::string(exc.what());
+			}
+			catch (...)
+			{
+				converted_geometry.error = std::string("Unknown error");
+			}
+		}
+	}
+};
+
+
 GPlatesFileIO::OgrReader::OgrReader():
 	d_num_layers(0),
 	d_data_source_ptr(NULL),
@@ -936,6 +1518,7 @@ GPlatesFileIO::OgrReader::OgrReader():
 	d_feature_ptr(NULL),
 	d_layer_ptr(NULL),
 	d_feature_type_string("UnclassifiedFeature"),
+	d_converted_feature(NULL),
 	d_total_geometries(0),
 	d_loaded_geometries(0),
 	d_total_features(0),
@@ -1056,226 +1639,332 @@ GPlatesFileIO::OgrReader::read_features(
 	boost::shared_ptr<GPlatesFileIO::DataSource> e_source(
 		new GPlatesFileIO::LocalFileDataSource(d_filename, GPlatesFileIO::DataFormats::Shapefile));
 
-	static const OgrUtils::feature_map_type &feature_map = OgrUtils::build_feature_map();
+	// OGR features are read (from the layer) in batches in this thread, since an OGR layer can only
+	// be read by one thread. Each batch is then converted in parallel (attributes, geometry points
+	// and coordinate transformation), and finally its features are added to the model in this thread
+	// (in their original order) since the model is not thread-safe.
+	std::vector<OGRFeature *> ogr_features;
+	ogr_features.reserve(OGR_FEATURE_BATCH_SIZE);
+	std::vector<ConvertedFeature> converted_features;
 
-	while ((d_feature_ptr = d_layer_ptr->GetNextFeature()) != NULL){
-	
-		boost::shared_ptr<GPlatesFileIO::LocationInDataSource> e_location(
-				new GPlatesFileIO::LineNumber(feature_number));
+	while (true)
+	{
+		// Read the next batch of OGR features.
+		OGRFeature *ogr_feature;
+		while (ogr_features.size() < OGR_FEATURE_BATCH_SIZE &&
+			(ogr_feature = d_layer_ptr->GetNextFeature()) != NULL)
+		{
+			ogr_features.push_back(ogr_feature);
+		}
+
+		if (ogr_features.empty())
+		{
+			break;
+		}
+
+		// Destroy the batch of OGR features when we're finished with them (or if an exception is thrown).
+		OgrFeatureBatchDestroyer ogr_features_destroyer(ogr_features);
+
+		convert_features(ogr_features, converted_features);
+
+		for (unsigned int n = 0; n < ogr_features.size(); ++n)
+		{
+			boost::shared_ptr<GPlatesFileIO::LocationInDataSource> e_location(
+					new GPlatesFileIO::LineNumber(feature_number));
+
+			d_feature_ptr = ogr_features[n];
+			d_converted_feature = &converted_features[n];
+
+			read_feature(collection, read_errors, e_source, e_location);
 
-		d_geometry_ptr = d_feature_ptr->GetGeometryRef();
-		if (d_geometry_ptr == NULL){
-			read_errors.d_warnings.push_back(
-				GPlatesFileIO::ReadErrorOccurrence(
-					e_source,
-					e_location,
-					GPlatesFileIO::ReadErrors::ErrorReadingOgrGeometry,
-					GPlatesFileIO::ReadErrors::FeatureIgnored));
 			++feature_number;
-			OGRFeature::DestroyFeature(d_feature_ptr);
-			continue;
 		}
 
-		get_attributes();
+		d_feature_ptr = NULL;
+		d_converted_feature = NULL;
+	}
+}
 
 
-		// Check if we have a shapefile attribute corresponding to the Feature Type.
-		QMap<QString,QString>::const_iterator it = 
-			d_model_to_attribute_map.find(ShapefileAttributes::model_properties[ShapefileAttributes::FEATURE_TYPE]);
+void
+GPlatesFileIO::OgrReader::convert_features(
+		const std::vector<OGRFeature *> &ogr_features,
+		std::vector<ConvertedFeature> &converted_features)
+{
+	converted_features.resize(ogr_features.size());
 
+	OGRFeatureDefn *feature_def = d_layer_ptr->GetLayerDefn();
 
-		if ((it != d_model_to_attribute_map.constEnd()) && d_field_names.contains(it.value())) {
-		
-			int index = d_field_names.indexOf(it.value());
-	
-			// d_field_names should be the same size as d_attributes, but check that we
-			// don't try to go beyond the bounds of d_attributes. If somehow we are trying to do 
-			// this, then we just get an unclassifiedFeature created.
-			if ((index >= 0) && (index < static_cast<int>(d_attributes.size())))
+	// Extract the attributes and geometry points of the features in parallel.
+	GPlatesUtils::ParallelUtils::parallel_for(
+			ogr_features.size(),
+			ConvertFeatures(ConvertFeatures::EXTRACT, ogr_features, converted_features, feature_def, d_field_names),
+			64/*min_items_per_chunk*/);
+
+	// Transform the points of the entire batch to WGS84 in one call.
+	//
+	// This is done in this thread since an OGR coordinate transformation is not thread-safe.
+	if (!d_current_coordinate_transformation->is_identity_transform())
+	{
+		std::vector<double> x;
+		std::vector<double> y;
+		BOOST_FOREACH(const ConvertedFeature &converted_feature, converted_features)
+		{
+			BOOST_FOREACH(const ConvertedPoint &converted_point, converted_feature.points)
 			{
+				x.push_back(converted_point.x);
+				y.push_back(converted_point.y);
+			}
+		}
 
-				QString feature_string = d_attributes[index].toString();
-				if (GPlatesFileIO::OgrUtils::feature_type_field_is_gpgim_type(d_model_to_attribute_map))
-				{
-					// Feature type string is expected to be the full GPGIM feature type (with or without "gpml:").
-					//
-					// We've loosened the GPGIM loading constraints to allow any feature type
-					// (even if it's not defined in the GPGIM). So there's no need to check it's in the GPGIM.
-					// It still has to be in "<namespace_alias>:<name>" format though (but that's checked below).
-					d_feature_type_string = feature_string;
-				}
-				else
+		if (!x.empty())
+		{
+			// If the batch transform fails (for any point) then transform the points individually
+			// to find which ones failed.
+			const bool transformed_batch =
+					d_current_coordinate_transformation->transform_in_place(x.size(), &x[0], &y[0]);
+
+			std::size_t point_index = 0;
+			BOOST_FOREACH(ConvertedFeature &converted_feature, converted_features)
+			{
+				BOOST_FOREACH(ConvertedPoint &converted_point, converted_feature.points)
 				{
-					// Feature type string is expected to be a 2-letter data type code (see OgrUtils::build_feature_map()),
-					// which we map to the full GPGIM feature type here.
-					OgrUtils::feature_map_const_iterator result = feature_map.find(feature_string);
-					if (result != feature_map.end()) {
-						d_feature_type_string = *result;
-					} else {
-						read_errors.d_warnings.push_back(GPlatesFileIO::ReadErrorOccurrence(e_source, e_location,
-						GPlatesFileIO::ReadErrors::UnrecognisedOgrFeatureType,
-						GPlatesFileIO::ReadErrors::UnclassifiedOgrFeatureCreated));
+					if (transformed_batch)
+					{
+						converted_point.x = x[point_index];
+						converted_point.y = y[point_index];
+					}
+					else if (!d_current_coordinate_transformation->transform_in_place(
+							&converted_point.x, &converted_point.y))
+					{
+						converted_point.status = ConvertedPoint::TRANSFORM_FAILED;
 					}
+
+					++point_index;
 				}
 			}
 		}
+	}
 
+	// Validate the points, convert them to points on the sphere, and create the geometries and
+	// attribute dictionaries in parallel. Only creating the features (and adding them to the model)
+	// is left for 'read_feature()'.
+	GPlatesUtils::ParallelUtils::parallel_for(
+			ogr_features.size(),
+			ConvertFeatures(ConvertFeatures::CONVERT, ogr_features, converted_features, feature_def, d_field_names),
+			64/*min_items_per_chunk*/);
+}
 
 
-		it = d_model_to_attribute_map.find(
-			ShapefileAttributes::model_properties[ShapefileAttributes::FEATURE_ID]);
+void
+GPlatesFileIO::OgrReader::read_feature(
+		const GPlatesModel::FeatureCollectionHandle::weak_ref &collection,
+		ReadErrorAccumulation &read_errors,
+		const boost::shared_ptr<GPlatesFileIO::DataSource> &e_source,
+		const boost::shared_ptr<GPlatesFileIO::LocationInDataSource> &e_location)
+{
+	static const OgrUtils::feature_map_type &feature_map = OgrUtils::build_feature_map();
 
-		if ((it != d_model_to_attribute_map.constEnd()) && d_field_names.contains(it.value())) {
+	d_geometry_ptr = d_feature_ptr->GetGeometryRef();
+	if (d_geometry_ptr == NULL){
+		read_errors.d_warnings.push_back(
+			GPlatesFileIO::ReadErrorOccurrence(
+				e_source,
+				e_location,
+				GPlatesFileIO::ReadErrors::ErrorReadingOgrGeometry,
+				GPlatesFileIO::ReadErrors::FeatureIgnored));
+		return;
+	}
 
-			int index = d_field_names.indexOf(it.value());
+	d_attributes = d_converted_feature->attributes;
 
-			// d_field_names should be the same size as d_attributes, but check that we
-			// don't try to go beyond the bounds of d_attributes. If somehow we are trying to do 
-			// this, then we just get a feature without a feature_id.
-			if ((index >= 0) && (index < static_cast<int>(d_attributes.size())))
-			{
 
-				QString feature_id = d_attributes[index].toString();
+	// Check if we have a shapefile attribute corresponding to the Feature Type.
+	QMap<QString,QString>::const_iterator it = 
+		d_model_to_attribute_map.find(ShapefileAttributes::model_properties[ShapefileAttributes::FEATURE_TYPE]);
 
-				// FIXME: should we check here that the provided string is of valid feature-id form,
-				// rather than just checking if it's not empty? 
-				if (feature_id.isEmpty())
-				{
-					d_feature_id.reset();
-				}
-				else
-				{
-					d_feature_id.reset(GPlatesUtils::make_icu_string_from_qstring(feature_id));
-				}
-			}
-		}		
 
+	if ((it != d_model_to_attribute_map.constEnd()) && d_field_names.contains(it.value())) {
+	
+		int index = d_field_names.indexOf(it.value());
 
-		boost::optional<GPlatesModel::FeatureType> feature_type =
-				GPlatesModel::convert_qstring_to_qualified_xml_name<GPlatesModel::FeatureType>(d_feature_type_string);
-		if (!feature_type)
+		// d_field_names should be the same size as d_attributes, but check that we
+		// don't try to go beyond the bounds of d_attributes. If somehow we are trying to do 
+		// this, then we just get an unclassifiedFeature created.
+		if ((index >= 0) && (index < static_cast<int>(d_attributes.size())))
 		{
-			// For some reason we didn't get a valid feature type. Make an unclassified feature.
-			feature_type.reset(GPlatesModel::FeatureType::create_gpml("UnclassifiedFeature"));
-			read_errors.d_warnings.push_back(GPlatesFileIO::ReadErrorOccurrence(e_source, e_location,
-																				GPlatesFileIO::ReadErrors::UnrecognisedOgrFeatureType,
-																				GPlatesFileIO::ReadErrors::UnclassifiedOgrFeatureCreated));
+
+			QString feature_string = d_attributes[index].toString();
+			if (GPlatesFileIO::OgrUtils::feature_type_field_is_gpgim_type(d_model_to_attribute_map))
+			{
+				// Feature type string is expected to be the full GPGIM feature type (with or without "gpml:").
+				//
+				// We've loosened the GPGIM loading constraints to allow any feature type
+				// (even if it's not defined in the GPGIM). So there's no need to check it's in the GPGIM.
+				// It still has to be in "<namespace_alias>:<name>" format though (but that's checked below).
+				d_feature_type_string = feature_string;
+			}
+			else
+			{
+				// Feature type string is expected to be a 2-letter data type code (see OgrUtils::build_feature_map()),
+				// which we map to the full GPGIM feature type here.
+				OgrUtils::feature_map_const_iterator result = feature_map.find(feature_string);
+				if (result != feature_map.end()) {
+					d_feature_type_string = *result;
+				} else {
+					read_errors.d_warnings.push_back(GPlatesFileIO::ReadErrorOccurrence(e_source, e_location,
+					GPlatesFileIO::ReadErrors::UnrecognisedOgrFeatureType,
+					GPlatesFileIO::ReadErrors::UnclassifiedOgrFeatureCreated));
+				}
+			}
 		}
-		// Now we have a feature type (in gpml form), even though it may still be the default "UnclassifiedFeature".
-		// Get the default geometry property for that feature type, and the possible structural types (e.g. point/multipint etc)
-		// for that default geometry property.
+	}
 
-		boost::optional<GPlatesModel::GpgimFeatureClass::non_null_ptr_to_const_type> feature_class =
-				GPlatesModel::Gpgim::instance().get_feature_class(*feature_type);
-		boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> default_geometry_feature_property;
-		GPlatesModel::GpgimProperty::structural_type_seq_type default_structural_types;
 
-		if (feature_class)
-		{
-			 default_geometry_feature_property = (*feature_class)->get_default_geometry_feature_property();
-		}
-		else
+
+	it = d_model_to_attribute_map.find(
+		ShapefileAttributes::model_properties[ShapefileAttributes::FEATURE_ID]);
+
+	if ((it != d_model_to_attribute_map.constEnd()) && d_field_names.contains(it.value())) {
+
+		int index = d_field_names.indexOf(it.value());
+
+		// d_field_names should be the same size as d_attributes, but check that we
+		// don't try to go beyond the bounds of d_attributes. If somehow we are trying to do 
+		// this, then we just get a feature without a feature_id.
+		if ((index >= 0) && (index < static_cast<int>(d_attributes.size())))
 		{
-			// TODO: We didn't get a valid feature class. What can we do here?
-			// I guess we have to bail out and flag up the issue with read-errors, and skip to the next feature.
-			read_errors.d_warnings.push_back(
-						GPlatesFileIO::ReadErrorOccurrence(
-							e_source,
-							e_location,
-							GPlatesFileIO::ReadErrors::UnrecognisedOgrFeatureType,
-							GPlatesFileIO::ReadErrors::FeatureIgnored));
-			++feature_number;
-			OGRFeature::DestroyFeature(d_feature_ptr);
-			continue;
-		}
 
-		d_type = d_geometry_ptr->getGeometryType();
-		OGRwkbGeometryType flattened_type = wkbFlatten(d_type);
+			QString feature_id = d_attributes[index].toString();
 
-		if( d_type != flattened_type){
-			read_errors.d_warnings.push_back(
-						GPlatesFileIO::ReadErrorOccurrence(
-							e_source,
-							e_location,
-							GPlatesFileIO::ReadErrors::TwoPointFiveDGeometryDetected,
-							GPlatesFileIO::ReadErrors::GeometryFlattenedTo2D));
+			// FIXME: should we check here that the provided string is of valid feature-id form,
+			// rather than just checking if it's not empty? 
+			if (feature_id.isEmpty())
+			{
+				d_feature_id.reset();
+			}
+			else
+			{
+				d_feature_id.reset(GPlatesUtils::make_icu_string_from_qstring(feature_id));
+			}
 		}
+	}		
 
 
+	boost::optional<GPlatesModel::FeatureType> feature_type =
+			GPlatesModel::convert_qstring_to_qualified_xml_name<GPlatesModel::FeatureType>(d_feature_type_string);
+	if (!feature_type)
+	{
+		// For some reason we didn't get a valid feature type. Make an unclassified feature.
+		feature_type.reset(GPlatesModel::FeatureType::create_gpml("UnclassifiedFeature"));
+		read_errors.d_warnings.push_back(GPlatesFileIO::ReadErrorOccurrence(e_source, e_location,
+																			GPlatesFileIO::ReadErrors::UnrecognisedOgrFeatureType,
+																			GPlatesFileIO::ReadErrors::UnclassifiedOgrFeatureCreated));
+	}
+	// Now we have a feature type (in gpml form), even though it may still be the default "UnclassifiedFeature".
+	// Get the default geometry property for that feature type, and the possible structural types (e.g. point/multipint etc)
+	// for that default geometry property.
+
+	boost::optional<GPlatesModel::GpgimFeatureClass::non_null_ptr_to_const_type> feature_class =
+			GPlatesModel::Gpgim::instance().get_feature_class(*feature_type);
+	boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> default_geometry_feature_property;
+	GPlatesModel::GpgimProperty::structural_type_seq_type default_structural_types;
+
+	if (feature_class)
+	{
+		 default_geometry_feature_property = (*feature_class)->get_default_geometry_feature_property();
+	}
+	else
+	{
+		// TODO: We didn't get a valid feature class. What can we do here?
+		// I guess we have to bail out and flag up the issue with read-errors, and skip to the next feature.
+		read_errors.d_warnings.push_back(
+					GPlatesFileIO::ReadErrorOccurrence(
+						e_source,
+						e_location,
+						GPlatesFileIO::ReadErrors::UnrecognisedOgrFeatureType,
+						GPlatesFileIO::ReadErrors::FeatureIgnored));
+		return;
+	}
 
+	d_type = d_geometry_ptr->getGeometryType();
+	OGRwkbGeometryType flattened_type = wkbFlatten(d_type);
 
-		if (default_geometry_feature_property)
-		{
-			default_structural_types = (*default_geometry_feature_property)->get_structural_types();
-		}
+	if( d_type != flattened_type){
+		read_errors.d_warnings.push_back(
+					GPlatesFileIO::ReadErrorOccurrence(
+						e_source,
+						e_location,
+						GPlatesFileIO::ReadErrors::TwoPointFiveDGeometryDetected,
+						GPlatesFileIO::ReadErrors::GeometryFlattenedTo2D));
+	}
 
-		// If we don't have a default, the default_structural_types container will be empty.
-		if (OgrUtils::wkb_type_belongs_to_structural_types(flattened_type,default_structural_types))
-		{
-			// We need to send the raw ogr type here so that we can determine if we need to handle multipolyines, multipolygons and the like.
-			handle_geometry(*feature_type,flattened_type,default_geometry_feature_property,collection,read_errors,e_source,e_location);
-		}
-		else
+
+
+
+	if (default_geometry_feature_property)
+	{
+		default_structural_types = (*default_geometry_feature_property)->get_structural_types();
+	}
+
+	// If we don't have a default, the default_structural_types container will be empty.
+	if (OgrUtils::wkb_type_belongs_to_structural_types(flattened_type,default_structural_types))
+	{
+		// We need to send the raw ogr type here so that we can determine if we need to handle multipolyines, multipolygons and the like.
+		handle_geometry(*feature_type,flattened_type,default_geometry_feature_property,collection,read_errors,e_source,e_location);
+	}
+	else
+	{
+		// We should get here either if:
+		//		we didn't have a default property, or
+		//		the structural type from OGR didn't match the possible structural types of the default property.
+		//
+		// So in this case we want to try any remaining properties and see if we get a match between property
+		// structural type and OGR structural type.
+		boost::optional<GPlatesPropertyValues::StructuralType> structural_type_of_ogr_geom =
+				OgrUtils::get_structural_type_of_wkb_type(flattened_type);
+
+		bool found_matching_property = false;
+		if (structural_type_of_ogr_geom)
 		{
-			// We should get here either if:
-			//		we didn't have a default property, or
-			//		the structural type from OGR didn't match the possible structural types of the default property.
-			//
-			// So in this case we want to try any remaining properties and see if we get a match between property
-			// structural type and OGR structural type.
-			boost::optional<GPlatesPropertyValues::StructuralType> structural_type_of_ogr_geom =
-					OgrUtils::get_structural_type_of_wkb_type(flattened_type);
-
-			bool found_matching_property = false;
-			if (structural_type_of_ogr_geom)
-			{
-				GPlatesModel::GpgimFeatureClass::gpgim_property_seq_type properties;
-				(*feature_class)->get_feature_properties(properties);
+			GPlatesModel::GpgimFeatureClass::gpgim_property_seq_type properties;
+			(*feature_class)->get_feature_properties(properties);
 
 
-				BOOST_FOREACH(GPlatesModel::GpgimProperty::non_null_ptr_to_const_type property, properties)
+			BOOST_FOREACH(GPlatesModel::GpgimProperty::non_null_ptr_to_const_type property, properties)
+			{
+				if (property->get_structural_type(*structural_type_of_ogr_geom))
 				{
-					if (property->get_structural_type(*structural_type_of_ogr_geom))
-					{
-						found_matching_property = true;
-						boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> optional_property;
-						optional_property.reset(property);
-						handle_geometry(*feature_type,flattened_type,optional_property,collection,read_errors,e_source,e_location);
-						break;
-					}
+					found_matching_property = true;
+					boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> optional_property;
+					optional_property.reset(property);
+					handle_geometry(*feature_type,flattened_type,optional_property,collection,read_errors,e_source,e_location);
+					break;
 				}
 			}
-			if (!found_matching_property)
-			{
-				// We can't match the OGR geometry with the feature's required geometry.
-				read_errors.d_warnings.push_back(
-							GPlatesFileIO::ReadErrorOccurrence(
-								e_source,
-								e_location,
-								GPlatesFileIO::ReadErrors::UnableToMatchOgrGeometryWithFeature,
-								GPlatesFileIO::ReadErrors::FeatureIgnored));
-			}
 		}
-
-		OGRFeature::DestroyFeature(d_feature_ptr);
-		feature_number++;
-	} // while
-
+		if (!found_matching_property)
+		{
+			// We can't match the OGR geometry with the feature's required geometry.
+			read_errors.d_warnings.push_back(
+						GPlatesFileIO::ReadErrorOccurrence(
+							e_source,
+							e_location,
+							GPlatesFileIO::ReadErrors::UnableToMatchOgrGeometryWithFeature,
+							GPlatesFileIO::ReadErrors::FeatureIgnored));
+		}
+	}
 }
 
 const GPlatesModel::FeatureHandle::weak_ref
-GPlatesFileIO::OgrReader::create_polygon_feature_from_list(
+GPlatesFileIO::OgrReader::create_polygon_feature(
 	const GPlatesModel::FeatureType &feature_type,
 	const GPlatesModel::FeatureCollectionHandle::weak_ref &collection,
-	const std::vector<GPlatesMaths::PointOnSphere> &exterior_ring,
-	const std::list< std::vector<GPlatesMaths::PointOnSphere> > &interior_rings,
+	const GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type &polygon_on_sphere,
 	const boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> &property)
 {
 	GPlatesModel::FeatureHandle::weak_ref feature = create_feature(feature_type,collection,d_feature_type_string,d_feature_id);
 
-	GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type polygon_on_sphere =
-		GPlatesMaths::PolygonOnSphere::create(exterior_ring, interior_rings);
-
 	GPlatesPropertyValues::GmlPolygon::non_null_ptr_type gml_polygon =
 		GPlatesPropertyValues::GmlPolygon::create(polygon_on_sphere);
 
@@ -1302,17 +1991,14 @@ GPlatesFileIO::OgrReader::create_polygon_feature_from_list(
 }
 
 const GPlatesModel::FeatureHandle::weak_ref
-GPlatesFileIO::OgrReader::create_line_feature_from_list(
+GPlatesFileIO::OgrReader::create_line_feature(
 	const GPlatesModel::FeatureType &feature_type,
 	const GPlatesModel::FeatureCollectionHandle::weak_ref &collection,
-	const std::vector<GPlatesMaths::PointOnSphere> &list_of_points,
+	const GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type &polyline,
 	const boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> &property)
 {
 	GPlatesModel::FeatureHandle::weak_ref feature = create_feature(feature_type,collection,d_feature_type_string,d_feature_id);
 
-	GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type polyline =
-		GPlatesMaths::PolylineOnSphere::create(list_of_points);
-
 	GPlatesPropertyValues::GmlLineString::non_null_ptr_type gml_line_string =
 		GPlatesPropertyValues::GmlLineString::create(polyline);
 
@@ -1376,18 +2062,15 @@ GPlatesFileIO::OgrReader::create_point_feature_from_point_on_sphere(
 }
 
 const GPlatesModel::FeatureHandle::weak_ref
-GPlatesFileIO::OgrReader::create_multi_point_feature_from_list(
+GPlatesFileIO::OgrReader::create_multi_point_feature(
 	const GPlatesModel::FeatureType &feature_type,
 	const GPlatesModel::FeatureCollectionHandle::weak_ref &collection,
-	const std::vector<GPlatesMaths::PointOnSphere> &list_of_points,
+	const GPlatesMaths::MultiPointOnSphere::non_null_ptr_to_const_type &multi_point_on_sphere,
 	const boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> &property)
 {
 
 	GPlatesModel::FeatureHandle::weak_ref feature = create_feature(feature_type,collection,d_feature_type_string,d_feature_id);
 
-	GPlatesMaths::MultiPointOnSphere::non_null_ptr_to_const_type multi_point_on_sphere =
-		GPlatesMaths::MultiPointOnSphere::create(list_of_points);
-
 	GPlatesPropertyValues::GmlMultiPoint::non_null_ptr_type gml_multi_point =
 		GPlatesPropertyValues::GmlMultiPoint::create(multi_point_on_sphere);
 
@@ -1439,7 +2122,8 @@ GPlatesFileIO::OgrReader::get_field_names(
 
 /**
  * @brief GPlatesFileIO::OgrReader::get_attributes
- * Fills the member variable d_attributes with QVariant forms of the imported file's attributes.
+ * Fills @a attributes with QVariant forms of the imported file's attributes for @a feature_ptr.
+ * This is called concurrently for different features (see @a convert_features).
  * Note that OgrReader was written initially to support ESRI shapefiles. While shapefiles
  * can store a variety of field types in the dbf file
  * (see for example http://www.dbase.com/Knowledgebase/INT/db7_file_fmt.htm)
@@ -1456,13 +2140,15 @@ GPlatesFileIO::OgrReader::get_field_names(
  *
  */
 void 
-GPlatesFileIO::OgrReader::get_attributes()
+GPlatesFileIO::OgrReader::get_attributes(
+		std::vector<QVariant> &attributes,
+		OGRFeature *feature_ptr,
+		OGRFeatureDefn *feature_def_ptr)
 {
-	d_attributes.clear();
-	if (!d_feature_ptr){
+	attributes.clear();
+	if (!feature_ptr){
 		return;
 	}
-	OGRFeatureDefn *feature_def_ptr = d_layer_ptr->GetLayerDefn();
 	int num_fields = feature_def_ptr->GetFieldCount();
 
 	//
@@ -1489,21 +2175,21 @@ GPlatesFileIO::OgrReader::get_attributes()
 		if (field_def_ptr->GetType()==OFTInteger){
 			value_variant =
 #if GPLATES_GDAL_VERSION_NUM >= GPLATES_GDAL_COMPUTE_VERSION(2,2,0)
-					d_feature_ptr->IsFieldSetAndNotNull(count)
+					feature_ptr->IsFieldSetAndNotNull(count)
 #else
-					d_feature_ptr->IsFieldSet(count)
+					feature_ptr->IsFieldSet(count)
 #endif
-							? QVariant(d_feature_ptr->GetFieldAsInteger(count))
+							? QVariant(feature_ptr->GetFieldAsInteger(count))
 							: QVariant(QVariant::Int);
 		}
 		else if (field_def_ptr->GetType()==OFTReal){
 			value_variant =
 #if GPLATES_GDAL_VERSION_NUM >= GPLATES_GDAL_COMPUTE_VERSION(2,2,0)
-					d_feature_ptr->IsFieldSetAndNotNull(count)
+					feature_ptr->IsFieldSetAndNotNull(count)
 #else
-					d_feature_ptr->IsFieldSet(count)
+					feature_ptr->IsFieldSet(count)
 #endif
-							? QVariant(d_feature_ptr->GetFieldAsDouble(count))
+							? QVariant(feature_ptr->GetFieldAsDouble(count))
 							: QVariant(QVariant::Double);
 		}
 		else if (field_def_ptr->GetType()==OFTDate)
@@ -1512,22 +2198,22 @@ GPlatesFileIO::OgrReader::get_attributes()
 			// fields separately if it becomes necessary.
 			value_variant =
 #if GPLATES_GDAL_VERSION_NUM >= GPLATES_GDAL_COMPUTE_VERSION(2,2,0)
-					d_feature_ptr->IsFieldSetAndNotNull(count)
+					feature_ptr->IsFieldSetAndNotNull(count)
 #else
-					d_feature_ptr->IsFieldSet(count)
+					feature_ptr->IsFieldSet(count)
 #endif
-							? QVariant(d_feature_ptr->GetFieldAsString(count))
+							? QVariant(feature_ptr->GetFieldAsString(count))
 							: QVariant(QVariant::String);
 		}
 		else
 		{ // If string or other type.
 			value_variant =
 #if GPLATES_GDAL_VERSION_NUM >= GPLATES_GDAL_COMPUTE_VERSION(2,2,0)
-					d_feature_ptr->IsFieldSetAndNotNull(count)
+					feature_ptr->IsFieldSetAndNotNull(count)
 #else
-					d_feature_ptr->IsFieldSet(count)
+					feature_ptr->IsFieldSet(count)
 #endif
-							? QVariant(d_feature_ptr->GetFieldAsString(count))
+							? QVariant(feature_ptr->GetFieldAsString(count))
 							: QVariant(QVariant::String);
 		}
 
@@ -1535,27 +2221,25 @@ GPlatesFileIO::OgrReader::get_attributes()
 		if (value_variant.isNull())
 		{
 			qDebug() << "Null field: " << field_def_ptr->GetNameRef()
-					<< "IsFieldSetAndNotNull: " << d_feature_ptr->IsFieldSetAndNotNull(count)
-					<< "IsFieldSet: " << d_feature_ptr->IsFieldSet(count)
-					<< "IsFieldNull: " << d_feature_ptr->IsFieldNull(count);
+					<< "IsFieldSetAndNotNull: " << feature_ptr->IsFieldSetAndNotNull(count)
+					<< "IsFieldSet: " << feature_ptr->IsFieldSet(count)
+					<< "IsFieldNull: " << feature_ptr->IsFieldNull(count);
 		}
 #endif
 
-		d_attributes.push_back(value_variant);
+		attributes.push_back(value_variant);
 	}
 }
 
-void
-GPlatesFileIO::OgrReader::add_attributes_to_feature(
-	const GPlatesModel::FeatureHandle::weak_ref &feature,
-	GPlatesFileIO::ReadErrorAccumulation &read_errors,
-	const boost::shared_ptr<GPlatesFileIO::DataSource> &source,
-	const boost::shared_ptr<GPlatesFileIO::LocationInDataSource> &location)
+boost::optional<GPlatesPropertyValues::GpmlKeyValueDictionary::non_null_ptr_type>
+GPlatesFileIO::OgrReader::create_attributes_dictionary(
+	const std::vector<QVariant> &attributes,
+	const QStringList &field_names)
 {
-	int n = static_cast<int>(d_attributes.size());
+	int n = static_cast<int>(attributes.size());
 	
 	// Can there be zero attributes? I dunno. 
-	if (n == 0) return;
+	if (n == 0) return boost::none;
 
 	// Create a key-value dictionary. This is empty and needs to have elements pushed back onto its d_elements vector. 
 	GPlatesPropertyValues::GpmlKeyValueDictionary::non_null_ptr_type dictionary = 
@@ -1563,14 +2247,14 @@ GPlatesFileIO::OgrReader::add_attributes_to_feature(
 
 	// If for any reason we've found more attributes than we have field names, only 
 	// go as far as the number of field names. 
-	if (n > d_field_names.size())
+	if (n > field_names.size())
 	{
-		n = d_field_names.size();
+		n = field_names.size();
 	}
 
 	for (int count = 0; count < n ; count++){
-		QString fieldname = d_field_names[count];
-		QVariant attribute = d_attributes[count];
+		QString fieldname = field_names[count];
+		QVariant attribute = attributes[count];
 
 		// A null attribute means the feature has no attribute (which is OK),
 		// we just don't add the attribute to the key/value dictionary
@@ -1635,11 +2319,28 @@ GPlatesFileIO::OgrReader::add_attributes_to_feature(
 
 	} // loop over number of attributes
 
+	return dictionary;
+}
+
+
+void
+GPlatesFileIO::OgrReader::add_attributes_to_feature(
+	const GPlatesModel::FeatureHandle::weak_ref &feature,
+	GPlatesFileIO::ReadErrorAccumulation &read_errors,
+	const boost::shared_ptr<GPlatesFileIO::DataSource> &source,
+	const boost::shared_ptr<GPlatesFileIO::LocationInDataSource> &location)
+{
+	// The dictionary was created by 'convert_features()'.
+	if (!d_converted_feature->attributes_dictionary)
+	{
+		return;
+	}
+
 	// Add the dictionary to the model.
 	feature->add(
 			GPlatesModel::TopLevelPropertyInline::create(
 				GPlatesModel::PropertyName::create_gpml("shapefileAttributes"),
-				dictionary));
+				d_converted_feature->attributes_dictionary.get()));
 
 	// Map the shapefile attributes to model properties.
 	map_attributes_to_properties(feature,d_model_to_attribute_map,read_errors,source,location);
@@ -1647,41 +2348,50 @@ GPlatesFileIO::OgrReader::add_attributes_to_feature(
 }
 
 
-bool
-GPlatesFileIO::OgrReader::transform_and_check_coords(
-		double &x,
-		double &y,
+boost::optional<GPlatesMaths::PointOnSphere>
+GPlatesFileIO::OgrReader::get_converted_point(
+		unsigned int point_index,
 		ReadErrorAccumulation &read_errors,
 		const boost::shared_ptr<GPlatesFileIO::DataSource> &source,
 		const boost::shared_ptr<GPlatesFileIO::LocationInDataSource> &location)
 {
+	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+			d_converted_feature &&
+				point_index < d_converted_feature->points.size(),
+			GPLATES_ASSERTION_SOURCE);
 
-	if (!d_current_coordinate_transformation->transform_in_place(&x,&y))
+	// The point was transformed and validated by 'convert_features()'.
+	// Here we just report any problems (in feature order).
+	const ConvertedPoint &converted_point = d_converted_feature->points[point_index];
+
+	switch (converted_point.status)
 	{
+	case ConvertedPoint::VALID:
+		return converted_point.point;
+
+	case ConvertedPoint::TRANSFORM_FAILED:
 		qWarning() << "Failed to transform coordinates";
-		return false;
-	}
+		break;
 
-	if (x < SHAPE_NO_DATA){
+	case ConvertedPoint::NO_LONGITUDE_DATA:
 		read_errors.d_recoverable_errors.push_back(
 					GPlatesFileIO::ReadErrorOccurrence(
 						source,
 						location,
 						GPlatesFileIO::ReadErrors::NoLongitudeShapeData,
 						GPlatesFileIO::ReadErrors::GeometryIgnored));
-		return false;
-	}
-	if (y < SHAPE_NO_DATA){
+		break;
+
+	case ConvertedPoint::NO_LATITUDE_DATA:
 		read_errors.d_recoverable_errors.push_back(
 					GPlatesFileIO::ReadErrorOccurrence(
 						source,
 						location,
 						GPlatesFileIO::ReadErrors::NoLatitudeShapeData,
 						GPlatesFileIO::ReadErrors::GeometryIgnored));
-		return false;
-	}
+		break;
 
-	if (!GPlatesMaths::LatLonPoint::is_valid_latitude(y)){
+	case ConvertedPoint::INVALID_LATITUDE:
 		read_errors.d_recoverable_errors.push_back(
 					GPlatesFileIO::ReadErrorOccurrence(
 						source,
@@ -1690,11 +2400,10 @@ GPlatesFileIO::OgrReader::transform_and_check_coords(
 						GPlatesFileIO::ReadErrors::GeometryIgnored));
 		// Increase precision to make sure numbers like 90.00000190700007 (an actual value in a Shapefile)
 		// don't get printed as 90.0.
-		qDebug() << "Invalid latitude: " << qSetRealNumberPrecision(16) << y;
-		return false;
-	}
+		qDebug() << "Invalid latitude: " << qSetRealNumberPrecision(16) << converted_point.y;
+		break;
 
-	if (!GPlatesMaths::LatLonPoint::is_valid_longitude(x)){
+	case ConvertedPoint::INVALID_LONGITUDE:
 		read_errors.d_recoverable_errors.push_back(
 					GPlatesFileIO::ReadErrorOccurrence(
 						source,
@@ -1703,11 +2412,45 @@ GPlatesFileIO::OgrReader::transform_and_check_coords(
 						GPlatesFileIO::ReadErrors::GeometryIgnored));
 		// Increase precision to make sure numbers very slightly less/greater than -360.0/360.0
 		// don't get printed -360.0/360.0.
-		qDebug() << "Invalid longitude: " << qSetRealNumberPrecision(16) << x;
-		return false;
+		qDebug() << "Invalid longitude: " << qSetRealNumberPrecision(16) << converted_point.x;
+		break;
 	}
 
-	return true;
+	return boost::none;
+}
+
+
+const GPlatesFileIO::OgrReader::ConvertedGeometry &
+GPlatesFileIO::OgrReader::get_converted_geometry(
+		unsigned int geometry_index)
+{
+	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+			d_converted_feature &&
+				geometry_index < d_converted_feature->geometries.size(),
+			GPLATES_ASSERTION_SOURCE);
+
+	const ConvertedGeometry &converted_geometry = d_converted_feature->geometries[geometry_index];
+
+	// The geometry was created by 'convert_features()'.
+	// Here we just report any problem creating it (in feature order).
+	if (converted_geometry.error)
+	{
+		throw std::runtime_error(converted_geometry.error.get());
+	}
+
+	// These throw an exception describing why the points are invalid.
+	if (converted_geometry.invalid_polyline_points)
+	{
+		GPlatesMaths::PolylineOnSphere::create(converted_geometry.invalid_polyline_points.get());
+	}
+	if (converted_geometry.invalid_polygon_exterior_ring)
+	{
+		GPlatesMaths::PolygonOnSphere::create(
+				converted_geometry.invalid_polygon_exterior_ring.get(),
+				converted_geometry.invalid_polygon_interior_rings);
+	}
+
+	return converted_geometry;
 }
 
 
@@ -1828,12 +2571,10 @@ GPlatesFileIO::OgrReader::handle_point(
 		const boost::shared_ptr<GPlatesFileIO::DataSource> &source,
 		const boost::shared_ptr<GPlatesFileIO::LocationInDataSource> &location)
 {
-	OGRPoint *ogr_point = static_cast<OGRPoint*>(d_geometry_ptr);
-	double x = ogr_point->getX();
-	double y = ogr_point->getY();
-	if (transform_and_check_coords(x,y,read_errors,source,location)){
-		GPlatesMaths::LatLonPoint llp(y,x);
-				GPlatesMaths::PointOnSphere point = GPlatesMaths::make_point_on_sphere(llp);
+	const boost::optional<GPlatesMaths::PointOnSphere> converted_point =
+			get_converted_point(0, read_errors, source, location);
+	if (converted_point){
+				const GPlatesMaths::PointOnSphere &point = converted_point.get();
 				try {
 					GPlatesModel::FeatureHandle::weak_ref feature =
 							create_point_feature_from_point_on_sphere(feature_type,collection,point,property);
@@ -1896,22 +2637,19 @@ GPlatesFileIO::OgrReader::handle_multi_point(
 
 		for(int count = 0; count < num_geometries; count++)
 		{
-			OGRPoint* ogr_point = static_cast<OGRPoint*>(multi->getGeometryRef(count));
-			double x = ogr_point->getX();
-			double y = ogr_point->getY();
-
-			if (transform_and_check_coords(x,y,read_errors,source,location)){
-				GPlatesMaths::LatLonPoint llp(y,x);
-				GPlatesMaths::PointOnSphere p = GPlatesMaths::make_point_on_sphere(llp);
-				list_of_points.push_back(p);
-
+			const boost::optional<GPlatesMaths::PointOnSphere> converted_point =
+					get_converted_point(count, read_errors, source, location);
+			if (converted_point){
+				list_of_points.push_back(converted_point.get());
 			}
 		} // loop over geometries
 
 		if (!list_of_points.empty())
 		{
 			try {
-				GPlatesModel::FeatureHandle::weak_ref feature = create_multi_point_feature_from_list(feature_type,collection,list_of_points,property);
+				const ConvertedGeometry &converted_geometry = get_converted_geometry(0);
+				GPlatesModel::FeatureHandle::weak_ref feature =
+						create_multi_point_feature(feature_type,collection,converted_geometry.multi_point.get(),property);
 				add_attributes_to_feature(feature,read_errors,source,location);
 				d_loaded_geometries++;
 			}
@@ -1963,13 +2701,11 @@ GPlatesFileIO::OgrReader::handle_linestring(
 			return;
 	}
 	int count;
-	double x,y;
 	for (count = 0; count < num_points; count ++){
-		x = linestring->getX(count);
-		y = linestring->getY(count);
-		if (transform_and_check_coords(x,y,read_errors,source,location)){
-			GPlatesMaths::LatLonPoint llp(y,x);
-			feature_points.push_back(GPlatesMaths::make_point_on_sphere(llp));
+		const boost::optional<GPlatesMaths::PointOnSphere> converted_point =
+				get_converted_point(count, read_errors, source, location);
+		if (converted_point){
+			feature_points.push_back(converted_point.get());
 		}
 		else{
 			return;
@@ -1978,7 +2714,9 @@ GPlatesFileIO::OgrReader::handle_linestring(
 	}
 
 	try {
-		GPlatesModel::FeatureHandle::weak_ref feature = create_line_feature_from_list(feature_type,collection,feature_points,property);
+		const ConvertedGeometry &converted_geometry = get_converted_geometry(0);
+		GPlatesModel::FeatureHandle::weak_ref feature =
+				create_line_feature(feature_type,collection,converted_geometry.polyline.get(),property);
 		add_attributes_to_feature(feature,read_errors,source,location);
 		d_loaded_geometries++;
 	}
@@ -2039,12 +2777,17 @@ GPlatesFileIO::OgrReader::handle_multi_linestring(
 	GPlatesModel::FeatureHandle::weak_ref feature = create_feature(feature_type,collection,d_feature_type_string,d_feature_id);
 	add_attributes_to_feature(feature,read_errors,source,location);	
 
+	// Index of the first converted point of the current linestring.
+	unsigned int point_index = 0;
+
 	for (int multiCount = 0; multiCount < num_geometries ; multiCount++){
 
 		std::vector<GPlatesMaths::PointOnSphere> feature_points;
 		OGRLineString *linestring = static_cast<OGRLineString*>(multi->getGeometryRef(multiCount));
 
 		int num_points = linestring->getNumPoints();
+		const unsigned int linestring_point_index = point_index;
+		point_index += num_points;
 		feature_points.reserve(num_points);
 		if (num_points < 2){	
 			// FIXME: May want to treat this as a warning, and accept the single-point line. 
@@ -2057,14 +2800,12 @@ GPlatesFileIO::OgrReader::handle_multi_linestring(
 			continue;
 		}
 		int count;
-		double x,y;
 
 		for (count = 0; count < num_points; count++){
-			x = linestring->getX(count);
-			y = linestring->getY(count);
-			if (transform_and_check_coords(x,y,read_errors,source,location)){
-				GPlatesMaths::LatLonPoint llp(y,x);
-				feature_points.push_back(GPlatesMaths::make_point_on_sphere(llp));
+			const boost::optional<GPlatesMaths::PointOnSphere> converted_point =
+					get_converted_point(linestring_point_index + count, read_errors, source, location);
+			if (converted_point){
+				feature_points.push_back(converted_point.get());
 			}
 			else{
 				feature_points.clear();
@@ -2075,7 +2816,8 @@ GPlatesFileIO::OgrReader::handle_multi_linestring(
 		if (!feature_points.empty())
 		{
 			try {
-				add_polyline_geometry_to_feature(feature,feature_points,property);
+				const ConvertedGeometry &converted_geometry = get_converted_geometry(multiCount);
+				add_polyline_geometry_to_feature(feature,converted_geometry.polyline.get(),property);
 				d_loaded_geometries++;
 			}
 			catch (std::exception &exc)
@@ -2117,10 +2859,13 @@ GPlatesFileIO::OgrReader::handle_polygon(
 	OGRPolygon *polygon = static_cast<OGRPolygon*>(d_geometry_ptr);
 	d_total_geometries++;
 
+	// Index of the first converted point of the current ring.
+	unsigned int ring_point_index = 0;
+
 	// Read the exterior ring points.
 	std::vector<GPlatesMaths::PointOnSphere> exterior_ring_points;
 	OGRLinearRing *exterior_ring = polygon->getExteriorRing();
-	add_ring_to_points_list(exterior_ring, exterior_ring_points, read_errors, source, location);
+	add_ring_to_points_list(exterior_ring, ring_point_index, exterior_ring_points, read_errors, source, location);
 
 	// If there are no points in the exterior ring then we don't create a polygon feature.
 	if (exterior_ring_points.empty())
@@ -2128,9 +2873,8 @@ GPlatesFileIO::OgrReader::handle_polygon(
 		return;
 	}
 
-	std::list< std::vector<GPlatesMaths::PointOnSphere> > interior_rings;
-
-	// Read the points in the interior rings.
+	// Read the points in the interior rings (to report any invalid points).
+	// Interior rings without (valid) points were excluded from the polygon by 'convert_features()'.
 	int num_interior_rings = polygon->getNumInteriorRings();
 	for (int ring_count = 0; ring_count < num_interior_rings; ring_count++)
 	{
@@ -2138,21 +2882,16 @@ GPlatesFileIO::OgrReader::handle_polygon(
 
 		std::vector<GPlatesMaths::PointOnSphere> interior_ring_points;
 		OGRLinearRing *interior_ring = polygon->getInteriorRing(ring_count);
-		add_ring_to_points_list(interior_ring, interior_ring_points, read_errors, source, location);
-
-		// Only add interior ring if it contains points.
-		if (!interior_ring_points.empty())
-		{
-			interior_rings.push_back(interior_ring_points);
-		}
+		add_ring_to_points_list(interior_ring, ring_point_index, interior_ring_points, read_errors, source, location);
 
 	} // loop over interior rings
 
 
 	try
 	{
-		GPlatesModel::FeatureHandle::weak_ref feature = create_polygon_feature_from_list(
-				feature_type, collection, exterior_ring_points, interior_rings, property);
+		const ConvertedGeometry &converted_geometry = get_converted_geometry(0);
+		GPlatesModel::FeatureHandle::weak_ref feature = create_polygon_feature(
+				feature_type, collection, converted_geometry.polygon.get(), property);
 		add_attributes_to_feature(feature, read_errors, source, location);
 		d_loaded_geometries++;
 	}
@@ -2208,25 +2947,31 @@ GPlatesFileIO::OgrReader::handle_multi_polygon(
 
 	d_total_geometries += num_geometries;
 
+	// Index of the first converted point of the current ring.
+	unsigned int ring_point_index = 0;
+
 	for (int multiCount = 0; multiCount < num_geometries ; multiCount++)
 	{
 		//std::cerr << "Polygon number: " << multiCount << std::endl;
 		OGRPolygon *polygon = static_cast<OGRPolygon*>(multi->getGeometryRef(multiCount));
 
+		// The converted points of the next polygon follow the points of this polygon's rings.
+		const unsigned int next_polygon_point_index = ring_point_index + get_num_polygon_points(polygon);
+
 		// Read the exterior ring points.
 		std::vector<GPlatesMaths::PointOnSphere> exterior_ring_points;
 		OGRLinearRing *exterior_ring = polygon->getExteriorRing();
-		add_ring_to_points_list(exterior_ring, exterior_ring_points, read_errors, source, location);
+		add_ring_to_points_list(exterior_ring, ring_point_index, exterior_ring_points, read_errors, source, location);
 
 		// If there are no points in the exterior ring then we don't add a polygon geometry.
 		if (exterior_ring_points.empty())
 		{
+			ring_point_index = next_polygon_point_index;
 			continue;
 		}
 
-		std::list< std::vector<GPlatesMaths::PointOnSphere> > interior_rings;
-
-		// Read the points in the interior rings.
+		// Read the points in the interior rings (to report any invalid points).
+		// Interior rings without (valid) points were excluded from the polygon by 'convert_features()'.
 		int num_interior_rings = polygon->getNumInteriorRings();
 		for (int ring_count = 0; ring_count < num_interior_rings; ring_count++)
 		{
@@ -2234,19 +2979,14 @@ GPlatesFileIO::OgrReader::handle_multi_polygon(
 
 			std::vector<GPlatesMaths::PointOnSphere> interior_ring_points;
 			OGRLinearRing *interior_ring = polygon->getInteriorRing(ring_count);
-			add_ring_to_points_list(interior_ring, interior_ring_points, read_errors, source, location);
-
-			// Only add interior ring if it contains points.
-			if (!interior_ring_points.empty())
-			{
-				interior_rings.push_back(interior_ring_points);
-			}
+			add_ring_to_points_list(interior_ring, ring_point_index, interior_ring_points, read_errors, source, location);
 
 		} // loop over interior rings
 
 		try
 		{	
-			add_polygon_geometry_to_feature(feature, exterior_ring_points, interior_rings, property);
+			const ConvertedGeometry &converted_geometry = get_converted_geometry(multiCount);
+			add_polygon_geometry_to_feature(feature, converted_geometry.polygon.get(), property);
 			d_loaded_geometries++;
 		}
 		catch (std::exception &exc)
@@ -2336,6 +3076,7 @@ GPlatesFileIO::OgrReader::read_srs_and_set_transformation(
 void
 GPlatesFileIO::OgrReader::add_ring_to_points_list(
 	OGRLinearRing *ring, 
+	unsigned int &ring_point_index,
 	std::vector<GPlatesMaths::PointOnSphere> &ring_points,
 	ReadErrorAccumulation &read_errors,
 	const boost::shared_ptr<GPlatesFileIO::DataSource> &source,
@@ -2349,11 +3090,14 @@ GPlatesFileIO::OgrReader::add_ring_to_points_list(
 
 	int num_points;
 	int count;
-	double x,y;
 
 	ring_points.clear();
 
 	num_points = ring->getNumPoints();
+
+	// The index of this ring's first converted point (and advance past this ring's points).
+	const unsigned int first_point_index = ring_point_index;
+	ring_point_index += num_points;
  
 	// TODO: check is this FIXME note relevant now...
 	// FIXME: Check if the shapefile format demands that a polygon must have
@@ -2373,11 +3117,10 @@ GPlatesFileIO::OgrReader::add_ring_to_points_list(
 	ring_points.reserve(num_points);
 
 	for (count = 0; count < num_points; count++){
-		x = ring->getX(count);
-		y = ring->getY(count);
-		if (transform_and_check_coords(x,y,read_errors,source,location)){
-			GPlatesMaths::LatLonPoint llp(y,x);
-			ring_points.push_back(GPlatesMaths::make_point_on_sphere(llp));
+		const boost::optional<GPlatesMaths::PointOnSphere> converted_point =
+				get_converted_point(first_point_index + count, read_errors, source, location);
+		if (converted_point){
+			ring_points.push_back(converted_point.get());
 		}
 		else{
 			// One of our points is invalid. We can't create a feature, so clear the std::vector.
@@ -34,6 +34,7 @@
 #include <vector>
 #include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
+#include <QVariant>
 
 #include "GdalUtils.h"
 #include "FeatureCollectionFileFormatConfigurations.h"
@@ -43,11 +44,17 @@
 #include "PropertyMapper.h"
 #include "ReadErrorAccumulation.h"
 
+#include "maths/MultiPointOnSphere.h"
+#include "maths/PointOnSphere.h"
+#include "maths/PolygonOnSphere.h"
+#include "maths/PolylineOnSphere.h"
+
 #include "model/FeatureCollectionHandle.h"
 #include "model/GpgimProperty.h"
 #include "model/ModelInterface.h"
 #include "model/ModelUtils.h"
 #include "property-values/CoordinateTransformation.h"
+#include "property-values/GpmlKeyValueDictionary.h"
 #include "property-values/SpatialReferenceSystem.h"
 
 
@@ -114,6 +121,11 @@ namespace GPlatesFileIO
 
 	private:
 
+		struct ConvertedPoint;
+		struct ConvertedGeometry;
+		struct ConvertedFeature;
+		class ConvertFeatures;
+
 		OgrReader();
 
 		~OgrReader();
@@ -149,8 +161,22 @@ namespace GPlatesFileIO
 		get_field_names(
 				ReadErrorAccumulation &read_errors);
 
+		static
 		void
-		get_attributes();
+		get_attributes(
+				std::vector<QVariant> &attributes,
+				OGRFeature *feature,
+				OGRFeatureDefn *feature_def);
+
+		/**
+		 * Creates a "gpml:shapefileAttributes" key-value dictionary from @a attributes
+		 * (returns none if there are no attributes).
+		 */
+		static
+		boost::optional<GPlatesPropertyValues::GpmlKeyValueDictionary::non_null_ptr_type>
+		create_attributes_dictionary(
+				const std::vector<QVariant> &attributes,
+				const QStringList &field_names);
 
 		void
 		handle_geometry(
@@ -223,19 +249,38 @@ namespace GPlatesFileIO
 				const GPlatesModel::FeatureCollectionHandle::weak_ref &collection,
 				ReadErrorAccumulation &read_errors);
 
+		/**
+		 * Extracts the attributes and geometry points of a batch of OGR features, converts
+		 * the points to WGS84 points on the sphere and creates the geometries and attribute
+		 * dictionaries (in parallel).
+		 */
+		void
+		convert_features(
+				const std::vector<OGRFeature *> &ogr_features,
+				std::vector<ConvertedFeature> &converted_features);
+
+		/**
+		 * Creates a feature from the current OGR feature (and its converted feature).
+		 */
+		void
+		read_feature(
+				const GPlatesModel::FeatureCollectionHandle::weak_ref &collection,
+				ReadErrorAccumulation &read_errors,
+				const boost::shared_ptr<GPlatesFileIO::DataSource> &source,
+				const boost::shared_ptr<GPlatesFileIO::LocationInDataSource> &location);
+
 		const GPlatesModel::FeatureHandle::weak_ref
-		create_polygon_feature_from_list(
+		create_polygon_feature(
 				const GPlatesModel::FeatureType &feature_type,
 				const GPlatesModel::FeatureCollectionHandle::weak_ref &collection,
-				const std::vector<GPlatesMaths::PointOnSphere> &exterior_ring,
-				const std::list< std::vector<GPlatesMaths::PointOnSphere> > &interior_rings,
+				const GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type &polygon_on_sphere,
 				const boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> &property);
 
 		const GPlatesModel::FeatureHandle::weak_ref
-		create_line_feature_from_list(
+		create_line_feature(
 				const GPlatesModel::FeatureType &feature_type,
 				const GPlatesModel::FeatureCollectionHandle::weak_ref &collection,
-				const std::vector<GPlatesMaths::PointOnSphere> &list_of_points,
+				const GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type &polyline,
 				const boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> &property);
 
 		const GPlatesModel::FeatureHandle::weak_ref
@@ -246,10 +291,10 @@ namespace GPlatesFileIO
 				const boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> &property);
 
 		const GPlatesModel::FeatureHandle::weak_ref
-		create_multi_point_feature_from_list(
+		create_multi_point_feature(
 				const GPlatesModel::FeatureType &feature_type,
 				const GPlatesModel::FeatureCollectionHandle::weak_ref &collection,
-				const std::vector<GPlatesMaths::PointOnSphere> &list_of_points,
+				const GPlatesMaths::MultiPointOnSphere::non_null_ptr_to_const_type &multi_point_on_sphere,
 				const boost::optional<GPlatesModel::GpgimProperty::non_null_ptr_to_const_type> &property);
 
 		void
@@ -259,14 +304,31 @@ namespace GPlatesFileIO
 				const boost::shared_ptr<GPlatesFileIO::DataSource> &source,
 				const boost::shared_ptr<GPlatesFileIO::LocationInDataSource> &location);
 
-		bool
-		transform_and_check_coords(
-				double &x,
-				double &y,
+		/**
+		 * Returns the converted point at @a point_index in the current converted feature, or
+		 * none (and reports why) if the point could not be transformed or is invalid.
+		 *
+		 * Points are indexed in the order they are visited in the OGR geometry.
+		 */
+		boost::optional<GPlatesMaths::PointOnSphere>
+		get_converted_point(
+				unsigned int point_index,
 				ReadErrorAccumulation &read_errors,
 				const boost::shared_ptr<GPlatesFileIO::DataSource> &source,
 				const boost::shared_ptr<GPlatesFileIO::LocationInDataSource> &location);
 
+		/**
+		 * Returns the geometry at @a geometry_index in the current converted feature.
+		 *
+		 * Geometries are indexed by their position in the OGR geometry (eg, the polygon index
+		 * of a multi-polygon).
+		 *
+		 * @throws std::runtime_error if the geometry could not be created.
+		 */
+		const ConvertedGeometry &
+		get_converted_geometry(
+				unsigned int geometry_index);
+
 		void
 		display_feature_counts();
 
@@ -282,9 +344,14 @@ namespace GPlatesFileIO
 				File::Reference &file_ref,
 				const GPlatesFileIO::FeatureCollectionFileFormat::OGRConfiguration::shared_ptr_to_const_type &default_ogr_file_configuration);
 
+		/**
+		 * @a ring_point_index is the index of the ring's first converted point and is advanced
+		 * past the ring's points.
+		 */
 		void
 		add_ring_to_points_list(
 				OGRLinearRing *ring,
+				unsigned int &ring_point_index,
 				std::vector<GPlatesMaths::PointOnSphere> &ring_points,
 				ReadErrorAccumulation &read_errors,
 				const boost::shared_ptr<GPlatesFileIO::DataSource> &source,
@@ -312,6 +379,9 @@ namespace GPlatesFileIO
 		/// The shapefile attributes for the current geometry.
 		std::vector<QVariant> d_attributes;
 
+		/// The attributes and converted geometry points of the current feature.
+		const ConvertedFeature *d_converted_feature;
+
 		/// Map for associating a model property with a shapefile attribute.
 		QMap<QString,QString> d_model_to_attribute_map;
 
@@ -723,29 +723,45 @@ namespace{
 		}
 	}
 
+	/**
+	 * Sets the points of an OGR line string (or linear ring) to the specified lat/lon points.
+	 *
+	 * All points are transformed with a single coordinate transformation call and added to
+	 * the line string at once (instead of transforming and adding one point at a time).
+	 */
 	void
-	add_polyline_to_ogr_line_string(
+	set_ogr_line_string_points(
 			OGRLineString &ogr_line_string,
-			const LatLonPolyline &lat_lon_polyline,
+			const lat_lon_points_seq_type &lat_lon_points,
 			const GPlatesPropertyValues::CoordinateTransformation::non_null_ptr_to_const_type &coordinate_transformation)
 	{
-		lat_lon_points_seq_type::const_iterator 
-			line_iter = lat_lon_polyline.line.begin(),
-			line_end = lat_lon_polyline.line.end();
+		const unsigned int num_points = lat_lon_points.size();
+		if (num_points == 0)
+		{
+			return;
+		}
 
-		for (; line_iter != line_end ; ++line_iter)
+		std::vector<double> x(num_points);
+		std::vector<double> y(num_points);
+		for (unsigned int n = 0; n < num_points; ++n)
 		{
-			OGRPoint ogr_point;
+			const GPlatesMaths::LatLonPoint &llp = lat_lon_points[n];
+			x[n] = llp.longitude();
+			y[n] = llp.latitude();
+		}
 
-			const GPlatesMaths::LatLonPoint &llp = *line_iter;
-			double x = llp.longitude();
-			double y = llp.latitude();
-			coordinate_transformation->transform_in_place(&x,&y);
-			ogr_point.setX(x);
-			ogr_point.setY(y);
+		coordinate_transformation->transform_in_place(num_points, &x[0], &y[0]);
 
-			ogr_line_string.addPoint(&ogr_point);
-		}
+		ogr_line_string.setPoints(num_points, &x[0], &y[0]);
+	}
+
+	void
+	add_polyline_to_ogr_line_string(
+			OGRLineString &ogr_line_string,
+			const LatLonPolyline &lat_lon_polyline,
+			const GPlatesPropertyValues::CoordinateTransformation::non_null_ptr_to_const_type &coordinate_transformation)
+	{
+		set_ogr_line_string_points(ogr_line_string, lat_lon_polyline.line, coordinate_transformation);
 	}
 
 	void
@@ -793,23 +809,7 @@ namespace{
 	{
 		OGRLinearRing ogr_linear_ring;
 
-		lat_lon_points_seq_type::const_iterator 
-			line_iter = lat_lon_polygon_ring.begin(),
-			line_end = lat_lon_polygon_ring.end();
-
-		for (; line_iter != line_end ; ++line_iter)
-		{
-			OGRPoint ogr_point;
-
-			const GPlatesMaths::LatLonPoint &llp = *line_iter;
-			double x = llp.longitude();
-			double y = llp.latitude();
-			coordinate_transformation->transform_in_place(&x,&y);
-			ogr_point.setX(x);
-			ogr_point.setY(y);
-
-			ogr_linear_ring.addPoint(&ogr_point);
-		}
+		set_ogr_line_string_points(ogr_linear_ring, lat_lon_polygon_ring, coordinate_transformation);
 
 		// Close the ring. GPlates stores polygons such that first-point != last-point; the 
 		// ESRI shapefile specification says that polygon rings must be closed (first-point == last-point). 
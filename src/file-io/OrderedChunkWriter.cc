@@ -0,0 +1,125 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <boost/bind/bind.hpp>
+
+#include "OrderedChunkWriter.h"
+
+
+GPlatesFileIO::OrderedChunkWriter::OrderedChunkWriter(
+		QIODevice &device,
+		unsigned int max_num_pending_chunks) :
+	d_device(device),
+	d_max_num_pending_chunks(max_num_pending_chunks > 0 ? max_num_pending_chunks : 1),
+	d_finished_appending(false),
+	d_error_writing(false)
+{
+	d_writer_thread.reset(
+			new boost::thread(boost::bind(&OrderedChunkWriter::write_chunks, this)));
+}
+
+
+GPlatesFileIO::OrderedChunkWriter::~OrderedChunkWriter()
+{
+	// Since this is a destructor we cannot let any exceptions escape.
+	try
+	{
+		finish();
+	}
+	catch (...)
+	{
+	}
+}
+
+
+void
+GPlatesFileIO::OrderedChunkWriter::append(
+		const QByteArray &chunk)
+{
+	{
+		boost::mutex::scoped_lock lock(d_mutex);
+
+		// Wait for the writer thread to catch up.
+		while (d_pending_chunks.size() >= d_max_num_pending_chunks)
+		{
+			d_chunk_removed_condition.wait(lock);
+		}
+
+		d_pending_chunks.push_back(chunk);
+	}
+
+	d_chunk_appended_condition.notify_one();
+}
+
+
+bool
+GPlatesFileIO::OrderedChunkWriter::finish()
+{
+	if (d_writer_thread)
+	{
+		{
+			boost::mutex::scoped_lock lock(d_mutex);
+			d_finished_appending = true;
+		}
+		d_chunk_appended_condition.notify_one();
+
+		d_writer_thread->join();
+		d_writer_thread.reset();
+	}
+
+	return !d_error_writing;
+}
+
+
+void
+GPlatesFileIO::OrderedChunkWriter::write_chunks()
+{
+	while (true)
+	{
+		QByteArray chunk;
+
+		{
+			boost::mutex::scoped_lock lock(d_mutex);
+
+			while (d_pending_chunks.empty() &&
+				!d_finished_appending)
+			{
+				d_chunk_appended_condition.wait(lock);
+			}
+
+			// If there are no more chunks then we're finished.
+			if (d_pending_chunks.empty())
+			{
+				return;
+			}
+
+			chunk = d_pending_chunks.front();
+			d_pending_chunks.pop_front();
+		}
+
+		d_chunk_removed_condition.notify_one();
+
+		// Only the writer thread accesses the error flag until it's joined.
+		if (!d_error_writing &&
+			d_device.write(chunk) != chunk.size())
+		{
+			d_error_writing = true;
+		}
+	}
+}
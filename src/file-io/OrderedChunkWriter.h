@@ -0,0 +1,123 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILE_IO_ORDEREDCHUNKWRITER_H
+#define GPLATES_FILE_IO_ORDEREDCHUNKWRITER_H
+
+#include <deque>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <QByteArray>
+#include <QIODevice>
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * Writes chunks of bytes to a device, in the order they are appended, on a separate thread.
+	 *
+	 * This is useful when the chunks are formatted by the caller (possibly on multiple threads)
+	 * since writing to the device then overlaps with the formatting of the next chunks.
+	 *
+	 * Appending blocks while too many chunks are waiting to be written (this limits the memory used).
+	 *
+	 * NOTE: The device is accessed exclusively by the writer thread (until @a finish is called),
+	 * so it must not be used by anything else in the meantime.
+	 */
+	class OrderedChunkWriter :
+			private boost::noncopyable
+	{
+	public:
+
+		/**
+		 * Maximum number of chunks waiting to be written before @a append blocks.
+		 */
+		static const unsigned int DEFAULT_MAX_NUM_PENDING_CHUNKS = 4;
+
+
+		/**
+		 * Starts the writer thread.
+		 *
+		 * @param device The device to write to - it should already be open for writing.
+		 */
+		explicit
+		OrderedChunkWriter(
+				QIODevice &device,
+				unsigned int max_num_pending_chunks = DEFAULT_MAX_NUM_PENDING_CHUNKS);
+
+		/**
+		 * Calls @a finish.
+		 */
+		~OrderedChunkWriter();
+
+		/**
+		 * Queues @a chunk to be written after all previously appended chunks.
+		 *
+		 * Blocks while the maximum number of chunks are waiting to be written.
+		 */
+		void
+		append(
+				const QByteArray &chunk);
+
+		/**
+		 * Waits for all appended chunks to be written and stops the writer thread.
+		 *
+		 * Returns false if writing to the device failed (in which case any chunks after the
+		 * failed write were discarded).
+		 */
+		bool
+		finish();
+
+	private:
+
+		QIODevice &d_device;
+		unsigned int d_max_num_pending_chunks;
+
+		boost::scoped_ptr<boost::thread> d_writer_thread;
+
+		//
+		// The following are shared with the writer thread (and protected by the mutex).
+		//
+
+		boost::mutex d_mutex;
+
+		//! Signalled when a chunk has been appended (or no more chunks will be appended).
+		boost::condition_variable d_chunk_appended_condition;
+
+		//! Signalled when a chunk has been removed from the queue to be written.
+		boost::condition_variable d_chunk_removed_condition;
+
+		std::deque<QByteArray> d_pending_chunks;
+
+		bool d_finished_appending;
+		bool d_error_writing;
+
+
+		/**
+		 * The writer thread function.
+		 */
+		void
+		write_chunks();
+	};
+}
+
+#endif // GPLATES_FILE_IO_ORDEREDCHUNKWRITER_H
@@ -35,10 +35,10 @@
 #include <QDebug>
 #include <QFile>
 #include <QString>
-#include <QTextStream>
 
 #include "ReadErrors.h"
 #include "LineReader.h"
+#include "LineTokenizer.h"
 
 #include "feature-visitors/PropertyValueFinder.h"
 
@@ -1792,7 +1792,7 @@ qDebug() << "use_tail_next = " << use_tail_next;
 			point_seq_type &points,
 			PlotterCodes::PlotterCode expected_code)
 	{
-		QString line;
+		GPlatesFileIO::LineReader::Line line;
 		if ( ! in.getline(line)) {
 			// Since we're in this function, we're expecting to read a point.  But we
 			// couldn't find one.  So, let's complain.
@@ -1802,14 +1802,12 @@ qDebug() << "use_tail_next = " << use_tail_next;
 		int plotter;
 		double latitude, longitude;
 
-		QTextStream line_stream(&line, QIODevice::ReadOnly);
-		// By default QTextStream attempts to detect the base of integers.
-		// We turn this off and set base to decimal since we don't want numbers
-		// like 012 being interpreted as octal (since has an '0' at front).
-		line_stream.setIntegerBase(10);
-
-		line_stream >> latitude >> longitude >> plotter;
-		if (line_stream.status() != QTextStream::Ok)
+		// Parse the line in place (integers are parsed as decimal so that numbers
+		// like 012 are not interpreted as octal).
+		GPlatesFileIO::LineTokenizer line_tokenizer(line);
+		if (!line_tokenizer.read(latitude) ||
+			!line_tokenizer.read(longitude) ||
+			!line_tokenizer.read(plotter))
 		{
 			throw GPlatesFileIO::ReadErrors::InvalidPlatesPolylinePoint;
 		}
@@ -35,7 +35,6 @@
 #include <loki/ScopeGuard.h>
 #include <QFile>
 #include <QString>
-#include <QTextStream>
 
 #include <boost/foreach.hpp>
 #include <boost/optional.hpp>
@@ -44,6 +43,7 @@
 #include "PlatesRotationFormatReader.h"
 #include "PlatesRotationFileProxy.h"
 #include "LineReader.h"
+#include "LineTokenizer.h"
 
 #include "app-logic/RotationUtils.h"
 
@@ -102,7 +102,7 @@ namespace
 	 */
 	void
 	extract_comment(
-			QTextStream &line_stream,
+			GPlatesFileIO::LineTokenizer &line_tokenizer,
 			QString &comment,
 			boost::shared_ptr<GPlatesFileIO::DataSource> data_source,
 			unsigned line_num,
@@ -110,21 +110,10 @@ namespace
 	{
 		using namespace GPlatesFileIO;
 
-		// Read rest of line.
-		const QString remainder = line_stream.readAll();
+		// Read rest of line (with leading whitespace skipped).
+		const LineReader::Line remainder = line_tokenizer.remainder();
 
-		// Find the first non-whitespace character in 'remainder'.
-		const int remainder_size = remainder.size();
-		int index_of_first_non_whitespace = 0;
-		for (; index_of_first_non_whitespace < remainder_size; ++index_of_first_non_whitespace)
-		{
-			if (!remainder.at(index_of_first_non_whitespace).isSpace())
-			{
-				break;
-			}
-		}
-
-		if (index_of_first_non_whitespace == remainder_size)
+		if (remainder.begin == remainder.end)
 		{
 			// No non-whitespace characters were found in the remainder, not even an
 			// exclamation mark.  Let's handle the problem by creating an empty comment
@@ -140,7 +129,7 @@ namespace
 			// Non-whitespace characters were found.  We'll assume these are intended
 			// to be the start of the comment.  Is the first character an exclamation
 			// mark?
-			if (remainder[index_of_first_non_whitespace] != '!')
+			if (*remainder.begin != '!')
 			{
 				// No, it's not an exclamation mark.  Let's handle the problem by
 				// pretending that the first character *was* an exclamation mark.
@@ -150,12 +139,12 @@ namespace
 				ReadErrorOccurrence read_error(data_source, location, descr, res);
 				read_errors.d_warnings.push_back(read_error);
 
-				comment = remainder.mid(index_of_first_non_whitespace);
+				comment = remainder.to_qstring();
 			}
 			else
 			{
 				// Remove the exclamation mark.
-				comment = remainder.mid(index_of_first_non_whitespace + 1);
+				comment = QString::fromUtf8(remainder.begin + 1, remainder.end - remainder.begin - 1);
 			}
 		}
 	}
@@ -172,7 +161,7 @@ namespace
 	 */
 	GPlatesPropertyValues::GpmlTimeSample
 	parse_pole(
-			QTextStream &line_stream,
+			GPlatesFileIO::LineTokenizer &line_tokenizer,
 			GPlatesModel::integer_plate_id_type &fixed_plate_id,
 			GPlatesModel::integer_plate_id_type &moving_plate_id,
 			boost::shared_ptr<GPlatesFileIO::DataSource> data_source,
@@ -191,8 +180,7 @@ namespace
 		double pole_longitude;
 		double rotation_angle;
 
-		line_stream >> moving_plate_id;
-		if (line_stream.status() != QTextStream::Ok)
+		if (!line_tokenizer.read(moving_plate_id))
 		{
 			boost::shared_ptr<LocationInDataSource> location(new LineNumber(line_num));
 			ReadErrors::Description descr = ReadErrors::ErrorReadingMovingPlateId;
@@ -202,8 +190,7 @@ namespace
 
 			throw PoleParsingException();
 		}
-		line_stream >> geo_time;
-		if (line_stream.status() != QTextStream::Ok)
+		if (!line_tokenizer.read(geo_time))
 		{
 			boost::shared_ptr<LocationInDataSource> location(new LineNumber(line_num));
 			ReadErrors::Description descr = ReadErrors::ErrorReadingGeoTime;
@@ -213,8 +200,7 @@ namespace
 
 			throw PoleParsingException();
 		}
-		line_stream >> pole_latitude;
-		if (line_stream.status() != QTextStream::Ok)
+		if (!line_tokenizer.read(pole_latitude))
 		{
 			boost::shared_ptr<LocationInDataSource> location(new LineNumber(line_num));
 			ReadErrors::Description descr = ReadErrors::ErrorReadingPoleLatitude;
@@ -224,8 +210,7 @@ namespace
 
 			throw PoleParsingException();
 		}
-		line_stream >> pole_longitude;
-		if (line_stream.status() != QTextStream::Ok)
+		if (!line_tokenizer.read(pole_longitude))
 		{
 			boost::shared_ptr<LocationInDataSource> location(new LineNumber(line_num));
 			ReadErrors::Description descr = ReadErrors::ErrorReadingPoleLongitude;
@@ -235,8 +220,7 @@ namespace
 
 			throw PoleParsingException();
 		}
-		line_stream >> rotation_angle;
-		if (line_stream.status() != QTextStream::Ok)
+		if (!line_tokenizer.read(rotation_angle))
 		{
 			boost::shared_ptr<LocationInDataSource> location(new LineNumber(line_num));
 			ReadErrors::Description descr = ReadErrors::ErrorReadingRotationAngle;
@@ -246,8 +230,7 @@ namespace
 
 			throw PoleParsingException();
 		}
-		line_stream >> fixed_plate_id;
-		if (line_stream.status() != QTextStream::Ok)
+		if (!line_tokenizer.read(fixed_plate_id))
 		{
 			boost::shared_ptr<LocationInDataSource> location(new LineNumber(line_num));
 			ReadErrors::Description descr = ReadErrors::ErrorReadingFixedPlateId;
@@ -260,7 +243,7 @@ namespace
 
 		// Now, from the remainder of the input line, extract the comment.
 		QString comment;
-		extract_comment(line_stream, comment, data_source, line_num, read_errors);
+		extract_comment(line_tokenizer, comment, data_source, line_num, read_errors);
 
 		// Did the pole have valid lat and lon?
 		if ( ! GPlatesMaths::LatLonPoint::is_valid_latitude(pole_latitude))
@@ -783,7 +766,7 @@ namespace
 			GPlatesFileIO::ReadErrorAccumulation &read_errors,
 			bool &contains_unsaved_changes)
 	{
-		QString line_of_input;
+		GPlatesFileIO::LineReader::Line line_of_input;
 
 		// When this iterator is default-constructed, it is not valid for dereferencing.
 		GPlatesModel::FeatureHandle::weak_ref current_total_recon_seq;
@@ -792,18 +775,16 @@ namespace
 
 		while (line_buffer.getline(line_of_input))
 		{
-			QTextStream line_stream(&line_of_input, QIODevice::ReadOnly);
-			// By default QTextStream attempts to detect the base of integers.
-			// We turn this off and set base to decimal since we don't want plate IDs
-			// like 012 being interpreted as octal (since has an '0' at front).
-			line_stream.setIntegerBase(10);
+			// Parse the line in place (integers are parsed as decimal so that plate IDs
+			// like 012 are not interpreted as octal).
+			GPlatesFileIO::LineTokenizer line_tokenizer(line_of_input);
 
 			GPlatesModel::integer_plate_id_type fixed_plate_id, moving_plate_id;
 
 			try
 			{
 				GPlatesPropertyValues::GpmlTimeSample time_sample =
-						parse_pole(line_stream, fixed_plate_id, moving_plate_id,
+						parse_pole(line_tokenizer, fixed_plate_id, moving_plate_id,
 								data_source, line_buffer.line_number(),
 								read_errors);
 
@@ -97,3 +97,20 @@ GPlatesFileIO::RasterBandReader::get_type(
 {
 	return d_raster_reader->get_type(d_band_number, read_errors);
 }
+
+
+boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type>
+GPlatesFileIO::RasterBandReader::get_decimated_raw_raster(
+		unsigned int level,
+		const QRect &region,
+		ReadErrorAccumulation *read_errors)
+{
+	return d_raster_reader->get_decimated_raw_raster(d_band_number, level, region, read_errors);
+}
+
+
+bool
+GPlatesFileIO::RasterBandReader::is_raster_file_cache_complete()
+{
+	return d_raster_reader->is_raster_file_cache_complete(d_band_number);
+}
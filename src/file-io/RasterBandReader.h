@@ -98,6 +98,15 @@ namespace GPlatesFileIO
 				const QRect &region = QRect(),
 				ReadErrorAccumulation *read_errors = NULL);
 
+		boost::optional<GPlatesGlobal::PointerTraits<GPlatesPropertyValues::RawRaster>::non_null_ptr_type>
+		get_decimated_raw_raster(
+				unsigned int level,
+				const QRect &region,
+				ReadErrorAccumulation *read_errors = NULL);
+
+		bool
+		is_raster_file_cache_complete();
+
 	private:
 
 		GPlatesGlobal::PointerTraits<RasterReader>::non_null_ptr_type d_raster_reader;
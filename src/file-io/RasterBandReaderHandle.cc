@@ -72,3 +72,20 @@ GPlatesFileIO::RasterBandReaderHandle::get_type(
 {
 	return d_raster_band_reader.get_type(read_errors);
 }
+
+
+boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type>
+GPlatesFileIO::RasterBandReaderHandle::get_decimated_raw_raster(
+		unsigned int level,
+		const QRect &region,
+		ReadErrorAccumulation *read_errors)
+{
+	return d_raster_band_reader.get_decimated_raw_raster(level, region, read_errors);
+}
+
+
+bool
+GPlatesFileIO::RasterBandReaderHandle::is_raster_file_cache_complete()
+{
+	return d_raster_band_reader.is_raster_file_cache_complete();
+}
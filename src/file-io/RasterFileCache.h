@@ -27,6 +27,7 @@
 #define GPLATES_FILE_IO_RASTERFILECACHE_H
 
 #include <exception>
+#include <boost/bind/bind.hpp>
 #include <boost/shared_ptr.hpp>
 #include <QDateTime>
 #include <QDebug>
@@ -38,11 +39,13 @@
 #include "MipmappedRasterFormatWriter.h"
 #include "RasterBandReaderHandle.h"
 #include "RasterFileCacheFormat.h"
+#include "RasterFileCacheWriteLock.h"
 #include "SourceRasterFileCacheFormatReader.h"
 #include "TemporaryFileRegistry.h"
 
 #include "global/AssertionFailureException.h"
 #include "global/GPlatesAssert.h"
+#include "global/LogException.h"
 
 #include "gui/Mipmapper.h"
 
@@ -93,6 +96,10 @@ namespace GPlatesFileIO
 		 * Note that since the mipmap file might get removed during this function, the caller
 		 * should not have any open file handles and hence not have any existing
 		 * @a MipmappedRasterFormatReader referencing the source raster.
+
+		 *
+		 * If the mipmap file needs to be generated then its progress is reported to
+		 * @a progress_callback (if specified).
 		 */
 		template <
 				class ProxiedRawRasterType,
@@ -103,7 +110,8 @@ namespace GPlatesFileIO
 				const typename ProxiedRawRasterType::non_null_ptr_type &proxied_raw_raster,
 				GPlatesFileIO::RasterBandReaderHandle raster_band_reader_handle,
 				const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette =
-						GPlatesGui::RasterColourPalette::create());
+						GPlatesGui::RasterColourPalette::create(),
+				const mipmap_progress_callback_type &progress_callback = mipmap_progress_callback_type());
 
 
 		namespace Internals
@@ -115,6 +123,8 @@ namespace GPlatesFileIO
 			 *  - cannot write to mipmap file, or
 			 *  - the element type of @a proxied_raw_raster is not that of its associated raster band reader, or
 			 *  - there is an error writing to the mipmap file.
+			 *
+			 * The progress of mipmapping is reported to @a progress_callback (if specified).
 			 */
 			template <
 					class ProxiedRawRasterType,
@@ -123,7 +133,8 @@ namespace GPlatesFileIO
 			create_mipmap_file(
 					const typename ProxiedRawRasterType::non_null_ptr_type &proxied_raw_raster,
 					GPlatesFileIO::RasterBandReaderHandle raster_band_reader_handle,
-					const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette)
+					const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette,
+					const mipmap_progress_callback_type &progress_callback)
 			{
 				PROFILE_FUNC();
 
@@ -144,16 +155,6 @@ namespace GPlatesFileIO
 					colour_palette_id = RasterFileCacheFormat::get_colour_palette_id(colour_palette);
 				}
 
-				boost::optional<QString> mipmap_filename =
-						RasterFileCacheFormat::get_writable_mipmap_cache_filename(
-								filename, band_number, colour_palette_id);
-
-				if (!mipmap_filename)
-				{
-					// Can't write mipmap file anywhere.
-					return false;
-				}
-
 				// Check the type of the source raster band.
 				typedef typename ProxiedRawRasterType::element_type element_type;
 				if (raster_band_reader_handle.get_type() !=
@@ -162,26 +163,56 @@ namespace GPlatesFileIO
 					return false;
 				}
 
+				boost::optional<QString> mipmap_filename;
+				QString partial_mipmap_filename;
+
 				// Write the mipmap file.
 				try
 				{
+					// Another thread (in this process) might be writing the same mipmap file, in which
+					// case wait for it to finish. The progress callback is called (with no progress)
+					// while waiting so that it can cancel the wait by throwing.
+					RasterFileCacheWriteLock write_lock(
+							RasterFileCacheWriteLock::get_mipmap_cache_id(filename, band_number, colour_palette_id),
+							progress_callback
+									? RasterFileCacheWriteLock::check_cancelled_callback_type(
+											boost::bind(progress_callback, 0, 1))
+									: RasterFileCacheWriteLock::check_cancelled_callback_type());
+
+					// If it was written while we were waiting then we don't need to write it.
+					boost::optional<QString> existing_mipmap_filename =
+							RasterFileCacheFormat::get_existing_mipmap_cache_filename(
+									filename, band_number, colour_palette_id);
+					if (existing_mipmap_filename &&
+						QFileInfo(filename).lastModified() <= QFileInfo(existing_mipmap_filename.get()).lastModified())
+					{
+						return true;
+					}
+
+					mipmap_filename =
+							RasterFileCacheFormat::get_writable_mipmap_cache_filename(
+									filename, band_number, colour_palette_id);
+					if (!mipmap_filename)
+					{
+						// Can't write mipmap file anywhere.
+						return false;
+					}
+
+					// Write to a partial file and only move it into place once complete.
+					// This way a reader never sees a partially written mipmap file.
+					partial_mipmap_filename = RasterFileCacheWriteLock::get_partial_cache_filename(mipmap_filename.get());
+
 					// Pass the colour palette so the mipmap format writer can colour the
 					// source raster and mipmap the coloured sections.
 					MipmapRasterFormatWriterType writer(
 							proxied_raw_raster,
 							raster_band_reader_handle,
 							colour_palette);
-					writer.write(mipmap_filename.get());
+					writer.set_progress_callback(progress_callback);
+					writer.write(partial_mipmap_filename);
 
 					if (is_integer_colour_palette)
 					{
-						// The coloured mipmap files used by integer rasters with integer colour
-						// palettes are deleted when GPlates exits.
-						// This is because they are created specifically for particular colour
-						// palettes, indexed by their memory address, which of course does not
-						// remain the same the next time GPlates gets run.
-						TemporaryFileRegistry::instance().add_file(mipmap_filename.get());
-
 						// Make sure the file is only readable and writable by the user.
 						// Suppose the source raster file is on a shared directory that happens to
 						// be global writable, and two users are running two instances of GPlates.
@@ -191,33 +222,56 @@ namespace GPlatesFileIO
 						// second instance of GPlates.
 						// 
 						// Note: this should change if we start hashing colour palettes, though.
-						QFile::setPermissions(mipmap_filename.get(), QFile::ReadUser | QFile::WriteUser);
+						QFile::setPermissions(partial_mipmap_filename, QFile::ReadUser | QFile::WriteUser);
 					}
 					else
 					{
 						// Copy the file permissions from the source raster file to the mipmap file.
-						QFile::setPermissions(mipmap_filename.get(), QFile::permissions(filename));
+						QFile::setPermissions(partial_mipmap_filename, QFile::permissions(filename));
+					}
+
+					if (!RasterFileCacheWriteLock::commit_partial_cache_file(partial_mipmap_filename, mipmap_filename.get()))
+					{
+						throw GPlatesGlobal::LogException(
+								GPLATES_EXCEPTION_SOURCE, "Unable to move completed mipmap file into place.");
+					}
+
+					if (is_integer_colour_palette)
+					{
+						// The coloured mipmap files used by integer rasters with integer colour
+						// palettes are deleted when GPlates exits.
+						// This is because they are created specifically for particular colour
+						// palettes, indexed by their memory address, which of course does not
+						// remain the same the next time GPlates gets run.
+						TemporaryFileRegistry::instance().add_file(mipmap_filename.get());
 					}
 				}
 				catch (std::exception &exc)
 				{
 					// Log the exception so we know what caused the failure.
-					qWarning() << "Error writing mipmap file '" << mipmap_filename.get()
-							<< "', removing it: " << exc.what();
+					qWarning() << "Error writing mipmap file for band" << band_number
+							<< "of raster '" << filename << "': " << exc.what();
 
-					// Remove the mipmap file in case it was partially written.
-					QFile(mipmap_filename.get()).remove();
+					// Remove the partially written mipmap file (if any).
+					// Note that the mipmap file itself is never partially written.
+					if (!partial_mipmap_filename.isEmpty())
+					{
+						QFile(partial_mipmap_filename).remove();
+					}
 
 					return false;
 				}
 				catch (...)
 				{
 					// Log the exception so we know what caused the failure.
-					qWarning() << "Unknown error writing mipmap file '" << mipmap_filename.get()
-							<< "', removing it";
+					qWarning() << "Unknown error writing mipmap file for band" << band_number
+							<< "of raster '" << filename << "'";
 
-					// Remove the mipmap file in case it was partially written.
-					QFile(mipmap_filename.get()).remove();
+					// Remove the partially written mipmap file (if any).
+					if (!partial_mipmap_filename.isEmpty())
+					{
+						QFile(partial_mipmap_filename).remove();
+					}
 
 					return false;
 				}
@@ -235,7 +289,8 @@ namespace GPlatesFileIO
 		create_mipmapped_raster_file_cache_format_reader(
 				const typename ProxiedRawRasterType::non_null_ptr_type &proxied_raw_raster,
 				GPlatesFileIO::RasterBandReaderHandle raster_band_reader_handle,
-				const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette)
+				const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette,
+				const mipmap_progress_callback_type &progress_callback)
 		{
 			typedef MipmappedRasterFormatReader<MipmappedRasterType> mipmapped_raster_format_reader_type;
 
@@ -269,7 +324,7 @@ namespace GPlatesFileIO
 					QFile(mipmap_filename.get()).remove();
 					// Create a new mipmap file.
 					if (!Internals::create_mipmap_file<ProxiedRawRasterType, MipmapRasterFormatWriterType>(
-						proxied_raw_raster, raster_band_reader_handle, colour_palette))
+						proxied_raw_raster, raster_band_reader_handle, colour_palette, progress_callback))
 					{
 						// Unable to create mipmap file.
 						return boost::shared_ptr<mipmapped_raster_format_reader_type>();
@@ -280,7 +335,7 @@ namespace GPlatesFileIO
 			else
 			{
 				if (!Internals::create_mipmap_file<ProxiedRawRasterType, MipmapRasterFormatWriterType>(
-					proxied_raw_raster, raster_band_reader_handle, colour_palette))
+					proxied_raw_raster, raster_band_reader_handle, colour_palette, progress_callback))
 				{
 					// Unable to create mipmap file.
 					return boost::shared_ptr<mipmapped_raster_format_reader_type>();
@@ -323,7 +378,7 @@ namespace GPlatesFileIO
 
 					// Build it with the current version format.
 					if (Internals::create_mipmap_file<ProxiedRawRasterType, MipmapRasterFormatWriterType>(
-						proxied_raw_raster, raster_band_reader_handle, colour_palette))
+						proxied_raw_raster, raster_band_reader_handle, colour_palette, progress_callback))
 					{
 						// Try reading it again.
 						mipmapped_raster_format_reader.reset(
@@ -343,7 +398,7 @@ namespace GPlatesFileIO
 
 					// Try building it again.
 					if (Internals::create_mipmap_file<ProxiedRawRasterType, MipmapRasterFormatWriterType>(
-						proxied_raw_raster, raster_band_reader_handle, colour_palette))
+						proxied_raw_raster, raster_band_reader_handle, colour_palette, progress_callback))
 					{
 						// Try reading it again.
 						mipmapped_raster_format_reader.reset(
@@ -25,7 +25,9 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <algorithm>
 #include <ostream>
+#include <QByteArray>
 #include <QDebug>
 #include <QFile>
 #include <QFileInfo>
@@ -185,6 +187,108 @@ namespace GPlatesFileIO
 }
 
 
+void
+GPlatesFileIO::RasterFileCacheFormat::write_block_info(
+		QDataStream &out,
+		const BlockInfo &block_info)
+{
+	out << block_info.x_offset
+		<< block_info.y_offset
+		<< block_info.width
+		<< block_info.height
+		<< block_info.main_offset
+		<< block_info.coverage_offset
+		<< block_info.main_size
+		<< block_info.coverage_size
+		<< block_info.main_compression
+		<< block_info.coverage_compression;
+}
+
+
+void
+GPlatesFileIO::RasterFileCacheFormat::read_block_info(
+		QDataStream &in,
+		BlockInfo &block_info,
+		quint32 version_number)
+{
+	in >> block_info.x_offset
+		>> block_info.y_offset
+		>> block_info.width
+		>> block_info.height
+		>> block_info.main_offset
+		>> block_info.coverage_offset;
+
+	if (version_number >= 2)
+	{
+		in >> block_info.main_size
+			>> block_info.coverage_size
+			>> block_info.main_compression
+			>> block_info.coverage_compression;
+	}
+	else
+	{
+		block_info.main_size = 0;
+		block_info.coverage_size = 0;
+		block_info.main_compression = BLOCK_UNCOMPRESSED;
+		block_info.coverage_compression = BLOCK_UNCOMPRESSED;
+	}
+}
+
+
+quint64
+GPlatesFileIO::RasterFileCacheFormat::write_block_data(
+		QDataStream &out,
+		quint64 position,
+		const void *data,
+		unsigned int num_bytes,
+		BlockCompression requested_compression,
+		quint32 &size,
+		quint32 &compression)
+{
+	const unsigned int num_padding_bytes = get_block_data_padding(position);
+	write_padding(out, num_padding_bytes);
+
+	if (requested_compression == BLOCK_ZLIB)
+	{
+		const QByteArray compressed_data = qCompress(static_cast<const uchar *>(data), num_bytes);
+
+		// Only keep the compressed data if it's smaller.
+		if (static_cast<unsigned int>(compressed_data.size()) < num_bytes)
+		{
+			out.writeRawData(compressed_data.constData(), compressed_data.size());
+
+			size = compressed_data.size();
+			compression = BLOCK_ZLIB;
+
+			return position + num_padding_bytes;
+		}
+	}
+
+	out.writeRawData(static_cast<const char *>(data), num_bytes);
+
+	size = num_bytes;
+	compression = BLOCK_UNCOMPRESSED;
+
+	return position + num_padding_bytes;
+}
+
+
+void
+GPlatesFileIO::RasterFileCacheFormat::write_padding(
+		QDataStream &out,
+		unsigned int num_padding_bytes)
+{
+	static const char PADDING[BLOCK_DATA_ALIGNMENT] = { 0 };
+
+	while (num_padding_bytes > 0)
+	{
+		const unsigned int num_bytes = (std::min)(num_padding_bytes, BLOCK_DATA_ALIGNMENT);
+		out.writeRawData(PADDING, num_bytes);
+		num_padding_bytes -= num_bytes;
+	}
+}
+
+
 GPlatesFileIO::RasterFileCacheFormat::BlockInfos::BlockInfos(
 		unsigned int image_width,
 		unsigned int image_height) :
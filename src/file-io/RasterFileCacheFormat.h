@@ -105,10 +105,20 @@ namespace GPlatesFileIO
 	 *
 	 * Most of the fields in the header are unsigned 32-bit integers.
 	 * Each RGBA component is stored as an unsigned 8-bit integer.
-	 * The byte order of the entire raster file cache is big endian (the QDataStream default).
+	 * The byte order of the header (including the block information) is big endian (the QDataStream default).
 	 * The file format is independent of the operating system and CPU, with one
 	 * qualification: float is assumed to be 32-bit and double is assumed to be
 	 * 64-bit.
+	 *
+	 * In version 1 the encoded block data is also big endian and uncompressed.
+	 *
+	 * In version 2 each image (base level or mipmap level) additionally stores the byte order of its
+	 * encoded block data (the native byte order of the machine that wrote it, so usually no
+	 * conversion is needed when reading). And the information for each block also records the
+	 * size and compression (see @a BlockCompression) of its encoded main and coverage data.
+	 * The encoded data of each block starts at a file offset that is a multiple of
+	 * @a BLOCK_DATA_ALIGNMENT so that uncompressed blocks can be accessed directly in a
+	 * memory-mapped file.
 	 */
 	namespace RasterFileCacheFormat
 	{
@@ -130,7 +140,7 @@ namespace GPlatesFileIO
 		 * But this is OK since each file format can test sub-ranges of version numbers and perform
 		 * backwards compatible reading of raster file caches as needed.
 		 */
-		const boost::uint32_t VERSION_NUMBER = 1;
+		const boost::uint32_t VERSION_NUMBER = 2;
 
 		/**
 		 * The type of raster used to store.
@@ -200,6 +210,36 @@ namespace GPlatesFileIO
 		 * The QDataStream serialisation version.
 		 */
 		const int Q_DATA_STREAM_VERSION = QDataStream::Qt_4_4;
+
+		/**
+		 * The encoded data of each block starts at a file offset that is a multiple of this
+		 * (in version 2 onwards).
+		 */
+		const unsigned int BLOCK_DATA_ALIGNMENT = 64;
+
+
+		/**
+		 * The compression of the encoded data of a block (in version 2 onwards).
+		 */
+		enum BlockCompression
+		{
+			BLOCK_UNCOMPRESSED = 0,
+			BLOCK_ZLIB = 1 // Compressed with 'qCompress()'.
+		};
+
+		/**
+		 * The compression requested when writing the main (raster) data of each block.
+		 *
+		 * This is uncompressed so that blocks can be copied directly out of a memory-mapped file.
+		 */
+		const BlockCompression MAIN_BLOCK_COMPRESSION = BLOCK_UNCOMPRESSED;
+
+		/**
+		 * The compression requested when writing the coverage data of each block.
+		 *
+		 * Coverage data is mostly uniform (fully covered) and so compresses very well.
+		 */
+		const BlockCompression COVERAGE_BLOCK_COMPRESSION = BLOCK_ZLIB;
 	
 		/**
 		 * Information for the size and file location of a level (base or mipmap) of the mipmap pyramid.
@@ -231,13 +271,84 @@ namespace GPlatesFileIO
 			// Offset within level of encoded data for the coverage (or mipmapped) raster.
 			// This is zero for source raster formats that don't require a separate coverage (ie, RGBA).
 			quint64 coverage_offset;
+			// Size, in bytes, of the encoded main and coverage data.
+			quint32 main_size, coverage_size;
+			// The @a BlockCompression of the encoded main and coverage data.
+			quint32 main_compression, coverage_compression;
 
-			// Size of sum of individual data members.
+			// Size of sum of individual data members (in the current version).
 			// This is not necessarily equal to the size of the structure due to alignment reasons.
-			static const unsigned int STREAM_SIZE = 4 * sizeof(quint32) + 2 * sizeof(quint64);
+			static const unsigned int STREAM_SIZE = 8 * sizeof(quint32) + 2 * sizeof(quint64);
+
+			// Size of sum of individual data members in version 1 (no sizes or compression).
+			static const unsigned int VERSION_ONE_STREAM_SIZE = 4 * sizeof(quint32) + 2 * sizeof(quint64);
 		};
 
 
+		/**
+		 * Writes @a block_info to @a out (in the current version).
+		 */
+		void
+		write_block_info(
+				QDataStream &out,
+				const BlockInfo &block_info);
+
+		/**
+		 * Reads @a block_info from @a in (written with the specified version).
+		 *
+		 * For version 1 the encoded sizes are set to zero (they are implied by the block dimensions)
+		 * and the compression is set to @a BLOCK_UNCOMPRESSED.
+		 */
+		void
+		read_block_info(
+				QDataStream &in,
+				BlockInfo &block_info,
+				quint32 version_number);
+
+
+		/**
+		 * Writes the encoded data of a block to @a out (in the current version).
+		 *
+		 * @a data contains @a num_bytes bytes of block data in the native byte order.
+		 * It is compressed according to @a requested_compression unless that does not reduce its size.
+		 *
+		 * @a position is the current position of @a out relative to a file offset that's a multiple of
+		 * @a BLOCK_DATA_ALIGNMENT (usually just the current file offset). Padding is written first
+		 * so that the block data is aligned.
+		 *
+		 * Returns the aligned position (relative to the same origin as @a position) of the block data
+		 * and sets @a size and @a compression to the size and compression of the encoded data.
+		 */
+		quint64
+		write_block_data(
+				QDataStream &out,
+				quint64 position,
+				const void *data,
+				unsigned int num_bytes,
+				BlockCompression requested_compression,
+				quint32 &size,
+				quint32 &compression);
+
+		/**
+		 * Returns the number of padding bytes needed to align @a position to @a BLOCK_DATA_ALIGNMENT.
+		 */
+		inline
+		unsigned int
+		get_block_data_padding(
+				quint64 position)
+		{
+			return (BLOCK_DATA_ALIGNMENT - position % BLOCK_DATA_ALIGNMENT) % BLOCK_DATA_ALIGNMENT;
+		}
+
+		/**
+		 * Writes the specified number of zero padding bytes to @a out.
+		 */
+		void
+		write_padding(
+				QDataStream &out,
+				unsigned int num_padding_bytes);
+
+
 		/**
 		 * Keeps track of encoded blocks within an image.
 		 */
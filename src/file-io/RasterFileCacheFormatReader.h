@@ -32,6 +32,7 @@
 #include <vector>
 #include <boost/optional.hpp>
 #include <boost/scoped_array.hpp>
+#include <QByteArray>
 #include <QDataStream>
 #include <QDebug>
 #include <QFile>
@@ -70,6 +71,9 @@ namespace GPlatesFileIO
 	 *
 	 * This can be used to retrieve a cached copy of the original source raster as well as mipmapped
 	 * versions of the source raster.
+	 *
+	 * For version 2 onwards the encoded block data of the image is memory-mapped (if possible)
+	 * and uncompressed blocks in the native byte order are copied directly from the mapped file.
 	 */
 	template <class RawRasterType>
 	class RasterFileCacheFormatReader
@@ -89,7 +93,11 @@ namespace GPlatesFileIO
 			d_image_width(image_width),
 			d_image_height(image_height),
 			d_has_coverage(has_coverage),
-			d_block_infos(image_width, image_height)
+			d_block_infos(image_width, image_height),
+			// Version 1 block data is big endian...
+			d_block_data_byte_order(QSysInfo::BigEndian),
+			d_mapped_block_data(NULL),
+			d_mapped_block_data_file_offset(0)
 		{
 			// NOTE: The total file size should have been verified before we get here so there's no
 			// need to check that the file is large enough to read data as we read.
@@ -144,11 +152,25 @@ namespace GPlatesFileIO
 				}
 			}
 
+			// Version 2 onwards stores the byte order of the block data.
+			if (version_number >= 2)
+			{
+				quint32 block_data_byte_order;
+				d_in >> block_data_byte_order;
+				d_block_data_byte_order = (block_data_byte_order == QSysInfo::BigEndian)
+						? QSysInfo::BigEndian
+						: QSysInfo::LittleEndian;
+			}
+
 			// Verify the number of blocks makes sense.
 			GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
 					num_blocks == d_block_infos.get_num_blocks(),
 					GPLATES_ASSERTION_SOURCE);
 
+			// The range of file offsets containing the encoded data of all blocks.
+			quint64 block_data_begin_file_offset = 0;
+			quint64 block_data_end_file_offset = 0;
+
 			// Read the block information.
 			for (unsigned int block_index = 0; block_index < num_blocks; ++block_index)
 			{
@@ -156,17 +178,50 @@ namespace GPlatesFileIO
 
 				// Note that the offsets are from the start of the file and hence are file offsets
 				// and not offsets from the beginning of the block-encoded data.
-				d_in >> block_info.x_offset
-					>> block_info.y_offset
-					>> block_info.width
-					>> block_info.height
-					>> block_info.main_offset
-					>> block_info.coverage_offset;
+				RasterFileCacheFormat::read_block_info(d_in, block_info, version_number);
 
 				// Make sure the coverage offsets match whether we have coverage data or not.
 				GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
 						(block_info.coverage_offset != 0) == has_coverage,
 						GPLATES_ASSERTION_SOURCE);
+
+				// Version 1 block data is uncompressed so its size is implied by the block dimensions.
+				if (version_number < 2)
+				{
+					block_info.main_size = block_info.width * block_info.height * sizeof(raster_element_type);
+					if (has_coverage)
+					{
+						block_info.coverage_size = block_info.width * block_info.height *
+								sizeof(GPlatesPropertyValues::CoverageRawRaster::element_type);
+					}
+				}
+
+				include_in_file_range(
+						block_data_begin_file_offset,
+						block_data_end_file_offset,
+						block_info.main_offset,
+						block_info.main_size);
+				if (has_coverage)
+				{
+					include_in_file_range(
+							block_data_begin_file_offset,
+							block_data_end_file_offset,
+							block_info.coverage_offset,
+							block_info.coverage_size);
+				}
+			}
+
+			// Memory-map the block data (version 2 onwards aligns the block data for this).
+			//
+			// If this fails (eg, not enough address space on 32-bit systems) then we just read
+			// the blocks from the file instead.
+			if (version_number >= 2 &&
+				block_data_end_file_offset > block_data_begin_file_offset)
+			{
+				d_mapped_block_data = d_file.map(
+						block_data_begin_file_offset,
+						block_data_end_file_offset - block_data_begin_file_offset);
+				d_mapped_block_data_file_offset = block_data_begin_file_offset;
 			}
 		}
 
@@ -203,7 +258,9 @@ namespace GPlatesFileIO
 					width,
 					height,
 					d_block_infos,
-					&RasterFileCacheFormat::BlockInfo::main_offset);
+					&RasterFileCacheFormat::BlockInfo::main_offset,
+					&RasterFileCacheFormat::BlockInfo::main_size,
+					&RasterFileCacheFormat::BlockInfo::main_compression);
 
 			// Add the no-data value to the raster if the raster type needs one (ie, if not RGBA).
 			if (d_no_data_value)
@@ -259,7 +316,9 @@ namespace GPlatesFileIO
 					width,
 					height,
 					d_block_infos,
-					&RasterFileCacheFormat::BlockInfo::coverage_offset);
+					&RasterFileCacheFormat::BlockInfo::coverage_offset,
+					&RasterFileCacheFormat::BlockInfo::coverage_size,
+					&RasterFileCacheFormat::BlockInfo::coverage_compression);
 
 			return result;
 		}
@@ -313,6 +372,41 @@ namespace GPlatesFileIO
 		};
 
 
+		/**
+		 * Extends the file range [begin_file_offset, end_file_offset) to include the specified data.
+		 */
+		static
+		void
+		include_in_file_range(
+				quint64 &begin_file_offset,
+				quint64 &end_file_offset,
+				quint64 data_file_offset,
+				quint32 data_size)
+		{
+			if (data_size == 0)
+			{
+				return;
+			}
+
+			if (end_file_offset == begin_file_offset)
+			{
+				// Range is empty.
+				begin_file_offset = data_file_offset;
+				end_file_offset = data_file_offset + data_size;
+				return;
+			}
+
+			if (begin_file_offset > data_file_offset)
+			{
+				begin_file_offset = data_file_offset;
+			}
+			if (end_file_offset < data_file_offset + data_size)
+			{
+				end_file_offset = data_file_offset + data_size;
+			}
+		}
+
+
 		bool
 		is_valid_region(
 				unsigned int x_offset,
@@ -333,8 +427,10 @@ namespace GPlatesFileIO
 				unsigned int region_width,
 				unsigned int region_height,
 				const RasterFileCacheFormat::BlockInfos &block_infos,
-				// Determines whether to use image file offset or coverage file offset...
-				quint64 RasterFileCacheFormat::BlockInfo::*encoded_block_data_offset) const
+				// Determines whether to use image or coverage file offset, size and compression...
+				quint64 RasterFileCacheFormat::BlockInfo::*encoded_block_data_offset,
+				quint32 RasterFileCacheFormat::BlockInfo::*encoded_block_data_size,
+				quint32 RasterFileCacheFormat::BlockInfo::*encoded_block_data_compression) const
 		{
 			// Determine the range blocks in the 'x' direction covered by the requested region.
 			const unsigned int start_block_x_offset =
@@ -379,13 +475,13 @@ namespace GPlatesFileIO
 			{
 				const RasterFileCacheFormat::BlockInfo &block_info = blocks_in_region.top();
 
-				//PROFILE_BEGIN(profile_seek, "RasterFileCacheFormatReader seek");
-				// Seek to the beginning of the block's encoded data.
-				d_file.seek(block_info.*encoded_block_data_offset);
-				//PROFILE_END(profile_seek);
-
-				// Read the encoded block data into our block data buffer.
-				read_block_data(block_data.get(), block_info.width * block_info.height);
+				// Decode the block data (this might just return a pointer into the memory-mapped file).
+				const T *const decoded_block_data = decode_block_data(
+						block_data.get(),
+						block_info.width * block_info.height,
+						block_info.*encoded_block_data_offset,
+						block_info.*encoded_block_data_size,
+						block_info.*encoded_block_data_compression);
 
 				// Copy the block data into the appropriate sub-section of the destination region.
 				copy_block_data_into_region(
@@ -394,7 +490,7 @@ namespace GPlatesFileIO
 						region_y_offset,
 						region_width,
 						region_height,
-						block_data.get(),
+						decoded_block_data,
 						block_info.x_offset,
 						block_info.y_offset,
 						block_info.width,
@@ -475,29 +571,121 @@ namespace GPlatesFileIO
 		}
 
 
+		/**
+		 * Decodes the encoded data of a block (at the specified file offset) and returns the decoded data.
+		 *
+		 * If the encoded data is uncompressed, in the native byte order and memory-mapped then
+		 * a pointer directly into the mapped file is returned. Otherwise the data is decoded into
+		 * @a block_data (which is then returned).
+		 */
 		template<typename T>
-		void
-		read_block_data(
-				T *data,
-				unsigned int num_elements) const
+		const T *
+		decode_block_data(
+				T *block_data,
+				unsigned int num_elements,
+				quint64 encoded_data_file_offset,
+				quint32 encoded_data_size,
+				quint32 encoded_data_compression) const
 		{
 			PROFILE_FUNC();
 
+			const unsigned int num_bytes = num_elements * sizeof(T);
+
+			// Memory-mapped encoded data (if any).
+			const uchar *const mapped_encoded_data = d_mapped_block_data
+					? d_mapped_block_data + (encoded_data_file_offset - d_mapped_block_data_file_offset)
+					: NULL;
+
+			if (encoded_data_compression == RasterFileCacheFormat::BLOCK_UNCOMPRESSED)
+			{
+				if (encoded_data_size != num_bytes)
+				{
+					throw GPlatesGlobal::LogException(
+							GPLATES_EXCEPTION_SOURCE,
+							"Unexpected block data size in raster file cache.");
+				}
+
+				if (mapped_encoded_data)
+				{
+					// If no byte order conversion is needed then use the mapped data directly.
+					// The block data is aligned (to BLOCK_DATA_ALIGNMENT) in the file and hence also
+					// in the mapped memory.
+					if (d_block_data_byte_order == QSysInfo::ByteOrder)
+					{
+						return reinterpret_cast<const T *>(mapped_encoded_data);
+					}
+
+					std::memcpy(block_data, mapped_encoded_data, num_bytes);
+				}
+				else
+				{
+					// Seek to the beginning of the block's encoded data.
+					d_file.seek(encoded_data_file_offset);
+
+					// Read the encoded block data into our block data buffer.
+					read_block_data(block_data, num_bytes);
+				}
+			}
+			else if (encoded_data_compression == RasterFileCacheFormat::BLOCK_ZLIB)
+			{
+				QByteArray compressed_data;
+				if (mapped_encoded_data)
+				{
+					// Avoid copying the mapped data.
+					compressed_data = QByteArray::fromRawData(
+							reinterpret_cast<const char *>(mapped_encoded_data),
+							encoded_data_size);
+				}
+				else
+				{
+					d_file.seek(encoded_data_file_offset);
+					compressed_data.resize(encoded_data_size);
+					read_block_data(compressed_data.data(), encoded_data_size);
+				}
+
+				const QByteArray uncompressed_data = qUncompress(compressed_data);
+				if (static_cast<unsigned int>(uncompressed_data.size()) != num_bytes)
+				{
+					throw GPlatesGlobal::LogException(
+							GPLATES_EXCEPTION_SOURCE,
+							"Error decompressing block data from raster file cache.");
+				}
+
+				std::memcpy(block_data, uncompressed_data.constData(), num_bytes);
+			}
+			else
+			{
+				throw GPlatesGlobal::LogException(
+						GPLATES_EXCEPTION_SOURCE,
+						"Unknown block compression in raster file cache.");
+			}
+
+			if (d_block_data_byte_order != QSysInfo::ByteOrder)
+			{
+				//PROFILE_BEGIN(profile_convert, "RasterFileCacheFormatReader: convert endian");
+				GPlatesUtils::Endian::convert(block_data, block_data + num_elements, d_block_data_byte_order);
+				//PROFILE_END(profile_convert);
+			}
+
+			return block_data;
+		}
+
+
+		void
+		read_block_data(
+				void *data,
+				unsigned int num_bytes) const
+		{
 			// NOTE: We bypass the expensive output operator '>>' and hence is *much*
 			// faster than doing a loop with '>>' (as determined by profiling).
 			// We have to do our own endian conversion though.
-			void *const raw_data = data;
-			const unsigned int bytes_read = d_in.readRawData(static_cast<char *>(raw_data), num_elements * sizeof(T));
-			if (bytes_read != num_elements * sizeof(T))
+			const int bytes_read = d_in.readRawData(static_cast<char *>(data), num_bytes);
+			if (bytes_read != static_cast<int>(num_bytes))
 			{
 				throw GPlatesGlobal::LogException(
 						GPLATES_EXCEPTION_SOURCE,
 						"Error reading block data from raster file cache mipmap.");
 			}
-
-			//PROFILE_BEGIN(profile_convert, "RasterFileCacheFormatReader: convert endian");
-			GPlatesUtils::Endian::convert(data, data + num_elements, QSysInfo::BigEndian);
-			//PROFILE_END(profile_convert);
 		}
 
 
@@ -510,6 +698,17 @@ namespace GPlatesFileIO
 		RasterFileCacheFormat::BlockInfos d_block_infos;
 		boost::optional<raster_element_type> d_no_data_value;
 		boost::optional<GPlatesPropertyValues::RasterStatistics> d_raster_statistics;
+
+		//! The byte order of the encoded block data.
+		QSysInfo::Endian d_block_data_byte_order;
+
+		/**
+		 * The memory-mapped encoded data of all blocks (or NULL if not mapped).
+		 *
+		 * This is unmapped when the file is closed.
+		 */
+		uchar *d_mapped_block_data;
+		quint64 d_mapped_block_data_file_offset;
 	};
 }
 
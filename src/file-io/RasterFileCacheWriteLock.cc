@@ -0,0 +1,146 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <set>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <QCoreApplication>
+#include <QFile>
+#include <QFileInfo>
+
+#include "RasterFileCacheWriteLock.h"
+
+
+namespace
+{
+	/**
+	 * How often a thread waiting to write a cache calls its cancel check.
+	 */
+	const unsigned int CHECK_CANCELLED_INTERVAL_MILLISECONDS = 100;
+
+
+	/**
+	 * The caches currently being written by this process.
+	 *
+	 * These are namespace-scope (rather than function-local statics) so they are constructed
+	 * before any threads can use them.
+	 */
+	boost::mutex s_locked_cache_ids_mutex;
+	boost::condition_variable s_locked_cache_ids_condition;
+	std::set<QString> s_locked_cache_ids;
+}
+
+
+QString
+GPlatesFileIO::RasterFileCacheWriteLock::get_source_cache_id(
+		const QString &source_filename,
+		unsigned int band_number)
+{
+	return QString("%1|source|%2")
+			.arg(QFileInfo(source_filename).absoluteFilePath())
+			.arg(band_number);
+}
+
+
+QString
+GPlatesFileIO::RasterFileCacheWriteLock::get_mipmap_cache_id(
+		const QString &source_filename,
+		unsigned int band_number,
+		boost::optional<std::size_t> colour_palette_id)
+{
+	QString cache_id = QString("%1|mipmap|%2")
+			.arg(QFileInfo(source_filename).absoluteFilePath())
+			.arg(band_number);
+	if (colour_palette_id)
+	{
+		cache_id += QString("|%1").arg(colour_palette_id.get());
+	}
+
+	return cache_id;
+}
+
+
+GPlatesFileIO::RasterFileCacheWriteLock::RasterFileCacheWriteLock(
+		const QString &cache_id,
+		const check_cancelled_callback_type &check_cancelled) :
+	d_cache_id(cache_id)
+{
+	boost::unique_lock<boost::mutex> lock(s_locked_cache_ids_mutex);
+
+	// Wait while another thread is writing the cache.
+	while (s_locked_cache_ids.find(d_cache_id) != s_locked_cache_ids.end())
+	{
+		if (check_cancelled)
+		{
+			// Don't hold the registry lock while calling back (it could take its own locks).
+			lock.unlock();
+			check_cancelled();
+			lock.lock();
+
+			// Wake up periodically to check again.
+			s_locked_cache_ids_condition.timed_wait(
+					lock,
+					boost::posix_time::milliseconds(CHECK_CANCELLED_INTERVAL_MILLISECONDS));
+		}
+		else
+		{
+			s_locked_cache_ids_condition.wait(lock);
+		}
+	}
+
+	s_locked_cache_ids.insert(d_cache_id);
+}
+
+
+GPlatesFileIO::RasterFileCacheWriteLock::~RasterFileCacheWriteLock()
+{
+	{
+		boost::lock_guard<boost::mutex> lock(s_locked_cache_ids_mutex);
+		s_locked_cache_ids.erase(d_cache_id);
+	}
+
+	s_locked_cache_ids_condition.notify_all();
+}
+
+
+QString
+GPlatesFileIO::RasterFileCacheWriteLock::get_partial_cache_filename(
+		const QString &cache_filename)
+{
+	return QString("%1.%2.partial")
+			.arg(cache_filename)
+			.arg(QCoreApplication::applicationPid());
+}
+
+
+bool
+GPlatesFileIO::RasterFileCacheWriteLock::commit_partial_cache_file(
+		const QString &partial_cache_filename,
+		const QString &cache_filename)
+{
+	// QFile::rename() does not overwrite an existing file.
+	if (QFile::exists(cache_filename) &&
+		!QFile::remove(cache_filename))
+	{
+		return false;
+	}
+
+	return QFile::rename(partial_cache_filename, cache_filename);
+}
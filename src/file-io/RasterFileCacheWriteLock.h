@@ -0,0 +1,129 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILE_IO_RASTERFILECACHEWRITELOCK_H
+#define GPLATES_FILE_IO_RASTERFILECACHEWRITELOCK_H
+
+#include <cstddef>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/optional.hpp>
+#include <QString>
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * Stops more than one thread (in this process) from writing the same raster file cache at a time.
+	 *
+	 * Raster readers of the same raster (such as the import dialog's reader followed by the layer's
+	 * reader, or two layers on one raster) can each find a cache missing and start creating it.
+	 * The process-wide registry of caches being written makes the later writers wait until the
+	 * earlier writer finishes - they should then check whether the cache now exists before
+	 * writing it themselves.
+	 *
+	 * A cache is identified by its source raster, band and (for a mipmap file cache) colour palette
+	 * rather than by its filename, since the cache filename is only chosen (in the source raster
+	 * directory or the temporary directory) once the writer holds the lock.
+	 *
+	 * The cache should be written to @a get_partial_cache_filename and only moved into place with
+	 * @a commit_partial_cache_file once complete, so readers never see a partially written cache.
+	 */
+	class RasterFileCacheWriteLock :
+			private boost::noncopyable
+	{
+	public:
+
+		/**
+		 * Called periodically while waiting for another thread to finish writing the cache.
+		 *
+		 * It can throw an exception to stop waiting (eg, if the wait has been cancelled).
+		 */
+		typedef boost::function<void ()> check_cancelled_callback_type;
+
+
+		/**
+		 * Returns the id of the source raster file cache of band @a band_number of @a source_filename.
+		 */
+		static
+		QString
+		get_source_cache_id(
+				const QString &source_filename,
+				unsigned int band_number);
+
+		/**
+		 * Returns the id of the mipmap file cache of band @a band_number of @a source_filename
+		 * (and of @a colour_palette_id, if any).
+		 */
+		static
+		QString
+		get_mipmap_cache_id(
+				const QString &source_filename,
+				unsigned int band_number,
+				boost::optional<std::size_t> colour_palette_id = boost::none);
+
+
+		/**
+		 * Waits until no other thread holds the lock for the cache @a cache_id and then locks it.
+		 *
+		 * @a cache_id is returned by @a get_source_cache_id or @a get_mipmap_cache_id.
+		 *
+		 * Any exception thrown by @a check_cancelled (while waiting) is propagated.
+		 */
+		explicit
+		RasterFileCacheWriteLock(
+				const QString &cache_id,
+				const check_cancelled_callback_type &check_cancelled = check_cancelled_callback_type());
+
+		/**
+		 * Unlocks the cache, waking any threads waiting to write it.
+		 */
+		~RasterFileCacheWriteLock();
+
+
+		/**
+		 * Returns the filename to write the cache @a cache_filename to until it is complete.
+		 *
+		 * It is in the same directory as @a cache_filename (so it can be renamed into place) and
+		 * is unique to this process (so another instance of GPlates does not write the same file).
+		 */
+		static
+		QString
+		get_partial_cache_filename(
+				const QString &cache_filename);
+
+		/**
+		 * Moves the completely written @a partial_cache_filename to @a cache_filename
+		 * (replacing any existing file).
+		 *
+		 * Returns false if unable to do so (@a partial_cache_filename is then left as is).
+		 */
+		static
+		bool
+		commit_partial_cache_file(
+				const QString &partial_cache_filename,
+				const QString &cache_filename);
+
+	private:
+
+		QString d_cache_id;
+	};
+}
+
+#endif // GPLATES_FILE_IO_RASTERFILECACHEWRITELOCK_H
@@ -33,6 +33,7 @@
 #include <boost/bind/bind.hpp>
 #include <boost/function.hpp>
 #include <boost/optional.hpp>
+#include <boost/ref.hpp>
 #include <boost/lambda/lambda.hpp>
 #include <boost/lambda/bind.hpp>
 #include <boost/lambda/construct.hpp>
@@ -306,6 +307,23 @@ namespace
 		return filters.join(";;");
 	}
 
+
+	/**
+	 * Reports the mipmap progress of one band as progress over all bands of the raster.
+	 */
+	void
+	report_band_mipmap_progress(
+			const RasterReader::mipmap_progress_callback_type &mipmap_progress_callback,
+			unsigned int band_index,
+			unsigned int num_bands,
+			unsigned int num_band_regions_mipmapped,
+			unsigned int num_band_regions)
+	{
+		mipmap_progress_callback(
+				band_index * num_band_regions + num_band_regions_mipmapped,
+				num_bands * num_band_regions);
+	}
+
 }  // anonymous namespace
 
 
@@ -352,17 +370,31 @@ GPlatesFileIO::RasterReader::get_file_dialog_filters(
 GPlatesFileIO::RasterReader::non_null_ptr_type
 GPlatesFileIO::RasterReader::create(
 		const QString &filename,
-		ReadErrorAccumulation *read_errors)
+		ReadErrorAccumulation *read_errors,
+		const mipmap_progress_callback_type &mipmap_progress_callback,
+		bool wait_for_file_caches)
 {
-	RasterReader::non_null_ptr_type raster_reader(new RasterReader(filename, read_errors));
+	RasterReader::non_null_ptr_type raster_reader(new RasterReader(filename, read_errors, wait_for_file_caches));
 
-	// By creating the raster reader we've ensured the source raster file cache has been created and
-	// is up to date so do the same with the raster mipmaps file cache.
+	// If creating the raster reader has ensured the source raster file cache exists and is up to
+	// date then do the same with the raster mipmaps file cache.
 	// This way the slow creation of caches can be done up front during the GPML file loading phase
 	// ensuring no hickups or delays during rendering (eg, if the user the mipmaps suddenly need
 	// to be rendered they won't suffer a delay while the mipmaps file cache is built).
-	for (unsigned int band_number = 1; band_number <= raster_reader->get_number_of_bands(); ++band_number)
+	//
+	// However if the source raster file cache is still being created in the background then the
+	// mipmaps are also created in the background (after the source raster file cache completes).
+	// Until then the raster is previewed using reduced-resolution reads of the source raster.
+	// That is unless the caller is waiting for the file caches (in which case the source raster file
+	// caches have already been created, and so the mipmaps are created here).
+	const unsigned int num_bands = raster_reader->get_number_of_bands();
+	for (unsigned int band_number = 1; band_number <= num_bands; ++band_number)
 	{
+		if (!raster_reader->is_raster_file_cache_complete(band_number))
+		{
+			continue;
+		}
+
 		boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type> proxied_raw_raster =
 				raster_reader->get_proxied_raw_raster(band_number, read_errors);
 		if (proxied_raw_raster)
@@ -371,7 +403,21 @@ GPlatesFileIO::RasterReader::create(
 					GPlatesPropertyValues::ProxiedRasterResolver::create(proxied_raw_raster.get());
 			if (proxied_raster_resolver)
 			{
-				proxied_raster_resolver.get()->ensure_mipmaps_available();
+				GPlatesFileIO::mipmap_progress_callback_type band_mipmap_progress_callback;
+				if (mipmap_progress_callback)
+				{
+					band_mipmap_progress_callback = boost::bind(
+							&report_band_mipmap_progress,
+							boost::cref(mipmap_progress_callback),
+							band_number - 1,
+							num_bands,
+							boost::placeholders::_1,
+							boost::placeholders::_2);
+				}
+
+				proxied_raster_resolver.get()->ensure_mipmaps_available(
+						GPlatesGui::RasterColourPalette::create(),
+						band_mipmap_progress_callback);
 			}
 		}
 	}
@@ -382,7 +428,8 @@ GPlatesFileIO::RasterReader::create(
 
 GPlatesFileIO::RasterReader::RasterReader(
 		const QString &filename,
-		ReadErrorAccumulation *read_errors) :
+		ReadErrorAccumulation *read_errors,
+		bool wait_for_file_caches) :
 	d_impl(NULL),
 	d_filename(filename)
 {
@@ -417,7 +464,7 @@ GPlatesFileIO::RasterReader::RasterReader(
 			break;
 		
 		case GDAL:
-			d_impl.reset(new GDALRasterReader(filename, this, read_errors));
+			d_impl.reset(new GDALRasterReader(filename, this, read_errors, wait_for_file_caches));
 			break;
 
 		default:
@@ -539,6 +586,39 @@ GPlatesFileIO::RasterReader::get_raw_raster(
 }
 
 
+boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type>
+GPlatesFileIO::RasterReader::get_decimated_raw_raster(
+		unsigned int band_number,
+		unsigned int level,
+		const QRect &region,
+		ReadErrorAccumulation *read_errors)
+{
+	if (d_impl)
+	{
+		return d_impl->get_decimated_raw_raster(band_number, level, region, read_errors);
+	}
+	else
+	{
+		return boost::none;
+	}
+}
+
+
+bool
+GPlatesFileIO::RasterReader::is_raster_file_cache_complete(
+		unsigned int band_number)
+{
+	if (d_impl)
+	{
+		return d_impl->is_raster_file_cache_complete(band_number);
+	}
+	else
+	{
+		return true;
+	}
+}
+
+
 GPlatesPropertyValues::RasterType::Type
 GPlatesFileIO::RasterReader::get_type(
 		unsigned int band_number,
@@ -31,6 +31,7 @@
 
 #include <utility>
 #include <map>
+#include <boost/function.hpp>
 #include <boost/optional.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <QRect>
@@ -93,18 +94,36 @@ namespace GPlatesFileIO
 			FormatHandler handler;
 		};
 
+		/**
+		 * Reports the progress of mipmap generation as the number of (equally sized) regions
+		 * mipmapped so far, and the total number of regions (over all bands).
+		 */
+		typedef boost::function<void (unsigned int, unsigned int)> mipmap_progress_callback_type;
+
 		/**
 		 * Returns a RasterReader to read data from @a filename.
 		 *
 		 * Errors encountered are added to @a read_errors if it is not NULL.
 		 * @a read_errors is *not* stored in the RasterReader for reporting of
 		 * errors in subsequent method calls.
+		 *
+		 * If the raster mipmap file caches are generated then their progress is reported to
+		 * @a mipmap_progress_callback (if specified). It is called on the calling thread.
+		 *
+		 * By default any missing raster file caches are created in the background (see
+		 * @a is_raster_file_cache_complete), and their creation is cancelled if the returned
+		 * reader is destroyed first. Callers whose job is to create the caches (eg, when
+		 * caching a time sequence of rasters) should set @a wait_for_file_caches to true so the
+		 * caches (and their mipmaps) are created before returning.
 		 */
 		static
 		non_null_ptr_type
 		create(
 				const QString &filename,
-				ReadErrorAccumulation *read_errors = NULL);
+				ReadErrorAccumulation *read_errors = NULL,
+				const mipmap_progress_callback_type &mipmap_progress_callback =
+						mipmap_progress_callback_type(),
+				bool wait_for_file_caches = false);
 
 		/**
 		 * Returns the filename of the file that the RasterReader was created with.
@@ -194,6 +213,39 @@ namespace GPlatesFileIO
 				const QRect &region = QRect(),
 				ReadErrorAccumulation *read_errors = NULL);
 
+		/**
+		 * Returns a non-proxied RawRaster containing a quick, reduced-resolution read of the
+		 * given @a region in the given @a band_number.
+		 *
+		 * @a level specifies the resolution - each level halves the resolution of the previous
+		 * level (rounding up) where level 0 is the full resolution of the raster. And @a region
+		 * is in the pixel coordinates of @a level.
+		 *
+		 * Unlike a mipmap, the reduced-resolution data is not filtered (it is sampled from
+		 * overviews in the raster file, if any, or decimated from the full-resolution data).
+		 * It is intended for previewing a raster while @a is_raster_file_cache_complete is false.
+		 *
+		 * Returns boost::none if the given @a band_number could not be read, or if the
+		 * raster format does not support reduced-resolution reads.
+		 */
+		boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type>
+		get_decimated_raw_raster(
+				unsigned int band_number,
+				unsigned int level,
+				const QRect &region,
+				ReadErrorAccumulation *read_errors = NULL);
+
+		/**
+		 * Returns false if the raster file cache of the given @a band_number, or its mipmap
+		 * file cache, is still being created in the background.
+		 *
+		 * Until the raster file cache is complete, @a get_raw_raster reads directly from the
+		 * raster file which is much slower (but does not block until the cache is created).
+		 */
+		bool
+		is_raster_file_cache_complete(
+				unsigned int band_number);
+
 
 		/**
 		 * Same interface but for the specified raster band.
@@ -251,7 +303,8 @@ namespace GPlatesFileIO
 
 		RasterReader(
 				const QString &filename,
-				ReadErrorAccumulation *read_errors);
+				ReadErrorAccumulation *read_errors,
+				bool wait_for_file_caches);
 
 		boost::scoped_ptr<RasterReaderImpl> d_impl;
 		QString d_filename;
@@ -307,6 +360,31 @@ namespace GPlatesFileIO
 				unsigned int band_number,
 				ReadErrorAccumulation *read_errors) = 0;
 
+		/**
+		 * Default implementation does not support reduced-resolution reads.
+		 */
+		virtual
+		boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type>
+		get_decimated_raw_raster(
+				unsigned int band_number,
+				unsigned int level,
+				const QRect &region,
+				ReadErrorAccumulation *read_errors)
+		{
+			return boost::none;
+		}
+
+		/**
+		 * Default implementation creates any raster file cache before the reader is constructed.
+		 */
+		virtual
+		bool
+		is_raster_file_cache_complete(
+				unsigned int band_number)
+		{
+			return true;
+		}
+
 	protected:
 
 		explicit
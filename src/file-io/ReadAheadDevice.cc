@@ -0,0 +1,253 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <boost/bind/bind.hpp>
+
+#include "ReadAheadDevice.h"
+
+#include "global/GPlatesAssert.h"
+#include "global/PreconditionViolationError.h"
+
+
+GPlatesFileIO::ReadAheadDevice::ReadAheadDevice(
+		QIODevice* device,
+		int block_size,
+		int max_num_blocks_read_ahead,
+		QObject *parent_) :
+	QIODevice(parent_),
+	d_device(device),
+	d_block_size(block_size),
+	d_max_num_blocks_read_ahead(max_num_blocks_read_ahead),
+	d_front_block_read_position(0),
+	d_num_bytes_read_ahead(0),
+	d_finished_reading_ahead(false),
+	d_error_reading_ahead(false),
+	d_stop_reading_ahead(false)
+{
+	GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+			d_block_size > 0 && d_max_num_blocks_read_ahead > 0,
+			GPLATES_ASSERTION_SOURCE);
+}
+
+
+GPlatesFileIO::ReadAheadDevice::~ReadAheadDevice()
+{
+	// Since this is a destructor we cannot let any exceptions escape.
+	// If one is thrown we just have to lump it and continue on.
+	try
+	{
+		// Also call 'close()' noting that the base class QIODevice destructor does not call it.
+		// This also stops the read-ahead thread (which must not outlive us).
+		close();
+	}
+	catch (...)
+	{
+	}
+}
+
+
+bool
+GPlatesFileIO::ReadAheadDevice::open(
+		OpenMode mode)
+{
+	// Mode should be read only.
+	if (mode != QIODevice::ReadOnly)
+	{
+		return false;
+	}
+
+	// The underlying device should already be open for reading.
+	if (!d_device->isOpen() ||
+		!d_device->openMode().testFlag(QIODevice::ReadOnly))
+	{
+		return false;
+	}
+
+	d_blocks.clear();
+	d_front_block_read_position = 0;
+	d_num_bytes_read_ahead = 0;
+	d_finished_reading_ahead = false;
+	d_error_reading_ahead = false;
+	d_stop_reading_ahead = false;
+
+	d_read_ahead_thread.reset(
+			new boost::thread(boost::bind(&ReadAheadDevice::read_ahead, this)));
+
+	// No need for QIODevice to buffer since we already buffer the blocks read ahead.
+	return QIODevice::open(mode | QIODevice::Unbuffered);
+}
+
+
+void
+GPlatesFileIO::ReadAheadDevice::close()
+{
+	if (d_read_ahead_thread)
+	{
+		// Tell the read-ahead thread to stop (in case it's waiting for blocks to be consumed).
+		{
+			boost::mutex::scoped_lock lock(d_mutex);
+			d_stop_reading_ahead = true;
+		}
+		d_block_consumed_condition.notify_all();
+
+		// Note that if the read-ahead thread is currently reading a block from the underlying device
+		// then we'll wait for that to finish.
+		d_read_ahead_thread->join();
+		d_read_ahead_thread.reset();
+
+		d_blocks.clear();
+		d_front_block_read_position = 0;
+		d_num_bytes_read_ahead = 0;
+	}
+
+	QIODevice::close();
+}
+
+
+bool
+GPlatesFileIO::ReadAheadDevice::atEnd() const
+{
+	boost::mutex::scoped_lock lock(d_mutex);
+
+	// We're at the end if there's nothing in our base class buffer, nothing read ahead and
+	// there's nothing more to read ahead.
+	return QIODevice::bytesAvailable() == 0 &&
+			d_blocks.empty() &&
+			d_finished_reading_ahead;
+}
+
+
+qint64
+GPlatesFileIO::ReadAheadDevice::bytesAvailable() const
+{
+	boost::mutex::scoped_lock lock(d_mutex);
+
+	return d_num_bytes_read_ahead + QIODevice::bytesAvailable();
+}
+
+
+qint64
+GPlatesFileIO::ReadAheadDevice::readData(
+		char *data,
+		qint64 maxSize)
+{
+	boost::mutex::scoped_lock lock(d_mutex);
+
+	// Wait until at least one block has been read ahead, or there's nothing more to read ahead.
+	while (d_blocks.empty() &&
+		!d_finished_reading_ahead)
+	{
+		d_block_read_condition.wait(lock);
+	}
+
+	if (d_blocks.empty())
+	{
+		// Reached the end of the underlying device (or failed to read it).
+		return d_error_reading_ahead ? -1 : 0;
+	}
+
+	// Copy as much as we can from the blocks read ahead.
+	qint64 num_bytes_read = 0;
+	while (num_bytes_read < maxSize &&
+		!d_blocks.empty())
+	{
+		const QByteArray &front_block = d_blocks.front();
+
+		const qint64 num_bytes_to_copy = (std::min)(
+				maxSize - num_bytes_read,
+				qint64(front_block.size() - d_front_block_read_position));
+		std::memcpy(
+				data + num_bytes_read,
+				front_block.constData() + d_front_block_read_position,
+				num_bytes_to_copy);
+
+		num_bytes_read += num_bytes_to_copy;
+		d_front_block_read_position += static_cast<int>(num_bytes_to_copy);
+		d_num_bytes_read_ahead -= num_bytes_to_copy;
+
+		if (d_front_block_read_position == front_block.size())
+		{
+			d_blocks.pop_front();
+			d_front_block_read_position = 0;
+
+			// Let the read-ahead thread know there's room for another block.
+			d_block_consumed_condition.notify_one();
+		}
+	}
+
+	return num_bytes_read;
+}
+
+
+void
+GPlatesFileIO::ReadAheadDevice::read_ahead()
+{
+	bool error = false;
+
+	try
+	{
+		while (true)
+		{
+			// Read the next block from the underlying device (without holding the lock so that
+			// blocks already read ahead can be consumed in the meantime).
+			QByteArray block(d_block_size, Qt::Uninitialized);
+			const qint64 block_size = d_device->read(block.data(), d_block_size);
+			if (block_size <= 0)
+			{
+				// Reached the end of the underlying device (or failed to read it).
+				error = (block_size < 0);
+				break;
+			}
+			block.resize(static_cast<int>(block_size));
+
+			boost::mutex::scoped_lock lock(d_mutex);
+
+			// Wait until there's room for another block.
+			while (d_blocks.size() >= static_cast<std::size_t>(d_max_num_blocks_read_ahead) &&
+				!d_stop_reading_ahead)
+			{
+				d_block_consumed_condition.wait(lock);
+			}
+
+			if (d_stop_reading_ahead)
+			{
+				break;
+			}
+
+			d_blocks.push_back(block);
+			d_num_bytes_read_ahead += block_size;
+
+			d_block_read_condition.notify_one();
+		}
+	}
+	catch (...)
+	{
+		// Exceptions must not escape the thread - just treat as a read failure.
+		error = true;
+	}
+
+	{
+		boost::mutex::scoped_lock lock(d_mutex);
+		d_finished_reading_ahead = true;
+		d_error_reading_ahead = error;
+	}
+	d_block_read_condition.notify_all();
+}
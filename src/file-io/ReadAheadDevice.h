@@ -0,0 +1,170 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILE_IO_READAHEADDEVICE_H
+#define GPLATES_FILE_IO_READAHEADDEVICE_H
+
+#include <deque>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <QByteArray>
+#include <QIODevice>
+#include <QObject>
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * A read-only sequential QIODevice that reads another device ahead of time on a separate thread.
+	 *
+	 * This is useful when reading the underlying device is expensive, such as decompressing a
+	 * gzip stream (see @a GzipFile), since it then overlaps with whatever the reader of this device
+	 * is doing (such as parsing XML).
+	 *
+	 * Reading from this device blocks until data has been read ahead (or the underlying device
+	 * reaches its end), so @a read only returns zero bytes at the end of the data.
+	 *
+	 * NOTE: Once this device is opened the underlying device is accessed exclusively by the
+	 * read-ahead thread (until this device is closed), so it must not be used by anything else.
+	 */
+	class ReadAheadDevice :
+			public QIODevice
+	{
+	public:
+
+		/**
+		 * Size of the blocks read from the underlying device.
+		 */
+		static const int DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+		/**
+		 * Maximum number of blocks read ahead before the read-ahead thread waits for the
+		 * reader of this device to catch up (this limits the memory used).
+		 */
+		static const int DEFAULT_MAX_NUM_BLOCKS_READ_AHEAD = 16;
+
+
+		/**
+		 * @param device The device to read ahead from - it should already be open for reading.
+		 */
+		explicit
+		ReadAheadDevice(
+				QIODevice* device,
+				int block_size = DEFAULT_BLOCK_SIZE,
+				int max_num_blocks_read_ahead = DEFAULT_MAX_NUM_BLOCKS_READ_AHEAD,
+				QObject *parent_ = NULL);
+
+		~ReadAheadDevice();
+
+		/**
+		 * Opens this device and starts the read-ahead thread.
+		 *
+		 * Mode should be read-only (any text flag should be specified on the underlying device instead).
+		 * Returns false if @a mode is not read-only or if the underlying device is not open for reading.
+		 */
+		virtual
+		bool
+		open(
+				OpenMode mode);
+
+		/**
+		 * Stops the read-ahead thread and closes this device (but not the underlying device).
+		 */
+		virtual
+		void
+		close();
+
+		virtual
+		bool
+		isSequential() const
+		{
+			// Sequential, no seeking.
+			return true;
+		}
+
+		virtual
+		bool
+		atEnd() const;
+
+		virtual
+		qint64
+		bytesAvailable() const;
+
+	protected:
+
+		virtual
+		qint64
+		readData(
+				char *data,
+				qint64 maxSize);
+
+		virtual
+		qint64
+		writeData(
+				const char *data,
+				qint64 maxSize)
+		{
+			// Read-only device.
+			return -1;
+		}
+
+	private:
+
+		QIODevice *d_device;
+		int d_block_size;
+		int d_max_num_blocks_read_ahead;
+
+		boost::scoped_ptr<boost::thread> d_read_ahead_thread;
+
+		//
+		// The following are shared with the read-ahead thread (and protected by the mutex).
+		//
+
+		mutable boost::mutex d_mutex;
+
+		//! Signalled when a block has been read ahead (or the read-ahead thread has finished).
+		boost::condition_variable d_block_read_condition;
+
+		//! Signalled when a block has been consumed (or the read-ahead thread should stop).
+		boost::condition_variable d_block_consumed_condition;
+
+		std::deque<QByteArray> d_blocks;
+
+		//! Number of bytes already consumed from the front block.
+		int d_front_block_read_position;
+
+		//! Number of unconsumed bytes in all blocks.
+		qint64 d_num_bytes_read_ahead;
+
+		bool d_finished_reading_ahead;
+		bool d_error_reading_ahead;
+		bool d_stop_reading_ahead;
+
+
+		/**
+		 * The read-ahead thread function.
+		 */
+		void
+		read_ahead();
+	};
+}
+
+#endif // GPLATES_FILE_IO_READAHEADDEVICE_H
@@ -25,10 +25,12 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <algorithm>
 #include <cstddef> // For std::size_t
 #include <exception>
 #include <iostream>
 #include <limits>
+#include <vector>
 #include <boost/scoped_array.hpp>
 #include <QtCore/qglobal.h>
 #include <QDataStream>
@@ -36,6 +38,7 @@
 #include <QDebug>
 #include <QFile>
 #include <QFileInfo>
+#include <QSysInfo>
 
 #include "RgbaRasterReader.h"
 
@@ -542,6 +545,9 @@ GPlatesFileIO::RgbaRasterReader::write_source_raster_file_cache(
 	out << static_cast<double>(0); // raster_mean - doesn't matter what gets read.
 	out << static_cast<double>(0); // raster_standard_deviation - doesn't matter what gets read.
 
+	// Write the byte order of the encoded block data.
+	out << static_cast<quint32>(QSysInfo::ByteOrder);
+
 	// The block information will get written next.
 	const qint64 block_info_pos = cache_file.pos();
 
@@ -562,14 +568,13 @@ GPlatesFileIO::RgbaRasterReader::write_source_raster_file_cache(
 		block_info.height = 0;
 		block_info.main_offset = 0;
 		block_info.coverage_offset = 0;
+		block_info.main_size = 0;
+		block_info.coverage_size = 0;
+		block_info.main_compression = RasterFileCacheFormat::BLOCK_UNCOMPRESSED;
+		block_info.coverage_compression = RasterFileCacheFormat::BLOCK_UNCOMPRESSED;
 
 		// Write out the dummy block information.
-		out << block_info.x_offset
-			<< block_info.y_offset
-			<< block_info.width
-			<< block_info.height
-			<< block_info.main_offset
-			<< block_info.coverage_offset;
+		RasterFileCacheFormat::write_block_info(out, block_info);
 	}
 
 	// Write the source raster image to the cache file.
@@ -583,12 +588,7 @@ GPlatesFileIO::RgbaRasterReader::write_source_raster_file_cache(
 				block_infos.get_block_info(block_index);
 
 		// Write out the proper block information.
-		out << block_info.x_offset
-			<< block_info.y_offset
-			<< block_info.width
-			<< block_info.height
-			<< block_info.main_offset
-			<< block_info.coverage_offset;
+		RasterFileCacheFormat::write_block_info(out, block_info);
 	}
 
 	// Write the total size of the cache file so the reader can verify that the
@@ -819,11 +819,10 @@ GPlatesFileIO::RgbaRasterReader::hilbert_curve_traversal(
 			block_info.height = RasterFileCacheFormat::BLOCK_SIZE;
 		}
 
-		// Record the file offset of the current block of data.
-		block_info.main_offset = out.device()->pos();
-
 		// NOTE: There's no coverage data for RGBA rasters.
 		block_info.coverage_offset = 0;
+		block_info.coverage_size = 0;
+		block_info.coverage_compression = RasterFileCacheFormat::BLOCK_UNCOMPRESSED;
 
 		// We should already have source region data.
 		GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
@@ -840,7 +839,8 @@ GPlatesFileIO::RgbaRasterReader::hilbert_curve_traversal(
 
 		PROFILE_BLOCK("Write Rgba raster data to file cache");
 
-		// Write the current block from the source region to the output stream.
+		// Copy the current block from the source region into contiguous block data.
+		std::vector<GPlatesGui::rgba8_t> block_data(block_info.width * block_info.height);
 		for (unsigned int y = 0; y < block_info.height; ++y)
 		{
 			const GPlatesGui::rgba8_t *const source_region_row =
@@ -849,17 +849,23 @@ GPlatesFileIO::RgbaRasterReader::hilbert_curve_traversal(
 						std::size_t(block_info.y_offset - source_region.y() + y) * source_region.width() +
 						block_info.x_offset - source_region.x();
 
-#if 1
-			output_pixels(out, source_region_row, block_info.width);
-#else
-			for (unsigned int x = 0; x < block_info.width; ++x)
-			{
-				out << source_region_row[x];
-			}
-#endif
-
+			std::copy(
+					source_region_row,
+					source_region_row + block_info.width,
+					block_data.begin() + y * block_info.width);
 		}
 
+		// Write the block data (in the native byte order) to the output stream and record the
+		// (aligned) file offset of the current block of data.
+		block_info.main_offset = RasterFileCacheFormat::write_block_data(
+				out,
+				out.device()->pos(),
+				&block_data[0],
+				block_data.size() * sizeof(GPlatesGui::rgba8_t),
+				RasterFileCacheFormat::MAIN_BLOCK_COMPRESSION,
+				block_info.main_size,
+				block_info.main_compression);
+
 		return;
 	}
 
@@ -25,6 +25,8 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <boost/bind.hpp>
+#include <boost/ref.hpp>
 #include <QFileInfo>
 #include <QMessageBox>
 #include <QString>
@@ -35,6 +37,18 @@
 
 namespace {
 
+	/**
+	 * Copies the line at @a line_index of @a data into @a line.
+	 */
+	void
+	get_line_from_data(
+			const std::vector<GPlatesGui::CsvExport::LineDataType> &data,
+			std::size_t line_index,
+			GPlatesGui::CsvExport::LineDataType &line)
+	{
+		line = data[line_index];
+	}
+
 	/**
 	 * Attempts to apply quoting/escaping rules to a single CSV field
 	 * as correctly as possible.
@@ -255,18 +269,35 @@ namespace GPlatesGui
 			const QString &filename,
 			const CsvExport::ExportOptions &options,
 			const std::vector<CsvExport::LineDataType> &data)
+	{
+		export_data(
+				filename,
+				options,
+				data.size(),
+				boost::bind(&get_line_from_data, boost::cref(data), _1, _2));
+	}
+
+	void
+	CsvExport::export_data(
+			const QString &filename,
+			const CsvExport::ExportOptions &options,
+			std::size_t num_lines,
+			const get_line_function_type &get_line)
 	{
 		std::ofstream os;
 		QFileInfo file_info(filename);
-		try{	
+		try{
 			os.exceptions(std::ios::badbit | std::ios::failbit);
 			os.open(filename.toStdString().c_str());
-			std::vector<CsvExport::LineDataType>::const_iterator it;
-			for(it=data.begin();it!=data.end();it++)
+
+			// Re-use the same line to avoid re-allocating it for each line.
+			CsvExport::LineDataType line;
+			for (std::size_t line_index = 0; line_index < num_lines; ++line_index)
 			{
-				export_line(os,options,*it);
+				line.clear();
+				get_line(line_index, line);
+				export_line(os, options, line);
 			}
-
 		}
 		catch (std::exception &exc)
 		{
@@ -274,7 +305,7 @@ namespace GPlatesGui
 			QString message = QObject::tr("Error writing to file '%1': %2")
 					.arg(file_info.filePath()).arg(exc.what());
 			QMessageBox::critical(0, QObject::tr("Error Saving File"), message,
-					QMessageBox::Ok, QMessageBox::Ok);					
+					QMessageBox::Ok, QMessageBox::Ok);
 		}
 		catch(...)
 		{
@@ -282,7 +313,7 @@ namespace GPlatesGui
 			QString message = QObject::tr("An error occurred while writing to file '%1'")
 				.arg(file_info.filePath());
 			QMessageBox::critical(0, QObject::tr("Error Saving File"), message,
-				QMessageBox::Ok, QMessageBox::Ok);					
+				QMessageBox::Ok, QMessageBox::Ok);
 		}
 		os.close();
 		return;
@@ -30,6 +30,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <boost/function.hpp>
 #include <QTableWidget>
 namespace GPlatesGui {
 
@@ -87,6 +88,25 @@ namespace GPlatesGui {
 				const QString &filename,
 				const ExportOptions &options,
 				const std::vector<LineDataType> &data);
+
+		/**
+		 * Function to get the line at a line index (the line is cleared before each call).
+		 */
+		typedef boost::function<void (std::size_t, LineDataType &)> get_line_function_type;
+
+		/**
+		 * Export @a num_lines lines to the file filename in csv form.
+		 *
+		 * Unlike the above overload, each line is requested from @a get_line just before it is
+		 * written, so the entire table does not need to be converted to strings up front.
+		 */
+		static
+		void
+		export_data(
+				const QString &filename,
+				const ExportOptions &options,
+				std::size_t num_lines,
+				const get_line_function_type &get_line);
 	
 	};
 
@@ -1721,7 +1721,22 @@ namespace GPlatesGui
 							new ExportCoRegistrationAnimationStrategy::Configuration(
 									add_export_filename_extension(
 											"co_registration_data%P_%0.2fMa",
-											ExportAnimationType::CSV_COMMA))),
+											ExportAnimationType::CSV_COMMA),
+									ExportCoRegistrationAnimationStrategy::Configuration::CSV_COMMA)),
+					&create_animation_strategy<ExportCoRegistrationAnimationStrategy>,
+					&create_null_export_options_widget,
+					&ExportFileNameTemplateValidationUtils::is_valid_template_filename_sequence_with_percent_P);
+
+			registry.register_exporter(
+					ExportAnimationType::get_export_id(
+							ExportAnimationType::CO_REGISTRATION,
+							ExportAnimationType::BINARY_TABLE),
+					ExportCoRegistrationAnimationStrategy::const_configuration_ptr(
+							new ExportCoRegistrationAnimationStrategy::Configuration(
+									add_export_filename_extension(
+											"co_registration_data%P_%0.2fMa",
+											ExportAnimationType::BINARY_TABLE),
+									ExportCoRegistrationAnimationStrategy::Configuration::BINARY_TABLE)),
 					&create_animation_strategy<ExportCoRegistrationAnimationStrategy>,
 					&create_null_export_options_widget,
 					&ExportFileNameTemplateValidationUtils::is_valid_template_filename_sequence_with_percent_P);
@@ -261,6 +261,7 @@ namespace GPlatesGui
 				export_format_description_map[ERMAPPER]        =QObject::tr("ERMapper (*.ers)");
 				export_format_description_map[CITCOMS_GLOBAL]  =QObject::tr("CitcomS global (*)");
 				export_format_description_map[TERRA_TEXT]      =QObject::tr("Terra text format (*)");
+				export_format_description_map[BINARY_TABLE]    =QObject::tr("Binary columnar table (*.gptab)");
 
 				return export_format_description_map;
 			}
@@ -295,6 +296,7 @@ namespace GPlatesGui
 				export_format_filename_extension_map[ERMAPPER]        ="ers";
 				export_format_filename_extension_map[CITCOMS_GLOBAL]  ="";
 				export_format_filename_extension_map[TERRA_TEXT]      ="";
+				export_format_filename_extension_map[BINARY_TABLE]    ="gptab";
 
 				return export_format_filename_extension_map;
 			}
@@ -108,6 +108,8 @@ namespace GPlatesGui
 			CITCOMS_GLOBAL,  // CitcomS global velocity file.
 			TERRA_TEXT,      // Terra velocity text file.
 
+			BINARY_TABLE,    // Binary columnar co-registration data table.
+
 			NUM_FORMATS,
 
 			INVALID_FORMAT // Must be after NUM_FORMATS.
@@ -34,6 +34,8 @@
 
 #include "data-mining/DataSelector.h"
 
+#include "global/GPlatesAssert.h"
+
 #include "gui/ExportAnimationContext.h"
 #include "gui/AnimationController.h"
 #include "gui/CsvExport.h"
@@ -160,7 +162,38 @@ GPlatesGui::ExportCoRegistrationAnimationStrategy::do_export_iteration(
 			QString full_filename = d_export_animation_context_ptr->target_dir().absoluteFilePath(output_basename);
 
 			// Export the co-registration data.
-			coregistration_data.get()->data_table().export_as_CSV(full_filename);
+			try
+			{
+				switch (d_configuration->file_format)
+				{
+				case Configuration::CSV_COMMA:
+					coregistration_data.get()->data_table().export_as_CSV(full_filename);
+					break;
+
+				case Configuration::BINARY_TABLE:
+					coregistration_data.get()->data_table().export_as_binary(full_filename);
+					break;
+
+				default:
+					// Shouldn't get here.
+					GPlatesGlobal::Abort(GPLATES_ASSERTION_SOURCE);
+					break;
+				}
+			}
+			catch (std::exception &exc)
+			{
+				d_export_animation_context_ptr->update_status_message(
+					QObject::tr("Error writing co-registration data file \"%1\": %2")
+							.arg(full_filename)
+							.arg(exc.what()));
+				return false;
+			}
+			catch (...)
+			{
+				d_export_animation_context_ptr->update_status_message(
+					QObject::tr("Error writing co-registration data file \"%1\": unknown error!").arg(full_filename));
+				return false;
+			}
 		}
 	}
 
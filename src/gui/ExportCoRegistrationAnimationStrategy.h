@@ -62,10 +62,20 @@ namespace GPlatesGui
 				public ExportAnimationStrategy::ConfigurationBase
 		{
 		public:
+
+			enum FileFormat
+			{
+				CSV_COMMA,
+				BINARY_TABLE // See GPlatesDataMining::DataTable::export_as_binary.
+			};
+
+
 			explicit
 			Configuration(
-					const QString& filename_template_) :
-				ConfigurationBase(filename_template_)
+					const QString& filename_template_,
+					FileFormat file_format_ = CSV_COMMA) :
+				ConfigurationBase(filename_template_),
+				file_format(file_format_)
 			{  }
 
 			virtual
@@ -74,6 +84,8 @@ namespace GPlatesGui
 			{
 				return configuration_base_ptr(new Configuration(*this));
 			}
+
+			FileFormat file_format;
 		};
 
 		//! Typedef for a shared pointer to const @a Configuration.
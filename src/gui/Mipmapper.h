@@ -1101,74 +1101,66 @@ namespace GPlatesGui
 		GPlatesPropertyValues::CoverageRawRaster::non_null_ptr_type new_fraction_in_source_raster =
 				GPlatesPropertyValues::CoverageRawRaster::create(new_width, new_height);
 
-		// Pointers into the new rasters.
-		coverage_element_type *new_coverage_ptr = new_coverage->data();
-		coverage_element_type *const new_coverage_end = new_coverage->data() + new_width * new_height;
-		fraction_in_source_element_type *new_fraction_in_source_raster_ptr = new_fraction_in_source_raster->data();
-
-		// Pointers into the old rasters.
-		const coverage_element_type *current_coverage_ptr = coverage_raster.data();
-		const fraction_in_source_element_type *current_fraction_in_source_raster_ptr =
-				fraction_in_source_raster.data();
+		// Coverage values within this threshold of zero are considered entirely sentinel value.
+		// Such pixels are excluded from the sum because mixing NaNs into the sum is going to
+		// screw things up. This is the same test as 'GPlatesMaths::are_almost_exactly_equal'.
+		//
+		// NOTE: Like that function, a NaN coverage value is not considered zero (all comparisons
+		// with NaN are false) and so such pixels are still included in the sum.
+		const coverage_element_type zero_coverage_threshold =
+				static_cast<coverage_element_type>(GPlatesMaths::EPSILON);
 
-		while (new_coverage_ptr != new_coverage_end)
+		// Each row of the new rasters is mipmapped from two rows of the current rasters.
+		//
+		// NOTE: The inner loop is written without branches (and without aliasing between the
+		// input and output rows) so that the compiler can vectorise it.
+		for (unsigned int j = 0; j != new_height; ++j)
 		{
+			coverage_element_type *const new_coverage_row = new_coverage->data() + j * new_width;
+			fraction_in_source_element_type *const new_fraction_in_source_raster_row =
+					new_fraction_in_source_raster->data() + j * new_width;
+
+			const coverage_element_type *const current_coverage_row0 =
+					coverage_raster.data() + 2 * j * current_width;
+			const coverage_element_type *const current_coverage_row1 =
+					current_coverage_row0 + current_width;
+			const fraction_in_source_element_type *const current_fraction_in_source_raster_row0 =
+					fraction_in_source_raster.data() + 2 * j * current_width;
+			const fraction_in_source_element_type *const current_fraction_in_source_raster_row1 =
+					current_fraction_in_source_raster_row0 + current_width;
+
 			for (unsigned int i = 0; i != new_width; ++i)
 			{
-				coverage_element_type sum_of_weights = coverage_element_type();
-				fraction_in_source_element_type sum_of_fraction_in_source_raster =
-						fraction_in_source_element_type();
-
-				const coverage_element_type * const current_coverage_pixels[] = {
-					current_coverage_ptr,
-					current_coverage_ptr + 1,
-					current_coverage_ptr + current_width,
-					current_coverage_ptr + current_width + 1
-				};
-				const fraction_in_source_element_type * const current_fraction_in_source_raster_pixels[] = {
-					current_fraction_in_source_raster_ptr,
-					current_fraction_in_source_raster_ptr + 1,
-					current_fraction_in_source_raster_ptr + current_width,
-					current_fraction_in_source_raster_ptr + current_width + 1
-				};
-
-				// Go through the four pixels that will be downsampled to one.
-				for (int j = 0; j != 4; ++j)
-				{
-					sum_of_fraction_in_source_raster += *current_fraction_in_source_raster_pixels[j];
-
-					// Don't process the pixel if it is entirely sentinel value,
-					// because mixing NaNs into the sum is going to screw things up.
-					if (!GPlatesMaths::are_almost_exactly_equal(
-							*current_coverage_pixels[j], coverage_element_type() /* 0.0f */))
-					{
-						coverage_element_type weight = (*current_coverage_pixels[j]) * 
-							(*current_fraction_in_source_raster_pixels[j]);
-						sum_of_weights += weight;
-					}
-				}
-
-				*new_coverage_ptr = sum_of_weights / sum_of_fraction_in_source_raster;
-#if 0
-				if (!(GPlatesMaths::are_almost_exactly_equal(*new_coverage_ptr, coverage_element_type() /* 0.0f */) ||
-						GPlatesMaths::are_almost_exactly_equal(*new_coverage_ptr, static_cast<coverage_element_type>(1.0))))
-				{
-					new_coverage_has_fractional_values = true;
-				}
-#endif
-				*new_fraction_in_source_raster_ptr = sum_of_fraction_in_source_raster / 4;
-
-				// Advance pointers.
-				++new_coverage_ptr;
-				++new_fraction_in_source_raster_ptr;
-				current_coverage_ptr += 2;
-				current_fraction_in_source_raster_ptr += 2;
+				// The four pixels that will be downsampled to one.
+				const coverage_element_type coverage0 = current_coverage_row0[2 * i];
+				const coverage_element_type coverage1 = current_coverage_row0[2 * i + 1];
+				const coverage_element_type coverage2 = current_coverage_row1[2 * i];
+				const coverage_element_type coverage3 = current_coverage_row1[2 * i + 1];
+				const fraction_in_source_element_type fraction_in_source0 = current_fraction_in_source_raster_row0[2 * i];
+				const fraction_in_source_element_type fraction_in_source1 = current_fraction_in_source_raster_row0[2 * i + 1];
+				const fraction_in_source_element_type fraction_in_source2 = current_fraction_in_source_raster_row1[2 * i];
+				const fraction_in_source_element_type fraction_in_source3 = current_fraction_in_source_raster_row1[2 * i + 1];
+
+				const fraction_in_source_element_type sum_of_fraction_in_source_raster =
+						fraction_in_source0 + fraction_in_source1 + fraction_in_source2 + fraction_in_source3;
+
+				const coverage_element_type weight0 =
+						!(-zero_coverage_threshold <= coverage0 && coverage0 <= zero_coverage_threshold)
+						? coverage0 * fraction_in_source0 : coverage_element_type();
+				const coverage_element_type weight1 =
+						!(-zero_coverage_threshold <= coverage1 && coverage1 <= zero_coverage_threshold)
+						? coverage1 * fraction_in_source1 : coverage_element_type();
+				const coverage_element_type weight2 =
+						!(-zero_coverage_threshold <= coverage2 && coverage2 <= zero_coverage_threshold)
+						? coverage2 * fraction_in_source2 : coverage_element_type();
+				const coverage_element_type weight3 =
+						!(-zero_coverage_threshold <= coverage3 && coverage3 <= zero_coverage_threshold)
+						? coverage3 * fraction_in_source3 : coverage_element_type();
+				const coverage_element_type sum_of_weights = weight0 + weight1 + weight2 + weight3;
+
+				new_coverage_row[i] = sum_of_weights / sum_of_fraction_in_source_raster;
+				new_fraction_in_source_raster_row[i] = sum_of_fraction_in_source_raster / 4;
 			}
-
-			// Because one line in the new mipmap corresponds to two lines
-			// in the current mipmap, skip over a line.
-			current_coverage_ptr += current_width;
-			current_fraction_in_source_raster_ptr += current_width;
 		}
 
 		// Return the two mipmapped rasters.
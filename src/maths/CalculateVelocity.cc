@@ -136,6 +136,76 @@ GPlatesMaths::calculate_velocity_vector(
 }
 
 
+GPlatesMaths::Vector3D
+GPlatesMaths::calculate_velocity_angular_vector(
+		const FiniteRotation &stage_rotation,
+		const double &delta_time)
+{
+	if (represents_identity_rotation(stage_rotation.unit_quat()))
+	{
+		// Return zero angular velocity.
+		return Vector3D(0, 0, 0);
+	}
+
+	// The axis hint does not affect our results because, in our stage rotation calculation,
+	// the signs of the axis and angle cancel each other out so it doesn't matter if
+	// axis/angle or -axis/-angle...
+	const UnitQuaternion3D::RotationParams params =
+			stage_rotation.unit_quat().get_rotation_params(boost::none/*axis_hint*/);
+
+	// Angular velocity of rotation (radians per million years).
+	const real_t omega = params.angle / delta_time;
+
+	// Scale so that crossing with a unit position vector gives cm/yr.
+	return (omega * (GPlatesUtils::Earth::EQUATORIAL_RADIUS_KMS * 1e-1/* kms/my -> cm/yr */)) *
+			Vector3D(params.axis);
+}
+
+
+void
+GPlatesMaths::calculate_velocity_vectors(
+		Vector3D *velocities,
+		const PointOnSphere *points,
+		unsigned int num_points,
+		const FiniteRotation &stage_rotation,
+		const double &delta_time)
+{
+	calculate_velocity_vectors(
+			velocities,
+			points,
+			num_points,
+			calculate_velocity_angular_vector(stage_rotation, delta_time));
+}
+
+
+void
+GPlatesMaths::calculate_velocity_vectors(
+		Vector3D *velocities,
+		const PointOnSphere *points,
+		unsigned int num_points,
+		const Vector3D &velocity_angular_vector)
+{
+	const double wx = velocity_angular_vector.x().dval();
+	const double wy = velocity_angular_vector.y().dval();
+	const double wz = velocity_angular_vector.z().dval();
+
+	for (unsigned int n = 0; n < num_points; ++n)
+	{
+		const UnitVector3D &position = points[n].position_vector();
+
+		const double px = position.x().dval();
+		const double py = position.y().dval();
+		const double pz = position.z().dval();
+
+		// Cross product (angular vector x position) written out in full to keep the loop branch-free.
+		velocities[n] = Vector3D(
+				wy * pz - wz * py,
+				wz * px - wx * pz,
+				wx * py - wy * px);
+	}
+}
+
+
 GPlatesMaths::VectorColatitudeLongitude
 GPlatesMaths::convert_vector_from_xyz_to_colat_lon(
 		const GPlatesMaths::PointOnSphere &point, 
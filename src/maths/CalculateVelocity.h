@@ -38,6 +38,8 @@
 #include <boost/optional.hpp>
 
 #include "FiniteRotation.h"
+#include "PointOnSphere.h"
+#include "Vector3D.h"
 #include "types.h"
 
 
@@ -113,6 +115,62 @@ namespace GPlatesMaths
 			const FiniteRotation &stage_rotation,
 			const double &delta_time);
 
+	/**
+	 * Returns the angular velocity vector of @a stage_rotation (over @a delta_time) scaled by the
+	 * Earth's radius such that its cross product with a point's position vector is the velocity
+	 * of that point (in centimetres per year).
+	 *
+	 * This is useful when calculating velocities of many points moving with the same stage rotation
+	 * since the (relatively expensive) extraction of the stage rotation axis and angle is done only once.
+	 *
+	 * Returns the zero vector if @a stage_rotation is the identity rotation.
+	 */
+	Vector3D
+	calculate_velocity_angular_vector(
+			const FiniteRotation &stage_rotation,
+			const double &delta_time);
+
+	/**
+	 * Similar to @a calculate_velocity_vector but uses an angular velocity vector
+	 * returned by @a calculate_velocity_angular_vector.
+	 */
+	inline
+	Vector3D
+	calculate_velocity_vector(
+			const PointOnSphere &point,
+			const Vector3D &velocity_angular_vector)
+	{
+		return cross(velocity_angular_vector, point.position_vector());
+	}
+
+	/**
+	 * Batched version of @a calculate_velocity_vector that calculates the velocities of
+	 * @a num_points points, all undergoing the same @a stage_rotation, and stores them in @a velocities
+	 * (which must have room for @a num_points vectors).
+	 *
+	 * The inner loop operates on plain doubles with no branches so the compiler can vectorise it.
+	 */
+	void
+	calculate_velocity_vectors(
+			Vector3D *velocities,
+			const PointOnSphere *points,
+			unsigned int num_points,
+			const FiniteRotation &stage_rotation,
+			const double &delta_time);
+
+	/**
+	 * Similar to @a calculate_velocity_vectors but uses an angular velocity vector
+	 * returned by @a calculate_velocity_angular_vector.
+	 *
+	 * The velocities are identical to calling @a calculate_velocity_vector on each point.
+	 */
+	void
+	calculate_velocity_vectors(
+			Vector3D *velocities,
+			const PointOnSphere *points,
+			unsigned int num_points,
+			const Vector3D &velocity_angular_vector);
+
 	/**
 	 * @brief calculate_velocity_vector_and_omega - as calculate_velocity_vector but
 	 * returns the angular velocity (radians per Ma) in addition to the velocity vector.
@@ -506,9 +506,6 @@ GPlatesMaths::PolygonOnSphere::is_point_in_polygon(
 		d_cached_calculations = new PolygonOnSphereImpl::CachedCalculations();
 	}
 
-	// Keep track of the total number of calls for the adaptive speed mode.
-	++d_cached_calculations->num_point_in_polygon_calls;
-
 	switch (speed_and_memory)
 	{
 	case MEDIUM_SPEED_MEDIUM_SETUP_MEDIUM_MEMORY_USAGE:
@@ -526,6 +523,23 @@ GPlatesMaths::PolygonOnSphere::is_point_in_polygon(
 		break;
 
 	case ADAPTIVE:
+		// Once the high speed point-in-polygon structure has been built there's nothing left to adapt.
+		//
+		// So we stop counting calls, which means adaptive calls then also do not modify this polygon
+		// and hence can be made concurrently from multiple threads (eg, when co-registering in parallel).
+		if (d_cached_calculations->point_in_polygon_speed_and_memory == HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE)
+		{
+			break;
+		}
+
+		// Keep track of the total number of calls for the adaptive speed mode.
+		//
+		// Note that we only count calls in adaptive mode (the only mode that uses the count).
+		// This means that, once a medium or high speed point-in-polygon structure has been built,
+		// non-adaptive calls do not modify this polygon and hence can be made concurrently
+		// from multiple threads (eg, when solving velocities in parallel).
+		++d_cached_calculations->num_point_in_polygon_calls;
+
 		// Adapt the speed according to the number of point-in-polygon calls made so far.
 		//
 		// This is based on:
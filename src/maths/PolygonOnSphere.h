@@ -1665,6 +1665,11 @@ namespace GPlatesMaths
 		 * similar to how filled polygons are currently rendered and so at least there is some
 		 * consistency there (and reconstructed rasters use the point-in-polygon test when generating
 		 * a polygon mesh so it's consistent too).
+		 *
+		 * NOTE: This is only safe to call concurrently from multiple threads once the point-in-polygon
+		 * structure for @a speed_and_memory has been built (eg, by a prior call from a single thread)
+		 * and @a speed_and_memory is not @a ADAPTIVE (or it is @a ADAPTIVE but the high speed
+		 * structure has been built).
 		 */
 		bool
 		is_point_in_polygon(
@@ -79,6 +79,15 @@ namespace GPlatesModel
 	}
 
 
+	template<>
+	void
+	BasicHandle<FeatureStoreRootHandle>::notify_parent_of_pending_notifications()
+	{
+		// Do nothing, as the parent of FeatureStoreRootHandle is the Model,
+		// which always flushes the feature store root when the last NotificationGuard is lifted.
+	}
+
+
 	template<>
 	Model *
 	BasicHandle<FeatureStoreRootHandle>::model_ptr()
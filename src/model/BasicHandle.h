@@ -31,7 +31,9 @@
 #define GPLATES_MODEL_BASICHANDLE_H
 
 #include <algorithm>
+#include <set>
 #include <vector>
+#include <boost/optional.hpp>
 #include <boost/scoped_ptr.hpp>
 
 #include "ChangesetHandle.h"
@@ -254,9 +256,26 @@ namespace GPlatesModel
 		 * This function should be called by a child when the child is modified.
 		 * An event is emitted to callbacks registered with weak references to this
 		 * Handle.
+		 *
+		 * @a child_index is the index of the modified child in our container. The modified
+		 * child is included in the event (see WeakReferencePublisherModifiedEvent::modified_children)
+		 * so that listeners can restrict any invalidation to the modified children.
 		 */
 		void
-		handle_child_modified();
+		handle_child_modified(
+				container_size_type child_index);
+
+		/**
+		 * This function should be called by a child when the child is holding notifications
+		 * (due to an active NotificationGuard) that need to be flushed when the guard is lifted.
+		 *
+		 * Only those children registered here are visited by @a flush_pending_notifications
+		 * (rather than all children) so that flushing a large feature collection only costs
+		 * as much as the number of features actually modified.
+		 */
+		void
+		handle_child_has_pending_notifications(
+				container_size_type child_index);
 
 		/**
 		 * Flushes pending notifications that were held up due to an active NotificationGuard.
@@ -299,11 +318,16 @@ namespace GPlatesModel
 		 *
 		 * If @a child_modified is true, this means that one of this Handle's
 		 * children was modified instead.
+		 *
+		 * If @a modified_child_index is specified then it identifies the modified child.
+		 * While a NotificationGuard is active the modified children are accumulated and
+		 * delivered in one (coalesced) notification when the guard is lifted.
 		 */
 		void
 		notify_listeners_of_modification(
 				bool publisher_modified,
-				bool child_modified);
+				bool child_modified,
+				boost::optional<container_size_type> modified_child_index = boost::none);
 
 		/**
 		 * If model_ptr() does not return NULL and there is a current ChangesetHandle
@@ -361,13 +385,22 @@ namespace GPlatesModel
 		void
 		notify_parent_of_modification();
 
+		/**
+		 * Notifies our parent that we are holding notifications until a NotificationGuard is lifted.
+		 */
+		void
+		notify_parent_of_pending_notifications();
+
 		/**
 		 * Does the job of notify_listeners_of_modification() without the guard checks.
+		 *
+		 * @a modified_children are the children (if any) known to have been modified.
 		 */
 		void
 		actual_notify_listeners_of_modification(
 				bool publisher_modified,
-				bool child_modified);
+				bool child_modified,
+				const std::vector<iterator> &modified_children);
 
 		/**
 		 * Notify our listeners of the addition of a new child.
@@ -483,6 +516,21 @@ namespace GPlatesModel
 		bool d_was_active_before_pending_notifications;
 		boost::scoped_ptr<std::vector<iterator> > d_pending_addition_notifications;
 
+		/**
+		 * Indices of children modified while a NotificationGuard was active.
+		 *
+		 * These are delivered as the modified children of the (coalesced) modification notification.
+		 */
+		boost::scoped_ptr<std::set<container_size_type> > d_pending_modified_children;
+
+		/**
+		 * Indices of children holding notifications while a NotificationGuard was active.
+		 *
+		 * This is a superset of @a d_pending_modified_children since it also includes children
+		 * that were only deactivated/reactivated.
+		 */
+		boost::scoped_ptr<std::set<container_size_type> > d_children_with_pending_notifications;
+
 		friend class RevisionAwareIterator<HandleType>;
 		friend class RevisionAwareIterator<const HandleType>;
 		friend class TopLevelPropertyRef;
@@ -807,6 +855,14 @@ namespace GPlatesModel
 				notify_listeners_of_deactivation();
 			}
 
+			// If a NotificationGuard is holding our (de)activation notification then our parent
+			// needs to flush us when the guard is lifted.
+			Model *model = model_ptr();
+			if (model && model->has_notification_guard())
+			{
+				notify_parent_of_pending_notifications();
+			}
+
 			set_children_active(active);
 		}
 	}
@@ -869,9 +925,38 @@ namespace GPlatesModel
 
 	template<class HandleType>
 	void
-	BasicHandle<HandleType>::handle_child_modified()
+	BasicHandle<HandleType>::handle_child_modified(
+			container_size_type child_index)
 	{
-		notify_listeners_of_modification(false, true);
+		// If a NotificationGuard is active then the child is also holding its own notification.
+		handle_child_has_pending_notifications(child_index);
+
+		notify_listeners_of_modification(false, true, child_index);
+	}
+
+
+	template<class HandleType>
+	void
+	BasicHandle<HandleType>::handle_child_has_pending_notifications(
+			container_size_type child_index)
+	{
+		Model *model = model_ptr();
+
+		if (model && model->has_notification_guard())
+		{
+			if (!d_children_with_pending_notifications)
+			{
+				d_children_with_pending_notifications.reset(new std::set<container_size_type>());
+			}
+
+			// Our parent must also visit us (in order to visit our child) when the guard is lifted.
+			// This matters when our child was only deactivated/reactivated (ie, not modified), since
+			// then we have not been modified and so have not otherwise notified our parent.
+			if (d_children_with_pending_notifications->insert(child_index).second)
+			{
+				notify_parent_of_pending_notifications();
+			}
+		}
 	}
 
 
@@ -879,7 +964,8 @@ namespace GPlatesModel
 	void
 	BasicHandle<HandleType>::notify_listeners_of_modification(
 			bool publisher_modified,
-			bool child_modified)
+			bool child_modified,
+			boost::optional<container_size_type> modified_child_index)
 	{
 		// We always set the unsaved changes flag immediately regardless of
 		// whether there is a NotificationGuard.
@@ -898,12 +984,27 @@ namespace GPlatesModel
 			{
 				d_has_pending_child_modification_notification = true;
 			}
+			if (modified_child_index)
+			{
+				if (!d_pending_modified_children)
+				{
+					d_pending_modified_children.reset(new std::set<container_size_type>());
+				}
+				d_pending_modified_children->insert(modified_child_index.get());
+			}
 		}
 		else
 		{
+			std::vector<iterator> modified_children;
+			if (modified_child_index)
+			{
+				modified_children.push_back(iterator(*d_handle_ptr, modified_child_index.get()));
+			}
+
 			actual_notify_listeners_of_modification(
 					publisher_modified,
-					child_modified);
+					child_modified,
+					modified_children);
 		}
 
 		// We always notify the parent even if there is a NotificationGuard.
@@ -916,7 +1017,8 @@ namespace GPlatesModel
 	void
 	BasicHandle<HandleType>::actual_notify_listeners_of_modification(
 			bool publisher_modified,
-			bool child_modified)
+			bool child_modified,
+			const std::vector<iterator> &modified_children)
 	{
 		int publisher_bit = publisher_modified ?
 			WeakReferencePublisherModifiedEvent<HandleType>::PUBLISHER_MODIFIED :
@@ -928,10 +1030,18 @@ namespace GPlatesModel
 			static_cast<typename WeakReferencePublisherModifiedEvent<HandleType>::Type>(
 					publisher_bit | child_bit);
 
-		WeakReferencePublisherModifiedVisitor<HandleType> visitor(type);
+		// The events (delivered to each listener) share the modified children.
+		const typename WeakReferencePublisherModifiedEvent<HandleType>::modified_children_ptr_type
+				shared_modified_children(new std::vector<iterator>(modified_children));
+		WeakReferencePublisherModifiedVisitor<HandleType> visitor(type, shared_modified_children);
 		this->apply_weak_observer_visitor(visitor);
+
+		const typename WeakReferencePublisherModifiedEvent<const HandleType>::modified_children_ptr_type
+				shared_const_modified_children(
+						new std::vector<const_iterator>(modified_children.begin(), modified_children.end()));
 		WeakReferencePublisherModifiedVisitor<const HandleType> const_visitor(
-				static_cast<typename WeakReferencePublisherModifiedEvent<const HandleType>::Type>(type));
+				static_cast<typename WeakReferencePublisherModifiedEvent<const HandleType>::Type>(type),
+				shared_const_modified_children);
 		this->apply_const_weak_observer_visitor(const_visitor);
 	}
 
@@ -1070,7 +1180,7 @@ namespace GPlatesModel
 		if (d_parent_ptr)
 		{
 			BasicHandle<parent_type> &parent = dynamic_cast<BasicHandle<parent_type> &>(*d_parent_ptr);
-			parent.handle_child_modified();
+			parent.handle_child_modified(d_index_in_container);
 		}
 	}
 
@@ -1081,6 +1191,24 @@ namespace GPlatesModel
 	BasicHandle<FeatureStoreRootHandle>::notify_parent_of_modification();
 
 
+	template<class HandleType>
+	void
+	BasicHandle<HandleType>::notify_parent_of_pending_notifications()
+	{
+		if (d_parent_ptr)
+		{
+			BasicHandle<parent_type> &parent = dynamic_cast<BasicHandle<parent_type> &>(*d_parent_ptr);
+			parent.handle_child_has_pending_notifications(d_index_in_container);
+		}
+	}
+
+
+	// Template specialisations are in the .cc file.
+	template<>
+	void
+	BasicHandle<FeatureStoreRootHandle>::notify_parent_of_pending_notifications();
+
+
 	template<class HandleType>
 	void
 	BasicHandle<HandleType>::flush_pending_notifications()
@@ -1091,9 +1219,32 @@ namespace GPlatesModel
 		if (d_has_pending_publisher_modification_notification ||
 				d_has_pending_child_modification_notification)
 		{
+			// Coalesce the children modified while the guard was active into one notification.
+			// Children that have since been removed are not included.
+			std::vector<iterator> modified_children;
+			if (d_pending_modified_children)
+			{
+				const revision_type &revision = *current_revision();
+
+				typename std::set<container_size_type>::const_iterator modified_child_iter =
+						d_pending_modified_children->begin();
+				typename std::set<container_size_type>::const_iterator modified_child_end =
+						d_pending_modified_children->end();
+				for ( ; modified_child_iter != modified_child_end; ++modified_child_iter)
+				{
+					if (revision.has_element_at(*modified_child_iter))
+					{
+						modified_children.push_back(iterator(*d_handle_ptr, *modified_child_iter));
+					}
+				}
+
+				d_pending_modified_children.reset(NULL);
+			}
+
 			actual_notify_listeners_of_modification(
 					d_has_pending_publisher_modification_notification,
-					d_has_pending_child_modification_notification);
+					d_has_pending_child_modification_notification,
+					modified_children);
 			d_has_pending_publisher_modification_notification = false;
 			d_has_pending_child_modification_notification = false;
 		}
@@ -1127,9 +1278,32 @@ namespace GPlatesModel
 	void
 	BasicHandle<HandleType>::flush_children_pending_notifications()
 	{
-		for (iterator iter = begin(); iter != end(); ++iter)
+		if (!d_children_with_pending_notifications)
+		{
+			return;
+		}
+
+		// Only visit those children that are holding notifications (instead of all children).
+		//
+		// Take ownership of the set first in case flushing a child's notifications results in
+		// listeners modifying the model (and hence registering pending notifications with us).
+		boost::scoped_ptr<std::set<container_size_type> > children_with_pending_notifications;
+		children_with_pending_notifications.swap(d_children_with_pending_notifications);
+
+		typename std::set<container_size_type>::const_iterator child_iter =
+				children_with_pending_notifications->begin();
+		typename std::set<container_size_type>::const_iterator child_end =
+				children_with_pending_notifications->end();
+		for ( ; child_iter != child_end; ++child_iter)
 		{
-			BasicHandle<child_type> &child = dynamic_cast<BasicHandle<child_type> &>(**iter);
+			// Skip children that have since been removed.
+			if (!current_revision()->has_element_at(*child_iter))
+			{
+				continue;
+			}
+
+			BasicHandle<child_type> &child = dynamic_cast<BasicHandle<child_type> &>(
+					*current_revision()->get(*child_iter));
 			child.flush_pending_notifications();
 		}
 	}
@@ -176,7 +176,7 @@ GPlatesModel::FeatureHandle::set(
 	{
 		current_revision()->set(iter.index(), new_child->deep_clone());
 
-		notify_listeners_of_modification(false, true);
+		notify_listeners_of_modification(false, true, iter.index());
 
 		ChangesetHandle *changeset_ptr = current_changeset_handle_ptr();
 		if (changeset_ptr)
@@ -31,6 +31,7 @@
 #include <vector>
 #include <boost/operators.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "StringSetSingletons.h"
 
@@ -106,7 +107,8 @@ namespace GPlatesModel
 			BackRef(
 					back_ref_target_type &target,
 					shared_iterator_type &sh_iter):
-				d_target_ptr(&target)
+				d_target_ptr(&target),
+				d_back_refs_mutex(sh_iter.back_refs_mutex())
 			{
 				// For some reason, VS2008 is giving us warning C4355 ('this'
 				// used in base member initializer list) - which makes no sense.
@@ -115,12 +117,18 @@ namespace GPlatesModel
 						new back_ref_list_type::Node(this));
 
 				// Register this BackRef as a back-reference for this ID.
+				// Features (and hence back-references) can be created on multiple threads.
+				boost::mutex::scoped_lock lock(d_back_refs_mutex);
 				sh_iter.back_refs().append(*d_node_for_back_ref_registration);
 			}
 
 			virtual
 			~BackRef()
-			{  }
+			{
+				// De-register this BackRef (by destroying its node) while holding the lock.
+				boost::mutex::scoped_lock lock(d_back_refs_mutex);
+				d_node_for_back_ref_registration.reset();
+			}
 
 			/**
 			 * Access the target of this back-reference, an object which defines this
@@ -147,6 +155,11 @@ namespace GPlatesModel
 			 */
 			back_ref_target_type *d_target_ptr;
 
+			/**
+			 * The mutex guarding registration in the list of back-references for the ID.
+			 */
+			boost::mutex &d_back_refs_mutex;
+
 			/**
 			 * The smart node which is linked into the list of back-references.
 			 *
@@ -55,6 +55,12 @@ namespace GPlatesModel
 	 * instance, a NotificationGuard was active when feature F in feature
 	 * collection FC was modified and feature G was added to FC, only one
 	 * modification notification will be sent by FC to its listeners.
+	 * That notification identifies all children of FC that were modified (F in
+	 * this instance) so that listeners can restrict their updates to those children.
+	 *
+	 * Each Handle also keeps track of which of its children have queued
+	 * notifications, so that when the final NotificationGuard is destroyed only
+	 * those Handles are visited (rather than every Handle in the model).
 	 */
 	class NotificationGuard :
 			private boost::noncopyable
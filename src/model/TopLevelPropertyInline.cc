@@ -33,6 +33,7 @@
 PUSH_MSVC_WARNINGS
 DISABLE_MSVC_WARNING(4181)
 #include <boost/lambda/lambda.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "TopLevelPropertyInline.h"
 #include "FeatureVisitor.h"
@@ -40,6 +41,19 @@ DISABLE_MSVC_WARNING(4181)
 #include "utils/UnicodeStringUtils.h"
 
 
+namespace
+{
+	/**
+	 * Serialises the decoding of lazy property values.
+	 *
+	 * Lazy values are decoded on first access (typically via const methods) which can happen
+	 * in multiple threads, and decoders (such as the binary GPML reader) can share state across
+	 * properties, so all decoding is done under a single lock.
+	 */
+	boost::mutex lazy_values_mutex;
+}
+
+
 const GPlatesModel::TopLevelPropertyInline::non_null_ptr_type
 GPlatesModel::TopLevelPropertyInline::create(
 		const PropertyName &property_name_,
@@ -92,6 +106,21 @@ GPlatesModel::TopLevelPropertyInline::create(
 }
 
 
+const GPlatesModel::TopLevelPropertyInline::non_null_ptr_type
+GPlatesModel::TopLevelPropertyInline::create_lazy(
+		const PropertyName &property_name_,
+		const LazyValues::non_null_ptr_to_const_type &lazy_values_,
+		const xml_attributes_type &xml_attributes_)
+{
+	non_null_ptr_type ptr(
+			new TopLevelPropertyInline(
+				property_name_,
+				lazy_values_,
+				xml_attributes_));
+	return ptr;
+}
+
+
 const GPlatesModel::TopLevelProperty::non_null_ptr_type
 GPlatesModel::TopLevelPropertyInline::clone() const
 {
@@ -104,6 +133,8 @@ GPlatesModel::TopLevelPropertyInline::clone() const
 const GPlatesModel::TopLevelProperty::non_null_ptr_type
 GPlatesModel::TopLevelPropertyInline::deep_clone() const 
 {
+	load_lazy_values();
+
 	TopLevelPropertyInline::non_null_ptr_type dup = create(
 			property_name(),
 			container_type(),
@@ -139,6 +170,8 @@ std::ostream &
 GPlatesModel::TopLevelPropertyInline::print_to(
 		std::ostream &os) const
 {
+	load_lazy_values();
+
 	os << property_name().build_aliased_name() << " [ ";
 
 	bool first = true;
@@ -167,6 +200,10 @@ GPlatesModel::TopLevelPropertyInline::operator==(
 	try
 	{
 		const TopLevelPropertyInline &other_inline = dynamic_cast<const TopLevelPropertyInline &>(other);
+
+		load_lazy_values();
+		other_inline.load_lazy_values();
+
 		if (property_name() == other.property_name() &&
 			xml_attributes() == other.xml_attributes() &&
 			d_values.size() == other_inline.d_values.size())
@@ -190,6 +227,36 @@ GPlatesModel::TopLevelPropertyInline::operator==(
 }
 
 
+void
+GPlatesModel::TopLevelPropertyInline::decode_lazy_values() const
+{
+	boost::mutex::scoped_lock lock(lazy_values_mutex);
+
+	// Another thread might have decoded the values while we were waiting for the lock.
+	if (!d_lazy_values)
+	{
+		return;
+	}
+
+	// Release the lazy values before decoding (in case decoding throws) so we only try once.
+	const boost::intrusive_ptr<const LazyValues> lazy_values = d_lazy_values;
+	d_lazy_values.reset();
+
+	try
+	{
+		lazy_values->decode(d_values);
+	}
+	catch (...)
+	{
+		d_has_lazy_values.store(false, std::memory_order_release);
+		throw;
+	}
+
+	// Publish the decoded values to threads that don't lock (see 'has_lazy_values()').
+	d_has_lazy_values.store(false, std::memory_order_release);
+}
+
+
 // See above.
 POP_MSVC_WARNINGS
 
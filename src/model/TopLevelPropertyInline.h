@@ -31,9 +31,11 @@
 #ifndef GPLATES_MODEL_TOPLEVELPROPERTYINLINE_H
 #define GPLATES_MODEL_TOPLEVELPROPERTYINLINE_H
 
+#include <atomic>
 #include <vector>
 #include <boost/optional.hpp>
 #include <boost/function.hpp>
+#include <boost/intrusive_ptr.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 #include <boost/lambda/construct.hpp>
 
@@ -42,6 +44,8 @@
 
 #include "global/unicode.h"
 
+#include "utils/ReferenceCount.h"
+
 namespace GPlatesModel
 {
 	/**
@@ -75,6 +79,38 @@ namespace GPlatesModel
 		 */
 		typedef container_type::iterator iterator;
 
+
+		/**
+		 * Decodes the property values of a top-level property created with @a create_lazy.
+		 *
+		 * This allows file readers to defer decoding property values (such as large geometries)
+		 * until they are first accessed.
+		 */
+		class LazyValues :
+				public GPlatesUtils::ReferenceCount<LazyValues>
+		{
+		public:
+
+			typedef GPlatesUtils::non_null_intrusive_ptr<const LazyValues> non_null_ptr_to_const_type;
+
+			virtual
+			~LazyValues()
+			{  }
+
+			/**
+			 * Appends the decoded property values to @a values.
+			 *
+			 * If the values cannot be decoded then none should be appended.
+			 *
+			 * Calls to this method (across all lazy values) are serialised by TopLevelPropertyInline
+			 * so implementations do not need to be thread-safe.
+			 */
+			virtual
+			void
+			decode(
+					container_type &values) const = 0;
+		};
+
 	private:
 
 		/**
@@ -136,6 +172,21 @@ namespace GPlatesModel
 				const AttributeIterator &attributes_begin,
 				const AttributeIterator &attributes_end);
 
+		/**
+		 * Creates a top-level property whose property values are decoded by @a lazy_values_
+		 * when they are first accessed (eg, by iterating over them or visiting them).
+		 *
+		 * Decoding is thread-safe so the property values can be accessed (via const methods)
+		 * from multiple threads. Cloning the property decodes its values first so that the clone
+		 * does not depend on the source of the lazy values (eg, a file that might later be overwritten).
+		 */
+		static
+		const non_null_ptr_type
+		create_lazy(
+				const PropertyName &property_name_,
+				const LazyValues::non_null_ptr_to_const_type &lazy_values_,
+				const xml_attributes_type &xml_attributes_ = xml_attributes_type());
+
 		virtual
 		const TopLevelProperty::non_null_ptr_type
 		clone() const;
@@ -147,6 +198,7 @@ namespace GPlatesModel
 		const_iterator
 		begin() const
 		{
+			load_lazy_values();
 			return boost::make_transform_iterator(
 					d_values.begin(),
 					make_const_ptr_fn_type(boost::lambda::constructor<PropertyValue::non_null_ptr_to_const_type>()));
@@ -155,6 +207,7 @@ namespace GPlatesModel
 		const_iterator
 		end() const
 		{
+			load_lazy_values();
 			return boost::make_transform_iterator(
 					d_values.end(),
 					make_const_ptr_fn_type(boost::lambda::constructor<PropertyValue::non_null_ptr_to_const_type>()));
@@ -163,21 +216,48 @@ namespace GPlatesModel
 		iterator
 		begin()
 		{
+			load_lazy_values();
 			return d_values.begin();
 		}
 
 		iterator
 		end()
 		{
+			load_lazy_values();
 			return d_values.end();
 		}
 
 		size_t
 		size() const
 		{
+			load_lazy_values();
 			return d_values.size();
 		}
 
+		/**
+		 * Returns true if this property was created with @a create_lazy and its property values
+		 * have not yet been decoded.
+		 */
+		bool
+		has_lazy_values() const
+		{
+			return d_has_lazy_values.load(std::memory_order_acquire);
+		}
+
+		/**
+		 * Decodes the property values now if they have not yet been decoded (see @a create_lazy).
+		 *
+		 * This is called automatically when the property values are accessed.
+		 */
+		void
+		load_lazy_values() const
+		{
+			if (has_lazy_values())
+			{
+				decode_lazy_values();
+			}
+		}
+
 		virtual
 		void
 		accept_visitor(
@@ -205,7 +285,8 @@ namespace GPlatesModel
 				const container_type &values_,
 				const xml_attributes_type &xml_attributes_) :
 			TopLevelProperty(property_name_, xml_attributes_),
-			d_values(values_)
+			d_values(values_),
+			d_has_lazy_values(false)
 		{  }
 
 		template<class PropertyValueIterator>
@@ -215,27 +296,72 @@ namespace GPlatesModel
 				const PropertyValueIterator &values_end_,
 				const xml_attributes_type &xml_attributes_) :
 			TopLevelProperty(property_name_, xml_attributes_),
-			d_values(values_begin_, values_end_)
+			d_values(values_begin_, values_end_),
+			d_has_lazy_values(false)
 		{  }
 
 		TopLevelPropertyInline(
 				const PropertyName &property_name_,
 				PropertyValue::non_null_ptr_type value_,
 				const xml_attributes_type &xml_attributes_) :
-			TopLevelProperty(property_name_, xml_attributes_)
+			TopLevelProperty(property_name_, xml_attributes_),
+			d_has_lazy_values(false)
 		{
 			d_values.push_back(value_);
 		}
 
+		TopLevelPropertyInline(
+				const PropertyName &property_name_,
+				const LazyValues::non_null_ptr_to_const_type &lazy_values_,
+				const xml_attributes_type &xml_attributes_) :
+			TopLevelProperty(property_name_, xml_attributes_),
+			d_lazy_values(lazy_values_.get()),
+			d_has_lazy_values(true)
+		{  }
+
+		/**
+		 * Copies the property values of @a other (decoding them first if necessary).
+		 */
 		TopLevelPropertyInline(
 				const TopLevelPropertyInline &other) :
 			TopLevelProperty(other),
-			d_values(other.d_values)
+			d_values(other.get_decoded_values()),
+			d_has_lazy_values(false)
 		{  }
 
 	private:
 
-		container_type d_values;
+		/**
+		 * The property values.
+		 *
+		 * This is mutable because lazy property values are decoded on first (const) access.
+		 */
+		mutable container_type d_values;
+
+		/**
+		 * Decodes the property values on first access (if this property was created with @a create_lazy).
+		 *
+		 * This is released once the property values are decoded.
+		 */
+		mutable boost::intrusive_ptr<const LazyValues> d_lazy_values;
+
+		/**
+		 * True until the lazy property values (if any) have been decoded into @a d_values.
+		 *
+		 * Once this is false @a d_values can be accessed without locking.
+		 */
+		mutable std::atomic<bool> d_has_lazy_values;
+
+
+		const container_type &
+		get_decoded_values() const
+		{
+			load_lazy_values();
+			return d_values;
+		}
+
+		void
+		decode_lazy_values() const;
 
 		// This operator should never be defined, because we don't want/need to allow
 		// copy-assignment:  All copying should use the virtual copy-constructor 'clone'
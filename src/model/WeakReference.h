@@ -354,13 +354,14 @@ namespace GPlatesModel
 		 */
 		void
 		publisher_modified(
-				typename WeakReferencePublisherModifiedEvent<H>::Type type) const
+				typename WeakReferencePublisherModifiedEvent<H>::Type type,
+				const typename WeakReferencePublisherModifiedEvent<H>::modified_children_ptr_type &modified_children) const
 		{
 			if (d_callback)
 			{
 				d_callback->publisher_modified(
 						*this,
-						WeakReferencePublisherModifiedEvent<H>(type));
+						WeakReferencePublisherModifiedEvent<H>(type, modified_children));
 			}
 		}
 
@@ -30,6 +30,7 @@
 
 #include <vector>
 #include <boost/intrusive_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include "HandleTraits.h"
 #include "utils/ReferenceCount.h"
@@ -46,7 +47,30 @@ namespace GPlatesModel
 	template<typename H>
 	class WeakReferencePublisherModifiedEvent
 	{
+	private:
+
+		// Helper traits class to choose appropriate const-ness for modified children.
+		template<class T>
+		struct Traits
+		{
+			typedef typename HandleTraits<T>::iterator iterator;
+		};
+
+		template<class T>
+		struct Traits<const T>
+		{
+			typedef typename HandleTraits<T>::const_iterator iterator;
+		};
+
 	public:
+
+		typedef std::vector<typename Traits<H>::iterator> modified_children_container_type;
+
+		/**
+		 * The modified children are shared (rather than copied) by the events delivered to each listener.
+		 */
+		typedef boost::shared_ptr<const modified_children_container_type> modified_children_ptr_type;
+
 		enum Type
 		{
 			NONE = 0,
@@ -74,10 +98,11 @@ namespace GPlatesModel
 			PUBLISHER_AND_CHILD_MODIFIED = (PUBLISHER_MODIFIED | CHILD_MODIFIED)
 		};
 
-		explicit
 		WeakReferencePublisherModifiedEvent(
-				Type type_) :
-			d_type(type_)
+				Type type_,
+				const modified_children_ptr_type &modified_children_) :
+			d_type(type_),
+			d_modified_children(modified_children_)
 		{
 		}
 
@@ -87,9 +112,31 @@ namespace GPlatesModel
 			return d_type;
 		}
 
+		/**
+		 * The children of the publisher that were modified (if @a type includes CHILD_MODIFIED).
+		 *
+		 * If a NotificationGuard was active then this contains all children modified while the
+		 * guard was active (coalesced into this one event), otherwise it contains the one child
+		 * that was modified. Children that were subsequently removed from the publisher are not included.
+		 *
+		 * Note that this does not identify children that were added or removed (those set
+		 * PUBLISHER_MODIFIED instead), so listeners should treat a PUBLISHER_MODIFIED event as
+		 * potentially affecting any child. For example, a feature collection's listeners can
+		 * invalidate only the modified features if the event type is only CHILD_MODIFIED.
+		 *
+		 * The modified children are shared by copies of this event, so a listener can keep
+		 * a copy of the event beyond the publisher_modified() callback.
+		 */
+		const modified_children_container_type &
+		modified_children() const
+		{
+			return *d_modified_children;
+		}
+
 	private:
 
 		Type d_type;
+		modified_children_ptr_type d_modified_children;
 	};
 
 	/**
@@ -49,8 +49,10 @@ namespace GPlatesModel
 	public:
 
 		WeakReferencePublisherModifiedVisitor(
-				typename WeakReferencePublisherModifiedEvent<H>::Type type) :
-			d_type(type)
+				typename WeakReferencePublisherModifiedEvent<H>::Type type,
+				const typename WeakReferencePublisherModifiedEvent<H>::modified_children_ptr_type &modified_children) :
+			d_type(type),
+			d_modified_children(modified_children)
 		{
 		}
 
@@ -59,12 +61,13 @@ namespace GPlatesModel
 		visit_weak_reference(
 				WeakReference<H> &weak_reference)
 		{
-			weak_reference.publisher_modified(d_type);
+			weak_reference.publisher_modified(d_type, d_modified_children);
 		}
 
 	private:
 
 		typename WeakReferencePublisherModifiedEvent<H>::Type d_type;
+		typename WeakReferencePublisherModifiedEvent<H>::modified_children_ptr_type d_modified_children;
 
 	};
 
@@ -29,6 +29,8 @@
 #include <iostream>
 #include <iterator>
 #include <boost/bind/bind.hpp>
+#include <QLocale>
+#include <QStringList>
 
 #include "XmlNode.h"
 
@@ -158,18 +160,96 @@ GPlatesModel::XmlTextNode::create(
 }
 
 
+boost::optional<GPlatesModel::XmlTextNode::non_null_ptr_type>
+GPlatesModel::XmlTextNode::create_numeric_list(
+		const qint64 &line_num,
+		const qint64 &col_num,
+		const QString &text)
+{
+	std::vector<double> numeric_list;
+
+	const QChar *const chars = text.constData();
+	const int num_chars = text.length();
+
+	int char_index = 0;
+	while (true)
+	{
+		// Skip whitespace to the start of the next token.
+		while (char_index < num_chars && chars[char_index].isSpace())
+		{
+			++char_index;
+		}
+		if (char_index == num_chars)
+		{
+			break;
+		}
+
+		const int token_start = char_index;
+		while (char_index < num_chars && !chars[char_index].isSpace())
+		{
+			++char_index;
+		}
+
+		// Parse the token in-place (without copying it out of 'text').
+		bool ok = false;
+		const double number =
+				QString::fromRawData(chars + token_start, char_index - token_start).toDouble(&ok);
+		if (!ok)
+		{
+			return boost::none;
+		}
+
+		numeric_list.push_back(number);
+	}
+
+	if (numeric_list.empty())
+	{
+		return boost::none;
+	}
+
+	return non_null_ptr_type(new XmlTextNode(line_num, col_num, numeric_list));
+}
+
+
+const QString &
+GPlatesModel::XmlTextNode::get_text() const
+{
+	// Regenerate the text from the numbers if it hasn't been done yet.
+	if (d_numeric_list &&
+		d_text.isEmpty())
+	{
+		QStringList tokens;
+		tokens.reserve(d_numeric_list->size());
+		for (std::vector<double>::const_iterator number_iter = d_numeric_list->begin();
+			number_iter != d_numeric_list->end();
+			++number_iter)
+		{
+#if QT_VERSION >= QT_VERSION_CHECK(5,7,0)
+			tokens.append(QString::number(*number_iter, 'g', QLocale::FloatingPointShortest));
+#else
+			tokens.append(QString::number(*number_iter, 'g', 17));
+#endif
+		}
+		d_text = tokens.join(" ");
+	}
+
+	return d_text;
+}
+
+
 void
 GPlatesModel::XmlTextNode::write_to(
 		QXmlStreamWriter &writer) const 
 {
-	writer.writeCharacters(d_text);
+	writer.writeCharacters(get_text());
 }
 
 
 const GPlatesModel::XmlElementNode::non_null_ptr_type
 GPlatesModel::XmlElementNode::create(
 		QXmlStreamReader &reader,
-		const boost::shared_ptr<GPlatesModel::XmlElementNode::AliasToNamespaceMap> &parent_alias_map)
+		const boost::shared_ptr<GPlatesModel::XmlElementNode::AliasToNamespaceMap> &parent_alias_map,
+		boost::optional<const element_name_seq_type &> numeric_list_element_names)
 {
 	// Add this scope to the call stack trace that is printed for an exception thrown in this scope.
 	TRACK_CALL_STACK();
@@ -217,6 +297,21 @@ GPlatesModel::XmlElementNode::create(
 
 	elem->load_attributes(reader.attributes());
 
+	// See if the text content of this element should be streamed into a numeric list.
+	bool is_numeric_list_element =
+			numeric_list_element_names &&
+			std::find(
+					numeric_list_element_names->begin(),
+					numeric_list_element_names->end(),
+					element_name) != numeric_list_element_names->end();
+
+	// The text content of a numeric list element is accumulated across character tokens
+	// (the reader can split text into several tokens when data arrives incrementally, such as
+	// from a gzip pipe) and only converted to numbers once the end element is reached.
+	QString numeric_list_text;
+	qint64 numeric_list_line_num = 0;
+	qint64 numeric_list_col_num = 0;
+
 	// .atEnd() can not be relied upon when reading a QProcess,
 	// so we must make sure we block for a moment to make sure
 	// the process is ready to feed us data.
@@ -232,10 +327,32 @@ GPlatesModel::XmlElementNode::create(
 
 		if (reader.isStartElement())
 		{
+			if (is_numeric_list_element)
+			{
+				// Mixed content - revert to a regular text node for any text accumulated so far.
+				is_numeric_list_element = false;
+				if (!numeric_list_text.trimmed().isEmpty())
+				{
+					elem->d_children.push_back(
+							XmlTextNode::non_null_ptr_type(
+									new XmlTextNode(numeric_list_line_num, numeric_list_col_num, numeric_list_text)));
+				}
+				numeric_list_text.clear();
+			}
+
 			XmlNode::non_null_ptr_type child = 
-				XmlElementNode::create(reader, elem->d_alias_map);
+				XmlElementNode::create(reader, elem->d_alias_map, numeric_list_element_names);
 			elem->d_children.push_back(child);
 		}
+		else if (is_numeric_list_element && reader.isCharacters())
+		{
+			if (numeric_list_text.isEmpty())
+			{
+				numeric_list_line_num = reader.lineNumber();
+				numeric_list_col_num = reader.columnNumber();
+			}
+			numeric_list_text.append(reader.text());
+		}
 		else if (reader.isCharacters() && ! reader.isWhitespace())
 		{
 			XmlNode::non_null_ptr_type child = XmlTextNode::create(reader);
@@ -245,6 +362,24 @@ GPlatesModel::XmlElementNode::create(
 		reader.device()->waitForReadyRead(1000);
 	}
 
+	if (is_numeric_list_element &&
+		!numeric_list_text.trimmed().isEmpty())
+	{
+		boost::optional<XmlTextNode::non_null_ptr_type> numeric_list_child =
+				XmlTextNode::create_numeric_list(numeric_list_line_num, numeric_list_col_num, numeric_list_text);
+		if (numeric_list_child)
+		{
+			elem->d_children.push_back(numeric_list_child.get());
+		}
+		else
+		{
+			// Not all tokens are numbers so fall back to a regular text node.
+			elem->d_children.push_back(
+					XmlTextNode::non_null_ptr_type(
+							new XmlTextNode(numeric_list_line_num, numeric_list_col_num, numeric_list_text)));
+		}
+	}
+
 	return elem;
 }
 
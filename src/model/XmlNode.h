@@ -30,6 +30,8 @@
 #include <map>
 #include <list>
 #include <utility>
+#include <vector>
+#include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
 #include <QXmlStreamReader>
 
@@ -133,10 +135,30 @@ namespace GPlatesModel
 				GPlatesUtils::NullIntrusivePointerHandler>
 						non_null_ptr_to_const_type;
 
+		/**
+		 * Returns the text of this node.
+		 *
+		 * If this node was created as a numeric list (see @a create_numeric_list) then the
+		 * text is regenerated (once) from the numbers - the numbers are preserved exactly
+		 * although their original formatting (eg, trailing zeros) is not.
+		 */
 		const QString &
-		get_text() const
+		get_text() const;
+
+		/**
+		 * Returns the numbers if this node was created as a numeric list, otherwise boost::none.
+		 *
+		 * This allows readers of large numeric payloads (such as coordinate lists) to bypass
+		 * re-tokenising the text returned by @a get_text.
+		 */
+		boost::optional<const std::vector<double> &>
+		get_numeric_list() const
 		{
-			return d_text;
+			if (!d_numeric_list)
+			{
+				return boost::none;
+			}
+			return d_numeric_list.get();
 		}
 
 		virtual
@@ -149,6 +171,18 @@ namespace GPlatesModel
 		create(
 				QXmlStreamReader &reader);
 
+		/**
+		 * Parses the whitespace-separated numbers in @a text and stores them instead of the text.
+		 *
+		 * Returns boost::none if any token in @a text is not a number, or there are no tokens.
+		 */
+		static
+		boost::optional<non_null_ptr_type>
+		create_numeric_list(
+				const qint64 &line_num,
+				const qint64 &col_num,
+				const QString &text);
+
 
 		virtual
 		void
@@ -161,7 +195,12 @@ namespace GPlatesModel
 				XmlNodeVisitor &visitor);
 
 	private:
-		QString d_text;
+		/**
+		 * The text (lazily generated from @a d_numeric_list if this is a numeric list node).
+		 */
+		mutable QString d_text;
+
+		boost::optional< std::vector<double> > d_numeric_list;
 
 		XmlTextNode(
 				const qint64 &line_num,
@@ -170,10 +209,24 @@ namespace GPlatesModel
 			XmlNode(line_num, col_num), d_text(text)
 		{ }
 
+		XmlTextNode(
+				const qint64 &line_num,
+				const qint64 &col_num,
+				std::vector<double> &numeric_list) :
+			XmlNode(line_num, col_num),
+			d_numeric_list(std::vector<double>())
+		{
+			// Avoid copying the (potentially large) list of numbers.
+			d_numeric_list->swap(numeric_list);
+		}
+
 
 		XmlTextNode &
 		operator=(
 				const XmlTextNode &);
+
+		// So XmlElementNode can create text nodes from text accumulated over several reader tokens.
+		friend class XmlElementNode;
 	};
 
 
@@ -211,6 +264,8 @@ namespace GPlatesModel
 
 		typedef std::map<QString, QString> AliasToNamespaceMap;
 
+		typedef std::vector<XmlElementName> element_name_seq_type;
+
 		const XmlElementName &
 		get_name() const
 		{
@@ -305,11 +360,20 @@ namespace GPlatesModel
 		{ }
 
 
+		/**
+		 * Creates an element node (and its descendants) from the start element that @a reader is at.
+		 *
+		 * The text content of any (descendant) element named in @a numeric_list_element_names is
+		 * streamed directly into a numeric list text node (see @a XmlTextNode::create_numeric_list),
+		 * rather than stored as text, provided it has no child elements and all its tokens are numbers.
+		 * This is intended for large payloads such as coordinate lists.
+		 */
 		static
 		const non_null_ptr_type
 		create(
 				QXmlStreamReader &reader,
-				const boost::shared_ptr<AliasToNamespaceMap> &parent_alias_map);
+				const boost::shared_ptr<AliasToNamespaceMap> &parent_alias_map,
+				boost::optional<const element_name_seq_type &> numeric_list_element_names = boost::none);
 
 		static
 		const non_null_ptr_type
@@ -717,6 +717,9 @@ GPlatesOpenGL::GLVisualLayers::RasterLayerUsage::get_multi_resolution_raster(
 		d_raster_modulate_colour_dirty = false;
 	}
 
+	// Replace any previewed raster data once the raster file caches have been created in the background.
+	d_visual_raster_source.get()->update_previewed_raster_data();
+
 	// If we're not up-to-date with respect to the raster feature in the raster layer proxy then rebuild.
 	if (!d_raster_layer_proxy->get_raster_feature_subject_token().is_observer_up_to_date(
 			d_raster_feature_observer_token))
@@ -140,6 +140,7 @@ GPlatesOpenGL::GLVisualRasterSource::GLVisualRasterSource(
 	d_tile_texel_dimension(tile_texel_dimension),
 	// Start with small size cache and just let the cache grow in size as needed...
 	d_raster_texture_cache(GPlatesUtils::ObjectCache<GLTexture>::create()),
+	d_previewing_raster_data(proxy_raster_resolver->is_previewing_levels()),
 	d_raster_modulate_colour(raster_modulate_colour),
 	d_full_screen_quad_drawable(
 			GLUtils::create_full_screen_2D_coloured_textured_quad(
@@ -263,6 +264,7 @@ GPlatesOpenGL::GLVisualRasterSource::change_raster(
 		return false;
 	}
 	d_proxied_raster_resolver = proxy_resolver_opt.get();
+	d_previewing_raster_data = d_proxied_raster_resolver->is_previewing_levels();
 
 	// New raster colour palette.
 	d_raster_colour_palette = raster_colour_palette;
@@ -308,6 +310,26 @@ GPlatesOpenGL::GLVisualRasterSource::change_modulate_colour(
 }
 
 
+void
+GPlatesOpenGL::GLVisualRasterSource::update_previewed_raster_data()
+{
+	// If the raster file caches have been created (in the background) since we last checked
+	// then the previewed raster data can now be replaced with the mipmapped raster data.
+	if (!d_previewing_raster_data ||
+		d_proxied_raster_resolver->is_previewing_levels())
+	{
+		return;
+	}
+
+	d_previewing_raster_data = false;
+
+	// Invalidate any raster data that clients may have cached.
+	invalidate();
+	// Also invalidate our internal raster texture cache since it contains previewed raster data.
+	d_raster_data_subject_token.invalidate();
+}
+
+
 void
 GPlatesOpenGL::GLVisualRasterSource::initialise_level_of_detail_pyramid()
 {
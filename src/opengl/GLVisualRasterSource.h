@@ -149,6 +149,16 @@ namespace GPlatesOpenGL
 				const GPlatesGui::Colour &raster_modulate_colour);
 
 
+		/**
+		 * Reloads the raster data if it was previewed while the raster file caches were still
+		 * being created in the background, and those caches have since been created.
+		 *
+		 * This should be called before rendering with this raster source.
+		 */
+		void
+		update_previewed_raster_data();
+
+
 		virtual
 		unsigned int
 		get_raster_width() const
@@ -297,12 +307,19 @@ namespace GPlatesOpenGL
 		/**
 		 * Keeps track of changes to the raster data itself (the data sourced from the proxied raster resolver).
 		 *
-		 * Changes include a new raster (eg, time-dependent raster) and/or a new raster colour palette.
+		 * Changes include a new raster (eg, time-dependent raster) and/or a new raster colour palette,
+		 * and the completion of raster file caches (replacing previewed raster data).
 		 * NOTE: Does *not* include changes to the modulate colour as this affects the raster data
 		 * *after* it's loaded from the proxied raster resolver.
 		 */
 		GPlatesUtils::SubjectToken d_raster_data_subject_token;
 
+		/**
+		 * Whether the raster data is being previewed because the raster file caches are still
+		 * being created in the background.
+		 */
+		bool d_previewing_raster_data;
+
 		/**
 		 * The cached source textures across the different levels of detail.
 		 */
@@ -122,6 +122,17 @@ namespace GPlatesPropertyValues
 				const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette =
 					GPlatesGui::RasterColourPalette::create()) = 0;
 
+		/**
+		 * Returns true if the levels (other than level 0) are currently previewed directly
+		 * from the source raster because the raster file caches are still being created
+		 * in the background.
+		 *
+		 * Clients that cache regions of levels should reload them once this returns false.
+		 */
+		virtual
+		bool
+		is_previewing_levels() = 0;
+
 		/**
 		 * Returns the number of levels in the mipmap file.
 		 *
@@ -131,6 +142,10 @@ namespace GPlatesPropertyValues
 		 * Returns 1 if there was an error in reading the mipmap file; 1 is
 		 * returned because level 0 is read from the source raster file, not
 		 * from the mipmap file.
+		 *
+		 * While the raster file caches are still being created in the background
+		 * the mipmap file is not yet available, but the number of levels it will have is
+		 * returned since the levels are then previewed directly from the source raster.
 		 */
 		virtual
 		unsigned int
@@ -158,12 +173,22 @@ namespace GPlatesPropertyValues
 		 *
 		 * Returns true if a mipmap file appropriate for @a colour_palette is
 		 * available after this function exits.
+		 *
+		 * Returns false, without generating a mipmap file, if the raster file caches
+		 * are still being created in the background. The "main" mipmap file is also created
+		 * in the background (a special mipmap file is generated when first needed after
+		 * the raster file caches are complete).
+		 *
+		 * If a mipmap file is generated then its progress is reported to @a progress_callback
+		 * (if specified).
 		 */
 		virtual
 		bool
 		ensure_mipmaps_available(
 				const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette =
-					GPlatesGui::RasterColourPalette::create()) = 0;
+					GPlatesGui::RasterColourPalette::create(),
+				const GPlatesFileIO::mipmap_progress_callback_type &progress_callback =
+					GPlatesFileIO::mipmap_progress_callback_type()) = 0;
 
 		/**
 		 * Retrieves a region from a level in the mipmapped raster file, in the data
@@ -402,6 +427,16 @@ namespace GPlatesPropertyValues
 					colour_region_if_necessary(*region_raster, region_coverage, colour_palette);
 			}
 
+			/**
+			 * Implementation of pure virtual function defined in base.
+			 */
+			virtual
+			bool
+			is_previewing_levels()
+			{
+				return !is_raster_file_cache_complete();
+			}
+
 			/**
 			 * Implementation of pure virtual function defined in base.
 			 */
@@ -416,6 +451,14 @@ namespace GPlatesPropertyValues
 				{
 					return mipmap_reader->get_number_of_levels() + 1;
 				}
+				else if (!is_raster_file_cache_complete())
+				{
+					// The levels are previewed directly from the source raster until the
+					// mipmap file is available.
+					return GPlatesFileIO::RasterFileCacheFormat::get_number_of_mipmapped_levels(
+							d_proxied_raw_raster->width(),
+							d_proxied_raw_raster->height()) + 1;
+				}
 				else
 				{
 					// Level 0 is read from the source raster, not the mipmap file.
@@ -435,19 +478,21 @@ namespace GPlatesPropertyValues
 			bool
 			ensure_mipmaps_available(
 					const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette =
-							GPlatesGui::RasterColourPalette::create())
+							GPlatesGui::RasterColourPalette::create(),
+					const GPlatesFileIO::mipmap_progress_callback_type &progress_callback =
+							GPlatesFileIO::mipmap_progress_callback_type())
 			{
 				// Create the main mipmap reader - this ensures the mipmap file exists and is
 				// ready for reading.
 				// Note: ignoring the colour palette.
-				return get_main_mipmap_reader();
+				return get_main_mipmap_reader(progress_callback);
 			}
 
 		private:
 
 			/**
-			 * Converts level 0 from the raster type stored in the source raster into the
-			 * raster type stored in the mipmapped raster file.
+			 * Converts level 0 (or a previewed level) from the raster type stored in the source raster
+			 * into the raster type stored in the mipmapped raster file.
 			 *
 			 * This conversion only happens if the source raster type differs from the
 			 * mipmapped raster type, and that is only the case for integer rasters. For
@@ -539,6 +584,24 @@ namespace GPlatesPropertyValues
 							region_width,
 							region_height);
 				}
+				else if (!is_raster_file_cache_complete())
+				{
+					// Preview the level directly from the source raster until the mipmap file is available.
+					boost::optional<typename source_raster_type::non_null_ptr_type> result =
+						get_decimated_region_from_source_as_source_type(
+								level,
+								region_x_offset,
+								region_y_offset,
+								region_width,
+								region_height);
+					if (!result)
+					{
+						return boost::none;
+					}
+
+					return ConvertLevel0IfNecessary<
+						source_raster_type, mipmapped_raster_type>::convert_level_0_if_necessary(*result);
+				}
 				else
 				{
 					return boost::none;
@@ -723,6 +786,48 @@ namespace GPlatesPropertyValues
 				return source_region_raster.get();
 			}
 
+			/**
+			 * Retrieves a region from a level (other than level 0) quickly, and directly, from the
+			 * source raster, in the data type of the source raster.
+			 *
+			 * Unlike the mipmapped raster file, the region is not filtered (it is sampled from
+			 * overviews in the source raster, if any, or decimated from the full-resolution data).
+			 * It is used to preview the raster until the mipmapped raster file is available.
+			 *
+			 * Returns boost::none if an error was encountered reading from disk.
+			 */
+			boost::optional<typename source_raster_type::non_null_ptr_type>
+			get_decimated_region_from_source_as_source_type(
+					unsigned int level,
+					unsigned int region_x_offset,
+					unsigned int region_y_offset,
+					unsigned int region_width,
+					unsigned int region_height)
+			{
+				GPlatesFileIO::RasterBandReaderHandle &raster_band_reader_handle =
+					get_raster_band_reader_handle(*d_proxied_raw_raster);
+
+				// Check that the raster band can offer us the correct data type.
+				typedef typename ProxiedRawRasterType::element_type element_type;
+				if (raster_band_reader_handle.get_type() != RasterType::get_type_as_enum<element_type>())
+				{
+					return boost::none;
+				}
+
+				// Get the decimated region data from the source raster.
+				const QRect level_region_rect(region_x_offset, region_y_offset, region_width, region_height);
+				boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type> level_region_raw_raster =
+						raster_band_reader_handle.get_decimated_raw_raster(level, level_region_rect);
+				if (!level_region_raw_raster)
+				{
+					return boost::none;
+				}
+
+				// Downcast the level region raster to the source raster type.
+				return GPlatesPropertyValues::RawRasterUtils::try_raster_cast<
+						source_raster_type>(*level_region_raw_raster.get());
+			}
+
 			/**
 			 * Implementation of pure virtual function defined in base.
 			 *
@@ -760,6 +865,20 @@ namespace GPlatesPropertyValues
 			~BaseProxiedRasterResolver()
 			{  }
 
+			/**
+			 * Returns false if the source raster file cache, or the "main" mipmap file cache,
+			 * is still being created in the background.
+			 *
+			 * Until they are complete, mipmap files are not generated on this thread (they are
+			 * generated from the source raster file cache in the background) and levels other than
+			 * level 0 are instead previewed directly from the source raster.
+			 */
+			bool
+			is_raster_file_cache_complete()
+			{
+				return get_raster_band_reader_handle(*d_proxied_raw_raster).is_raster_file_cache_complete();
+			}
+
 			typename ProxiedRawRasterType::non_null_ptr_type d_proxied_raw_raster;
 
 		private:
@@ -772,10 +891,13 @@ namespace GPlatesPropertyValues
 			 * floating-point rasters, and integer rasters with floating-point colour
 			 * palettes.
 			 *
-			 * Returns NULL if the reader could not be opened for some reason.
+			 * Returns NULL if the reader could not be opened for some reason, or if the
+			 * raster file caches are still being created.
 			 */
 			GPlatesFileIO::MipmappedRasterFormatReader<mipmapped_raster_type> *
-			get_main_mipmap_reader()
+			get_main_mipmap_reader(
+					const GPlatesFileIO::mipmap_progress_callback_type &progress_callback =
+							GPlatesFileIO::mipmap_progress_callback_type())
 			{
 				// There's only one main mipmap file for all but integer rasters with integer colour
 				// palettes and they are handled in a derived class.
@@ -784,7 +906,12 @@ namespace GPlatesPropertyValues
 					// If we fail once to get a mipmap reader then we don't need to try again.
 					// This is because frequent partial mipmap builds will slow down GPlates.
 					// The client code should notify the user of failure.
-					if (!d_error_getting_mipmap_reader)
+					//
+					// And we wait for the raster file caches to be created (in the background) before
+					// opening the mipmap file (in the meantime the levels are previewed). The mipmap file
+					// is only generated here if it failed to be created in the background.
+					if (!d_error_getting_mipmap_reader &&
+						is_raster_file_cache_complete())
 					{
 						d_main_mipmap_reader =
 								GPlatesFileIO::RasterFileCache::create_mipmapped_raster_file_cache_format_reader<
@@ -792,7 +919,9 @@ namespace GPlatesPropertyValues
 										mipmapped_raster_type,
 										GPlatesFileIO::MipmappedRasterFormatWriter<ProxiedRawRasterType> >(
 												d_proxied_raw_raster,
-												get_raster_band_reader_handle(*d_proxied_raw_raster));
+												get_raster_band_reader_handle(*d_proxied_raw_raster),
+												GPlatesGui::RasterColourPalette::create(),
+												progress_callback);
 
 						// If there was an error then don't try again next time.
 						if (!d_main_mipmap_reader)
@@ -926,7 +1055,23 @@ namespace GPlatesPropertyValues
 				get_coloured_mipmap_reader(colour_palette);
 			if (!mipmap_reader)
 			{
-				return boost::none;
+				if (this->is_raster_file_cache_complete())
+				{
+					return boost::none;
+				}
+
+				// Preview the level directly from the source raster (and colour it) until
+				// the mipmap file is available.
+				boost::optional<typename source_raster_type::non_null_ptr_type> region_raster =
+					base_type::get_decimated_region_from_source_as_source_type(
+							level, region_x_offset, region_y_offset, region_width, region_height);
+				if (!region_raster)
+				{
+					return boost::none;
+				}
+
+				return GPlatesGui::ColourRawRaster::colour_raw_raster_with_raster_colour_palette(
+						**region_raster, colour_palette);
 			}
 
 			return mipmap_reader->read_level(
@@ -941,7 +1086,9 @@ namespace GPlatesPropertyValues
 		bool
 		ensure_mipmaps_available(
 				const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette =
-					GPlatesGui::RasterColourPalette::create())
+					GPlatesGui::RasterColourPalette::create(),
+				const GPlatesFileIO::mipmap_progress_callback_type &progress_callback =
+					GPlatesFileIO::mipmap_progress_callback_type())
 		{
 			GPlatesGui::RasterColourPaletteType::Type colour_palette_type =
 				GPlatesGui::RasterColourPaletteType::get_type(*colour_palette);
@@ -949,13 +1096,13 @@ namespace GPlatesPropertyValues
 					colour_palette_type == GPlatesGui::RasterColourPaletteType::INVALID)
 			{
 				// Note: Ignoring colour palette.
-				return base_type::ensure_mipmaps_available();
+				return base_type::ensure_mipmaps_available(colour_palette, progress_callback);
 			}
 			else
 			{
 				// Create the coloured mipmap reader for the specified colour palette - this ensures
 				// the mipmap file exists and is ready for reading.
-				return get_coloured_mipmap_reader(colour_palette);
+				return get_coloured_mipmap_reader(colour_palette, progress_callback);
 			}
 		}
 
@@ -974,11 +1121,14 @@ namespace GPlatesPropertyValues
 		 * Coloured mipmap files are used for integer rasters with integer colour
 		 * palettes.
 		 *
-		 * Returns NULL if the reader could not be opened for some reason.
+		 * Returns NULL if the reader could not be opened for some reason, or if the
+		 * raster file caches are still being created.
 		 */
 		GPlatesFileIO::MipmappedRasterFormatReader<Rgba8RawRaster> *
 		get_coloured_mipmap_reader(
-				const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette)
+				const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette,
+				const GPlatesFileIO::mipmap_progress_callback_type &progress_callback =
+						GPlatesFileIO::mipmap_progress_callback_type())
 		{
 			const boost::optional<std::size_t> colour_palette_id =
 					GPlatesFileIO::RasterFileCacheFormat::get_colour_palette_id(colour_palette);
@@ -999,7 +1149,11 @@ namespace GPlatesPropertyValues
 				// again until something changes - in this case the colour palette.
 				// This is because frequent partial mipmap builds will slow down GPlates.
 				// The client code should notify the user of failure.
-				if (!d_error_getting_mipmap_reader_for_current_colour_palette)
+				//
+				// And we wait for the raster file caches to be created (in the background)
+				// before generating the mipmap file (in the meantime the levels are previewed).
+				if (!d_error_getting_mipmap_reader_for_current_colour_palette &&
+					this->is_raster_file_cache_complete())
 				{
 					d_coloured_mipmap_reader =
 							GPlatesFileIO::RasterFileCache::create_mipmapped_raster_file_cache_format_reader<
@@ -1009,7 +1163,8 @@ namespace GPlatesPropertyValues
 									GPlatesFileIO::MipmappedRasterFormatWriter<ProxiedRawRasterType, true> >(
 											d_proxied_raw_raster,
 											this->get_raster_band_reader_handle(*d_proxied_raw_raster),
-											colour_palette);
+											colour_palette,
+											progress_callback);
 
 					// If there was an error then don't try again next time
 					// (unless there's a different colour palette)...
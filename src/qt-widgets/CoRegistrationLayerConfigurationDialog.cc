@@ -45,6 +45,7 @@
 
 #include "data-mining/PopulateShapeFileAttributesVisitor.h"
 #include "data-mining/CoRegConfigurationTable.h"
+#include "data-mining/CpuRasterCoRegistration.h"
 #include "data-mining/RegionOfInterestFilter.h"
 #include "data-mining/SeedSelfFilter.h"
 
@@ -745,7 +746,7 @@ GPlatesQtWidgets::CoRegistrationLayerConfigurationDialog::react_add_configuratio
 		setup_reducer_combobox(
 				attr_item->text(),
 				combo,
-				target_layer_type);
+				target_layer);
 		
 		// Layer Name column
 		LayerTableItem* layer_name_item = 
@@ -818,15 +819,15 @@ void
 GPlatesQtWidgets::CoRegistrationLayerConfigurationDialog::setup_reducer_combobox(
 		const QString& attribute_name,	
 		QComboBox* combo,
-		const GPlatesAppLogic::LayerTaskType::Type target_layer_type)
+		const GPlatesAppLogic::Layer &target_layer)
 {
 	if (relational_radio_button->isChecked()) 
 	{
-		setup_reducer_relational_combobox(attribute_name, combo, target_layer_type);
+		setup_reducer_relational_combobox(attribute_name, combo, target_layer.get_type());
 	}
 	else
 	{
-		setup_reducer_non_relational_combobox(attribute_name, combo, target_layer_type);
+		setup_reducer_non_relational_combobox(attribute_name, combo, target_layer);
 	}
 }
 
@@ -857,6 +858,9 @@ GPlatesQtWidgets::CoRegistrationLayerConfigurationDialog::setup_reducer_relation
 		combo->addItem(
 				QApplication::tr("Median"),
 				GPlatesDataMining::REDUCER_MEDIAN);
+		combo->addItem(
+				QApplication::tr("Median (approximate)"),
+				GPlatesDataMining::REDUCER_APPROXIMATE_MEDIAN);
 		return;
 	}
 
@@ -874,12 +878,12 @@ void
 GPlatesQtWidgets::CoRegistrationLayerConfigurationDialog::setup_reducer_non_relational_combobox(
 		const QString& attribute_name,	
 		QComboBox* combo,
-		const GPlatesAppLogic::LayerTaskType::Type target_layer_type)
+		const GPlatesAppLogic::Layer &target_layer)
 {
 	// Rasters have a fixed set of reducer options that is independent of the attribute type.
 	// Mainly because rasters only contain numerical data and hence the attribute type is
 	// effectively always a number type (ie, not a string type).
-	if (target_layer_type == GPlatesAppLogic::LayerTaskType::RASTER)
+	if (target_layer.get_type() == GPlatesAppLogic::LayerTaskType::RASTER)
 	{
 		combo->addItem(
 				QApplication::tr("Min"),
@@ -894,6 +898,21 @@ GPlatesQtWidgets::CoRegistrationLayerConfigurationDialog::setup_reducer_non_rela
 				QApplication::tr("Std Dev"),
 				GPlatesDataMining::REDUCER_STANDARD_DEVIATION);
 
+		// The median is only co-registered on the CPU, which doesn't support reconstructed
+		// (or age-grid masked) rasters, so only offer it for rasters it supports.
+		// The raster band name is the attribute name.
+		boost::optional<GPlatesAppLogic::RasterLayerProxy::non_null_ptr_type> raster_layer_proxy =
+				target_layer.get_layer_output<GPlatesAppLogic::RasterLayerProxy>();
+		if (raster_layer_proxy &&
+			GPlatesDataMining::CpuRasterCoRegistration::is_supported(
+					*raster_layer_proxy.get(),
+					GPlatesPropertyValues::TextContent(GPlatesUtils::make_icu_string_from_qstring(attribute_name))))
+		{
+			combo->addItem(
+					QApplication::tr("Median"),
+					GPlatesDataMining::REDUCER_MEDIAN);
+		}
+
 		return;
 	}
 
@@ -909,6 +928,9 @@ GPlatesQtWidgets::CoRegistrationLayerConfigurationDialog::setup_reducer_non_rela
 	combo->addItem(
 			QApplication::tr("Vote"),
 			GPlatesDataMining::REDUCER_VOTE);
+	combo->addItem(
+			QApplication::tr("Vote (approximate)"),
+			GPlatesDataMining::REDUCER_APPROXIMATE_VOTE);
 
 	if(GPlatesDataMining::Number_Attribute == a_type || GPlatesDataMining::Unknown_Type == a_type)
 	{
@@ -924,6 +946,9 @@ GPlatesQtWidgets::CoRegistrationLayerConfigurationDialog::setup_reducer_non_rela
 		combo->addItem(
 				QApplication::tr("Median"),
 				GPlatesDataMining::REDUCER_MEDIAN);
+		combo->addItem(
+				QApplication::tr("Median (approximate)"),
+				GPlatesDataMining::REDUCER_APPROXIMATE_MEDIAN);
 	}
 }
 
@@ -1420,7 +1445,7 @@ GPlatesQtWidgets::CoRegistrationLayerConfigurationDialog::get_configuration_tabl
 			setup_reducer_non_relational_combobox(
 					config_row.attr_name,
 					reducer_combo,
-					target_layer_type);
+					target_layer);
 		}
 		// Select the combo box item associated with the current config row.
 		for (int r = 0; r < reducer_combo->count(); ++r)
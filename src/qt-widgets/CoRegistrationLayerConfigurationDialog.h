@@ -311,7 +311,7 @@ namespace GPlatesQtWidgets
 		setup_reducer_combobox(
 				const QString& attribute_name,	
 				QComboBox* combo,
-				const GPlatesAppLogic::LayerTaskType::Type target_layer_type);
+				const GPlatesAppLogic::Layer &target_layer);
 
 		void
 		setup_reducer_relational_combobox(
@@ -323,7 +323,7 @@ namespace GPlatesQtWidgets
 		setup_reducer_non_relational_combobox(
 				const QString& attribute_name,	
 				QComboBox* combo,
-				const GPlatesAppLogic::LayerTaskType::Type target_layer_type);
+				const GPlatesAppLogic::Layer &target_layer);
 
 		void
 		setup_association_type_combobox(
@@ -219,13 +219,7 @@ GPlatesQtWidgets::ResultTableModel::data(
 
 	if (role == Qt::DisplayRole) 
 	{
-		GPlatesDataMining::OpaqueData o_data;
-		d_table.at( idx.row() )->get_cell( idx.column(), o_data );
-
-		return 
-			boost::apply_visitor(
-					GPlatesDataMining::ConvertOpaqueDataToString(),
-					o_data);
+		return d_table.get_cell_as_string(idx.row(), idx.column());
 
 	} 
 	else if (role == Qt::TextAlignmentRole) 
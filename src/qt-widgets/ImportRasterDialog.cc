@@ -27,6 +27,8 @@
 #include <iterator>
 #include <boost/bind/bind.hpp>
 #include <boost/foreach.hpp>
+#include <boost/ref.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <QMessageBox>
 #include <QString>
 #include <QStringList>
@@ -35,6 +37,7 @@
 
 #include "ImportRasterDialog.h"
 
+#include "ProgressDialog.h"
 #include "RasterGeoreferencingPage.h"
 #include "RasterBandPage.h"
 #include "RasterFeatureCollectionPage.h"
@@ -81,6 +84,37 @@
 #include "utils/Parse.h"
 #include "utils/UnicodeStringUtils.h"
 
+namespace
+{
+	using namespace GPlatesQtWidgets;
+
+	/**
+	 * Shows the progress of mipmapping the imported raster.
+	 *
+	 * The progress dialog is only created (on first call) if the mipmaps need to be generated.
+	 */
+	void
+	report_mipmap_progress(
+			boost::scoped_ptr<ProgressDialog> &progress_dialog,
+			QWidget *parent_widget,
+			unsigned int num_regions_mipmapped,
+			unsigned int num_regions)
+	{
+		if (!progress_dialog)
+		{
+			progress_dialog.reset(new ProgressDialog(parent_widget));
+			// Mipmap generation cannot be cancelled.
+			progress_dialog->disable_cancel_button(true);
+			progress_dialog->setWindowModality(Qt::WindowModal);
+			progress_dialog->setRange(0, num_regions);
+			progress_dialog->show();
+		}
+
+		progress_dialog->update_progress(num_regions_mipmapped, QObject::tr("Building raster mipmaps..."));
+	}
+}
+
+
 const QString
 GPlatesQtWidgets::ImportRasterDialog::GPML_EXT = ".gpml";
 
@@ -375,8 +409,22 @@ GPlatesQtWidgets::ImportRasterDialog::display(
 		}
 
 		// Read the number of bands and their type in the raster file.
+		// This also generates the raster file caches (if necessary) so show any mipmapping progress.
+		boost::scoped_ptr<ProgressDialog> mipmap_progress_dialog;
 		GPlatesFileIO::RasterReader::non_null_ptr_type reader =
-			GPlatesFileIO::RasterReader::create(filename, read_errors);
+			GPlatesFileIO::RasterReader::create(
+					filename,
+					read_errors,
+					boost::bind(
+							&report_mipmap_progress,
+							boost::ref(mipmap_progress_dialog),
+							parentWidget(),
+							boost::placeholders::_1,
+							boost::placeholders::_2));
+		if (mipmap_progress_dialog)
+		{
+			mipmap_progress_dialog->close();
+		}
 		if (!reader->can_read())
 		{
 			QMessageBox::critical(parentWidget(), "Import Raster",
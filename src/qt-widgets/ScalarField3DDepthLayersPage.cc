@@ -843,8 +843,15 @@ GPlatesQtWidgets::ScalarField3DDepthLayersPage::add_files_to_sequence(
 		// (preventing its removal).
 		{
 			// Attempt to read the raster file.
+			//
+			// Create the caches now (instead of in the background) since the reader is destroyed
+			// at the end of this block.
 			GPlatesFileIO::RasterReader::non_null_ptr_type reader =
-				GPlatesFileIO::RasterReader::create(absolute_file_path);
+				GPlatesFileIO::RasterReader::create(
+						absolute_file_path,
+						NULL/*read_errors*/,
+						GPlatesFileIO::RasterReader::mipmap_progress_callback_type(),
+						true/*wait_for_file_caches*/);
 			if (!reader->can_read())
 			{
 				continue;
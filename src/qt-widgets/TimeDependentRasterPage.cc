@@ -29,6 +29,8 @@
 #include <boost/foreach.hpp>
 #include <boost/bind/bind.hpp>
 #include <boost/cast.hpp>
+#include <boost/function.hpp>
+#include <boost/ref.hpp>
 #include <boost/weak_ptr.hpp>
 #include <QDir>
 #include <QDoubleValidator>
@@ -326,6 +328,24 @@ namespace
 
 		boost::function<void ()> d_remove_rows_function;
 	};
+
+
+	/**
+	 * Shows the progress of mipmapping the current raster file in the progress dialog.
+	 */
+	void
+	report_mipmap_progress(
+			ProgressDialog *progress_dialog,
+			int file_index,
+			const QString &progress_dialog_text,
+			unsigned int num_regions_mipmapped,
+			unsigned int num_regions)
+	{
+		const int percent_mipmapped = (num_regions == 0) ? 100 : (100 * num_regions_mipmapped / num_regions);
+		progress_dialog->update_progress(
+				file_index,
+				QObject::tr("%1 (building mipmaps %2%)").arg(progress_dialog_text).arg(percent_mipmapped));
+	}
 }
 
 
@@ -840,7 +860,19 @@ GPlatesQtWidgets::TimeDependentRasterPage::add_files_to_sequence(
 		// Attempt to read the number of bands in the file.
 		QString absolute_file_path = file_info.absoluteFilePath();
 		GPlatesFileIO::RasterReader::non_null_ptr_type reader =
-			GPlatesFileIO::RasterReader::create(absolute_file_path);
+			GPlatesFileIO::RasterReader::create(
+					absolute_file_path,
+					NULL/*read_errors*/,
+					boost::bind(
+							&report_mipmap_progress,
+							progress_dialog,
+							file_index,
+							boost::cref(progress_dialog_text),
+							boost::placeholders::_1,
+							boost::placeholders::_2),
+					// Create the caches now (instead of in the background) since the reader is
+					// destroyed at the end of this iteration.
+					true/*wait_for_file_caches*/);
 		if (!reader->can_read())
 		{
 			continue;
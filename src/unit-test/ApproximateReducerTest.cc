@@ -0,0 +1,373 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <boost/optional.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/tuple/tuple.hpp>
+#include <QString>
+
+#include "unit-test/ApproximateReducerTest.h"
+
+#include "data-mining/ApproximateQuantileReducer.h"
+#include "data-mining/ApproximateVoteReducer.h"
+#include "data-mining/FrequentValueSummary.h"
+#include "data-mining/QuantileDigest.h"
+
+#include "model/FeatureHandle.h"
+
+
+namespace
+{
+	/**
+	 * Returns the difference between @a quantile and the (closest) rank of @a value in the sorted values.
+	 */
+	double
+	get_rank_error(
+			const std::vector<double> &sorted_values,
+			const double &value,
+			const double &quantile)
+	{
+		const double num_values = static_cast<double>(sorted_values.size());
+		const double min_rank =
+				(std::lower_bound(sorted_values.begin(), sorted_values.end(), value) - sorted_values.begin()) / num_values;
+		const double max_rank =
+				(std::upper_bound(sorted_values.begin(), sorted_values.end(), value) - sorted_values.begin()) / num_values;
+
+		if (quantile < min_rank)
+		{
+			return min_rank - quantile;
+		}
+		if (quantile > max_rank)
+		{
+			return quantile - max_rank;
+		}
+
+		return 0;
+	}
+
+
+	/**
+	 * Checks the quantiles of @a digest (of @a values) are within 1% of rank (and the minimum/maximum are exact).
+	 */
+	void
+	check_quantile_digest_error_bounds(
+			GPlatesDataMining::QuantileDigest &digest,
+			const std::vector<double> &values)
+	{
+		std::vector<double> sorted_values(values);
+		std::sort(sorted_values.begin(), sorted_values.end());
+
+		BOOST_CHECK_EQUAL(digest.get_quantile(0), sorted_values.front());
+		BOOST_CHECK_EQUAL(digest.get_quantile(1), sorted_values.back());
+
+		const double quantiles[] = { 0.01, 0.1, 0.5, 0.9, 0.99 };
+		for (unsigned int q = 0; q < sizeof(quantiles) / sizeof(quantiles[0]); ++q)
+		{
+			BOOST_CHECK_SMALL(
+					get_rank_error(sorted_values, digest.get_quantile(quantiles[q]), quantiles[q]),
+					0.01);
+		}
+	}
+
+
+	/**
+	 * Checks the quantiles of a digest of @a values are within 1% of rank.
+	 */
+	void
+	check_quantile_digest(
+			const std::vector<double> &values)
+	{
+		GPlatesDataMining::QuantileDigest digest;
+		for (std::size_t n = 0; n < values.size(); ++n)
+		{
+			digest.add(values[n]);
+		}
+
+		check_quantile_digest_error_bounds(digest, values);
+	}
+
+
+	/**
+	 * Checks the quantiles of digests of @a num_partitions disjoint (contiguous) partitions of @a values,
+	 * merged into one digest, are within the same 1% of rank as a single digest of @a values.
+	 */
+	void
+	check_merged_quantile_digest(
+			const std::vector<double> &values,
+			unsigned int num_partitions)
+	{
+		std::vector<GPlatesDataMining::QuantileDigest> partition_digests(num_partitions);
+		for (std::size_t n = 0; n < values.size(); ++n)
+		{
+			partition_digests[n * num_partitions / values.size()].add(values[n]);
+		}
+
+		GPlatesDataMining::QuantileDigest merged_digest;
+		for (unsigned int p = 0; p < num_partitions; ++p)
+		{
+			merged_digest.merge(partition_digests[p]);
+		}
+
+		check_quantile_digest_error_bounds(merged_digest, values);
+	}
+
+
+	/**
+	 * Generates @a num_values uniformly distributed values in [0, 1000] with a fixed seed (so tests are repeatable).
+	 */
+	void
+	generate_values(
+			std::vector<double> &values,
+			unsigned int num_values)
+	{
+		boost::mt19937 gen(0);
+		boost::uniform_real<> dist(0.0, 1000.0);
+		boost::variate_generator<boost::mt19937&, boost::uniform_real<> > rand(gen, dist);
+
+		values.reserve(num_values);
+		for (unsigned int n = 0; n < num_values; ++n)
+		{
+			values.push_back(rand());
+		}
+	}
+
+
+	void
+	add_reducer_input(
+			GPlatesDataMining::CoRegReducer::ReducerInDataset &input,
+			const GPlatesDataMining::OpaqueData &value)
+	{
+		input.push_back(
+				boost::make_tuple(
+						value,
+						// Not used...
+						GPlatesAppLogic::ReconstructContext::ReconstructedFeature(
+								GPlatesModel::FeatureHandle::weak_ref())));
+	}
+
+
+	/**
+	 * Reduces @a input in batches of @a batch_size.
+	 */
+	GPlatesDataMining::OpaqueData
+	reduce_in_batches(
+			GPlatesDataMining::CoRegReducer &reducer,
+			const GPlatesDataMining::CoRegReducer::ReducerInDataset &input,
+			std::size_t batch_size)
+	{
+		reducer.begin_batches();
+		for (std::size_t batch_begin = 0; batch_begin < input.size(); batch_begin += batch_size)
+		{
+			const std::size_t batch_end = (std::min)(batch_begin + batch_size, input.size());
+			reducer.process_batch(input.begin() + batch_begin, input.begin() + batch_end);
+		}
+
+		return reducer.end_batches();
+	}
+}
+
+
+GPlatesUnitTest::ApproximateReducerTestSuite::ApproximateReducerTestSuite(
+		unsigned level) :
+	GPlatesUnitTest::GPlatesTestSuite(
+			"ApproximateReducerTestSuite")
+{
+	init(level);
+}
+
+
+void
+GPlatesUnitTest::ApproximateReducerTestSuite::construct_maps()
+{
+	boost::shared_ptr<ApproximateReducerTest> instance(new ApproximateReducerTest());
+
+	ADD_TESTCASE(ApproximateReducerTest, test_quantile_digest_error_bounds);
+	ADD_TESTCASE(ApproximateReducerTest, test_frequent_value_summary);
+	ADD_TESTCASE(ApproximateReducerTest, test_merge);
+	ADD_TESTCASE(ApproximateReducerTest, test_batched_reduction);
+}
+
+
+void
+GPlatesUnitTest::ApproximateReducerTest::test_quantile_digest_error_bounds()
+{
+	std::vector<double> values;
+	generate_values(values, 100000);
+
+	// Random order.
+	check_quantile_digest(values);
+
+	// Sorted order.
+	std::sort(values.begin(), values.end());
+	check_quantile_digest(values);
+
+	// Skewed distribution (most values near the minimum), in random order.
+	values.clear();
+	generate_values(values, 100000);
+	for (std::size_t n = 0; n < values.size(); ++n)
+	{
+		values[n] = std::exp(values[n] / 100.0);
+	}
+	check_quantile_digest(values);
+
+	// A single value.
+	GPlatesDataMining::QuantileDigest single_value_digest;
+	single_value_digest.add(5.0);
+	BOOST_CHECK_EQUAL(single_value_digest.get_quantile(0.5), 5.0);
+}
+
+
+void
+GPlatesUnitTest::ApproximateReducerTest::test_frequent_value_summary()
+{
+	using GPlatesDataMining::FrequentValueSummary;
+
+	// No values.
+	FrequentValueSummary empty_summary;
+	BOOST_CHECK(empty_summary.empty());
+	BOOST_CHECK(!empty_summary.get_most_frequent_value());
+
+	// Fewer distinct values than counters is exact (and ties choose the lexicographically smallest value).
+	FrequentValueSummary exact_summary;
+	const char *const exact_values[] = { "b", "c", "a", "b", "a", "c", "b", "a" };
+	for (unsigned int n = 0; n < sizeof(exact_values) / sizeof(exact_values[0]); ++n)
+	{
+		exact_summary.add(QString(exact_values[n]));
+	}
+	BOOST_CHECK(exact_summary.get_most_frequent_value() == QString("a"));
+	exact_summary.add(QString("c"));
+	exact_summary.add(QString("c"));
+	BOOST_CHECK(exact_summary.get_most_frequent_value() == QString("c"));
+
+	// A value occurring 30% of the time amongst many distinct values (far more than the number of counters).
+	FrequentValueSummary heavy_hitter_summary(16);
+	for (unsigned int n = 0; n < 100000; ++n)
+	{
+		heavy_hitter_summary.add(
+				(n % 10) < 3
+				? QString("heavy")
+				: QString::number(n));
+	}
+	BOOST_CHECK(heavy_hitter_summary.get_most_frequent_value() == QString("heavy"));
+}
+
+
+void
+GPlatesUnitTest::ApproximateReducerTest::test_merge()
+{
+	using GPlatesDataMining::FrequentValueSummary;
+	using GPlatesDataMining::QuantileDigest;
+
+	std::vector<double> values;
+	generate_values(values, 100000);
+
+	// Partitions of random order values (each partition covers the full range of values).
+	check_merged_quantile_digest(values, 2);
+	check_merged_quantile_digest(values, 8);
+
+	// Partitions of sorted values (each partition covers a separate range of values).
+	std::sort(values.begin(), values.end());
+	check_merged_quantile_digest(values, 8);
+	check_merged_quantile_digest(values, 100);
+
+	// Merging empty digests.
+	QuantileDigest empty_digest;
+	QuantileDigest single_value_digest;
+	single_value_digest.add(5.0);
+	single_value_digest.merge(empty_digest);
+	BOOST_CHECK_EQUAL(single_value_digest.get_quantile(0.5), 5.0);
+	empty_digest.merge(single_value_digest);
+	BOOST_CHECK_EQUAL(empty_digest.get_quantile(0.5), 5.0);
+
+	// Merged vote summaries of disjoint partitions give the same result as a single summary, with fewer
+	// distinct values than counters (exact) and with far more distinct values than counters (heavy hitter).
+	for (unsigned int num_distinct_values = 10; num_distinct_values <= 100000; num_distinct_values *= 100)
+	{
+		FrequentValueSummary single_summary(16);
+		std::vector<FrequentValueSummary> partition_summaries(4, FrequentValueSummary(16));
+		for (unsigned int n = 0; n < 100000; ++n)
+		{
+			// Value "3" occurs 30% of the time, and the remaining values are spread over the rest.
+			const QString value = (n % 10) < 3
+					? QString("3")
+					: QString::number((n * 7919) % num_distinct_values);
+
+			single_summary.add(value);
+			partition_summaries[n * partition_summaries.size() / 100000].add(value);
+		}
+
+		FrequentValueSummary merged_summary(16);
+		for (std::size_t p = 0; p < partition_summaries.size(); ++p)
+		{
+			merged_summary.merge(partition_summaries[p]);
+		}
+
+		BOOST_CHECK(single_summary.get_most_frequent_value() == QString("3"));
+		BOOST_CHECK(merged_summary.get_most_frequent_value() == single_summary.get_most_frequent_value());
+	}
+
+	// Merging an empty summary.
+	FrequentValueSummary empty_summary;
+	FrequentValueSummary single_value_summary;
+	single_value_summary.add(QString("a"));
+	empty_summary.merge(single_value_summary);
+	BOOST_CHECK(empty_summary.get_most_frequent_value() == QString("a"));
+	single_value_summary.merge(FrequentValueSummary());
+	BOOST_CHECK(single_value_summary.get_most_frequent_value() == QString("a"));
+}
+
+
+void
+GPlatesUnitTest::ApproximateReducerTest::test_batched_reduction()
+{
+	using namespace GPlatesDataMining;
+
+	std::vector<double> values;
+	generate_values(values, 10000);
+
+	CoRegReducer::ReducerInDataset numerical_input;
+	CoRegReducer::ReducerInDataset string_input;
+	for (std::size_t n = 0; n < values.size(); ++n)
+	{
+		add_reducer_input(numerical_input, OpaqueData(values[n]));
+		add_reducer_input(string_input, OpaqueData(QString::number(static_cast<int>(values[n] / 100.0))));
+	}
+
+	ApproximateQuantileReducer median_reducer(0.5);
+	const OpaqueData median = median_reducer.process(numerical_input.begin(), numerical_input.end());
+	BOOST_CHECK(boost::get<double>(&median));
+	BOOST_CHECK(reduce_in_batches(median_reducer, numerical_input, 1000) == median);
+	BOOST_CHECK(reduce_in_batches(median_reducer, numerical_input, 1) == median);
+
+	ApproximateVoteReducer vote_reducer;
+	const OpaqueData vote = vote_reducer.process(string_input.begin(), string_input.end());
+	BOOST_CHECK(boost::get<QString>(&vote));
+	BOOST_CHECK(reduce_in_batches(vote_reducer, string_input, 1000) == vote);
+
+	// No input.
+	const CoRegReducer::ReducerInDataset empty_input;
+	BOOST_CHECK(boost::apply_visitor(is_empty_visitor(), reduce_in_batches(median_reducer, empty_input, 1000)));
+	BOOST_CHECK(boost::apply_visitor(is_empty_visitor(), reduce_in_batches(vote_reducer, empty_input, 1000)));
+}
@@ -0,0 +1,78 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_UNIT_TEST_APPROXIMATEREDUCER_TEST_H
+#define GPLATES_UNIT_TEST_APPROXIMATEREDUCER_TEST_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "unit-test/GPlatesTestSuite.h"
+
+
+namespace GPlatesUnitTest
+{
+	class ApproximateReducerTest
+	{
+	public:
+
+		ApproximateReducerTest()
+		{
+		}
+
+		/**
+		 * Tests the rank error of @a QuantileDigest quantiles (and exact minimum/maximum).
+		 */
+		void
+		test_quantile_digest_error_bounds();
+
+		/**
+		 * Tests @a FrequentValueSummary finds the most frequent value (exactly, or when it's a heavy hitter).
+		 */
+		void
+		test_frequent_value_summary();
+
+		/**
+		 * Tests merging digests (and vote summaries) of disjoint partitions is as accurate as a single one.
+		 */
+		void
+		test_merge();
+
+		/**
+		 * Tests reducing in batches gives the same result as reducing all input at once.
+		 */
+		void
+		test_batched_reduction();
+	};
+
+
+	class ApproximateReducerTestSuite :
+			public GPlatesUnitTest::GPlatesTestSuite
+	{
+	public:
+
+		ApproximateReducerTestSuite(
+				unsigned depth);
+
+	protected:
+
+		void
+		construct_maps();
+	};
+}
+#endif //GPLATES_UNIT_TEST_APPROXIMATEREDUCER_TEST_H
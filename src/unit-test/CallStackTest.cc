@@ -0,0 +1,144 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <boost/bind/bind.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/ref.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "unit-test/CallStackTest.h"
+
+#include "global/PreconditionViolationError.h"
+
+#include "utils/CallStackTracker.h"
+
+
+namespace
+{
+	const unsigned int NUM_THREADS = 4;
+
+	const unsigned int NUM_EXCEPTIONS_PER_THREAD = 10000;
+
+	const char *const TEST_FILENAME = "CallStackTest";
+
+
+	/**
+	 * Throws and catches exceptions (each of which tracks its location on the call stack while
+	 * it is constructed) and counts the exceptions that did not see only this thread's call stack.
+	 */
+	void
+	throw_exceptions(
+			unsigned int thread_index,
+			unsigned int &num_bad_exceptions)
+	{
+		// Track a location unique to this thread.
+		GPlatesUtils::CallStackTracker call_stack_tracker(
+				GPlatesUtils::CallStack::Trace(TEST_FILENAME, thread_index));
+
+		const GPlatesUtils::CallStack::Trace exception_source(TEST_FILENAME, NUM_THREADS + thread_index);
+
+		std::string expected_call_stack_trace = "Call stack trace:\n";
+		for (unsigned int n = 0; n < 2; ++n)
+		{
+			expected_call_stack_trace += std::string("(") + TEST_FILENAME + ", " +
+					boost::lexical_cast<std::string>(n * NUM_THREADS + thread_index) + ")\n";
+		}
+
+		num_bad_exceptions = 0;
+		for (unsigned int n = 0; n < NUM_EXCEPTIONS_PER_THREAD; ++n)
+		{
+			try
+			{
+				throw GPlatesGlobal::PreconditionViolationError(exception_source);
+			}
+			catch (const GPlatesGlobal::Exception &exception)
+			{
+				std::string call_stack_trace;
+				exception.get_call_stack_trace_string(call_stack_trace);
+				if (call_stack_trace != expected_call_stack_trace)
+				{
+					++num_bad_exceptions;
+				}
+			}
+		}
+
+		// The exception location was popped off this thread's call stack.
+		const GPlatesUtils::CallStack::trace_const_iterator call_stack_begin =
+				GPlatesUtils::CallStack::instance().call_stack_begin();
+		if (GPlatesUtils::CallStack::instance().call_stack_end() - call_stack_begin != 1 ||
+			call_stack_begin->get_line_num() != static_cast<int>(thread_index))
+		{
+			++num_bad_exceptions;
+		}
+	}
+}
+
+
+GPlatesUnitTest::CallStackTestSuite::CallStackTestSuite(
+		unsigned level) :
+	GPlatesUnitTest::GPlatesTestSuite(
+			"CallStackTestSuite")
+{
+	init(level);
+}
+
+
+void
+GPlatesUnitTest::CallStackTestSuite::construct_maps()
+{
+	boost::shared_ptr<CallStackTest> instance(new CallStackTest());
+
+	ADD_TESTCASE(CallStackTest, concurrent_exception_test);
+}
+
+
+void
+GPlatesUnitTest::CallStackTest::concurrent_exception_test()
+{
+	const std::ptrdiff_t call_stack_size =
+			GPlatesUtils::CallStack::instance().call_stack_end() -
+				GPlatesUtils::CallStack::instance().call_stack_begin();
+
+	std::vector<unsigned int> num_bad_exceptions(NUM_THREADS);
+
+	boost::thread_group threads;
+	for (unsigned int thread_index = 0; thread_index < NUM_THREADS; ++thread_index)
+	{
+		threads.create_thread(
+				boost::bind(
+						&throw_exceptions,
+						thread_index,
+						boost::ref(num_bad_exceptions[thread_index])));
+	}
+	threads.join_all();
+
+	for (unsigned int thread_index = 0; thread_index < NUM_THREADS; ++thread_index)
+	{
+		BOOST_CHECK_EQUAL(num_bad_exceptions[thread_index], 0U);
+	}
+
+	// Other threads did not change this thread's call stack.
+	BOOST_CHECK_EQUAL(
+			GPlatesUtils::CallStack::instance().call_stack_end() -
+				GPlatesUtils::CallStack::instance().call_stack_begin(),
+			call_stack_size);
+}
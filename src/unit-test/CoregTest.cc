@@ -22,9 +22,16 @@
  * with this program; if not, write to Free Software Foundation, Inc.,
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
+#include <cmath>
 #include <iostream>
 #include <sstream>
+#include <QApplication>
 #include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QGLPixelBuffer>
+#include <QTemporaryDir>
+#include <QTextStream>
 
 // The BOOST_FOREACH macro in versions of boost before 1.37 uses the same local
 // variable name in each instantiation. Nested BOOST_FOREACH macros therefore
@@ -36,7 +43,10 @@ DISABLE_GCC_WARNING("-Wshadow")
 
 #include "app-logic/CoRegistrationData.h"
 #include "app-logic/ReconstructionTreeCreator.h"
+#include "app-logic/ReconstructMethodRegistry.h"
+#include "app-logic/ReconstructUtils.h"
 
+#include "data-mining/CpuRasterCoRegistration.h"
 #include "data-mining/DataSelector.h"
 #include "data-mining/DataMiningUtils.h"
 #include "data-mining/OpaqueDataToQString.h"
@@ -44,10 +54,32 @@ DISABLE_GCC_WARNING("-Wshadow")
 
 #include "file-io/ReadErrorAccumulation.h"
 #include "file-io/FeatureCollectionFileFormatRegistry.h"
+#include "file-io/RasterReader.h"
 
 #include "global/NotYetImplementedException.h"
 
+#include "maths/LatLonPoint.h"
+#include "maths/MathsUtils.h"
+#include "maths/PointOnSphere.h"
+#include "maths/PolygonOnSphere.h"
+
+#include "model/FeatureCollectionHandle.h"
+#include "model/FeatureHandle.h"
+#include "model/FeatureType.h"
 #include "model/ModelInterface.h"
+#include "model/PropertyName.h"
+#include "model/TopLevelPropertyInline.h"
+
+#include "opengl/GLContext.h"
+#include "opengl/GLDataRasterSource.h"
+#include "opengl/GLMultiResolutionRaster.h"
+#include "opengl/GLOffScreenContext.h"
+#include "opengl/GLRasterCoRegistration.h"
+#include "opengl/GLRenderer.h"
+
+#include "property-values/CoordinateTransformation.h"
+#include "property-values/GmlPoint.h"
+#include "property-values/GmlPolygon.h"
 
 
 //./gplates-unit-test --detect_memory_leaks=0 --G_test_to_run=*/Coreg
@@ -58,6 +90,95 @@ const QString cfg_file = "coreg_input_table.txt";
 using namespace GPlatesAppLogic;
 using namespace GPlatesDataMining;
 
+namespace
+{
+	/**
+	 * Writes a global one-degree ESRI ASCII grid whose pixel values are the latitude plus the
+	 * longitude (in degrees) of the pixel centre, with no data south of 60S.
+	 */
+	bool
+	write_test_raster(
+			const QString &filename)
+	{
+		QFile file(filename);
+		if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+		{
+			return false;
+		}
+
+		QTextStream stream(&file);
+		stream << "ncols 360\nnrows 180\nxllcorner -180\nyllcorner -90\ncellsize 1\nNODATA_value -9999\n";
+		for (int row = 0; row < 180; ++row)
+		{
+			const double latitude = 89.5 - row;
+			for (int column = 0; column < 360; ++column)
+			{
+				const double longitude = -179.5 + column;
+				if (latitude < -60)
+				{
+					stream << "-9999 ";
+				}
+				else
+				{
+					// Use a decimal point so the raster is read as floating-point.
+					stream << QString::number(latitude + longitude, 'f', 1) << ' ';
+				}
+			}
+			stream << '\n';
+		}
+
+		return stream.status() == QTextStream::Ok;
+	}
+
+
+	void
+	add_seed_feature(
+			const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+			const GPlatesModel::PropertyValue::non_null_ptr_type &geometry)
+	{
+		const GPlatesModel::FeatureHandle::weak_ref feature =
+				GPlatesModel::FeatureHandle::create(
+						feature_collection,
+						GPlatesModel::FeatureType::create_gpml("UnclassifiedFeature"));
+		feature->add(
+				GPlatesModel::TopLevelPropertyInline::create(
+						GPlatesModel::PropertyName::create_gpml("unclassifiedGeometry"),
+						geometry));
+	}
+
+
+	GPlatesModel::PropertyValue::non_null_ptr_type
+	create_polygon(
+			const double &min_latitude,
+			const double &max_latitude,
+			const double &min_longitude,
+			const double &max_longitude)
+	{
+		std::vector<GPlatesMaths::PointOnSphere> points;
+		points.push_back(GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(min_latitude, min_longitude)));
+		points.push_back(GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(min_latitude, max_longitude)));
+		points.push_back(GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(max_latitude, max_longitude)));
+		points.push_back(GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(max_latitude, min_longitude)));
+
+		return GPlatesPropertyValues::GmlPolygon::create(GPlatesMaths::PolygonOnSphere::create(points));
+	}
+
+
+	bool
+	are_results_close(
+			const boost::optional<double> &cpu_result,
+			const boost::optional<double> &gl_result,
+			const double &tolerance)
+	{
+		if (!cpu_result || !gl_result)
+		{
+			return !cpu_result && !gl_result;
+		}
+
+		return std::fabs(cpu_result.get() - gl_result.get()) <= tolerance;
+	}
+}
+
 GPlatesUnitTest::CoregTestSuite::CoregTestSuite(
 		unsigned level) :
 	GPlatesUnitTest::GPlatesTestSuite(
@@ -444,6 +565,189 @@ GPlatesUnitTest::CoregTest::test_case_7()
 	return;
 }
 
+void
+GPlatesUnitTest::CoregTest::test_cpu_raster_co_registration()
+{
+	QTemporaryDir temp_dir;
+	const QString raster_filename = QDir(temp_dir.path()).filePath("coreg_test_raster.asc");
+	BOOST_REQUIRE(temp_dir.isValid() && write_test_raster(raster_filename));
+
+	// This also generates the raster's mipmap file cache (read by CPU co-registration).
+	GPlatesFileIO::RasterReader::non_null_ptr_type raster_reader =
+			GPlatesFileIO::RasterReader::create(raster_filename);
+	boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type> proxied_raster =
+			raster_reader->get_proxied_raw_raster(1);
+	boost::optional<GPlatesPropertyValues::Georeferencing::non_null_ptr_to_const_type> georeferencing =
+			raster_reader->get_georeferencing();
+	BOOST_REQUIRE(proxied_raster && georeferencing);
+
+	//
+	// Seed features (at present day with no rotations).
+	//
+
+	GPlatesModel::FeatureCollectionHandle::weak_ref seed_feature_collection =
+			GPlatesModel::FeatureCollectionHandle::create(d_model->root());
+	// A point at the centre of the pixel at 10.5N, 20.5E.
+	add_seed_feature(
+			seed_feature_collection,
+			GPlatesPropertyValues::GmlPoint::create(
+					GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(10.5, 20.5))));
+	// A point in the region of no data.
+	add_seed_feature(
+			seed_feature_collection,
+			GPlatesPropertyValues::GmlPoint::create(
+					GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(-70.5, 40.5))));
+	// A polygon straddling the dateline.
+	add_seed_feature(seed_feature_collection, create_polygon(-20, 20, 170, -170));
+
+	ReconstructMethodRegistry reconstruct_method_registry;
+	std::vector<ReconstructContext::ReconstructedFeature> reconstructed_seed_features;
+	ReconstructUtils::reconstruct(
+			reconstructed_seed_features,
+			0.0/*reconstruction_time*/,
+			reconstruct_method_registry,
+			std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref>(1, seed_feature_collection),
+			create_cached_reconstruction_tree_creator(
+					std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref>()));
+	BOOST_REQUIRE(reconstructed_seed_features.size() == 3);
+
+	//
+	// Co-register on the CPU.
+	//
+
+	const double region_of_interest_radius = GPlatesMaths::convert_deg_to_rad(2.0);
+	const CpuRasterCoRegistration::OperationType cpu_operation_types[] =
+	{
+		CpuRasterCoRegistration::OPERATION_MEAN,
+		CpuRasterCoRegistration::OPERATION_STANDARD_DEVIATION,
+		CpuRasterCoRegistration::OPERATION_MINIMUM,
+		CpuRasterCoRegistration::OPERATION_MAXIMUM
+	};
+	const unsigned int num_operations = sizeof(cpu_operation_types) / sizeof(cpu_operation_types[0]);
+
+	std::vector<CpuRasterCoRegistration::Operation> cpu_point_operations;
+	std::vector<CpuRasterCoRegistration::Operation> cpu_operations;
+	for (unsigned int n = 0; n < num_operations; ++n)
+	{
+		// Zero region-of-interest so a seed point covers only the pixel it's in.
+		cpu_point_operations.push_back(
+				CpuRasterCoRegistration::Operation(0.0, cpu_operation_types[n], true/*fill_polygons*/));
+		cpu_operations.push_back(
+				CpuRasterCoRegistration::Operation(region_of_interest_radius, cpu_operation_types[n], true/*fill_polygons*/));
+	}
+
+	BOOST_REQUIRE(CpuRasterCoRegistration::co_register(
+			cpu_point_operations,
+			reconstructed_seed_features,
+			proxied_raster.get(),
+			georeferencing.get(),
+			0/*raster_level_of_detail*/));
+	BOOST_REQUIRE(CpuRasterCoRegistration::co_register(
+			cpu_operations,
+			reconstructed_seed_features,
+			proxied_raster.get(),
+			georeferencing.get(),
+			0/*raster_level_of_detail*/));
+
+	// The seed point in a pixel centre only samples that pixel.
+	BOOST_CHECK(are_results_close(cpu_point_operations[0].get_co_registration_results()[0], 31.0, 1e-4));
+	BOOST_CHECK(are_results_close(cpu_point_operations[1].get_co_registration_results()[0], 0.0, 1e-4));
+	BOOST_CHECK(are_results_close(cpu_point_operations[2].get_co_registration_results()[0], 31.0, 1e-4));
+	BOOST_CHECK(are_results_close(cpu_point_operations[3].get_co_registration_results()[0], 31.0, 1e-4));
+
+	// The region-of-interest of the seed point is a small circle symmetric about the pixel centre.
+	BOOST_CHECK(are_results_close(cpu_operations[0].get_co_registration_results()[0], 31.0, 0.1));
+	BOOST_CHECK(are_results_close(cpu_operations[2].get_co_registration_results()[0], 29.0, 1e-4));
+	BOOST_CHECK(are_results_close(cpu_operations[3].get_co_registration_results()[0], 33.0, 1e-4));
+
+	for (unsigned int n = 0; n < num_operations; ++n)
+	{
+		// No raster data in the region-of-interest of the second seed point.
+		BOOST_CHECK(!cpu_operations[n].get_co_registration_results()[1]);
+		// The polygon is covered by the raster on both sides of the dateline.
+		BOOST_CHECK(cpu_operations[n].get_co_registration_results()[2]);
+	}
+
+	//
+	// Co-register with OpenGL (if available) and compare with the CPU results.
+	//
+
+	if (!qobject_cast<QApplication *>(QCoreApplication::instance()) ||
+		!QGLPixelBuffer::hasOpenGLPbuffers())
+	{
+		qWarning() << "GPlatesUnitTest::CoregTest: No off-screen OpenGL - skipping comparison with OpenGL co-registration.";
+		return;
+	}
+
+	GPlatesOpenGL::GLOffScreenContext::non_null_ptr_type off_screen_context =
+			GPlatesOpenGL::GLOffScreenContext::create(
+					GPlatesOpenGL::GLContext::get_qgl_format_to_create_context_with());
+	if (!off_screen_context->is_valid())
+	{
+		qWarning() << "GPlatesUnitTest::CoregTest: No off-screen OpenGL - skipping comparison with OpenGL co-registration.";
+		return;
+	}
+
+	GPlatesOpenGL::GLOffScreenContext::RenderScope render_scope(*off_screen_context, 256, 256);
+	GPlatesOpenGL::GLRenderer &renderer = *render_scope.get_renderer();
+
+	boost::optional<GPlatesOpenGL::GLRasterCoRegistration::non_null_ptr_type> gl_raster_co_registration =
+			GPlatesOpenGL::GLRasterCoRegistration::create(renderer);
+	boost::optional<GPlatesOpenGL::GLDataRasterSource::non_null_ptr_type> gl_data_raster_source =
+			GPlatesOpenGL::GLDataRasterSource::create(renderer, proxied_raster.get());
+	if (!gl_raster_co_registration ||
+		!gl_data_raster_source)
+	{
+		qWarning() << "GPlatesUnitTest::CoregTest: OpenGL raster co-registration not supported - skipping comparison.";
+		return;
+	}
+
+	const GPlatesOpenGL::GLMultiResolutionRaster::non_null_ptr_type gl_raster =
+			GPlatesOpenGL::GLMultiResolutionRaster::create(
+					renderer,
+					georeferencing.get(),
+					GPlatesPropertyValues::CoordinateTransformation::create(),
+					gl_data_raster_source.get(),
+					GPlatesOpenGL::GLMultiResolutionRaster::DEFAULT_FIXED_POINT_TEXTURE_FILTER,
+					GPlatesOpenGL::GLMultiResolutionRaster::CACHE_TILE_TEXTURES_ENTIRE_LEVEL_OF_DETAIL_PYRAMID);
+
+	const GPlatesOpenGL::GLRasterCoRegistration::OperationType gl_operation_types[num_operations] =
+	{
+		GPlatesOpenGL::GLRasterCoRegistration::OPERATION_MEAN,
+		GPlatesOpenGL::GLRasterCoRegistration::OPERATION_STANDARD_DEVIATION,
+		GPlatesOpenGL::GLRasterCoRegistration::OPERATION_MINIMUM,
+		GPlatesOpenGL::GLRasterCoRegistration::OPERATION_MAXIMUM
+	};
+	std::vector<GPlatesOpenGL::GLRasterCoRegistration::Operation> gl_operations;
+	for (unsigned int n = 0; n < num_operations; ++n)
+	{
+		gl_operations.push_back(
+				GPlatesOpenGL::GLRasterCoRegistration::Operation(
+						region_of_interest_radius, gl_operation_types[n], true/*fill_polygons*/));
+	}
+
+	gl_raster_co_registration.get()->co_register(
+			renderer,
+			gl_operations,
+			reconstructed_seed_features,
+			gl_raster,
+			0/*raster_level_of_detail*/);
+
+	// The two paths sample the raster differently (pixel centres versus rasterised region-of-interest)
+	// so allow for differences of about one pixel (where neighbouring pixels differ by one or two).
+	const double tolerance = 2.0;
+	for (unsigned int n = 0; n < num_operations; ++n)
+	{
+		for (unsigned int seed_feature_index = 0; seed_feature_index < reconstructed_seed_features.size(); ++seed_feature_index)
+		{
+			BOOST_CHECK(are_results_close(
+					cpu_operations[n].get_co_registration_results()[seed_feature_index],
+					gl_operations[n].get_co_registration_results()[seed_feature_index],
+					tolerance));
+		}
+	}
+}
+
 void
 GPlatesUnitTest::CoregTestSuite::construct_maps()
 {
@@ -463,5 +767,7 @@ GPlatesUnitTest::CoregTestSuite::construct_maps()
 	ADD_TESTCASE(CoregTest,test_case_6);
 	ADD_TESTCASE(CoregTest,test_case_7);
 #endif
+
+	ADD_TESTCASE(CoregTest,test_cpu_raster_co_registration);
 }
 
@@ -69,6 +69,13 @@ namespace GPlatesUnitTest
 		void 
 		test_case_7();
 
+		/*
+		* Compare CPU raster co-registration with known results and with OpenGL raster
+		* co-registration (if OpenGL is available).
+		*/
+		void
+		test_cpu_raster_co_registration();
+
 	private:
 		/*
 		* Load test data files.
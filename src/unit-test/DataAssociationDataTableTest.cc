@@ -54,55 +54,74 @@ GPlatesUnitTest::DataAssociationDataTableTest::test_data_table()
 
 	BOOST_TEST_MESSAGE( "DataAssociationDataTableTest::test_data_table." );
 
-	GPlatesDataMining::DataRowSharedPtr row(
-			new GPlatesDataMining::DataRow);
-
-	row->append_cell(
-			GPlatesDataMining::OpaqueData(7));
-	row->append_cell(
-			GPlatesDataMining::OpaqueData(QString("hello world!")));
-	row->append_cell(
-			GPlatesDataMining::OpaqueData(true));
-			
-	d_data_table->push_back(row);
-	d_data_table->push_back(row);
-	d_data_table->push_back(row);
-
-	GPlatesDataMining::DataRowSharedPtr ret_row = d_data_table->at(0);
+	d_data_table->resize(3, 4);
+
+	for (unsigned int row = 0; row < 3; ++row)
+	{
+		d_data_table->set_cell(
+				row, 0, GPlatesDataMining::OpaqueData(7));
+		d_data_table->set_cell(
+				row, 1, GPlatesDataMining::OpaqueData(QString("hello world!")));
+		d_data_table->set_cell(
+				row, 2, GPlatesDataMining::OpaqueData(true));
+	}
 
 	GPlatesDataMining::OpaqueData o_data;
 	QString con_str;
-	ret_row->get_cell(
+	d_data_table->get_cell(
 			0, 
+			0,
 			o_data);
 	int j = boost::get<int>(
 			o_data);
+	BOOST_CHECK(j == 7);
 	con_str = boost::apply_visitor(
 			GPlatesDataMining::ConvertOpaqueDataToString(),
 			o_data);
 	std::cout << "the int is: " << j << std::endl;
 
 
-	ret_row->get_cell(
+	d_data_table->get_cell(
+			0,
 			1,
 			o_data);
 	QString str_r = boost::get<QString>(
 			o_data);
+	BOOST_CHECK(str_r == "hello world!");
 	con_str = boost::apply_visitor(
 			GPlatesDataMining::ConvertOpaqueDataToString(),
 			o_data);
 	std::cout << "the string is: " << str_r.toStdString() << std::endl;
 
-	ret_row->get_cell(
+	d_data_table->get_cell(
+			0,
 			2,
 			o_data);
 	bool ret_b = boost::get<bool>(
 			o_data);
+	BOOST_CHECK(ret_b);
 	con_str = boost::apply_visitor(
 			GPlatesDataMining::ConvertOpaqueDataToString(),
 			o_data);
 	std::cout << "the bool is: " << ret_b << std::endl;
 
-	d_data_table->export_as_CSV(QString("export_as_CSV.csv"));
+	// Cells that are not set are empty.
+	d_data_table->get_cell(
+			1,
+			3,
+			o_data);
+	BOOST_CHECK(GPlatesDataMining::is_empty_opaque(o_data));
+
+	// Mixing numbers in a column converts the column to double.
+	d_data_table->set_cell(
+			0, 3, GPlatesDataMining::OpaqueData(2));
+	d_data_table->set_cell(
+			2, 3, GPlatesDataMining::OpaqueData(2.5));
+	d_data_table->get_cell(
+			0,
+			3,
+			o_data);
+	BOOST_CHECK(boost::get<double>(o_data) == 2.0);
 
+	d_data_table->export_as_CSV(QString("export_as_CSV.csv"));
 }
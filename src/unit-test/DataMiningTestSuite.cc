@@ -28,6 +28,7 @@
 
 #include "unit-test/AppLogicTestSuite.h"
 #include "unit-test/ApplicationStateTest.h"
+#include "unit-test/ApproximateReducerTest.h"
 #include "unit-test/TestSuiteFilter.h"
 #include "unit-test/DataMiningTestSuite.h"
 #include "unit-test/DataAssociationDataTableTest.h"
@@ -51,5 +52,6 @@ GPlatesUnitTest::DataMiningTestSuite::construct_maps()
 	ADD_TESTSUITE(DataAssociationDataTable);
 	ADD_TESTSUITE(MultiThread);
 	ADD_TESTSUITE(Filter);
+	ADD_TESTSUITE(ApproximateReducer);
 }
 
@@ -39,6 +39,8 @@
 
 #include <QDebug>
 
+#include <vector>
+#include <boost/intrusive_ptr.hpp>
 #include <boost/pool/singleton_pool.hpp>
 
 #include "unit-test/FeatureHandleTest.h"
@@ -46,11 +48,16 @@
 #include "maths/LatLonPoint.h"
 #include "maths/PointOnSphere.h"
 
+#include "model/FeatureCollectionHandle.h"
 #include "model/FeatureHandle.h"
 #include "model/ModelUtils.h"
+#include "model/NotificationGuard.h"
+#include "model/TopLevelPropertyInline.h"
+#include "model/WeakReferenceCallback.h"
 
 #include "property-values/GmlPoint.h"
 #include "property-values/GpmlKeyValueDictionary.h"
+#include "property-values/XsString.h"
 
 GPlatesUnitTest::FeatureHandleTestSuite::FeatureHandleTestSuite(
 		unsigned level) :
@@ -118,6 +125,125 @@ namespace
 	{}
 #endif
 
+
+	/**
+	 * Records the notifications sent by a feature collection or feature.
+	 */
+	template <class HandleType>
+	class NotificationRecorder :
+			public GPlatesModel::WeakReferenceCallback<HandleType>
+	{
+	public:
+
+		typedef GPlatesModel::WeakReferenceCallback<HandleType> base_type;
+		typedef typename base_type::weak_reference_type weak_reference_type;
+		typedef typename base_type::modified_event_type modified_event_type;
+		typedef typename base_type::deactivated_event_type deactivated_event_type;
+
+		NotificationRecorder() :
+			num_deactivated_events(0)
+		{  }
+
+		void
+		publisher_modified(
+				const weak_reference_type &,
+				const modified_event_type &event)
+		{
+			// Keep a copy of the event (its modified children must outlive this callback).
+			modified_events.push_back(event);
+		}
+
+		void
+		publisher_deactivated(
+				const weak_reference_type &,
+				const deactivated_event_type &)
+		{
+			++num_deactivated_events;
+		}
+
+		std::vector<modified_event_type> modified_events;
+		unsigned int num_deactivated_events;
+	};
+
+	typedef NotificationRecorder<GPlatesModel::FeatureCollectionHandle> feature_collection_recorder_type;
+	typedef NotificationRecorder<GPlatesModel::FeatureHandle> feature_recorder_type;
+
+
+	template <class HandleType>
+	boost::intrusive_ptr< NotificationRecorder<HandleType> >
+	attach_notification_recorder(
+			const GPlatesModel::WeakReference<HandleType> &weak_ref)
+	{
+		boost::intrusive_ptr< NotificationRecorder<HandleType> > recorder(new NotificationRecorder<HandleType>());
+		weak_ref.attach_callback(recorder.get());
+		return recorder;
+	}
+
+
+	/**
+	 * Creates a feature collection (in @a model) containing @a num_features features.
+	 */
+	GPlatesModel::FeatureCollectionHandle::weak_ref
+	create_feature_collection(
+			GPlatesModel::ModelInterface &model,
+			unsigned int num_features,
+			std::vector<GPlatesModel::FeatureHandle::weak_ref> &features)
+	{
+		const GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection =
+				GPlatesModel::FeatureCollectionHandle::create(model->root());
+
+		for (unsigned int n = 0; n < num_features; ++n)
+		{
+			features.push_back(
+					GPlatesModel::FeatureHandle::create(
+							feature_collection,
+							GPlatesModel::FeatureType::create_gpml("UnclassifiedFeature")));
+		}
+
+		return feature_collection;
+	}
+
+
+	/**
+	 * Modifies @a feature by adding a property.
+	 */
+	void
+	modify_feature(
+			const GPlatesModel::FeatureHandle::weak_ref &feature)
+	{
+		feature->add(
+				GPlatesModel::TopLevelPropertyInline::create(
+						GPlatesModel::PropertyName::create_gml("name"),
+						GPlatesPropertyValues::XsString::create(GPlatesUtils::UnicodeString("modified"))));
+	}
+
+
+	/**
+	 * Returns true if the modified children of @a event are exactly @a features (in collection order).
+	 */
+	bool
+	are_modified_children(
+			const feature_collection_recorder_type::modified_event_type &event,
+			const std::vector<GPlatesModel::FeatureHandle::weak_ref> &features)
+	{
+		const feature_collection_recorder_type::modified_event_type::modified_children_container_type &
+				modified_children = event.modified_children();
+		if (modified_children.size() != features.size())
+		{
+			return false;
+		}
+
+		for (unsigned int n = 0; n < features.size(); ++n)
+		{
+			if ((*modified_children[n])->feature_id() != features[n]->feature_id())
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 #if 0
 	void
 	print_memory_usage()
@@ -325,6 +451,137 @@ GPlatesUnitTest::FeatureHandleTest::test_case_7()
 	return;
 }
 
+void
+GPlatesUnitTest::FeatureHandleTest::test_coalesced_modified_children()
+{
+	typedef GPlatesModel::WeakReferencePublisherModifiedEvent<GPlatesModel::FeatureCollectionHandle> event_type;
+
+	std::vector<GPlatesModel::FeatureHandle::weak_ref> features;
+	const GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection =
+			create_feature_collection(d_model, 4, features);
+	const boost::intrusive_ptr<feature_collection_recorder_type> recorder =
+			attach_notification_recorder(feature_collection);
+
+	// Without a guard each modification is notified separately.
+	modify_feature(features[1]);
+	BOOST_CHECK_EQUAL(recorder->modified_events.size(), 1U);
+	BOOST_CHECK(recorder->modified_events.back().type() == event_type::CHILD_MODIFIED);
+	BOOST_CHECK(are_modified_children(recorder->modified_events.back(), std::vector<GPlatesModel::FeatureHandle::weak_ref>(1, features[1])));
+	recorder->modified_events.clear();
+
+	{
+		GPlatesModel::NotificationGuard guard(*d_model.access_model());
+
+		modify_feature(features[2]);
+		modify_feature(features[0]);
+		modify_feature(features[2]);
+
+		// Notifications are held while the guard is active.
+		BOOST_CHECK(recorder->modified_events.empty());
+	}
+
+	// One notification identifying each modified feature once (in collection order).
+	BOOST_CHECK_EQUAL(recorder->modified_events.size(), 1U);
+	if (!recorder->modified_events.empty())
+	{
+		BOOST_CHECK(recorder->modified_events.front().type() == event_type::CHILD_MODIFIED);
+
+		std::vector<GPlatesModel::FeatureHandle::weak_ref> expected_modified_features;
+		expected_modified_features.push_back(features[0]);
+		expected_modified_features.push_back(features[2]);
+		BOOST_CHECK(are_modified_children(recorder->modified_events.front(), expected_modified_features));
+	}
+}
+
+
+void
+GPlatesUnitTest::FeatureHandleTest::test_removed_modified_children()
+{
+	typedef GPlatesModel::WeakReferencePublisherModifiedEvent<GPlatesModel::FeatureCollectionHandle> event_type;
+
+	std::vector<GPlatesModel::FeatureHandle::weak_ref> features;
+	const GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection =
+			create_feature_collection(d_model, 3, features);
+	const boost::intrusive_ptr<feature_collection_recorder_type> recorder =
+			attach_notification_recorder(feature_collection);
+
+	// Keep the removed feature alive (so it's removed from the collection but not destroyed).
+	boost::optional<GPlatesModel::FeatureHandle::non_null_ptr_type> removed_feature;
+	{
+		GPlatesModel::NotificationGuard guard(*d_model.access_model());
+
+		modify_feature(features[0]);
+		modify_feature(features[1]);
+		removed_feature = features[1]->remove_from_parent();
+	}
+
+	BOOST_CHECK_EQUAL(recorder->modified_events.size(), 1U);
+	if (!recorder->modified_events.empty())
+	{
+		// Removing a feature modifies the collection itself.
+		BOOST_CHECK(recorder->modified_events.front().type() == event_type::PUBLISHER_AND_CHILD_MODIFIED);
+
+		// The removed feature is not reported as modified.
+		BOOST_CHECK(are_modified_children(
+				recorder->modified_events.front(),
+				std::vector<GPlatesModel::FeatureHandle::weak_ref>(1, features[0])));
+	}
+}
+
+
+void
+GPlatesUnitTest::FeatureHandleTest::test_flush_pending_notifications()
+{
+	std::vector<GPlatesModel::FeatureHandle::weak_ref> features;
+	const GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection =
+			create_feature_collection(d_model, 4, features);
+	const boost::intrusive_ptr<feature_collection_recorder_type> feature_collection_recorder =
+			attach_notification_recorder(feature_collection);
+	std::vector< boost::intrusive_ptr<feature_recorder_type> > feature_recorders;
+	for (unsigned int n = 0; n < features.size(); ++n)
+	{
+		feature_recorders.push_back(attach_notification_recorder(features[n]));
+	}
+
+	// Only deactivate a feature (its collection is not modified).
+	{
+		GPlatesModel::NotificationGuard guard(*d_model.access_model());
+
+		features[3]->set_active(false);
+		BOOST_CHECK_EQUAL(feature_recorders[3]->num_deactivated_events, 0U);
+	}
+
+	BOOST_CHECK_EQUAL(feature_recorders[3]->num_deactivated_events, 1U);
+	BOOST_CHECK(feature_collection_recorder->modified_events.empty());
+
+	// Modify one feature and deactivate another.
+	{
+		GPlatesModel::NotificationGuard guard(*d_model.access_model());
+
+		modify_feature(features[1]);
+		modify_feature(features[1]);
+		features[2]->set_active(false);
+	}
+
+	// Only the features holding notifications are notified (and only once each).
+	BOOST_CHECK(feature_recorders[0]->modified_events.empty());
+	BOOST_CHECK_EQUAL(feature_recorders[0]->num_deactivated_events, 0U);
+	BOOST_CHECK_EQUAL(feature_recorders[1]->modified_events.size(), 1U);
+	BOOST_CHECK_EQUAL(feature_recorders[1]->num_deactivated_events, 0U);
+	BOOST_CHECK(feature_recorders[2]->modified_events.empty());
+	BOOST_CHECK_EQUAL(feature_recorders[2]->num_deactivated_events, 1U);
+	BOOST_CHECK(feature_recorders[3]->modified_events.empty());
+	BOOST_CHECK_EQUAL(feature_recorders[3]->num_deactivated_events, 1U);
+
+	BOOST_CHECK_EQUAL(feature_collection_recorder->modified_events.size(), 1U);
+	if (!feature_collection_recorder->modified_events.empty())
+	{
+		BOOST_CHECK(are_modified_children(
+				feature_collection_recorder->modified_events.front(),
+				std::vector<GPlatesModel::FeatureHandle::weak_ref>(1, features[1])));
+	}
+}
+
 void
 GPlatesUnitTest::FeatureHandleTestSuite::construct_maps()
 {
@@ -338,5 +595,8 @@ GPlatesUnitTest::FeatureHandleTestSuite::construct_maps()
 	ADD_TESTCASE(FeatureHandleTest,test_case_5);
 	ADD_TESTCASE(FeatureHandleTest,test_case_6);
 	ADD_TESTCASE(FeatureHandleTest,test_case_7);
+	ADD_TESTCASE(FeatureHandleTest,test_coalesced_modified_children);
+	ADD_TESTCASE(FeatureHandleTest,test_removed_modified_children);
+	ADD_TESTCASE(FeatureHandleTest,test_flush_pending_notifications);
 }
 
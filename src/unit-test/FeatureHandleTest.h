@@ -60,6 +60,25 @@ namespace GPlatesUnitTest{
 		void 
 		test_case_7();
 
+		/**
+		 * Tests that modifications made while a NotificationGuard is active are coalesced into
+		 * one notification identifying all modified children.
+		 */
+		void
+		test_coalesced_modified_children();
+
+		/**
+		 * Tests that children removed while a NotificationGuard is active are not reported as modified.
+		 */
+		void
+		test_removed_modified_children();
+
+		/**
+		 * Tests that lifting a NotificationGuard flushes exactly those children holding notifications.
+		 */
+		void
+		test_flush_pending_notifications();
+
 	private:
 		GPlatesModel::ModelInterface d_model;
 		
@@ -27,6 +27,8 @@
 #include <QDebug>
 
 #include "unit-test/FileIoTestSuite.h"
+#include "unit-test/GpmlBinaryTest.h"
+#include "unit-test/LineTokenizerTest.h"
 #include "unit-test/TestSuiteFilter.h"
 
 GPlatesUnitTest::FileIoTestSuite::FileIoTestSuite(
@@ -40,6 +42,7 @@ GPlatesUnitTest::FileIoTestSuite::FileIoTestSuite(
 void 
 GPlatesUnitTest::FileIoTestSuite::construct_maps()
 {
-	//ADD YOUR TEST SUITE HERE
+	ADD_TESTSUITE(GpmlBinary);
+	ADD_TESTSUITE(LineTokenizer);
 }
 
@@ -0,0 +1,286 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <iterator>
+#include <vector>
+#include <QDir>
+#include <QFile>
+#include <QString>
+
+#include "unit-test/GpmlBinaryTest.h"
+
+#include "app-logic/AppLogicUtils.h"
+
+#include "file-io/File.h"
+#include "file-io/FileInfo.h"
+#include "file-io/GpmlBinaryFeatureIndex.h"
+#include "file-io/GpmlBinaryReader.h"
+#include "file-io/GpmlBinaryWriter.h"
+#include "file-io/GpmlPropertyStructuralTypeReader.h"
+#include "file-io/ReadErrorAccumulation.h"
+
+#include "maths/LatLonPoint.h"
+#include "maths/PointOnSphere.h"
+#include "maths/PolylineOnSphere.h"
+
+#include "model/FeatureCollectionHandle.h"
+#include "model/FeatureHandle.h"
+#include "model/FeatureType.h"
+#include "model/ModelUtils.h"
+#include "model/PropertyName.h"
+#include "model/TopLevelPropertyInline.h"
+
+#include "property-values/GeoTimeInstant.h"
+#include "property-values/GmlLineString.h"
+#include "property-values/GmlPoint.h"
+#include "property-values/GpmlConstantValue.h"
+#include "property-values/GpmlKeyValueDictionary.h"
+#include "property-values/GpmlKeyValueDictionaryElement.h"
+#include "property-values/GpmlPlateId.h"
+#include "property-values/StructuralType.h"
+#include "property-values/XsInteger.h"
+#include "property-values/XsString.h"
+
+
+namespace
+{
+	void
+	add_name(
+			const GPlatesModel::FeatureHandle::non_null_ptr_type &feature,
+			const QString &name)
+	{
+		feature->add(
+				GPlatesModel::TopLevelPropertyInline::create(
+						GPlatesModel::PropertyName::create_gml("name"),
+						GPlatesPropertyValues::XsString::create(GPlatesUtils::UnicodeString(name))));
+	}
+
+	void
+	add_reconstruction_plate_id(
+			const GPlatesModel::FeatureHandle::non_null_ptr_type &feature,
+			GPlatesModel::integer_plate_id_type plate_id)
+	{
+		feature->add(
+				GPlatesModel::TopLevelPropertyInline::create(
+						GPlatesModel::PropertyName::create_gpml("reconstructionPlateId"),
+						GPlatesPropertyValues::GpmlConstantValue::create(
+								GPlatesPropertyValues::GpmlPlateId::create(plate_id),
+								GPlatesPropertyValues::StructuralType::create_gpml("plateId"))));
+	}
+
+	/**
+	 * A feature whose property values all have a native binary encoding.
+	 */
+	GPlatesModel::FeatureHandle::non_null_ptr_type
+	create_native_feature(
+			const QString &name,
+			GPlatesModel::integer_plate_id_type plate_id)
+	{
+		const GPlatesModel::FeatureHandle::non_null_ptr_type feature =
+				GPlatesModel::FeatureHandle::create(GPlatesModel::FeatureType::create_gpml("Isochron"));
+
+		add_name(feature, name);
+		add_reconstruction_plate_id(feature, plate_id);
+
+		feature->add(
+				GPlatesModel::TopLevelPropertyInline::create(
+						GPlatesModel::PropertyName::create_gml("validTime"),
+						GPlatesModel::ModelUtils::create_gml_time_period(
+								GPlatesPropertyValues::GeoTimeInstant(100.0),
+								GPlatesPropertyValues::GeoTimeInstant::create_distant_future())));
+
+		std::vector<GPlatesMaths::PointOnSphere> points;
+		points.push_back(GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(10, 20)));
+		points.push_back(GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(-15, 45)));
+		points.push_back(GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(30, 60)));
+		feature->add(
+				GPlatesModel::TopLevelPropertyInline::create(
+						GPlatesModel::PropertyName::create_gpml("center"),
+						GPlatesPropertyValues::GpmlConstantValue::create(
+								GPlatesPropertyValues::GmlLineString::create(
+										GPlatesMaths::PolylineOnSphere::create(points)),
+								GPlatesPropertyValues::StructuralType::create_gml("LineString"))));
+
+		return feature;
+	}
+
+	/**
+	 * A feature containing a property value with no native binary encoding (so it's written as GPML).
+	 */
+	GPlatesModel::FeatureHandle::non_null_ptr_type
+	create_gpml_feature(
+			const QString &name,
+			GPlatesModel::integer_plate_id_type plate_id)
+	{
+		const GPlatesModel::FeatureHandle::non_null_ptr_type feature =
+				GPlatesModel::FeatureHandle::create(GPlatesModel::FeatureType::create_gpml("UnclassifiedFeature"));
+
+		add_name(feature, name);
+		add_reconstruction_plate_id(feature, plate_id);
+
+		GPlatesPropertyValues::GpmlKeyValueDictionary::non_null_ptr_type dictionary =
+				GPlatesPropertyValues::GpmlKeyValueDictionary::create();
+		dictionary->elements().push_back(
+				GPlatesPropertyValues::GpmlKeyValueDictionaryElement(
+						GPlatesPropertyValues::XsString::create(GPlatesUtils::UnicodeString("PLATEID1")),
+						GPlatesPropertyValues::XsInteger::create(plate_id),
+						GPlatesPropertyValues::StructuralType::create_xsi("integer")));
+		feature->add(
+				GPlatesModel::TopLevelPropertyInline::create(
+						GPlatesModel::PropertyName::create_gpml("shapefileAttributes"),
+						dictionary));
+
+		feature->add(
+				GPlatesModel::TopLevelPropertyInline::create(
+						GPlatesModel::PropertyName::create_gpml("position"),
+						GPlatesPropertyValues::GpmlConstantValue::create(
+								GPlatesPropertyValues::GmlPoint::create(
+										GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(-40, 170))),
+								GPlatesPropertyValues::StructuralType::create_gml("Point"))));
+
+		return feature;
+	}
+
+	void
+	check_features_equal(
+			const GPlatesModel::FeatureHandle &written_feature,
+			const GPlatesModel::FeatureHandle &read_feature)
+	{
+		BOOST_CHECK(written_feature.feature_type() == read_feature.feature_type());
+		BOOST_CHECK(written_feature.feature_id() == read_feature.feature_id());
+		BOOST_CHECK(written_feature.revision_id() == read_feature.revision_id());
+
+		BOOST_REQUIRE_EQUAL(
+				std::distance(written_feature.begin(), written_feature.end()),
+				std::distance(read_feature.begin(), read_feature.end()));
+
+		GPlatesModel::FeatureHandle::const_iterator written_properties_iter = written_feature.begin();
+		GPlatesModel::FeatureHandle::const_iterator read_properties_iter = read_feature.begin();
+		for ( ;
+			written_properties_iter != written_feature.end();
+			++written_properties_iter, ++read_properties_iter)
+		{
+			BOOST_CHECK((*written_properties_iter)->property_name() ==
+					(*read_properties_iter)->property_name());
+			BOOST_CHECK(**written_properties_iter == **read_properties_iter);
+		}
+	}
+}
+
+
+GPlatesUnitTest::GpmlBinaryTestSuite::GpmlBinaryTestSuite(
+		unsigned level) :
+	GPlatesUnitTest::GPlatesTestSuite(
+			"GpmlBinaryTestSuite")
+{
+	init(level);
+}
+
+
+void
+GPlatesUnitTest::GpmlBinaryTestSuite::construct_maps()
+{
+	boost::shared_ptr<GpmlBinaryTest> instance(new GpmlBinaryTest());
+
+	ADD_TESTCASE(GpmlBinaryTest, round_trip_test);
+	ADD_TESTCASE(GpmlBinaryTest, lazy_round_trip_test);
+}
+
+
+void
+GPlatesUnitTest::GpmlBinaryTest::round_trip_test()
+{
+	test_round_trip(false/*lazy_loading*/);
+}
+
+
+void
+GPlatesUnitTest::GpmlBinaryTest::lazy_round_trip_test()
+{
+	test_round_trip(true/*lazy_loading*/);
+}
+
+
+void
+GPlatesUnitTest::GpmlBinaryTest::test_round_trip(
+		bool lazy_loading)
+{
+	const QString filename = QDir::temp().filePath("gplates_gpml_binary_test.gpmlb");
+
+	{
+		// Interleave natively encoded features and GPML features (in the same block) to check that
+		// the features are read back in their original order.
+		const GPlatesModel::FeatureCollectionHandle::non_null_ptr_type written_feature_collection =
+				GPlatesModel::FeatureCollectionHandle::create();
+		written_feature_collection->add(create_native_feature("native 1", 801));
+		written_feature_collection->add(create_gpml_feature("gpml 1", 802));
+		written_feature_collection->add(create_gpml_feature("gpml 2", 803));
+		written_feature_collection->add(create_native_feature("native 2", 804));
+		written_feature_collection->add(create_gpml_feature("gpml 3", 805));
+
+		{
+			// The last block is written when the writer is destroyed.
+			GPlatesFileIO::GpmlBinaryWriter writer(
+					GPlatesFileIO::FileInfo(filename),
+					written_feature_collection->reference());
+			GPlatesAppLogic::AppLogicUtils::visit_feature_collection(
+					written_feature_collection->reference(),
+					writer);
+		}
+
+		GPlatesFileIO::File::non_null_ptr_type file =
+				GPlatesFileIO::File::create_file(GPlatesFileIO::FileInfo(filename));
+		GPlatesFileIO::ReadErrorAccumulation read_errors;
+		bool contains_unsaved_changes = false;
+		GPlatesFileIO::GpmlBinaryReader::read_file(
+				file->get_reference(),
+				GPlatesFileIO::GpmlPropertyStructuralTypeReader::create(),
+				read_errors,
+				contains_unsaved_changes,
+				lazy_loading);
+
+		BOOST_CHECK(read_errors.is_empty());
+
+		const GPlatesModel::FeatureCollectionHandle::weak_ref read_feature_collection =
+				file->get_reference().get_feature_collection();
+
+		BOOST_REQUIRE_EQUAL(
+				std::distance(written_feature_collection->begin(), written_feature_collection->end()),
+				std::distance(read_feature_collection->begin(), read_feature_collection->end()));
+
+		// The first feature is natively encoded so, when loaded lazily, it has a feature index entry
+		// until its property values are decoded (after which they could be modified in-place).
+		const GPlatesModel::FeatureHandle &first_read_feature = **read_feature_collection->begin();
+		BOOST_CHECK(static_cast<bool>(GPlatesFileIO::GpmlBinaryFeatureIndex::get_entry(first_read_feature)) == lazy_loading);
+
+		GPlatesModel::FeatureCollectionHandle::iterator written_features_iter = written_feature_collection->begin();
+		GPlatesModel::FeatureCollectionHandle::iterator read_features_iter = read_feature_collection->begin();
+		for ( ;
+			written_features_iter != written_feature_collection->end();
+			++written_features_iter, ++read_features_iter)
+		{
+			check_features_equal(**written_features_iter, **read_features_iter);
+		}
+
+		BOOST_CHECK(!GPlatesFileIO::GpmlBinaryFeatureIndex::get_entry(first_read_feature));
+	}
+
+	// The file is no longer mapped now that its features have been destroyed.
+	QFile::remove(filename);
+}
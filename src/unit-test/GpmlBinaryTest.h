@@ -0,0 +1,72 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_UNIT_TEST_GPMLBINARY_TEST_H
+#define GPLATES_UNIT_TEST_GPMLBINARY_TEST_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "unit-test/GPlatesTestSuite.h"
+
+
+namespace GPlatesUnitTest
+{
+	class GpmlBinaryTest
+	{
+	public:
+
+		GpmlBinaryTest()
+		{
+		}
+
+		/**
+		 * Writes features to a binary GPML file, reads them back and compares them.
+		 */
+		void
+		round_trip_test();
+
+		/**
+		 * Same as @a round_trip_test but property values are decoded on first access.
+		 */
+		void
+		lazy_round_trip_test();
+
+	private:
+
+		void
+		test_round_trip(
+				bool lazy_loading);
+	};
+
+
+	class GpmlBinaryTestSuite :
+			public GPlatesUnitTest::GPlatesTestSuite
+	{
+	public:
+
+		GpmlBinaryTestSuite(
+				unsigned depth);
+
+	protected:
+
+		void
+		construct_maps();
+	};
+}
+#endif //GPLATES_UNIT_TEST_GPMLBINARY_TEST_H
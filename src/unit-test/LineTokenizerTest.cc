@@ -0,0 +1,379 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <limits>
+#include <string>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <QByteArray>
+
+#include "unit-test/LineTokenizerTest.h"
+
+#include "file-io/LineReader.h"
+#include "file-io/LineTokenizer.h"
+
+
+namespace
+{
+	const unsigned int NUM_ROUND_TRIP_VALUES = 100000;
+
+
+	GPlatesFileIO::LineReader::Line
+	get_line(
+			const QByteArray &bytes)
+	{
+		GPlatesFileIO::LineReader::Line line;
+		line.begin = bytes.constData();
+		line.end = bytes.constData() + bytes.size();
+
+		return line;
+	}
+
+
+	std::string
+	get_remainder(
+			GPlatesFileIO::LineTokenizer &line_tokenizer)
+	{
+		const GPlatesFileIO::LineReader::Line remainder = line_tokenizer.remainder();
+		return std::string(remainder.begin, remainder.end);
+	}
+
+
+	/**
+	 * Checks @a token is read as a double equal to @a expected_value, leaving @a expected_remainder.
+	 */
+	void
+	check_read_double(
+			const char *token,
+			const double &expected_value,
+			const char *expected_remainder = "")
+	{
+		const QByteArray bytes(token);
+		GPlatesFileIO::LineTokenizer line_tokenizer(get_line(bytes));
+
+		double value;
+		BOOST_REQUIRE_MESSAGE(line_tokenizer.read(value), "Unable to read double from \"" << token << "\"");
+		BOOST_CHECK_MESSAGE(
+				value == expected_value,
+				"Read " << value << " from \"" << token << "\" instead of " << expected_value);
+		BOOST_CHECK_EQUAL(get_remainder(line_tokenizer), std::string(expected_remainder));
+	}
+
+
+	/**
+	 * Checks no double can be read from @a token (and that nothing was consumed).
+	 */
+	void
+	check_read_double_fails(
+			const char *token)
+	{
+		const QByteArray bytes(token);
+		GPlatesFileIO::LineTokenizer line_tokenizer(get_line(bytes));
+
+		double value;
+		BOOST_CHECK_MESSAGE(!line_tokenizer.read(value), "Read double from \"" << token << "\"");
+		BOOST_CHECK_EQUAL(get_remainder(line_tokenizer), std::string(bytes.trimmed().constData()));
+	}
+
+
+	/**
+	 * Checks @a token is read as the same double as QByteArray::toDouble (and is consumed entirely).
+	 */
+	void
+	check_read_double_matches_qbytearray(
+			const QByteArray &token)
+	{
+		bool ok;
+		const double expected_value = token.toDouble(&ok);
+		BOOST_REQUIRE(ok);
+
+		GPlatesFileIO::LineTokenizer line_tokenizer(get_line(token));
+
+		double value;
+		BOOST_REQUIRE_MESSAGE(line_tokenizer.read(value), "Unable to read double from \"" << token.constData() << "\"");
+		BOOST_CHECK_MESSAGE(
+				value == expected_value,
+				"Read " << value << " from \"" << token.constData() << "\" instead of " << expected_value);
+		BOOST_CHECK(get_remainder(line_tokenizer).empty());
+	}
+
+
+	/**
+	 * Checks @a token is read as @a expected_value of integer type @a IntegerType.
+	 */
+	template <typename IntegerType>
+	void
+	check_read_integer(
+			const char *token,
+			IntegerType expected_value,
+			const char *expected_remainder = "")
+	{
+		const QByteArray bytes(token);
+		GPlatesFileIO::LineTokenizer line_tokenizer(get_line(bytes));
+
+		IntegerType value;
+		BOOST_REQUIRE_MESSAGE(line_tokenizer.read(value), "Unable to read integer from \"" << token << "\"");
+		BOOST_CHECK_EQUAL(value, expected_value);
+		BOOST_CHECK_EQUAL(get_remainder(line_tokenizer), std::string(expected_remainder));
+	}
+
+
+	/**
+	 * Checks no integer of type @a IntegerType can be read from @a token (and that nothing was consumed).
+	 */
+	template <typename IntegerType>
+	void
+	check_read_integer_fails(
+			const char *token)
+	{
+		const QByteArray bytes(token);
+		GPlatesFileIO::LineTokenizer line_tokenizer(get_line(bytes));
+
+		IntegerType value;
+		BOOST_CHECK_MESSAGE(!line_tokenizer.read(value), "Read integer from \"" << token << "\"");
+		BOOST_CHECK_EQUAL(get_remainder(line_tokenizer), std::string(bytes.trimmed().constData()));
+	}
+}
+
+
+GPlatesUnitTest::LineTokenizerTestSuite::LineTokenizerTestSuite(
+		unsigned level) :
+	GPlatesUnitTest::GPlatesTestSuite(
+			"LineTokenizerTestSuite")
+{
+	init(level);
+}
+
+
+void
+GPlatesUnitTest::LineTokenizerTestSuite::construct_maps()
+{
+	boost::shared_ptr<LineTokenizerTest> instance(new LineTokenizerTest());
+
+	ADD_TESTCASE(LineTokenizerTest, test_read_double);
+	ADD_TESTCASE(LineTokenizerTest, test_read_double_round_trip);
+	ADD_TESTCASE(LineTokenizerTest, test_read_integer);
+	ADD_TESTCASE(LineTokenizerTest, test_remainder);
+}
+
+
+void
+GPlatesUnitTest::LineTokenizerTest::test_read_double()
+{
+	check_read_double("1.5", 1.5);
+	check_read_double("  \t-2.25  ", -2.25);
+	check_read_double("+3", 3.0);
+	check_read_double("-0", 0.0);
+
+	// Optional integral or fractional digits.
+	check_read_double(".5", 0.5);
+	check_read_double("-.5", -0.5);
+	check_read_double("5.", 5.0);
+	check_read_double("5.abc", 5.0, "abc");
+
+	// Exponents.
+	check_read_double("2.5E-3", 2.5e-3);
+	check_read_double("1e+2", 100.0);
+	check_read_double("1e22", 1e22);
+	check_read_double("1e-22", 1e-22);
+	check_read_double("1e300", 1e300);
+
+	// An exponent without digits is not part of the number.
+	check_read_double("1e", 1.0, "e");
+	check_read_double("1e+", 1.0, "e+");
+	check_read_double("1E-x", 1.0, "E-x");
+
+	// The number ends at the first character that cannot continue it.
+	check_read_double("1.5.5", 1.5, ".5");
+	check_read_double("-7,8", -7.0, ",8");
+
+	// More significant digits than fit in the 64-bit mantissa (these use the fallback conversion).
+	check_read_double_matches_qbytearray("12345678901234567890123");
+	check_read_double_matches_qbytearray("1234567890.1234567890123");
+	check_read_double_matches_qbytearray("0.00000000000000000000001234567890123456789");
+	check_read_double_matches_qbytearray("-9007199254740993");
+	check_read_double_matches_qbytearray("9007199254740993e-5");
+	check_read_double_matches_qbytearray("17976931348623157e292");
+
+	// Leading zeros are not significant digits.
+	check_read_double("0000000000000000000000001.5", 1.5);
+
+	// Infinity and NaN (case insensitive).
+	check_read_double("inf", std::numeric_limits<double>::infinity());
+	check_read_double("+INF", std::numeric_limits<double>::infinity());
+	check_read_double("-Inf 1", -std::numeric_limits<double>::infinity(), "1");
+	{
+		const QByteArray bytes("NaN -nan");
+		GPlatesFileIO::LineTokenizer line_tokenizer(get_line(bytes));
+
+		double value;
+		BOOST_REQUIRE(line_tokenizer.read(value));
+		BOOST_CHECK(value != value);
+		BOOST_REQUIRE(line_tokenizer.read(value));
+		BOOST_CHECK(value != value);
+		BOOST_CHECK(get_remainder(line_tokenizer).empty());
+	}
+
+	// Not numbers.
+	check_read_double_fails("");
+	check_read_double_fails("   ");
+	check_read_double_fails(".");
+	check_read_double_fails("-.");
+	check_read_double_fails("+");
+	check_read_double_fails("-");
+	check_read_double_fails("e5");
+	check_read_double_fails("in");
+	check_read_double_fails("abc");
+}
+
+
+void
+GPlatesUnitTest::LineTokenizerTest::test_read_double_round_trip()
+{
+	// Fixed seed so the test is repeatable.
+	boost::mt19937 gen(0);
+	boost::uniform_int<> dist(0, 1000000);
+	boost::variate_generator<boost::mt19937&, boost::uniform_int<> > rand(gen, dist);
+
+	for (unsigned int n = 0; n < NUM_ROUND_TRIP_VALUES; ++n)
+	{
+		QByteArray token;
+
+		const int sign = rand() % 3;
+		if (sign == 1)
+		{
+			token += '-';
+		}
+		else if (sign == 2)
+		{
+			token += '+';
+		}
+
+		// Up to 25 digits (so some exceed the 19 significant digits of the fast path)
+		// with the decimal point anywhere (including first or last).
+		const int num_digits = 1 + rand() % 25;
+		const int decimal_point_position = rand() % (num_digits + 2);
+		for (int d = 0; d < num_digits; ++d)
+		{
+			if (d == decimal_point_position)
+			{
+				token += '.';
+			}
+			token += static_cast<char>('0' + rand() % 10);
+		}
+		if (decimal_point_position == num_digits)
+		{
+			token += '.';
+		}
+
+		if (rand() % 2)
+		{
+			token += (rand() % 2) ? 'e' : 'E';
+			const int exponent_sign = rand() % 3;
+			if (exponent_sign == 1)
+			{
+				token += '-';
+			}
+			else if (exponent_sign == 2)
+			{
+				token += '+';
+			}
+			token += QByteArray::number(rand() % 40);
+		}
+
+		check_read_double_matches_qbytearray(token);
+	}
+}
+
+
+void
+GPlatesUnitTest::LineTokenizerTest::test_read_integer()
+{
+	check_read_integer<int>("12", 12);
+	check_read_integer<int>("  -12  ", -12);
+	check_read_integer<int>("+12", 12);
+	check_read_integer<int>("-2147483648", std::numeric_limits<int>::min());
+	check_read_integer<unsigned int>("4294967295", std::numeric_limits<unsigned int>::max());
+	check_read_integer<unsigned long>("123456", 123456UL);
+
+	// Leading zeros do not make the integer octal (eg, plate ID "012" is plate 12).
+	check_read_integer<int>("012", 12);
+	check_read_integer<unsigned int>("012", 12U);
+	check_read_integer<unsigned long>("012", 12UL);
+	check_read_integer<unsigned long>("0x12", 0UL, "x12");
+
+	// The integer ends at the first non-digit.
+	check_read_integer<int>("12.5", 12, ".5");
+	check_read_integer<unsigned int>("7abc", 7U, "abc");
+	check_read_integer<int>("1e5", 1, "e5");
+
+	// Not integers.
+	check_read_integer_fails<int>("");
+	check_read_integer_fails<int>("  ");
+	check_read_integer_fails<int>("-");
+	check_read_integer_fails<int>("+ 1");
+	check_read_integer_fails<unsigned int>(".5");
+	check_read_integer_fails<unsigned long>("abc");
+}
+
+
+void
+GPlatesUnitTest::LineTokenizerTest::test_remainder()
+{
+	// A PLATES rotation line: the remainder is the comment.
+	const QByteArray bytes(" 801  12.0  -10.5  20.25  3.5  000 !Comment  with  spaces ");
+	GPlatesFileIO::LineTokenizer line_tokenizer(get_line(bytes));
+
+	unsigned long plate_id;
+	double time;
+	double latitude;
+	double longitude;
+	double angle;
+	unsigned long fixed_plate_id;
+	BOOST_REQUIRE(line_tokenizer.read(plate_id));
+	BOOST_REQUIRE(line_tokenizer.read(time));
+	BOOST_REQUIRE(line_tokenizer.read(latitude));
+	BOOST_REQUIRE(line_tokenizer.read(longitude));
+	BOOST_REQUIRE(line_tokenizer.read(angle));
+	BOOST_REQUIRE(line_tokenizer.read(fixed_plate_id));
+	BOOST_CHECK_EQUAL(plate_id, 801UL);
+	BOOST_CHECK_EQUAL(time, 12.0);
+	BOOST_CHECK_EQUAL(latitude, -10.5);
+	BOOST_CHECK_EQUAL(longitude, 20.25);
+	BOOST_CHECK_EQUAL(angle, 3.5);
+	BOOST_CHECK_EQUAL(fixed_plate_id, 0UL);
+
+	// Leading whitespace is skipped but trailing whitespace is kept.
+	BOOST_CHECK_EQUAL(get_remainder(line_tokenizer), std::string("!Comment  with  spaces "));
+
+	// The remainder consumes the rest of the line.
+	BOOST_CHECK(get_remainder(line_tokenizer).empty());
+	double value;
+	BOOST_CHECK(!line_tokenizer.read(value));
+
+	// A failed read leaves the position unchanged.
+	const QByteArray mixed_bytes("5 x 6");
+	GPlatesFileIO::LineTokenizer mixed_line_tokenizer(get_line(mixed_bytes));
+	int integer;
+	BOOST_REQUIRE(mixed_line_tokenizer.read(integer));
+	BOOST_CHECK(!mixed_line_tokenizer.read(integer));
+	BOOST_CHECK(!mixed_line_tokenizer.read(value));
+	BOOST_CHECK_EQUAL(get_remainder(mixed_line_tokenizer), std::string("x 6"));
+}
@@ -0,0 +1,67 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_UNIT_TEST_LINETOKENIZER_TEST_H
+#define GPLATES_UNIT_TEST_LINETOKENIZER_TEST_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "unit-test/GPlatesTestSuite.h"
+
+
+namespace GPlatesUnitTest
+{
+	class LineTokenizerTest
+	{
+	public:
+
+		LineTokenizerTest()
+		{
+		}
+
+		void
+		test_read_double();
+
+		void
+		test_read_double_round_trip();
+
+		void
+		test_read_integer();
+
+		void
+		test_remainder();
+	};
+
+
+	class LineTokenizerTestSuite :
+			public GPlatesUnitTest::GPlatesTestSuite
+	{
+	public:
+
+		LineTokenizerTestSuite(
+				unsigned depth);
+
+	protected:
+
+		void
+		construct_maps();
+	};
+}
+
+#endif // GPLATES_UNIT_TEST_LINETOKENIZER_TEST_H
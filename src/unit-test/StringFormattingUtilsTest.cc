@@ -0,0 +1,199 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <boost/math/special_functions/next.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+
+#include "unit-test/StringFormattingUtilsTest.h"
+
+#include "utils/StringFormattingUtils.h"
+
+
+namespace
+{
+	const unsigned int NUM_RANDOM_VALUES_PER_PRECISION = 10000;
+
+
+	/**
+	 * Returns the result of 'append_formatted_double()' (appended to a non-empty string).
+	 */
+	std::string
+	append_formatted_double(
+			const double &val,
+			unsigned int width,
+			unsigned int prec)
+	{
+		std::string str = "prefix";
+		GPlatesUtils::append_formatted_double(str, val, width, prec);
+
+		BOOST_REQUIRE_EQUAL(str.substr(0, 6), std::string("prefix"));
+		return str.substr(6);
+	}
+
+
+	/**
+	 * Checks 'append_formatted_double()' matches 'formatted_double_to_string()' for @a val at
+	 * precision @a prec, both at the narrowest allowed width and at a wider width.
+	 */
+	void
+	check_append_formatted_double(
+			const double &val,
+			unsigned int prec)
+	{
+		const unsigned int widths[] = { prec + 3, prec + 10 };
+		for (unsigned int w = 0; w < sizeof(widths) / sizeof(widths[0]); ++w)
+		{
+			const std::string expected = GPlatesUtils::formatted_double_to_string(val, widths[w], prec);
+			const std::string appended = append_formatted_double(val, widths[w], prec);
+
+			BOOST_CHECK_MESSAGE(
+					appended == expected,
+					"append_formatted_double(" << val << ", " << widths[w] << ", " << prec <<
+						") gave \"" << appended << "\" instead of \"" << expected << "\"");
+		}
+	}
+
+
+	/**
+	 * Checks @a val and -@a val.
+	 */
+	void
+	check_append_formatted_double_both_signs(
+			const double &val,
+			unsigned int prec)
+	{
+		check_append_formatted_double(val, prec);
+		check_append_formatted_double(-val, prec);
+	}
+}
+
+
+GPlatesUnitTest::StringFormattingUtilsTestSuite::StringFormattingUtilsTestSuite(
+		unsigned level) :
+	GPlatesUnitTest::GPlatesTestSuite(
+			"StringFormattingUtilsTestSuite")
+{
+	init(level);
+}
+
+
+void
+GPlatesUnitTest::StringFormattingUtilsTestSuite::construct_maps()
+{
+	boost::shared_ptr<StringFormattingUtilsTest> instance(new StringFormattingUtilsTest());
+
+	ADD_TESTCASE(StringFormattingUtilsTest, test_append_formatted_double);
+	ADD_TESTCASE(StringFormattingUtilsTest, test_append_formatted_double_special_values);
+	ADD_TESTCASE(StringFormattingUtilsTest, test_append_formatted_double_invalid_parameters);
+}
+
+
+void
+GPlatesUnitTest::StringFormattingUtilsTest::test_append_formatted_double()
+{
+	// Fixed seed so the test is repeatable.
+	boost::mt19937 gen(0);
+	boost::uniform_real<> mantissa_dist(-1.0, 1.0);
+	boost::variate_generator<boost::mt19937&, boost::uniform_real<> > random_mantissa(gen, mantissa_dist);
+	boost::uniform_int<> exponent_dist(-20, 20);
+	boost::variate_generator<boost::mt19937&, boost::uniform_int<> > random_exponent(gen, exponent_dist);
+
+	for (unsigned int prec = 1; prec <= GPlatesUtils::MAX_APPEND_FORMATTED_DOUBLE_PRECISION; ++prec)
+	{
+		const double scale = std::pow(10.0, static_cast<int>(prec));
+
+		// Values across many magnitudes (including ones too large for the fast path).
+		for (unsigned int n = 0; n < NUM_RANDOM_VALUES_PER_PRECISION; ++n)
+		{
+			check_append_formatted_double(random_mantissa() * std::pow(10.0, random_exponent()), prec);
+		}
+
+		// Values that are exactly half way between two decimal digits (at 'prec'),
+		// where the stream formatter rounds to even.
+		for (unsigned int n = 0; n < 1000; ++n)
+		{
+			check_append_formatted_double_both_signs((n + 0.5) / std::ldexp(1.0, prec), prec);
+		}
+
+		// Values near the largest that the fast path handles (2^52 once scaled by 10^prec).
+		const double fast_path_limit = std::ldexp(1.0, 52) / scale;
+		check_append_formatted_double_both_signs(fast_path_limit, prec);
+		check_append_formatted_double_both_signs(boost::math::float_prior(fast_path_limit), prec);
+		check_append_formatted_double_both_signs(boost::math::float_next(fast_path_limit), prec);
+
+		// Tiny values, including negative values that round to zero.
+		check_append_formatted_double_both_signs(1e-20, prec);
+		check_append_formatted_double_both_signs(0.4 / scale, prec);
+		check_append_formatted_double_both_signs(0.5 / scale, prec);
+		check_append_formatted_double_both_signs(std::numeric_limits<double>::denorm_min(), prec);
+		check_append_formatted_double_both_signs(0.0, prec);
+
+		check_append_formatted_double_both_signs(std::numeric_limits<double>::max(), prec);
+	}
+}
+
+
+void
+GPlatesUnitTest::StringFormattingUtilsTest::test_append_formatted_double_special_values()
+{
+	// Exact ties round to even (like the stream formatter).
+	BOOST_CHECK_EQUAL(append_formatted_double(0.125, 6, 2), std::string("  0.12"));
+	BOOST_CHECK_EQUAL(append_formatted_double(0.375, 6, 2), std::string("  0.38"));
+	BOOST_CHECK_EQUAL(append_formatted_double(-0.125, 6, 2), std::string(" -0.12"));
+	BOOST_CHECK_EQUAL(append_formatted_double(0.25, 4, 1), std::string(" 0.2"));
+	BOOST_CHECK_EQUAL(append_formatted_double(0.75, 4, 1), std::string(" 0.8"));
+
+	// Negative zero, and negative values that round to zero, keep their sign.
+	BOOST_CHECK_EQUAL(append_formatted_double(-0.0, 9, 6), std::string("-0.000000"));
+	BOOST_CHECK_EQUAL(append_formatted_double(-1e-20, 9, 6), std::string("-0.000000"));
+	BOOST_CHECK_EQUAL(append_formatted_double(-4e-7, 9, 6), std::string("-0.000000"));
+
+	const unsigned int prec_values[] = { 1, 6, GPlatesUtils::MAX_APPEND_FORMATTED_DOUBLE_PRECISION };
+	for (unsigned int p = 0; p < sizeof(prec_values) / sizeof(prec_values[0]); ++p)
+	{
+		check_append_formatted_double(std::numeric_limits<double>::quiet_NaN(), prec_values[p]);
+		check_append_formatted_double_both_signs(std::numeric_limits<double>::infinity(), prec_values[p]);
+	}
+}
+
+
+void
+GPlatesUnitTest::StringFormattingUtilsTest::test_append_formatted_double_invalid_parameters()
+{
+	std::string str;
+
+	// Not enough width for the sign, integral part and decimal point.
+	BOOST_CHECK_THROW(
+			GPlatesUtils::append_formatted_double(str, 1.0, 8, 6),
+			GPlatesUtils::InvalidFormattingParametersException);
+
+	// Precision too large for the fast path.
+	BOOST_CHECK_THROW(
+			GPlatesUtils::append_formatted_double(
+					str, 1.0, 30, GPlatesUtils::MAX_APPEND_FORMATTED_DOUBLE_PRECISION + 1),
+			GPlatesUtils::InvalidFormattingParametersException);
+
+	BOOST_CHECK(str.empty());
+}
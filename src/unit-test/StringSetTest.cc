@@ -23,15 +23,115 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <vector>
+#include <boost/bind/bind.hpp>
+#include <boost/ref.hpp>
+#include <boost/thread/thread.hpp>
 #include <QString>
 
 #include "model/FeatureType.h"
 
 #include "unit-test/StringSetTest.h"
 
+#include "utils/IdStringSet.h"
 #include "utils/StringSet.h"
 
 
+namespace
+{
+	const unsigned int NUM_THREADS = 4;
+
+	// A power-of-two so that each thread's (odd) stride visits every string.
+	const unsigned int NUM_STRINGS = 1024;
+
+	const unsigned int NUM_PASSES = 10;
+
+
+	GPlatesUtils::UnicodeString
+	get_test_string(
+			unsigned int string_index)
+	{
+		return GPlatesUtils::UnicodeString(QString("string%1").arg(string_index));
+	}
+
+
+	/**
+	 * Inserts all test strings into @a string_set (in an order that depends on @a thread_index).
+	 *
+	 * All but the last pass release their strings, so elements are removed from the set while
+	 * other threads are inserting them.
+	 */
+	template <class StringSetType>
+	void
+	insert_test_strings(
+			StringSetType &string_set,
+			unsigned int thread_index,
+			std::vector<typename StringSetType::SharedIterator> &shared_iterators)
+	{
+		for (unsigned int pass = 0; pass < NUM_PASSES; ++pass)
+		{
+			shared_iterators.clear();
+			shared_iterators.resize(NUM_STRINGS);
+
+			for (unsigned int n = 0; n < NUM_STRINGS; ++n)
+			{
+				const unsigned int string_index = (n * (2 * thread_index + 1) + thread_index) % NUM_STRINGS;
+				shared_iterators[string_index] = string_set.insert(get_test_string(string_index));
+			}
+		}
+	}
+
+
+	/**
+	 * Inserts the test strings into @a string_set from multiple threads and checks each thread
+	 * obtained the same element for each string.
+	 */
+	template <class StringSetType>
+	void
+	check_concurrent_insert(
+			StringSetType &string_set)
+	{
+		typedef typename StringSetType::SharedIterator shared_iterator_type;
+
+		std::vector< std::vector<shared_iterator_type> > thread_shared_iterators(NUM_THREADS);
+
+		boost::thread_group threads;
+		for (unsigned int thread_index = 0; thread_index < NUM_THREADS; ++thread_index)
+		{
+			threads.create_thread(
+					boost::bind(
+							&insert_test_strings<StringSetType>,
+							boost::ref(string_set),
+							thread_index,
+							boost::ref(thread_shared_iterators[thread_index])));
+		}
+		threads.join_all();
+
+		BOOST_CHECK_EQUAL(string_set.size(), NUM_STRINGS);
+
+		for (unsigned int string_index = 0; string_index < NUM_STRINGS; ++string_index)
+		{
+			const GPlatesUtils::UnicodeString string = get_test_string(string_index);
+			const shared_iterator_type &shared_iterator = thread_shared_iterators[0][string_index];
+
+			BOOST_CHECK(*shared_iterator == string);
+			for (unsigned int thread_index = 1; thread_index < NUM_THREADS; ++thread_index)
+			{
+				BOOST_CHECK(thread_shared_iterators[thread_index][string_index] == shared_iterator);
+			}
+
+			const boost::optional<shared_iterator_type> contained = string_set.contains(string);
+			BOOST_CHECK(contained && contained.get() == shared_iterator);
+		}
+
+		// Releasing the last references removes the strings.
+		thread_shared_iterators.clear();
+		BOOST_CHECK_EQUAL(string_set.size(), 0U);
+		BOOST_CHECK(!string_set.contains(get_test_string(0)));
+	}
+}
+
+
 GPlatesUnitTest::StringSetTestSuite::StringSetTestSuite(
 		unsigned level) :
 	GPlatesUnitTest::GPlatesTestSuite(
@@ -47,6 +147,8 @@ GPlatesUnitTest::StringSetTestSuite::construct_maps()
 	boost::shared_ptr<StringSetTest> instance(new StringSetTest());
 
 	ADD_TESTCASE(StringSetTest, equality_test);
+	ADD_TESTCASE(StringSetTest, concurrent_insert_test);
+	ADD_TESTCASE(StringSetTest, concurrent_id_insert_test);
 }
 
 
@@ -69,3 +171,18 @@ GPlatesUnitTest::StringSetTest::equality_test()
 	BOOST_CHECK(foo == foo2);
 }
 
+
+void
+GPlatesUnitTest::StringSetTest::concurrent_insert_test()
+{
+	GPlatesUtils::StringSet string_set;
+	check_concurrent_insert(string_set);
+}
+
+
+void
+GPlatesUnitTest::StringSetTest::concurrent_id_insert_test()
+{
+	GPlatesUtils::IdStringSet string_set;
+	check_concurrent_insert(string_set);
+}
@@ -42,6 +42,12 @@ namespace GPlatesUnitTest
 
 		void
 		equality_test();
+
+		void
+		concurrent_insert_test();
+
+		void
+		concurrent_id_insert_test();
 	};
 
 	
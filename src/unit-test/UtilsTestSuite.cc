@@ -29,7 +29,9 @@
 #include "unit-test/UtilsTestSuite.h"
 #include "unit-test/TestSuiteFilter.h"
 
+#include "unit-test/CallStackTest.h"
 #include "unit-test/SmartNodeLinkedListTest.h"
+#include "unit-test/StringFormattingUtilsTest.h"
 #include "unit-test/StringSetTest.h"
 
 GPlatesUnitTest::UtilsTestSuite::UtilsTestSuite(
@@ -43,7 +45,9 @@ GPlatesUnitTest::UtilsTestSuite::UtilsTestSuite(
 void 
 GPlatesUnitTest::UtilsTestSuite::construct_maps()
 {
+	ADD_TESTSUITE(CallStack);
 	ADD_TESTSUITE(SmartNodeLinkedList);
+	ADD_TESTSUITE(StringFormattingUtils);
 	ADD_TESTSUITE(StringSet);
 }
 
@@ -66,18 +66,21 @@
 namespace GPlatesUtils
 {
 	/**
-	 * This class is a singleton that keeps track of the call stack.
+	 * This class is a per-thread singleton that keeps track of the call stack.
+	 *
+	 * Each thread has its own call stack since exceptions (which track their location on the
+	 * call stack when constructed) are also thrown, and caught, on worker threads.
 	 */
 	class CallStack :
 			public boost::noncopyable
 	{
 	public:
-		//! Returns singleton instance of this class.
+		//! Returns singleton instance of this class for the calling thread.
 		static
 		CallStack &
 		instance()
 		{
-			static CallStack s_call_stack_tracker;
+			static thread_local CallStack s_call_stack_tracker;
 			return s_call_stack_tracker;
 		}
 
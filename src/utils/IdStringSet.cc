@@ -33,6 +33,18 @@ GPlatesUtils::IdStringSet::AbstractBackRef::~AbstractBackRef()
 {  }
 
 
+boost::mutex &
+GPlatesUtils::IdStringSet::SharedIterator::back_refs_mutex() const
+{
+	// The number of mutexes shared by all elements (a power of two).
+	static const unsigned int NUM_BACK_REFS_MUTEXES = 64;
+	static boost::mutex back_refs_mutexes[NUM_BACK_REFS_MUTEXES];
+
+	// Select a mutex using the element's (precomputed) hash.
+	return back_refs_mutexes[d_element->d_hash & (NUM_BACK_REFS_MUTEXES - 1)];
+}
+
+
 bool
 GPlatesUtils::IdStringSet::SharedIterator::operator==(
 		const SharedIterator &other) const
@@ -53,7 +65,7 @@ GPlatesUtils::IdStringSet::SharedIterator::operator==(
 		return true;
 	}
 
-	return (d_iter == other.d_iter);
+	return (d_element == other.d_element);
 }
 
 
@@ -65,7 +77,7 @@ GPlatesUtils::IdStringSet::SharedIterator::increment_ref_count()
 		// This instance is uninitialised.
 		return;
 	}
-	++(d_iter->d_ref_count);
+	collection_type::add_ref(d_element);
 }
 
 
@@ -77,11 +89,8 @@ GPlatesUtils::IdStringSet::SharedIterator::decrement_ref_count()
 		// This instance is uninitialised.
 		return;
 	}
-	if (--(d_iter->d_ref_count) == 0)
-	{
-		// There are no more references to the element in the set.
-		d_impl_ptr->collection().erase(d_iter);
-	}
+	// If there are no more references to the element then it is removed from the set.
+	d_impl_ptr->collection().release(d_element);
 }
 
 
@@ -89,12 +98,11 @@ const boost::optional<GPlatesUtils::IdStringSet::SharedIterator>
 GPlatesUtils::IdStringSet::contains(
 		const GPlatesUtils::UnicodeString &s) const
 {
-	UnicodeStringAndRefCountWithBackRef elem(s);
-	collection_type::iterator iter = d_impl->collection().find(elem);
-	if (iter != d_impl->collection().end())
+	const UnicodeStringAndRefCountWithBackRef *element = d_impl->collection().find_and_add_ref(s);
+	if (element != NULL)
 	{
-		// The element already exists in the set.
-		SharedIterator sh_iter(iter, d_impl);
+		// The element already exists in the set (and its reference-count has been incremented for us).
+		SharedIterator sh_iter(element, d_impl, false/*add_ref*/);
 		return sh_iter;
 	}
 	else
@@ -108,19 +116,9 @@ GPlatesUtils::IdStringSet::SharedIterator
 GPlatesUtils::IdStringSet::insert(
 		const GPlatesUtils::UnicodeString &s)
 {
-	UnicodeStringAndRefCountWithBackRef elem(s);
-	collection_type::iterator iter = d_impl->collection().find(elem);
-	if (iter != d_impl->collection().end())
-	{
-		// The element already exists in the set.
-		SharedIterator sh_iter(iter, d_impl);
-		return sh_iter;
-	}
-	else
-	{
-		std::pair< collection_type::iterator, bool > insertion = d_impl->collection().insert(elem);
-		// Now the element exists in the set.
-		SharedIterator sh_iter(insertion.first, d_impl);
-		return sh_iter;
-	}
+	// Insert the element if it's not already in the set (its reference-count is incremented for us).
+	const UnicodeStringAndRefCountWithBackRef *element = d_impl->collection().insert_and_add_ref(s);
+	SharedIterator sh_iter(element, d_impl, false/*add_ref*/);
+	return sh_iter;
 }
+
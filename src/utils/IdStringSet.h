@@ -33,13 +33,16 @@
 #endif
 
 #include <algorithm>
-#include <set>
+#include <atomic>
+#include <cstddef>
 #include <boost/intrusive_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/optional.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "SmartNodeLinkedList.h"
 #include "ReferenceCount.h"
+#include "ShardedStringTable.h"
 
 #include "global/unicode.h"
 
@@ -79,6 +82,13 @@ namespace GPlatesUtils
 	 * Further, it is assumed that in general, most (if not all) IDs will have one back-ref. 
 	 * As a result, the classes below (particularly class UnicodeStringAndRefCountWithBackRef)
 	 * were optimised for the presence of back-references.
+	 *
+	 * Like StringSet, an IdStringSet instance can be accessed concurrently from multiple threads
+	 * (for example, when loading files in parallel).  Back-references can also be added and
+	 * removed concurrently (for example, when features are created on multiple threads) provided
+	 * the mutex returned by SharedIterator::back_refs_mutex is locked while doing so.  However the
+	 * back-references of an element should only be traversed by one thread at a time, and not
+	 * while other threads are adding or removing them (typically traversal is done by the main thread).
 	 */
 	class IdStringSet
 	{
@@ -111,22 +121,24 @@ namespace GPlatesUtils
 
 
 		/**
-		 * This is the element which is contained in the @c std::set inside IdStringSetImpl.
+		 * This is the element which is contained in the hash table inside IdStringSetImpl.
 		 */
 		struct UnicodeStringAndRefCountWithBackRef
 		{
-			GPlatesUtils::UnicodeString d_str;
-			mutable long d_ref_count;
+			const GPlatesUtils::UnicodeString d_str;
+			const std::size_t d_hash;
+			mutable std::atomic<long> d_ref_count;
 			mutable back_ref_list_type d_back_refs;
 
 			/**
 			 * Construct a UnicodeStringAndRefCountWithBackRef instance for the
-			 * UnicodeString instance @a str.
+			 * UnicodeString instance @a str (with hash @a hash).
 			 */
-			explicit
 			UnicodeStringAndRefCountWithBackRef(
-					const GPlatesUtils::UnicodeString &str) :
+					const GPlatesUtils::UnicodeString &str,
+					std::size_t hash) :
 				d_str(str),
+				d_hash(hash),
 				d_ref_count(0),
 				d_back_refs(back_ref_type())
 			{  }
@@ -140,28 +152,15 @@ namespace GPlatesUtils
 			 *
 			 * This constructor is necessary so that
 			 * UnicodeStringAndRefCountWithBackRef can be stored as an element in
-			 * @c std::set.
+			 * the hash table.
 			 */
 			UnicodeStringAndRefCountWithBackRef(
 					const UnicodeStringAndRefCountWithBackRef &other):
 				d_str(other.d_str),
+				d_hash(other.d_hash),
 				d_ref_count(0),
 				d_back_refs(back_ref_type())
 			{  }
-
-			/**
-			 * Provide a "less than" comparison for UnicodeStringAndRefCountWithBackRef
-			 * instances.
-			 *
-			 * A "less than" comparison is used by 'std::set' to position elements in
-			 * its internal balanced binary tree.
-			 */
-			bool
-			operator<(
-					const UnicodeStringAndRefCountWithBackRef &other) const
-			{
-				return GPLATES_ICU_BOOL(d_str < other.d_str);
-			}
 		private:
 			/**
 			 * Do not define the copy-assignment operator.
@@ -173,7 +172,7 @@ namespace GPlatesUtils
 		};
 
 
-		typedef std::set< UnicodeStringAndRefCountWithBackRef > collection_type;
+		typedef ShardedStringTable< UnicodeStringAndRefCountWithBackRef > collection_type;
 		typedef collection_type::size_type size_type;
 
 
@@ -250,40 +249,40 @@ namespace GPlatesUtils
 		 *
 		 * @par Implementation (white box) description:
 		 * (This description complements the abstraction description.)
-		 *  -# An instance of SharedIterator contains an iterator into the collection
+		 *  -# An instance of SharedIterator contains a pointer to an element of the collection
 		 * contained within the IdStringSetImpl instance of the SharedIterator's
 		 * IdStringSet.  It also contains a pointer-to-IdStringSetImpl.
-		 *  -# If a SharedIterator instance was default-constructed, the contained iterator
+		 *  -# If a SharedIterator instance was default-constructed, the contained element pointer
 		 * will be uninitialised and the pointer-to-IdStringSetImpl will be NULL.  Thus, by
 		 * examining the pointer-to-IdStringSetImpl, it may be determined whether an
 		 * instance was default-constructed or not.
 		 *  -# If a SharedIterator instance was constructed with parameters, it will have
-		 * been passed an iterator which is assumed to point into the @c std::set contained
+		 * been passed an element pointer which is assumed to point into the hash table contained
 		 * within an IdStringSetImpl, and a pointer-to-IdStringSetImple which is assumed to
-		 * point to the IdStringSetImpl instance containing the @c std::set.  The
+		 * point to the IdStringSetImpl instance containing the hash table.  The
 		 * SharedIterator instance will assume part of the responsibility for the
 		 * management of the lifetime of the IdStringSetImpl instance.
-		 *  -# Each element contained within the @c std::set inside an IdStringSetImpl
+		 *  -# Each element contained within the hash table inside an IdStringSetImpl
 		 * instance is a UnicodeString instance with an associated reference-count.  When
 		 * a SharedIterator instance is constructed with parameters, it is assumed to be
-		 * referencing the an element within the @c std::set; the reference-count of the
+		 * referencing the an element within the hash table; the reference-count of the
 		 * element will be incremented.
 		 *  -# When a SharedIterator instance is copy-constructed, if the original
-		 * SharedIterator instance references an element within the @c std::set, the
+		 * SharedIterator instance references an element within the hash table, the
 		 * newly-instantiated SharedIterator instance will reference that same element, and
 		 * the reference-count of the element will be incremented.  If the original
 		 * SharedIterator instance is uninitialised, the newly-instantiated instance will
 		 * be uninitialised also.
 		 *  -# When a SharedIterator instance is destroyed, if it referenced an element of
-		 * the @c std::set, the reference-count of the element will be decremented; if the
+		 * the hash table, the reference-count of the element will be decremented; if the
 		 * SharedIterator instance held the last reference to the element, the element will
-		 * be removed from the @c std::set.  If the SharedIterator instance was the last
+		 * be removed from the hash table.  If the SharedIterator instance was the last
 		 * SharedIterator or IdStringSet instance responsible for managing the lifetime of
 		 * the IdStringSetImpl instance, the IdStringSetImpl instance will also be
 		 * de-allocated.
 		 *  -# When a SharedIterator instance is copy-assigned to another instance, the
 		 * copy-assignment function acts to handle the increment/decrement of the number of
-		 * references to elements of the @c std::set :  if a SharedIterator instance is
+		 * references to elements of the hash table :  if a SharedIterator instance is
 		 * being assigned to itself, there will be no net change in the number of
 		 * references; if the l-value of the assignment referenced an element before the
 		 * assignment, that reference will be undone (the reference-count will be
@@ -313,13 +312,13 @@ namespace GPlatesUtils
 		 * (These collectively imply the abstraction invariants.)
 		 *  -# Either the pointer-to-IdStringSetImpl is NULL, or it points to the
 		 * IdStringSetImpl instance contained within an IdStringSet instance and the
-		 * iterator points to an element of the @a std::set contained within the
+		 * element pointer points to an element of the hash table contained within the
 		 * IdStringSetImpl instance.
 		 *  -# If the pointer-to-IdStringSetImpl is non-NULL, the IdStringSetImpl instance
 		 * will have a reference-count which is one greater than it would be if the
 		 * pointer-to-IdStringSetImpl were not pointing to that IdStringSetImpl instance,
-		 * and the UnicodeString element of the @c std::set will have a reference-count
-		 * which is one greater than it would be if the iterator did not reference it.
+		 * and the UnicodeString element of the hash table will have a reference-count
+		 * which is one greater than it would be if the element pointer did not reference it.
 		 */
 		class SharedIterator
 		{
@@ -330,6 +329,7 @@ namespace GPlatesUtils
 			 * This function will not throw.
 			 */
 			SharedIterator() :
+					d_element(NULL),
 					d_impl_ptr(NULL) {  }
 
 			/**
@@ -337,18 +337,25 @@ namespace GPlatesUtils
 			 * element of an IdStringSet instance.
 			 *
 			 * It is assumed that @a impl is a non-NULL pointer to an IdStringSetImpl
-			 * instance, and @a iter points to an element of the @a std::set contained
+			 * instance, and @a element points to an element of the hash table contained
 			 * within the IdStringSetImpl instance.
 			 *
+			 * If @a add_ref is false then the reference-count of the element is not
+			 * incremented (because the caller has already incremented it on our behalf).
+			 *
 			 * This function will not throw.
 			 */
 			SharedIterator(
-					collection_type::iterator iter,
-					boost::intrusive_ptr<IdStringSetImpl> impl) :
-				d_iter(iter),
+					const UnicodeStringAndRefCountWithBackRef *element,
+					boost::intrusive_ptr<IdStringSetImpl> impl,
+					bool add_ref = true) :
+				d_element(element),
 				d_impl_ptr(impl)
 			{
-				increment_ref_count();
+				if (add_ref)
+				{
+					increment_ref_count();
+				}
 			}
 
 			/**
@@ -358,7 +365,7 @@ namespace GPlatesUtils
 			 */
 			SharedIterator(
 					const SharedIterator &other) :
-				d_iter(other.d_iter),
+				d_element(other.d_element),
 				d_impl_ptr(other.d_impl_ptr)
 			{
 				increment_ref_count();
@@ -414,7 +421,7 @@ namespace GPlatesUtils
 			back_ref_list_type &
 			back_refs() const
 			{
-				return d_iter->d_back_refs;
+				return d_element->d_back_refs;
 			}
 
 			/**
@@ -423,9 +430,18 @@ namespace GPlatesUtils
 			back_ref_list_type &
 			back_refs()
 			{
-				return d_iter->d_back_refs;
+				return d_element->d_back_refs;
 			}
 
+			/**
+			 * The mutex to lock while adding a back-reference to, or removing a back-reference
+			 * from, the list of back-references for this IdStringSet element.
+			 *
+			 * Each mutex is shared by many elements (to avoid a mutex per element).
+			 */
+			boost::mutex &
+			back_refs_mutex() const;
+
 			/**
 			 * Swap the internals of this instance with @a other.
 			 *
@@ -443,7 +459,7 @@ namespace GPlatesUtils
 			swap(
 					SharedIterator &other)
 			{
-				std::swap(d_iter, other.d_iter);
+				std::swap(d_element, other.d_element);
 				std::swap(d_impl_ptr, other.d_impl_ptr);
 			}
 
@@ -535,19 +551,19 @@ namespace GPlatesUtils
 			}
 		private:
 			/**
-			 * An iterator to an element in the std::set contained in IdStringSetImpl.
+			 * A pointer to an element in the hash table contained in IdStringSetImpl.
 			 *
-			 * The collection-type iterator is only meaningful if the impl-pointer is
+			 * The element pointer is only meaningful if the impl-pointer is
 			 * non-NULL (which means that the shared iterator instance is initialised).
 			 */
-			collection_type::iterator d_iter;
+			const UnicodeStringAndRefCountWithBackRef *d_element;
 
 			/**
 			 * An intrusive-pointer which manages the IdStringSetImpl instance.
 			 *
-			 * We need a pointer to the IdStringSetImpl instance (or the std::set which
-			 * it contains) in order to be able to invoke the 'erase' member function
-			 * of std::set.
+			 * We need a pointer to the IdStringSetImpl instance (or the hash table which
+			 * it contains) in order to be able to remove an element from the hash table
+			 * when its last reference is released.
 			 *
 			 * Since we have a pointer to the IdStringSetImpl instance, we're also
 			 * using it to indicate (based upon whether it is NULL or non-NULL) whether
@@ -562,7 +578,7 @@ namespace GPlatesUtils
 			const GPlatesUtils::UnicodeString &
 			access_target() const
 			{
-				return d_iter->d_str;
+				return d_element->d_str;
 			}
 
 			void
@@ -614,7 +630,7 @@ namespace GPlatesUtils
 		 * which matches the UnicodeString instance @a s, or is @c boost::none if @a s is
 		 * not contained within the IdStringSet instance.
 		 *
-		 * This function might throw whatever the copy-constructor and less-than-comparison
+		 * This function might throw whatever the copy-constructor and equality-comparison
 		 * operator of UnicodeString might throw.  This function is strongly exception-safe
 		 * and exception-neutral.
 		 */
@@ -628,8 +644,8 @@ namespace GPlatesUtils
 		 *
 		 * If the UnicodeString instance @a s is not yet contained within the IdStringSet
 		 * instance, it will be inserted (or an exception will be thrown, in the case of
-		 * copy-construction failure or less-than-comparison failure for the UnicodeString
-		 * instance, or memory allocation failure for @c std::set).
+		 * copy-construction failure or equality-comparison failure for the UnicodeString
+		 * instance, or memory allocation failure for the hash table).
 		 *
 		 * @return The SharedIterator instance which points to the element of the
 		 * IdStringSet instance which matches the UnicodeString instance @a s.
@@ -640,9 +656,9 @@ namespace GPlatesUtils
 		 * instance, or an exception has been thrown.  Return-value is a SharedIterator
 		 * instance which points to the element for the UnicodeString instance @a s.
 		 *
-		 * This function might throw whatever the copy-constructor and less-than-comparison
-		 * operator of UnicodeString might throw, as well as whatever the @a insert
-		 * function of @c std::set might throw.  This function is strongly exception-safe
+		 * This function might throw whatever the copy-constructor and equality-comparison
+		 * operator of UnicodeString might throw, as well as whatever the hash table
+		 * might throw when inserting.  This function is strongly exception-safe
 		 * and exception-neutral.
 		 */
 		SharedIterator
@@ -77,6 +77,11 @@ namespace GPlatesUtils
 		 */
 		typedef boost::function< value_type (const key_type &) > create_value_object_function_type;
 
+		/**
+		 * Typedef for a function that visits a cached key/value pair and can modify the value.
+		 */
+		typedef boost::function< void (const key_type &, value_type &) > visit_value_object_function_type;
+
 
 		/**
 		 * Constructor accepting a function that creates a value object given a key object.
@@ -152,6 +157,19 @@ namespace GPlatesUtils
 				const key_type &key,
 				boost::optional<bool &> new_value_created = boost::none);
 
+
+		/**
+		 * Calls @a visit_value_object_function on each key/value pair currently in the cache.
+		 *
+		 * This is useful for updating cached value objects in place (rather than clearing the cache).
+		 *
+		 * Unlike @a get_value this does not change the least-recently used order of the cached values
+		 * (and does not create or evict any values).
+		 */
+		void
+		visit_values(
+				const visit_value_object_function_type &visit_value_object_function);
+
 	private:
 		//! Typedef for this class.
 		typedef KeyValueCache<KeyType,ValueType> this_type;
@@ -402,6 +420,20 @@ namespace GPlatesUtils
 	}
 
 
+	template <typename KeyType, typename ValueType>
+	void
+	KeyValueCache<KeyType,ValueType>::visit_values(
+			const visit_value_object_function_type &visit_value_object_function)
+	{
+		typename key_value_map_type::iterator key_value_iter = d_key_value_map.begin();
+		typename key_value_map_type::iterator key_value_end = d_key_value_map.end();
+		for ( ; key_value_iter != key_value_end; ++key_value_iter)
+		{
+			visit_value_object_function(key_value_iter->first, key_value_iter->second->value_object);
+		}
+	}
+
+
 	template <typename KeyType, typename ValueType>
 	void
 	KeyValueCache<KeyType,ValueType>::remove_least_recently_used_value()
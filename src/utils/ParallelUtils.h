@@ -0,0 +1,225 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_UTILS_PARALLELUTILS_H
+#define GPLATES_UTILS_PARALLELUTILS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <boost/bind/bind.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/optional.hpp>
+#include <boost/ref.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+
+namespace GPlatesUtils
+{
+	/**
+	 * Utilities for splitting a loop over independent items across multiple threads.
+	 *
+	 * This is intentionally simple (there's no persistent thread pool) since it's intended for
+	 * coarse-grained work (such as solving velocities at hundreds of thousands of points) where
+	 * the cost of starting a handful of threads is negligible compared to the work itself.
+	 *
+	 * NOTE: Much of GPlates lazily caches calculations inside otherwise 'const' objects
+	 * (eg, point-in-polygon structures in @a PolygonOnSphere) and these caches are *not* thread-safe.
+	 * So the caller is responsible for ensuring any shared objects accessed by the worker functor
+	 * have been fully prepared (ie, their caches populated) before calling @a parallel_for.
+	 */
+	namespace ParallelUtils
+	{
+		/**
+		 * Returns the number of worker threads used by @a parallel_for (at least one).
+		 */
+		unsigned int
+		get_num_worker_threads();
+
+
+		namespace Implementation
+		{
+			/**
+			 * Hands out contiguous chunks of the index range [0, num_items) to worker threads.
+			 */
+			class ChunkDispenser
+			{
+			public:
+				ChunkDispenser(
+						std::size_t num_items,
+						std::size_t chunk_size) :
+					d_num_items(num_items),
+					d_chunk_size(chunk_size),
+					d_next_item(0)
+				{  }
+
+				/**
+				 * Returns false if there are no more chunks (or a worker has already failed).
+				 */
+				bool
+				get_next_chunk(
+						std::size_t &chunk_begin,
+						std::size_t &chunk_end)
+				{
+					boost::mutex::scoped_lock lock(d_mutex);
+
+					if (d_exception ||
+						d_next_item >= d_num_items)
+					{
+						return false;
+					}
+
+					chunk_begin = d_next_item;
+					chunk_end = (std::min)(d_num_items, d_next_item + d_chunk_size);
+					d_next_item = chunk_end;
+
+					return true;
+				}
+
+				/**
+				 * Records the first exception thrown by a worker (subsequent ones are dropped).
+				 */
+				void
+				set_exception(
+						const boost::exception_ptr &exception)
+				{
+					boost::mutex::scoped_lock lock(d_mutex);
+
+					if (!d_exception)
+					{
+						d_exception = exception;
+					}
+				}
+
+				void
+				rethrow_exception_if_any() const
+				{
+					if (d_exception)
+					{
+						boost::rethrow_exception(d_exception.get());
+					}
+				}
+
+			private:
+				boost::mutex d_mutex;
+				std::size_t d_num_items;
+				std::size_t d_chunk_size;
+				std::size_t d_next_item;
+				boost::optional<boost::exception_ptr> d_exception;
+			};
+
+
+			template <typename RangeFunctorType>
+			void
+			run_worker(
+					ChunkDispenser &chunk_dispenser,
+					RangeFunctorType &range_functor)
+			{
+				try
+				{
+					std::size_t chunk_begin;
+					std::size_t chunk_end;
+					while (chunk_dispenser.get_next_chunk(chunk_begin, chunk_end))
+					{
+						range_functor(chunk_begin, chunk_end);
+					}
+				}
+				catch (...)
+				{
+					chunk_dispenser.set_exception(boost::current_exception());
+				}
+			}
+		}
+
+
+		/**
+		 * Calls `range_functor(begin, end)` for consecutive sub-ranges of the index range
+		 * [0, num_items), distributing the sub-ranges across @a get_num_worker_threads threads.
+		 *
+		 * Each sub-range contains at least @a min_items_per_chunk items (except possibly the last).
+		 * The functor is shared (not copied) by all threads so it must be safe to call concurrently.
+		 *
+		 * The calling thread participates in the work and only returns once all items are processed.
+		 * If the functor throws then the remaining sub-ranges are abandoned and the first exception
+		 * is re-thrown in the calling thread.
+		 *
+		 * If there's only one chunk of work (or only one hardware thread) then everything is done
+		 * in the calling thread.
+		 */
+		template <typename RangeFunctorType>
+		void
+		parallel_for(
+				std::size_t num_items,
+				RangeFunctorType range_functor,
+				std::size_t min_items_per_chunk = 1)
+		{
+			if (num_items == 0)
+			{
+				return;
+			}
+
+			if (min_items_per_chunk == 0)
+			{
+				min_items_per_chunk = 1;
+			}
+
+			const unsigned int num_worker_threads = get_num_worker_threads();
+
+			// Use several chunks per thread so that threads finishing early can pick up the slack
+			// (some items, like velocity domain points near plate boundaries, are more expensive than others).
+			const std::size_t num_chunks_per_thread = 8;
+			const std::size_t chunk_size = (std::max)(
+					min_items_per_chunk,
+					(num_items + num_worker_threads * num_chunks_per_thread - 1) /
+						(num_worker_threads * num_chunks_per_thread));
+
+			if (num_worker_threads == 1 ||
+				chunk_size >= num_items)
+			{
+				range_functor(std::size_t(0), num_items);
+				return;
+			}
+
+			Implementation::ChunkDispenser chunk_dispenser(num_items, chunk_size);
+
+			// The calling thread is one of the workers, so start one less thread.
+			const std::size_t num_chunks = (num_items + chunk_size - 1) / chunk_size;
+			const unsigned int num_threads_to_start = static_cast<unsigned int>(
+					(std::min)(std::size_t(num_worker_threads), num_chunks) - 1);
+
+			boost::thread_group worker_threads;
+			for (unsigned int n = 0; n < num_threads_to_start; ++n)
+			{
+				worker_threads.create_thread(
+						boost::bind(
+								&Implementation::run_worker<RangeFunctorType>,
+								boost::ref(chunk_dispenser),
+								boost::ref(range_functor)));
+			}
+
+			Implementation::run_worker(chunk_dispenser, range_functor);
+
+			worker_threads.join_all();
+
+			chunk_dispenser.rethrow_exception_if_any();
+		}
+	}
+}
+
+#endif // GPLATES_UTILS_PARALLELUTILS_H
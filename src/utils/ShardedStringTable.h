@@ -0,0 +1,311 @@
+/**
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_UTILS_SHARDEDSTRINGTABLE_H
+#define GPLATES_UTILS_SHARDEDSTRINGTABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/unordered_set.hpp>
+#include <QHash>
+
+#include "global/unicode.h"
+
+
+namespace GPlatesUtils
+{
+	/**
+	 * A hash table of unique, reference-counted strings that can be accessed concurrently
+	 * (used to implement @a StringSet and @a IdStringSet).
+	 *
+	 * The table is split into shards (selected by string hash), each with its own mutex, so that
+	 * threads interning different strings rarely contend for the same lock. Each element stores its
+	 * (precomputed) hash so that it never needs to be re-hashed (eg, when the table grows or when the
+	 * element is removed).
+	 *
+	 * The address of an element does not change while it is in the table (even if the table grows).
+ *
+ * Lookups compare the string (and its hash) directly against the elements, so an element (and a copy
+ * of its string) is only constructed when a new string is inserted.
+	 *
+	 * Reference counts are atomic. Incrementing a reference count, and decrementing it to a value
+	 * other than zero, does not lock. However the last reference to an element is only released while
+	 * its shard is locked - this ensures that an element with a zero reference count is never found
+	 * by another thread (since the element is removed before the shard is unlocked).
+	 *
+	 * ElementType must have:
+	 *  - a 'const UnicodeString d_str' data member,
+	 *  - a 'const std::size_t d_hash' data member,
+	 *  - a 'mutable std::atomic<long> d_ref_count' data member (initialised to zero), and
+	 *  - a constructor accepting a string and its hash (see @a hash).
+	 */
+	template <class ElementType>
+	class ShardedStringTable :
+			private boost::noncopyable
+	{
+	public:
+
+		typedef std::size_t size_type;
+
+		/**
+		 * The number of shards (a power of two).
+		 */
+		static const unsigned int NUM_SHARDS = 32;
+
+
+		/**
+		 * The hash of a string as stored in an element.
+		 */
+		static
+		std::size_t
+		hash(
+				const UnicodeString &s)
+		{
+			return qHash(s.qstring());
+		}
+
+
+		/**
+		 * Returns the number of elements.
+		 */
+		size_type
+		size() const
+		{
+			size_type num_elements = 0;
+			for (unsigned int n = 0; n < NUM_SHARDS; ++n)
+			{
+				boost::mutex::scoped_lock lock(d_shards[n].mutex);
+				num_elements += d_shards[n].elements.size();
+			}
+			return num_elements;
+		}
+
+
+		/**
+		 * Returns the element containing @a s (with its reference count incremented), or NULL
+		 * if there is no such element.
+		 */
+		const ElementType *
+		find_and_add_ref(
+				const UnicodeString &s)
+		{
+			const std::size_t string_hash = hash(s);
+			Shard &shard = get_shard(string_hash);
+
+			boost::mutex::scoped_lock lock(shard.mutex);
+
+			typename element_set_type::iterator iter = find(shard, s, string_hash);
+			if (iter == shard.elements.end())
+			{
+				return NULL;
+			}
+
+			++iter->d_ref_count;
+			return &*iter;
+		}
+
+
+		/**
+		 * Returns the element containing @a s (with its reference count incremented), first inserting
+		 * a new element if there is no such element.
+		 */
+		const ElementType *
+		insert_and_add_ref(
+				const UnicodeString &s)
+		{
+			const std::size_t string_hash = hash(s);
+			Shard &shard = get_shard(string_hash);
+
+			boost::mutex::scoped_lock lock(shard.mutex);
+
+			typename element_set_type::iterator iter = find(shard, s, string_hash);
+			if (iter == shard.elements.end())
+			{
+				// Only now is the string copied (into the new element).
+				iter = shard.elements.emplace(s, string_hash).first;
+			}
+
+			++iter->d_ref_count;
+			return &*iter;
+		}
+
+
+		/**
+		 * Increments the reference count of @a element (which must already be referenced by the caller).
+		 */
+		static
+		void
+		add_ref(
+				const ElementType *element)
+		{
+			++element->d_ref_count;
+		}
+
+
+		/**
+		 * Decrements the reference count of @a element, and removes it from the table if that was
+		 * the last reference.
+		 */
+		void
+		release(
+				const ElementType *element)
+		{
+			// Decrement without locking as long as it's not the last reference.
+			long ref_count = element->d_ref_count.load();
+			while (ref_count > 1)
+			{
+				if (element->d_ref_count.compare_exchange_weak(ref_count, ref_count - 1))
+				{
+					return;
+				}
+			}
+
+			// It might be the last reference, so decrement while locked. Another thread could
+			// have found the element (and incremented its reference count) since we checked.
+			Shard &shard = get_shard(element->d_hash);
+			boost::mutex::scoped_lock lock(shard.mutex);
+
+			if (--element->d_ref_count == 0)
+			{
+				// There are no more references to the element.
+				// Note that this destroys 'element'.
+				shard.elements.erase(find(shard, element->d_str, element->d_hash));
+			}
+		}
+
+	private:
+
+		//! Hashes an element using its precomputed hash.
+		struct ElementHash
+		{
+			std::size_t
+			operator()(
+					const ElementType &element) const
+			{
+				return element.d_hash;
+			}
+		};
+
+		//! Compares the strings of elements (comparing hashes first).
+		struct ElementEqual
+		{
+			bool
+			operator()(
+					const ElementType &lhs,
+					const ElementType &rhs) const
+			{
+				return lhs.d_hash == rhs.d_hash &&
+						lhs.d_str == rhs.d_str;
+			}
+		};
+
+		/**
+		 * A string (and its hash) to look up without constructing an element.
+		 */
+		struct StringKey
+		{
+			StringKey(
+					const UnicodeString &str_,
+					std::size_t hash_) :
+				str(str_),
+				hash(hash_)
+			{  }
+
+			const UnicodeString &str;
+			std::size_t hash;
+		};
+
+		//! Hashes a string key using its precomputed hash.
+		struct StringKeyHash
+		{
+			std::size_t
+			operator()(
+					const StringKey &key) const
+			{
+				return key.hash;
+			}
+		};
+
+		//! Compares a string key with an element (comparing hashes first).
+		struct StringKeyEqual
+		{
+			bool
+			operator()(
+					const StringKey &key,
+					const ElementType &element) const
+			{
+				return key.hash == element.d_hash &&
+						key.str == element.d_str;
+			}
+
+			bool
+			operator()(
+					const ElementType &element,
+					const StringKey &key) const
+			{
+				return operator()(key, element);
+			}
+		};
+
+		typedef boost::unordered_set<ElementType, ElementHash, ElementEqual> element_set_type;
+
+		struct Shard
+		{
+			mutable boost::mutex mutex;
+			element_set_type elements;
+		};
+
+
+		Shard d_shards[NUM_SHARDS];
+
+
+		static
+		unsigned int
+		get_shard_index(
+				std::size_t string_hash)
+		{
+			// Use the high bits of the (32-bit) hash since the low bits select the hash table bucket.
+			return (string_hash >> 16) & (NUM_SHARDS - 1);
+		}
+
+		Shard &
+		get_shard(
+				std::size_t string_hash)
+		{
+			return d_shards[get_shard_index(string_hash)];
+		}
+
+		/**
+		 * Finds the element containing @a s (with hash @a string_hash) in @a shard (which must be locked).
+		 */
+		static
+		typename element_set_type::iterator
+		find(
+				Shard &shard,
+				const UnicodeString &s,
+				std::size_t string_hash)
+		{
+			return shard.elements.find(StringKey(s, string_hash), StringKeyHash(), StringKeyEqual());
+		}
+	};
+}
+
+#endif // GPLATES_UTILS_SHARDEDSTRINGTABLE_H
@@ -25,8 +25,10 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <cmath>
 #include <iomanip>
 #include <sstream>
+#include <boost/cstdint.hpp>
 
 #include "StringFormattingUtils.h"
 
@@ -132,6 +134,104 @@ GPlatesUtils::formatted_double_to_string(
 }
 
 
+void
+GPlatesUtils::append_formatted_double(
+		std::string &str,
+		const double &val,
+		unsigned width,
+		unsigned prec)
+{
+	GPlatesGlobal::Assert<InvalidFormattingParametersException>(
+			prec > 0 && prec <= MAX_APPEND_FORMATTED_DOUBLE_PRECISION,
+			GPLATES_ASSERTION_SOURCE,
+			"Attempt to format a real number using an unsupported precision.");
+
+	// The number 3 below is the number of characters required to represent (1) the decimal point,
+	// (2) the minus sign, and (3) at least one digit to the left of the decimal point.
+	// This is the same precondition as 'formatted_double_to_string()' (which we can fall back to).
+	GPlatesGlobal::Assert<InvalidFormattingParametersException>(
+			width >= prec + 3,
+			GPLATES_ASSERTION_SOURCE,
+			"Attempted to format a real number with parameters that don't "\
+			"leave enough space for the decimal point, sign, and integral part.");
+
+	static const boost::uint64_t POWERS_OF_TEN[MAX_APPEND_FORMATTED_DOUBLE_PRECISION + 1] =
+	{
+		1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+		100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+		10000000000000ULL, 100000000000000ULL, 1000000000000000ULL
+	};
+	// Beyond this a double has no fractional bits, so we cannot round exactly below.
+	static const double MAX_SCALED_VALUE = 4503599627370496.0; // 2^52
+
+	const boost::uint64_t scale = POWERS_OF_TEN[prec];
+	const double abs_val = std::fabs(val);
+	const double scaled_val = abs_val * scale;
+
+	// Note that this comparison is also false for NaN.
+	if (!(scaled_val < MAX_SCALED_VALUE))
+	{
+		str += formatted_double_to_string(val, width, prec);
+		return;
+	}
+
+	// The product 'scaled_val' has been rounded and 'rounding_error' is exactly what was lost
+	// (so 'scaled_val + rounding_error' is the exact scaled value).
+	//
+	// The fractional part of 'scaled_val' is a multiple of its ULP and the rounding error is at
+	// most half an ULP, so the rounding error can only change the rounding direction when the
+	// fractional part is exactly one half.
+	const double rounding_error = std::fma(abs_val, double(scale), -scaled_val);
+	const double floor_scaled_val = std::floor(scaled_val);
+	const double fraction = scaled_val - floor_scaled_val;
+
+	boost::uint64_t digits = static_cast<boost::uint64_t>(floor_scaled_val);
+	if (fraction > 0.5 ||
+		(fraction == 0.5 &&
+			(rounding_error > 0 ||
+				// Exactly half way so round to even...
+				(rounding_error == 0 && (digits & 1) != 0))))
+	{
+		++digits;
+	}
+
+	// Write the characters backwards (from the last fractional digit).
+	// Largest is a sign, 16 integral digits, the decimal point and 15 fractional digits.
+	char buffer[40];
+	char *const buffer_end = buffer + sizeof(buffer);
+	char *pos = buffer_end;
+
+	boost::uint64_t fractional_digits = digits % scale;
+	for (unsigned int n = 0; n < prec; ++n)
+	{
+		*--pos = static_cast<char>('0' + fractional_digits % 10);
+		fractional_digits /= 10;
+	}
+	*--pos = '.';
+
+	boost::uint64_t integral_digits = digits / scale;
+	do
+	{
+		*--pos = static_cast<char>('0' + integral_digits % 10);
+		integral_digits /= 10;
+	}
+	while (integral_digits != 0);
+
+	// Negative zero is also written with a minus sign (like the stream formatting).
+	if (std::signbit(val))
+	{
+		*--pos = '-';
+	}
+
+	const unsigned int num_chars = buffer_end - pos;
+	if (num_chars < width)
+	{
+		str.append(width - num_chars, ' ');
+	}
+	str.append(pos, num_chars);
+}
+
+
 const std::string
 GPlatesUtils::formatted_int_to_string(
 		int val,
@@ -92,6 +92,35 @@ namespace GPlatesUtils
 			bool elide_trailing_zeroes = false);
 
 
+	/**
+	 * The maximum precision supported by @a append_formatted_double.
+	 */
+	static const unsigned int MAX_APPEND_FORMATTED_DOUBLE_PRECISION = 15;
+
+	/**
+	 * Appends a real number to @a str in the same format as 'formatted_double_to_string()'
+	 * (right-justified in 'width' characters, with exactly 'prec' digits to the right of the
+	 * decimal place) but without the overhead of a string stream.
+	 *
+	 * This is intended for writing large numbers of coordinates (such as in GMT exports).
+	 * The default precision of 6 matches 'formatted_double_to_string()' with IGNORE_PRECISION.
+	 *
+	 * The result is the same as 'formatted_double_to_string()' (ie, correctly rounded, with
+	 * ties going to even). Values that are not finite or too large to round exactly fall back
+	 * to 'formatted_double_to_string()'.
+	 *
+	 * As with 'formatted_double_to_string()', 'width' must be at least 'prec + 3'.
+	 *
+	 * This is thread-safe.
+	 */
+	void
+	append_formatted_double(
+			std::string &str,
+			const double &val,
+			unsigned width,
+			unsigned prec = 6);
+
+
 	const std::string
 	formatted_int_to_string(
 			int val,
@@ -49,7 +49,7 @@ GPlatesUtils::StringSet::SharedIterator::operator==(
 		return true;
 	}
 
-	return (d_iter == other.d_iter);
+	return (d_element == other.d_element);
 }
 
 
@@ -61,7 +61,7 @@ GPlatesUtils::StringSet::SharedIterator::increment_ref_count()
 		// This instance is uninitialised.
 		return;
 	}
-	++(d_iter->d_ref_count);
+	collection_type::add_ref(d_element);
 }
 
 
@@ -73,11 +73,8 @@ GPlatesUtils::StringSet::SharedIterator::decrement_ref_count()
 		// This instance is uninitialised.
 		return;
 	}
-	if (--(d_iter->d_ref_count) == 0)
-	{
-		// There are no more references to the element in the set.
-		d_impl_ptr->collection().erase(d_iter);
-	}
+	// If there are no more references to the element then it is removed from the set.
+	d_impl_ptr->collection().release(d_element);
 }
 
 
@@ -85,12 +82,11 @@ const boost::optional<GPlatesUtils::StringSet::SharedIterator>
 GPlatesUtils::StringSet::contains(
 		const GPlatesUtils::UnicodeString &s) const
 {
-	UnicodeStringAndRefCount elem(s);
-	collection_type::iterator iter = d_impl->collection().find(elem);
-	if (iter != d_impl->collection().end())
+	const UnicodeStringAndRefCount *element = d_impl->collection().find_and_add_ref(s);
+	if (element != NULL)
 	{
-		// The element already exists in the set.
-		SharedIterator sh_iter(iter, d_impl);
+		// The element already exists in the set (and its reference-count has been incremented for us).
+		SharedIterator sh_iter(element, d_impl, false/*add_ref*/);
 		return sh_iter;
 	}
 	else
@@ -104,19 +100,9 @@ GPlatesUtils::StringSet::SharedIterator
 GPlatesUtils::StringSet::insert(
 		const GPlatesUtils::UnicodeString &s)
 {
-	UnicodeStringAndRefCount elem(s);
-	collection_type::iterator iter = d_impl->collection().find(elem);
-	if (iter != d_impl->collection().end())
-	{
-		// The element already exists in the set.
-		SharedIterator sh_iter(iter, d_impl);
-		return sh_iter;
-	}
-	else
-	{
-		std::pair< collection_type::iterator, bool > insertion = d_impl->collection().insert(elem);
-		// Now the element exists in the set.
-		SharedIterator sh_iter(insertion.first, d_impl);
-		return sh_iter;
-	}
+	// Insert the element if it's not already in the set (its reference-count is incremented for us).
+	const UnicodeStringAndRefCount *element = d_impl->collection().insert_and_add_ref(s);
+	SharedIterator sh_iter(element, d_impl, false/*add_ref*/);
+	return sh_iter;
 }
+
@@ -33,11 +33,13 @@
 #endif
 
 #include <algorithm>
-#include <set>
+#include <atomic>
+#include <cstddef>
 #include <boost/intrusive_ptr.hpp>
 #include <boost/optional.hpp>
 
 #include "ReferenceCount.h"
+#include "ShardedStringTable.h"
 
 #include "global/unicode.h"
 
@@ -63,16 +65,14 @@ namespace GPlatesUtils
 	 * strings contained in a StringSet instance:  Instead of comparing the Unicode strings
 	 * code-point by code-point, it is sufficient to compare iterators.
 	 *
-	 * (However, it is still necessary to use less-than comparisons of the Unicode strings for
-	 * the internal strict weak ordering of the set; these less-than comparisons of the Unicode
-	 * strings compare code-point by code-point.  Thus, while the cost to compare iterators is
-	 * O(1), the cost to insert a string is O(L log N), where L is the length of the strings
-	 * and N is the number of elements in the StringSet instance.  Though in many cases, the
-	 * insertion of a string into a StringSet occurs within a function which is invoked many
-	 * times (for example, a function which reads a particular type of feature from file); the
-	 * iterator returned by the insertion may be stored in a function-scope static variable,
-	 * meaning that the O(L log N) insertion only needs to happen once for that string (for
-	 * example, the feature type).)
+	 * (However, it is still necessary to hash and compare the Unicode strings when inserting
+	 * a string; these comparisons compare code-point by code-point.  Thus, while the cost to
+	 * compare iterators is O(1), the cost to insert a string is O(L), where L is the length of
+	 * the string.  Though in many cases, the insertion of a string into a StringSet occurs within
+	 * a function which is invoked many times (for example, a function which reads a particular
+	 * type of feature from file); the iterator returned by the insertion may be stored in a
+	 * function-scope static variable, meaning that the insertion only needs to happen once for
+	 * that string (for example, the feature type).)
 	 *
 	 * The main benefits of class StringSet are:
 	 *  -# the significant reduction in memory usage when there would be many occurrences of a
@@ -117,18 +117,27 @@ namespace GPlatesUtils
 	 * constructor.  The StringSet instance wraps the StringSetImpl, providing an interface to
 	 * manipulate its contents.  The StringSet instance also assumes part of the responsibility
 	 * for the management of the lifetime of the StringSetImpl.
-	 *  -# A StringSetImpl instance contains a @c std::set of UnicodeString instances, each
+	 *  -# A StringSetImpl instance contains a hash table (see ShardedStringTable) of
+	 * UnicodeString instances, each
 	 * with an associated reference-count.  The UnicodeString instance and associated
-	 * reference-count together compose an element of the @c std::set, although only the
+	 * reference-count together compose an element of the hash table, although only the
 	 * UnicodeString instance is accessible by clients of StringSet (the reference-count is not
 	 * part of the class abstraction).  The reference-count of an element is the number of
 	 * SharedIterator instances which currently reference that element.
 	 *  -# Since a UnicodeString instance is only contained within the conceptual StringSet
 	 * instance as long as there are one or more SharedIterator instances which reference the
-	 * StringSet element, every element in StringSetImpl's @c std::set has a reference-count
+	 * StringSet element, every element in StringSetImpl's hash table has a reference-count
 	 * which is greater than zero.  When the reference-count reaches zero, the element is
 	 * removed.
 	 *
+	 * @par Thread-safety:
+	 *  -# A StringSet instance can be accessed concurrently from multiple threads (for example,
+	 * when loading files in parallel), and SharedIterator instances can be copied and destroyed
+	 * concurrently (as long as each SharedIterator instance is only used by one thread at a time).
+	 *  -# The hash table is split into shards, each with its own lock, so threads rarely contend.
+	 * Incrementing a reference-count does not lock; only releasing the last reference to an
+	 * element locks (so that the element can be removed before another thread can find it).
+	 *
 	 * @par Abstraction invariants:
 	 *  -# The StringSet instance contains the set of UnicodeStrings which have been inserted
 	 * by client code (using the @a insert member function), for which the number of
@@ -143,9 +152,9 @@ namespace GPlatesUtils
 	 * pointed-to by the impl-pointer of any other StringSet instance.
 	 *  -# The reference-count of each element corresponds to the number of SharedIterator
 	 * instances referencing that element.
-	 *  -# The @c std::set contains at most one element for any UnicodeString instance.  (Note
-	 * that this is not automatically implied by the uniqueness of elements in the @a std::set,
-	 * since an element of the @c std::set is a UnicodeString instance and a reference-count.)
+	 *  -# The hash table contains at most one element for any UnicodeString instance.  (Note
+	 * that this is not automatically implied by the uniqueness of elements in the hash table,
+	 * since an element of the hash table is a UnicodeString instance and a reference-count.)
 	 *  -# The location in memory of the element for a particular UnicodeString will not change
 	 * as long as the reference count of that element is greater than zero.
 	 *  -# The class does not contain any elements which have a reference-count less than one.
@@ -154,21 +163,23 @@ namespace GPlatesUtils
 	{
 	public:
 		/**
-		 * This is the element which is contained in the @c std::set inside StringSetImpl.
+		 * This is the element which is contained in the hash table inside StringSetImpl.
 		 */
 		struct UnicodeStringAndRefCount
 		{
-			GPlatesUtils::UnicodeString d_str;
-			mutable long d_ref_count;
+			const GPlatesUtils::UnicodeString d_str;
+			const std::size_t d_hash;
+			mutable std::atomic<long> d_ref_count;
 
 			/**
 			 * Construct a UnicodeStringAndRefCount instance for the UnicodeString
-			 * instance @a str.
+			 * instance @a str (with hash @a hash).
 			 */
-			explicit
 			UnicodeStringAndRefCount(
-					const GPlatesUtils::UnicodeString &str) :
+					const GPlatesUtils::UnicodeString &str,
+					std::size_t hash) :
 				d_str(str),
+				d_hash(hash),
 				d_ref_count(0) {  }
 
 			/**
@@ -179,26 +190,14 @@ namespace GPlatesUtils
 			 * initialise the ref-count to zero.
 			 *
 			 * This constructor is necessary so that UnicodeStringAndRefCount can be
-			 * stored as an element in @c std::set.
+			 * stored as an element in the hash table.
 			 */
 			UnicodeStringAndRefCount(
 					const UnicodeStringAndRefCount &other):
 				d_str(other.d_str),
+				d_hash(other.d_hash),
 				d_ref_count(0)
 			{  }
-
-			/**
-			 * Provide a "less than" comparison for UnicodeStringAndRefCount instances.
-			 *
-			 * A "less than" comparison is used by 'std::set' to position elements in
-			 * its internal balanced binary tree.
-			 */
-			bool
-			operator<(
-					const UnicodeStringAndRefCount &other) const
-			{
-				return GPLATES_ICU_BOOL(d_str < other.d_str);
-			}
 		private:
 			/**
 			 * Do not define the copy-assignment operator.
@@ -210,7 +209,7 @@ namespace GPlatesUtils
 		};
 
 
-		typedef std::set< UnicodeStringAndRefCount > collection_type;
+		typedef ShardedStringTable< UnicodeStringAndRefCount > collection_type;
 		typedef collection_type::size_type size_type;
 
 
@@ -286,40 +285,40 @@ namespace GPlatesUtils
 		 *
 		 * @par Implementation (white box) description:
 		 * (This description complements the abstraction description.)
-		 *  -# An instance of SharedIterator contains an iterator into the collection
+		 *  -# An instance of SharedIterator contains a pointer to an element of the collection
 		 * contained within the StringSetImpl instance of the SharedIterator's StringSet.
 		 * It also contains a pointer-to-StringSetImpl.
-		 *  -# If a SharedIterator instance was default-constructed, the contained iterator
+		 *  -# If a SharedIterator instance was default-constructed, the contained element pointer
 		 * will be uninitialised and the pointer-to-StringSetImpl will be NULL.  Thus, by
 		 * examining the pointer-to-StringSetImpl, it may be determined whether an instance
 		 * was default-constructed or not.
 		 *  -# If a SharedIterator instance was constructed with parameters, it will have
-		 * been passed an iterator which is assumed to point into the @c std::set contained
+		 * been passed an element pointer which is assumed to point into the hash table contained
 		 * within a StringSetImpl, and a pointer-to-StringSetImple which is assumed to
-		 * point to the StringSetImpl instance containing the @c std::set.  The
+		 * point to the StringSetImpl instance containing the hash table.  The
 		 * SharedIterator instance will assume part of the responsibility for the
 		 * management of the lifetime of the StringSetImpl instance.
-		 *  -# Each element contained within the @c std::set inside a StringSetImpl
+		 *  -# Each element contained within the hash table inside a StringSetImpl
 		 * instance is a UnicodeString instance with an associated reference-count.  When
 		 * a SharedIterator instance is constructed with parameters, it is assumed to be
-		 * referencing the an element within the @c std::set; the reference-count of the
+		 * referencing the an element within the hash table; the reference-count of the
 		 * element will be incremented.
 		 *  -# When a SharedIterator instance is copy-constructed, if the original
-		 * SharedIterator instance references an element within the @c std::set, the
+		 * SharedIterator instance references an element within the hash table, the
 		 * newly-instantiated SharedIterator instance will reference that same element, and
 		 * the reference-count of the element will be incremented.  If the original
 		 * SharedIterator instance is uninitialised, the newly-instantiated instance will
 		 * be uninitialised also.
 		 *  -# When a SharedIterator instance is destroyed, if it referenced an element of
-		 * the @c std::set, the reference-count of the element will be decremented; if the
+		 * the hash table, the reference-count of the element will be decremented; if the
 		 * SharedIterator instance held the last reference to the element, the element will
-		 * be removed from the @c std::set.  If the SharedIterator instance was the last
+		 * be removed from the hash table.  If the SharedIterator instance was the last
 		 * SharedIterator or StringSet instance responsible for managing the lifetime of
 		 * the StringSetImpl instance, the StringSetImpl instance will also be
 		 * de-allocated.
 		 *  -# When a SharedIterator instance is copy-assigned to another instance, the
 		 * copy-assignment function acts to handle the increment/decrement of the number of
-		 * references to elements of the @c std::set :  if a SharedIterator instance is
+		 * references to elements of the hash table :  if a SharedIterator instance is
 		 * being assigned to itself, there will be no net change in the number of
 		 * references; if the l-value of the assignment referenced an element before the
 		 * assignment, that reference will be undone (the reference-count will be
@@ -348,14 +347,14 @@ namespace GPlatesUtils
 		 * @par Implementation invariants:
 		 * (These collectively imply the abstraction invariants.)
 		 *  -# Either the pointer-to-StringSetImpl is NULL, or it points to the
-		 * StringSetImpl instance contained within a StringSet instance and the iterator
-		 * points to an element of the @a std::set contained within the StringSetImpl
+		 * StringSetImpl instance contained within a StringSet instance and the element pointer
+		 * points to an element of the hash table contained within the StringSetImpl
 		 * instance.
 		 *  -# If the pointer-to-StringSetImpl is non-NULL, the StringSetImpl instance will
 		 * have a reference-count which is one greater than it would be if the
 		 * pointer-to-StringSetImpl were not pointing to that StringSetImpl instance, and
-		 * the UnicodeString element of the @c std::set will have a reference-count which
-		 * is one greater than it would be if the iterator did not reference it.
+		 * the UnicodeString element of the hash table will have a reference-count which
+		 * is one greater than it would be if the element pointer did not reference it.
 		 */
 		class SharedIterator
 		{
@@ -366,6 +365,7 @@ namespace GPlatesUtils
 			 * This function will not throw.
 			 */
 			SharedIterator() :
+					d_element(NULL),
 					d_impl_ptr(NULL) {  }
 
 			/**
@@ -373,18 +373,25 @@ namespace GPlatesUtils
 			 * element of a StringSet instance.
 			 *
 			 * It is assumed that @a impl is a non-NULL pointer to a StringSetImpl
-			 * instance, and @a iter points to an element of the @a std::set contained
+			 * instance, and @a element points to an element of the hash table contained
 			 * within the StringSetImpl instance.
 			 *
+			 * If @a add_ref is false then the reference-count of the element is not
+			 * incremented (because the caller has already incremented it on our behalf).
+			 *
 			 * This function will not throw.
 			 */
 			SharedIterator(
-					collection_type::iterator iter,
-					boost::intrusive_ptr<StringSetImpl> impl) :
-				d_iter(iter),
+					const UnicodeStringAndRefCount *element,
+					boost::intrusive_ptr<StringSetImpl> impl,
+					bool add_ref = true) :
+				d_element(element),
 				d_impl_ptr(impl)
 			{
-				increment_ref_count();
+				if (add_ref)
+				{
+					increment_ref_count();
+				}
 			}
 
 			/**
@@ -394,7 +401,7 @@ namespace GPlatesUtils
 			 */
 			SharedIterator(
 					const SharedIterator &other) :
-				d_iter(other.d_iter),
+				d_element(other.d_element),
 				d_impl_ptr(other.d_impl_ptr)
 			{
 				increment_ref_count();
@@ -461,7 +468,7 @@ namespace GPlatesUtils
 			swap(
 					SharedIterator &other)
 			{
-				std::swap(d_iter, other.d_iter);
+				std::swap(d_element, other.d_element);
 				std::swap(d_impl_ptr, other.d_impl_ptr);
 			}
 
@@ -553,19 +560,19 @@ namespace GPlatesUtils
 			}
 		private:
 			/**
-			 * An iterator to an element in the std::set contained in StringSetImpl.
+			 * A pointer to an element in the hash table contained in StringSetImpl.
 			 *
-			 * The collection-type iterator is only meaningful if the impl-pointer is
+			 * The element pointer is only meaningful if the impl-pointer is
 			 * non-NULL (which means that the shared iterator instance is initialised).
 			 */
-			collection_type::iterator d_iter;
+			const UnicodeStringAndRefCount *d_element;
 
 			/**
 			 * An intrusive-pointer which manages the StringSetImpl instance.
 			 *
-			 * We need a pointer to the StringSetImpl instance (or the std::set which
-			 * it contains) in order to be able to invoke the 'erase' member function
-			 * of std::set.
+			 * We need a pointer to the StringSetImpl instance (or the hash table which
+			 * it contains) in order to be able to remove an element from the hash table
+			 * when its last reference is released.
 			 *
 			 * Since we have a pointer to the StringSetImpl instance, we're also using
 			 * it to indicate (based upon whether it is NULL or non-NULL) whether this
@@ -580,7 +587,7 @@ namespace GPlatesUtils
 			const GPlatesUtils::UnicodeString &
 			access_target() const
 			{
-				return d_iter->d_str;
+				return d_element->d_str;
 			}
 
 			void
@@ -632,7 +639,7 @@ namespace GPlatesUtils
 		 * which matches the UnicodeString instance @a s, or is @c boost::none if @a s is
 		 * not contained within the StringSet instance.
 		 *
-		 * This function might throw whatever the copy-constructor and less-than-comparison
+		 * This function might throw whatever the copy-constructor and equality-comparison
 		 * operator of UnicodeString might throw.  This function is strongly exception-safe
 		 * and exception-neutral.
 		 */
@@ -646,8 +653,8 @@ namespace GPlatesUtils
 		 *
 		 * If the UnicodeString instance @a s is not yet contained within the StringSet
 		 * instance, it will be inserted (or an exception will be thrown, in the case of
-		 * copy-construction failure or less-than-comparison failure for the UnicodeString
-		 * instance, or memory allocation failure for @c std::set).
+		 * copy-construction failure or equality-comparison failure for the UnicodeString
+		 * instance, or memory allocation failure for the hash table).
 		 *
 		 * @return The SharedIterator instance which points to the element of the StringSet
 		 * instance which matches the UnicodeString instance @a s.
@@ -658,9 +665,9 @@ namespace GPlatesUtils
 		 * instance, or an exception has been thrown.  Return-value is a SharedIterator
 		 * instance which points to the element for the UnicodeString instance @a s.
 		 *
-		 * This function might throw whatever the copy-constructor and less-than-comparison
-		 * operator of UnicodeString might throw, as well as whatever the @a insert
-		 * function of @c std::set might throw.  This function is strongly exception-safe
+		 * This function might throw whatever the copy-constructor and equality-comparison
+		 * operator of UnicodeString might throw, as well as whatever the hash table
+		 * might throw when inserting.  This function is strongly exception-safe
 		 * and exception-neutral.
 		 */
 		SharedIterator